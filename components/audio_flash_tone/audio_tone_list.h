@@ -0,0 +1,17 @@
+/* Generated by tools/gen_tone_bin.py from tools/tones/tones.json, do not edit */
+#ifndef __AUDIO_TONE_LIST_H__
+#define __AUDIO_TONE_LIST_H__
+
+typedef enum {
+    TONE_TYPE_BT_MODE,
+    TONE_TYPE_INTRO_MODE,
+    TONE_TYPE_SD_MODE,
+    TONE_TYPE_WIFI_MODE,
+    TONE_TYPE_VOLUME_MAX,
+    TONE_TYPE_VOLUME_MIN,
+    TONE_TYPE_STATION_CHANGED,
+    TONE_TYPE_ERROR,
+    TONE_TYPE_MAX,
+} tone_type_t;
+
+#endif
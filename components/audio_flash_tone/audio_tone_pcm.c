@@ -0,0 +1,72 @@
+#include <string.h>
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "audio_tone_pcm.h"
+
+static const char *TAG = "AUDIO_TONE_PCM";
+
+static const uint8_t *s_image;
+static size_t s_image_size;
+static spi_flash_mmap_handle_t s_mmap_handle;
+
+esp_err_t audio_tone_pcm_map(void)
+{
+    if (s_image) {
+        return ESP_OK;
+    }
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY,
+                                                           AUDIO_TONE_PCM_PARTITION);
+    if (part == NULL) {
+        ESP_LOGE(TAG, "No %s partition", AUDIO_TONE_PCM_PARTITION);
+        return ESP_ERR_NOT_FOUND;
+    }
+    const void *ptr = NULL;
+    esp_err_t ret = esp_partition_mmap(part, 0, part->size, SPI_FLASH_MMAP_DATA, &ptr, &s_mmap_handle);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to map %s, %s", AUDIO_TONE_PCM_PARTITION, esp_err_to_name(ret));
+        return ret;
+    }
+    const audio_tone_pcm_header_t *header = ptr;
+    if (memcmp(header->magic, AUDIO_TONE_PCM_MAGIC, sizeof(header->magic)) != 0
+        || header->version != AUDIO_TONE_PCM_VERSION
+        || header->channels != 1 || header->bits != 16) {
+        ESP_LOGE(TAG, "The %s partition does not hold a v%d PCM tone image, flash tools/audio_tone_pcm.bin",
+                 AUDIO_TONE_PCM_PARTITION, AUDIO_TONE_PCM_VERSION);
+        spi_flash_munmap(s_mmap_handle);
+        return ESP_ERR_INVALID_VERSION;
+    }
+    if (header->tone_num < TONE_TYPE_MAX) {
+        ESP_LOGW(TAG, "Image has %d tones, firmware expects %d", header->tone_num, TONE_TYPE_MAX);
+    }
+    s_image = ptr;
+    s_image_size = part->size;
+    ESP_LOGI(TAG, "Mapped %d tones at %d Hz", header->tone_num, header->sample_rate);
+    return ESP_OK;
+}
+
+esp_err_t audio_tone_pcm_get(tone_type_t type, audio_tone_pcm_t *tone)
+{
+    if (s_image == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    const audio_tone_pcm_header_t *header = (const audio_tone_pcm_header_t *)s_image;
+    if (type < 0 || type >= header->tone_num) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    const audio_tone_pcm_entry_t *entry = (const audio_tone_pcm_entry_t *)(header + 1) + type;
+    if (entry->offset + entry->samples * sizeof(int16_t) > s_image_size) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    tone->pcm = (const int16_t *)(s_image + entry->offset);
+    tone->samples = entry->samples;
+    tone->sample_rate = header->sample_rate;
+    return ESP_OK;
+}
+
+void audio_tone_pcm_unmap(void)
+{
+    if (s_image) {
+        spi_flash_munmap(s_mmap_handle);
+        s_image = NULL;
+    }
+}
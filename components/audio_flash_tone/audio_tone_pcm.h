@@ -0,0 +1,51 @@
+#ifndef __AUDIO_TONE_PCM_H__
+#define __AUDIO_TONE_PCM_H__
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "audio_tone_list.h"
+
+/*
+ * Pre-decoded prompt tones stored in the `flash_tone` partition.
+ * The image is produced by tools/gen_tone_bin.py and read in place through a flash mmap.
+ */
+
+#define AUDIO_TONE_PCM_MAGIC        "TPCM"
+#define AUDIO_TONE_PCM_VERSION      (1)
+#define AUDIO_TONE_PCM_PARTITION    "flash_tone"
+
+typedef struct {
+    char        magic[4];
+    uint16_t    version;
+    uint16_t    tone_num;
+    uint32_t    sample_rate;
+    uint16_t    channels;
+    uint16_t    bits;
+} audio_tone_pcm_header_t;
+
+typedef struct {
+    uint32_t    offset;     /* Byte offset of the first sample from the start of the partition */
+    uint32_t    samples;
+} audio_tone_pcm_entry_t;
+
+typedef struct {
+    const int16_t   *pcm;   /* Points into the mapped partition, never copied */
+    uint32_t        samples;
+    uint32_t        sample_rate;
+} audio_tone_pcm_t;
+
+/**
+ * @brief Map the flash_tone partition and validate the image header
+ *
+ * @return ESP_OK on success, ESP_ERR_NOT_FOUND without the partition, ESP_ERR_INVALID_VERSION on a foreign image
+ */
+esp_err_t audio_tone_pcm_map(void);
+
+/**
+ * @brief Look up a tone in the mapped image
+ */
+esp_err_t audio_tone_pcm_get(tone_type_t type, audio_tone_pcm_t *tone);
+
+void audio_tone_pcm_unmap(void);
+
+#endif
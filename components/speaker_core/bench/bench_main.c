@@ -0,0 +1,525 @@
+/*
+ * Host benchmark of the speaker core: the EQ/gain/limiter kernel, the
+ * fixed-rate and the drift resampler and the crossfade mixer on fixed test
+ * signals, the drift estimator against a simulated Bluetooth source, the ICY
+ * metadata parser on a synthetic stream, and the control logic against a stub
+ * board HAL.
+ *
+ * The kernel figures are samples per second of one host core; compare them
+ * between commits on the same machine, not against the target. Every kernel
+ * run also prints a checksum of its output, a change there without a change to
+ * the tables means the processing itself changed.
+ */
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "loudness_table.h"
+#include "speaker_kernel.h"
+#include "speaker_control.h"
+#include "speaker_resampler.h"
+#include "speaker_asrc.h"
+#include "speaker_drift.h"
+#include "speaker_crossfade.h"
+#include "speaker_icy.h"
+
+#define BENCH_FRAMES        (1024)      /* Frames per block, as the element gets them */
+#define BENCH_BT_FRAMES     (512)       /* Stereo frames the DSP element reads from the Bluetooth source at a time */
+#define BENCH_AUDIO_S       (20)        /* Seconds of programme run per case */
+#define BENCH_CONTROL_LOOPS (200000)
+
+typedef enum {
+    SIGNAL_TONE,        /* 1 kHz at -6 dBFS over 50 Hz, drives the bass bands into the limiter */
+    SIGNAL_NOISE,       /* White noise at -12 dBFS */
+    SIGNAL_SILENCE,
+} bench_signal_t;
+
+static const char *const s_signal_names[] = { "tone", "noise", "silence" };
+
+static double bench_now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void bench_fill(int16_t *pcm, int frames, int channels, int rate, bench_signal_t signal)
+{
+    uint32_t seed = 1;
+    for (int i = 0; i < frames; i++) {
+        float s = 0.0f;
+        if (signal == SIGNAL_TONE) {
+            s = 0.5f * sinf(2 * M_PI * 1000 * i / rate) + 0.4f * sinf(2 * M_PI * 50 * i / rate);
+        } else if (signal == SIGNAL_NOISE) {
+            seed = seed * 1664525u + 1013904223u;
+            s = 0.25f * ((int32_t)seed / 2147483648.0f);
+        }
+        for (int ch = 0; ch < channels; ch++) {
+            pcm[i * channels + ch] = (int16_t)(s * 32767 * 0.9f);
+        }
+    }
+}
+
+static void bench_kernel_case(int rate, int channels, int volume, bench_signal_t signal)
+{
+    static int16_t src[BENCH_FRAMES * SPEAKER_KERNEL_MAX_CH];
+    static int16_t pcm[BENCH_FRAMES * SPEAKER_KERNEL_MAX_CH];
+    speaker_kernel_t kernel;
+    speaker_kernel_init(&kernel, 0.0f, -1.0f, 200);
+    int slot = speaker_kernel_set_rate(&kernel, rate);
+    speaker_kernel_sync(&kernel, slot, volume);
+    bench_fill(src, BENCH_FRAMES, channels, rate, signal);
+
+    int blocks = (int)((int64_t)rate * BENCH_AUDIO_S / BENCH_FRAMES);
+    uint32_t checksum = 0;
+    double start = bench_now_s();
+    for (int b = 0; b < blocks; b++) {
+        memcpy(pcm, src, BENCH_FRAMES * channels * sizeof(int16_t));
+        speaker_kernel_sync(&kernel, slot, volume);
+        speaker_kernel_run(&kernel, pcm, BENCH_FRAMES, channels);
+        checksum = checksum * 31 + (uint16_t)pcm[(b * 7) % (BENCH_FRAMES * channels)];
+    }
+    double elapsed = bench_now_s() - start;
+    double samples = (double)blocks * BENCH_FRAMES * channels;
+    printf("  %5d Hz %s vol %3d %-7s %8.2f Msamples/s %7.1f ns/frame %6.0fx realtime  sum %08x\n",
+           rate, channels == 2 ? "stereo" : "mono  ", volume, s_signal_names[signal],
+           samples / elapsed / 1e6, elapsed * 1e9 / ((double)blocks * BENCH_FRAMES),
+           BENCH_AUDIO_S / elapsed, checksum);
+}
+
+static void bench_kernel(void)
+{
+    static const int volumes[] = { 0, 50, 100 };
+    printf("EQ/gain/limiter kernel, %d s of programme per case, %d-frame blocks\n", BENCH_AUDIO_S, BENCH_FRAMES);
+    for (int r = 0; r < LOUDNESS_RATE_NUM; r++) {
+        for (size_t v = 0; v < sizeof(volumes) / sizeof(volumes[0]); v++) {
+            for (int s = SIGNAL_TONE; s <= SIGNAL_SILENCE; s++) {
+                bench_kernel_case(loudness_rates[r].sample_rate, 2, volumes[v], s);
+            }
+        }
+    }
+    /* Mono programmes, and a rate without tables: limiter only */
+    bench_kernel_case(44100, 1, 50, SIGNAL_TONE);
+    bench_kernel_case(32000, 2, 50, SIGNAL_TONE);
+}
+
+/* One ratio of the resampler on the tone: throughput, and the 1 kHz level that comes out */
+static void bench_resampler_case(const resampler_ratio_t *ratio)
+{
+    static int16_t src[BENCH_FRAMES * 2];
+    static int16_t out[(BENCH_FRAMES * RESAMPLER_MAX_RATIO_Q8 / 256 + 2) * 2];
+    static speaker_resampler_t res;
+    for (int i = 0; i < BENCH_FRAMES; i++) {
+        src[2 * i] = src[2 * i + 1] = (int16_t)(16384 * sinf(2 * M_PI * 1000 * i / ratio->in_rate));
+    }
+    speaker_resampler_set(&res, ratio, 2);
+    int blocks = (int)((int64_t)ratio->in_rate * BENCH_AUDIO_S / BENCH_FRAMES);
+    int64_t produced = 0;
+    uint32_t checksum = 0;
+    int peak = 0;
+    double start = bench_now_s();
+    for (int b = 0; b < blocks; b++) {
+        int n = speaker_resampler_run(&res, src, BENCH_FRAMES, out);
+        produced += n;
+        checksum = checksum * 31 + (uint16_t)out[(b * 7) % (n * 2)];
+        /* The block does not hold a whole number of periods, skip the seam and the start */
+        if (b == 1) {
+            for (int i = n / 4; i < n; i++) {
+                peak = abs(out[2 * i]) > peak ? abs(out[2 * i]) : peak;
+            }
+        }
+    }
+    double elapsed = bench_now_s() - start;
+    double expect = (double)blocks * BENCH_FRAMES * ratio->up / ratio->down;
+    printf("  %5d -> %5d Hz stereo %8.2f Msamples/s %7.1f ns/frame %6.0fx realtime  level %+.2f dB  sum %08x\n",
+           ratio->in_rate, ratio->out_rate, produced * 2 / elapsed / 1e6, elapsed * 1e9 / produced,
+           BENCH_AUDIO_S / elapsed, 20 * log10(peak / 16384.0), checksum);
+    if (produced < expect - 1 || produced > expect + 1) {
+        printf("  %lld frames out, %.0f expected\n", (long long)produced, expect);
+        exit(1);
+    }
+}
+
+static void bench_resampler(void)
+{
+    printf("Fixed-rate resampler, %d taps per phase, %d s of programme per ratio, %d-frame blocks\n",
+           RESAMPLER_TAPS, BENCH_AUDIO_S, BENCH_FRAMES);
+    for (int i = 0; i < RESAMPLER_RATIO_NUM; i++) {
+        bench_resampler_case(&resampler_ratios[i]);
+    }
+}
+
+/* The drift resampler at one ratio on a continuous tone: throughput, frames out against the ratio, and the level */
+static void bench_asrc_case(int ppm)
+{
+    static int16_t src[BENCH_FRAMES * 2];
+    static int16_t out[(BENCH_FRAMES + BENCH_FRAMES / 1000 + 2) * 2];
+    static speaker_asrc_t asrc;
+    const int rate = 44100;
+    speaker_asrc_reset(&asrc, 2);
+    int blocks = rate * BENCH_AUDIO_S / BENCH_FRAMES;
+    int64_t produced = 0;
+    uint32_t checksum = 0;
+    int peak = 0;
+    double elapsed = 0;
+    for (int b = 0; b < blocks; b++) {
+        for (int i = 0; i < BENCH_FRAMES; i++) {
+            int64_t t = (int64_t)b * BENCH_FRAMES + i;
+            src[2 * i] = src[2 * i + 1] = (int16_t)(16384 * sin(2 * M_PI * 1000 * (double)t / rate));
+        }
+        double start = bench_now_s();
+        int n = speaker_asrc_run(&asrc, src, BENCH_FRAMES, out, (float)ppm);
+        elapsed += bench_now_s() - start;
+        produced += n;
+        checksum = checksum * 31 + (uint16_t)out[(b * 7) % (n * 2)];
+        if (b >= 2) {
+            for (int i = 0; i < n; i++) {
+                peak = abs(out[2 * i]) > peak ? abs(out[2 * i]) : peak;
+            }
+        }
+    }
+    double expect = (double)blocks * BENCH_FRAMES / (1 + ppm * 1e-6);
+    printf("  %+4d ppm stereo %8.2f Msamples/s %7.1f ns/frame %6.0fx realtime  level %+.2f dB  sum %08x\n",
+           ppm, produced * 2 / elapsed / 1e6, elapsed * 1e9 / produced, BENCH_AUDIO_S / elapsed,
+           20 * log10(peak / 16384.0), checksum);
+    if (produced < expect - 2 || produced > expect + 2 || fabs(20 * log10(peak / 16384.0)) > 0.1) {
+        printf("  %lld frames out, %.0f expected\n", (long long)produced, expect);
+        exit(1);
+    }
+}
+
+static void bench_asrc(void)
+{
+    printf("Drift resampler, %d phases of %d taps interpolated, %d s of programme per ratio\n",
+           RESAMPLER_FRAC_PHASES, RESAMPLER_TAPS, BENCH_AUDIO_S);
+    bench_asrc_case(0);
+    bench_asrc_case(SPEAKER_ASRC_MAX_PPM);
+    bench_asrc_case(-SPEAKER_ASRC_MAX_PPM);
+    bench_asrc_case(37);
+}
+
+/*
+ * The drift estimator against a source whose clock runs `source_ppm` off
+ * ours. The source pushes its frames in bursts of one to six 128-frame
+ * packets, as an A2DP link does; the element takes a block at a time, runs
+ * it through the drift resampler at the estimated ratio and plays what comes
+ * out. After ten minutes the estimate must sit on the drift and the fill on
+ * the target over the last minute, without a slip or an underrun.
+ */
+static void bench_drift_case(int source_ppm, int target_ms)
+{
+    static int16_t block[BENCH_BT_FRAMES];
+    static int16_t out[BENCH_BT_FRAMES + BENCH_BT_FRAMES / 1000 + 2];
+    static speaker_asrc_t asrc;
+    static speaker_drift_t drift;
+    const int rate = 44100;
+    const int minutes = 10;
+    memset(block, 0, sizeof(block));
+    speaker_asrc_reset(&asrc, 1);
+    speaker_drift_init(&drift, rate, target_ms, false);
+    uint32_t seed = 7;
+    double pending = 0;         /* Frames the source has made and not sent yet */
+    int fill = drift.target;    /* Primed */
+    int burst = 128;
+    int underruns = 0;
+    bool holding = false;
+    double err_sum = 0;
+    double err_max = 0;
+    int err_samples = 0;
+    int64_t played = 0;
+    while (played < (int64_t)rate * 60 * minutes) {
+        int n;
+        if (fill < drift.target && holding) {
+            /* Waiting for the depth after a slip, the output plays a block of silence */
+            n = BENCH_BT_FRAMES;
+        } else {
+            holding = false;
+            int taken = fill < BENCH_BT_FRAMES ? fill : BENCH_BT_FRAMES;
+            underruns += taken < BENCH_BT_FRAMES;
+            n = speaker_asrc_run(&asrc, block, taken, out, drift.ratio_ppm);
+            int slip = speaker_drift_update(&drift, fill, n);
+            fill -= taken;
+            if (slip > 0) {
+                fill -= slip < fill ? slip : fill;
+            }
+            holding = slip < 0;
+        }
+        played += n;
+        pending += n * (1 + source_ppm * 1e-6);
+        while (pending >= burst) {
+            fill += burst;
+            pending -= burst;
+            seed = seed * 1664525u + 1013904223u;
+            burst = 128 * (1 + (seed >> 16) % 6);
+        }
+        if (played > (int64_t)rate * 60 * (minutes - 1)) {
+            double err = drift.fill_ms - target_ms;
+            err_sum += err;
+            err_max = fabs(err) > err_max ? fabs(err) : err_max;
+            err_samples++;
+        }
+    }
+    double bias = err_sum / err_samples;
+    printf("  source %+4d ppm, target %3d ms: drift %+7.1f ppm, ratio %+7.1f ppm, last minute fill %+.2f ms off (%.2f ms at most), "
+           "%u slips, %d underruns\n", source_ppm, target_ms, drift.drift_ppm, drift.ratio_ppm, bias, err_max, drift.slips, underruns);
+    if (fabs(drift.drift_ppm - source_ppm) > 10 || fabs(bias) > 2 || drift.slips || underruns) {
+        exit(1);
+    }
+}
+
+static void bench_drift(void)
+{
+    printf("Drift estimator, %d ms periods, simulated A2DP source in 128-frame packets\n", SPEAKER_DRIFT_PERIOD_MS);
+    bench_drift_case(0, 150);
+    bench_drift_case(300, 150);
+    bench_drift_case(-300, 150);
+    bench_drift_case(450, 40);
+    bench_drift_case(-120, 40);
+}
+
+/*
+ * The crossfade mixer: one channel fades a constant level out and the other
+ * fades it in, so every frame shows both gains and their summed power, which
+ * must stay at 0 dB all through an equal-power fade.
+ */
+static void bench_crossfade(void)
+{
+    static int16_t out[BENCH_FRAMES * 2];
+    static int16_t in[BENCH_FRAMES * 2];
+    static speaker_crossfade_t x;
+    const int rate = 44100;
+    const uint32_t len = 2 * rate;
+    printf("Crossfade mixer, %d-segment quarter sine, %u-frame fade\n", SPEAKER_CROSSFADE_STEPS, len);
+
+    speaker_crossfade_start(&x, len);
+    double worst = 0;
+    int blocks = 0;
+    bool done = false;
+    while (!done) {
+        for (int i = 0; i < BENCH_FRAMES; i++) {
+            out[2 * i] = 16384;
+            out[2 * i + 1] = 0;
+            in[2 * i] = 0;
+            in[2 * i + 1] = 16384;
+        }
+        done = speaker_crossfade_run(&x, out, in, BENCH_FRAMES, 2);
+        for (int i = 0; i < BENCH_FRAMES; i++) {
+            double power = ((double)out[2 * i] * out[2 * i] + (double)out[2 * i + 1] * out[2 * i + 1]) / (16384.0 * 16384.0);
+            double db = fabs(10 * log10(power));
+            worst = db > worst ? db : worst;
+        }
+        blocks++;
+    }
+    int tail = BENCH_FRAMES - 1;
+    printf("  power within %.3f dB over %d blocks, last frame out %d in %d\n", worst, blocks, out[2 * tail], out[2 * tail + 1]);
+    if (worst > 0.05 || out[2 * tail] != 0 || out[2 * tail + 1] != 16384 || blocks != (int)((len + BENCH_FRAMES - 1) / BENCH_FRAMES)) {
+        exit(1);
+    }
+
+    /* Throughput on two programmes, restarted so every frame is mixed */
+    bench_fill(out, BENCH_FRAMES, 2, rate, SIGNAL_TONE);
+    bench_fill(in, BENCH_FRAMES, 2, rate, SIGNAL_NOISE);
+    static int16_t mix[BENCH_FRAMES * 2];
+    int total = rate * BENCH_AUDIO_S / BENCH_FRAMES;
+    uint32_t checksum = 0;
+    speaker_crossfade_start(&x, (uint32_t)total * BENCH_FRAMES);
+    double start = bench_now_s();
+    for (int b = 0; b < total; b++) {
+        memcpy(mix, out, sizeof(mix));
+        speaker_crossfade_run(&x, mix, in, BENCH_FRAMES, 2);
+        checksum = checksum * 31 + (uint16_t)mix[(b * 7) % (BENCH_FRAMES * 2)];
+    }
+    double elapsed = bench_now_s() - start;
+    long frames = (long)total * BENCH_FRAMES;
+    printf("  44100 Hz stereo %8.2f Msamples/s %7.1f ns/frame %6.0fx realtime  sum %08x\n",
+           frames * 2 / elapsed / 1e6, elapsed * 1e9 / frames, BENCH_AUDIO_S / elapsed, checksum);
+}
+
+/*
+ * The ICY parser: a counting byte stream with a metadata block after every
+ * `metaint` bytes, fed in reads of an odd size so blocks and titles are split
+ * across reads. Every audio byte must come out in order and every title once.
+ */
+static void bench_icy(void)
+{
+    static const char *const titles[] = {
+        "Artist - Song", "Guns N' Roses - Don't Cry", "Guns N' Roses - Don't Cry", "",
+    };
+    const int metaint = 8000;
+    const int read_len = 1459;
+    const int blocks = 400;
+    static uint8_t stream[(8000 + 1 + 16 * 8) * 400];
+    int len = 0;
+    uint8_t audio = 0;
+    for (int b = 0; b < blocks; b++) {
+        for (int i = 0; i < metaint; i++) {
+            stream[len++] = audio++;
+        }
+        /* Every other block carries no metadata, as servers send it */
+        char meta[16 * 8] = { 0 };
+        if (b % 2 == 0) {
+            snprintf(meta, sizeof(meta), "StreamTitle='%s';StreamUrl='http://x/;y';", titles[(b / 2) % 4]);
+        }
+        int n = (strlen(meta) + 15) / 16;
+        stream[len++] = n;
+        memcpy(stream + len, meta, n * 16);
+        len += n * 16;
+    }
+    printf("ICY parser, metaint %d, %d-byte reads\n", metaint, read_len);
+
+    static speaker_icy_t icy;
+    speaker_icy_init(&icy, metaint);
+    uint8_t expect = 0;
+    int titles_seen = 0;
+    bool ok = true;
+    double start = bench_now_s();
+    for (int pos = 0; pos < len; pos += read_len) {
+        int n = len - pos < read_len ? len - pos : read_len;
+        int kept = speaker_icy_strip(&icy, stream + pos, n);
+        for (int i = 0; i < kept && ok; i++) {
+            ok = stream[pos + i] == expect++;
+        }
+        if (speaker_icy_take_title(&icy)) {
+            titles_seen++;
+        }
+    }
+    double elapsed = bench_now_s() - start;
+    printf("  %d titles over %u blocks, last '%s', %8.1f MB/s\n", titles_seen, icy.blocks, icy.title, len / elapsed / 1e6);
+    /* The repeated title is not announced again, the empty one is */
+    if (!ok || expect != (uint8_t)(metaint * blocks) || titles_seen != 3 * blocks / 2 / 4 || strcmp(icy.title, "") != 0) {
+        printf("  audio %s, %d titles\n", ok ? "in order" : "corrupted", titles_seen);
+        exit(1);
+    }
+
+    /* A value the server never closes ends with its block */
+    uint8_t cut[16 + 1 + 32 + 16] = { 0 };
+    cut[16] = 2;
+    memcpy(cut + 17, "StreamTitle='Unterminated", 25);
+    speaker_icy_init(&icy, 16);
+    int kept = speaker_icy_strip(&icy, cut, sizeof(cut));
+    if (kept != 32 || !speaker_icy_take_title(&icy) || strcmp(icy.title, "Unterminated") != 0) {
+        printf("  unterminated title lost, '%s'\n", icy.title);
+        exit(1);
+    }
+}
+
+typedef struct {
+    int     volume_calls;
+    int     amp_calls;
+    int     prompts;
+    int     tunes;
+    int     volume;
+    bool    amp;
+} bench_board_t;
+
+static void stub_set_volume(void *ctx, int volume)
+{
+    bench_board_t *board = ctx;
+    board->volume_calls++;
+    board->volume = volume;
+}
+
+static void stub_set_amp(void *ctx, bool on)
+{
+    bench_board_t *board = ctx;
+    board->amp_calls++;
+    board->amp = on;
+}
+
+static void stub_play_prompt(void *ctx, speaker_prompt_t prompt)
+{
+    (void)prompt;
+    ((bench_board_t *)ctx)->prompts++;
+}
+
+static void stub_tune(void *ctx, int station)
+{
+    (void)station;
+    ((bench_board_t *)ctx)->tunes++;
+}
+
+static void bench_report(const char *name, double elapsed, long ops, const bench_board_t *board)
+{
+    printf("  %-22s %8.1f ns/op  hal: %d volume, %d amp, %d prompt, %d tune\n", name, elapsed * 1e9 / ops,
+           board->volume_calls, board->amp_calls, board->prompts, board->tunes);
+}
+
+static void bench_control(void)
+{
+    static const speaker_event_t cycle[] = {
+        SPEAKER_EVENT_SD_READY, SPEAKER_EVENT_READY, SPEAKER_EVENT_MODE_KEY,
+        SPEAKER_EVENT_READY, SPEAKER_EVENT_MODE_KEY, SPEAKER_EVENT_READY, SPEAKER_EVENT_MODE_KEY,
+    };
+    const int cycle_len = sizeof(cycle) / sizeof(cycle[0]);
+    bench_board_t board = { 0 };
+    speaker_hal_t hal = {
+        .set_volume = stub_set_volume,
+        .set_amp = stub_set_amp,
+        .play_prompt = stub_play_prompt,
+        .tune = stub_tune,
+        .ctx = &board,
+    };
+    speaker_control_t ctl;
+    printf("Control logic against a stub board, %d loops per case\n", BENCH_CONTROL_LOOPS);
+
+    double start = bench_now_s();
+    for (int i = 0; i < BENCH_CONTROL_LOOPS; i++) {
+        speaker_control_init(&ctl, &hal, 3);
+        for (int e = 0; e < cycle_len; e++) {
+            speaker_control_event(&ctl, cycle[e]);
+        }
+    }
+    bench_report("mode transition", bench_now_s() - start, (long)BENCH_CONTROL_LOOPS * cycle_len, &board);
+    if (ctl.mode != SD_CARD_DET) {
+        printf("  mode cycle ended in mode %d instead of SD_CARD_DET\n", ctl.mode);
+        exit(1);
+    }
+    speaker_control_init(&ctl, &hal, 3);
+    speaker_control_resume(&ctl, WIFI_MODE, 35, 2);
+    speaker_control_event(&ctl, SPEAKER_EVENT_SD_READY);
+    if (ctl.mode != WIFI_MODE_INIT || ctl.volume != 35 || ctl.station != 2) {
+        printf("  resume entered mode %d at volume %d, station %d\n", ctl.mode, ctl.volume, ctl.station);
+        exit(1);
+    }
+    /* A volume the Bluetooth source already set on the codec is recorded, not written again */
+    int volume_calls = board.volume_calls;
+    speaker_control_set_volume(&ctl, 60);
+    if (ctl.volume != 60 || board.volume_calls != volume_calls) {
+        printf("  followed volume %d with %d hal calls\n", ctl.volume, board.volume_calls - volume_calls);
+        exit(1);
+    }
+
+    memset(&board, 0, sizeof(board));
+    speaker_control_init(&ctl, &hal, 3);
+    start = bench_now_s();
+    for (int i = 0; i < BENCH_CONTROL_LOOPS; i++) {
+        for (int s = 0; s < 20; s++) {
+            speaker_control_volume_up(&ctl, false);
+        }
+        for (int s = 0; s < 20; s++) {
+            speaker_control_volume_down(&ctl);
+        }
+    }
+    bench_report("volume step", bench_now_s() - start, (long)BENCH_CONTROL_LOOPS * 40, &board);
+
+    memset(&board, 0, sizeof(board));
+    start = bench_now_s();
+    for (int i = 0; i < BENCH_CONTROL_LOOPS; i++) {
+        speaker_control_station_step(&ctl, (i & 1) ? -1 : 2);
+    }
+    bench_report("station step", bench_now_s() - start, BENCH_CONTROL_LOOPS, &board);
+}
+
+int main(void)
+{
+    bench_kernel();
+    bench_resampler();
+    bench_asrc();
+    bench_drift();
+    bench_crossfade();
+    bench_icy();
+    bench_control();
+    return 0;
+}
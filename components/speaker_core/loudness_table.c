@@ -0,0 +1,4869 @@
+/* Generated by tools/gen_loudness_table.py from tools/loudness/curves.json, do not edit */
+#include "loudness_table.h"
+
+static const loudness_coefs_t s_loudness_11025[LOUDNESS_STEPS] = {
+    { { /* 0 % */
+        { 1.007590589e+00f, -1.992668061e+00f, 9.853884915e-01f, -1.992668061e+00f, 9.929790803e-01f },
+        { 1.015125727e+00f, -1.984769820e+00f, 9.708837230e-01f, -1.984769820e+00f, 9.860094500e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.052950842e+00f, -1.922085574e+00f, 8.888096729e-01f, -1.922085574e+00f, 9.417605153e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.097654257e+00f, -1.472618802e+00f, 6.513966465e-01f, -1.472618802e+00f, 7.490509038e-01f },
+        { 7.509403816e-01f, -5.311999421e-01f, 5.205725404e-01f, -5.311999421e-01f, 2.715129220e-01f },
+        { 9.292090638e-01f, 9.863123362e-01f, 5.860115191e-01f, 9.863123362e-01f, 5.152205829e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 1 % */
+        { 1.007556904e+00f, -1.992651936e+00f, 9.854060488e-01f, -1.992651936e+00f, 9.929629524e-01f },
+        { 1.015058481e+00f, -1.984737815e+00f, 9.709189431e-01f, -1.984737815e+00f, 9.859774245e-01f },
+        { 1.030126124e+00f, -1.966944775e+00f, 9.418201937e-01f, -1.966944775e+00f, 9.719463179e-01f },
+        { 1.052821093e+00f, -1.922021101e+00f, 8.888742888e-01f, -1.922021101e+00f, 9.416953819e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.097238922e+00f, -1.472405979e+00f, 6.515592081e-01f, -1.472405979e+00f, 7.487981305e-01f },
+        { 7.500456766e-01f, -5.307542846e-01f, 5.204004924e-01f, -5.307542846e-01f, 2.704461689e-01f },
+        { 9.287522889e-01f, 9.860370128e-01f, 5.860453290e-01f, 9.860370128e-01f, 5.147976178e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 2 % */
+        { 1.007523259e+00f, -1.992635773e+00f, 9.854235288e-01f, -1.992635773e+00f, 9.929467875e-01f },
+        { 1.014991317e+00f, -1.984705736e+00f, 9.709540089e-01f, -1.984705736e+00f, 9.859453263e-01f },
+        { 1.029991270e+00f, -1.966881176e+00f, 9.418912864e-01f, -1.966881176e+00f, 9.718825567e-01f },
+        { 1.052691420e+00f, -1.921956557e+00f, 8.889387574e-01f, -1.921956557e+00f, 9.416301777e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.096823820e+00f, -1.472192972e+00f, 6.517213189e-01f, -1.472192972e+00f, 7.485451393e-01f },
+        { 7.491516321e-01f, -5.303083496e-01f, 5.202271193e-01f, -5.303083496e-01f, 2.693787513e-01f },
+        { 9.282956975e-01f, 9.857615262e-01f, 5.860787045e-01f, 9.857615262e-01f, 5.143744020e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 3 % */
+        { 1.007489654e+00f, -1.992619574e+00f, 9.854409315e-01f, -1.992619574e+00f, 9.929305857e-01f },
+        { 1.014924234e+00f, -1.984673585e+00f, 9.709889207e-01f, -1.984673585e+00f, 9.859131551e-01f },
+        { 1.029856582e+00f, -1.966817434e+00f, 9.419620708e-01f, -1.966817434e+00f, 9.718186526e-01f },
+        { 1.052561824e+00f, -1.921891944e+00f, 8.890030787e-01f, -1.921891944e+00f, 9.415649028e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.096408951e+00f, -1.471979782e+00f, 6.518829793e-01f, -1.471979782e+00f, 7.482919300e-01f },
+        { 7.482582470e-01f, -5.298621379e-01f, 5.200524245e-01f, -5.298621379e-01f, 2.683106715e-01f },
+        { 9.278392894e-01f, 9.854858764e-01f, 5.861116460e-01f, 9.854858764e-01f, 5.139509355e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 4 % */
+        { 1.007456090e+00f, -1.992603338e+00f, 9.854582570e-01f, -1.992603338e+00f, 9.929143467e-01f },
+        { 1.014857232e+00f, -1.984641361e+00f, 9.710236787e-01f, -1.984641361e+00f, 9.858809109e-01f },
+        { 1.029722058e+00f, -1.966753549e+00f, 9.420325473e-01f, -1.966753549e+00f, 9.717546053e-01f },
+        { 1.052432304e+00f, -1.921827260e+00f, 8.890672529e-01f, -1.921827260e+00f, 9.414995572e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.095994313e+00f, -1.471766408e+00f, 6.520441896e-01f, -1.471766408e+00f, 7.480385024e-01f },
+        { 7.473655201e-01f, -5.294156504e-01f, 5.198764114e-01f, -5.294156504e-01f, 2.672419315e-01f },
+        { 9.273830643e-01f, 9.852100634e-01f, 5.861441540e-01f, 9.852100634e-01f, 5.135272183e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 5 % */
+        { 1.007422565e+00f, -1.992587064e+00f, 9.854755053e-01f, -1.992587064e+00f, 9.928980706e-01f },
+        { 1.014790310e+00f, -1.984609064e+00f, 9.710582829e-01f, -1.984609064e+00f, 9.858485933e-01f },
+        { 1.029587698e+00f, -1.966689521e+00f, 9.421027161e-01f, -1.966689521e+00f, 9.716904146e-01f },
+        { 1.052302861e+00f, -1.921762506e+00f, 8.891312801e-01f, -1.921762506e+00f, 9.414341406e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.095579907e+00f, -1.471552850e+00f, 6.522049500e-01f, -1.471552850e+00f, 7.477848565e-01f },
+        { 7.464734502e-01f, -5.289688881e-01f, 5.196990835e-01f, -5.289688881e-01f, 2.661725337e-01f },
+        { 9.269270218e-01f, 9.849340874e-01f, 5.861762288e-01f, 9.849340874e-01f, 5.131032505e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 6 % */
+        { 1.007389081e+00f, -1.992570753e+00f, 9.854926767e-01f, -1.992570753e+00f, 9.928817572e-01f },
+        { 1.014723469e+00f, -1.984576693e+00f, 9.710927337e-01f, -1.984576693e+00f, 9.858162023e-01f },
+        { 1.029453502e+00f, -1.966625350e+00f, 9.421725778e-01f, -1.966625350e+00f, 9.716260801e-01f },
+        { 1.052173493e+00f, -1.921697682e+00f, 8.891951602e-01f, -1.921697682e+00f, 9.413686532e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.095165731e+00f, -1.471339108e+00f, 6.523652610e-01f, -1.471339108e+00f, 7.475309921e-01f },
+        { 7.455820361e-01f, -5.285218519e-01f, 5.195204442e-01f, -5.285218519e-01f, 2.651024803e-01f },
+        { 9.264711616e-01f, 9.846579482e-01f, 5.862078707e-01f, 9.846579482e-01f, 5.126790322e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 7 % */
+        { 1.007355635e+00f, -1.992554405e+00f, 9.855097711e-01f, -1.992554405e+00f, 9.928654065e-01f },
+        { 1.014656707e+00f, -1.984544249e+00f, 9.711270311e-01f, -1.984544249e+00f, 9.857837377e-01f },
+        { 1.029319469e+00f, -1.966561035e+00f, 9.422421327e-01f, -1.966561035e+00f, 9.715616016e-01f },
+        { 1.052044201e+00f, -1.921632788e+00f, 8.892588935e-01f, -1.921632788e+00f, 9.413030947e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.094751786e+00f, -1.471125182e+00f, 6.525251228e-01f, -1.471125182e+00f, 7.472769092e-01f },
+        { 7.446912766e-01f, -5.280745427e-01f, 5.193404968e-01f, -5.280745427e-01f, 2.640317735e-01f },
+        { 9.260154834e-01f, 9.843816460e-01f, 5.862390801e-01f, 9.843816460e-01f, 5.122545635e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 8 % */
+        { 1.007322230e+00f, -1.992538019e+00f, 9.855267887e-01f, -1.992538019e+00f, 9.928490184e-01f },
+        { 1.014590024e+00f, -1.984511731e+00f, 9.711611755e-01f, -1.984511731e+00f, 9.857511993e-01f },
+        { 1.029185597e+00f, -1.966496575e+00f, 9.423113812e-01f, -1.966496575e+00f, 9.714969786e-01f },
+        { 1.051914985e+00f, -1.921567824e+00f, 8.893224800e-01f, -1.921567824e+00f, 9.412374651e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.094338072e+00f, -1.470911072e+00f, 6.526845358e-01f, -1.470911072e+00f, 7.470226075e-01f },
+        { 7.438011706e-01f, -5.276269615e-01f, 5.191592449e-01f, -5.276269615e-01f, 2.629604155e-01f },
+        { 9.255599868e-01f, 9.841051808e-01f, 5.862698575e-01f, 9.841051808e-01f, 5.118298443e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 9 % */
+        { 1.007288863e+00f, -1.992521596e+00f, 9.855437296e-01f, -1.992521596e+00f, 9.928325928e-01f },
+        { 1.014523420e+00f, -1.984479139e+00f, 9.711951669e-01f, -1.984479139e+00f, 9.857185870e-01f },
+        { 1.029051887e+00f, -1.966431972e+00f, 9.423803236e-01f, -1.966431972e+00f, 9.714322109e-01f },
+        { 1.051785844e+00f, -1.921502789e+00f, 8.893859199e-01f, -1.921502789e+00f, 9.411717644e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.093924587e+00f, -1.470696778e+00f, 6.528435003e-01f, -1.470696778e+00f, 7.467680871e-01f },
+        { 7.429117168e-01f, -5.271791092e-01f, 5.189766919e-01f, -5.271791092e-01f, 2.618884087e-01f },
+        { 9.251046717e-01f, 9.838285527e-01f, 5.863002032e-01f, 9.838285527e-01f, 5.114048748e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 10 % */
+        { 1.007255536e+00f, -1.992505136e+00f, 9.855605938e-01f, -1.992505136e+00f, 9.928161295e-01f },
+        { 1.014456895e+00f, -1.984446473e+00f, 9.712290056e-01f, -1.984446473e+00f, 9.856859005e-01f },
+        { 1.028918338e+00f, -1.966367224e+00f, 9.424489604e-01f, -1.966367224e+00f, 9.713672981e-01f },
+        { 1.051656779e+00f, -1.921437683e+00f, 8.894492131e-01f, -1.921437683e+00f, 9.411059924e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.093511331e+00f, -1.470482299e+00f, 6.530020167e-01f, -1.470482299e+00f, 7.465133477e-01f },
+        { 7.420229142e-01f, -5.267309868e-01f, 5.187928410e-01f, -5.267309868e-01f, 2.608157552e-01f },
+        { 9.246495375e-01f, 9.835517616e-01f, 5.863301175e-01f, 9.835517616e-01f, 5.109796550e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 11 % */
+        { 1.007222247e+00f, -1.992488637e+00f, 9.855773814e-01f, -1.992488637e+00f, 9.927996286e-01f },
+        { 1.014390448e+00f, -1.984413732e+00f, 9.712626917e-01f, -1.984413732e+00f, 9.856531398e-01f },
+        { 1.028784948e+00f, -1.966302331e+00f, 9.425172919e-01f, -1.966302331e+00f, 9.713022400e-01f },
+        { 1.051527789e+00f, -1.921372507e+00f, 8.895123599e-01f, -1.921372507e+00f, 9.410401491e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.093098304e+00f, -1.470267636e+00f, 6.531600852e-01f, -1.470267636e+00f, 7.462583893e-01f },
+        { 7.411347615e-01f, -5.262825952e-01f, 5.186076959e-01f, -5.262825952e-01f, 2.597424574e-01f },
+        { 9.241945842e-01f, 9.832748077e-01f, 5.863596009e-01f, 9.832748077e-01f, 5.105541850e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 12 % */
+        { 1.007188997e+00f, -1.992472101e+00f, 9.855940926e-01f, -1.992472101e+00f, 9.927830899e-01f },
+        { 1.014324079e+00f, -1.984380918e+00f, 9.712962255e-01f, -1.984380918e+00f, 9.856203047e-01f },
+        { 1.028651718e+00f, -1.966237292e+00f, 9.425853185e-01f, -1.966237292e+00f, 9.712370363e-01f },
+        { 1.051398874e+00f, -1.921307260e+00f, 8.895753602e-01f, -1.921307260e+00f, 9.409742345e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.092685506e+00f, -1.470052789e+00f, 6.533177062e-01f, -1.470052789e+00f, 7.460032118e-01f },
+        { 7.402472577e-01f, -5.258339353e-01f, 5.184212598e-01f, -5.258339353e-01f, 2.586685174e-01f },
+        { 9.237398112e-01f, 9.829976909e-01f, 5.863886536e-01f, 9.829976909e-01f, 5.101284649e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 13 % */
+        { 1.007155786e+00f, -1.992455527e+00f, 9.856107274e-01f, -1.992455527e+00f, 9.927665134e-01f },
+        { 1.014257788e+00f, -1.984348028e+00f, 9.713296070e-01f, -1.984348028e+00f, 9.855873949e-01f },
+        { 1.028518646e+00f, -1.966172109e+00f, 9.426530406e-01f, -1.966172109e+00f, 9.711716865e-01f },
+        { 1.051270034e+00f, -1.921241943e+00f, 8.896382142e-01f, -1.921241943e+00f, 9.409082484e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.092272935e+00f, -1.469837757e+00f, 6.534748800e-01f, -1.469837757e+00f, 7.457478150e-01f },
+        { 7.393604015e-01f, -5.253850081e-01f, 5.182335361e-01f, -5.253850081e-01f, 2.575939377e-01f },
+        { 9.232852184e-01f, 9.827204113e-01f, 5.864172762e-01f, 9.827204113e-01f, 5.097024946e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 14 % */
+        { 1.007122613e+00f, -1.992438915e+00f, 9.856272859e-01f, -1.992438915e+00f, 9.927498990e-01f },
+        { 1.014191574e+00f, -1.984315065e+00f, 9.713628365e-01f, -1.984315065e+00f, 9.855544104e-01f },
+        { 1.028385732e+00f, -1.966106779e+00f, 9.427204585e-01f, -1.966106779e+00f, 9.711061905e-01f },
+        { 1.051141269e+00f, -1.921176554e+00f, 8.897009219e-01f, -1.921176554e+00f, 9.408421908e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.091860592e+00f, -1.469622540e+00f, 6.536316069e-01f, -1.469622540e+00f, 7.454921988e-01f },
+        { 7.384741919e-01f, -5.249358145e-01f, 5.180445284e-01f, -5.249358145e-01f, 2.565187203e-01f },
+        { 9.228308053e-01f, 9.824429689e-01f, 5.864454689e-01f, 9.824429689e-01f, 5.092762743e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 15 % */
+        { 1.007089478e+00f, -1.992422266e+00f, 9.856437682e-01f, -1.992422266e+00f, 9.927332465e-01f },
+        { 1.014125437e+00f, -1.984282026e+00f, 9.713959142e-01f, -1.984282026e+00f, 9.855213510e-01f },
+        { 1.028252975e+00f, -1.966041302e+00f, 9.427875727e-01f, -1.966041302e+00f, 9.710405478e-01f },
+        { 1.051012578e+00f, -1.921111095e+00f, 8.897634836e-01f, -1.921111095e+00f, 9.407760616e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.091448476e+00f, -1.469407138e+00f, 6.537878873e-01f, -1.469407138e+00f, 7.452363631e-01f },
+        { 7.375886278e-01f, -5.244863556e-01f, 5.178542399e-01f, -5.244863556e-01f, 2.554428677e-01f },
+        { 9.223765718e-01f, 9.821653639e-01f, 5.864732322e-01f, 9.821653639e-01f, 5.088498040e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 16 % */
+        { 1.007056381e+00f, -1.992405578e+00f, 9.856601744e-01f, -1.992405578e+00f, 9.927165559e-01f },
+        { 1.014059376e+00f, -1.984248912e+00f, 9.714288402e-01f, -1.984248912e+00f, 9.854882164e-01f },
+        { 1.028120375e+00f, -1.965975680e+00f, 9.428543834e-01f, -1.965975680e+00f, 9.709747582e-01f },
+        { 1.050883962e+00f, -1.921045565e+00f, 8.898258992e-01f, -1.921045565e+00f, 9.407098608e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.091036586e+00f, -1.469191552e+00f, 6.539437215e-01f, -1.469191552e+00f, 7.449803079e-01f },
+        { 7.367037080e-01f, -5.240366322e-01f, 5.176626741e-01f, -5.240366322e-01f, 2.543663821e-01f },
+        { 9.219225174e-01f, 9.818875961e-01f, 5.865005663e-01f, 9.818875961e-01f, 5.084230837e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 17 % */
+        { 1.007023323e+00f, -1.992388851e+00f, 9.856765046e-01f, -1.992388851e+00f, 9.926998271e-01f },
+        { 1.013993392e+00f, -1.984215723e+00f, 9.714616148e-01f, -1.984215723e+00f, 9.854550066e-01f },
+        { 1.027987930e+00f, -1.965909910e+00f, 9.429208911e-01f, -1.965909910e+00f, 9.709088214e-01f },
+        { 1.050755419e+00f, -1.920979964e+00f, 8.898881688e-01f, -1.920979964e+00f, 9.406435882e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.090624923e+00f, -1.468975780e+00f, 6.540991098e-01f, -1.468975780e+00f, 7.447240329e-01f },
+        { 7.358194314e-01f, -5.235866454e-01f, 5.174698345e-01f, -5.235866454e-01f, 2.532892658e-01f },
+        { 9.214686419e-01f, 9.816096657e-01f, 5.865274718e-01f, 9.816096657e-01f, 5.079961137e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 18 % */
+        { 1.006990301e+00f, -1.992372087e+00f, 9.856927588e-01f, -1.992372087e+00f, 9.926830600e-01f },
+        { 1.013927483e+00f, -1.984182458e+00f, 9.714942380e-01f, -1.984182458e+00f, 9.854217213e-01f },
+        { 1.027855641e+00f, -1.965843993e+00f, 9.429870962e-01f, -1.965843993e+00f, 9.708427370e-01f },
+        { 1.050626951e+00f, -1.920914292e+00f, 8.899502925e-01f, -1.920914292e+00f, 9.405772438e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.090213486e+00f, -1.468759824e+00f, 6.542540526e-01f, -1.468759824e+00f, 7.444675381e-01f },
+        { 7.349357969e-01f, -5.231363960e-01f, 5.172757243e-01f, -5.231363960e-01f, 2.522115212e-01f },
+        { 9.210149450e-01f, 9.813315728e-01f, 5.865539489e-01f, 9.813315728e-01f, 5.075688938e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 19 % */
+        { 1.006957317e+00f, -1.992355284e+00f, 9.857089372e-01f, -1.992355284e+00f, 9.926662546e-01f },
+        { 1.013861650e+00f, -1.984149118e+00f, 9.715267101e-01f, -1.984149118e+00f, 9.853883605e-01f },
+        { 1.027723506e+00f, -1.965777929e+00f, 9.430529989e-01f, -1.965777929e+00f, 9.707765047e-01f },
+        { 1.050498557e+00f, -1.920848549e+00f, 8.900122705e-01f, -1.920848549e+00f, 9.405108275e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.089802273e+00f, -1.468543682e+00f, 6.544085501e-01f, -1.468543682e+00f, 7.442108234e-01f },
+        { 7.340528034e-01f, -5.226858851e-01f, 5.170803470e-01f, -5.226858851e-01f, 2.511331504e-01f },
+        { 9.205614263e-01f, 9.810533172e-01f, 5.865799980e-01f, 9.810533172e-01f, 5.071414243e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 20 % */
+        { 1.006924371e+00f, -1.992338443e+00f, 9.857250398e-01f, -1.992338443e+00f, 9.926494107e-01f },
+        { 1.013795892e+00f, -1.984115702e+00f, 9.715590313e-01f, -1.984115702e+00f, 9.853549238e-01f },
+        { 1.027591524e+00f, -1.965711717e+00f, 9.431185997e-01f, -1.965711717e+00f, 9.707101241e-01f },
+        { 1.050370236e+00f, -1.920782734e+00f, 8.900741028e-01f, -1.920782734e+00f, 9.404443392e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.089391286e+00f, -1.468327355e+00f, 6.545626027e-01f, -1.468327355e+00f, 7.439538886e-01f },
+        { 7.331704500e-01f, -5.222351136e-01f, 5.168837060e-01f, -5.222351136e-01f, 2.500541560e-01f },
+        { 9.201080855e-01f, 9.807748992e-01f, 5.866056195e-01f, 9.807748992e-01f, 5.067137050e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 21 % */
+        { 1.006891462e+00f, -1.992321563e+00f, 9.857410667e-01f, -1.992321563e+00f, 9.926325283e-01f },
+        { 1.013730209e+00f, -1.984082211e+00f, 9.715912017e-01f, -1.984082211e+00f, 9.853214112e-01f },
+        { 1.027459696e+00f, -1.965645356e+00f, 9.431838989e-01f, -1.965645356e+00f, 9.706435951e-01f },
+        { 1.050241990e+00f, -1.920716848e+00f, 8.901357895e-01f, -1.920716848e+00f, 9.403777790e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.088980523e+00f, -1.468110842e+00f, 6.547162106e-01f, -1.468110842e+00f, 7.436967337e-01f },
+        { 7.322887354e-01f, -5.217840824e-01f, 5.166858047e-01f, -5.217840824e-01f, 2.489745400e-01f },
+        { 9.196549224e-01f, 9.804963187e-01f, 5.866308138e-01f, 9.804963187e-01f, 5.062857362e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 22 % */
+        { 1.006858589e+00f, -1.992304645e+00f, 9.857570181e-01f, -1.992304645e+00f, 9.926156072e-01f },
+        { 1.013664601e+00f, -1.984048643e+00f, 9.716232215e-01f, -1.984048643e+00f, 9.852878225e-01f },
+        { 1.027328020e+00f, -1.965578848e+00f, 9.432488969e-01f, -1.965578848e+00f, 9.705769171e-01f },
+        { 1.050113816e+00f, -1.920650891e+00f, 8.901973306e-01f, -1.920650891e+00f, 9.403111466e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.088569984e+00f, -1.467894145e+00f, 6.548693743e-01f, -1.467894145e+00f, 7.434393585e-01f },
+        { 7.314076586e-01f, -5.213327926e-01f, 5.164866464e-01f, -5.213327926e-01f, 2.478943050e-01f },
+        { 9.192019366e-01f, 9.802175757e-01f, 5.866555812e-01f, 9.802175757e-01f, 5.058575179e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 23 % */
+        { 1.006825754e+00f, -1.992287687e+00f, 9.857728939e-01f, -1.992287687e+00f, 9.925986474e-01f },
+        { 1.013599067e+00f, -1.984014999e+00f, 9.716550909e-01f, -1.984014999e+00f, 9.852541574e-01f },
+        { 1.027196496e+00f, -1.965512190e+00f, 9.433135941e-01f, -1.965512190e+00f, 9.705100900e-01f },
+        { 1.049985716e+00f, -1.920584862e+00f, 8.902587264e-01f, -1.920584862e+00f, 9.402444421e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.088159669e+00f, -1.467677261e+00f, 6.550220941e-01f, -1.467677261e+00f, 7.431817629e-01f },
+        { 7.305272186e-01f, -5.208812452e-01f, 5.162862347e-01f, -5.208812452e-01f, 2.468134532e-01f },
+        { 9.187491278e-01f, 9.799386704e-01f, 5.866799222e-01f, 9.799386704e-01f, 5.054290500e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 24 % */
+        { 1.006792954e+00f, -1.992270692e+00f, 9.857886943e-01f, -1.992270692e+00f, 9.925816488e-01f },
+        { 1.013533606e+00f, -1.983981279e+00f, 9.716868100e-01f, -1.983981279e+00f, 9.852204160e-01f },
+        { 1.027065123e+00f, -1.965445383e+00f, 9.433779907e-01f, -1.965445383e+00f, 9.704431134e-01f },
+        { 1.049857688e+00f, -1.920518762e+00f, 8.903199768e-01f, -1.920518762e+00f, 9.401776653e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.087749577e+00f, -1.467460192e+00f, 6.551743702e-01f, -1.467460192e+00f, 7.429239468e-01f },
+        { 7.296474142e-01f, -5.204294411e-01f, 5.160845728e-01f, -5.204294411e-01f, 2.457319870e-01f },
+        { 9.182964958e-01f, 9.796596027e-01f, 5.867038371e-01f, 9.796596027e-01f, 5.050003328e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 25 % */
+        { 1.006760192e+00f, -1.992253657e+00f, 9.858044194e-01f, -1.992253657e+00f, 9.925646113e-01f },
+        { 1.013468219e+00f, -1.983947482e+00f, 9.717183790e-01f, -1.983947482e+00f, 9.851865978e-01f },
+        { 1.026933900e+00f, -1.965378427e+00f, 9.434420872e-01f, -1.965378427e+00f, 9.703759870e-01f },
+        { 1.049729734e+00f, -1.920452591e+00f, 8.903810820e-01f, -1.920452591e+00f, 9.401108162e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.087339707e+00f, -1.467242937e+00f, 6.553262030e-01f, -1.467242937e+00f, 7.426659101e-01f },
+        { 7.287682446e-01f, -5.199773812e-01f, 5.158816641e-01f, -5.199773812e-01f, 2.446499087e-01f },
+        { 9.178440401e-01f, 9.793803728e-01f, 5.867273262e-01f, 9.793803728e-01f, 5.045713663e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 26 % */
+        { 1.006727466e+00f, -1.992236583e+00f, 9.858200692e-01f, -1.992236583e+00f, 9.925475348e-01f },
+        { 1.013402905e+00f, -1.983913608e+00f, 9.717497981e-01f, -1.983913608e+00f, 9.851527029e-01f },
+        { 1.026802826e+00f, -1.965311321e+00f, 9.435058839e-01f, -1.965311321e+00f, 9.703087104e-01f },
+        { 1.049601853e+00f, -1.920386347e+00f, 8.904420420e-01f, -1.920386347e+00f, 9.400438947e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.086930060e+00f, -1.467025497e+00f, 6.554775928e-01f, -1.467025497e+00f, 7.424076527e-01f },
+        { 7.278897085e-01f, -5.195250667e-01f, 5.156775121e-01f, -5.195250667e-01f, 2.435672207e-01f },
+        { 9.173917606e-01f, 9.791009805e-01f, 5.867503899e-01f, 9.791009805e-01f, 5.041421505e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 27 % */
+        { 1.006694775e+00f, -1.992219470e+00f, 9.858356439e-01f, -1.992219470e+00f, 9.925304193e-01f },
+        { 1.013337664e+00f, -1.983879657e+00f, 9.717810675e-01f, -1.983879657e+00f, 9.851187310e-01f },
+        { 1.026671902e+00f, -1.965244065e+00f, 9.435693812e-01f, -1.965244065e+00f, 9.702412834e-01f },
+        { 1.049474044e+00f, -1.920320032e+00f, 8.905028569e-01f, -1.920320032e+00f, 9.399769007e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.086520634e+00f, -1.466807870e+00f, 6.556285400e-01f, -1.466807870e+00f, 7.421491744e-01f },
+        { 7.270118051e-01f, -5.190724983e-01f, 5.154721202e-01f, -5.190724983e-01f, 2.424839252e-01f },
+        { 9.169396568e-01f, 9.788214261e-01f, 5.867730287e-01f, 9.788214261e-01f, 5.037126855e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 28 % */
+        { 1.006662121e+00f, -1.992202318e+00f, 9.858511434e-01f, -1.992202318e+00f, 9.925132646e-01f },
+        { 1.013272495e+00f, -1.983845629e+00f, 9.718121873e-01f, -1.983845629e+00f, 9.850846820e-01f },
+        { 1.026541126e+00f, -1.965176659e+00f, 9.436325794e-01f, -1.965176659e+00f, 9.701737055e-01f },
+        { 1.049346307e+00f, -1.920253645e+00f, 8.905635269e-01f, -1.920253645e+00f, 9.399098342e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.086111430e+00f, -1.466590057e+00f, 6.557790448e-01f, -1.466590057e+00f, 7.418904752e-01f },
+        { 7.261345332e-01f, -5.186196773e-01f, 5.152654916e-01f, -5.186196773e-01f, 2.414000248e-01f },
+        { 9.164877285e-01f, 9.785417095e-01f, 5.867952428e-01f, 9.785417095e-01f, 5.032829713e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 29 % */
+        { 1.006629503e+00f, -1.992185127e+00f, 9.858665680e-01f, -1.992185127e+00f, 9.924960706e-01f },
+        { 1.013207398e+00f, -1.983811524e+00f, 9.718431578e-01f, -1.983811524e+00f, 9.850505557e-01f },
+        { 1.026410498e+00f, -1.965109101e+00f, 9.436954789e-01f, -1.965109101e+00f, 9.701059765e-01f },
+        { 1.049218643e+00f, -1.920187186e+00f, 8.906240520e-01f, -1.920187186e+00f, 9.398426951e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.085702447e+00f, -1.466372059e+00f, 6.559291075e-01f, -1.466372059e+00f, 7.416315550e-01f },
+        { 7.252578919e-01f, -5.181666044e-01f, 5.150576298e-01f, -5.181666044e-01f, 2.403155217e-01f },
+        { 9.160359755e-01f, 9.782618308e-01f, 5.868170327e-01f, 9.782618308e-01f, 5.028530082e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 30 % */
+        { 1.006596920e+00f, -1.992167896e+00f, 9.858819177e-01f, -1.992167896e+00f, 9.924788374e-01f },
+        { 1.013142373e+00f, -1.983777342e+00f, 9.718739789e-01f, -1.983777342e+00f, 9.850163518e-01f },
+        { 1.026280016e+00f, -1.965041393e+00f, 9.437580800e-01f, -1.965041393e+00f, 9.700380960e-01f },
+        { 1.049091051e+00f, -1.920120655e+00f, 8.906844323e-01f, -1.920120655e+00f, 9.397754833e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.085293685e+00f, -1.466153874e+00f, 6.560787286e-01f, -1.466153874e+00f, 7.413724135e-01f },
+        { 7.243818801e-01f, -5.177132808e-01f, 5.148485383e-01f, -5.177132808e-01f, 2.392304184e-01f },
+        { 9.155843973e-01f, 9.779817900e-01f, 5.868383987e-01f, 9.779817900e-01f, 5.024227960e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 31 % */
+        { 1.006564372e+00f, -1.992150626e+00f, 9.858971925e-01f, -1.992150626e+00f, 9.924615646e-01f },
+        { 1.013077419e+00f, -1.983743082e+00f, 9.719046511e-01f, -1.983743082e+00f, 9.849820703e-01f },
+        { 1.026149681e+00f, -1.964973533e+00f, 9.438203831e-01f, -1.964973533e+00f, 9.699700638e-01f },
+        { 1.048963531e+00f, -1.920054053e+00f, 8.907446679e-01f, -1.920054053e+00f, 9.397081987e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.084885143e+00f, -1.465935503e+00f, 6.562279082e-01f, -1.465935503e+00f, 7.411130508e-01f },
+        { 7.235064969e-01f, -5.172597074e-01f, 5.146382202e-01f, -5.172597074e-01f, 2.381447171e-01f },
+        { 9.151329937e-01f, 9.777015872e-01f, 5.868593412e-01f, 9.777015872e-01f, 5.019923349e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 32 % */
+        { 1.006531860e+00f, -1.992133317e+00f, 9.859123925e-01f, -1.992133317e+00f, 9.924442524e-01f },
+        { 1.013012537e+00f, -1.983708744e+00f, 9.719351743e-01f, -1.983708744e+00f, 9.849477110e-01f },
+        { 1.026019491e+00f, -1.964905522e+00f, 9.438823885e-01f, -1.964905522e+00f, 9.699018794e-01f },
+        { 1.048836082e+00f, -1.919987378e+00f, 8.908047588e-01f, -1.919987378e+00f, 9.396408413e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.084476820e+00f, -1.465716945e+00f, 6.563766468e-01f, -1.465716945e+00f, 7.408534667e-01f },
+        { 7.226317412e-01f, -5.168058852e-01f, 5.144266792e-01f, -5.168058852e-01f, 2.370584204e-01f },
+        { 9.146817644e-01f, 9.774212223e-01f, 5.868798606e-01f, 9.774212223e-01f, 5.015616249e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 33 % */
+        { 1.006499383e+00f, -1.992115967e+00f, 9.859275179e-01f, -1.992115967e+00f, 9.924269006e-01f },
+        { 1.012947725e+00f, -1.983674328e+00f, 9.719655488e-01f, -1.983674328e+00f, 9.849132736e-01f },
+        { 1.025889446e+00f, -1.964837359e+00f, 9.439440966e-01f, -1.964837359e+00f, 9.698335426e-01f },
+        { 1.048708706e+00f, -1.919920631e+00f, 8.908647052e-01f, -1.919920631e+00f, 9.395734110e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.084068716e+00f, -1.465498201e+00f, 6.565249446e-01f, -1.465498201e+00f, 7.405936611e-01f },
+        { 7.217576121e-01f, -5.163518152e-01f, 5.142139184e-01f, -5.163518152e-01f, 2.359715305e-01f },
+        { 9.142307090e-01f, 9.771406956e-01f, 5.868999571e-01f, 9.771406956e-01f, 5.011306662e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 34 % */
+        { 1.006466940e+00f, -1.992098579e+00f, 9.859425687e-01f, -1.992098579e+00f, 9.924095090e-01f },
+        { 1.012882983e+00f, -1.983639834e+00f, 9.719957747e-01f, -1.983639834e+00f, 9.848787580e-01f },
+        { 1.025759545e+00f, -1.964769043e+00f, 9.440055076e-01f, -1.964769043e+00f, 9.697650530e-01f },
+        { 1.048581401e+00f, -1.919853811e+00f, 8.909245072e-01f, -1.919853811e+00f, 9.395059077e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.083660832e+00f, -1.465279270e+00f, 6.566728020e-01f, -1.465279270e+00f, 7.403336339e-01f },
+        { 7.208841086e-01f, -5.158974985e-01f, 5.139999413e-01f, -5.158974985e-01f, 2.348840499e-01f },
+        { 9.137798274e-01f, 9.768600069e-01f, 5.869196313e-01f, 9.768600069e-01f, 5.006994587e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 35 % */
+        { 1.006434533e+00f, -1.992081150e+00f, 9.859575450e-01f, -1.992081150e+00f, 9.923920777e-01f },
+        { 1.012818312e+00f, -1.983605262e+00f, 9.720258522e-01f, -1.983605262e+00f, 9.848441641e-01f },
+        { 1.025629788e+00f, -1.964700574e+00f, 9.440666220e-01f, -1.964700574e+00f, 9.696964103e-01f },
+        { 1.048454167e+00f, -1.919786920e+00f, 8.909841648e-01f, -1.919786920e+00f, 9.394383314e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.083253166e+00f, -1.465060153e+00f, 6.568202193e-01f, -1.465060153e+00f, 7.400733849e-01f },
+        { 7.200112297e-01f, -5.154429359e-01f, 5.137847513e-01f, -5.154429359e-01f, 2.337959810e-01f },
+        { 9.133291191e-01f, 9.765791564e-01f, 5.869388835e-01f, 9.765791564e-01f, 5.002680026e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 36 % */
+        { 1.006402160e+00f, -1.992063681e+00f, 9.859724468e-01f, -1.992063681e+00f, 9.923746065e-01f },
+        { 1.012753710e+00f, -1.983570611e+00f, 9.720557815e-01f, -1.983570611e+00f, 9.848094917e-01f },
+        { 1.025500174e+00f, -1.964631952e+00f, 9.441274401e-01f, -1.964631952e+00f, 9.696276142e-01f },
+        { 1.048327004e+00f, -1.919719956e+00f, 8.910436781e-01f, -1.919719956e+00f, 9.393706819e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.082845717e+00f, -1.464840849e+00f, 6.569671967e-01f, -1.464840849e+00f, 7.398129142e-01f },
+        { 7.191389745e-01f, -5.149881286e-01f, 5.135683517e-01f, -5.149881286e-01f, 2.327073262e-01f },
+        { 9.128785839e-01f, 9.762981441e-01f, 5.869577140e-01f, 9.762981441e-01f, 4.998362980e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 37 % */
+        { 1.006369821e+00f, -1.992046173e+00f, 9.859872743e-01f, -1.992046173e+00f, 9.923570953e-01f },
+        { 1.012689178e+00f, -1.983535881e+00f, 9.720855627e-01f, -1.983535881e+00f, 9.847747405e-01f },
+        { 1.025370702e+00f, -1.964563177e+00f, 9.441879622e-01f, -1.964563177e+00f, 9.695586643e-01f },
+        { 1.048199912e+00f, -1.919652919e+00f, 8.911030472e-01f, -1.919652919e+00f, 9.393029592e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.082438487e+00f, -1.464621357e+00f, 6.571137346e-01f, -1.464621357e+00f, 7.395522214e-01f },
+        { 7.182673420e-01f, -5.145330776e-01f, 5.133507460e-01f, -5.145330776e-01f, 2.316180879e-01f },
+        { 9.124282216e-01f, 9.760169700e-01f, 5.869761233e-01f, 9.760169700e-01f, 4.994043448e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 38 % */
+        { 1.006337516e+00f, -1.992028625e+00f, 9.860020276e-01f, -1.992028625e+00f, 9.923395441e-01f },
+        { 1.012624715e+00f, -1.983501073e+00f, 9.721151960e-01f, -1.983501073e+00f, 9.847399105e-01f },
+        { 1.025241372e+00f, -1.964494249e+00f, 9.442481887e-01f, -1.964494249e+00f, 9.694895603e-01f },
+        { 1.048072891e+00f, -1.919585810e+00f, 8.911622722e-01f, -1.919585810e+00f, 9.392351633e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.082031473e+00f, -1.464401679e+00f, 6.572598334e-01f, -1.464401679e+00f, 7.392913066e-01f },
+        { 7.173963312e-01f, -5.140777837e-01f, 5.131319374e-01f, -5.140777837e-01f, 2.305282686e-01f },
+        { 9.119780316e-01f, 9.757356343e-01f, 5.869941116e-01f, 9.757356343e-01f, 4.989721432e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 39 % */
+        { 1.006305246e+00f, -1.992011036e+00f, 9.860167066e-01f, -1.992011036e+00f, 9.923219527e-01f },
+        { 1.012560320e+00f, -1.983466186e+00f, 9.721446815e-01f, -1.983466186e+00f, 9.847050014e-01f },
+        { 1.025112182e+00f, -1.964425166e+00f, 9.443081199e-01f, -1.964425166e+00f, 9.694203019e-01f },
+        { 1.047945941e+00f, -1.919518629e+00f, 8.912213533e-01f, -1.919518629e+00f, 9.391672940e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.081624676e+00f, -1.464181814e+00f, 6.574054933e-01f, -1.464181814e+00f, 7.390301697e-01f },
+        { 7.165259412e-01f, -5.136222482e-01f, 5.129119293e-01f, -5.136222482e-01f, 2.294378706e-01f },
+        { 9.115280139e-01f, 9.754541368e-01f, 5.870116794e-01f, 9.754541368e-01f, 4.985396933e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 40 % */
+        { 1.006273010e+00f, -1.991993407e+00f, 9.860313116e-01f, -1.991993407e+00f, 9.923043211e-01f },
+        { 1.012495994e+00f, -1.983431219e+00f, 9.721740194e-01f, -1.983431219e+00f, 9.846700130e-01f },
+        { 1.024983133e+00f, -1.964355929e+00f, 9.443677561e-01f, -1.964355929e+00f, 9.693508887e-01f },
+        { 1.047819061e+00f, -1.919451374e+00f, 8.912802903e-01f, -1.919451374e+00f, 9.390993513e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.081218096e+00f, -1.463961762e+00f, 6.575507147e-01f, -1.463961762e+00f, 7.387688104e-01f },
+        { 7.156561711e-01f, -5.131664719e-01f, 5.126907252e-01f, -5.131664719e-01f, 2.283468964e-01f },
+        { 9.110781681e-01f, 9.751724778e-01f, 5.870288269e-01f, 9.751724778e-01f, 4.981069951e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 41 % */
+        { 1.006240807e+00f, -1.991975738e+00f, 9.860458425e-01f, -1.991975738e+00f, 9.922866491e-01f },
+        { 1.012431735e+00f, -1.983396173e+00f, 9.722032099e-01f, -1.983396173e+00f, 9.846349452e-01f },
+        { 1.024854223e+00f, -1.964286537e+00f, 9.444270976e-01f, -1.964286537e+00f, 9.692813204e-01f },
+        { 1.047692252e+00f, -1.919384047e+00f, 8.913390836e-01f, -1.919384047e+00f, 9.390313351e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.080811731e+00f, -1.463741523e+00f, 6.576954979e-01f, -1.463741523e+00f, 7.385072288e-01f },
+        { 7.147870200e-01f, -5.127104559e-01f, 5.124683284e-01f, -5.127104559e-01f, 2.272553484e-01f },
+        { 9.106284939e-01f, 9.748906571e-01f, 5.870455547e-01f, 9.748906571e-01f, 4.976740486e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 42 % */
+        { 1.006208637e+00f, -1.991958028e+00f, 9.860602994e-01f, -1.991958028e+00f, 9.922689367e-01f },
+        { 1.012367545e+00f, -1.983361048e+00f, 9.722322532e-01f, -1.983361048e+00f, 9.845997979e-01f },
+        { 1.024725452e+00f, -1.964216990e+00f, 9.444861449e-01f, -1.964216990e+00f, 9.692115966e-01f },
+        { 1.047565512e+00f, -1.919316647e+00f, 8.913977330e-01f, -1.919316647e+00f, 9.389632453e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.080405582e+00f, -1.463521096e+00f, 6.578398431e-01f, -1.463521096e+00f, 7.382454247e-01f },
+        { 7.139184869e-01f, -5.122542012e-01f, 5.122447422e-01f, -5.122542012e-01f, 2.261632291e-01f },
+        { 9.101789910e-01f, 9.746086750e-01f, 5.870618631e-01f, 9.746086750e-01f, 4.972408541e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 43 % */
+        { 1.006176501e+00f, -1.991940278e+00f, 9.860746825e-01f, -1.991940278e+00f, 9.922511839e-01f },
+        { 1.012303421e+00f, -1.983325843e+00f, 9.722611493e-01f, -1.983325843e+00f, 9.845645707e-01f },
+        { 1.024596819e+00f, -1.964147288e+00f, 9.445448982e-01f, -1.964147288e+00f, 9.691417171e-01f },
+        { 1.047438843e+00f, -1.919249175e+00f, 8.914562388e-01f, -1.919249175e+00f, 9.388950818e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.079999647e+00f, -1.463300482e+00f, 6.579837507e-01f, -1.463300482e+00f, 7.379833979e-01f },
+        { 7.130505709e-01f, -5.117977089e-01f, 5.120199699e-01f, -5.117977089e-01f, 2.250705409e-01f },
+        { 9.097296590e-01f, 9.743265314e-01f, 5.870777524e-01f, 9.743265314e-01f, 4.968074114e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 44 % */
+        { 1.006144399e+00f, -1.991922487e+00f, 9.860889917e-01f, -1.991922487e+00f, 9.922333904e-01f },
+        { 1.012239365e+00f, -1.983290558e+00f, 9.722898985e-01f, -1.983290558e+00f, 9.845292636e-01f },
+        { 1.024468324e+00f, -1.964077430e+00f, 9.446033579e-01f, -1.964077430e+00f, 9.690716815e-01f },
+        { 1.047312244e+00f, -1.919181629e+00f, 8.915146011e-01f, -1.919181629e+00f, 9.388268447e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.079593927e+00f, -1.463079680e+00f, 6.581272210e-01f, -1.463079680e+00f, 7.377211484e-01f },
+        { 7.121832712e-01f, -5.113409799e-01f, 5.117940151e-01f, -5.113409799e-01f, 2.239772863e-01f },
+        { 9.092804978e-01f, 9.740442263e-01f, 5.870932230e-01f, 9.740442263e-01f, 4.963737208e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 45 % */
+        { 1.006112329e+00f, -1.991904656e+00f, 9.861032273e-01f, -1.991904656e+00f, 9.922155562e-01f },
+        { 1.012175376e+00f, -1.983255192e+00f, 9.723185008e-01f, -1.983255192e+00f, 9.844938764e-01f },
+        { 1.024339965e+00f, -1.964007416e+00f, 9.446615242e-01f, -1.964007416e+00f, 9.690014894e-01f },
+        { 1.047185714e+00f, -1.919114010e+00f, 8.915728198e-01f, -1.919114010e+00f, 9.387585337e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.079188422e+00f, -1.462858691e+00f, 6.582702544e-01f, -1.462858691e+00f, 7.374586761e-01f },
+        { 7.113165867e-01f, -5.108840154e-01f, 5.115668810e-01f, -5.108840154e-01f, 2.228834677e-01f },
+        { 9.088315070e-01f, 9.737617599e-01f, 5.871082752e-01f, 9.737617599e-01f, 4.959397823e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 46 % */
+        { 1.006080292e+00f, -1.991886784e+00f, 9.861173892e-01f, -1.991886784e+00f, 9.921976812e-01f },
+        { 1.012111452e+00f, -1.983219747e+00f, 9.723469565e-01f, -1.983219747e+00f, 9.844584088e-01f },
+        { 1.024211743e+00f, -1.963937245e+00f, 9.447193975e-01f, -1.963937245e+00f, 9.689311405e-01f },
+        { 1.047059254e+00f, -1.919046318e+00f, 8.916308951e-01f, -1.919046318e+00f, 9.386901489e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.078783130e+00f, -1.462637513e+00f, 6.584128511e-01f, -1.462637513e+00f, 7.371959809e-01f },
+        { 7.104505167e-01f, -5.104268162e-01f, 5.113385709e-01f, -5.104268162e-01f, 2.217890876e-01f },
+        { 9.083826864e-01f, 9.734791322e-01f, 5.871229095e-01f, 9.734791322e-01f, 4.955055959e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 47 % */
+        { 1.006048288e+00f, -1.991868871e+00f, 9.861314775e-01f, -1.991868871e+00f, 9.921797653e-01f },
+        { 1.012047595e+00f, -1.983184221e+00f, 9.723752658e-01f, -1.983184221e+00f, 9.844228608e-01f },
+        { 1.024083656e+00f, -1.963866918e+00f, 9.447769782e-01f, -1.963866918e+00f, 9.688606345e-01f },
+        { 1.046932863e+00f, -1.918978553e+00f, 8.916888270e-01f, -1.918978553e+00f, 9.386216902e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.078378051e+00f, -1.462416149e+00f, 6.585550114e-01f, -1.462416149e+00f, 7.369330626e-01f },
+        { 7.095850602e-01f, -5.099693835e-01f, 5.111090883e-01f, -5.099693835e-01f, 2.206941485e-01f },
+        { 9.079340355e-01f, 9.731963432e-01f, 5.871371262e-01f, 9.731963432e-01f, 4.950711618e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 48 % */
+        { 1.006016316e+00f, -1.991850917e+00f, 9.861454923e-01f, -1.991850917e+00f, 9.921618084e-01f },
+        { 1.011983803e+00f, -1.983148615e+00f, 9.724034286e-01f, -1.983148615e+00f, 9.843872321e-01f },
+        { 1.023955705e+00f, -1.963796434e+00f, 9.448342665e-01f, -1.963796434e+00f, 9.687899710e-01f },
+        { 1.046806542e+00f, -1.918910715e+00f, 8.917466157e-01f, -1.918910715e+00f, 9.385531574e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.077973185e+00f, -1.462194596e+00f, 6.586967357e-01f, -1.462194596e+00f, 7.366699211e-01f },
+        { 7.087202163e-01f, -5.095117183e-01f, 5.108784365e-01f, -5.095117183e-01f, 2.195986528e-01f },
+        { 9.074855542e-01f, 9.729133929e-01f, 5.871509257e-01f, 9.729133929e-01f, 4.946364799e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 49 % */
+        { 1.005984377e+00f, -1.991832922e+00f, 9.861594337e-01f, -1.991832922e+00f, 9.921438105e-01f },
+        { 1.011920077e+00f, -1.983112928e+00f, 9.724314454e-01f, -1.983112928e+00f, 9.843515226e-01f },
+        { 1.023827887e+00f, -1.963725792e+00f, 9.448912628e-01f, -1.963725792e+00f, 9.687191498e-01f },
+        { 1.046680289e+00f, -1.918842803e+00f, 8.918042613e-01f, -1.918842803e+00f, 9.384845505e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.077568532e+00f, -1.461972855e+00f, 6.588380243e-01f, -1.461972855e+00f, 7.364065564e-01f },
+        { 7.078559843e-01f, -5.090538216e-01f, 5.106466188e-01f, -5.090538216e-01f, 2.185026031e-01f },
+        { 9.070372422e-01f, 9.726302815e-01f, 5.871643083e-01f, 9.726302815e-01f, 4.942015505e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 50 % */
+        { 1.005952470e+00f, -1.991814885e+00f, 9.861733018e-01f, -1.991814885e+00f, 9.921257714e-01f },
+        { 1.011856416e+00f, -1.983077159e+00f, 9.724593160e-01f, -1.983077159e+00f, 9.843157320e-01f },
+        { 1.023700203e+00f, -1.963654993e+00f, 9.449479674e-01f, -1.963654993e+00f, 9.686481703e-01f },
+        { 1.046554106e+00f, -1.918774818e+00f, 8.918617638e-01f, -1.918774818e+00f, 9.384158695e-01f },
+        { 1.114776522e+00f, -1.817468826e+00f, 7.790608670e-01f, -1.817468826e+00f, 8.938373885e-01f },
+        { 1.077164091e+00f, -1.461750926e+00f, 6.589788775e-01f, -1.461750926e+00f, 7.361429683e-01f },
+        { 7.069923632e-01f, -5.085956945e-01f, 5.104136386e-01f, -5.085956945e-01f, 2.174060018e-01f },
+        { 9.065890991e-01f, 9.723470089e-01f, 5.871772745e-01f, 9.723470089e-01f, 4.937663736e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 51 % */
+        { 1.005872841e+00f, -1.991769614e+00f, 9.862076515e-01f, -1.991769614e+00f, 9.920804930e-01f },
+        { 1.011856416e+00f, -1.983077159e+00f, 9.724593160e-01f, -1.983077159e+00f, 9.843157320e-01f },
+        { 1.023700203e+00f, -1.963654993e+00f, 9.449479674e-01f, -1.963654993e+00f, 9.686481703e-01f },
+        { 1.046554106e+00f, -1.918774818e+00f, 8.918617638e-01f, -1.918774818e+00f, 9.384158695e-01f },
+        { 1.112171470e+00f, -1.816352401e+00f, 7.805025817e-01f, -1.816352401e+00f, 8.926740516e-01f },
+        { 1.077164091e+00f, -1.461750926e+00f, 6.589788775e-01f, -1.461750926e+00f, 7.361429683e-01f },
+        { 7.069923632e-01f, -5.085956945e-01f, 5.104136386e-01f, -5.085956945e-01f, 2.174060018e-01f },
+        { 9.065890991e-01f, 9.723470089e-01f, 5.871772745e-01f, 9.723470089e-01f, 4.937663736e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 52 % */
+        { 1.005793411e+00f, -1.991724083e+00f, 9.862415445e-01f, -1.991724083e+00f, 9.920349553e-01f },
+        { 1.011856416e+00f, -1.983077159e+00f, 9.724593160e-01f, -1.983077159e+00f, 9.843157320e-01f },
+        { 1.023700203e+00f, -1.963654993e+00f, 9.449479674e-01f, -1.963654993e+00f, 9.686481703e-01f },
+        { 1.046554106e+00f, -1.918774818e+00f, 8.918617638e-01f, -1.918774818e+00f, 9.384158695e-01f },
+        { 1.109583697e+00f, -1.815224442e+00f, 7.819150004e-01f, -1.815224442e+00f, 8.914986971e-01f },
+        { 1.077164091e+00f, -1.461750926e+00f, 6.589788775e-01f, -1.461750926e+00f, 7.361429683e-01f },
+        { 7.069923632e-01f, -5.085956945e-01f, 5.104136386e-01f, -5.085956945e-01f, 2.174060018e-01f },
+        { 9.065890991e-01f, 9.723470089e-01f, 5.871772745e-01f, 9.723470089e-01f, 4.937663736e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 53 % */
+        { 1.005714175e+00f, -1.991678292e+00f, 9.862749818e-01f, -1.991678292e+00f, 9.919891568e-01f },
+        { 1.011856416e+00f, -1.983077159e+00f, 9.724593160e-01f, -1.983077159e+00f, 9.843157320e-01f },
+        { 1.023700203e+00f, -1.963654993e+00f, 9.449479674e-01f, -1.963654993e+00f, 9.686481703e-01f },
+        { 1.046554106e+00f, -1.918774818e+00f, 8.918617638e-01f, -1.918774818e+00f, 9.384158695e-01f },
+        { 1.107012883e+00f, -1.814084847e+00f, 7.832983341e-01f, -1.814084847e+00f, 8.903112169e-01f },
+        { 1.077164091e+00f, -1.461750926e+00f, 6.589788775e-01f, -1.461750926e+00f, 7.361429683e-01f },
+        { 7.069923632e-01f, -5.085956945e-01f, 5.104136386e-01f, -5.085956945e-01f, 2.174060018e-01f },
+        { 9.065890991e-01f, 9.723470089e-01f, 5.871772745e-01f, 9.723470089e-01f, 4.937663736e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 54 % */
+        { 1.005635131e+00f, -1.991632238e+00f, 9.863079647e-01f, -1.991632238e+00f, 9.919430960e-01f },
+        { 1.011856416e+00f, -1.983077159e+00f, 9.724593160e-01f, -1.983077159e+00f, 9.843157320e-01f },
+        { 1.023700203e+00f, -1.963654993e+00f, 9.449479674e-01f, -1.963654993e+00f, 9.686481703e-01f },
+        { 1.046554106e+00f, -1.918774818e+00f, 8.918617638e-01f, -1.918774818e+00f, 9.384158695e-01f },
+        { 1.104458711e+00f, -1.812933511e+00f, 7.846527911e-01f, -1.812933511e+00f, 8.891115024e-01f },
+        { 1.077164091e+00f, -1.461750926e+00f, 6.589788775e-01f, -1.461750926e+00f, 7.361429683e-01f },
+        { 7.069923632e-01f, -5.085956945e-01f, 5.104136386e-01f, -5.085956945e-01f, 2.174060018e-01f },
+        { 9.065890991e-01f, 9.723470089e-01f, 5.871772745e-01f, 9.723470089e-01f, 4.937663736e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 55 % */
+        { 1.005556277e+00f, -1.991585921e+00f, 9.863404941e-01f, -1.991585921e+00f, 9.918967714e-01f },
+        { 1.011856416e+00f, -1.983077159e+00f, 9.724593160e-01f, -1.983077159e+00f, 9.843157320e-01f },
+        { 1.023700203e+00f, -1.963654993e+00f, 9.449479674e-01f, -1.963654993e+00f, 9.686481703e-01f },
+        { 1.046554106e+00f, -1.918774818e+00f, 8.918617638e-01f, -1.918774818e+00f, 9.384158695e-01f },
+        { 1.101920869e+00f, -1.811770328e+00f, 7.859785758e-01f, -1.811770328e+00f, 8.878994443e-01f },
+        { 1.077164091e+00f, -1.461750926e+00f, 6.589788775e-01f, -1.461750926e+00f, 7.361429683e-01f },
+        { 7.069923632e-01f, -5.085956945e-01f, 5.104136386e-01f, -5.085956945e-01f, 2.174060018e-01f },
+        { 9.065890991e-01f, 9.723470089e-01f, 5.871772745e-01f, 9.723470089e-01f, 4.937663736e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 56 % */
+        { 1.005477610e+00f, -1.991539338e+00f, 9.863725712e-01f, -1.991539338e+00f, 9.918501816e-01f },
+        { 1.011856416e+00f, -1.983077159e+00f, 9.724593160e-01f, -1.983077159e+00f, 9.843157320e-01f },
+        { 1.023700203e+00f, -1.963654993e+00f, 9.449479674e-01f, -1.963654993e+00f, 9.686481703e-01f },
+        { 1.046554106e+00f, -1.918774818e+00f, 8.918617638e-01f, -1.918774818e+00f, 9.384158695e-01f },
+        { 1.099399043e+00f, -1.810595195e+00f, 7.872758896e-01f, -1.810595195e+00f, 8.866749326e-01f },
+        { 1.077164091e+00f, -1.461750926e+00f, 6.589788775e-01f, -1.461750926e+00f, 7.361429683e-01f },
+        { 7.069923632e-01f, -5.085956945e-01f, 5.104136386e-01f, -5.085956945e-01f, 2.174060018e-01f },
+        { 9.065890991e-01f, 9.723470089e-01f, 5.871772745e-01f, 9.723470089e-01f, 4.937663736e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 57 % */
+        { 1.005399128e+00f, -1.991492489e+00f, 9.864041971e-01f, -1.991492489e+00f, 9.918033250e-01f },
+        { 1.011856416e+00f, -1.983077159e+00f, 9.724593160e-01f, -1.983077159e+00f, 9.843157320e-01f },
+        { 1.023700203e+00f, -1.963654993e+00f, 9.449479674e-01f, -1.963654993e+00f, 9.686481703e-01f },
+        { 1.046554106e+00f, -1.918774818e+00f, 8.918617638e-01f, -1.918774818e+00f, 9.384158695e-01f },
+        { 1.096892926e+00f, -1.809408004e+00f, 7.885449306e-01f, -1.809408004e+00f, 8.854378568e-01f },
+        { 1.077164091e+00f, -1.461750926e+00f, 6.589788775e-01f, -1.461750926e+00f, 7.361429683e-01f },
+        { 7.069923632e-01f, -5.085956945e-01f, 5.104136386e-01f, -5.085956945e-01f, 2.174060018e-01f },
+        { 9.065890991e-01f, 9.723470089e-01f, 5.871772745e-01f, 9.723470089e-01f, 4.937663736e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 58 % */
+        { 1.005320827e+00f, -1.991445372e+00f, 9.864353728e-01f, -1.991445372e+00f, 9.917562001e-01f },
+        { 1.011856416e+00f, -1.983077159e+00f, 9.724593160e-01f, -1.983077159e+00f, 9.843157320e-01f },
+        { 1.023700203e+00f, -1.963654993e+00f, 9.449479674e-01f, -1.963654993e+00f, 9.686481703e-01f },
+        { 1.046554106e+00f, -1.918774818e+00f, 8.918617638e-01f, -1.918774818e+00f, 9.384158695e-01f },
+        { 1.094402212e+00f, -1.808208649e+00f, 7.897858938e-01f, -1.808208649e+00f, 8.841881058e-01f },
+        { 1.077164091e+00f, -1.461750926e+00f, 6.589788775e-01f, -1.461750926e+00f, 7.361429683e-01f },
+        { 7.069923632e-01f, -5.085956945e-01f, 5.104136386e-01f, -5.085956945e-01f, 2.174060018e-01f },
+        { 9.065890991e-01f, 9.723470089e-01f, 5.871772745e-01f, 9.723470089e-01f, 4.937663736e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 59 % */
+        { 1.005242706e+00f, -1.991397984e+00f, 9.864660994e-01f, -1.991397984e+00f, 9.917088054e-01f },
+        { 1.011856416e+00f, -1.983077159e+00f, 9.724593160e-01f, -1.983077159e+00f, 9.843157320e-01f },
+        { 1.023700203e+00f, -1.963654993e+00f, 9.449479674e-01f, -1.963654993e+00f, 9.686481703e-01f },
+        { 1.046554106e+00f, -1.918774818e+00f, 8.918617638e-01f, -1.918774818e+00f, 9.384158695e-01f },
+        { 1.091926597e+00f, -1.806997022e+00f, 7.909989708e-01f, -1.806997022e+00f, 8.829255680e-01f },
+        { 1.077164091e+00f, -1.461750926e+00f, 6.589788775e-01f, -1.461750926e+00f, 7.361429683e-01f },
+        { 7.069923632e-01f, -5.085956945e-01f, 5.104136386e-01f, -5.085956945e-01f, 2.174060018e-01f },
+        { 9.065890991e-01f, 9.723470089e-01f, 5.871772745e-01f, 9.723470089e-01f, 4.937663736e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 60 % */
+        { 1.005164761e+00f, -1.991350326e+00f, 9.864963780e-01f, -1.991350326e+00f, 9.916611394e-01f },
+        { 1.011856416e+00f, -1.983077159e+00f, 9.724593160e-01f, -1.983077159e+00f, 9.843157320e-01f },
+        { 1.023700203e+00f, -1.963654993e+00f, 9.449479674e-01f, -1.963654993e+00f, 9.686481703e-01f },
+        { 1.046554106e+00f, -1.918774818e+00f, 8.918617638e-01f, -1.918774818e+00f, 9.384158695e-01f },
+        { 1.089465781e+00f, -1.805773017e+00f, 7.921843503e-01f, -1.805773017e+00f, 8.816501309e-01f },
+        { 1.077164091e+00f, -1.461750926e+00f, 6.589788775e-01f, -1.461750926e+00f, 7.361429683e-01f },
+        { 7.069923632e-01f, -5.085956945e-01f, 5.104136386e-01f, -5.085956945e-01f, 2.174060018e-01f },
+        { 9.065890991e-01f, 9.723470089e-01f, 5.871772745e-01f, 9.723470089e-01f, 4.937663736e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 61 % */
+        { 1.005086991e+00f, -1.991302394e+00f, 9.865262095e-01f, -1.991302394e+00f, 9.916132005e-01f },
+        { 1.011697545e+00f, -1.982987383e+00f, 9.725283548e-01f, -1.982987383e+00f, 9.842258999e-01f },
+        { 1.023381573e+00f, -1.963477302e+00f, 9.450884547e-01f, -1.963477302e+00f, 9.684700276e-01f },
+        { 1.045924216e+00f, -1.918433788e+00f, 8.921471330e-01f, -1.918433788e+00f, 9.380713491e-01f },
+        { 1.087019464e+00f, -1.804536524e+00f, 7.933422177e-01f, -1.804536524e+00f, 8.803616818e-01f },
+        { 1.073131248e+00f, -1.459521274e+00f, 6.603635297e-01f, -1.459521274e+00f, 7.334947773e-01f },
+        { 7.026833917e-01f, -5.063016389e-01f, 5.092314172e-01f, -5.063016389e-01f, 2.119148089e-01f },
+        { 9.021168970e-01f, 9.695054326e-01f, 5.872841099e-01f, 9.695054326e-01f, 4.894010069e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 62 % */
+        { 1.005009392e+00f, -1.991254189e+00f, 9.865555950e-01f, -1.991254189e+00f, 9.915649872e-01f },
+        { 1.011539073e+00f, -1.982897097e+00f, 9.725964843e-01f, -1.982897097e+00f, 9.841355574e-01f },
+        { 1.023063763e+00f, -1.963298618e+00f, 9.452271258e-01f, -1.963298618e+00f, 9.682908890e-01f },
+        { 1.045296026e+00f, -1.918090912e+00f, 8.924289378e-01f, -1.918090912e+00f, 9.377249633e-01f },
+        { 1.084587352e+00f, -1.803287436e+00f, 7.944727556e-01f, -1.803287436e+00f, 8.790601072e-01f },
+        { 1.069119148e+00f, -1.457272713e+00f, 6.617049803e-01f, -1.457272713e+00f, 7.308241286e-01f },
+        { 6.983895678e-01f, -5.040019795e-01f, 5.080206348e-01f, -5.040019795e-01f, 2.064102026e-01f },
+        { 8.976612743e-01f, 9.666478005e-01f, 5.873497003e-01f, 9.666478005e-01f, 4.850109746e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 63 % */
+        { 1.004931963e+00f, -1.991205707e+00f, 9.865845354e-01f, -1.991205707e+00f, 9.915164979e-01f },
+        { 1.011380995e+00f, -1.982806298e+00f, 9.726637067e-01f, -1.982806298e+00f, 9.840447016e-01f },
+        { 1.022746764e+00f, -1.963118935e+00f, 9.453639856e-01f, -1.963118935e+00f, 9.681107492e-01f },
+        { 1.044669514e+00f, -1.917746181e+00f, 8.927071887e-01f, -1.917746181e+00f, 9.373767027e-01f },
+        { 1.082169150e+00f, -1.802025641e+00f, 7.955761432e-01f, -1.802025641e+00f, 8.777452931e-01f },
+        { 1.065127380e+00f, -1.455005153e+00f, 6.630035350e-01f, -1.455005153e+00f, 7.281309146e-01f },
+        { 6.941107913e-01f, -5.016968489e-01f, 5.067817085e-01f, -5.016968489e-01f, 2.008924998e-01f },
+        { 8.932219491e-01f, 9.637741671e-01f, 5.873744114e-01f, 9.637741671e-01f, 4.805963605e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 64 % */
+        { 1.004854699e+00f, -1.991156948e+00f, 9.866130317e-01f, -1.991156948e+00f, 9.914677310e-01f },
+        { 1.011223305e+00f, -1.982714983e+00f, 9.727300243e-01f, -1.982714983e+00f, 9.839533297e-01f },
+        { 1.022430564e+00f, -1.962938248e+00f, 9.454990387e-01f, -1.962938248e+00f, 9.679296026e-01f },
+        { 1.044044662e+00f, -1.917399583e+00f, 8.929818958e-01f, -1.917399583e+00f, 9.370265578e-01f },
+        { 1.079764568e+00f, -1.800751031e+00f, 7.966525569e-01f, -1.800751031e+00f, 8.764171249e-01f },
+        { 1.061155533e+00f, -1.452718505e+00f, 6.642594956e-01f, -1.452718505e+00f, 7.254150289e-01f },
+        { 6.898469663e-01f, -4.993863807e-01f, 5.055150544e-01f, -4.993863807e-01f, 1.953620207e-01f },
+        { 8.887986452e-01f, 9.608845899e-01f, 5.873586074e-01f, 9.608845899e-01f, 4.761572525e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 65 % */
+        { 1.004777600e+00f, -1.991107909e+00f, 9.866410850e-01f, -1.991107909e+00f, 9.914186851e-01f },
+        { 1.011065999e+00f, -1.982623150e+00f, 9.727954395e-01f, -1.982623150e+00f, 9.838614388e-01f },
+        { 1.022115154e+00f, -1.962756551e+00f, 9.456322901e-01f, -1.962756551e+00f, 9.677474438e-01f },
+        { 1.043421450e+00f, -1.917051112e+00f, 8.932530695e-01f, -1.917051112e+00f, 9.366745191e-01f },
+        { 1.077373317e+00f, -1.799463495e+00f, 7.977021704e-01f, -1.799463495e+00f, 8.750754875e-01f },
+        { 1.057203205e+00f, -1.450412679e+00f, 6.654731606e-01f, -1.450412679e+00f, 7.226763661e-01f },
+        { 6.855980009e-01f, -4.970707100e-01f, 5.042210877e-01f, -4.970707100e-01f, 1.898190886e-01f },
+        { 8.843910918e-01f, 9.579791287e-01f, 5.873026511e-01f, 9.579791287e-01f, 4.716937429e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 66 % */
+        { 1.004700662e+00f, -1.991058590e+00f, 9.866686961e-01f, -1.991058590e+00f, 9.913693584e-01f },
+        { 1.010909072e+00f, -1.982530794e+00f, 9.728599544e-01f, -1.982530794e+00f, 9.837690259e-01f },
+        { 1.021800523e+00f, -1.962573839e+00f, 9.457637443e-01f, -1.962573839e+00f, 9.675642675e-01f },
+        { 1.042799858e+00f, -1.916700756e+00f, 8.935207196e-01f, -1.916700756e+00f, 9.363205772e-01f },
+        { 1.074995111e+00f, -1.798162922e+00f, 7.987251539e-01f, -1.798162922e+00f, 8.737202653e-01f },
+        { 1.053269997e+00f, -1.448087589e+00f, 6.666448253e-01f, -1.448087589e+00f, 7.199148224e-01f },
+        { 6.813638075e-01f, -4.947499732e-01f, 5.029002225e-01f, -4.947499732e-01f, 1.842640300e-01f },
+        { 8.799990240e-01f, 9.550578464e-01f, 5.872069041e-01f, 9.550578464e-01f, 4.672059281e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 67 % */
+        { 1.004623883e+00f, -1.991008989e+00f, 9.866958660e-01f, -1.991008989e+00f, 9.913197494e-01f },
+        { 1.010752517e+00f, -1.982437915e+00f, 9.729235713e-01f, -1.982437915e+00f, 9.836760883e-01f },
+        { 1.021486662e+00f, -1.962390107e+00f, 9.458934062e-01f, -1.962390107e+00f, 9.673800681e-01f },
+        { 1.042179866e+00f, -1.916348507e+00f, 8.937848563e-01f, -1.916348507e+00f, 9.359647224e-01f },
+        { 1.072629667e+00f, -1.796849200e+00f, 7.997216753e-01f, -1.796849200e+00f, 8.723513420e-01f },
+        { 1.049355514e+00f, -1.445743148e+00f, 6.677747814e-01f, -1.445743148e+00f, 7.171302952e-01f },
+        { 6.771443025e-01f, -4.924243080e-01f, 5.015528720e-01f, -4.924243080e-01f, 1.786971745e-01f },
+        { 8.756221821e-01f, 9.521208086e-01f, 5.870717269e-01f, 9.521208086e-01f, 4.626939090e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 68 % */
+        { 1.004547261e+00f, -1.990959104e+00f, 9.867225956e-01f, -1.990959104e+00f, 9.912698565e-01f },
+        { 1.010596331e+00f, -1.982344508e+00f, 9.729862924e-01f, -1.982344508e+00f, 9.835826229e-01f },
+        { 1.021173560e+00f, -1.962205349e+00f, 9.460212801e-01f, -1.962205349e+00f, 9.671948400e-01f },
+        { 1.041561456e+00f, -1.915994355e+00f, 8.940454892e-01f, -1.915994355e+00f, 9.356069451e-01f },
+        { 1.070276702e+00f, -1.795522218e+00f, 8.006918992e-01f, -1.795522218e+00f, 8.709686010e-01f },
+        { 1.045459366e+00f, -1.443379270e+00f, 6.688633175e-01f, -1.443379270e+00f, 7.143226831e-01f },
+        { 6.729394061e-01f, -4.900938533e-01f, 5.001794483e-01f, -4.900938533e-01f, 1.731188545e-01f },
+        { 8.712603122e-01f, 9.491680837e-01f, 5.868974784e-01f, 9.491680837e-01f, 4.581577906e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 69 % */
+        { 1.004470792e+00f, -1.990908933e+00f, 9.867488858e-01f, -1.990908933e+00f, 9.912196781e-01f },
+        { 1.010440507e+00f, -1.982250570e+00f, 9.730481198e-01f, -1.982250570e+00f, 9.834886268e-01f },
+        { 1.020861207e+00f, -1.962019559e+00f, 9.461473707e-01f, -1.962019559e+00f, 9.670085778e-01f },
+        { 1.040944607e+00f, -1.915638290e+00f, 8.943026283e-01f, -1.915638290e+00f, 9.352472357e-01f },
+        { 1.067935937e+00f, -1.794181862e+00f, 8.016359876e-01f, -1.794181862e+00f, 8.695719250e-01f },
+        { 1.041581167e+00f, -1.440995872e+00f, 6.699107190e-01f, -1.440995872e+00f, 7.114918863e-01f },
+        { 6.687490427e-01f, -4.877587492e-01f, 4.987803626e-01f, -4.877587492e-01f, 1.675294053e-01f },
+        { 8.669131656e-01f, 9.461997429e-01f, 5.866845168e-01f, 9.461997429e-01f, 4.535976824e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 70 % */
+        { 1.004394475e+00f, -1.990858476e+00f, 9.867747376e-01f, -1.990858476e+00f, 9.911692125e-01f },
+        { 1.010285041e+00f, -1.982156100e+00f, 9.731090556e-01f, -1.982156100e+00f, 9.833940971e-01f },
+        { 1.020549593e+00f, -1.961832732e+00f, 9.462716825e-01f, -1.961832732e+00f, 9.668212759e-01f },
+        { 1.040329301e+00f, -1.915280304e+00f, 8.945562830e-01f, -1.915280304e+00f, 9.348855845e-01f },
+        { 1.065607097e+00f, -1.792828021e+00f, 8.025540997e-01f, -1.792828021e+00f, 8.681611962e-01f },
+        { 1.037720538e+00f, -1.438592870e+00f, 6.709172683e-01f, -1.438592870e+00f, 7.086378063e-01f },
+        { 6.645731403e-01f, -4.854191369e-01f, 4.973560249e-01f, -4.854191369e-01f, 1.619291651e-01f },
+        { 8.625804993e-01f, 9.432158604e-01f, 5.864331988e-01f, 9.432158604e-01f, 4.490136981e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 71 % */
+        { 1.004318307e+00f, -1.990807729e+00f, 9.868001517e-01f, -1.990807729e+00f, 9.911184582e-01f },
+        { 1.010129929e+00f, -1.982061093e+00f, 9.731691019e-01f, -1.982061093e+00f, 9.832990307e-01f },
+        { 1.020238709e+00f, -1.961644862e+00f, 9.463942198e-01f, -1.961644862e+00f, 9.666329287e-01f },
+        { 1.039715519e+00f, -1.914920385e+00f, 8.948064630e-01f, -1.914920385e+00f, 9.345219818e-01f },
+        { 1.064447062e+00f, -1.792146007e+00f, 8.030034636e-01f, -1.792146007e+00f, 8.674505251e-01f },
+        { 1.035796694e+00f, -1.437383993e+00f, 6.714053107e-01f, -1.437383993e+00f, 7.072020048e-01f },
+        { 6.604116307e-01f, -4.830751589e-01f, 4.959068442e-01f, -4.830751589e-01f, 1.563184749e-01f },
+        { 8.604195217e-01f, 9.417181149e-01f, 5.862932675e-01f, 9.417181149e-01f, 4.467127892e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 72 % */
+        { 1.004242284e+00f, -1.990756693e+00f, 9.868251291e-01f, -1.990756693e+00f, 9.910674136e-01f },
+        { 1.009975164e+00f, -1.981965546e+00f, 9.732282608e-01f, -1.981965546e+00f, 9.832034247e-01f },
+        { 1.019928543e+00f, -1.961455945e+00f, 9.465149871e-01f, -1.961455945e+00f, 9.664435304e-01f },
+        { 1.039103240e+00f, -1.914558525e+00f, 8.950531777e-01f, -1.914558525e+00f, 9.341564178e-01f },
+        { 1.063289905e+00f, -1.791460580e+00f, 8.034463918e-01f, -1.791460580e+00f, 8.667362964e-01f },
+        { 1.033877102e+00f, -1.436170184e+00f, 6.718832445e-01f, -1.436170184e+00f, 7.057603462e-01f },
+        { 6.562644497e-01f, -4.807269588e-01f, 4.944332286e-01f, -4.807269588e-01f, 1.506976783e-01f },
+        { 8.582620754e-01f, 9.402165130e-01f, 5.861438805e-01f, 9.402165130e-01f, 4.444059559e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 73 % */
+        { 1.004166406e+00f, -1.990705364e+00f, 9.868496705e-01f, -1.990705364e+00f, 9.910160768e-01f },
+        { 1.009820742e+00f, -1.981869458e+00f, 9.732865344e-01f, -1.981869458e+00f, 9.831072760e-01f },
+        { 1.019619087e+00f, -1.961265973e+00f, 9.466339886e-01f, -1.961265973e+00f, 9.662530756e-01f },
+        { 1.038492446e+00f, -1.914194714e+00f, 8.952964364e-01f, -1.914194714e+00f, 9.337888827e-01f },
+        { 1.062135592e+00f, -1.790771724e+00f, 8.038829036e-01f, -1.790771724e+00f, 8.660184953e-01f },
+        { 1.031961715e+00f, -1.434951434e+00f, 6.723511042e-01f, -1.434951434e+00f, 7.043128187e-01f },
+        { 6.521315365e-01f, -4.783746811e-01f, 4.929355849e-01f, -4.783746811e-01f, 1.450671214e-01f },
+        { 8.561081317e-01f, 9.387110647e-01f, 5.859850821e-01f, 9.387110647e-01f, 4.420932138e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 74 % */
+        { 1.004090669e+00f, -1.990653741e+00f, 9.868737769e-01f, -1.990653741e+00f, 9.909644464e-01f },
+        { 1.009666657e+00f, -1.981772824e+00f, 9.733439247e-01f, -1.981772824e+00f, 9.830105817e-01f },
+        { 1.019310330e+00f, -1.961074942e+00f, 9.467512286e-01f, -1.961074942e+00f, 9.660615585e-01f },
+        { 1.037883118e+00f, -1.913828942e+00f, 8.955362483e-01f, -1.913828942e+00f, 9.334193666e-01f },
+        { 1.060984089e+00f, -1.790079425e+00f, 8.043130177e-01f, -1.790079425e+00f, 8.652971069e-01f },
+        { 1.030050487e+00f, -1.433727732e+00f, 6.728089239e-01f, -1.433727732e+00f, 7.028594106e-01f },
+        { 6.480128339e-01f, -4.760184715e-01f, 4.914143190e-01f, -4.760184715e-01f, 1.394271529e-01f },
+        { 8.539576618e-01f, 9.372017805e-01f, 5.858169166e-01f, 9.372017805e-01f, 4.397745784e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 75 % */
+        { 1.004015071e+00f, -1.990601824e+00f, 9.868974491e-01f, -1.990601824e+00f, 9.909125206e-01f },
+        { 1.009512905e+00f, -1.981675641e+00f, 9.734004335e-01f, -1.981675641e+00f, 9.829133386e-01f },
+        { 1.019002262e+00f, -1.960882845e+00f, 9.468667113e-01f, -1.960882845e+00f, 9.658689734e-01f },
+        { 1.037275237e+00f, -1.913461200e+00f, 8.957726226e-01f, -1.913461200e+00f, 9.330478598e-01f },
+        { 1.059835363e+00f, -1.789383670e+00f, 8.047367531e-01f, -1.789383670e+00f, 8.645721162e-01f },
+        { 1.028143372e+00f, -1.432499070e+00f, 6.732567379e-01f, -1.432499070e+00f, 7.014001101e-01f },
+        { 6.439082883e-01f, -4.736584767e-01f, 4.898698356e-01f, -4.736584767e-01f, 1.337781238e-01f },
+        { 8.518106377e-01f, 9.356886705e-01f, 5.856394282e-01f, 9.356886705e-01f, 4.374500660e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 76 % */
+        { 1.003939610e+00f, -1.990549609e+00f, 9.869206878e-01f, -1.990549609e+00f, 9.908602977e-01f },
+        { 1.009359481e+00f, -1.981577907e+00f, 9.734560630e-01f, -1.981577907e+00f, 9.828155438e-01f },
+        { 1.018694874e+00f, -1.960689677e+00f, 9.469804409e-01f, -1.960689677e+00f, 9.656753145e-01f },
+        { 1.036668784e+00f, -1.913091477e+00f, 8.960055683e-01f, -1.913091477e+00f, 9.326743522e-01f },
+        { 1.058689380e+00f, -1.788684443e+00f, 8.051541284e-01f, -1.788684443e+00f, 8.638435084e-01f },
+        { 1.026240326e+00f, -1.431265436e+00f, 6.736945799e-01f, -1.431265436e+00f, 6.999349056e-01f },
+        { 6.398178495e-01f, -4.712948443e-01f, 4.883025382e-01f, -4.712948443e-01f, 1.281203877e-01f },
+        { 8.496670315e-01f, 9.341717455e-01f, 5.854526611e-01f, 9.341717455e-01f, 4.351196926e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 77 % */
+        { 1.003864282e+00f, -1.990497096e+00f, 9.869434939e-01f, -1.990497096e+00f, 9.908077762e-01f },
+        { 1.009206379e+00f, -1.981479619e+00f, 9.735108149e-01f, -1.981479619e+00f, 9.827171941e-01f },
+        { 1.018388155e+00f, -1.960495433e+00f, 9.470924214e-01f, -1.960495433e+00f, 9.654805761e-01f },
+        { 1.036063739e+00f, -1.912719763e+00f, 8.962350944e-01f, -1.912719763e+00f, 9.322988338e-01f },
+        { 1.057546106e+00f, -1.787981730e+00f, 8.055651620e-01f, -1.787981730e+00f, 8.631112684e-01f },
+        { 1.024341302e+00f, -1.430026822e+00f, 6.741224838e-01f, -1.430026822e+00f, 6.984637857e-01f },
+        { 6.357414708e-01f, -4.689277229e-01f, 4.867128293e-01f, -4.689277229e-01f, 1.224543001e-01f },
+        { 8.475268156e-01f, 9.326510163e-01f, 5.852566594e-01f, 9.326510163e-01f, 4.327834750e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 78 % */
+        { 1.003789086e+00f, -1.990444282e+00f, 9.869658682e-01f, -1.990444282e+00f, 9.907549542e-01f },
+        { 1.009053595e+00f, -1.981380773e+00f, 9.735646913e-01f, -1.981380773e+00f, 9.826182865e-01f },
+        { 1.018082095e+00f, -1.960300106e+00f, 9.472026569e-01f, -1.960300106e+00f, 9.652847523e-01f },
+        { 1.035460085e+00f, -1.912346050e+00f, 8.964612096e-01f, -1.912346050e+00f, 9.319212948e-01f },
+        { 1.056405509e+00f, -1.787275517e+00f, 8.059698722e-01f, -1.787275517e+00f, 8.623753812e-01f },
+        { 1.022446256e+00f, -1.428783218e+00f, 6.745404830e-01f, -1.428783218e+00f, 6.969867390e-01f },
+        { 6.316791087e-01f, -4.665572620e-01f, 4.851011101e-01f, -4.665572620e-01f, 1.167802188e-01f },
+        { 8.453899628e-01f, 9.311264937e-01f, 5.850514671e-01f, 9.311264937e-01f, 4.304414299e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 79 % */
+        { 1.003714019e+00f, -1.990391166e+00f, 9.869878113e-01f, -1.990391166e+00f, 9.907018301e-01f },
+        { 1.008901124e+00f, -1.981281367e+00f, 9.736176940e-01f, -1.981281367e+00f, 9.825188179e-01f },
+        { 1.017776686e+00f, -1.960103690e+00f, 9.473111514e-01f, -1.960103690e+00f, 9.650878374e-01f },
+        { 1.034857802e+00f, -1.911970326e+00f, 8.966839227e-01f, -1.911970326e+00f, 9.315417250e-01f },
+        { 1.055267555e+00f, -1.786565790e+00f, 8.063682771e-01f, -1.786565790e+00f, 8.616358319e-01f },
+        { 1.020555143e+00f, -1.427534615e+00f, 6.749486109e-01f, -1.427534615e+00f, 6.955037542e-01f },
+        { 6.276307230e-01f, -4.641836120e-01f, 4.834677808e-01f, -4.641836120e-01f, 1.110985038e-01f },
+        { 8.432564462e-01f, 9.295981889e-01f, 5.848371282e-01f, 9.295981889e-01f, 4.280935744e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 80 % */
+        { 1.003639078e+00f, -1.990337747e+00f, 9.870093241e-01f, -1.990337747e+00f, 9.906484021e-01f },
+        { 1.008748960e+00f, -1.981181396e+00f, 9.736698247e-01f, -1.981181396e+00f, 9.824187851e-01f },
+        { 1.017471917e+00f, -1.959906181e+00f, 9.474179088e-01f, -1.959906181e+00f, 9.648898256e-01f },
+        { 1.034256872e+00f, -1.911592582e+00f, 8.969032423e-01f, -1.911592582e+00f, 9.311601143e-01f },
+        { 1.054132211e+00f, -1.785852534e+00f, 8.067603947e-01f, -1.785852534e+00f, 8.608926053e-01f },
+        { 1.018667919e+00f, -1.426281002e+00f, 6.753469009e-01f, -1.426281002e+00f, 6.940148202e-01f },
+        { 6.235962768e-01f, -4.618069240e-01f, 4.818132401e-01f, -4.618069240e-01f, 1.054095169e-01f },
+        { 8.411262393e-01f, 9.280661134e-01f, 5.846136867e-01f, 9.280661134e-01f, 4.257399260e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 81 % */
+        { 1.003564261e+00f, -1.990284021e+00f, 9.870304073e-01f, -1.990284021e+00f, 9.905946687e-01f },
+        { 1.008748960e+00f, -1.981181396e+00f, 9.736698247e-01f, -1.981181396e+00f, 9.824187851e-01f },
+        { 1.017471917e+00f, -1.959906181e+00f, 9.474179088e-01f, -1.959906181e+00f, 9.648898256e-01f },
+        { 1.033058995e+00f, -1.910830993e+00f, 8.973317350e-01f, -1.910830993e+00f, 9.303907297e-01f },
+        { 1.052999443e+00f, -1.785135734e+00f, 8.071462429e-01f, -1.785135734e+00f, 8.601456863e-01f },
+        { 1.016784540e+00f, -1.425022371e+00f, 6.757353858e-01f, -1.425022371e+00f, 6.925199259e-01f },
+        { 6.195757362e-01f, -4.594273500e-01f, 4.801378857e-01f, -4.594273500e-01f, 9.971362191e-02f },
+        { 8.389993159e-01f, 9.265302784e-01f, 5.843811864e-01f, 9.265302784e-01f, 4.233805023e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 82 % */
+        { 1.003489566e+00f, -1.990229989e+00f, 9.870510616e-01f, -1.990229989e+00f, 9.905406279e-01f },
+        { 1.008748960e+00f, -1.981181396e+00f, 9.736698247e-01f, -1.981181396e+00f, 9.824187851e-01f },
+        { 1.017471917e+00f, -1.959906181e+00f, 9.474179088e-01f, -1.959906181e+00f, 9.648898256e-01f },
+        { 1.031866305e+00f, -1.910061203e+00f, 8.977467548e-01f, -1.910061203e+00f, 9.296130596e-01f },
+        { 1.051869221e+00f, -1.784415377e+00f, 8.075258393e-01f, -1.784415377e+00f, 8.593950599e-01f },
+        { 1.014904962e+00f, -1.423758713e+00f, 6.761140985e-01f, -1.423758713e+00f, 6.910190604e-01f },
+        { 6.155690703e-01f, -4.570450427e-01f, 4.784421140e-01f, -4.570450427e-01f, 9.401118437e-02f },
+        { 8.368756501e-01f, 9.249906958e-01f, 5.841396712e-01f, 9.249906958e-01f, 4.210153213e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 83 % */
+        { 1.003414990e+00f, -1.990175648e+00f, 9.870712878e-01f, -1.990175648e+00f, 9.904862781e-01f },
+        { 1.008748960e+00f, -1.981181396e+00f, 9.736698247e-01f, -1.981181396e+00f, 9.824187851e-01f },
+        { 1.017471917e+00f, -1.959906181e+00f, 9.474179088e-01f, -1.959906181e+00f, 9.648898256e-01f },
+        { 1.030678655e+00f, -1.909283129e+00f, 8.981483672e-01f, -1.909283129e+00f, 9.288270218e-01f },
+        { 1.050741510e+00f, -1.783691447e+00f, 8.078992013e-01f, -1.783691447e+00f, 8.586407109e-01f },
+        { 1.013029141e+00f, -1.422490018e+00f, 6.764830719e-01f, -1.422490018e+00f, 6.895122128e-01f },
+        { 6.115762515e-01f, -4.546601556e-01f, 4.767263201e-01f, -4.546601556e-01f, 8.830257156e-02f },
+        { 8.347552162e-01f, 9.234473775e-01f, 5.838891849e-01f, 9.234473775e-01f, 4.186444012e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 84 % */
+        { 1.003340531e+00f, -1.990120996e+00f, 9.870910864e-01f, -1.990120996e+00f, 9.904316176e-01f },
+        { 1.008748960e+00f, -1.981181396e+00f, 9.736698247e-01f, -1.981181396e+00f, 9.824187851e-01f },
+        { 1.017471917e+00f, -1.959906181e+00f, 9.474179088e-01f, -1.959906181e+00f, 9.648898256e-01f },
+        { 1.029495897e+00f, -1.908496691e+00f, 8.985366362e-01f, -1.908496691e+00f, 9.280325333e-01f },
+        { 1.049616278e+00f, -1.782963930e+00f, 8.082663463e-01f, -1.782963930e+00f, 8.578826241e-01f },
+        { 1.011157034e+00f, -1.421216277e+00f, 6.768423384e-01f, -1.421216277e+00f, 6.879993724e-01f },
+        { 6.075972547e-01f, -4.522728427e-01f, 4.749908976e-01f, -4.522728427e-01f, 8.258815237e-02f },
+        { 8.326379892e-01f, 9.219003354e-01f, 5.836297713e-01f, 9.219003354e-01f, 4.162677605e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 85 % */
+        { 1.003266186e+00f, -1.990066031e+00f, 9.871104583e-01f, -1.990066031e+00f, 9.903766445e-01f },
+        { 1.008748960e+00f, -1.981181396e+00f, 9.736698247e-01f, -1.981181396e+00f, 9.824187851e-01f },
+        { 1.017471917e+00f, -1.959906181e+00f, 9.474179088e-01f, -1.959906181e+00f, 9.648898256e-01f },
+        { 1.028317887e+00f, -1.907701805e+00f, 8.989116240e-01f, -1.907701805e+00f, 9.272295107e-01f },
+        { 1.048493493e+00f, -1.782232811e+00f, 8.086272915e-01f, -1.782232811e+00f, 8.571207844e-01f },
+        { 1.009288598e+00f, -1.419937482e+00f, 6.771919304e-01f, -1.419937482e+00f, 6.864805287e-01f },
+        { 6.036320580e-01f, -4.498832589e-01f, 4.732362392e-01f, -4.498832589e-01f, 7.686829721e-02f },
+        { 8.305239439e-01f, 9.203495818e-01f, 5.833614741e-01f, 9.203495818e-01f, 4.138854180e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 86 % */
+        { 1.003191953e+00f, -1.990010753e+00f, 9.871294040e-01f, -1.990010753e+00f, 9.903213571e-01f },
+        { 1.008748960e+00f, -1.981181396e+00f, 9.736698247e-01f, -1.981181396e+00f, 9.824187851e-01f },
+        { 1.017471917e+00f, -1.959906181e+00f, 9.474179088e-01f, -1.959906181e+00f, 9.648898256e-01f },
+        { 1.027144478e+00f, -1.906898388e+00f, 8.992733916e-01f, -1.906898388e+00f, 9.264178699e-01f },
+        { 1.047373122e+00f, -1.781498076e+00f, 8.089820540e-01f, -1.781498076e+00f, 8.563551764e-01f },
+        { 1.007423791e+00f, -1.418653623e+00f, 6.775318801e-01f, -1.418653623e+00f, 6.849556710e-01f },
+        { 5.996806422e-01f, -4.474915594e-01f, 4.714627357e-01f, -4.474915594e-01f, 7.114337791e-02f },
+        { 8.284130559e-01f, 9.187951291e-01f, 5.830843369e-01f, 9.187951291e-01f, 4.114973928e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 87 % */
+        { 1.003117829e+00f, -1.989955158e+00f, 9.871479243e-01f, -1.989955158e+00f, 9.902657536e-01f },
+        { 1.008748960e+00f, -1.981181396e+00f, 9.736698247e-01f, -1.981181396e+00f, 9.824187851e-01f },
+        { 1.017471917e+00f, -1.959906181e+00f, 9.474179088e-01f, -1.959906181e+00f, 9.648898256e-01f },
+        { 1.025975528e+00f, -1.906086357e+00f, 8.996219984e-01f, -1.906086357e+00f, 9.255975260e-01f },
+        { 1.046255135e+00f, -1.780759710e+00f, 8.093306504e-01f, -1.780759710e+00f, 8.555857850e-01f },
+        { 1.005562569e+00f, -1.417364693e+00f, 6.778622197e-01f, -1.417364693e+00f, 6.834247891e-01f },
+        { 5.957429907e-01f, -4.450979002e-01f, 4.696707769e-01f, -4.450979002e-01f, 6.541376764e-02f },
+        { 8.263053009e-01f, 9.172369899e-01f, 5.827984033e-01f, 9.172369899e-01f, 4.091037042e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 88 % */
+        { 1.003043813e+00f, -1.989899245e+00f, 9.871660197e-01f, -1.989899245e+00f, 9.902098323e-01f },
+        { 1.008748960e+00f, -1.981181396e+00f, 9.736698247e-01f, -1.981181396e+00f, 9.824187851e-01f },
+        { 1.017471917e+00f, -1.959906181e+00f, 9.474179088e-01f, -1.959906181e+00f, 9.648898256e-01f },
+        { 1.024810891e+00f, -1.905265625e+00f, 8.999575021e-01f, -1.905265625e+00f, 9.247683934e-01f },
+        { 1.045139497e+00f, -1.780017699e+00f, 8.096730977e-01f, -1.780017699e+00f, 8.548125950e-01f },
+        { 1.003704892e+00f, -1.416070681e+00f, 6.781829811e-01f, -1.416070681e+00f, 6.818878727e-01f },
+        { 5.918190897e-01f, -4.427024376e-01f, 4.678607511e-01f, -4.427024376e-01f, 5.967984080e-02f },
+        { 8.242006548e-01f, 9.156751769e-01f, 5.825037170e-01f, 9.156751769e-01f, 4.067043718e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 89 % */
+        { 1.002969900e+00f, -1.989843013e+00f, 9.871836910e-01f, -1.989843013e+00f, 9.901535913e-01f },
+        { 1.008748960e+00f, -1.981181396e+00f, 9.736698247e-01f, -1.981181396e+00f, 9.824187851e-01f },
+        { 1.017471917e+00f, -1.959906181e+00f, 9.474179088e-01f, -1.959906181e+00f, 9.648898256e-01f },
+        { 1.023650427e+00f, -1.904436109e+00f, 9.002799592e-01f, -1.904436109e+00f, 9.239303862e-01f },
+        { 1.044026179e+00f, -1.779272027e+00f, 8.100094123e-01f, -1.779272027e+00f, 8.540355908e-01f },
+        { 1.001850716e+00f, -1.414771580e+00f, 6.784941960e-01f, -1.414771580e+00f, 6.803449117e-01f },
+        { 5.879089279e-01f, -4.403053286e-01f, 4.660330450e-01f, -4.403053286e-01f, 5.394197292e-02f },
+        { 8.220990942e-01f, 9.141097033e-01f, 5.822003215e-01f, 9.141097033e-01f, 4.042994157e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 90 % */
+        { 1.002896090e+00f, -1.989786459e+00f, 9.872009386e-01f, -1.989786459e+00f, 9.900970288e-01f },
+        { 1.008748960e+00f, -1.981181396e+00f, 9.736698247e-01f, -1.981181396e+00f, 9.824187851e-01f },
+        { 1.017471917e+00f, -1.959906181e+00f, 9.474179088e-01f, -1.959906181e+00f, 9.648898256e-01f },
+        { 1.022493993e+00f, -1.903597722e+00f, 9.005894245e-01f, -1.903597722e+00f, 9.230834173e-01f },
+        { 1.042915147e+00f, -1.778522681e+00f, 8.103396107e-01f, -1.778522681e+00f, 8.532547574e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 5.840124966e-01f, -4.379067305e-01f, 4.641880440e-01f, -4.379067305e-01f, 4.820054060e-02f },
+        { 8.200005956e-01f, 9.125405820e-01f, 5.818882603e-01f, 9.125405820e-01f, 4.018888559e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 91 % */
+        { 1.002822380e+00f, -1.989729582e+00f, 9.872177633e-01f, -1.989729582e+00f, 9.900401431e-01f },
+        { 1.008597099e+00f, -1.981080859e+00f, 9.737210855e-01f, -1.981080859e+00f, 9.823181849e-01f },
+        { 1.017167778e+00f, -1.959707571e+00f, 9.475229330e-01f, -1.959707571e+00f, 9.646907108e-01f },
+        { 1.021917243e+00f, -1.903175175e+00f, 9.007393021e-01f, -1.903175175e+00f, 9.226565450e-01f },
+        { 1.041806370e+00f, -1.777769644e+00f, 8.106637091e-01f, -1.777769644e+00f, 8.524700793e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 5.820694278e-01f, -4.367069223e-01f, 4.632591779e-01f, -4.367069223e-01f, 4.532860571e-02f },
+        { 8.179051360e-01f, 9.109678264e-01f, 5.815675769e-01f, 9.109678264e-01f, 3.994727129e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 92 % */
+        { 1.002748767e+00f, -1.989672380e+00f, 9.872341655e-01f, -1.989672380e+00f, 9.899829322e-01f },
+        { 1.008445536e+00f, -1.980979752e+00f, 9.737714779e-01f, -1.980979752e+00f, 9.822170143e-01f },
+        { 1.016864259e+00f, -1.959507855e+00f, 9.476262277e-01f, -1.959507855e+00f, 9.644904872e-01f },
+        { 1.021341448e+00f, -1.902750378e+00f, 9.008859516e-01f, -1.902750378e+00f, 9.222273994e-01f },
+        { 1.040699818e+00f, -1.777012904e+00f, 8.109817236e-01f, -1.777012904e+00f, 8.516815412e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 5.801297895e-01f, -4.355068009e-01f, 4.623261318e-01f, -4.355068009e-01f, 4.245592133e-02f },
+        { 8.158126929e-01f, 9.093914500e-01f, 5.812383146e-01f, 9.093914500e-01f, 3.970510075e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 93 % */
+        { 1.002675248e+00f, -1.989614852e+00f, 9.872501459e-01f, -1.989614852e+00f, 9.899253943e-01f },
+        { 1.008294266e+00f, -1.980878071e+00f, 9.738210038e-01f, -1.980878071e+00f, 9.821152701e-01f },
+        { 1.016561352e+00f, -1.959307027e+00f, 9.477277969e-01f, -1.959307027e+00f, 9.642891489e-01f },
+        { 1.020766590e+00f, -1.902323320e+00f, 9.010293796e-01f, -1.902323320e+00f, 9.217959696e-01f },
+        { 1.039595457e+00f, -1.776252444e+00f, 8.112936702e-01f, -1.776252444e+00f, 8.508891276e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 5.781935812e-01f, -4.343063863e-01f, 4.613889536e-01f, -4.343063863e-01f, 3.958253481e-02f },
+        { 8.137232437e-01f, 9.078114666e-01f, 5.809005170e-01f, 9.078114666e-01f, 3.946237607e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 94 % */
+        { 1.002601823e+00f, -1.989556994e+00f, 9.872657050e-01f, -1.989556994e+00f, 9.898675276e-01f },
+        { 1.008143284e+00f, -1.980775814e+00f, 9.738696649e-01f, -1.980775814e+00f, 9.820129490e-01f },
+        { 1.016259046e+00f, -1.959105082e+00f, 9.478276441e-01f, -1.959105082e+00f, 9.640866899e-01f },
+        { 1.020192652e+00f, -1.901893989e+00f, 9.011695924e-01f, -1.901893989e+00f, 9.213622444e-01f },
+        { 1.038493258e+00f, -1.775488251e+00f, 8.115995647e-01f, -1.775488251e+00f, 8.500928232e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 5.762608027e-01f, -4.331056981e-01f, 4.604476908e-01f, -4.331056981e-01f, 3.670849349e-02f },
+        { 8.116367665e-01f, 9.062278899e-01f, 5.805542274e-01f, 9.062278899e-01f, 3.921909938e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 95 % */
+        { 1.002528487e+00f, -1.989498806e+00f, 9.872808434e-01f, -1.989498806e+00f, 9.898093303e-01f },
+        { 1.007992585e+00f, -1.980672977e+00f, 9.739174630e-01f, -1.980672977e+00f, 9.819100478e-01f },
+        { 1.015957331e+00f, -1.958902012e+00f, 9.479257730e-01f, -1.958902012e+00f, 9.638831041e-01f },
+        { 1.019619616e+00f, -1.901462375e+00f, 9.013065962e-01f, -1.901462375e+00f, 9.209262126e-01f },
+        { 1.037393190e+00f, -1.774720308e+00f, 8.118994228e-01f, -1.774720308e+00f, 8.492926124e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 5.743314538e-01f, -4.319047561e-01f, 4.595023910e-01f, -4.319047561e-01f, 3.383384480e-02f },
+        { 8.095532395e-01f, 9.046407341e-01f, 5.801994890e-01f, 9.046407341e-01f, 3.897527285e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 96 % */
+        { 1.002455239e+00f, -1.989440285e+00f, 9.872955616e-01f, -1.989440285e+00f, 9.897508004e-01f },
+        { 1.007842164e+00f, -1.980569557e+00f, 9.739643996e-01f, -1.980569557e+00f, 9.818065634e-01f },
+        { 1.015656198e+00f, -1.958697813e+00f, 9.480221874e-01f, -1.958697813e+00f, 9.636783856e-01f },
+        { 1.019047466e+00f, -1.901028468e+00f, 9.014403974e-01f, -1.901028468e+00f, 9.204878632e-01f },
+        { 1.036295220e+00f, -1.773948602e+00f, 8.121932599e-01f, -1.773948602e+00f, 8.484884800e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 5.724055345e-01f, -4.307035802e-01f, 4.585531016e-01f, -4.307035802e-01f, 3.095863617e-02f },
+        { 8.074726413e-01f, 9.030500133e-01f, 5.798363452e-01f, 9.030500133e-01f, 3.873089865e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 97 % */
+        { 1.002382076e+00f, -1.989381430e+00f, 9.873098601e-01f, -1.989381430e+00f, 9.896919361e-01f },
+        { 1.007692016e+00f, -1.980465551e+00f, 9.740104765e-01f, -1.980465551e+00f, 9.817024925e-01f },
+        { 1.015355638e+00f, -1.958492478e+00f, 9.481168906e-01f, -1.958492478e+00f, 9.634725283e-01f },
+        { 1.018476183e+00f, -1.900592255e+00f, 9.015710019e-01f, -1.900592255e+00f, 9.200471850e-01f },
+        { 1.035199319e+00f, -1.773173118e+00f, 8.124810915e-01f, -1.773173118e+00f, 8.476804103e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 5.704830451e-01f, -4.295021902e-01f, 4.575998700e-01f, -4.295021902e-01f, 2.808291511e-02f },
+        { 8.053949508e-01f, 9.014557420e-01f, 5.794648393e-01f, 9.014557420e-01f, 3.848597901e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 98 % */
+        { 1.002308996e+00f, -1.989322238e+00f, 9.873237395e-01f, -1.989322238e+00f, 9.896327354e-01f },
+        { 1.007542137e+00f, -1.980360955e+00f, 9.740556952e-01f, -1.980360955e+00f, 9.815978317e-01f },
+        { 1.015055640e+00f, -1.958286001e+00f, 9.482098862e-01f, -1.958286001e+00f, 9.632655261e-01f },
+        { 1.017905751e+00f, -1.900153725e+00f, 9.016984158e-01f, -1.900153725e+00f, 9.196041666e-01f },
+        { 1.034105455e+00f, -1.772393840e+00f, 8.127629328e-01f, -1.772393840e+00f, 8.468683879e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 5.685639858e-01f, -4.283006061e-01f, 4.566427434e-01f, -4.283006061e-01f, 2.520672912e-02f },
+        { 8.033201471e-01f, 8.998579348e-01f, 5.790850145e-01f, 8.998579348e-01f, 3.824051616e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 99 % */
+        { 1.002235996e+00f, -1.989262709e+00f, 9.873372001e-01f, -1.989262709e+00f, 9.895731966e-01f },
+        { 1.007392521e+00f, -1.980255767e+00f, 9.741000574e-01f, -1.980255767e+00f, 9.814925780e-01f },
+        { 1.014756195e+00f, -1.958078376e+00f, 9.483011778e-01f, -1.958078376e+00f, 9.630573729e-01f },
+        { 1.017336152e+00f, -1.899712868e+00f, 9.018226450e-01f, -1.899712868e+00f, 9.191587968e-01f },
+        { 1.033013598e+00f, -1.771610754e+00f, 8.130387989e-01f, -1.771610754e+00f, 8.460523973e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 5.666483570e-01f, -4.270988475e-01f, 4.556817688e-01f, -4.270988475e-01f, 2.233012577e-02f },
+        { 8.012482098e-01f, 8.982566065e-01f, 5.786969141e-01f, 8.982566065e-01f, 3.799451239e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 100 % */
+        { 1.002163075e+00f, -1.989202839e+00f, 9.873502425e-01f, -1.989202839e+00f, 9.895133176e-01f },
+        { 1.007243163e+00f, -1.980149983e+00f, 9.741435646e-01f, -1.980149983e+00f, 9.813867278e-01f },
+        { 1.014457294e+00f, -1.957869596e+00f, 9.483907686e-01f, -1.957869596e+00f, 9.628480625e-01f },
+        { 1.016767369e+00f, -1.899269672e+00f, 9.019436953e-01f, -1.899269672e+00f, 9.187110643e-01f },
+        { 1.031923718e+00f, -1.770823845e+00f, 8.133087047e-01f, -1.770823845e+00f, 8.452324228e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 5.647361592e-01f, -4.258969345e-01f, 4.547169934e-01f, -4.258969345e-01f, 1.945315262e-02f },
+        { 7.991791187e-01f, 8.966517721e-01f, 5.783005811e-01f, 8.966517721e-01f, 3.774796998e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+};
+
+static const loudness_coefs_t s_loudness_22050[LOUDNESS_STEPS] = {
+    { { /* 0 % */
+        { 1.003802116e+00f, -1.996405338e+00f, 9.926811149e-01f, -1.996405338e+00f, 9.964832307e-01f },
+        { 1.007590589e+00f, -1.992668061e+00f, 9.853884915e-01f, -1.992668061e+00f, 9.929790803e-01f },
+        { 1.015246797e+00f, -1.984637834e+00f, 9.706506683e-01f, -1.984637834e+00f, 9.858974657e-01f },
+        { 1.026933900e+00f, -1.965378427e+00f, 9.434420872e-01f, -1.965378427e+00f, 9.703759870e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.054132211e+00f, -1.785852534e+00f, 8.067603947e-01f, -1.785852534e+00f, 8.608926053e-01f },
+        { 8.264148269e-01f, -1.256422966e+00f, 6.658571185e-01f, -1.256422966e+00f, 4.922719454e-01f },
+        { 9.191333546e-01f, -6.041880211e-01f, 5.270883322e-01f, -6.041880211e-01f, 4.462216868e-01f },
+        { 1.050101296e+00f, 1.049964401e+00f, 5.629046592e-01f, 1.049964401e+00f, 6.130059554e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 1 % */
+        { 1.003785258e+00f, -1.996397245e+00f, 9.926898798e-01f, -1.996397245e+00f, 9.964751380e-01f },
+        { 1.007556904e+00f, -1.992651936e+00f, 9.854060488e-01f, -1.992651936e+00f, 9.929629524e-01f },
+        { 1.015179012e+00f, -1.984605575e+00f, 9.706861740e-01f, -1.984605575e+00f, 9.858651858e-01f },
+        { 1.026868344e+00f, -1.965344893e+00f, 9.434740230e-01f, -1.965344893e+00f, 9.703423675e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.053905452e+00f, -1.785709458e+00f, 8.068380654e-01f, -1.785709458e+00f, 8.607435174e-01f },
+        { 8.257469495e-01f, -1.255688116e+00f, 6.656522037e-01f, -1.255688116e+00f, 4.913991532e-01f },
+        { 9.186148001e-01f, -6.039953684e-01f, 5.271457411e-01f, -6.039953684e-01f, 4.457605412e-01f },
+        { 1.049587052e+00f, 1.049730416e+00f, 5.630594448e-01f, 1.049730416e+00f, 6.126464965e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 2 % */
+        { 1.003768421e+00f, -1.996389134e+00f, 9.926986060e-01f, -1.996389134e+00f, 9.964670267e-01f },
+        { 1.007523259e+00f, -1.992635773e+00f, 9.854235288e-01f, -1.992635773e+00f, 9.929467875e-01f },
+        { 1.015111308e+00f, -1.984573242e+00f, 9.707215243e-01f, -1.984573242e+00f, 9.858328325e-01f },
+        { 1.026802826e+00f, -1.965311321e+00f, 9.435058839e-01f, -1.965311321e+00f, 9.703087104e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.053678796e+00f, -1.785566240e+00f, 8.069154854e-01f, -1.785566240e+00f, 8.605942816e-01f },
+        { 8.250791653e-01f, -1.254952434e+00f, 6.654462077e-01f, -1.254952434e+00f, 4.905253729e-01f },
+        { 9.180964985e-01f, -6.038026167e-01f, 5.272026604e-01f, -6.038026167e-01f, 4.452991589e-01f },
+        { 1.049073090e+00f, 1.049496266e+00f, 5.632136945e-01f, 1.049496266e+00f, 6.122867840e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 3 % */
+        { 1.003751603e+00f, -1.996381005e+00f, 9.927072934e-01f, -1.996381005e+00f, 9.964588968e-01f },
+        { 1.007489654e+00f, -1.992619574e+00f, 9.854409315e-01f, -1.992619574e+00f, 9.929305857e-01f },
+        { 1.015043686e+00f, -1.984540836e+00f, 9.707567193e-01f, -1.984540836e+00f, 9.858004056e-01f },
+        { 1.026737346e+00f, -1.965277712e+00f, 9.435376700e-01f, -1.965277712e+00f, 9.702750157e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.053452243e+00f, -1.785422880e+00f, 8.069926549e-01f, -1.785422880e+00f, 8.604448980e-01f },
+        { 8.244114732e-01f, -1.254215921e+00f, 6.652391320e-01f, -1.254215921e+00f, 4.896506052e-01f },
+        { 9.175784493e-01f, -6.036097662e-01f, 5.272590907e-01f, -6.036097662e-01f, 4.448375400e-01f },
+        { 1.048559409e+00f, 1.049261951e+00f, 5.633674088e-01f, 1.049261951e+00f, 6.119268179e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 4 % */
+        { 1.003734806e+00f, -1.996372856e+00f, 9.927159422e-01f, -1.996372856e+00f, 9.964507482e-01f },
+        { 1.007456090e+00f, -1.992603338e+00f, 9.854582570e-01f, -1.992603338e+00f, 9.929143467e-01f },
+        { 1.014976146e+00f, -1.984508356e+00f, 9.707917593e-01f, -1.984508356e+00f, 9.857679051e-01f },
+        { 1.026671902e+00f, -1.965244065e+00f, 9.435693812e-01f, -1.965244065e+00f, 9.702412834e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.053225792e+00f, -1.785279379e+00f, 8.070695740e-01f, -1.785279379e+00f, 8.602953662e-01f },
+        { 8.237438723e-01f, -1.253478577e+00f, 6.650309783e-01f, -1.253478577e+00f, 4.887748506e-01f },
+        { 9.170606523e-01f, -6.034168169e-01f, 5.273150324e-01f, -6.034168169e-01f, 4.443756847e-01f },
+        { 1.048046010e+00f, 1.049027471e+00f, 5.635205881e-01f, 1.049027471e+00f, 6.115665981e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 5 % */
+        { 1.003718028e+00f, -1.996364689e+00f, 9.927245524e-01f, -1.996364689e+00f, 9.964425809e-01f },
+        { 1.007422565e+00f, -1.992587064e+00f, 9.854755053e-01f, -1.992587064e+00f, 9.928980706e-01f },
+        { 1.014908686e+00f, -1.984475802e+00f, 9.708266443e-01f, -1.984475802e+00f, 9.857353308e-01f },
+        { 1.026606496e+00f, -1.965210381e+00f, 9.436010177e-01f, -1.965210381e+00f, 9.702075133e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.052999443e+00f, -1.785135734e+00f, 8.071462429e-01f, -1.785135734e+00f, 8.601456863e-01f },
+        { 8.230763615e-01f, -1.252740402e+00f, 6.648217483e-01f, -1.252740402e+00f, 4.878981098e-01f },
+        { 9.165431070e-01f, -6.032237688e-01f, 5.273704860e-01f, -6.032237688e-01f, 4.439135930e-01f },
+        { 1.047532892e+00f, 1.048792826e+00f, 5.636732328e-01f, 1.048792826e+00f, 6.112061245e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 6 % */
+        { 1.003701271e+00f, -1.996356504e+00f, 9.927331240e-01f, -1.996356504e+00f, 9.964343948e-01f },
+        { 1.007389081e+00f, -1.992570753e+00f, 9.854926767e-01f, -1.992570753e+00f, 9.928817572e-01f },
+        { 1.014841308e+00f, -1.984443175e+00f, 9.708613746e-01f, -1.984443175e+00f, 9.857026824e-01f },
+        { 1.026541126e+00f, -1.965176659e+00f, 9.436325794e-01f, -1.965176659e+00f, 9.701737055e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.052773196e+00f, -1.784991948e+00f, 8.072226618e-01f, -1.784991948e+00f, 8.599958581e-01f },
+        { 8.224089400e-01f, -1.252001398e+00f, 6.646114436e-01f, -1.252001398e+00f, 4.870203836e-01f },
+        { 9.160258131e-01f, -6.030306221e-01f, 5.274254519e-01f, -6.030306221e-01f, 4.434512651e-01f },
+        { 1.047020054e+00f, 1.048558015e+00f, 5.638253434e-01f, 1.048558015e+00f, 6.108453973e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 7 % */
+        { 1.003684533e+00f, -1.996348299e+00f, 9.927416571e-01f, -1.996348299e+00f, 9.964261899e-01f },
+        { 1.007355635e+00f, -1.992554405e+00f, 9.855097711e-01f, -1.992554405e+00f, 9.928654065e-01f },
+        { 1.014774009e+00f, -1.984410473e+00f, 9.708959504e-01f, -1.984410473e+00f, 9.856699598e-01f },
+        { 1.026475793e+00f, -1.965142899e+00f, 9.436640665e-01f, -1.965142899e+00f, 9.701398599e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.052547051e+00f, -1.784848019e+00f, 8.072988307e-01f, -1.784848019e+00f, 8.598458815e-01f },
+        { 8.217416067e-01f, -1.251261564e+00f, 6.644000658e-01f, -1.251261564e+00f, 4.861416725e-01f },
+        { 9.155087703e-01f, -6.028373767e-01f, 5.274799308e-01f, -6.028373767e-01f, 4.429887010e-01f },
+        { 1.046507496e+00f, 1.048323039e+00f, 5.639769203e-01f, 1.048323039e+00f, 6.104844162e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 8 % */
+        { 1.003667815e+00f, -1.996340076e+00f, 9.927501516e-01f, -1.996340076e+00f, 9.964179662e-01f },
+        { 1.007322230e+00f, -1.992538019e+00f, 9.855267887e-01f, -1.992538019e+00f, 9.928490184e-01f },
+        { 1.014706791e+00f, -1.984377697e+00f, 9.709303718e-01f, -1.984377697e+00f, 9.856371629e-01f },
+        { 1.026410498e+00f, -1.965109101e+00f, 9.436954789e-01f, -1.965109101e+00f, 9.701059765e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.052321007e+00f, -1.784703948e+00f, 8.073747498e-01f, -1.784703948e+00f, 8.596957564e-01f },
+        { 8.210743606e-01f, -1.250520902e+00f, 6.641876166e-01f, -1.250520902e+00f, 4.852619772e-01f },
+        { 9.149919781e-01f, -6.026440328e-01f, 5.275339229e-01f, -6.026440328e-01f, 4.425259010e-01f },
+        { 1.045995217e+00f, 1.048087899e+00f, 5.641279640e-01f, 1.048087899e+00f, 6.101231813e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 9 % */
+        { 1.003651116e+00f, -1.996331833e+00f, 9.927586078e-01f, -1.996331833e+00f, 9.964097236e-01f },
+        { 1.007288863e+00f, -1.992521596e+00f, 9.855437296e-01f, -1.992521596e+00f, 9.928325928e-01f },
+        { 1.014639652e+00f, -1.984344846e+00f, 9.709646391e-01f, -1.984344846e+00f, 9.856042914e-01f },
+        { 1.026345238e+00f, -1.965075266e+00f, 9.437268168e-01f, -1.965075266e+00f, 9.700720552e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.052095063e+00f, -1.784559734e+00f, 8.074504193e-01f, -1.784559734e+00f, 8.595454825e-01f },
+        { 8.204072009e-01f, -1.249779412e+00f, 6.639740976e-01f, -1.249779412e+00f, 4.843812985e-01f },
+        { 9.144754363e-01f, -6.024505903e-01f, 5.275874289e-01f, -6.024505903e-01f, 4.420628652e-01f },
+        { 1.045483218e+00f, 1.047852592e+00f, 5.642784748e-01f, 1.047852592e+00f, 6.097616926e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 10 % */
+        { 1.003634436e+00f, -1.996323572e+00f, 9.927670255e-01f, -1.996323572e+00f, 9.964014620e-01f },
+        { 1.007255536e+00f, -1.992505136e+00f, 9.855605938e-01f, -1.992505136e+00f, 9.928161295e-01f },
+        { 1.014572593e+00f, -1.984311921e+00f, 9.709987524e-01f, -1.984311921e+00f, 9.855713453e-01f },
+        { 1.026280016e+00f, -1.965041393e+00f, 9.437580800e-01f, -1.965041393e+00f, 9.700380960e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.051869221e+00f, -1.784415377e+00f, 8.075258393e-01f, -1.784415377e+00f, 8.593950599e-01f },
+        { 8.197401265e-01f, -1.249037094e+00f, 6.637595105e-01f, -1.249037094e+00f, 4.834996369e-01f },
+        { 9.139591445e-01f, -6.022570493e-01f, 5.276404492e-01f, -6.022570493e-01f, 4.415995936e-01f },
+        { 1.044971497e+00f, 1.047617121e+00f, 5.644284534e-01f, 1.047617121e+00f, 6.093999501e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 11 % */
+        { 1.003617777e+00f, -1.996315292e+00f, 9.927754049e-01f, -1.996315292e+00f, 9.963931815e-01f },
+        { 1.007222247e+00f, -1.992488637e+00f, 9.855773814e-01f, -1.992488637e+00f, 9.927996286e-01f },
+        { 1.014505612e+00f, -1.984278921e+00f, 9.710327119e-01f, -1.984278921e+00f, 9.855383243e-01f },
+        { 1.026214830e+00f, -1.965007482e+00f, 9.437892688e-01f, -1.965007482e+00f, 9.700040989e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.051643479e+00f, -1.784270877e+00f, 8.076010099e-01f, -1.784270877e+00f, 8.592444884e-01f },
+        { 8.190731364e-01f, -1.248293950e+00f, 6.635438569e-01f, -1.248293950e+00f, 4.826169933e-01f },
+        { 9.134431023e-01f, -6.020634100e-01f, 5.276929842e-01f, -6.020634100e-01f, 4.411360865e-01f },
+        { 1.044460054e+00f, 1.047381484e+00f, 5.645779000e-01f, 1.047381484e+00f, 6.090379536e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 12 % */
+        { 1.003601136e+00f, -1.996306993e+00f, 9.927837460e-01f, -1.996306993e+00f, 9.963848819e-01f },
+        { 1.007188997e+00f, -1.992472101e+00f, 9.855940926e-01f, -1.992472101e+00f, 9.927830899e-01f },
+        { 1.014438710e+00f, -1.984245846e+00f, 9.710665179e-01f, -1.984245846e+00f, 9.855052283e-01f },
+        { 1.026149681e+00f, -1.964973533e+00f, 9.438203831e-01f, -1.964973533e+00f, 9.699700638e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.051417837e+00f, -1.784126234e+00f, 8.076759312e-01f, -1.784126234e+00f, 8.590937679e-01f },
+        { 8.184062299e-01f, -1.247549979e+00f, 6.633271384e-01f, -1.247549979e+00f, 4.817333683e-01f },
+        { 9.129273093e-01f, -6.018696722e-01f, 5.277450345e-01f, -6.018696722e-01f, 4.406723439e-01f },
+        { 1.043948888e+00f, 1.047145682e+00f, 5.647268152e-01f, 1.047145682e+00f, 6.086757033e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 13 % */
+        { 1.003584514e+00f, -1.996298674e+00f, 9.927920488e-01f, -1.996298674e+00f, 9.963765633e-01f },
+        { 1.007155786e+00f, -1.992455527e+00f, 9.856107274e-01f, -1.992455527e+00f, 9.927665134e-01f },
+        { 1.014371887e+00f, -1.984212696e+00f, 9.711001704e-01f, -1.984212696e+00f, 9.854720572e-01f },
+        { 1.026084568e+00f, -1.964939547e+00f, 9.438514230e-01f, -1.964939547e+00f, 9.699359906e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.051192295e+00f, -1.783981448e+00f, 8.077506035e-01f, -1.783981448e+00f, 8.589428982e-01f },
+        { 8.177394058e-01f, -1.246805182e+00f, 6.631093568e-01f, -1.246805182e+00f, 4.808487626e-01f },
+        { 9.124117653e-01f, -6.016758361e-01f, 5.277966006e-01f, -6.016758361e-01f, 4.402083659e-01f },
+        { 1.043438000e+00f, 1.046909715e+00f, 5.648751993e-01f, 1.046909715e+00f, 6.083131990e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 14 % */
+        { 1.003567912e+00f, -1.996290337e+00f, 9.928003135e-01f, -1.996290337e+00f, 9.963682256e-01f },
+        { 1.007122613e+00f, -1.992438915e+00f, 9.856272859e-01f, -1.992438915e+00f, 9.927498990e-01f },
+        { 1.014305141e+00f, -1.984179470e+00f, 9.711336697e-01f, -1.984179470e+00f, 9.854388106e-01f },
+        { 1.026019491e+00f, -1.964905522e+00f, 9.438823885e-01f, -1.964905522e+00f, 9.699018794e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.050966852e+00f, -1.783836519e+00f, 8.078250268e-01f, -1.783836519e+00f, 8.587918793e-01f },
+        { 8.170726633e-01f, -1.246059561e+00f, 6.628905136e-01f, -1.246059561e+00f, 4.799631769e-01f },
+        { 9.118964699e-01f, -6.014819018e-01f, 5.278476828e-01f, -6.014819018e-01f, 4.397441528e-01f },
+        { 1.042927388e+00f, 1.046673582e+00f, 5.650230528e-01f, 1.046673582e+00f, 6.079504407e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 15 % */
+        { 1.003551329e+00f, -1.996281980e+00f, 9.928085399e-01f, -1.996281980e+00f, 9.963598688e-01f },
+        { 1.007089478e+00f, -1.992422266e+00f, 9.856437682e-01f, -1.992422266e+00f, 9.927332465e-01f },
+        { 1.014238473e+00f, -1.984146169e+00f, 9.711670159e-01f, -1.984146169e+00f, 9.854054886e-01f },
+        { 1.025954450e+00f, -1.964871459e+00f, 9.439132797e-01f, -1.964871459e+00f, 9.698677301e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.050741510e+00f, -1.783691447e+00f, 8.078992013e-01f, -1.783691447e+00f, 8.586407109e-01f },
+        { 8.164060014e-01f, -1.245313115e+00f, 6.626706105e-01f, -1.245313115e+00f, 4.790766119e-01f },
+        { 9.113814227e-01f, -6.012878693e-01f, 5.278982818e-01f, -6.012878693e-01f, 4.392797045e-01f },
+        { 1.042417052e+00f, 1.046437285e+00f, 5.651703762e-01f, 1.046437285e+00f, 6.075874284e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 16 % */
+        { 1.003534764e+00f, -1.996273605e+00f, 9.928167282e-01f, -1.996273605e+00f, 9.963514927e-01f },
+        { 1.007056381e+00f, -1.992405578e+00f, 9.856601744e-01f, -1.992405578e+00f, 9.927165559e-01f },
+        { 1.014171882e+00f, -1.984112793e+00f, 9.712002092e-01f, -1.984112793e+00f, 9.853720908e-01f },
+        { 1.025889446e+00f, -1.964837359e+00f, 9.439440966e-01f, -1.964837359e+00f, 9.698335426e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.050516266e+00f, -1.783546231e+00f, 8.079731271e-01f, -1.783546231e+00f, 8.584893931e-01f },
+        { 8.157394193e-01f, -1.244565845e+00f, 6.624496492e-01f, -1.244565845e+00f, 4.781890684e-01f },
+        { 9.108666234e-01f, -6.010937386e-01f, 5.279483979e-01f, -6.010937386e-01f, 4.388150213e-01f },
+        { 1.041906992e+00f, 1.046200821e+00f, 5.653171699e-01f, 1.046200821e+00f, 6.072241622e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 17 % */
+        { 1.003518219e+00f, -1.996265210e+00f, 9.928248785e-01f, -1.996265210e+00f, 9.963430974e-01f },
+        { 1.007023323e+00f, -1.992388851e+00f, 9.856765046e-01f, -1.992388851e+00f, 9.926998271e-01f },
+        { 1.014105367e+00f, -1.984079340e+00f, 9.712332499e-01f, -1.984079340e+00f, 9.853386172e-01f },
+        { 1.025824478e+00f, -1.964803220e+00f, 9.439748392e-01f, -1.964803220e+00f, 9.697993169e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.050291121e+00f, -1.783400871e+00f, 8.080468044e-01f, -1.783400871e+00f, 8.583379256e-01f },
+        { 8.150729160e-01f, -1.243817752e+00f, 6.622276312e-01f, -1.243817752e+00f, 4.773005472e-01f },
+        { 9.103520716e-01f, -6.008995098e-01f, 5.279980317e-01f, -6.008995098e-01f, 4.383501033e-01f },
+        { 1.041397208e+00f, 1.045964193e+00f, 5.654634343e-01f, 1.045964193e+00f, 6.068606418e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 18 % */
+        { 1.003501692e+00f, -1.996256796e+00f, 9.928329907e-01f, -1.996256796e+00f, 9.963346828e-01f },
+        { 1.006990301e+00f, -1.992372087e+00f, 9.856927588e-01f, -1.992372087e+00f, 9.926830600e-01f },
+        { 1.014038929e+00f, -1.984045812e+00f, 9.712661381e-01f, -1.984045812e+00f, 9.853050675e-01f },
+        { 1.025759545e+00f, -1.964769043e+00f, 9.440055076e-01f, -1.964769043e+00f, 9.697650530e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.050066075e+00f, -1.783255368e+00f, 8.081202333e-01f, -1.783255368e+00f, 8.581863083e-01f },
+        { 8.144064906e-01f, -1.243068836e+00f, 6.620045583e-01f, -1.243068836e+00f, 4.764110489e-01f },
+        { 9.098377671e-01f, -6.007051830e-01f, 5.280471836e-01f, -6.007051830e-01f, 4.378849506e-01f },
+        { 1.040887698e+00f, 1.045727399e+00f, 5.656091699e-01f, 1.045727399e+00f, 6.064968674e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 19 % */
+        { 1.003485184e+00f, -1.996248362e+00f, 9.928410649e-01f, -1.996248362e+00f, 9.963262489e-01f },
+        { 1.006957317e+00f, -1.992355284e+00f, 9.857089372e-01f, -1.992355284e+00f, 9.926662546e-01f },
+        { 1.013972568e+00f, -1.984012207e+00f, 9.712988739e-01f, -1.984012207e+00f, 9.852714417e-01f },
+        { 1.025694649e+00f, -1.964734828e+00f, 9.440361019e-01f, -1.964734828e+00f, 9.697307508e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.049841127e+00f, -1.783109721e+00f, 8.081934139e-01f, -1.783109721e+00f, 8.580345412e-01f },
+        { 8.137401422e-01f, -1.242319098e+00f, 6.617804321e-01f, -1.242319098e+00f, 4.755205743e-01f },
+        { 9.093237093e-01f, -6.005107581e-01f, 5.280958541e-01f, -6.005107581e-01f, 4.374195634e-01f },
+        { 1.040378462e+00f, 1.045490439e+00f, 5.657543771e-01f, 1.045490439e+00f, 6.061328389e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 20 % */
+        { 1.003468695e+00f, -1.996239909e+00f, 9.928491011e-01f, -1.996239909e+00f, 9.963177956e-01f },
+        { 1.006924371e+00f, -1.992338443e+00f, 9.857250398e-01f, -1.992338443e+00f, 9.926494107e-01f },
+        { 1.013906282e+00f, -1.983978527e+00f, 9.713314575e-01f, -1.983978527e+00f, 9.852377395e-01f },
+        { 1.025629788e+00f, -1.964700574e+00f, 9.440666220e-01f, -1.964700574e+00f, 9.696964103e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.049616278e+00f, -1.782963930e+00f, 8.082663463e-01f, -1.782963930e+00f, 8.578826241e-01f },
+        { 8.130738699e-01f, -1.241568539e+00f, 6.615552543e-01f, -1.241568539e+00f, 4.746291242e-01f },
+        { 9.088098980e-01f, -6.003162354e-01f, 5.281440437e-01f, -6.003162354e-01f, 4.369539417e-01f },
+        { 1.039869500e+00f, 1.045253314e+00f, 5.658990563e-01f, 1.045253314e+00f, 6.057685563e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 21 % */
+        { 1.003452224e+00f, -1.996231437e+00f, 9.928570994e-01f, -1.996231437e+00f, 9.963093229e-01f },
+        { 1.006891462e+00f, -1.992321563e+00f, 9.857410667e-01f, -1.992321563e+00f, 9.926325283e-01f },
+        { 1.013840072e+00f, -1.983944769e+00f, 9.713638892e-01f, -1.983944769e+00f, 9.852039607e-01f },
+        { 1.025564963e+00f, -1.964666282e+00f, 9.440970681e-01f, -1.964666282e+00f, 9.696620315e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.049391526e+00f, -1.782817995e+00f, 8.083390308e-01f, -1.782817995e+00f, 8.577305569e-01f },
+        { 8.124076729e-01f, -1.240817159e+00f, 6.613290264e-01f, -1.240817159e+00f, 4.737366993e-01f },
+        { 9.082963329e-01f, -6.001216147e-01f, 5.281917528e-01f, -6.001216147e-01f, 4.364880857e-01f },
+        { 1.039360812e+00f, 1.045016024e+00f, 5.660432080e-01f, 1.045016024e+00f, 6.054040196e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 22 % */
+        { 1.003435771e+00f, -1.996222945e+00f, 9.928650599e-01f, -1.996222945e+00f, 9.963008308e-01f },
+        { 1.006858589e+00f, -1.992304645e+00f, 9.857570181e-01f, -1.992304645e+00f, 9.926156072e-01f },
+        { 1.013773936e+00f, -1.983910935e+00f, 9.713961691e-01f, -1.983910935e+00f, 9.851701052e-01f },
+        { 1.025500174e+00f, -1.964631952e+00f, 9.441274401e-01f, -1.964631952e+00f, 9.696276142e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.049166872e+00f, -1.782671915e+00f, 8.084114674e-01f, -1.782671915e+00f, 8.575783394e-01f },
+        { 8.117415502e-01f, -1.240064959e+00f, 6.611017502e-01f, -1.240064959e+00f, 4.728433004e-01f },
+        { 9.077830136e-01f, -5.999268962e-01f, 5.282389820e-01f, -5.999268962e-01f, 4.360219956e-01f },
+        { 1.038852396e+00f, 1.044778568e+00f, 5.661868326e-01f, 1.044778568e+00f, 6.050392286e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 23 % */
+        { 1.003419337e+00f, -1.996214434e+00f, 9.928729825e-01f, -1.996214434e+00f, 9.962923191e-01f },
+        { 1.006825754e+00f, -1.992287687e+00f, 9.857728939e-01f, -1.992287687e+00f, 9.925986474e-01f },
+        { 1.013707876e+00f, -1.983877024e+00f, 9.714282973e-01f, -1.983877024e+00f, 9.851361729e-01f },
+        { 1.025435420e+00f, -1.964597584e+00f, 9.441577381e-01f, -1.964597584e+00f, 9.695931585e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.048942315e+00f, -1.782525692e+00f, 8.084836563e-01f, -1.782525692e+00f, 8.574259716e-01f },
+        { 8.110755009e-01f, -1.239311939e+00f, 6.608734273e-01f, -1.239311939e+00f, 4.719489282e-01f },
+        { 9.072699397e-01f, -5.997320800e-01f, 5.282857317e-01f, -5.997320800e-01f, 4.355556714e-01f },
+        { 1.038344253e+00f, 1.044540947e+00f, 5.663299306e-01f, 1.044540947e+00f, 6.046741835e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 24 % */
+        { 1.003402921e+00f, -1.996205903e+00f, 9.928808674e-01f, -1.996205903e+00f, 9.962837879e-01f },
+        { 1.006792954e+00f, -1.992270692e+00f, 9.857886943e-01f, -1.992270692e+00f, 9.925816488e-01f },
+        { 1.013641889e+00f, -1.983843036e+00f, 9.714602741e-01f, -1.983843036e+00f, 9.851021634e-01f },
+        { 1.025370702e+00f, -1.964563177e+00f, 9.441879622e-01f, -1.964563177e+00f, 9.695586643e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.048717856e+00f, -1.782379324e+00f, 8.085555977e-01f, -1.782379324e+00f, 8.572734533e-01f },
+        { 8.104095243e-01f, -1.238558101e+00f, 6.606440593e-01f, -1.238558101e+00f, 4.710535836e-01f },
+        { 9.067571110e-01f, -5.995371660e-01f, 5.283320023e-01f, -5.995371660e-01f, 4.350891133e-01f },
+        { 1.037836382e+00f, 1.044303160e+00f, 5.664725024e-01f, 1.044303160e+00f, 6.043088842e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 25 % */
+        { 1.003386523e+00f, -1.996197352e+00f, 9.928887145e-01f, -1.996197352e+00f, 9.962752371e-01f },
+        { 1.006760192e+00f, -1.992253657e+00f, 9.858044194e-01f, -1.992253657e+00f, 9.925646113e-01f },
+        { 1.013575977e+00f, -1.983808971e+00f, 9.714920996e-01f, -1.983808971e+00f, 9.850680768e-01f },
+        { 1.025306019e+00f, -1.964528732e+00f, 9.442181124e-01f, -1.964528732e+00f, 9.695241316e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.048493493e+00f, -1.782232811e+00f, 8.086272915e-01f, -1.782232811e+00f, 8.571207844e-01f },
+        { 8.097436194e-01f, -1.237803445e+00f, 6.604136480e-01f, -1.237803445e+00f, 4.701572674e-01f },
+        { 9.062445270e-01f, -5.993421544e-01f, 5.283777945e-01f, -5.993421544e-01f, 4.346223215e-01f },
+        { 1.037328782e+00f, 1.044065208e+00f, 5.666145484e-01f, 1.044065208e+00f, 6.039433306e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 26 % */
+        { 1.003370143e+00f, -1.996188782e+00f, 9.928965239e-01f, -1.996188782e+00f, 9.962666667e-01f },
+        { 1.006727466e+00f, -1.992236583e+00f, 9.858200692e-01f, -1.992236583e+00f, 9.925475348e-01f },
+        { 1.013510139e+00f, -1.983774829e+00f, 9.715237740e-01f, -1.983774829e+00f, 9.850339127e-01f },
+        { 1.025241372e+00f, -1.964494249e+00f, 9.442481887e-01f, -1.964494249e+00f, 9.694895603e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.048269227e+00f, -1.782086154e+00f, 8.086987381e-01f, -1.782086154e+00f, 8.569679647e-01f },
+        { 8.090777854e-01f, -1.237047972e+00f, 6.601821949e-01f, -1.237047972e+00f, 4.692599803e-01f },
+        { 9.057321875e-01f, -5.991470452e-01f, 5.284231086e-01f, -5.991470452e-01f, 4.341552960e-01f },
+        { 1.036821454e+00f, 1.043827091e+00f, 5.667560691e-01f, 1.043827091e+00f, 6.035775228e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 27 % */
+        { 1.003353781e+00f, -1.996180192e+00f, 9.929042956e-01f, -1.996180192e+00f, 9.962580766e-01f },
+        { 1.006694775e+00f, -1.992219470e+00f, 9.858356439e-01f, -1.992219470e+00f, 9.925304193e-01f },
+        { 1.013444374e+00f, -1.983740609e+00f, 9.715552975e-01f, -1.983740609e+00f, 9.849996711e-01f },
+        { 1.025176759e+00f, -1.964459727e+00f, 9.442781912e-01f, -1.964459727e+00f, 9.694549504e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.048045057e+00f, -1.781939352e+00f, 8.087699375e-01f, -1.781939352e+00f, 8.568149942e-01f },
+        { 8.084120214e-01f, -1.236291681e+00f, 6.599497018e-01f, -1.236291681e+00f, 4.683617232e-01f },
+        { 9.052200920e-01f, -5.989518384e-01f, 5.284679451e-01f, -5.989518384e-01f, 4.336880371e-01f },
+        { 1.036314396e+00f, 1.043588807e+00f, 5.668970649e-01f, 1.043588807e+00f, 6.032114606e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 28 % */
+        { 1.003337437e+00f, -1.996171583e+00f, 9.929120298e-01f, -1.996171583e+00f, 9.962494667e-01f },
+        { 1.006662121e+00f, -1.992202318e+00f, 9.858511434e-01f, -1.992202318e+00f, 9.925132646e-01f },
+        { 1.013378682e+00f, -1.983706312e+00f, 9.715866702e-01f, -1.983706312e+00f, 9.849653517e-01f },
+        { 1.025112182e+00f, -1.964425166e+00f, 9.443081199e-01f, -1.964425166e+00f, 9.694203019e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.047820983e+00f, -1.781792405e+00f, 8.088408898e-01f, -1.781792405e+00f, 8.566618728e-01f },
+        { 8.077463266e-01f, -1.235534575e+00f, 6.597161702e-01f, -1.235534575e+00f, 4.674624968e-01f },
+        { 9.047082403e-01f, -5.987565342e-01f, 5.285123044e-01f, -5.987565342e-01f, 4.332205448e-01f },
+        { 1.035807608e+00f, 1.043350359e+00f, 5.670375362e-01f, 1.043350359e+00f, 6.028451442e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 29 % */
+        { 1.003321111e+00f, -1.996162953e+00f, 9.929197263e-01f, -1.996162953e+00f, 9.962408371e-01f },
+        { 1.006629503e+00f, -1.992185127e+00f, 9.858665680e-01f, -1.992185127e+00f, 9.924960706e-01f },
+        { 1.013313062e+00f, -1.983671936e+00f, 9.716178923e-01f, -1.983671936e+00f, 9.849309544e-01f },
+        { 1.025047640e+00f, -1.964390567e+00f, 9.443379748e-01f, -1.964390567e+00f, 9.693856146e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.047597005e+00f, -1.781645313e+00f, 8.089115953e-01f, -1.781645313e+00f, 8.565086002e-01f },
+        { 8.070807001e-01f, -1.234776653e+00f, 6.594816019e-01f, -1.234776653e+00f, 4.665623020e-01f },
+        { 9.041966320e-01f, -5.985611325e-01f, 5.285561872e-01f, -5.985611325e-01f, 4.327528192e-01f },
+        { 1.035301090e+00f, 1.043111744e+00f, 5.671774834e-01f, 1.043111744e+00f, 6.024785734e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 30 % */
+        { 1.003304802e+00f, -1.996154304e+00f, 9.929273854e-01f, -1.996154304e+00f, 9.962321876e-01f },
+        { 1.006596920e+00f, -1.992167896e+00f, 9.858819177e-01f, -1.992167896e+00f, 9.924788374e-01f },
+        { 1.013247515e+00f, -1.983637482e+00f, 9.716489639e-01f, -1.983637482e+00f, 9.848964790e-01f },
+        { 1.024983133e+00f, -1.964355929e+00f, 9.443677561e-01f, -1.964355929e+00f, 9.693508887e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.047373122e+00f, -1.781498076e+00f, 8.089820540e-01f, -1.781498076e+00f, 8.563551764e-01f },
+        { 8.064151411e-01f, -1.234017916e+00f, 6.592459985e-01f, -1.234017916e+00f, 4.656611396e-01f },
+        { 9.036852668e-01f, -5.983656334e-01f, 5.285995938e-01f, -5.983656334e-01f, 4.322848606e-01f },
+        { 1.034794841e+00f, 1.042872965e+00f, 5.673169071e-01f, 1.042872965e+00f, 6.021117483e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 31 % */
+        { 1.003288511e+00f, -1.996145635e+00f, 9.929350069e-01f, -1.996145635e+00f, 9.962235183e-01f },
+        { 1.006564372e+00f, -1.992150626e+00f, 9.858971925e-01f, -1.992150626e+00f, 9.924615646e-01f },
+        { 1.013182040e+00f, -1.983602951e+00f, 9.716798853e-01f, -1.983602951e+00f, 9.848619253e-01f },
+        { 1.024918660e+00f, -1.964321252e+00f, 9.443974637e-01f, -1.964321252e+00f, 9.693161239e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.047149335e+00f, -1.781350694e+00f, 8.090522660e-01f, -1.781350694e+00f, 8.562016013e-01f },
+        { 8.057496488e-01f, -1.233258366e+00f, 6.590093616e-01f, -1.233258366e+00f, 4.647590104e-01f },
+        { 9.031741442e-01f, -5.981700370e-01f, 5.286425247e-01f, -5.981700370e-01f, 4.318166690e-01f },
+        { 1.034288861e+00f, 1.042634019e+00f, 5.674558076e-01f, 1.042634019e+00f, 6.017446688e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 32 % */
+        { 1.003272238e+00f, -1.996136947e+00f, 9.929425910e-01f, -1.996136947e+00f, 9.962148291e-01f },
+        { 1.006531860e+00f, -1.992133317e+00f, 9.859123925e-01f, -1.992133317e+00f, 9.924442524e-01f },
+        { 1.013116637e+00f, -1.983568341e+00f, 9.717106567e-01f, -1.983568341e+00f, 9.848272932e-01f },
+        { 1.024854223e+00f, -1.964286537e+00f, 9.444270976e-01f, -1.964286537e+00f, 9.692813204e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.046925643e+00f, -1.781203166e+00f, 8.091222315e-01f, -1.781203166e+00f, 8.560478747e-01f },
+        { 8.050842224e-01f, -1.232498002e+00f, 6.587716929e-01f, -1.232498002e+00f, 4.638559153e-01f },
+        { 9.026632641e-01f, -5.979743433e-01f, 5.286849804e-01f, -5.979743433e-01f, 4.313482446e-01f },
+        { 1.033783149e+00f, 1.042394908e+00f, 5.675941854e-01f, 1.042394908e+00f, 6.013773349e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 33 % */
+        { 1.003255982e+00f, -1.996128238e+00f, 9.929501376e-01f, -1.996128238e+00f, 9.962061200e-01f },
+        { 1.006499383e+00f, -1.992115967e+00f, 9.859275179e-01f, -1.992115967e+00f, 9.924269006e-01f },
+        { 1.013051304e+00f, -1.983533652e+00f, 9.717412781e-01f, -1.983533652e+00f, 9.847925824e-01f },
+        { 1.024789820e+00f, -1.964251783e+00f, 9.444566580e-01f, -1.964251783e+00f, 9.692464779e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.046702046e+00f, -1.781055493e+00f, 8.091919507e-01f, -1.781055493e+00f, 8.558939966e-01f },
+        { 8.044188611e-01f, -1.231736826e+00f, 6.585329941e-01f, -1.231736826e+00f, 4.629518551e-01f },
+        { 9.021526261e-01f, -5.977785525e-01f, 5.287269614e-01f, -5.977785525e-01f, 4.308795875e-01f },
+        { 1.033277706e+00f, 1.042155632e+00f, 5.677320409e-01f, 1.042155632e+00f, 6.010097466e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 34 % */
+        { 1.003239744e+00f, -1.996119509e+00f, 9.929576469e-01f, -1.996119509e+00f, 9.961973908e-01f },
+        { 1.006466940e+00f, -1.992098579e+00f, 9.859425687e-01f, -1.992098579e+00f, 9.924095090e-01f },
+        { 1.012986043e+00f, -1.983498884e+00f, 9.717717497e-01f, -1.983498884e+00f, 9.847577929e-01f },
+        { 1.024725452e+00f, -1.964216990e+00f, 9.444861449e-01f, -1.964216990e+00f, 9.692115966e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.046478543e+00f, -1.780907674e+00f, 8.092614236e-01f, -1.780907674e+00f, 8.557399667e-01f },
+        { 8.037535639e-01f, -1.230974838e+00f, 6.582932668e-01f, -1.230974838e+00f, 4.620468307e-01f },
+        { 9.016422297e-01f, -5.975826644e-01f, 5.287684681e-01f, -5.975826644e-01f, 4.304106978e-01f },
+        { 1.032772529e+00f, 1.041916189e+00f, 5.678693746e-01f, 1.041916189e+00f, 6.006419039e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 35 % */
+        { 1.003223523e+00f, -1.996110760e+00f, 9.929651189e-01f, -1.996110760e+00f, 9.961886416e-01f },
+        { 1.006434533e+00f, -1.992081150e+00f, 9.859575450e-01f, -1.992081150e+00f, 9.923920777e-01f },
+        { 1.012920853e+00f, -1.983464038e+00f, 9.718020718e-01f, -1.983464038e+00f, 9.847229244e-01f },
+        { 1.024661118e+00f, -1.964182158e+00f, 9.445155583e-01f, -1.964182158e+00f, 9.691766763e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.046255135e+00f, -1.780759710e+00f, 8.093306504e-01f, -1.780759710e+00f, 8.555857850e-01f },
+        { 8.030883302e-01f, -1.230212039e+00f, 6.580525127e-01f, -1.230212039e+00f, 4.611408429e-01f },
+        { 9.011320747e-01f, -5.973866793e-01f, 5.288095011e-01f, -5.973866793e-01f, 4.299415758e-01f },
+        { 1.032267620e+00f, 1.041676581e+00f, 5.680061868e-01f, 1.041676581e+00f, 6.002738067e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 36 % */
+        { 1.003207319e+00f, -1.996101991e+00f, 9.929725535e-01f, -1.996101991e+00f, 9.961798723e-01f },
+        { 1.006402160e+00f, -1.992063681e+00f, 9.859724468e-01f, -1.992063681e+00f, 9.923746065e-01f },
+        { 1.012855732e+00f, -1.983429112e+00f, 9.718322444e-01f, -1.983429112e+00f, 9.846879767e-01f },
+        { 1.024596819e+00f, -1.964147288e+00f, 9.445448982e-01f, -1.964147288e+00f, 9.691417171e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.046031820e+00f, -1.780611600e+00f, 8.093996313e-01f, -1.780611600e+00f, 8.554314514e-01f },
+        { 8.024231592e-01f, -1.229448429e+00f, 6.578107334e-01f, -1.229448429e+00f, 4.602338926e-01f },
+        { 9.006221608e-01f, -5.971905972e-01f, 5.288500607e-01f, -5.971905972e-01f, 4.294722215e-01f },
+        { 1.031762977e+00f, 1.041436808e+00f, 5.681424780e-01f, 1.041436808e+00f, 5.999054550e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 37 % */
+        { 1.003191132e+00f, -1.996093202e+00f, 9.929799509e-01f, -1.996093202e+00f, 9.961710828e-01f },
+        { 1.006369821e+00f, -1.992046173e+00f, 9.859872743e-01f, -1.992046173e+00f, 9.923570953e-01f },
+        { 1.012790682e+00f, -1.983394108e+00f, 9.718622678e-01f, -1.983394108e+00f, 9.846529497e-01f },
+        { 1.024532554e+00f, -1.964112378e+00f, 9.445741647e-01f, -1.964112378e+00f, 9.691067188e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.045808599e+00f, -1.780463344e+00f, 8.094683663e-01f, -1.780463344e+00f, 8.552769657e-01f },
+        { 8.017580500e-01f, -1.228684010e+00f, 6.575679307e-01f, -1.228684010e+00f, 4.593259807e-01f },
+        { 9.001124876e-01f, -5.969944181e-01f, 5.288901475e-01f, -5.969944181e-01f, 4.290026350e-01f },
+        { 1.031258600e+00f, 1.041196869e+00f, 5.682782486e-01f, 1.041196869e+00f, 5.995368488e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 38 % */
+        { 1.003174962e+00f, -1.996084393e+00f, 9.929873111e-01f, -1.996084393e+00f, 9.961622732e-01f },
+        { 1.006337516e+00f, -1.992028625e+00f, 9.860020276e-01f, -1.992028625e+00f, 9.923395441e-01f },
+        { 1.012725701e+00f, -1.983359023e+00f, 9.718921421e-01f, -1.983359023e+00f, 9.846178432e-01f },
+        { 1.024468324e+00f, -1.964077430e+00f, 9.446033579e-01f, -1.964077430e+00f, 9.690716815e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.045585472e+00f, -1.780314942e+00f, 8.095368556e-01f, -1.780314942e+00f, 8.551223278e-01f },
+        { 8.010930019e-01f, -1.227918782e+00f, 6.573241062e-01f, -1.227918782e+00f, 4.584171081e-01f },
+        { 8.996030547e-01f, -5.967981420e-01f, 5.289297619e-01f, -5.967981420e-01f, 4.285328166e-01f },
+        { 1.030754489e+00f, 1.040956764e+00f, 5.684134991e-01f, 1.040956764e+00f, 5.991679882e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 39 % */
+        { 1.003158809e+00f, -1.996075563e+00f, 9.929946342e-01f, -1.996075563e+00f, 9.961534433e-01f },
+        { 1.006305246e+00f, -1.992011036e+00f, 9.860167066e-01f, -1.992011036e+00f, 9.923219527e-01f },
+        { 1.012660790e+00f, -1.983323860e+00f, 9.719218674e-01f, -1.983323860e+00f, 9.845826570e-01f },
+        { 1.024404127e+00f, -1.964042442e+00f, 9.446324777e-01f, -1.964042442e+00f, 9.690366050e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.045362438e+00f, -1.780166393e+00f, 8.096050994e-01f, -1.780166393e+00f, 8.549675376e-01f },
+        { 8.004280141e-01f, -1.227152745e+00f, 6.570792615e-01f, -1.227152745e+00f, 4.575072755e-01f },
+        { 8.990938619e-01f, -5.966017691e-01f, 5.289689045e-01f, -5.966017691e-01f, 4.280627663e-01f },
+        { 1.030250643e+00f, 1.040716493e+00f, 5.685482299e-01f, 1.040716493e+00f, 5.987988729e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 40 % */
+        { 1.003142673e+00f, -1.996066713e+00f, 9.930019201e-01f, -1.996066713e+00f, 9.961445932e-01f },
+        { 1.006273010e+00f, -1.991993407e+00f, 9.860313116e-01f, -1.991993407e+00f, 9.923043211e-01f },
+        { 1.012595947e+00f, -1.983288616e+00f, 9.719514440e-01f, -1.983288616e+00f, 9.845473909e-01f },
+        { 1.024339965e+00f, -1.964007416e+00f, 9.446615242e-01f, -1.964007416e+00f, 9.690014894e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.045139497e+00f, -1.780017699e+00f, 8.096730977e-01f, -1.780017699e+00f, 8.548125950e-01f },
+        { 7.997630858e-01f, -1.226385902e+00f, 6.568333983e-01f, -1.226385902e+00f, 4.565964841e-01f },
+        { 8.985849088e-01f, -5.964052994e-01f, 5.290075756e-01f, -5.964052994e-01f, 4.275924844e-01f },
+        { 1.029747062e+00f, 1.040476057e+00f, 5.686824415e-01f, 1.040476057e+00f, 5.984295032e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 41 % */
+        { 1.003126554e+00f, -1.996057843e+00f, 9.930091688e-01f, -1.996057843e+00f, 9.961357227e-01f },
+        { 1.006240807e+00f, -1.991975738e+00f, 9.860458425e-01f, -1.991975738e+00f, 9.922866491e-01f },
+        { 1.012531173e+00f, -1.983253292e+00f, 9.719808719e-01f, -1.983253292e+00f, 9.845120449e-01f },
+        { 1.024275837e+00f, -1.963972350e+00f, 9.446904975e-01f, -1.963972350e+00f, 9.689663346e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.044916649e+00f, -1.779868858e+00f, 8.097408507e-01f, -1.779868858e+00f, 8.546574997e-01f },
+        { 7.990982162e-01f, -1.225618251e+00f, 6.565865183e-01f, -1.225618251e+00f, 4.556847345e-01f },
+        { 8.980761950e-01f, -5.962087330e-01f, 5.290457757e-01f, -5.962087330e-01f, 4.271219708e-01f },
+        { 1.029243745e+00f, 1.040235455e+00f, 5.688161342e-01f, 1.040235455e+00f, 5.980598788e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 42 % */
+        { 1.003110451e+00f, -1.996048953e+00f, 9.930163806e-01f, -1.996048953e+00f, 9.961268319e-01f },
+        { 1.006208637e+00f, -1.991958028e+00f, 9.860602994e-01f, -1.991958028e+00f, 9.922689367e-01f },
+        { 1.012466467e+00f, -1.983217888e+00f, 9.720101514e-01f, -1.983217888e+00f, 9.844766186e-01f },
+        { 1.024211743e+00f, -1.963937245e+00f, 9.447193975e-01f, -1.963937245e+00f, 9.689311405e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.044693893e+00f, -1.779719870e+00f, 8.098083586e-01f, -1.779719870e+00f, 8.545022518e-01f },
+        { 7.984334047e-01f, -1.224849795e+00f, 6.563386231e-01f, -1.224849795e+00f, 4.547720278e-01f },
+        { 8.975677204e-01f, -5.960120698e-01f, 5.290835054e-01f, -5.960120698e-01f, 4.266512258e-01f },
+        { 1.028740691e+00f, 1.039994687e+00f, 5.689493084e-01f, 1.039994687e+00f, 5.976899999e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 43 % */
+        { 1.003094365e+00f, -1.996040042e+00f, 9.930235553e-01f, -1.996040042e+00f, 9.961179207e-01f },
+        { 1.006176501e+00f, -1.991940278e+00f, 9.860746825e-01f, -1.991940278e+00f, 9.922511839e-01f },
+        { 1.012401829e+00f, -1.983182404e+00f, 9.720392827e-01f, -1.983182404e+00f, 9.844411118e-01f },
+        { 1.024147683e+00f, -1.963902101e+00f, 9.447482244e-01f, -1.963902101e+00f, 9.688959072e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.044471230e+00f, -1.779570736e+00f, 8.098756214e-01f, -1.779570736e+00f, 8.543468512e-01f },
+        { 7.977686504e-01f, -1.224080534e+00f, 6.560897145e-01f, -1.224080534e+00f, 4.538583648e-01f },
+        { 8.970594844e-01f, -5.958153101e-01f, 5.291207652e-01f, -5.958153101e-01f, 4.261802495e-01f },
+        { 1.028237902e+00f, 1.039753754e+00f, 5.690819647e-01f, 1.039753754e+00f, 5.973198663e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 44 % */
+        { 1.003078296e+00f, -1.996031111e+00f, 9.930306930e-01f, -1.996031111e+00f, 9.961089890e-01f },
+        { 1.006144399e+00f, -1.991922487e+00f, 9.860889917e-01f, -1.991922487e+00f, 9.922333904e-01f },
+        { 1.012337259e+00f, -1.983146839e+00f, 9.720682657e-01f, -1.983146839e+00f, 9.844055246e-01f },
+        { 1.024083656e+00f, -1.963866918e+00f, 9.447769782e-01f, -1.963866918e+00f, 9.688606345e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.044248658e+00f, -1.779421455e+00f, 8.099426392e-01f, -1.779421455e+00f, 8.541912975e-01f },
+        { 7.971039525e-01f, -1.223310468e+00f, 6.558397940e-01f, -1.223310468e+00f, 4.529437466e-01f },
+        { 8.965514868e-01f, -5.956184538e-01f, 5.291575553e-01f, -5.956184538e-01f, 4.257090421e-01f },
+        { 1.027735375e+00f, 1.039512655e+00f, 5.692141035e-01f, 1.039512655e+00f, 5.969494782e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 45 % */
+        { 1.003062243e+00f, -1.996022159e+00f, 9.930377938e-01f, -1.996022159e+00f, 9.961000367e-01f },
+        { 1.006112329e+00f, -1.991904656e+00f, 9.861032273e-01f, -1.991904656e+00f, 9.922155562e-01f },
+        { 1.012272756e+00f, -1.983111194e+00f, 9.720971008e-01f, -1.983111194e+00f, 9.843698565e-01f },
+        { 1.024019664e+00f, -1.963831696e+00f, 9.448056589e-01f, -1.963831696e+00f, 9.688253225e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.044026179e+00f, -1.779272027e+00f, 8.100094123e-01f, -1.779272027e+00f, 8.540355908e-01f },
+        { 7.964393105e-01f, -1.222539599e+00f, 6.555888634e-01f, -1.222539599e+00f, 4.520281739e-01f },
+        { 8.960437272e-01f, -5.954215009e-01f, 5.291938765e-01f, -5.954215009e-01f, 4.252376037e-01f },
+        { 1.027233110e+00f, 1.039271390e+00f, 5.693457251e-01f, 1.039271390e+00f, 5.965788354e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 46 % */
+        { 1.003046206e+00f, -1.996013186e+00f, 9.930448577e-01f, -1.996013186e+00f, 9.960910640e-01f },
+        { 1.006080292e+00f, -1.991886784e+00f, 9.861173892e-01f, -1.991886784e+00f, 9.921976812e-01f },
+        { 1.012208319e+00f, -1.983075468e+00f, 9.721257881e-01f, -1.983075468e+00f, 9.843341076e-01f },
+        { 1.023955705e+00f, -1.963796434e+00f, 9.448342665e-01f, -1.963796434e+00f, 9.687899710e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.043803790e+00f, -1.779122452e+00f, 8.100759408e-01f, -1.779122452e+00f, 8.538797310e-01f },
+        { 7.957747235e-01f, -1.221767927e+00f, 6.553369243e-01f, -1.221767927e+00f, 4.511116478e-01f },
+        { 8.955362054e-01f, -5.952244517e-01f, 5.292297290e-01f, -5.952244517e-01f, 4.247659344e-01f },
+        { 1.026731108e+00f, 1.039029959e+00f, 5.694768301e-01f, 1.039029959e+00f, 5.962079379e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 47 % */
+        { 1.003030186e+00f, -1.996004193e+00f, 9.930518847e-01f, -1.996004193e+00f, 9.960820706e-01f },
+        { 1.006048288e+00f, -1.991868871e+00f, 9.861314775e-01f, -1.991868871e+00f, 9.921797653e-01f },
+        { 1.012143950e+00f, -1.983039660e+00f, 9.721543278e-01f, -1.983039660e+00f, 9.842982775e-01f },
+        { 1.023891779e+00f, -1.963761133e+00f, 9.448628011e-01f, -1.963761133e+00f, 9.687545801e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.043581493e+00f, -1.778972730e+00f, 8.101422247e-01f, -1.778972730e+00f, 8.537237179e-01f },
+        { 7.951101907e-01f, -1.220995453e+00f, 6.550839784e-01f, -1.220995453e+00f, 4.501941691e-01f },
+        { 8.950289210e-01f, -5.950273060e-01f, 5.292651134e-01f, -5.950273060e-01f, 4.242940344e-01f },
+        { 1.026229367e+00f, 1.038788363e+00f, 5.696074187e-01f, 1.038788363e+00f, 5.958367858e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 48 % */
+        { 1.003014182e+00f, -1.995995180e+00f, 9.930588749e-01f, -1.995995180e+00f, 9.960730566e-01f },
+        { 1.006016316e+00f, -1.991850917e+00f, 9.861454923e-01f, -1.991850917e+00f, 9.921618084e-01f },
+        { 1.012079646e+00f, -1.983003772e+00f, 9.721827199e-01f, -1.983003772e+00f, 9.842623661e-01f },
+        { 1.023827887e+00f, -1.963725792e+00f, 9.448912628e-01f, -1.963725792e+00f, 9.687191498e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.043359287e+00f, -1.778822861e+00f, 8.102082643e-01f, -1.778822861e+00f, 8.535675513e-01f },
+        { 7.944457116e-01f, -1.220222178e+00f, 6.548300274e-01f, -1.220222178e+00f, 4.492757389e-01f },
+        { 8.945218736e-01f, -5.948300640e-01f, 5.293000302e-01f, -5.948300640e-01f, 4.238219039e-01f },
+        { 1.025727887e+00f, 1.038546600e+00f, 5.697374916e-01f, 1.038546600e+00f, 5.954653789e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 49 % */
+        { 1.002998194e+00f, -1.995986145e+00f, 9.930658283e-01f, -1.995986145e+00f, 9.960640219e-01f },
+        { 1.005984377e+00f, -1.991832922e+00f, 9.861594337e-01f, -1.991832922e+00f, 9.921438105e-01f },
+        { 1.012015409e+00f, -1.982967802e+00f, 9.722109647e-01f, -1.982967802e+00f, 9.842263732e-01f },
+        { 1.023764028e+00f, -1.963690412e+00f, 9.449196515e-01f, -1.963690412e+00f, 9.686836798e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.043137172e+00f, -1.778672845e+00f, 8.102740596e-01f, -1.778672845e+00f, 8.534112312e-01f },
+        { 7.937812852e-01f, -1.219448102e+00f, 6.545750729e-01f, -1.219448102e+00f, 4.483563581e-01f },
+        { 8.940150630e-01f, -5.946327258e-01f, 5.293344798e-01f, -5.946327258e-01f, 4.233495429e-01f },
+        { 1.025226668e+00f, 1.038304672e+00f, 5.698670490e-01f, 1.038304672e+00f, 5.950937174e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 50 % */
+        { 1.002982221e+00f, -1.995977090e+00f, 9.930727450e-01f, -1.995977090e+00f, 9.960549664e-01f },
+        { 1.005952470e+00f, -1.991814885e+00f, 9.861733018e-01f, -1.991814885e+00f, 9.921257714e-01f },
+        { 1.011951236e+00f, -1.982931750e+00f, 9.722390622e-01f, -1.982931750e+00f, 9.841902987e-01f },
+        { 1.023700203e+00f, -1.963654993e+00f, 9.449479674e-01f, -1.963654993e+00f, 9.686481703e-01f },
+        { 1.059539749e+00f, -1.925221631e+00f, 8.853889242e-01f, -1.925221631e+00f, 9.449286736e-01f },
+        { 1.042915147e+00f, -1.778522681e+00f, 8.103396107e-01f, -1.778522681e+00f, 8.532547574e-01f },
+        { 7.931169111e-01f, -1.218673227e+00f, 6.543191166e-01f, -1.218673227e+00f, 4.474360277e-01f },
+        { 8.935084888e-01f, -5.944352913e-01f, 5.293684628e-01f, -5.944352913e-01f, 4.228769516e-01f },
+        { 1.024725710e+00f, 1.038062578e+00f, 5.699960914e-01f, 1.038062578e+00f, 5.947218011e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 51 % */
+        { 1.002942361e+00f, -1.995954361e+00f, 9.930898760e-01f, -1.995954361e+00f, 9.960322366e-01f },
+        { 1.005952470e+00f, -1.991814885e+00f, 9.861733018e-01f, -1.991814885e+00f, 9.921257714e-01f },
+        { 1.011951236e+00f, -1.982931750e+00f, 9.722390622e-01f, -1.982931750e+00f, 9.841902987e-01f },
+        { 1.023700203e+00f, -1.963654993e+00f, 9.449479674e-01f, -1.963654993e+00f, 9.686481703e-01f },
+        { 1.058205599e+00f, -1.924607974e+00f, 8.861031360e-01f, -1.924607974e+00f, 9.443087347e-01f },
+        { 1.042915147e+00f, -1.778522681e+00f, 8.103396107e-01f, -1.778522681e+00f, 8.532547574e-01f },
+        { 7.931169111e-01f, -1.218673227e+00f, 6.543191166e-01f, -1.218673227e+00f, 4.474360277e-01f },
+        { 8.935084888e-01f, -5.944352913e-01f, 5.293684628e-01f, -5.944352913e-01f, 4.228769516e-01f },
+        { 1.024725710e+00f, 1.038062578e+00f, 5.699960914e-01f, 1.038062578e+00f, 5.947218011e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 52 % */
+        { 1.002902598e+00f, -1.995931502e+00f, 9.931067782e-01f, -1.995931502e+00f, 9.960093762e-01f },
+        { 1.005952470e+00f, -1.991814885e+00f, 9.861733018e-01f, -1.991814885e+00f, 9.921257714e-01f },
+        { 1.011951236e+00f, -1.982931750e+00f, 9.722390622e-01f, -1.982931750e+00f, 9.841902987e-01f },
+        { 1.023700203e+00f, -1.963654993e+00f, 9.449479674e-01f, -1.963654993e+00f, 9.686481703e-01f },
+        { 1.056879801e+00f, -1.923987608e+00f, 8.868022183e-01f, -1.923987608e+00f, 9.436820193e-01f },
+        { 1.042915147e+00f, -1.778522681e+00f, 8.103396107e-01f, -1.778522681e+00f, 8.532547574e-01f },
+        { 7.931169111e-01f, -1.218673227e+00f, 6.543191166e-01f, -1.218673227e+00f, 4.474360277e-01f },
+        { 8.935084888e-01f, -5.944352913e-01f, 5.293684628e-01f, -5.944352913e-01f, 4.228769516e-01f },
+        { 1.024725710e+00f, 1.038062578e+00f, 5.699960914e-01f, 1.038062578e+00f, 5.947218011e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 53 % */
+        { 1.002862932e+00f, -1.995908511e+00f, 9.931234520e-01f, -1.995908511e+00f, 9.959863843e-01f },
+        { 1.005952470e+00f, -1.991814885e+00f, 9.861733018e-01f, -1.991814885e+00f, 9.921257714e-01f },
+        { 1.011951236e+00f, -1.982931750e+00f, 9.722390622e-01f, -1.982931750e+00f, 9.841902987e-01f },
+        { 1.023700203e+00f, -1.963654993e+00f, 9.449479674e-01f, -1.963654993e+00f, 9.686481703e-01f },
+        { 1.055562187e+00f, -1.923360466e+00f, 8.874862704e-01f, -1.923360466e+00f, 9.430484577e-01f },
+        { 1.042915147e+00f, -1.778522681e+00f, 8.103396107e-01f, -1.778522681e+00f, 8.532547574e-01f },
+        { 7.931169111e-01f, -1.218673227e+00f, 6.543191166e-01f, -1.218673227e+00f, 4.474360277e-01f },
+        { 8.935084888e-01f, -5.944352913e-01f, 5.293684628e-01f, -5.944352913e-01f, 4.228769516e-01f },
+        { 1.024725710e+00f, 1.038062578e+00f, 5.699960914e-01f, 1.038062578e+00f, 5.947218011e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 54 % */
+        { 1.002823362e+00f, -1.995885387e+00f, 9.931398980e-01f, -1.995885387e+00f, 9.959632602e-01f },
+        { 1.005952470e+00f, -1.991814885e+00f, 9.861733018e-01f, -1.991814885e+00f, 9.921257714e-01f },
+        { 1.011951236e+00f, -1.982931750e+00f, 9.722390622e-01f, -1.982931750e+00f, 9.841902987e-01f },
+        { 1.023700203e+00f, -1.963654993e+00f, 9.449479674e-01f, -1.963654993e+00f, 9.686481703e-01f },
+        { 1.054252590e+00f, -1.922726478e+00f, 8.881553900e-01f, -1.922726478e+00f, 9.424079800e-01f },
+        { 1.042915147e+00f, -1.778522681e+00f, 8.103396107e-01f, -1.778522681e+00f, 8.532547574e-01f },
+        { 7.931169111e-01f, -1.218673227e+00f, 6.543191166e-01f, -1.218673227e+00f, 4.474360277e-01f },
+        { 8.935084888e-01f, -5.944352913e-01f, 5.293684628e-01f, -5.944352913e-01f, 4.228769516e-01f },
+        { 1.024725710e+00f, 1.038062578e+00f, 5.699960914e-01f, 1.038062578e+00f, 5.947218011e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 55 % */
+        { 1.002783886e+00f, -1.995862131e+00f, 9.931561167e-01f, -1.995862131e+00f, 9.959400032e-01f },
+        { 1.005952470e+00f, -1.991814885e+00f, 9.861733018e-01f, -1.991814885e+00f, 9.921257714e-01f },
+        { 1.011951236e+00f, -1.982931750e+00f, 9.722390622e-01f, -1.982931750e+00f, 9.841902987e-01f },
+        { 1.023700203e+00f, -1.963654993e+00f, 9.449479674e-01f, -1.963654993e+00f, 9.686481703e-01f },
+        { 1.052950842e+00f, -1.922085574e+00f, 8.888096729e-01f, -1.922085574e+00f, 9.417605153e-01f },
+        { 1.042915147e+00f, -1.778522681e+00f, 8.103396107e-01f, -1.778522681e+00f, 8.532547574e-01f },
+        { 7.931169111e-01f, -1.218673227e+00f, 6.543191166e-01f, -1.218673227e+00f, 4.474360277e-01f },
+        { 8.935084888e-01f, -5.944352913e-01f, 5.293684628e-01f, -5.944352913e-01f, 4.228769516e-01f },
+        { 1.024725710e+00f, 1.038062578e+00f, 5.699960914e-01f, 1.038062578e+00f, 5.947218011e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 56 % */
+        { 1.002744504e+00f, -1.995838741e+00f, 9.931721088e-01f, -1.995838741e+00f, 9.959166124e-01f },
+        { 1.005952470e+00f, -1.991814885e+00f, 9.861733018e-01f, -1.991814885e+00f, 9.921257714e-01f },
+        { 1.011951236e+00f, -1.982931750e+00f, 9.722390622e-01f, -1.982931750e+00f, 9.841902987e-01f },
+        { 1.023700203e+00f, -1.963654993e+00f, 9.449479674e-01f, -1.963654993e+00f, 9.686481703e-01f },
+        { 1.051656779e+00f, -1.921437683e+00f, 8.894492131e-01f, -1.921437683e+00f, 9.411059924e-01f },
+        { 1.042915147e+00f, -1.778522681e+00f, 8.103396107e-01f, -1.778522681e+00f, 8.532547574e-01f },
+        { 7.931169111e-01f, -1.218673227e+00f, 6.543191166e-01f, -1.218673227e+00f, 4.474360277e-01f },
+        { 8.935084888e-01f, -5.944352913e-01f, 5.293684628e-01f, -5.944352913e-01f, 4.228769516e-01f },
+        { 1.024725710e+00f, 1.038062578e+00f, 5.699960914e-01f, 1.038062578e+00f, 5.947218011e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 57 % */
+        { 1.002705213e+00f, -1.995815217e+00f, 9.931878747e-01f, -1.995815217e+00f, 9.958930872e-01f },
+        { 1.005952470e+00f, -1.991814885e+00f, 9.861733018e-01f, -1.991814885e+00f, 9.921257714e-01f },
+        { 1.011951236e+00f, -1.982931750e+00f, 9.722390622e-01f, -1.982931750e+00f, 9.841902987e-01f },
+        { 1.023700203e+00f, -1.963654993e+00f, 9.449479674e-01f, -1.963654993e+00f, 9.686481703e-01f },
+        { 1.050370236e+00f, -1.920782734e+00f, 8.900741028e-01f, -1.920782734e+00f, 9.404443392e-01f },
+        { 1.042915147e+00f, -1.778522681e+00f, 8.103396107e-01f, -1.778522681e+00f, 8.532547574e-01f },
+        { 7.931169111e-01f, -1.218673227e+00f, 6.543191166e-01f, -1.218673227e+00f, 4.474360277e-01f },
+        { 8.935084888e-01f, -5.944352913e-01f, 5.293684628e-01f, -5.944352913e-01f, 4.228769516e-01f },
+        { 1.024725710e+00f, 1.038062578e+00f, 5.699960914e-01f, 1.038062578e+00f, 5.947218011e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 58 % */
+        { 1.002666012e+00f, -1.995791558e+00f, 9.932034149e-01f, -1.995791558e+00f, 9.958694267e-01f },
+        { 1.005952470e+00f, -1.991814885e+00f, 9.861733018e-01f, -1.991814885e+00f, 9.921257714e-01f },
+        { 1.011951236e+00f, -1.982931750e+00f, 9.722390622e-01f, -1.982931750e+00f, 9.841902987e-01f },
+        { 1.023700203e+00f, -1.963654993e+00f, 9.449479674e-01f, -1.963654993e+00f, 9.686481703e-01f },
+        { 1.049091051e+00f, -1.920120655e+00f, 8.906844323e-01f, -1.920120655e+00f, 9.397754833e-01f },
+        { 1.042915147e+00f, -1.778522681e+00f, 8.103396107e-01f, -1.778522681e+00f, 8.532547574e-01f },
+        { 7.931169111e-01f, -1.218673227e+00f, 6.543191166e-01f, -1.218673227e+00f, 4.474360277e-01f },
+        { 8.935084888e-01f, -5.944352913e-01f, 5.293684628e-01f, -5.944352913e-01f, 4.228769516e-01f },
+        { 1.024725710e+00f, 1.038062578e+00f, 5.699960914e-01f, 1.038062578e+00f, 5.947218011e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 59 % */
+        { 1.002626900e+00f, -1.995767762e+00f, 9.932187300e-01f, -1.995767762e+00f, 9.958456301e-01f },
+        { 1.005952470e+00f, -1.991814885e+00f, 9.861733018e-01f, -1.991814885e+00f, 9.921257714e-01f },
+        { 1.011951236e+00f, -1.982931750e+00f, 9.722390622e-01f, -1.982931750e+00f, 9.841902987e-01f },
+        { 1.023700203e+00f, -1.963654993e+00f, 9.449479674e-01f, -1.963654993e+00f, 9.686481703e-01f },
+        { 1.047819061e+00f, -1.919451374e+00f, 8.912802903e-01f, -1.919451374e+00f, 9.390993513e-01f },
+        { 1.042915147e+00f, -1.778522681e+00f, 8.103396107e-01f, -1.778522681e+00f, 8.532547574e-01f },
+        { 7.931169111e-01f, -1.218673227e+00f, 6.543191166e-01f, -1.218673227e+00f, 4.474360277e-01f },
+        { 8.935084888e-01f, -5.944352913e-01f, 5.293684628e-01f, -5.944352913e-01f, 4.228769516e-01f },
+        { 1.024725710e+00f, 1.038062578e+00f, 5.699960914e-01f, 1.038062578e+00f, 5.947218011e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 60 % */
+        { 1.002587876e+00f, -1.995743830e+00f, 9.932338206e-01f, -1.995743830e+00f, 9.958216968e-01f },
+        { 1.005952470e+00f, -1.991814885e+00f, 9.861733018e-01f, -1.991814885e+00f, 9.921257714e-01f },
+        { 1.011951236e+00f, -1.982931750e+00f, 9.722390622e-01f, -1.982931750e+00f, 9.841902987e-01f },
+        { 1.023700203e+00f, -1.963654993e+00f, 9.449479674e-01f, -1.963654993e+00f, 9.686481703e-01f },
+        { 1.046554106e+00f, -1.918774818e+00f, 8.918617638e-01f, -1.918774818e+00f, 9.384158695e-01f },
+        { 1.042915147e+00f, -1.778522681e+00f, 8.103396107e-01f, -1.778522681e+00f, 8.532547574e-01f },
+        { 7.931169111e-01f, -1.218673227e+00f, 6.543191166e-01f, -1.218673227e+00f, 4.474360277e-01f },
+        { 8.935084888e-01f, -5.944352913e-01f, 5.293684628e-01f, -5.944352913e-01f, 4.228769516e-01f },
+        { 1.024725710e+00f, 1.038062578e+00f, 5.699960914e-01f, 1.038062578e+00f, 5.947218011e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 61 % */
+        { 1.002548939e+00f, -1.995719760e+00f, 9.932486870e-01f, -1.995719760e+00f, 9.957976259e-01f },
+        { 1.005872841e+00f, -1.991769614e+00f, 9.862076515e-01f, -1.991769614e+00f, 9.920804930e-01f },
+        { 1.011791091e+00f, -1.982841263e+00f, 9.723086632e-01f, -1.982841263e+00f, 9.840997539e-01f },
+        { 1.023381573e+00f, -1.963477302e+00f, 9.450884547e-01f, -1.963477302e+00f, 9.684700276e-01f },
+        { 1.045296026e+00f, -1.918090912e+00f, 8.924289378e-01f, -1.918090912e+00f, 9.377249633e-01f },
+        { 1.040699818e+00f, -1.777012904e+00f, 8.109817236e-01f, -1.777012904e+00f, 8.516815412e-01f },
+        { 7.897957980e-01f, -1.214786888e+00f, 6.530243672e-01f, -1.214786888e+00f, 4.428201652e-01f },
+        { 8.884556782e-01f, -5.924556689e-01f, 5.296827271e-01f, -5.924556689e-01f, 4.181384052e-01f },
+        { 1.019730340e+00f, 1.035632518e+00f, 5.712582858e-01f, 1.035632518e+00f, 5.909886256e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 62 % */
+        { 1.002510087e+00f, -1.995695551e+00f, 9.932633298e-01f, -1.995695551e+00f, 9.957734166e-01f },
+        { 1.005793411e+00f, -1.991724083e+00f, 9.862415445e-01f, -1.991724083e+00f, 9.920349553e-01f },
+        { 1.011631347e+00f, -1.982750261e+00f, 9.723773475e-01f, -1.982750261e+00f, 9.840086947e-01f },
+        { 1.023063763e+00f, -1.963298618e+00f, 9.452271258e-01f, -1.963298618e+00f, 9.682908890e-01f },
+        { 1.044044662e+00f, -1.917399583e+00f, 8.929818958e-01f, -1.917399583e+00f, 9.370265578e-01f },
+        { 1.038493258e+00f, -1.775488251e+00f, 8.115995647e-01f, -1.775488251e+00f, 8.500928232e-01f },
+        { 7.864758855e-01f, -1.210880684e+00f, 6.517048249e-01f, -1.210880684e+00f, 4.381807104e-01f },
+        { 8.834261546e-01f, -5.904664936e-01f, 5.299508382e-01f, -5.904664936e-01f, 4.133769927e-01f },
+        { 1.014760513e+00f, 1.033185868e+00f, 5.724694499e-01f, 1.033185868e+00f, 5.872299630e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 63 % */
+        { 1.002471319e+00f, -1.995671204e+00f, 9.932777495e-01f, -1.995671204e+00f, 9.957490681e-01f },
+        { 1.005714175e+00f, -1.991678292e+00f, 9.862749818e-01f, -1.991678292e+00f, 9.919891568e-01f },
+        { 1.011472001e+00f, -1.982658743e+00f, 9.724451176e-01f, -1.982658743e+00f, 9.839171183e-01f },
+        { 1.022746764e+00f, -1.963118935e+00f, 9.453639856e-01f, -1.963118935e+00f, 9.681107492e-01f },
+        { 1.042799858e+00f, -1.916700756e+00f, 8.935207196e-01f, -1.916700756e+00f, 9.363205772e-01f },
+        { 1.036295220e+00f, -1.773948602e+00f, 8.121932599e-01f, -1.773948602e+00f, 8.484884800e-01f },
+        { 7.831570917e-01f, -1.206954726e+00f, 6.503607002e-01f, -1.206954726e+00f, 4.335177919e-01f },
+        { 8.784196023e-01f, -5.884678290e-01f, 5.301732637e-01f, -5.884678290e-01f, 4.085928660e-01f },
+        { 1.009815797e+00f, 1.030722620e+00f, 5.736300060e-01f, 1.030722620e+00f, 5.834458033e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 64 % */
+        { 1.002432633e+00f, -1.995646716e+00f, 9.932919465e-01f, -1.995646716e+00f, 9.957245797e-01f },
+        { 1.005635131e+00f, -1.991632238e+00f, 9.863079647e-01f, -1.991632238e+00f, 9.919430960e-01f },
+        { 1.011313046e+00f, -1.982566705e+00f, 9.725119756e-01f, -1.982566705e+00f, 9.838250217e-01f },
+        { 1.022430564e+00f, -1.962938248e+00f, 9.454990387e-01f, -1.962938248e+00f, 9.679296026e-01f },
+        { 1.041561456e+00f, -1.915994355e+00f, 8.940454892e-01f, -1.915994355e+00f, 9.356069451e-01f },
+        { 1.034105455e+00f, -1.772393840e+00f, 8.127629328e-01f, -1.772393840e+00f, 8.468683879e-01f },
+        { 7.798393384e-01f, -1.203009124e+00f, 6.489922040e-01f, -1.203009124e+00f, 4.288315425e-01f },
+        { 8.734357119e-01f, -5.864597405e-01f, 5.303504696e-01f, -5.864597405e-01f, 4.037861815e-01f },
+        { 1.004895766e+00f, 1.028242771e+00f, 5.747403732e-01f, 1.028242771e+00f, 5.796361393e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 65 % */
+        { 1.002394029e+00f, -1.995622088e+00f, 9.933059215e-01f, -1.995622088e+00f, 9.956999505e-01f },
+        { 1.005556277e+00f, -1.991585921e+00f, 9.863404941e-01f, -1.991585921e+00f, 9.918967714e-01f },
+        { 1.011154478e+00f, -1.982474144e+00f, 9.725779240e-01f, -1.982474144e+00f, 9.837324021e-01f },
+        { 1.022115154e+00f, -1.962756551e+00f, 9.456322901e-01f, -1.962756551e+00f, 9.677474438e-01f },
+        { 1.040329301e+00f, -1.915280304e+00f, 8.945562830e-01f, -1.915280304e+00f, 9.348855845e-01f },
+        { 1.031923718e+00f, -1.770823845e+00f, 8.133087047e-01f, -1.770823845e+00f, 8.452324228e-01f },
+        { 7.765225512e-01f, -1.199043994e+00f, 6.475995483e-01f, -1.199043994e+00f, 4.241220995e-01f },
+        { 8.684741805e-01f, -5.844422952e-01f, 5.304829196e-01f, -5.844422952e-01f, 3.989571001e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 66 % */
+        { 1.002355505e+00f, -1.995597318e+00f, 9.933196747e-01f, -1.995597318e+00f, 9.956751797e-01f },
+        { 1.005477610e+00f, -1.991539338e+00f, 9.863725712e-01f, -1.991539338e+00f, 9.918501816e-01f },
+        { 1.010996291e+00f, -1.982381057e+00f, 9.726429650e-01f, -1.982381057e+00f, 9.836392564e-01f },
+        { 1.021800523e+00f, -1.962573839e+00f, 9.457637443e-01f, -1.962573839e+00f, 9.675642675e-01f },
+        { 1.039103240e+00f, -1.914558525e+00f, 8.950531777e-01f, -1.914558525e+00f, 9.341564178e-01f },
+        { 1.029749766e+00f, -1.769238497e+00f, 8.138306946e-01f, -1.769238497e+00f, 8.435804604e-01f },
+        { 7.732066595e-01f, -1.195059455e+00f, 6.461829454e-01f, -1.195059455e+00f, 4.193896049e-01f },
+        { 8.635347112e-01f, -5.824155622e-01f, 5.305710759e-01f, -5.824155622e-01f, 3.941057871e-01f },
+        { 9.951280857e-01f, 1.023233260e+00f, 5.768122017e-01f, 1.023233260e+00f, 5.719402874e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 67 % */
+        { 1.002317060e+00f, -1.995572406e+00f, 9.933332067e-01f, -1.995572406e+00f, 9.956502665e-01f },
+        { 1.005399128e+00f, -1.991492489e+00f, 9.864041971e-01f, -1.991492489e+00f, 9.918033250e-01f },
+        { 1.010838481e+00f, -1.982287442e+00f, 9.727071007e-01f, -1.982287442e+00f, 9.835455819e-01f },
+        { 1.021486662e+00f, -1.962390107e+00f, 9.458934062e-01f, -1.962390107e+00f, 9.673800681e-01f },
+        { 1.037883118e+00f, -1.913828942e+00f, 8.955362483e-01f, -1.913828942e+00f, 9.334193666e-01f },
+        { 1.027583357e+00f, -1.767637678e+00f, 8.143290193e-01f, -1.767637678e+00f, 8.419123758e-01f },
+        { 7.698915964e-01f, -1.191055631e+00f, 6.447426085e-01f, -1.191055631e+00f, 4.146342049e-01f },
+        { 8.586170136e-01f, -5.803796125e-01f, 5.306153988e-01f, -5.803796125e-01f, 3.892324123e-01f },
+        { 9.902796161e-01f, 1.020703601e+00f, 5.777744861e-01f, 1.020703601e+00f, 5.680541022e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 68 % */
+        { 1.002278692e+00f, -1.995547351e+00f, 9.933465179e-01f, -1.995547351e+00f, 9.956252102e-01f },
+        { 1.005320827e+00f, -1.991445372e+00f, 9.864353728e-01f, -1.991445372e+00f, 9.917562001e-01f },
+        { 1.010681042e+00f, -1.982193296e+00f, 9.727703335e-01f, -1.982193296e+00f, 9.834513755e-01f },
+        { 1.021173560e+00f, -1.962205349e+00f, 9.460212801e-01f, -1.962205349e+00f, 9.671948400e-01f },
+        { 1.036668784e+00f, -1.913091477e+00f, 8.960055683e-01f, -1.913091477e+00f, 9.326743522e-01f },
+        { 1.025424251e+00f, -1.766021267e+00f, 8.148037933e-01f, -1.766021267e+00f, 8.402280441e-01f },
+        { 7.665772986e-01f, -1.187032649e+00f, 6.432787515e-01f, -1.187032649e+00f, 4.098560501e-01f },
+        { 8.537208034e-01f, -5.783345189e-01f, 5.306163468e-01f, -5.783345189e-01f, 3.843371502e-01f },
+        { 9.854541905e-01f, 1.018157343e+00f, 5.786882279e-01f, 1.018157343e+00f, 5.641424183e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 69 % */
+        { 1.002240401e+00f, -1.995522151e+00f, 9.933596088e-01f, -1.995522151e+00f, 9.956000098e-01f },
+        { 1.005242706e+00f, -1.991397984e+00f, 9.864660994e-01f, -1.991397984e+00f, 9.917088054e-01f },
+        { 1.010523969e+00f, -1.982098614e+00f, 9.728326654e-01f, -1.982098614e+00f, 9.833566343e-01f },
+        { 1.020861207e+00f, -1.962019559e+00f, 9.461473707e-01f, -1.962019559e+00f, 9.670085778e-01f },
+        { 1.035460085e+00f, -1.912346050e+00f, 8.964612096e-01f, -1.912346050e+00f, 9.319212948e-01f },
+        { 1.023272211e+00f, -1.764389143e+00f, 8.152551292e-01f, -1.764389143e+00f, 8.385273401e-01f },
+        { 7.632637068e-01f, -1.182990639e+00f, 6.417915891e-01f, -1.182990639e+00f, 4.050552959e-01f },
+        { 8.488458026e-01f, -5.762803561e-01f, 5.305743770e-01f, -5.762803561e-01f, 3.794201795e-01f },
+        { 9.806514144e-01f, 1.015594494e+00f, 5.795538315e-01f, 1.015594494e+00f, 5.602052459e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 70 % */
+        { 1.002202185e+00f, -1.995496807e+00f, 9.933724798e-01f, -1.995496807e+00f, 9.955746646e-01f },
+        { 1.005164761e+00f, -1.991350326e+00f, 9.864963780e-01f, -1.991350326e+00f, 9.916611394e-01f },
+        { 1.010367257e+00f, -1.982003396e+00f, 9.728940987e-01f, -1.982003396e+00f, 9.832613552e-01f },
+        { 1.020549593e+00f, -1.961832732e+00f, 9.462716825e-01f, -1.961832732e+00f, 9.668212759e-01f },
+        { 1.034256872e+00f, -1.911592582e+00f, 8.969032423e-01f, -1.911592582e+00f, 9.311601143e-01f },
+        { 1.021127001e+00f, -1.762741187e+00f, 8.156831371e-01f, -1.762741187e+00f, 8.368101382e-01f },
+        { 7.599507652e-01f, -1.178929736e+00f, 6.402813367e-01f, -1.178929736e+00f, 4.002321019e-01f },
+        { 8.439917391e-01f, -5.742172007e-01f, 5.304899445e-01f, -5.742172007e-01f, 3.744816836e-01f },
+        { 9.758708994e-01f, 1.013015062e+00f, 5.803716990e-01f, 1.013015062e+00f, 5.562425984e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 71 % */
+        { 1.002164042e+00f, -1.995471317e+00f, 9.933851314e-01f, -1.995471317e+00f, 9.955491737e-01f },
+        { 1.005086991e+00f, -1.991302394e+00f, 9.865262095e-01f, -1.991302394e+00f, 9.916132005e-01f },
+        { 1.010210900e+00f, -1.981907637e+00f, 9.729546354e-01f, -1.981907637e+00f, 9.831655354e-01f },
+        { 1.020238709e+00f, -1.961644862e+00f, 9.463942198e-01f, -1.961644862e+00f, 9.666329287e-01f },
+        { 1.033657276e+00f, -1.911212808e+00f, 8.971191769e-01f, -1.911212808e+00f, 9.307764526e-01f },
+        { 1.020056884e+00f, -1.761911234e+00f, 8.158884270e-01f, -1.761911234e+00f, 8.359453112e-01f },
+        { 7.566384217e-01f, -1.174850078e+00f, 6.387482107e-01f, -1.174850078e+00f, 3.953866324e-01f },
+        { 8.415724755e-01f, -5.731822752e-01f, 5.304319466e-01f, -5.731822752e-01f, 3.720044221e-01f },
+        { 9.734888703e-01f, 1.011719131e+00f, 5.807628565e-01f, 1.011719131e+00f, 5.542517267e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 72 % */
+        { 1.002125972e+00f, -1.995445681e+00f, 9.933975639e-01f, -1.995445681e+00f, 9.955235363e-01f },
+        { 1.005009392e+00f, -1.991254189e+00f, 9.865555950e-01f, -1.991254189e+00f, 9.915649872e-01f },
+        { 1.010054894e+00f, -1.981811334e+00f, 9.730142776e-01f, -1.981811334e+00f, 9.830691717e-01f },
+        { 1.019928543e+00f, -1.961455945e+00f, 9.465149871e-01f, -1.961455945e+00f, 9.664435304e-01f },
+        { 1.033058995e+00f, -1.910830993e+00f, 8.973317350e-01f, -1.910830993e+00f, 9.303907297e-01f },
+        { 1.018988387e+00f, -1.761077278e+00f, 8.160879253e-01f, -1.761077278e+00f, 8.350763126e-01f },
+        { 7.533266278e-01f, -1.170751807e+00f, 6.371924281e-01f, -1.170751807e+00f, 3.905190559e-01f },
+        { 8.391583470e-01f, -5.721451311e-01f, 5.303635031e-01f, -5.721451311e-01f, 3.695218501e-01f },
+        { 9.711122636e-01f, 1.010419059e+00f, 5.811422294e-01f, 1.010419059e+00f, 5.522544930e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 73 % */
+        { 1.002087974e+00f, -1.995419897e+00f, 9.934097778e-01f, -1.995419897e+00f, 9.954977516e-01f },
+        { 1.004931963e+00f, -1.991205707e+00f, 9.865845354e-01f, -1.991205707e+00f, 9.915164979e-01f },
+        { 1.009899234e+00f, -1.981714485e+00f, 9.730730274e-01f, -1.981714485e+00f, 9.829722611e-01f },
+        { 1.019619087e+00f, -1.961265973e+00f, 9.466339886e-01f, -1.961265973e+00f, 9.662530756e-01f },
+        { 1.032462011e+00f, -1.910447128e+00f, 8.975409249e-01f, -1.910447128e+00f, 9.300029355e-01f },
+        { 1.017921481e+00f, -1.760239303e+00f, 8.162816451e-01f, -1.760239303e+00f, 8.342031266e-01f },
+        { 7.500153388e-01f, -1.166635069e+00f, 6.356142068e-01f, -1.166635069e+00f, 3.856295456e-01f },
+        { 8.367493213e-01f, -5.711057785e-01f, 5.302846705e-01f, -5.711057785e-01f, 3.670339917e-01f },
+        { 9.687410326e-01f, 1.009114847e+00f, 5.815098673e-01f, 1.009114847e+00f, 5.502508999e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 74 % */
+        { 1.002050045e+00f, -1.995393965e+00f, 9.934217735e-01f, -1.995393965e+00f, 9.954718187e-01f },
+        { 1.004854699e+00f, -1.991156948e+00f, 9.866130317e-01f, -1.991156948e+00f, 9.914677310e-01f },
+        { 1.009743914e+00f, -1.981617086e+00f, 9.731308868e-01f, -1.981617086e+00f, 9.828748006e-01f },
+        { 1.019310330e+00f, -1.961074942e+00f, 9.467512286e-01f, -1.961074942e+00f, 9.660615585e-01f },
+        { 1.031866305e+00f, -1.910061203e+00f, 8.977467548e-01f, -1.910061203e+00f, 9.296130596e-01f },
+        { 1.016856138e+00f, -1.759397294e+00f, 8.164695997e-01f, -1.759397294e+00f, 8.333257375e-01f },
+        { 7.467045136e-01f, -1.162500013e+00f, 6.340137656e-01f, -1.162500013e+00f, 3.807182792e-01f },
+        { 8.343453664e-01f, -5.700642277e-01f, 5.301955050e-01f, -5.700642277e-01f, 3.645408714e-01f },
+        { 9.663751308e-01f, 1.007806498e+00f, 5.818658195e-01f, 1.007806498e+00f, 5.482409503e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 75 % */
+        { 1.002012185e+00f, -1.995367884e+00f, 9.934335514e-01f, -1.995367884e+00f, 9.954457367e-01f },
+        { 1.004777600e+00f, -1.991107909e+00f, 9.866410850e-01f, -1.991107909e+00f, 9.914186851e-01f },
+        { 1.009588929e+00f, -1.981519135e+00f, 9.731878578e-01f, -1.981519135e+00f, 9.827767871e-01f },
+        { 1.019002262e+00f, -1.960882845e+00f, 9.468667113e-01f, -1.960882845e+00f, 9.658689734e-01f },
+        { 1.031271859e+00f, -1.909673207e+00f, 8.979492329e-01f, -1.909673207e+00f, 9.292210918e-01f },
+        { 1.015792327e+00f, -1.758551236e+00f, 8.166518019e-01f, -1.758551236e+00f, 8.324441293e-01f },
+        { 7.433941145e-01f, -1.158346793e+00f, 6.323913243e-01f, -1.158346793e+00f, 3.757854388e-01f },
+        { 8.319464508e-01f, -5.690204888e-01f, 5.300960631e-01f, -5.690204888e-01f, 3.620425139e-01f },
+        { 9.640145122e-01f, 1.006494013e+00f, 5.822101353e-01f, 1.006494013e+00f, 5.462246475e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 76 % */
+        { 1.001974393e+00f, -1.995341653e+00f, 9.934451119e-01f, -1.995341653e+00f, 9.954195049e-01f },
+        { 1.004700662e+00f, -1.991058590e+00f, 9.866686961e-01f, -1.991058590e+00f, 9.913693584e-01f },
+        { 1.009434275e+00f, -1.981420628e+00f, 9.732439423e-01f, -1.981420628e+00f, 9.826782176e-01f },
+        { 1.018694874e+00f, -1.960689677e+00f, 9.469804409e-01f, -1.960689677e+00f, 9.656753145e-01f },
+        { 1.030678655e+00f, -1.909283129e+00f, 8.981483672e-01f, -1.909283129e+00f, 9.288270218e-01f },
+        { 1.014730022e+00f, -1.757701115e+00f, 8.168282645e-01f, -1.757701115e+00f, 8.315582865e-01f },
+        { 7.400841076e-01f, -1.154175566e+00f, 6.307471033e-01f, -1.154175566e+00f, 3.708312109e-01f },
+        { 8.295525433e-01f, -5.679745725e-01f, 5.299864009e-01f, -5.679745725e-01f, 3.595389442e-01f },
+        { 9.616591312e-01f, 1.005177394e+00f, 5.825428636e-01f, 1.005177394e+00f, 5.442019949e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 77 % */
+        { 1.001936667e+00f, -1.995315272e+00f, 9.934564554e-01f, -1.995315272e+00f, 9.953931223e-01f },
+        { 1.004623883e+00f, -1.991008989e+00f, 9.866958660e-01f, -1.991008989e+00f, 9.913197494e-01f },
+        { 1.009279946e+00f, -1.981321562e+00f, 9.732991424e-01f, -1.981321562e+00f, 9.825790889e-01f },
+        { 1.018388155e+00f, -1.960495433e+00f, 9.470924214e-01f, -1.960495433e+00f, 9.654805761e-01f },
+        { 1.030086673e+00f, -1.908890961e+00f, 8.983441657e-01f, -1.908890961e+00f, 9.284308391e-01f },
+        { 1.013669193e+00f, -1.756846914e+00f, 8.169990003e-01f, -1.756846914e+00f, 8.306681930e-01f },
+        { 7.367744626e-01f, -1.149986492e+00f, 6.290813241e-01f, -1.149986492e+00f, 3.658557867e-01f },
+        { 8.271636131e-01f, -5.669264893e-01f, 5.298665745e-01f, -5.669264893e-01f, 3.570301875e-01f },
+        { 9.593089425e-01f, 1.003856645e+00f, 5.828640534e-01f, 1.003856645e+00f, 5.421729959e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 78 % */
+        { 1.001899006e+00f, -1.995288739e+00f, 9.934675823e-01f, -1.995288739e+00f, 9.953665881e-01f },
+        { 1.004547261e+00f, -1.990959104e+00f, 9.867225956e-01f, -1.990959104e+00f, 9.912698565e-01f },
+        { 1.009125938e+00f, -1.981221935e+00f, 9.733534599e-01f, -1.981221935e+00f, 9.824793979e-01f },
+        { 1.018082095e+00f, -1.960300106e+00f, 9.472026569e-01f, -1.960300106e+00f, 9.652847523e-01f },
+        { 1.029495897e+00f, -1.908496691e+00f, 8.985366362e-01f, -1.908496691e+00f, 9.280325333e-01f },
+        { 1.012609812e+00f, -1.755988619e+00f, 8.171640217e-01f, -1.755988619e+00f, 8.297738333e-01f },
+        { 7.334651526e-01f, -1.145779736e+00f, 6.273942091e-01f, -1.145779736e+00f, 3.608593617e-01f },
+        { 8.247796297e-01f, -5.658762498e-01f, 5.297366399e-01f, -5.658762498e-01f, 3.545162695e-01f },
+        { 9.569639011e-01f, 1.002531767e+00f, 5.831737535e-01f, 1.002531767e+00f, 5.401376546e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 79 % */
+        { 1.001861409e+00f, -1.995262053e+00f, 9.934784929e-01f, -1.995262053e+00f, 9.953399015e-01f },
+        { 1.004470792e+00f, -1.990908933e+00f, 9.867488858e-01f, -1.990908933e+00f, 9.912196781e-01f },
+        { 1.008972245e+00f, -1.981121742e+00f, 9.734068968e-01f, -1.981121742e+00f, 9.823791416e-01f },
+        { 1.017776686e+00f, -1.960103690e+00f, 9.473111514e-01f, -1.960103690e+00f, 9.650878374e-01f },
+        { 1.028906308e+00f, -1.908100309e+00f, 8.987257864e-01f, -1.908100309e+00f, 9.276320940e-01f },
+        { 1.011551850e+00f, -1.755126215e+00f, 8.173233413e-01f, -1.755126215e+00f, 8.288751913e-01f },
+        { 7.301561543e-01f, -1.141555468e+00f, 6.256859815e-01f, -1.141555468e+00f, 3.558421358e-01f },
+        { 8.224005630e-01f, -5.648238648e-01f, 5.295966530e-01f, -5.648238648e-01f, 3.519972160e-01f },
+        { 9.546239625e-01f, 1.001202763e+00f, 5.834720125e-01f, 1.001202763e+00f, 5.380959750e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 80 % */
+        { 1.001823874e+00f, -1.995235214e+00f, 9.934891876e-01f, -1.995235214e+00f, 9.953130615e-01f },
+        { 1.004394475e+00f, -1.990858476e+00f, 9.867747376e-01f, -1.990858476e+00f, 9.911692125e-01f },
+        { 1.008818862e+00f, -1.981020981e+00f, 9.734594548e-01f, -1.981020981e+00f, 9.822783166e-01f },
+        { 1.017471917e+00f, -1.959906181e+00f, 9.474179088e-01f, -1.959906181e+00f, 9.648898256e-01f },
+        { 1.028317887e+00f, -1.907701805e+00f, 8.989116240e-01f, -1.907701805e+00f, 9.272295107e-01f },
+        { 1.010495280e+00f, -1.754259686e+00f, 8.174769714e-01f, -1.754259686e+00f, 8.279722514e-01f },
+        { 7.268474480e-01f, -1.137313858e+00f, 6.239568655e-01f, -1.137313858e+00f, 3.508043135e-01f },
+        { 8.200263832e-01f, -5.637693453e-01f, 5.294466698e-01f, -5.637693453e-01f, 3.494730530e-01f },
+        { 9.522890826e-01f, 9.998696365e-01f, 5.837588789e-01f, 9.998696365e-01f, 5.360479615e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 81 % */
+        { 1.001786400e+00f, -1.995208221e+00f, 9.934996668e-01f, -1.995208221e+00f, 9.952860673e-01f },
+        { 1.004394475e+00f, -1.990858476e+00f, 9.867747376e-01f, -1.990858476e+00f, 9.911692125e-01f },
+        { 1.008818862e+00f, -1.981020981e+00f, 9.734594548e-01f, -1.981020981e+00f, 9.822783166e-01f },
+        { 1.016864259e+00f, -1.959507855e+00f, 9.476262277e-01f, -1.959507855e+00f, 9.644904872e-01f },
+        { 1.027730616e+00f, -1.907301168e+00f, 8.990941566e-01f, -1.907301168e+00f, 9.268247729e-01f },
+        { 1.009440073e+00f, -1.753389017e+00f, 8.176249241e-01f, -1.753389017e+00f, 8.270649975e-01f },
+        { 7.235390172e-01f, -1.133055082e+00f, 6.222070864e-01f, -1.133055082e+00f, 3.457461035e-01f },
+        { 8.176570611e-01f, -5.627127022e-01f, 5.292867459e-01f, -5.627127022e-01f, 3.469438070e-01f },
+        { 9.476343241e-01f, 9.971910261e-01f, 5.842986270e-01f, 9.971910261e-01f, 5.319329511e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 82 % */
+        { 1.001748987e+00f, -1.995181073e+00f, 9.935099308e-01f, -1.995181073e+00f, 9.952589179e-01f },
+        { 1.004394475e+00f, -1.990858476e+00f, 9.867747376e-01f, -1.990858476e+00f, 9.911692125e-01f },
+        { 1.008818862e+00f, -1.981020981e+00f, 9.734594548e-01f, -1.981020981e+00f, 9.822783166e-01f },
+        { 1.016259046e+00f, -1.959105082e+00f, 9.478276441e-01f, -1.959105082e+00f, 9.640866899e-01f },
+        { 1.027144478e+00f, -1.906898388e+00f, 8.992733916e-01f, -1.906898388e+00f, 9.264178699e-01f },
+        { 1.008386203e+00f, -1.752514193e+00f, 8.177672115e-01f, -1.752514193e+00f, 8.261534140e-01f },
+        { 7.202308491e-01f, -1.128779321e+00f, 6.204368701e-01f, -1.128779321e+00f, 3.406677192e-01f },
+        { 8.152925677e-01f, -5.616539467e-01f, 5.291169370e-01f, -5.616539467e-01f, 3.444095046e-01f },
+        { 9.429992798e-01f, 9.944959615e-01f, 5.847933830e-01f, 9.944959615e-01f, 5.277926628e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 83 % */
+        { 1.001711633e+00f, -1.995153768e+00f, 9.935199800e-01f, -1.995153768e+00f, 9.952316126e-01f },
+        { 1.004394475e+00f, -1.990858476e+00f, 9.867747376e-01f, -1.990858476e+00f, 9.911692125e-01f },
+        { 1.008818862e+00f, -1.981020981e+00f, 9.734594548e-01f, -1.981020981e+00f, 9.822783166e-01f },
+        { 1.015656198e+00f, -1.958697813e+00f, 9.480221874e-01f, -1.958697813e+00f, 9.636783856e-01f },
+        { 1.026559455e+00f, -1.906493455e+00f, 8.994493364e-01f, -1.906493455e+00f, 9.260087911e-01f },
+        { 1.007333639e+00f, -1.751635198e+00f, 8.179038456e-01f, -1.751635198e+00f, 8.252374849e-01f },
+        { 7.169229344e-01f, -1.124486757e+00f, 6.186464437e-01f, -1.124486757e+00f, 3.355693781e-01f },
+        { 8.129328742e-01f, -5.605930901e-01f, 5.289372987e-01f, -5.605930901e-01f, 3.418701729e-01f },
+        { 9.383836099e-01f, 9.917844707e-01f, 5.852435300e-01f, 9.917844707e-01f, 5.236271398e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 84 % */
+        { 1.001674336e+00f, -1.995126307e+00f, 9.935298147e-01f, -1.995126307e+00f, 9.952041504e-01f },
+        { 1.004394475e+00f, -1.990858476e+00f, 9.867747376e-01f, -1.990858476e+00f, 9.911692125e-01f },
+        { 1.008818862e+00f, -1.981020981e+00f, 9.734594548e-01f, -1.981020981e+00f, 9.822783166e-01f },
+        { 1.015055640e+00f, -1.958286001e+00f, 9.482098862e-01f, -1.958286001e+00f, 9.632655261e-01f },
+        { 1.025975528e+00f, -1.906086357e+00f, 8.996219984e-01f, -1.906086357e+00f, 9.255975260e-01f },
+        { 1.006282356e+00f, -1.750752018e+00f, 8.180348383e-01f, -1.750752018e+00f, 8.243171944e-01f },
+        { 7.136152669e-01f, -1.120177577e+00f, 6.168360353e-01f, -1.120177577e+00f, 3.304513022e-01f },
+        { 8.105779523e-01f, -5.595301437e-01f, 5.287478866e-01f, -5.595301437e-01f, 3.393258389e-01f },
+        { 9.337869805e-01f, 9.890565845e-01f, 5.856494490e-01f, 9.890565845e-01f, 5.194364295e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 85 % */
+        { 1.001637095e+00f, -1.995098688e+00f, 9.935394352e-01f, -1.995098688e+00f, 9.951765305e-01f },
+        { 1.004394475e+00f, -1.990858476e+00f, 9.867747376e-01f, -1.990858476e+00f, 9.911692125e-01f },
+        { 1.008818862e+00f, -1.981020981e+00f, 9.734594548e-01f, -1.981020981e+00f, 9.822783166e-01f },
+        { 1.014457294e+00f, -1.957869596e+00f, 9.483907686e-01f, -1.957869596e+00f, 9.628480625e-01f },
+        { 1.025392679e+00f, -1.905677084e+00f, 8.997913845e-01f, -1.905677084e+00f, 9.251840636e-01f },
+        { 1.005232325e+00f, -1.749864638e+00f, 8.181602013e-01f, -1.749864638e+00f, 8.233925266e-01f },
+        { 7.103078442e-01f, -1.115851972e+00f, 6.150058738e-01f, -1.115851972e+00f, 3.253137180e-01f },
+        { 8.082277742e-01f, -5.584651190e-01f, 5.285487559e-01f, -5.584651190e-01f, 3.367765301e-01f },
+        { 9.292090638e-01f, 9.863123362e-01f, 5.860115191e-01f, 9.863123362e-01f, 5.152205829e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 86 % */
+        { 1.001599910e+00f, -1.995070911e+00f, 9.935488419e-01f, -1.995070911e+00f, 9.951487518e-01f },
+        { 1.004394475e+00f, -1.990858476e+00f, 9.867747376e-01f, -1.990858476e+00f, 9.911692125e-01f },
+        { 1.008818862e+00f, -1.981020981e+00f, 9.734594548e-01f, -1.981020981e+00f, 9.822783166e-01f },
+        { 1.013861084e+00f, -1.957448550e+00f, 9.485648613e-01f, -1.957448550e+00f, 9.624259455e-01f },
+        { 1.024810891e+00f, -1.905265625e+00f, 8.999575021e-01f, -1.905265625e+00f, 9.247683934e-01f },
+        { 1.004183520e+00f, -1.748973041e+00f, 8.182799461e-01f, -1.748973041e+00f, 8.224634657e-01f },
+        { 7.070006669e-01f, -1.111510136e+00f, 6.131561890e-01f, -1.111510136e+00f, 3.201568559e-01f },
+        { 8.058823122e-01f, -5.573980276e-01f, 5.283399622e-01f, -5.573980276e-01f, 3.342222744e-01f },
+        { 9.246495375e-01f, 9.835517616e-01f, 5.863301175e-01f, 9.835517616e-01f, 5.109796550e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 87 % */
+        { 1.001562778e+00f, -1.995042974e+00f, 9.935580351e-01f, -1.995042974e+00f, 9.951208136e-01f },
+        { 1.004394475e+00f, -1.990858476e+00f, 9.867747376e-01f, -1.990858476e+00f, 9.911692125e-01f },
+        { 1.008818862e+00f, -1.981020981e+00f, 9.734594548e-01f, -1.981020981e+00f, 9.822783166e-01f },
+        { 1.013266935e+00f, -1.957022812e+00f, 9.487321906e-01f, -1.957022812e+00f, 9.619991253e-01f },
+        { 1.024230147e+00f, -1.904851971e+00f, 9.001203580e-01f, -1.904851971e+00f, 9.243505046e-01f },
+        { 1.003135911e+00f, -1.748077213e+00f, 8.183940844e-01f, -1.748077213e+00f, 8.215299957e-01f },
+        { 7.036937391e-01f, -1.107152267e+00f, 6.112872120e-01f, -1.107152267e+00f, 3.149809511e-01f },
+        { 8.035415391e-01f, -5.563288813e-01f, 5.281215606e-01f, -5.563288813e-01f, 3.316630997e-01f },
+        { 9.201080855e-01f, 9.807748992e-01f, 5.866056195e-01f, 9.807748992e-01f, 5.067137050e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 88 % */
+        { 1.001525700e+00f, -1.995014876e+00f, 9.935670151e-01f, -1.995014876e+00f, 9.950927148e-01f },
+        { 1.004394475e+00f, -1.990858476e+00f, 9.867747376e-01f, -1.990858476e+00f, 9.911692125e-01f },
+        { 1.008818862e+00f, -1.981020981e+00f, 9.734594548e-01f, -1.981020981e+00f, 9.822783166e-01f },
+        { 1.012674770e+00f, -1.956592333e+00f, 9.488927818e-01f, -1.956592333e+00f, 9.615675517e-01f },
+        { 1.023650427e+00f, -1.904436109e+00f, 9.002799592e-01f, -1.904436109e+00f, 9.239303862e-01f },
+        { 1.002089473e+00f, -1.747177138e+00f, 8.185026273e-01f, -1.747177138e+00f, 8.205921008e-01f },
+        { 7.003870682e-01f, -1.102778566e+00f, 6.093991746e-01f, -1.102778566e+00f, 3.097862428e-01f },
+        { 8.012054281e-01f, -5.552576917e-01f, 5.278936063e-01f, -5.552576917e-01f, 3.290990344e-01f },
+        { 9.155843973e-01f, 9.779817900e-01f, 5.868383987e-01f, 9.779817900e-01f, 5.024227960e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 89 % */
+        { 1.001488672e+00f, -1.994986617e+00f, 9.935757822e-01f, -1.994986617e+00f, 9.950644547e-01f },
+        { 1.004394475e+00f, -1.990858476e+00f, 9.867747376e-01f, -1.990858476e+00f, 9.911692125e-01f },
+        { 1.008818862e+00f, -1.981020981e+00f, 9.734594548e-01f, -1.981020981e+00f, 9.822783166e-01f },
+        { 1.012084514e+00f, -1.956157062e+00f, 9.490466594e-01f, -1.956157062e+00f, 9.611311737e-01f },
+        { 1.023071715e+00f, -1.904018030e+00f, 9.004363125e-01f, -1.904018030e+00f, 9.235080274e-01f },
+        { 1.001044179e+00f, -1.746272802e+00f, 8.186055864e-01f, -1.746272802e+00f, 8.196497650e-01f },
+        { 6.970806649e-01f, -1.098389239e+00f, 6.074923095e-01f, -1.098389239e+00f, 3.045729744e-01f },
+        { 7.988739525e-01f, -5.541844709e-01f, 5.276561545e-01f, -5.541844709e-01f, 3.265301070e-01f },
+        { 9.110781681e-01f, 9.751724778e-01f, 5.870288269e-01f, 9.751724778e-01f, 4.981069951e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 90 % */
+        { 1.001451695e+00f, -1.994958196e+00f, 9.935843367e-01f, -1.994958196e+00f, 9.950360322e-01f },
+        { 1.004394475e+00f, -1.990858476e+00f, 9.867747376e-01f, -1.990858476e+00f, 9.911692125e-01f },
+        { 1.008818862e+00f, -1.981020981e+00f, 9.734594548e-01f, -1.981020981e+00f, 9.822783166e-01f },
+        { 1.011496093e+00f, -1.955716948e+00f, 9.491938471e-01f, -1.955716948e+00f, 9.606899402e-01f },
+        { 1.022493993e+00f, -1.903597722e+00f, 9.005894245e-01f, -1.903597722e+00f, 9.230834173e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 6.937745430e-01f, -1.093984493e+00f, 6.055668506e-01f, -1.093984493e+00f, 2.993413936e-01f },
+        { 7.965470862e-01f, -5.531092310e-01f, 5.274092601e-01f, -5.531092310e-01f, 3.239563464e-01f },
+        { 9.065890991e-01f, 9.723470089e-01f, 5.871772745e-01f, 9.723470089e-01f, 4.937663736e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 91 % */
+        { 1.001414768e+00f, -1.994929611e+00f, 9.935926789e-01f, -1.994929611e+00f, 9.950074464e-01f },
+        { 1.004318307e+00f, -1.990807729e+00f, 9.868001517e-01f, -1.990807729e+00f, 9.911184582e-01f },
+        { 1.008665784e+00f, -1.980919648e+00f, 9.735111358e-01f, -1.980919648e+00f, 9.821769199e-01f },
+        { 1.011202547e+00f, -1.955495058e+00f, 9.492649394e-01f, -1.955495058e+00f, 9.604674865e-01f },
+        { 1.021917243e+00f, -1.903175175e+00f, 9.007393021e-01f, -1.903175175e+00f, 9.226565450e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 6.921215929e-01f, -1.091776405e+00f, 6.045972218e-01f, -1.091776405e+00f, 2.967188147e-01f },
+        { 7.942248034e-01f, -5.520319840e-01f, 5.271529782e-01f, -5.520319840e-01f, 3.213777816e-01f },
+        { 9.043509078e-01f, 9.709282310e-01f, 5.872358707e-01f, 9.709282310e-01f, 4.915867785e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 92 % */
+        { 1.001377887e+00f, -1.994900862e+00f, 9.936008091e-01f, -1.994900862e+00f, 9.949786965e-01f },
+        { 1.004242284e+00f, -1.990756693e+00f, 9.868251291e-01f, -1.990756693e+00f, 9.910674136e-01f },
+        { 1.008513007e+00f, -1.980817742e+00f, 9.735619416e-01f, -1.980817742e+00f, 9.820749484e-01f },
+        { 1.010909432e+00f, -1.955271938e+00f, 9.493343677e-01f, -1.955271938e+00f, 9.602437995e-01f },
+        { 1.021341448e+00f, -1.902750378e+00f, 9.008859516e-01f, -1.902750378e+00f, 9.222273994e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 6.904687198e-01f, -1.089564542e+00f, 6.036230326e-01f, -1.089564542e+00f, 2.940917524e-01f },
+        { 7.919070786e-01f, -5.509527423e-01f, 5.268873636e-01f, -5.509527423e-01f, 3.187944421e-01f },
+        { 9.021168970e-01f, 9.695054326e-01f, 5.872841099e-01f, 9.695054326e-01f, 4.894010069e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 93 % */
+        { 1.001341054e+00f, -1.994871948e+00f, 9.936087275e-01f, -1.994871948e+00f, 9.949497814e-01f },
+        { 1.004166406e+00f, -1.990705364e+00f, 9.868496705e-01f, -1.990705364e+00f, 9.910160768e-01f },
+        { 1.008360525e+00f, -1.980715257e+00f, 9.736118740e-01f, -1.980715257e+00f, 9.819723987e-01f },
+        { 1.010616738e+00f, -1.955047582e+00f, 9.494021348e-01f, -1.955047582e+00f, 9.600188726e-01f },
+        { 1.020766590e+00f, -1.902323320e+00f, 9.010293796e-01f, -1.902323320e+00f, 9.217959696e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 6.888159264e-01f, -1.087348931e+00f, 6.026443125e-01f, -1.087348931e+00f, 2.914602389e-01f },
+        { 7.895938865e-01f, -5.498715182e-01f, 5.266124710e-01f, -5.498715182e-01f, 3.162063575e-01f },
+        { 8.998870310e-01f, 9.680786201e-01f, 5.873220378e-01f, 9.680786201e-01f, 4.872090688e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 94 % */
+        { 1.001304266e+00f, -1.994842868e+00f, 9.936164344e-01f, -1.994842868e+00f, 9.949207002e-01f },
+        { 1.004090669e+00f, -1.990653741e+00f, 9.868737769e-01f, -1.990653741e+00f, 9.909644464e-01f },
+        { 1.008208333e+00f, -1.980612191e+00f, 9.736609347e-01f, -1.980612191e+00f, 9.818692677e-01f },
+        { 1.010324456e+00f, -1.954821982e+00f, 9.494682434e-01f, -1.954821982e+00f, 9.597926992e-01f },
+        { 1.020192652e+00f, -1.901893989e+00f, 9.011695924e-01f, -1.901893989e+00f, 9.213622444e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 6.871632155e-01f, -1.085129600e+00f, 6.016610912e-01f, -1.085129600e+00f, 2.888243066e-01f },
+        { 7.872852024e-01f, -5.487883243e-01f, 5.263283553e-01f, -5.487883243e-01f, 3.136135578e-01f },
+        { 8.976612743e-01f, 9.666478005e-01f, 5.873497003e-01f, 9.666478005e-01f, 4.850109746e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 95 % */
+        { 1.001267522e+00f, -1.994813621e+00f, 9.936239301e-01f, -1.994813621e+00f, 9.948914520e-01f },
+        { 1.004015071e+00f, -1.990601824e+00f, 9.868974491e-01f, -1.990601824e+00f, 9.909125206e-01f },
+        { 1.008056427e+00f, -1.980508542e+00f, 9.737091255e-01f, -1.980508542e+00f, 9.817655521e-01f },
+        { 1.010032577e+00f, -1.954595133e+00f, 9.495326961e-01f, -1.954595133e+00f, 9.595652728e-01f },
+        { 1.019619616e+00f, -1.901462375e+00f, 9.013065962e-01f, -1.901462375e+00f, 9.209262126e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 6.855105901e-01f, -1.082906575e+00f, 6.006733981e-01f, -1.082906575e+00f, 2.861839882e-01f },
+        { 7.849810018e-01f, -5.477031731e-01f, 5.260350711e-01f, -5.477031731e-01f, 3.110160730e-01f },
+        { 8.954395919e-01f, 9.652129804e-01f, 5.873671430e-01f, 9.652129804e-01f, 4.828067349e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 96 % */
+        { 1.001230821e+00f, -1.994784206e+00f, 9.936312149e-01f, -1.994784206e+00f, 9.948620358e-01f },
+        { 1.003939610e+00f, -1.990549609e+00f, 9.869206878e-01f, -1.990549609e+00f, 9.908602977e-01f },
+        { 1.007904801e+00f, -1.980404304e+00f, 9.737564480e-01f, -1.980404304e+00f, 9.816612487e-01f },
+        { 1.009741091e+00f, -1.954367027e+00f, 9.495954954e-01f, -1.954367027e+00f, 9.593365866e-01f },
+        { 1.019047466e+00f, -1.901028468e+00f, 9.014403974e-01f, -1.901028468e+00f, 9.204878632e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 6.838580535e-01f, -1.080679886e+00f, 5.996812630e-01f, -1.080679886e+00f, 2.835393166e-01f },
+        { 7.826812606e-01f, -5.466160773e-01f, 5.257326730e-01f, -5.466160773e-01f, 3.084139336e-01f },
+        { 8.932219491e-01f, 9.637741671e-01f, 5.873744114e-01f, 9.637741671e-01f, 4.805963605e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 97 % */
+        { 1.001194162e+00f, -1.994754622e+00f, 9.936382889e-01f, -1.994754622e+00f, 9.948324506e-01f },
+        { 1.003864282e+00f, -1.990497096e+00f, 9.869434939e-01f, -1.990497096e+00f, 9.908077762e-01f },
+        { 1.007753450e+00f, -1.980299476e+00f, 9.738029038e-01f, -1.980299476e+00f, 9.815563543e-01f },
+        { 1.009449990e+00f, -1.954137657e+00f, 9.496566439e-01f, -1.954137657e+00f, 9.591066341e-01f },
+        { 1.018476183e+00f, -1.900592255e+00f, 9.015710019e-01f, -1.900592255e+00f, 9.200471850e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 6.822056092e-01f, -1.078449559e+00f, 5.986847156e-01f, -1.078449559e+00f, 2.808903248e-01f },
+        { 7.803859549e-01f, -5.455270499e-01f, 5.254212155e-01f, -5.455270499e-01f, 3.058071704e-01f },
+        { 8.910083115e-01f, 9.623313678e-01f, 5.873715511e-01f, 9.623313678e-01f, 4.783798626e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 98 % */
+        { 1.001157543e+00f, -1.994724868e+00f, 9.936451525e-01f, -1.994724868e+00f, 9.948026955e-01f },
+        { 1.003789086e+00f, -1.990444282e+00f, 9.869658682e-01f, -1.990444282e+00f, 9.907549542e-01f },
+        { 1.007602371e+00f, -1.980194054e+00f, 9.738484947e-01f, -1.980194054e+00f, 9.814508655e-01f },
+        { 1.009159264e+00f, -1.953907018e+00f, 9.497161441e-01f, -1.953907018e+00f, 9.588754084e-01f },
+        { 1.017905751e+00f, -1.900153725e+00f, 9.016984158e-01f, -1.900153725e+00f, 9.196041666e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 6.805532606e-01f, -1.076215623e+00f, 5.976837857e-01f, -1.076215623e+00f, 2.782370463e-01f },
+        { 7.780950613e-01f, -5.444361037e-01f, 5.251007530e-01f, -5.444361037e-01f, 3.031958143e-01f },
+        { 8.887986452e-01f, 9.608845899e-01f, 5.873586074e-01f, 9.608845899e-01f, 4.761572525e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 99 % */
+        { 1.001120964e+00f, -1.994694943e+00f, 9.936518058e-01f, -1.994694943e+00f, 9.947727696e-01f },
+        { 1.003714019e+00f, -1.990391166e+00f, 9.869878113e-01f, -1.990391166e+00f, 9.907018301e-01f },
+        { 1.007451557e+00f, -1.980088035e+00f, 9.738932223e-01f, -1.980088035e+00f, 9.813447790e-01f },
+        { 1.008868905e+00f, -1.953675102e+00f, 9.497739985e-01f, -1.953675102e+00f, 9.586429030e-01f },
+        { 1.017336152e+00f, -1.899712868e+00f, 9.018226450e-01f, -1.899712868e+00f, 9.191587968e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 6.789010117e-01f, -1.073978106e+00f, 5.966785031e-01f, -1.073978106e+00f, 2.755795148e-01f },
+        { 7.758085566e-01f, -5.433432517e-01f, 5.247713399e-01f, -5.433432517e-01f, 3.005798965e-01f },
+        { 8.865929164e-01f, 9.594338409e-01f, 5.873356256e-01f, 9.594338409e-01f, 4.739285420e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+    { { /* 100 % */
+        { 1.001084423e+00f, -1.994664847e+00f, 9.936582492e-01f, -1.994664847e+00f, 9.947426718e-01f },
+        { 1.003639078e+00f, -1.990337747e+00f, 9.870093241e-01f, -1.990337747e+00f, 9.906484021e-01f },
+        { 1.007301004e+00f, -1.979981416e+00f, 9.739370880e-01f, -1.979981416e+00f, 9.812380916e-01f },
+        { 1.008578902e+00f, -1.953441903e+00f, 9.498302093e-01f, -1.953441903e+00f, 9.584091109e-01f },
+        { 1.016767369e+00f, -1.899269672e+00f, 9.019436953e-01f, -1.899269672e+00f, 9.187110643e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 6.772488664e-01f, -1.071737037e+00f, 5.956688977e-01f, -1.071737037e+00f, 2.729177641e-01f },
+        { 7.735264180e-01f, -5.422485072e-01f, 5.244330306e-01f, -5.422485072e-01f, 2.979594485e-01f },
+        { 8.843910918e-01f, 9.579791287e-01f, 5.873026511e-01f, 9.579791287e-01f, 4.716937429e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+    } },
+};
+
+static const loudness_coefs_t s_loudness_44100[LOUDNESS_STEPS] = {
+    { { /* 0 % */
+        { 1.001902749e+00f, -1.998220560e+00f, 9.963373016e-01f, -1.998220560e+00f, 9.982400509e-01f },
+        { 1.003802116e+00f, -1.996405338e+00f, 9.926811149e-01f, -1.996405338e+00f, 9.964832307e-01f },
+        { 1.007651580e+00f, -1.992606619e+00f, 9.852710861e-01f, -1.992606619e+00f, 9.929226663e-01f },
+        { 1.013575977e+00f, -1.983808971e+00f, 9.714920996e-01f, -1.983808971e+00f, 9.850680768e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.028317887e+00f, -1.907701805e+00f, 8.989116240e-01f, -1.907701805e+00f, 9.272295107e-01f },
+        { 8.970407796e-01f, -1.630343653e+00f, 8.018085879e-01f, -1.630343653e+00f, 6.988493675e-01f },
+        { 9.458919485e-01f, -1.371933675e+00f, 6.835737561e-01f, -1.371933675e+00f, 6.294657046e-01f },
+        { 1.057762811e+00f, -6.491421410e-01f, 4.960638281e-01f, -6.491421410e-01f, 5.538266388e-01f },
+        { 1.159312088e+00f, 1.093481549e+00f, 5.205470080e-01f, 1.093481549e+00f, 6.798590964e-01f },
+    } },
+    { { /* 1 % */
+        { 1.001894317e+00f, -1.998216507e+00f, 9.963416805e-01f, -1.998216507e+00f, 9.982359974e-01f },
+        { 1.003785258e+00f, -1.996397245e+00f, 9.926898798e-01f, -1.996397245e+00f, 9.964751380e-01f },
+        { 1.007617624e+00f, -1.992590365e+00f, 9.852887855e-01f, -1.992590365e+00f, 9.929064093e-01f },
+        { 1.013543049e+00f, -1.983791910e+00f, 9.715079557e-01f, -1.983791910e+00f, 9.850510044e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.028200341e+00f, -1.907621849e+00f, 8.989483947e-01f, -1.907621849e+00f, 9.271487359e-01f },
+        { 8.966200381e-01f, -1.629777938e+00f, 8.016398431e-01f, -1.629777938e+00f, 6.982598812e-01f },
+        { 9.455392364e-01f, -1.371640940e+00f, 6.835787826e-01f, -1.371640940e+00f, 6.291180190e-01f },
+        { 1.057167979e+00f, -6.489753634e-01f, 4.962594503e-01f, -6.489753634e-01f, 5.534274298e-01f },
+        { 1.158150171e+00f, 1.093078202e+00f, 5.210892853e-01f, 1.093078202e+00f, 6.792394562e-01f },
+    } },
+    { { /* 2 % */
+        { 1.001885894e+00f, -1.998212444e+00f, 9.963460401e-01f, -1.998212444e+00f, 9.982319345e-01f },
+        { 1.003768421e+00f, -1.996389134e+00f, 9.926986060e-01f, -1.996389134e+00f, 9.964670267e-01f },
+        { 1.007583708e+00f, -1.992574073e+00f, 9.853064068e-01f, -1.992574073e+00f, 9.928901150e-01f },
+        { 1.013510139e+00f, -1.983774829e+00f, 9.715237740e-01f, -1.983774829e+00f, 9.850339127e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.028082842e+00f, -1.907541807e+00f, 8.989850332e-01f, -1.907541807e+00f, 9.270678747e-01f },
+        { 8.961991236e-01f, -1.629211312e+00f, 8.014703228e-01f, -1.629211312e+00f, 6.976694463e-01f },
+        { 9.451866160e-01f, -1.371347993e+00f, 6.835834655e-01f, -1.371347993e+00f, 6.287700815e-01f },
+        { 1.056573513e+00f, -6.488084796e-01f, 4.964544535e-01f, -6.488084796e-01f, 5.530279663e-01f },
+        { 1.156989815e+00f, 1.092674225e+00f, 5.216290310e-01f, 1.092674225e+00f, 6.786188462e-01f },
+    } },
+    { { /* 3 % */
+        { 1.001877482e+00f, -1.998208372e+00f, 9.963503803e-01f, -1.998208372e+00f, 9.982278623e-01f },
+        { 1.003751603e+00f, -1.996381005e+00f, 9.927072934e-01f, -1.996381005e+00f, 9.964588968e-01f },
+        { 1.007549833e+00f, -1.992557744e+00f, 9.853239503e-01f, -1.992557744e+00f, 9.928737834e-01f },
+        { 1.013477247e+00f, -1.983757729e+00f, 9.715395546e-01f, -1.983757729e+00f, 9.850168016e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.027965388e+00f, -1.907461680e+00f, 8.990215397e-01f, -1.907461680e+00f, 9.269869272e-01f },
+        { 8.957780349e-01f, -1.628643775e+00f, 8.013000273e-01f, -1.628643775e+00f, 6.970780622e-01f },
+        { 9.448340872e-01f, -1.371054834e+00f, 6.835878048e-01f, -1.371054834e+00f, 6.284218920e-01f },
+        { 1.055979410e+00f, -6.486414895e-01f, 4.966488381e-01f, -6.486414895e-01f, 5.526282485e-01f },
+        { 1.155831016e+00f, 1.092269615e+00f, 5.221662496e-01f, 1.092269615e+00f, 6.779972656e-01f },
+    } },
+    { { /* 4 % */
+        { 1.001869080e+00f, -1.998204290e+00f, 9.963547011e-01f, -1.998204290e+00f, 9.982237807e-01f },
+        { 1.003734806e+00f, -1.996372856e+00f, 9.927159422e-01f, -1.996372856e+00f, 9.964507482e-01f },
+        { 1.007515998e+00f, -1.992541378e+00f, 9.853414160e-01f, -1.992541378e+00f, 9.928574144e-01f },
+        { 1.013444374e+00f, -1.983740609e+00f, 9.715552975e-01f, -1.983740609e+00f, 9.849996711e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.027847979e+00f, -1.907381467e+00f, 8.990579141e-01f, -1.907381467e+00f, 9.269058933e-01f },
+        { 8.953567712e-01f, -1.628075327e+00f, 8.011289569e-01f, -1.628075327e+00f, 6.964857281e-01f },
+        { 9.444816496e-01f, -1.370761463e+00f, 6.835918009e-01f, -1.370761463e+00f, 6.280734506e-01f },
+        { 1.055385671e+00f, -6.484743931e-01f, 4.968426049e-01f, -6.484743931e-01f, 5.522282762e-01f },
+        { 1.154673769e+00f, 1.091864374e+00f, 5.227009453e-01f, 1.091864374e+00f, 6.773747138e-01f },
+    } },
+    { { /* 5 % */
+        { 1.001860687e+00f, -1.998200199e+00f, 9.963590026e-01f, -1.998200199e+00f, 9.982196898e-01f },
+        { 1.003718028e+00f, -1.996364689e+00f, 9.927245524e-01f, -1.996364689e+00f, 9.964425809e-01f },
+        { 1.007482204e+00f, -1.992524974e+00f, 9.853588039e-01f, -1.992524974e+00f, 9.928410080e-01f },
+        { 1.013411518e+00f, -1.983723470e+00f, 9.715710027e-01f, -1.983723470e+00f, 9.849825211e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.027730616e+00f, -1.907301168e+00f, 8.990941566e-01f, -1.907301168e+00f, 9.268247729e-01f },
+        { 8.949353313e-01f, -1.627505966e+00f, 8.009571120e-01f, -1.627505966e+00f, 6.958924434e-01f },
+        { 9.441293031e-01f, -1.370467879e+00f, 6.835954540e-01f, -1.370467879e+00f, 6.277247570e-01f },
+        { 1.054792295e+00f, -6.483071904e-01f, 4.970357544e-01f, -6.483071904e-01f, 5.518280496e-01f },
+        { 1.153518068e+00f, 1.091458499e+00f, 5.232331222e-01f, 1.091458499e+00f, 6.767511904e-01f },
+    } },
+    { { /* 6 % */
+        { 1.001852305e+00f, -1.998196099e+00f, 9.963632848e-01f, -1.998196099e+00f, 9.982155894e-01f },
+        { 1.003701271e+00f, -1.996356504e+00f, 9.927331240e-01f, -1.996356504e+00f, 9.964343948e-01f },
+        { 1.007448450e+00f, -1.992508533e+00f, 9.853761142e-01f, -1.992508533e+00f, 9.928245640e-01f },
+        { 1.013378682e+00f, -1.983706312e+00f, 9.715866702e-01f, -1.983706312e+00f, 9.849653517e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.027613299e+00f, -1.907220784e+00f, 8.991302672e-01f, -1.907220784e+00f, 9.267435658e-01f },
+        { 8.945137143e-01f, -1.626935692e+00f, 8.007844929e-01f, -1.626935692e+00f, 6.952982072e-01f },
+        { 9.437770472e-01f, -1.370174083e+00f, 6.835987642e-01f, -1.370174083e+00f, 6.273758114e-01f },
+        { 1.054199282e+00f, -6.481398815e-01f, 4.972282870e-01f, -6.481398815e-01f, 5.514275686e-01f },
+        { 1.152363910e+00f, 1.091051992e+00f, 5.237627848e-01f, 1.091051992e+00f, 6.761266945e-01f },
+    } },
+    { { /* 7 % */
+        { 1.001843932e+00f, -1.998191989e+00f, 9.963675477e-01f, -1.998191989e+00f, 9.982114796e-01f },
+        { 1.003684533e+00f, -1.996348299e+00f, 9.927416571e-01f, -1.996348299e+00f, 9.964261899e-01f },
+        { 1.007414736e+00f, -1.992492054e+00f, 9.853933469e-01f, -1.992492054e+00f, 9.928080824e-01f },
+        { 1.013345863e+00f, -1.983689134e+00f, 9.716023000e-01f, -1.983689134e+00f, 9.849481628e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.027496026e+00f, -1.907140314e+00f, 8.991662459e-01f, -1.907140314e+00f, 9.266622721e-01f },
+        { 8.940919191e-01f, -1.626364505e+00f, 8.006110998e-01f, -1.626364505e+00f, 6.947030188e-01f },
+        { 9.434248818e-01f, -1.369880075e+00f, 6.836017319e-01f, -1.369880075e+00f, 6.270266137e-01f },
+        { 1.053606630e+00f, -6.479724663e-01f, 4.974202035e-01f, -6.479724663e-01f, 5.510268333e-01f },
+        { 1.151211288e+00f, 1.090644852e+00f, 5.242899373e-01f, 1.090644852e+00f, 6.755012256e-01f },
+    } },
+    { { /* 8 % */
+        { 1.001835569e+00f, -1.998187870e+00f, 9.963717914e-01f, -1.998187870e+00f, 9.982073603e-01f },
+        { 1.003667815e+00f, -1.996340076e+00f, 9.927501516e-01f, -1.996340076e+00f, 9.964179662e-01f },
+        { 1.007381061e+00f, -1.992475537e+00f, 9.854105022e-01f, -1.992475537e+00f, 9.927915631e-01f },
+        { 1.013313062e+00f, -1.983671936e+00f, 9.716178923e-01f, -1.983671936e+00f, 9.849309544e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.027378799e+00f, -1.907059758e+00f, 8.992020928e-01f, -1.907059758e+00f, 9.265808916e-01f },
+        { 8.936699446e-01f, -1.625792403e+00f, 8.004369331e-01f, -1.625792403e+00f, 6.941068777e-01f },
+        { 9.430728066e-01f, -1.369585855e+00f, 6.836043572e-01f, -1.369585855e+00f, 6.266771638e-01f },
+        { 1.053014339e+00f, -6.478049448e-01f, 4.976115043e-01f, -6.478049448e-01f, 5.506258437e-01f },
+        { 1.150060199e+00f, 1.090237078e+00f, 5.248145839e-01f, 1.090237078e+00f, 6.748747832e-01f },
+    } },
+    { { /* 9 % */
+        { 1.001827216e+00f, -1.998183741e+00f, 9.963760158e-01f, -1.998183741e+00f, 9.982032316e-01f },
+        { 1.003651116e+00f, -1.996331833e+00f, 9.927586078e-01f, -1.996331833e+00f, 9.964097236e-01f },
+        { 1.007347426e+00f, -1.992458982e+00f, 9.854275801e-01f, -1.992458982e+00f, 9.927750060e-01f },
+        { 1.013280280e+00f, -1.983654719e+00f, 9.716334469e-01f, -1.983654719e+00f, 9.849137265e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.027261616e+00f, -1.906979116e+00f, 8.992378081e-01f, -1.906979116e+00f, 9.264994242e-01f },
+        { 8.932477899e-01f, -1.625219386e+00f, 8.002619931e-01f, -1.625219386e+00f, 6.935097830e-01f },
+        { 9.427208214e-01f, -1.369291422e+00f, 6.836066403e-01f, -1.369291422e+00f, 6.263274617e-01f },
+        { 1.052422410e+00f, -6.476373172e-01f, 4.978021900e-01f, -6.476373172e-01f, 5.502245998e-01f },
+        { 1.148910638e+00f, 1.089828669e+00f, 5.253367288e-01f, 1.089828669e+00f, 6.742473665e-01f },
+    } },
+    { { /* 10 % */
+        { 1.001818872e+00f, -1.998179603e+00f, 9.963802210e-01f, -1.998179603e+00f, 9.981990933e-01f },
+        { 1.003634436e+00f, -1.996323572e+00f, 9.927670255e-01f, -1.996323572e+00f, 9.964014620e-01f },
+        { 1.007313830e+00f, -1.992442390e+00f, 9.854445808e-01f, -1.992442390e+00f, 9.927584109e-01f },
+        { 1.013247515e+00f, -1.983637482e+00f, 9.716489639e-01f, -1.983637482e+00f, 9.848964790e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.027144478e+00f, -1.906898388e+00f, 8.992733916e-01f, -1.906898388e+00f, 9.264178699e-01f },
+        { 8.928254539e-01f, -1.624645453e+00f, 8.000862802e-01f, -1.624645453e+00f, 6.929117341e-01f },
+        { 9.423689258e-01f, -1.368996777e+00f, 6.836085815e-01f, -1.368996777e+00f, 6.259775073e-01f },
+        { 1.051830841e+00f, -6.474695833e-01f, 4.979922611e-01f, -6.474695833e-01f, 5.498231016e-01f },
+        { 1.147762599e+00f, 1.089419626e+00f, 5.258563763e-01f, 1.089419626e+00f, 6.736189749e-01f },
+    } },
+    { { /* 11 % */
+        { 1.001810538e+00f, -1.998175455e+00f, 9.963844071e-01f, -1.998175455e+00f, 9.981949455e-01f },
+        { 1.003617777e+00f, -1.996315292e+00f, 9.927754049e-01f, -1.996315292e+00f, 9.963931815e-01f },
+        { 1.007280274e+00f, -1.992425760e+00f, 9.854615043e-01f, -1.992425760e+00f, 9.927417779e-01f },
+        { 1.013214769e+00f, -1.983620226e+00f, 9.716644434e-01f, -1.983620226e+00f, 9.848792119e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.027027385e+00f, -1.906817574e+00f, 8.993088436e-01f, -1.906817574e+00f, 9.263362286e-01f },
+        { 8.924029356e-01f, -1.624070604e+00f, 7.999097946e-01f, -1.624070604e+00f, 6.923127302e-01f },
+        { 9.420171196e-01f, -1.368701919e+00f, 6.836101810e-01f, -1.368701919e+00f, 6.256273006e-01f },
+        { 1.051239631e+00f, -6.473017432e-01f, 4.981817183e-01f, -6.473017432e-01f, 5.494213493e-01f },
+        { 1.146616077e+00f, 1.089009948e+00f, 5.263735306e-01f, 1.089009948e+00f, 6.729896080e-01f },
+    } },
+    { { /* 12 % */
+        { 1.001802214e+00f, -1.998171298e+00f, 9.963885739e-01f, -1.998171298e+00f, 9.981907882e-01f },
+        { 1.003601136e+00f, -1.996306993e+00f, 9.927837460e-01f, -1.996306993e+00f, 9.963848819e-01f },
+        { 1.007246756e+00f, -1.992409091e+00f, 9.854783507e-01f, -1.992409091e+00f, 9.927251069e-01f },
+        { 1.013182040e+00f, -1.983602951e+00f, 9.716798853e-01f, -1.983602951e+00f, 9.848619253e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.026910336e+00f, -1.906736674e+00f, 8.993441640e-01f, -1.906736674e+00f, 9.262545001e-01f },
+        { 8.919802340e-01f, -1.623494838e+00f, 7.997325366e-01f, -1.623494838e+00f, 6.917127707e-01f },
+        { 9.416654026e-01f, -1.368406849e+00f, 6.836114390e-01f, -1.368406849e+00f, 6.252768416e-01f },
+        { 1.050648781e+00f, -6.471337969e-01f, 4.983705621e-01f, -6.471337969e-01f, 5.490193427e-01f },
+        { 1.145471069e+00f, 1.088599635e+00f, 5.268881959e-01f, 1.088599635e+00f, 6.723592650e-01f },
+    } },
+    { { /* 13 % */
+        { 1.001793900e+00f, -1.998167131e+00f, 9.963927216e-01f, -1.998167131e+00f, 9.981866213e-01f },
+        { 1.003584514e+00f, -1.996298674e+00f, 9.927920488e-01f, -1.996298674e+00f, 9.963765633e-01f },
+        { 1.007213278e+00f, -1.992392385e+00f, 9.854951201e-01f, -1.992392385e+00f, 9.927083976e-01f },
+        { 1.013149329e+00f, -1.983585655e+00f, 9.716952898e-01f, -1.983585655e+00f, 9.848446191e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.026793332e+00f, -1.906655687e+00f, 8.993793529e-01f, -1.906655687e+00f, 9.261726844e-01f },
+        { 8.915573482e-01f, -1.622918154e+00f, 7.995545066e-01f, -1.622918154e+00f, 6.911118548e-01f },
+        { 9.413137744e-01f, -1.368111566e+00f, 6.836123558e-01f, -1.368111566e+00f, 6.249261302e-01f },
+        { 1.050058289e+00f, -6.469657444e-01f, 4.985587930e-01f, -6.469657444e-01f, 5.486170819e-01f },
+        { 1.144327569e+00f, 1.088188686e+00f, 5.274003763e-01f, 1.088188686e+00f, 6.717279454e-01f },
+    } },
+    { { /* 14 % */
+        { 1.001785595e+00f, -1.998162955e+00f, 9.963968502e-01f, -1.998162955e+00f, 9.981824449e-01f },
+        { 1.003567912e+00f, -1.996290337e+00f, 9.928003135e-01f, -1.996290337e+00f, 9.963682256e-01f },
+        { 1.007179838e+00f, -1.992375640e+00f, 9.855118126e-01f, -1.992375640e+00f, 9.926916502e-01f },
+        { 1.013116637e+00f, -1.983568341e+00f, 9.717106567e-01f, -1.983568341e+00f, 9.848272932e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.026676371e+00f, -1.906574614e+00f, 8.994144103e-01f, -1.906574614e+00f, 9.260907815e-01f },
+        { 8.911342770e-01f, -1.622340551e+00f, 7.993757050e-01f, -1.622340551e+00f, 6.905099819e-01f },
+        { 9.409622349e-01f, -1.367816071e+00f, 6.836129315e-01f, -1.367816071e+00f, 6.245751664e-01f },
+        { 1.049468155e+00f, -6.467975858e-01f, 4.987464116e-01f, -6.467975858e-01f, 5.482145670e-01f },
+        { 1.143185572e+00f, 1.087777101e+00f, 5.279100762e-01f, 1.087777101e+00f, 6.710956486e-01f },
+    } },
+    { { /* 15 % */
+        { 1.001777299e+00f, -1.998158769e+00f, 9.964009597e-01f, -1.998158769e+00f, 9.981782588e-01f },
+        { 1.003551329e+00f, -1.996281980e+00f, 9.928085399e-01f, -1.996281980e+00f, 9.963598688e-01f },
+        { 1.007146436e+00f, -1.992358857e+00f, 9.855284283e-01f, -1.992358857e+00f, 9.926748644e-01f },
+        { 1.013083962e+00f, -1.983551006e+00f, 9.717259861e-01f, -1.983551006e+00f, 9.848099476e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.026559455e+00f, -1.906493455e+00f, 8.994493364e-01f, -1.906493455e+00f, 9.260087911e-01f },
+        { 8.907110195e-01f, -1.621762030e+00f, 7.991961319e-01f, -1.621762030e+00f, 6.899071514e-01f },
+        { 9.406107837e-01f, -1.367520364e+00f, 6.836131664e-01f, -1.367520364e+00f, 6.242239501e-01f },
+        { 1.048878379e+00f, -6.466293210e-01f, 4.989334184e-01f, -6.466293210e-01f, 5.478117979e-01f },
+        { 1.142045074e+00f, 1.087364880e+00f, 5.284172997e-01f, 1.087364880e+00f, 6.704623739e-01f },
+    } },
+    { { /* 16 % */
+        { 1.001769013e+00f, -1.998154573e+00f, 9.964050501e-01f, -1.998154573e+00f, 9.981740631e-01f },
+        { 1.003534764e+00f, -1.996273605e+00f, 9.928167282e-01f, -1.996273605e+00f, 9.963514927e-01f },
+        { 1.007113073e+00f, -1.992342035e+00f, 9.855449673e-01f, -1.992342035e+00f, 9.926580402e-01f },
+        { 1.013051304e+00f, -1.983533652e+00f, 9.717412781e-01f, -1.983533652e+00f, 9.847925824e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.026442582e+00f, -1.906412209e+00f, 8.994841312e-01f, -1.906412209e+00f, 9.259267134e-01f },
+        { 8.902875747e-01f, -1.621182588e+00f, 7.990157877e-01f, -1.621182588e+00f, 6.893033624e-01f },
+        { 9.402594206e-01f, -1.367224444e+00f, 6.836130607e-01f, -1.367224444e+00f, 6.238724813e-01f },
+        { 1.048288961e+00f, -6.464609500e-01f, 4.991198141e-01f, -6.464609500e-01f, 5.474087747e-01f },
+        { 1.140906070e+00f, 1.086952021e+00f, 5.289220508e-01f, 1.086952021e+00f, 6.698281208e-01f },
+    } },
+    { { /* 17 % */
+        { 1.001760736e+00f, -1.998150368e+00f, 9.964091214e-01f, -1.998150368e+00f, 9.981698577e-01f },
+        { 1.003518219e+00f, -1.996265210e+00f, 9.928248785e-01f, -1.996265210e+00f, 9.963430974e-01f },
+        { 1.007079748e+00f, -1.992325175e+00f, 9.855614296e-01f, -1.992325175e+00f, 9.926411775e-01f },
+        { 1.013018665e+00f, -1.983516278e+00f, 9.717565326e-01f, -1.983516278e+00f, 9.847751975e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.026325753e+00f, -1.906330876e+00f, 8.995187948e-01f, -1.906330876e+00f, 9.258445480e-01f },
+        { 8.898639415e-01f, -1.620602227e+00f, 7.988346728e-01f, -1.620602227e+00f, 6.886986143e-01f },
+        { 9.399081454e-01f, -1.366928311e+00f, 6.836126146e-01f, -1.366928311e+00f, 6.235207600e-01f },
+        { 1.047699898e+00f, -6.462924729e-01f, 4.993055991e-01f, -6.462924729e-01f, 5.470054975e-01f },
+        { 1.139768555e+00f, 1.086538525e+00f, 5.294243339e-01f, 1.086538525e+00f, 6.691928888e-01f },
+    } },
+    { { /* 18 % */
+        { 1.001752469e+00f, -1.998146153e+00f, 9.964131737e-01f, -1.998146153e+00f, 9.981656427e-01f },
+        { 1.003501692e+00f, -1.996256796e+00f, 9.928329907e-01f, -1.996256796e+00f, 9.963346828e-01f },
+        { 1.007046461e+00f, -1.992308277e+00f, 9.855778154e-01f, -1.992308277e+00f, 9.926242763e-01f },
+        { 1.012986043e+00f, -1.983498884e+00f, 9.717717497e-01f, -1.983498884e+00f, 9.847577929e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.026208968e+00f, -1.906249456e+00f, 8.995533271e-01f, -1.906249456e+00f, 9.257622951e-01f },
+        { 8.894401191e-01f, -1.620020944e+00f, 7.986527874e-01f, -1.620020944e+00f, 6.880929065e-01f },
+        { 9.395569577e-01f, -1.366631965e+00f, 6.836118284e-01f, -1.366631965e+00f, 6.231687861e-01f },
+        { 1.047111192e+00f, -6.461238896e-01f, 4.994907741e-01f, -6.461238896e-01f, 5.466019662e-01f },
+        { 1.138632524e+00f, 1.086124392e+00f, 5.299241531e-01f, 1.086124392e+00f, 6.685566772e-01f },
+    } },
+    { { /* 19 % */
+        { 1.001744211e+00f, -1.998141928e+00f, 9.964172070e-01f, -1.998141928e+00f, 9.981614179e-01f },
+        { 1.003485184e+00f, -1.996248362e+00f, 9.928410649e-01f, -1.996248362e+00f, 9.963262489e-01f },
+        { 1.007013212e+00f, -1.992291339e+00f, 9.855941248e-01f, -1.992291339e+00f, 9.926073363e-01f },
+        { 1.012953439e+00f, -1.983481471e+00f, 9.717869294e-01f, -1.983481471e+00f, 9.847403685e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.026092226e+00f, -1.906167950e+00f, 8.995877283e-01f, -1.906167950e+00f, 9.256799544e-01f },
+        { 8.890161063e-01f, -1.619438739e+00f, 7.984701319e-01f, -1.619438739e+00f, 6.874862382e-01f },
+        { 9.392058574e-01f, -1.366335407e+00f, 6.836107022e-01f, -1.366335407e+00f, 6.228165596e-01f },
+        { 1.046522841e+00f, -6.459552002e-01f, 4.996753396e-01f, -6.459552002e-01f, 5.461981809e-01f },
+        { 1.137497973e+00f, 1.085709621e+00f, 5.304215125e-01f, 1.085709621e+00f, 6.679194854e-01f },
+    } },
+    { { /* 20 % */
+        { 1.001735962e+00f, -1.998137694e+00f, 9.964212213e-01f, -1.998137694e+00f, 9.981571835e-01f },
+        { 1.003468695e+00f, -1.996239909e+00f, 9.928491011e-01f, -1.996239909e+00f, 9.963177956e-01f },
+        { 1.006980000e+00f, -1.992274363e+00f, 9.856103577e-01f, -1.992274363e+00f, 9.925903576e-01f },
+        { 1.012920853e+00f, -1.983464038e+00f, 9.718020718e-01f, -1.983464038e+00f, 9.847229244e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.025975528e+00f, -1.906086357e+00f, 8.996219984e-01f, -1.906086357e+00f, 9.255975260e-01f },
+        { 8.885919022e-01f, -1.618855612e+00f, 7.982867066e-01f, -1.618855612e+00f, 6.868786088e-01f },
+        { 9.388548441e-01f, -1.366038636e+00f, 6.836092364e-01f, -1.366038636e+00f, 6.224640805e-01f },
+        { 1.045934846e+00f, -6.457864047e-01f, 4.998592960e-01f, -6.457864047e-01f, 5.457941416e-01f },
+        { 1.136364897e+00f, 1.085294211e+00f, 5.309164163e-01f, 1.085294211e+00f, 6.672813130e-01f },
+    } },
+    { { /* 21 % */
+        { 1.001727723e+00f, -1.998133450e+00f, 9.964252166e-01f, -1.998133450e+00f, 9.981529393e-01f },
+        { 1.003452224e+00f, -1.996231437e+00f, 9.928570994e-01f, -1.996231437e+00f, 9.963093229e-01f },
+        { 1.006946826e+00f, -1.992257349e+00f, 9.856265144e-01f, -1.992257349e+00f, 9.925733400e-01f },
+        { 1.012888284e+00f, -1.983446585e+00f, 9.718171768e-01f, -1.983446585e+00f, 9.847054604e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.025858872e+00f, -1.906004676e+00f, 8.996561374e-01f, -1.906004676e+00f, 9.255150096e-01f },
+        { 8.881675059e-01f, -1.618271563e+00f, 7.981025118e-01f, -1.618271563e+00f, 6.862700177e-01f },
+        { 9.385039177e-01f, -1.365741652e+00f, 6.836074310e-01f, -1.365741652e+00f, 6.221113487e-01f },
+        { 1.045347204e+00f, -6.456175031e-01f, 5.000426441e-01f, -6.456175031e-01f, 5.453898484e-01f },
+        { 1.135233291e+00f, 1.084878162e+00f, 5.314088685e-01f, 1.084878162e+00f, 6.666421592e-01f },
+    } },
+    { { /* 22 % */
+        { 1.001719492e+00f, -1.998129196e+00f, 9.964291929e-01f, -1.998129196e+00f, 9.981486853e-01f },
+        { 1.003435771e+00f, -1.996222945e+00f, 9.928650599e-01f, -1.996222945e+00f, 9.963008308e-01f },
+        { 1.006913689e+00f, -1.992240295e+00f, 9.856425949e-01f, -1.992240295e+00f, 9.925562835e-01f },
+        { 1.012855732e+00f, -1.983429112e+00f, 9.718322444e-01f, -1.983429112e+00f, 9.846879767e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.025742260e+00f, -1.905922909e+00f, 8.996901455e-01f, -1.905922909e+00f, 9.254324053e-01f },
+        { 8.877429163e-01f, -1.617686589e+00f, 7.979175477e-01f, -1.617686589e+00f, 6.856604640e-01f },
+        { 9.381530777e-01f, -1.365444456e+00f, 6.836052863e-01f, -1.365444456e+00f, 6.217583641e-01f },
+        { 1.044759917e+00f, -6.454484954e-01f, 5.002253843e-01f, -6.454484954e-01f, 5.449853011e-01f },
+        { 1.134103150e+00f, 1.084461475e+00f, 5.318988734e-01f, 1.084461475e+00f, 6.660020236e-01f },
+    } },
+    { { /* 23 % */
+        { 1.001711271e+00f, -1.998124932e+00f, 9.964331504e-01f, -1.998124932e+00f, 9.981444215e-01f },
+        { 1.003419337e+00f, -1.996214434e+00f, 9.928729825e-01f, -1.996214434e+00f, 9.962923191e-01f },
+        { 1.006880589e+00f, -1.992223202e+00f, 9.856585992e-01f, -1.992223202e+00f, 9.925391880e-01f },
+        { 1.012823198e+00f, -1.983411620e+00f, 9.718472747e-01f, -1.983411620e+00f, 9.846704731e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.025625690e+00f, -1.905841055e+00f, 8.997240227e-01f, -1.905841055e+00f, 9.253497129e-01f },
+        { 8.873181324e-01f, -1.617100691e+00f, 7.977318149e-01f, -1.617100691e+00f, 6.850499473e-01f },
+        { 9.378023241e-01f, -1.365147047e+00f, 6.836028026e-01f, -1.365147047e+00f, 6.214051268e-01f },
+        { 1.044172983e+00f, -6.452793817e-01f, 5.004075173e-01f, -6.452793817e-01f, 5.445805000e-01f },
+        { 1.132974471e+00f, 1.084044148e+00f, 5.323864350e-01f, 1.084044148e+00f, 6.653609056e-01f },
+    } },
+    { { /* 24 % */
+        { 1.001703059e+00f, -1.998120658e+00f, 9.964370889e-01f, -1.998120658e+00f, 9.981401479e-01f },
+        { 1.003402921e+00f, -1.996205903e+00f, 9.928808674e-01f, -1.996205903e+00f, 9.962837879e-01f },
+        { 1.006847526e+00f, -1.992206070e+00f, 9.856745275e-01f, -1.992206070e+00f, 9.925220534e-01f },
+        { 1.012790682e+00f, -1.983394108e+00f, 9.718622678e-01f, -1.983394108e+00f, 9.846529497e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.025509163e+00f, -1.905759113e+00f, 8.997577690e-01f, -1.905759113e+00f, 9.252669324e-01f },
+        { 8.868931534e-01f, -1.616513869e+00f, 7.975453134e-01f, -1.616513869e+00f, 6.844384668e-01f },
+        { 9.374516565e-01f, -1.364849425e+00f, 6.835999801e-01f, -1.364849425e+00f, 6.210516366e-01f },
+        { 1.043586402e+00f, -6.451101619e-01f, 5.005890435e-01f, -6.451101619e-01f, 5.441754450e-01f },
+        { 1.131847247e+00f, 1.083626181e+00f, 5.328715574e-01f, 1.083626181e+00f, 6.647188046e-01f },
+    } },
+    { { /* 25 % */
+        { 1.001694856e+00f, -1.998116375e+00f, 9.964410085e-01f, -1.998116375e+00f, 9.981358645e-01f },
+        { 1.003386523e+00f, -1.996197352e+00f, 9.928887145e-01f, -1.996197352e+00f, 9.962752371e-01f },
+        { 1.006814500e+00f, -1.992188899e+00f, 9.856903799e-01f, -1.992188899e+00f, 9.925048795e-01f },
+        { 1.012758183e+00f, -1.983376575e+00f, 9.718772236e-01f, -1.983376575e+00f, 9.846354064e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.025392679e+00f, -1.905677084e+00f, 8.997913845e-01f, -1.905677084e+00f, 9.251840636e-01f },
+        { 8.864679781e-01f, -1.615926120e+00f, 7.973580437e-01f, -1.615926120e+00f, 6.838260218e-01f },
+        { 9.371010747e-01f, -1.364551590e+00f, 6.835968190e-01f, -1.364551590e+00f, 6.206978936e-01f },
+        { 1.043000173e+00f, -6.449408360e-01f, 5.007699634e-01f, -6.449408360e-01f, 5.437701362e-01f },
+        { 1.130721475e+00f, 1.083207574e+00f, 5.333542448e-01f, 1.083207574e+00f, 6.640757200e-01f },
+    } },
+    { { /* 26 % */
+        { 1.001686662e+00f, -1.998112082e+00f, 9.964449092e-01f, -1.998112082e+00f, 9.981315713e-01f },
+        { 1.003370143e+00f, -1.996188782e+00f, 9.928965239e-01f, -1.996188782e+00f, 9.962666667e-01f },
+        { 1.006781510e+00f, -1.992171688e+00f, 9.857061565e-01f, -1.992171688e+00f, 9.924876664e-01f },
+        { 1.012725701e+00f, -1.983359023e+00f, 9.718921421e-01f, -1.983359023e+00f, 9.846178432e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.025276237e+00f, -1.905594967e+00f, 8.998248693e-01f, -1.905594967e+00f, 9.251011066e-01f },
+        { 8.860426056e-01f, -1.615337446e+00f, 7.971700061e-01f, -1.615337446e+00f, 6.832126118e-01f },
+        { 9.367505784e-01f, -1.364253542e+00f, 6.835933194e-01f, -1.364253542e+00f, 6.203438978e-01f },
+        { 1.042414296e+00f, -6.447714041e-01f, 5.009502778e-01f, -6.447714041e-01f, 5.433645736e-01f },
+        { 1.129597150e+00f, 1.082788326e+00f, 5.338345012e-01f, 1.082788326e+00f, 6.634316514e-01f },
+    } },
+    { { /* 27 % */
+        { 1.001678477e+00f, -1.998107779e+00f, 9.964487912e-01f, -1.998107779e+00f, 9.981272681e-01f },
+        { 1.003353781e+00f, -1.996180192e+00f, 9.929042956e-01f, -1.996180192e+00f, 9.962580766e-01f },
+        { 1.006748557e+00f, -1.992154439e+00f, 9.857218572e-01f, -1.992154439e+00f, 9.924704139e-01f },
+        { 1.012693237e+00f, -1.983341451e+00f, 9.719070233e-01f, -1.983341451e+00f, 9.846002601e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.025159838e+00f, -1.905512763e+00f, 8.998582234e-01f, -1.905512763e+00f, 9.250180611e-01f },
+        { 8.856170351e-01f, -1.614747845e+00f, 7.969812009e-01f, -1.614747845e+00f, 6.825982360e-01f },
+        { 9.364001673e-01f, -1.363955281e+00f, 6.835894817e-01f, -1.363955281e+00f, 6.199896490e-01f },
+        { 1.041828770e+00f, -6.446018662e-01f, 5.011299870e-01f, -6.446018662e-01f, 5.429587571e-01f },
+        { 1.128474267e+00f, 1.082368437e+00f, 5.343123308e-01f, 1.082368437e+00f, 6.627865981e-01f },
+    } },
+    { { /* 28 % */
+        { 1.001670301e+00f, -1.998103466e+00f, 9.964526542e-01f, -1.998103466e+00f, 9.981229551e-01f },
+        { 1.003337437e+00f, -1.996171583e+00f, 9.929120298e-01f, -1.996171583e+00f, 9.962494667e-01f },
+        { 1.006715640e+00f, -1.992137149e+00f, 9.857374823e-01f, -1.992137149e+00f, 9.924531219e-01f },
+        { 1.012660790e+00f, -1.983323860e+00f, 9.719218674e-01f, -1.983323860e+00f, 9.845826570e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.025043480e+00f, -1.905430472e+00f, 8.998914469e-01f, -1.905430472e+00f, 9.249349272e-01f },
+        { 8.851912654e-01f, -1.614157316e+00f, 7.967916284e-01f, -1.614157316e+00f, 6.819828938e-01f },
+        { 9.360498413e-01f, -1.363656807e+00f, 6.835853061e-01f, -1.363656807e+00f, 6.196351473e-01f },
+        { 1.041243595e+00f, -6.444322222e-01f, 5.013090918e-01f, -6.444322222e-01f, 5.425526869e-01f },
+        { 1.127352822e+00f, 1.081947907e+00f, 5.347877375e-01f, 1.081947907e+00f, 6.621405597e-01f },
+    } },
+    { { /* 29 % */
+        { 1.001662134e+00f, -1.998099143e+00f, 9.964564985e-01f, -1.998099143e+00f, 9.981186321e-01f },
+        { 1.003321111e+00f, -1.996162953e+00f, 9.929197263e-01f, -1.996162953e+00f, 9.962408371e-01f },
+        { 1.006682759e+00f, -1.992119821e+00f, 9.857530317e-01f, -1.992119821e+00f, 9.924357903e-01f },
+        { 1.012628360e+00f, -1.983306248e+00f, 9.719366743e-01f, -1.983306248e+00f, 9.845650340e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.024927165e+00f, -1.905348092e+00f, 8.999245397e-01f, -1.905348092e+00f, 9.248517046e-01f },
+        { 8.847652956e-01f, -1.613565859e+00f, 7.966012889e-01f, -1.613565859e+00f, 6.813665845e-01f },
+        { 9.356996000e-01f, -1.363358120e+00f, 6.835807927e-01f, -1.363358120e+00f, 6.192803926e-01f },
+        { 1.040658770e+00f, -6.442624723e-01f, 5.014875925e-01f, -6.442624723e-01f, 5.421463630e-01f },
+        { 1.126232810e+00f, 1.081526736e+00f, 5.352607255e-01f, 1.081526736e+00f, 6.614935355e-01f },
+    } },
+    { { /* 30 % */
+        { 1.001653975e+00f, -1.998094810e+00f, 9.964603240e-01f, -1.998094810e+00f, 9.981142992e-01f },
+        { 1.003304802e+00f, -1.996154304e+00f, 9.929273854e-01f, -1.996154304e+00f, 9.962321876e-01f },
+        { 1.006649913e+00f, -1.992102452e+00f, 9.857685057e-01f, -1.992102452e+00f, 9.924184191e-01f },
+        { 1.012595947e+00f, -1.983288616e+00f, 9.719514440e-01f, -1.983288616e+00f, 9.845473909e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.024810891e+00f, -1.905265625e+00f, 8.999575021e-01f, -1.905265625e+00f, 9.247683934e-01f },
+        { 8.843391248e-01f, -1.612973474e+00f, 7.964101828e-01f, -1.612973474e+00f, 6.807493076e-01f },
+        { 9.353494431e-01f, -1.363059220e+00f, 6.835759417e-01f, -1.363059220e+00f, 6.189253849e-01f },
+        { 1.040074296e+00f, -6.440926163e-01f, 5.016654898e-01f, -6.440926163e-01f, 5.417397854e-01f },
+        { 1.125114226e+00f, 1.081104922e+00f, 5.357312988e-01f, 1.081104922e+00f, 6.608455251e-01f },
+    } },
+    { { /* 31 % */
+        { 1.001645826e+00f, -1.998090467e+00f, 9.964641307e-01f, -1.998090467e+00f, 9.981099563e-01f },
+        { 1.003288511e+00f, -1.996145635e+00f, 9.929350069e-01f, -1.996145635e+00f, 9.962235183e-01f },
+        { 1.006617104e+00f, -1.992085044e+00f, 9.857839042e-01f, -1.992085044e+00f, 9.924010082e-01f },
+        { 1.012563551e+00f, -1.983270964e+00f, 9.719661765e-01f, -1.983270964e+00f, 9.845297279e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.024694660e+00f, -1.905183070e+00f, 8.999903340e-01f, -1.905183070e+00f, 9.246849935e-01f },
+        { 8.839127521e-01f, -1.612380159e+00f, 7.962183103e-01f, -1.612380159e+00f, 6.801310623e-01f },
+        { 9.349993706e-01f, -1.362760108e+00f, 6.835707535e-01f, -1.362760108e+00f, 6.185701241e-01f },
+        { 1.039490170e+00f, -6.439226544e-01f, 5.018427843e-01f, -6.439226544e-01f, 5.413329541e-01f },
+        { 1.123997066e+00f, 1.080682466e+00f, 5.361994614e-01f, 1.080682466e+00f, 6.601965279e-01f },
+    } },
+    { { /* 32 % */
+        { 1.001637685e+00f, -1.998086114e+00f, 9.964679187e-01f, -1.998086114e+00f, 9.981056035e-01f },
+        { 1.003272238e+00f, -1.996136947e+00f, 9.929425910e-01f, -1.996136947e+00f, 9.962148291e-01f },
+        { 1.006584330e+00f, -1.992067596e+00f, 9.857992274e-01f, -1.992067596e+00f, 9.923835574e-01f },
+        { 1.012531173e+00f, -1.983253292e+00f, 9.719808719e-01f, -1.983253292e+00f, 9.845120449e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.024578469e+00f, -1.905100428e+00f, 9.000230355e-01f, -1.905100428e+00f, 9.246015047e-01f },
+        { 8.834861764e-01f, -1.611785915e+00f, 7.960256717e-01f, -1.611785915e+00f, 6.795118481e-01f },
+        { 9.346493820e-01f, -1.362460782e+00f, 6.835652282e-01f, -1.362460782e+00f, 6.182146103e-01f },
+        { 1.038906393e+00f, -6.437525866e-01f, 5.020194764e-01f, -6.437525866e-01f, 5.409258692e-01f },
+        { 1.122881326e+00f, 1.080259367e+00f, 5.366652175e-01f, 1.080259367e+00f, 6.595465433e-01f },
+    } },
+    { { /* 33 % */
+        { 1.001629553e+00f, -1.998081751e+00f, 9.964716880e-01f, -1.998081751e+00f, 9.981012406e-01f },
+        { 1.003255982e+00f, -1.996128238e+00f, 9.929501376e-01f, -1.996128238e+00f, 9.962061200e-01f },
+        { 1.006551591e+00f, -1.992050108e+00f, 9.858144752e-01f, -1.992050108e+00f, 9.923660667e-01f },
+        { 1.012498812e+00f, -1.983235600e+00f, 9.719955302e-01f, -1.983235600e+00f, 9.844943417e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.024462320e+00f, -1.905017697e+00f, 9.000556066e-01f, -1.905017697e+00f, 9.245179270e-01f },
+        { 8.830593968e-01f, -1.611190740e+00f, 7.958322675e-01f, -1.611190740e+00f, 6.788916643e-01f },
+        { 9.342994772e-01f, -1.362161242e+00f, 6.835593661e-01f, -1.362161242e+00f, 6.178588433e-01f },
+        { 1.038322964e+00f, -6.435824128e-01f, 5.021955667e-01f, -6.435824128e-01f, 5.405185307e-01f },
+        { 1.121767000e+00f, 1.079835626e+00f, 5.371285710e-01f, 1.079835626e+00f, 6.588955709e-01f },
+    } },
+    { { /* 34 % */
+        { 1.001621429e+00f, -1.998077379e+00f, 9.964754385e-01f, -1.998077379e+00f, 9.980968677e-01f },
+        { 1.003239744e+00f, -1.996119509e+00f, 9.929576469e-01f, -1.996119509e+00f, 9.961973908e-01f },
+        { 1.006518888e+00f, -1.992032580e+00f, 9.858296479e-01f, -1.992032580e+00f, 9.923485360e-01f },
+        { 1.012466467e+00f, -1.983217888e+00f, 9.720101514e-01f, -1.983217888e+00f, 9.844766186e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.024346213e+00f, -1.904934878e+00f, 9.000880474e-01f, -1.904934878e+00f, 9.244342603e-01f },
+        { 8.826324123e-01f, -1.610594633e+00f, 7.956380979e-01f, -1.610594633e+00f, 6.782705102e-01f },
+        { 9.339496558e-01f, -1.361861490e+00f, 6.835531673e-01f, -1.361861490e+00f, 6.175028231e-01f },
+        { 1.037739883e+00f, -6.434121330e-01f, 5.023710558e-01f, -6.434121330e-01f, 5.401109386e-01f },
+        { 1.120654084e+00f, 1.079411241e+00f, 5.375895260e-01f, 1.079411241e+00f, 6.582436101e-01f },
+    } },
+    { { /* 35 % */
+        { 1.001613314e+00f, -1.998072996e+00f, 9.964791704e-01f, -1.998072996e+00f, 9.980924847e-01f },
+        { 1.003223523e+00f, -1.996110760e+00f, 9.929651189e-01f, -1.996110760e+00f, 9.961886416e-01f },
+        { 1.006486220e+00f, -1.992015012e+00f, 9.858447455e-01f, -1.992015012e+00f, 9.923309652e-01f },
+        { 1.012434140e+00f, -1.983200156e+00f, 9.720247356e-01f, -1.983200156e+00f, 9.844588753e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.024230147e+00f, -1.904851971e+00f, 9.001203580e-01f, -1.904851971e+00f, 9.243505046e-01f },
+        { 8.822052221e-01f, -1.609997596e+00f, 7.954431631e-01f, -1.609997596e+00f, 6.776483853e-01f },
+        { 9.335999176e-01f, -1.361561525e+00f, 6.835466321e-01f, -1.361561525e+00f, 6.171465498e-01f },
+        { 1.037157149e+00f, -6.432417474e-01f, 5.025459442e-01f, -6.432417474e-01f, 5.397030930e-01f },
+        { 1.119542574e+00f, 1.078986212e+00f, 5.380480865e-01f, 1.078986212e+00f, 6.575906604e-01f },
+    } },
+    { { /* 36 % */
+        { 1.001605208e+00f, -1.998068603e+00f, 9.964828836e-01f, -1.998068603e+00f, 9.980880916e-01f },
+        { 1.003207319e+00f, -1.996101991e+00f, 9.929725535e-01f, -1.996101991e+00f, 9.961798723e-01f },
+        { 1.006453586e+00f, -1.991997404e+00f, 9.858597681e-01f, -1.991997404e+00f, 9.923133542e-01f },
+        { 1.012401829e+00f, -1.983182404e+00f, 9.720392827e-01f, -1.983182404e+00f, 9.844411118e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.024114121e+00f, -1.904768975e+00f, 9.001525384e-01f, -1.904768975e+00f, 9.242666596e-01f },
+        { 8.817778252e-01f, -1.609399625e+00f, 7.952474636e-01f, -1.609399625e+00f, 6.770252889e-01f },
+        { 9.332502625e-01f, -1.361261346e+00f, 6.835397607e-01f, -1.361261346e+00f, 6.167900232e-01f },
+        { 1.036574761e+00f, -6.430712558e-01f, 5.027202325e-01f, -6.430712558e-01f, 5.392949939e-01f },
+        { 1.118432465e+00f, 1.078560539e+00f, 5.385042564e-01f, 1.078560539e+00f, 6.569367213e-01f },
+    } },
+    { { /* 37 % */
+        { 1.001597110e+00f, -1.998064199e+00f, 9.964865781e-01f, -1.998064199e+00f, 9.980836884e-01f },
+        { 1.003191132e+00f, -1.996093202e+00f, 9.929799509e-01f, -1.996093202e+00f, 9.961710828e-01f },
+        { 1.006420987e+00f, -1.991979755e+00f, 9.858747157e-01f, -1.991979755e+00f, 9.922957029e-01f },
+        { 1.012369536e+00f, -1.983164632e+00f, 9.720537927e-01f, -1.983164632e+00f, 9.844233283e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.023998137e+00f, -1.904685892e+00f, 9.001845887e-01f, -1.904685892e+00f, 9.241827254e-01f },
+        { 8.813502206e-01f, -1.608800722e+00f, 7.950509997e-01f, -1.608800722e+00f, 6.764012203e-01f },
+        { 9.329006900e-01f, -1.360960954e+00f, 6.835325533e-01f, -1.360960954e+00f, 6.164332433e-01f },
+        { 1.035992720e+00f, -6.429006584e-01f, 5.028939212e-01f, -6.429006584e-01f, 5.388866413e-01f },
+        { 1.117323752e+00f, 1.078134222e+00f, 5.389580399e-01f, 1.078134222e+00f, 6.562817923e-01f },
+    } },
+    { { /* 38 % */
+        { 1.001589021e+00f, -1.998059786e+00f, 9.964902540e-01f, -1.998059786e+00f, 9.980792751e-01f },
+        { 1.003174962e+00f, -1.996084393e+00f, 9.929873111e-01f, -1.996084393e+00f, 9.961622732e-01f },
+        { 1.006388423e+00f, -1.991962067e+00f, 9.858895884e-01f, -1.991962067e+00f, 9.922780112e-01f },
+        { 1.012337259e+00f, -1.983146839e+00f, 9.720682657e-01f, -1.983146839e+00f, 9.844055246e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.023882193e+00f, -1.904602719e+00f, 9.002165088e-01f, -1.904602719e+00f, 9.240987018e-01f },
+        { 8.809224075e-01f, -1.608200886e+00f, 7.948537716e-01f, -1.608200886e+00f, 6.757761791e-01f },
+        { 9.325512001e-01f, -1.360660349e+00f, 6.835250102e-01f, -1.360660349e+00f, 6.160762102e-01f },
+        { 1.035411025e+00f, -6.427299551e-01f, 5.030670108e-01f, -6.427299551e-01f, 5.384780353e-01f },
+        { 1.116216432e+00f, 1.077707260e+00f, 5.394094408e-01f, 1.077707260e+00f, 6.556258728e-01f },
+    } },
+    { { /* 39 % */
+        { 1.001580940e+00f, -1.998055363e+00f, 9.964939114e-01f, -1.998055363e+00f, 9.980748516e-01f },
+        { 1.003158809e+00f, -1.996075563e+00f, 9.929946342e-01f, -1.996075563e+00f, 9.961534433e-01f },
+        { 1.006355893e+00f, -1.991944337e+00f, 9.859043864e-01f, -1.991944337e+00f, 9.922602791e-01f },
+        { 1.012304999e+00f, -1.983129027e+00f, 9.720827018e-01f, -1.983129027e+00f, 9.843877007e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.023766290e+00f, -1.904519459e+00f, 9.002482990e-01f, -1.904519459e+00f, 9.240145887e-01f },
+        { 8.804943848e-01f, -1.607600115e+00f, 7.946557797e-01f, -1.607600115e+00f, 6.751501645e-01f },
+        { 9.322017923e-01f, -1.360359531e+00f, 6.835171314e-01f, -1.360359531e+00f, 6.157189238e-01f },
+        { 1.034829674e+00f, -6.425591459e-01f, 5.032395020e-01f, -6.425591459e-01f, 5.380691760e-01f },
+        { 1.115110499e+00f, 1.077279653e+00f, 5.398584633e-01f, 1.077279653e+00f, 6.549689623e-01f },
+    } },
+    { { /* 40 % */
+        { 1.001572868e+00f, -1.998050929e+00f, 9.964975501e-01f, -1.998050929e+00f, 9.980704180e-01f },
+        { 1.003142673e+00f, -1.996066713e+00f, 9.930019201e-01f, -1.996066713e+00f, 9.961445932e-01f },
+        { 1.006323397e+00f, -1.991926567e+00f, 9.859191096e-01f, -1.991926567e+00f, 9.922425064e-01f },
+        { 1.012272756e+00f, -1.983111194e+00f, 9.720971008e-01f, -1.983111194e+00f, 9.843698565e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.023650427e+00f, -1.904436109e+00f, 9.002799592e-01f, -1.904436109e+00f, 9.239303862e-01f },
+        { 8.800661516e-01f, -1.606998410e+00f, 7.944570244e-01f, -1.606998410e+00f, 6.745231760e-01f },
+        { 9.318524665e-01f, -1.360058499e+00f, 6.835089174e-01f, -1.360058499e+00f, 6.153613839e-01f },
+        { 1.034248668e+00f, -6.423882309e-01f, 5.034113952e-01f, -6.423882309e-01f, 5.376600632e-01f },
+        { 1.114005949e+00f, 1.076851401e+00f, 5.403051112e-01f, 1.076851401e+00f, 6.543110605e-01f },
+    } },
+    { { /* 41 % */
+        { 1.001564804e+00f, -1.998046485e+00f, 9.965011703e-01f, -1.998046485e+00f, 9.980659741e-01f },
+        { 1.003126554e+00f, -1.996057843e+00f, 9.930091688e-01f, -1.996057843e+00f, 9.961357227e-01f },
+        { 1.006290935e+00f, -1.991908757e+00f, 9.859337582e-01f, -1.991908757e+00f, 9.922246930e-01f },
+        { 1.012240529e+00f, -1.983093341e+00f, 9.721114630e-01f, -1.983093341e+00f, 9.843519922e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.023534605e+00f, -1.904352671e+00f, 9.003114895e-01f, -1.904352671e+00f, 9.238460940e-01f },
+        { 8.796377071e-01f, -1.606395769e+00f, 7.942575058e-01f, -1.606395769e+00f, 6.738952129e-01f },
+        { 9.315032225e-01f, -1.359757254e+00f, 6.835003683e-01f, -1.359757254e+00f, 6.150035907e-01f },
+        { 1.033668006e+00f, -6.422172100e-01f, 5.035826911e-01f, -6.422172100e-01f, 5.372506972e-01f },
+        { 1.112902778e+00f, 1.076422503e+00f, 5.407493885e-01f, 1.076422503e+00f, 6.536521666e-01f },
+    } },
+    { { /* 42 % */
+        { 1.001556748e+00f, -1.998042031e+00f, 9.965047719e-01f, -1.998042031e+00f, 9.980615201e-01f },
+        { 1.003110451e+00f, -1.996048953e+00f, 9.930163806e-01f, -1.996048953e+00f, 9.961268319e-01f },
+        { 1.006258507e+00f, -1.991890906e+00f, 9.859483323e-01f, -1.991890906e+00f, 9.922068389e-01f },
+        { 1.012208319e+00f, -1.983075468e+00f, 9.721257881e-01f, -1.983075468e+00f, 9.843341076e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.023418822e+00f, -1.904269144e+00f, 9.003428899e-01f, -1.904269144e+00f, 9.237617121e-01f },
+        { 8.792090502e-01f, -1.605792192e+00f, 7.940572244e-01f, -1.605792192e+00f, 6.732662746e-01f },
+        { 9.311540599e-01f, -1.359455795e+00f, 6.834914842e-01f, -1.359455795e+00f, 6.146455441e-01f },
+        { 1.033087688e+00f, -6.420460833e-01f, 5.037533901e-01f, -6.420460833e-01f, 5.368410778e-01f },
+        { 1.111800981e+00f, 1.075992959e+00f, 5.411912992e-01f, 1.075992959e+00f, 6.529922804e-01f },
+    } },
+    { { /* 43 % */
+        { 1.001548701e+00f, -1.998037567e+00f, 9.965083549e-01f, -1.998037567e+00f, 9.980570558e-01f },
+        { 1.003094365e+00f, -1.996040042e+00f, 9.930235553e-01f, -1.996040042e+00f, 9.961179207e-01f },
+        { 1.006226112e+00f, -1.991873013e+00f, 9.859628319e-01f, -1.991873013e+00f, 9.921889440e-01f },
+        { 1.012176126e+00f, -1.983057574e+00f, 9.721400764e-01f, -1.983057574e+00f, 9.843162027e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.023303080e+00f, -1.904185528e+00f, 9.003741605e-01f, -1.904185528e+00f, 9.236772405e-01f },
+        { 8.787801801e-01f, -1.605187680e+00f, 7.938561804e-01f, -1.605187680e+00f, 6.726363606e-01f },
+        { 9.308049785e-01f, -1.359154123e+00f, 6.834822655e-01f, -1.359154123e+00f, 6.142872440e-01f },
+        { 1.032507712e+00f, -6.418748509e-01f, 5.039234928e-01f, -6.418748509e-01f, 5.364312052e-01f },
+        { 1.110700554e+00f, 1.075562768e+00f, 5.416308473e-01f, 1.075562768e+00f, 6.523314012e-01f },
+    } },
+    { { /* 44 % */
+        { 1.001540662e+00f, -1.998033093e+00f, 9.965119195e-01f, -1.998033093e+00f, 9.980525812e-01f },
+        { 1.003078296e+00f, -1.996031111e+00f, 9.930306930e-01f, -1.996031111e+00f, 9.961089890e-01f },
+        { 1.006193751e+00f, -1.991855080e+00f, 9.859772571e-01f, -1.991855080e+00f, 9.921710082e-01f },
+        { 1.012143950e+00f, -1.983039660e+00f, 9.721543278e-01f, -1.983039660e+00f, 9.842982775e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.023187378e+00f, -1.904101824e+00f, 9.004053013e-01f, -1.904101824e+00f, 9.235926789e-01f },
+        { 8.783510959e-01f, -1.604582230e+00f, 7.936543742e-01f, -1.604582230e+00f, 6.720054702e-01f },
+        { 9.304559781e-01f, -1.358852238e+00f, 6.834727123e-01f, -1.358852238e+00f, 6.139286904e-01f },
+        { 1.031928080e+00f, -6.417035126e-01f, 5.040929997e-01f, -6.417035126e-01f, 5.360210794e-01f },
+        { 1.109601492e+00f, 1.075131931e+00f, 5.420680367e-01f, 1.075131931e+00f, 6.516695286e-01f },
+    } },
+    { { /* 45 % */
+        { 1.001532631e+00f, -1.998028608e+00f, 9.965154656e-01f, -1.998028608e+00f, 9.980480963e-01f },
+        { 1.003062243e+00f, -1.996022159e+00f, 9.930377938e-01f, -1.996022159e+00f, 9.961000367e-01f },
+        { 1.006161423e+00f, -1.991837106e+00f, 9.859916080e-01f, -1.991837106e+00f, 9.921530313e-01f },
+        { 1.012111790e+00f, -1.983021726e+00f, 9.721685423e-01f, -1.983021726e+00f, 9.842803320e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.023071715e+00f, -1.904018030e+00f, 9.004363125e-01f, -1.904018030e+00f, 9.235080274e-01f },
+        { 8.779217967e-01f, -1.603975842e+00f, 7.934518061e-01f, -1.603975842e+00f, 6.713736028e-01f },
+        { 9.301070584e-01f, -1.358550139e+00f, 6.834628249e-01f, -1.358550139e+00f, 6.135698833e-01f },
+        { 1.031348789e+00f, -6.415320686e-01f, 5.042619114e-01f, -6.415320686e-01f, 5.356107005e-01f },
+        { 1.108503791e+00f, 1.074700447e+00f, 5.425028713e-01f, 1.074700447e+00f, 6.510066620e-01f },
+    } },
+    { { /* 46 % */
+        { 1.001524608e+00f, -1.998024113e+00f, 9.965189932e-01f, -1.998024113e+00f, 9.980436011e-01f },
+        { 1.003046206e+00f, -1.996013186e+00f, 9.930448577e-01f, -1.996013186e+00f, 9.960910640e-01f },
+        { 1.006129129e+00f, -1.991819091e+00f, 9.860058846e-01f, -1.991819091e+00f, 9.921350133e-01f },
+        { 1.012079646e+00f, -1.983003772e+00f, 9.721827199e-01f, -1.983003772e+00f, 9.842623661e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.022956092e+00f, -1.903934147e+00f, 9.004671940e-01f, -1.903934147e+00f, 9.234232858e-01f },
+        { 8.774922814e-01f, -1.603368517e+00f, 7.932484764e-01f, -1.603368517e+00f, 6.707407579e-01f },
+        { 9.297582192e-01f, -1.358247827e+00f, 6.834526035e-01f, -1.358247827e+00f, 6.132108227e-01f },
+        { 1.030769840e+00f, -6.413605188e-01f, 5.044302285e-01f, -6.413605188e-01f, 5.352000684e-01f },
+        { 1.107407446e+00f, 1.074268316e+00f, 5.429353551e-01f, 1.074268316e+00f, 6.503428011e-01f },
+    } },
+    { { /* 47 % */
+        { 1.001516593e+00f, -1.998019607e+00f, 9.965225024e-01f, -1.998019607e+00f, 9.980390955e-01f },
+        { 1.003030186e+00f, -1.996004193e+00f, 9.930518847e-01f, -1.996004193e+00f, 9.960820706e-01f },
+        { 1.006096867e+00f, -1.991801035e+00f, 9.860200871e-01f, -1.991801035e+00f, 9.921169541e-01f },
+        { 1.012047519e+00f, -1.982985797e+00f, 9.721968607e-01f, -1.982985797e+00f, 9.842443799e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.022840508e+00f, -1.903850175e+00f, 9.004979459e-01f, -1.903850175e+00f, 9.233384541e-01f },
+        { 8.770625493e-01f, -1.602760252e+00f, 7.930443855e-01f, -1.602760252e+00f, 6.701069348e-01f },
+        { 9.294094602e-01f, -1.357945301e+00f, 6.834420483e-01f, -1.357945301e+00f, 6.128515084e-01f },
+        { 1.030191232e+00f, -6.411888633e-01f, 5.045979514e-01f, -6.411888633e-01f, 5.347891832e-01f },
+        { 1.106312453e+00f, 1.073835537e+00f, 5.433654920e-01f, 1.073835537e+00f, 6.496779454e-01f },
+    } },
+    { { /* 48 % */
+        { 1.001508587e+00f, -1.998015091e+00f, 9.965259931e-01f, -1.998015091e+00f, 9.980345796e-01f },
+        { 1.003014182e+00f, -1.995995180e+00f, 9.930588749e-01f, -1.995995180e+00f, 9.960730566e-01f },
+        { 1.006064638e+00f, -1.991782937e+00f, 9.860342155e-01f, -1.991782937e+00f, 9.920988536e-01f },
+        { 1.012015409e+00f, -1.982967802e+00f, 9.722109647e-01f, -1.982967802e+00f, 9.842263732e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.022724964e+00f, -1.903766113e+00f, 9.005285682e-01f, -1.903766113e+00f, 9.232535322e-01f },
+        { 8.766325994e-01f, -1.602151049e+00f, 7.928395336e-01f, -1.602151049e+00f, 6.694721330e-01f },
+        { 9.290607812e-01f, -1.357642562e+00f, 6.834311594e-01f, -1.357642562e+00f, 6.124919406e-01f },
+        { 1.029612964e+00f, -6.410171021e-01f, 5.047650808e-01f, -6.410171021e-01f, 5.343780449e-01f },
+        { 1.105218808e+00f, 1.073402110e+00f, 5.437932859e-01f, 1.073402110e+00f, 6.490120943e-01f },
+    } },
+    { { /* 49 % */
+        { 1.001500588e+00f, -1.998010565e+00f, 9.965294654e-01f, -1.998010565e+00f, 9.980300533e-01f },
+        { 1.002998194e+00f, -1.995986145e+00f, 9.930658283e-01f, -1.995986145e+00f, 9.960640219e-01f },
+        { 1.006032442e+00f, -1.991764798e+00f, 9.860482699e-01f, -1.991764798e+00f, 9.920807117e-01f },
+        { 1.011983314e+00f, -1.982949786e+00f, 9.722250318e-01f, -1.982949786e+00f, 9.842083462e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.022609459e+00f, -1.903681963e+00f, 9.005590611e-01f, -1.903681963e+00f, 9.231685200e-01f },
+        { 8.762024309e-01f, -1.601540905e+00f, 7.926339210e-01f, -1.601540905e+00f, 6.688363519e-01f },
+        { 9.287121819e-01f, -1.357339609e+00f, 6.834199372e-01f, -1.357339609e+00f, 6.121321191e-01f },
+        { 1.029035036e+00f, -6.408452352e-01f, 5.049316171e-01f, -6.408452352e-01f, 5.339666536e-01f },
+        { 1.104126507e+00f, 1.072968035e+00f, 5.442187407e-01f, 1.072968035e+00f, 6.483452474e-01f },
+    } },
+    { { /* 50 % */
+        { 1.001492597e+00f, -1.998006028e+00f, 9.965329193e-01f, -1.998006028e+00f, 9.980255166e-01f },
+        { 1.002982221e+00f, -1.995977090e+00f, 9.930727450e-01f, -1.995977090e+00f, 9.960549664e-01f },
+        { 1.006000278e+00f, -1.991746618e+00f, 9.860622504e-01f, -1.991746618e+00f, 9.920625283e-01f },
+        { 1.011951236e+00f, -1.982931750e+00f, 9.722390622e-01f, -1.982931750e+00f, 9.841902987e-01f },
+        { 1.030261144e+00f, -1.967008232e+00f, 9.417487922e-01f, -1.967008232e+00f, 9.720099366e-01f },
+        { 1.022493993e+00f, -1.903597722e+00f, 9.005894245e-01f, -1.903597722e+00f, 9.230834173e-01f },
+        { 8.757720427e-01f, -1.600929822e+00f, 7.924275482e-01f, -1.600929822e+00f, 6.681995909e-01f },
+        { 9.283636621e-01f, -1.357036443e+00f, 6.834083819e-01f, -1.357036443e+00f, 6.117720439e-01f },
+        { 1.028457448e+00f, -6.406732625e-01f, 5.050975609e-01f, -6.406732625e-01f, 5.335550093e-01f },
+        { 1.103035544e+00f, 1.072533312e+00f, 5.446418604e-01f, 1.072533312e+00f, 6.476774043e-01f },
+    } },
+    { { /* 51 % */
+        { 1.001472655e+00f, -1.997994641e+00f, 9.965414737e-01f, -1.997994641e+00f, 9.980141291e-01f },
+        { 1.002982221e+00f, -1.995977090e+00f, 9.930727450e-01f, -1.995977090e+00f, 9.960549664e-01f },
+        { 1.006000278e+00f, -1.991746618e+00f, 9.860622504e-01f, -1.991746618e+00f, 9.920625283e-01f },
+        { 1.011951236e+00f, -1.982931750e+00f, 9.722390622e-01f, -1.982931750e+00f, 9.841902987e-01f },
+        { 1.029587698e+00f, -1.966689521e+00f, 9.421027161e-01f, -1.966689521e+00f, 9.716904146e-01f },
+        { 1.022493993e+00f, -1.903597722e+00f, 9.005894245e-01f, -1.903597722e+00f, 9.230834173e-01f },
+        { 8.757720427e-01f, -1.600929822e+00f, 7.924275482e-01f, -1.600929822e+00f, 6.681995909e-01f },
+        { 9.283636621e-01f, -1.357036443e+00f, 6.834083819e-01f, -1.357036443e+00f, 6.117720439e-01f },
+        { 1.028457448e+00f, -6.406732625e-01f, 5.050975609e-01f, -6.406732625e-01f, 5.335550093e-01f },
+        { 1.108503791e+00f, 1.074700447e+00f, 5.425028713e-01f, 1.074700447e+00f, 6.510066620e-01f },
+    } },
+    { { /* 52 % */
+        { 1.001452763e+00f, -1.997983188e+00f, 9.965499135e-01f, -1.997983188e+00f, 9.980026760e-01f },
+        { 1.002982221e+00f, -1.995977090e+00f, 9.930727450e-01f, -1.995977090e+00f, 9.960549664e-01f },
+        { 1.006000278e+00f, -1.991746618e+00f, 9.860622504e-01f, -1.991746618e+00f, 9.920625283e-01f },
+        { 1.011951236e+00f, -1.982931750e+00f, 9.722390622e-01f, -1.982931750e+00f, 9.841902987e-01f },
+        { 1.028918338e+00f, -1.966367224e+00f, 9.424489604e-01f, -1.966367224e+00f, 9.713672981e-01f },
+        { 1.022493993e+00f, -1.903597722e+00f, 9.005894245e-01f, -1.903597722e+00f, 9.230834173e-01f },
+        { 8.757720427e-01f, -1.600929822e+00f, 7.924275482e-01f, -1.600929822e+00f, 6.681995909e-01f },
+        { 9.283636621e-01f, -1.357036443e+00f, 6.834083819e-01f, -1.357036443e+00f, 6.117720439e-01f },
+        { 1.028457448e+00f, -6.406732625e-01f, 5.050975609e-01f, -6.406732625e-01f, 5.335550093e-01f },
+        { 1.114005949e+00f, 1.076851401e+00f, 5.403051112e-01f, 1.076851401e+00f, 6.543110605e-01f },
+    } },
+    { { /* 53 % */
+        { 1.001432918e+00f, -1.997971669e+00f, 9.965582390e-01f, -1.997971669e+00f, 9.979911569e-01f },
+        { 1.002982221e+00f, -1.995977090e+00f, 9.930727450e-01f, -1.995977090e+00f, 9.960549664e-01f },
+        { 1.006000278e+00f, -1.991746618e+00f, 9.860622504e-01f, -1.991746618e+00f, 9.920625283e-01f },
+        { 1.011951236e+00f, -1.982931750e+00f, 9.722390622e-01f, -1.982931750e+00f, 9.841902987e-01f },
+        { 1.028252975e+00f, -1.966041302e+00f, 9.427875727e-01f, -1.966041302e+00f, 9.710405478e-01f },
+        { 1.022493993e+00f, -1.903597722e+00f, 9.005894245e-01f, -1.903597722e+00f, 9.230834173e-01f },
+        { 8.757720427e-01f, -1.600929822e+00f, 7.924275482e-01f, -1.600929822e+00f, 6.681995909e-01f },
+        { 9.283636621e-01f, -1.357036443e+00f, 6.834083819e-01f, -1.357036443e+00f, 6.117720439e-01f },
+        { 1.028457448e+00f, -6.406732625e-01f, 5.050975609e-01f, -6.406732625e-01f, 5.335550093e-01f },
+        { 1.119542574e+00f, 1.078986212e+00f, 5.380480865e-01f, 1.078986212e+00f, 6.575906604e-01f },
+    } },
+    { { /* 54 % */
+        { 1.001413121e+00f, -1.997960083e+00f, 9.965664505e-01f, -1.997960083e+00f, 9.979795715e-01f },
+        { 1.002982221e+00f, -1.995977090e+00f, 9.930727450e-01f, -1.995977090e+00f, 9.960549664e-01f },
+        { 1.006000278e+00f, -1.991746618e+00f, 9.860622504e-01f, -1.991746618e+00f, 9.920625283e-01f },
+        { 1.011951236e+00f, -1.982931750e+00f, 9.722390622e-01f, -1.982931750e+00f, 9.841902987e-01f },
+        { 1.027591524e+00f, -1.965711717e+00f, 9.431185997e-01f, -1.965711717e+00f, 9.707101241e-01f },
+        { 1.022493993e+00f, -1.903597722e+00f, 9.005894245e-01f, -1.903597722e+00f, 9.230834173e-01f },
+        { 8.757720427e-01f, -1.600929822e+00f, 7.924275482e-01f, -1.600929822e+00f, 6.681995909e-01f },
+        { 9.283636621e-01f, -1.357036443e+00f, 6.834083819e-01f, -1.357036443e+00f, 6.117720439e-01f },
+        { 1.028457448e+00f, -6.406732625e-01f, 5.050975609e-01f, -6.406732625e-01f, 5.335550093e-01f },
+        { 1.125114226e+00f, 1.081104922e+00f, 5.357312988e-01f, 1.081104922e+00f, 6.608455251e-01f },
+    } },
+    { { /* 55 % */
+        { 1.001393371e+00f, -1.997948431e+00f, 9.965745482e-01f, -1.997948431e+00f, 9.979679192e-01f },
+        { 1.002982221e+00f, -1.995977090e+00f, 9.930727450e-01f, -1.995977090e+00f, 9.960549664e-01f },
+        { 1.006000278e+00f, -1.991746618e+00f, 9.860622504e-01f, -1.991746618e+00f, 9.920625283e-01f },
+        { 1.011951236e+00f, -1.982931750e+00f, 9.722390622e-01f, -1.982931750e+00f, 9.841902987e-01f },
+        { 1.026933900e+00f, -1.965378427e+00f, 9.434420872e-01f, -1.965378427e+00f, 9.703759870e-01f },
+        { 1.022493993e+00f, -1.903597722e+00f, 9.005894245e-01f, -1.903597722e+00f, 9.230834173e-01f },
+        { 8.757720427e-01f, -1.600929822e+00f, 7.924275482e-01f, -1.600929822e+00f, 6.681995909e-01f },
+        { 9.283636621e-01f, -1.357036443e+00f, 6.834083819e-01f, -1.357036443e+00f, 6.117720439e-01f },
+        { 1.028457448e+00f, -6.406732625e-01f, 5.050975609e-01f, -6.406732625e-01f, 5.335550093e-01f },
+        { 1.130721475e+00f, 1.083207574e+00f, 5.333542448e-01f, 1.083207574e+00f, 6.640757200e-01f },
+    } },
+    { { /* 56 % */
+        { 1.001373667e+00f, -1.997936712e+00f, 9.965825324e-01f, -1.997936712e+00f, 9.979561999e-01f },
+        { 1.002982221e+00f, -1.995977090e+00f, 9.930727450e-01f, -1.995977090e+00f, 9.960549664e-01f },
+        { 1.006000278e+00f, -1.991746618e+00f, 9.860622504e-01f, -1.991746618e+00f, 9.920625283e-01f },
+        { 1.011951236e+00f, -1.982931750e+00f, 9.722390622e-01f, -1.982931750e+00f, 9.841902987e-01f },
+        { 1.026280016e+00f, -1.965041393e+00f, 9.437580800e-01f, -1.965041393e+00f, 9.700380960e-01f },
+        { 1.022493993e+00f, -1.903597722e+00f, 9.005894245e-01f, -1.903597722e+00f, 9.230834173e-01f },
+        { 8.757720427e-01f, -1.600929822e+00f, 7.924275482e-01f, -1.600929822e+00f, 6.681995909e-01f },
+        { 9.283636621e-01f, -1.357036443e+00f, 6.834083819e-01f, -1.357036443e+00f, 6.117720439e-01f },
+        { 1.028457448e+00f, -6.406732625e-01f, 5.050975609e-01f, -6.406732625e-01f, 5.335550093e-01f },
+        { 1.136364897e+00f, 1.085294211e+00f, 5.309164163e-01f, 1.085294211e+00f, 6.672813130e-01f },
+    } },
+    { { /* 57 % */
+        { 1.001354010e+00f, -1.997924925e+00f, 9.965904034e-01f, -1.997924925e+00f, 9.979444130e-01f },
+        { 1.002982221e+00f, -1.995977090e+00f, 9.930727450e-01f, -1.995977090e+00f, 9.960549664e-01f },
+        { 1.006000278e+00f, -1.991746618e+00f, 9.860622504e-01f, -1.991746618e+00f, 9.920625283e-01f },
+        { 1.011951236e+00f, -1.982931750e+00f, 9.722390622e-01f, -1.982931750e+00f, 9.841902987e-01f },
+        { 1.025629788e+00f, -1.964700574e+00f, 9.440666220e-01f, -1.964700574e+00f, 9.696964103e-01f },
+        { 1.022493993e+00f, -1.903597722e+00f, 9.005894245e-01f, -1.903597722e+00f, 9.230834173e-01f },
+        { 8.757720427e-01f, -1.600929822e+00f, 7.924275482e-01f, -1.600929822e+00f, 6.681995909e-01f },
+        { 9.283636621e-01f, -1.357036443e+00f, 6.834083819e-01f, -1.357036443e+00f, 6.117720439e-01f },
+        { 1.028457448e+00f, -6.406732625e-01f, 5.050975609e-01f, -6.406732625e-01f, 5.335550093e-01f },
+        { 1.142045074e+00f, 1.087364880e+00f, 5.284172997e-01f, 1.087364880e+00f, 6.704623739e-01f },
+    } },
+    { { /* 58 % */
+        { 1.001334397e+00f, -1.997913071e+00f, 9.965981615e-01f, -1.997913071e+00f, 9.979325583e-01f },
+        { 1.002982221e+00f, -1.995977090e+00f, 9.930727450e-01f, -1.995977090e+00f, 9.960549664e-01f },
+        { 1.006000278e+00f, -1.991746618e+00f, 9.860622504e-01f, -1.991746618e+00f, 9.920625283e-01f },
+        { 1.011951236e+00f, -1.982931750e+00f, 9.722390622e-01f, -1.982931750e+00f, 9.841902987e-01f },
+        { 1.024983133e+00f, -1.964355929e+00f, 9.443677561e-01f, -1.964355929e+00f, 9.693508887e-01f },
+        { 1.022493993e+00f, -1.903597722e+00f, 9.005894245e-01f, -1.903597722e+00f, 9.230834173e-01f },
+        { 8.757720427e-01f, -1.600929822e+00f, 7.924275482e-01f, -1.600929822e+00f, 6.681995909e-01f },
+        { 9.283636621e-01f, -1.357036443e+00f, 6.834083819e-01f, -1.357036443e+00f, 6.117720439e-01f },
+        { 1.028457448e+00f, -6.406732625e-01f, 5.050975609e-01f, -6.406732625e-01f, 5.335550093e-01f },
+        { 1.147762599e+00f, 1.089419626e+00f, 5.258563763e-01f, 1.089419626e+00f, 6.736189749e-01f },
+    } },
+    { { /* 59 % */
+        { 1.001314828e+00f, -1.997901148e+00f, 9.966058068e-01f, -1.997901148e+00f, 9.979206352e-01f },
+        { 1.002982221e+00f, -1.995977090e+00f, 9.930727450e-01f, -1.995977090e+00f, 9.960549664e-01f },
+        { 1.006000278e+00f, -1.991746618e+00f, 9.860622504e-01f, -1.991746618e+00f, 9.920625283e-01f },
+        { 1.011951236e+00f, -1.982931750e+00f, 9.722390622e-01f, -1.982931750e+00f, 9.841902987e-01f },
+        { 1.024339965e+00f, -1.964007416e+00f, 9.446615242e-01f, -1.964007416e+00f, 9.690014894e-01f },
+        { 1.022493993e+00f, -1.903597722e+00f, 9.005894245e-01f, -1.903597722e+00f, 9.230834173e-01f },
+        { 8.757720427e-01f, -1.600929822e+00f, 7.924275482e-01f, -1.600929822e+00f, 6.681995909e-01f },
+        { 9.283636621e-01f, -1.357036443e+00f, 6.834083819e-01f, -1.357036443e+00f, 6.117720439e-01f },
+        { 1.028457448e+00f, -6.406732625e-01f, 5.050975609e-01f, -6.406732625e-01f, 5.335550093e-01f },
+        { 1.153518068e+00f, 1.091458499e+00f, 5.232331222e-01f, 1.091458499e+00f, 6.767511904e-01f },
+    } },
+    { { /* 60 % */
+        { 1.001295304e+00f, -1.997889156e+00f, 9.966133397e-01f, -1.997889156e+00f, 9.979086435e-01f },
+        { 1.002982221e+00f, -1.995977090e+00f, 9.930727450e-01f, -1.995977090e+00f, 9.960549664e-01f },
+        { 1.006000278e+00f, -1.991746618e+00f, 9.860622504e-01f, -1.991746618e+00f, 9.920625283e-01f },
+        { 1.011951236e+00f, -1.982931750e+00f, 9.722390622e-01f, -1.982931750e+00f, 9.841902987e-01f },
+        { 1.023700203e+00f, -1.963654993e+00f, 9.449479674e-01f, -1.963654993e+00f, 9.686481703e-01f },
+        { 1.022493993e+00f, -1.903597722e+00f, 9.005894245e-01f, -1.903597722e+00f, 9.230834173e-01f },
+        { 8.757720427e-01f, -1.600929822e+00f, 7.924275482e-01f, -1.600929822e+00f, 6.681995909e-01f },
+        { 9.283636621e-01f, -1.357036443e+00f, 6.834083819e-01f, -1.357036443e+00f, 6.117720439e-01f },
+        { 1.028457448e+00f, -6.406732625e-01f, 5.050975609e-01f, -6.406732625e-01f, 5.335550093e-01f },
+        { 1.159312088e+00f, 1.093481549e+00f, 5.205470080e-01f, 1.093481549e+00f, 6.798590964e-01f },
+    } },
+    { { /* 61 % */
+        { 1.001275822e+00f, -1.997877095e+00f, 9.966207604e-01f, -1.997877095e+00f, 9.978965826e-01f },
+        { 1.002942361e+00f, -1.995954361e+00f, 9.930898760e-01f, -1.995954361e+00f, 9.960322366e-01f },
+        { 1.005920009e+00f, -1.991700984e+00f, 9.860968786e-01f, -1.991700984e+00f, 9.920168877e-01f },
+        { 1.011791091e+00f, -1.982841263e+00f, 9.723086632e-01f, -1.982841263e+00f, 9.840997539e-01f },
+        { 1.023063763e+00f, -1.963298618e+00f, 9.452271258e-01f, -1.963298618e+00f, 9.682908890e-01f },
+        { 1.021341448e+00f, -1.902750378e+00f, 9.008859516e-01f, -1.902750378e+00f, 9.222273994e-01f },
+        { 8.736167771e-01f, -1.597860278e+00f, 7.913842904e-01f, -1.597860278e+00f, 6.650010675e-01f },
+        { 9.248827817e-01f, -1.353993027e+00f, 6.832745524e-01f, -1.353993027e+00f, 6.081573341e-01f },
+        { 1.022700130e+00f, -6.389477272e-01f, 5.067245317e-01f, -6.389477272e-01f, 5.294246616e-01f },
+        { 1.156410221e+00f, 1.092471999e+00f, 5.218979560e-01f, 1.092471999e+00f, 6.783081772e-01f },
+    } },
+    { { /* 62 % */
+        { 1.001256383e+00f, -1.997864965e+00f, 9.966280691e-01f, -1.997864965e+00f, 9.978844523e-01f },
+        { 1.002902598e+00f, -1.995931502e+00f, 9.931067782e-01f, -1.995931502e+00f, 9.960093762e-01f },
+        { 1.005839939e+00f, -1.991655090e+00f, 9.861310463e-01f, -1.991655090e+00f, 9.919709857e-01f },
+        { 1.011631347e+00f, -1.982750261e+00f, 9.723773475e-01f, -1.982750261e+00f, 9.840086947e-01f },
+        { 1.022430564e+00f, -1.962938248e+00f, 9.454990387e-01f, -1.962938248e+00f, 9.679296026e-01f },
+        { 1.020192652e+00f, -1.901893989e+00f, 9.011695924e-01f, -1.901893989e+00f, 9.213622444e-01f },
+        { 8.714558890e-01f, -1.594767144e+00f, 7.903220731e-01f, -1.594767144e+00f, 6.617779620e-01f },
+        { 9.214095814e-01f, -1.350928227e+00f, 6.831076453e-01f, -1.350928227e+00f, 6.045172267e-01f },
+        { 1.016976213e+00f, -6.372116423e-01f, 5.082928483e-01f, -6.372116423e-01f, 5.252690617e-01f },
+        { 1.153518068e+00f, 1.091458499e+00f, 5.232331222e-01f, 1.091458499e+00f, 6.767511904e-01f },
+    } },
+    { { /* 63 % */
+        { 1.001236986e+00f, -1.997852765e+00f, 9.966352662e-01f, -1.997852765e+00f, 9.978722521e-01f },
+        { 1.002862932e+00f, -1.995908511e+00f, 9.931234520e-01f, -1.995908511e+00f, 9.959863843e-01f },
+        { 1.005760066e+00f, -1.991608932e+00f, 9.861647547e-01f, -1.991608932e+00f, 9.919248208e-01f },
+        { 1.011472001e+00f, -1.982658743e+00f, 9.724451176e-01f, -1.982658743e+00f, 9.839171183e-01f },
+        { 1.021800523e+00f, -1.962573839e+00f, 9.457637443e-01f, -1.962573839e+00f, 9.675642675e-01f },
+        { 1.019047466e+00f, -1.901028468e+00f, 9.014403974e-01f, -1.901028468e+00f, 9.204878632e-01f },
+        { 8.692892696e-01f, -1.591650353e+00f, 7.892409365e-01f, -1.591650353e+00f, 6.585302061e-01f },
+        { 9.179438213e-01f, -1.347842023e+00f, 6.829078754e-01f, -1.347842023e+00f, 6.008516968e-01f },
+        { 1.011285208e+00f, -6.354650269e-01f, 5.098030479e-01f, -6.354650269e-01f, 5.210882555e-01f },
+        { 1.150635553e+00f, 1.090441044e+00f, 5.245525736e-01f, 1.090441044e+00f, 6.751881261e-01f },
+    } },
+    { { /* 64 % */
+        { 1.001217630e+00f, -1.997840495e+00f, 9.966423518e-01f, -1.997840495e+00f, 9.978599816e-01f },
+        { 1.002823362e+00f, -1.995885387e+00f, 9.931398980e-01f, -1.995885387e+00f, 9.959632602e-01f },
+        { 1.005680387e+00f, -1.991562510e+00f, 9.861980050e-01f, -1.991562510e+00f, 9.918783916e-01f },
+        { 1.011313046e+00f, -1.982566705e+00f, 9.725119756e-01f, -1.982566705e+00f, 9.838250217e-01f },
+        { 1.021173560e+00f, -1.962205349e+00f, 9.460212801e-01f, -1.962205349e+00f, 9.671948400e-01f },
+        { 1.017905751e+00f, -1.900153725e+00f, 9.016984158e-01f, -1.900153725e+00f, 9.196041666e-01f },
+        { 8.671168121e-01f, -1.588509842e+00f, 7.881409214e-01f, -1.588509842e+00f, 6.552577336e-01f },
+        { 9.144852656e-01f, -1.344734396e+00f, 6.826754570e-01f, -1.344734396e+00f, 5.971607226e-01f },
+        { 1.005626629e+00f, -6.337079017e-01f, 5.112556638e-01f, -6.337079017e-01f, 5.168822923e-01f },
+        { 1.147762599e+00f, 1.089419626e+00f, 5.258563763e-01f, 1.089419626e+00f, 6.736189749e-01f },
+    } },
+    { { /* 65 % */
+        { 1.001198314e+00f, -1.997828154e+00f, 9.966493261e-01f, -1.997828154e+00f, 9.978476405e-01f },
+        { 1.002783886e+00f, -1.995862131e+00f, 9.931561167e-01f, -1.995862131e+00f, 9.959400032e-01f },
+        { 1.005600898e+00f, -1.991515823e+00f, 9.862307982e-01f, -1.991515823e+00f, 9.918316965e-01f },
+        { 1.011154478e+00f, -1.982474144e+00f, 9.725779240e-01f, -1.982474144e+00f, 9.837324021e-01f },
+        { 1.020549593e+00f, -1.961832732e+00f, 9.462716825e-01f, -1.961832732e+00f, 9.668212759e-01f },
+        { 1.016767369e+00f, -1.899269672e+00f, 9.019436953e-01f, -1.899269672e+00f, 9.187110643e-01f },
+        { 8.649384117e-01f, -1.585345550e+00f, 7.870220688e-01f, -1.585345550e+00f, 6.519604805e-01f },
+        { 9.110336824e-01f, -1.341605330e+00f, 6.824106031e-01f, -1.341605330e+00f, 5.934442855e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.144899131e+00f, 1.088394240e+00f, 5.271445964e-01f, 1.088394240e+00f, 6.720437273e-01f },
+    } },
+    { { /* 66 % */
+        { 1.001179039e+00f, -1.997815742e+00f, 9.966561894e-01f, -1.997815742e+00f, 9.978352282e-01f },
+        { 1.002744504e+00f, -1.995838741e+00f, 9.931721088e-01f, -1.995838741e+00f, 9.959166124e-01f },
+        { 1.005521599e+00f, -1.991468868e+00f, 9.862631355e-01f, -1.991468868e+00f, 9.917847341e-01f },
+        { 1.010996291e+00f, -1.982381057e+00f, 9.726429650e-01f, -1.982381057e+00f, 9.836392564e-01f },
+        { 1.019928543e+00f, -1.961455945e+00f, 9.465149871e-01f, -1.961455945e+00f, 9.664435304e-01f },
+        { 1.015632183e+00f, -1.898376219e+00f, 9.021762822e-01f, -1.898376219e+00f, 9.178084654e-01f },
+        { 8.627539655e-01f, -1.582157417e+00f, 7.858844199e-01f, -1.582157417e+00f, 6.486383854e-01f },
+        { 9.075888440e-01f, -1.338454813e+00f, 6.821135259e-01f, -1.338454813e+00f, 5.897023699e-01f },
+        { 9.944048533e-01f, -6.301622130e-01f, 5.139902600e-01f, -6.301622130e-01f, 5.083951133e-01f },
+        { 1.142045074e+00f, 1.087364880e+00f, 5.284172997e-01f, 1.087364880e+00f, 6.704623739e-01f },
+    } },
+    { { /* 67 % */
+        { 1.001159802e+00f, -1.997803258e+00f, 9.966629420e-01f, -1.997803258e+00f, 9.978227445e-01f },
+        { 1.002705213e+00f, -1.995815217e+00f, 9.931878747e-01f, -1.995815217e+00f, 9.958930872e-01f },
+        { 1.005442485e+00f, -1.991421644e+00f, 9.862950180e-01f, -1.991421644e+00f, 9.917375028e-01f },
+        { 1.010838481e+00f, -1.982287442e+00f, 9.727071007e-01f, -1.982287442e+00f, 9.835455819e-01f },
+        { 1.019310330e+00f, -1.961074942e+00f, 9.467512286e-01f, -1.961074942e+00f, 9.660615585e-01f },
+        { 1.014500057e+00f, -1.897473275e+00f, 9.023962215e-01f, -1.897473275e+00f, 9.168962786e-01f },
+        { 8.605633727e-01f, -1.578945388e+00f, 7.847280164e-01f, -1.578945388e+00f, 6.452913890e-01f },
+        { 9.041505269e-01f, -1.335282833e+00f, 6.817844365e-01f, -1.335282833e+00f, 5.859349635e-01f },
+        { 9.888407271e-01f, -6.283736992e-01f, 5.152732894e-01f, -6.283736992e-01f, 5.041140166e-01f },
+        { 1.139200354e+00f, 1.086331538e+00f, 5.296745513e-01f, 1.086331538e+00f, 6.688749055e-01f },
+    } },
+    { { /* 68 % */
+        { 1.001140605e+00f, -1.997790702e+00f, 9.966695841e-01f, -1.997790702e+00f, 9.978101888e-01f },
+        { 1.002666012e+00f, -1.995791558e+00f, 9.932034149e-01f, -1.995791558e+00f, 9.958694267e-01f },
+        { 1.005363554e+00f, -1.991374150e+00f, 9.863264466e-01f, -1.991374150e+00f, 9.916900011e-01f },
+        { 1.010681042e+00f, -1.982193296e+00f, 9.727703335e-01f, -1.982193296e+00f, 9.834513755e-01f },
+        { 1.018694874e+00f, -1.960689677e+00f, 9.469804409e-01f, -1.960689677e+00f, 9.656753145e-01f },
+        { 1.013370855e+00f, -1.896560749e+00f, 9.026035567e-01f, -1.896560749e+00f, 9.159744116e-01f },
+        { 8.583665344e-01f, -1.575709407e+00f, 7.835529004e-01f, -1.575709407e+00f, 6.419194348e-01f },
+        { 9.007185114e-01f, -1.332089384e+00f, 6.814235456e-01f, -1.332089384e+00f, 5.821420570e-01f },
+        { 9.833071676e-01f, -6.265747752e-01f, 5.165008334e-01f, -6.265747752e-01f, 4.998080010e-01f },
+        { 1.136364897e+00f, 1.085294211e+00f, 5.309164163e-01f, 1.085294211e+00f, 6.672813130e-01f },
+    } },
+    { { /* 69 % */
+        { 1.001121445e+00f, -1.997778075e+00f, 9.966761158e-01f, -1.997778075e+00f, 9.977975608e-01f },
+        { 1.002626900e+00f, -1.995767762e+00f, 9.932187300e-01f, -1.995767762e+00f, 9.958456301e-01f },
+        { 1.005284805e+00f, -1.991326384e+00f, 9.863574226e-01f, -1.991326384e+00f, 9.916422274e-01f },
+        { 1.010523969e+00f, -1.982098614e+00f, 9.728326654e-01f, -1.982098614e+00f, 9.833566343e-01f },
+        { 1.018082095e+00f, -1.960300106e+00f, 9.472026569e-01f, -1.960300106e+00f, 9.652847523e-01f },
+        { 1.012244442e+00f, -1.895638549e+00f, 9.027983301e-01f, -1.895638549e+00f, 9.150427716e-01f },
+        { 8.561633538e-01f, -1.572449422e+00f, 7.823591146e-01f, -1.572449422e+00f, 6.385224684e-01f },
+        { 8.972925819e-01f, -1.328874460e+00f, 6.810310628e-01f, -1.328874460e+00f, 5.783236447e-01f },
+        { 9.778037283e-01f, -6.247654699e-01f, 5.176734080e-01f, -6.247654699e-01f, 4.954771363e-01f },
+        { 1.133538628e+00f, 1.084252891e+00f, 5.321429593e-01f, 1.084252891e+00f, 6.656815874e-01f },
+    } },
+    { { /* 70 % */
+        { 1.001102323e+00f, -1.997765374e+00f, 9.966825374e-01f, -1.997765374e+00f, 9.977848600e-01f },
+        { 1.002587876e+00f, -1.995743830e+00f, 9.932338206e-01f, -1.995743830e+00f, 9.958216968e-01f },
+        { 1.005206233e+00f, -1.991278344e+00f, 9.863879469e-01f, -1.991278344e+00f, 9.915941802e-01f },
+        { 1.010367257e+00f, -1.982003396e+00f, 9.728940987e-01f, -1.982003396e+00f, 9.832613552e-01f },
+        { 1.017471917e+00f, -1.959906181e+00f, 9.474179088e-01f, -1.959906181e+00f, 9.648898256e-01f },
+        { 1.011120683e+00f, -1.894706582e+00f, 9.029805824e-01f, -1.894706582e+00f, 9.141012650e-01f },
+        { 8.539537363e-01f, -1.569165385e+00f, 7.811467019e-01f, -1.569165385e+00f, 6.351004382e-01f },
+        { 8.938725270e-01f, -1.325638059e+00f, 6.806071970e-01f, -1.325638059e+00f, 5.744797240e-01f },
+        { 9.723299701e-01f, -6.229458142e-01f, 5.187915262e-01f, -6.229458142e-01f, 4.911214963e-01f },
+        { 1.130721475e+00f, 1.083207574e+00f, 5.333542448e-01f, 1.083207574e+00f, 6.640757200e-01f },
+    } },
+    { { /* 71 % */
+        { 1.001083237e+00f, -1.997752600e+00f, 9.966888491e-01f, -1.997752600e+00f, 9.977720862e-01f },
+        { 1.002548939e+00f, -1.995719760e+00f, 9.932486870e-01f, -1.995719760e+00f, 9.957976259e-01f },
+        { 1.005127837e+00f, -1.991230029e+00f, 9.864180206e-01f, -1.991230029e+00f, 9.915458580e-01f },
+        { 1.010210900e+00f, -1.981907637e+00f, 9.729546354e-01f, -1.981907637e+00f, 9.831655354e-01f },
+        { 1.017167778e+00f, -1.959707571e+00f, 9.475229330e-01f, -1.959707571e+00f, 9.646907108e-01f },
+        { 1.010559757e+00f, -1.894236907e+00f, 9.030670255e-01f, -1.894236907e+00f, 9.136267824e-01f },
+        { 8.517375892e-01f, -1.565857247e+00f, 7.799157059e-01f, -1.565857247e+00f, 6.316532951e-01f },
+        { 8.921646375e-01f, -1.324011805e+00f, 6.803835607e-01f, -1.324011805e+00f, 5.725481982e-01f },
+        { 9.696040860e-01f, -6.220321150e-01f, 5.193303237e-01f, -6.220321150e-01f, 4.889344097e-01f },
+        { 1.127913365e+00f, 1.082158252e+00f, 5.345503367e-01f, 1.082158252e+00f, 6.624637021e-01f },
+    } },
+    { { /* 72 % */
+        { 1.001064188e+00f, -1.997739753e+00f, 9.966950512e-01f, -1.997739753e+00f, 9.977592387e-01f },
+        { 1.002510087e+00f, -1.995695551e+00f, 9.932633298e-01f, -1.995695551e+00f, 9.957734166e-01f },
+        { 1.005049615e+00f, -1.991181438e+00f, 9.864476446e-01f, -1.991181438e+00f, 9.914972592e-01f },
+        { 1.010054894e+00f, -1.981811334e+00f, 9.730142776e-01f, -1.981811334e+00f, 9.830691717e-01f },
+        { 1.016864259e+00f, -1.959507855e+00f, 9.476262277e-01f, -1.959507855e+00f, 9.644904872e-01f },
+        { 1.009999445e+00f, -1.893764755e+00f, 9.031503531e-01f, -1.893764755e+00f, 9.131497978e-01f },
+        { 8.495148219e-01f, -1.562524964e+00f, 7.786661706e-01f, -1.562524964e+00f, 6.281809925e-01f },
+        { 8.904581391e-01f, -1.322380182e+00f, 6.801521567e-01f, -1.322380182e+00f, 5.706102958e-01f },
+        { 9.668854609e-01f, -6.211158406e-01f, 5.198556980e-01f, -6.211158406e-01f, 4.867411589e-01f },
+        { 1.125114226e+00f, 1.081104922e+00f, 5.357312988e-01f, 1.081104922e+00f, 6.608455251e-01f },
+    } },
+    { { /* 73 % */
+        { 1.001045173e+00f, -1.997726832e+00f, 9.967011437e-01f, -1.997726832e+00f, 9.977463172e-01f },
+        { 1.002471319e+00f, -1.995671204e+00f, 9.932777495e-01f, -1.995671204e+00f, 9.957490681e-01f },
+        { 1.004971562e+00f, -1.991132569e+00f, 9.864768201e-01f, -1.991132569e+00f, 9.914483823e-01f },
+        { 1.009899234e+00f, -1.981714485e+00f, 9.730730274e-01f, -1.981714485e+00f, 9.829722611e-01f },
+        { 1.016561352e+00f, -1.959307027e+00f, 9.477277969e-01f, -1.959307027e+00f, 9.642891489e-01f },
+        { 1.009439729e+00f, -1.893290115e+00f, 9.032305699e-01f, -1.893290115e+00f, 9.126702993e-01f },
+        { 8.472853459e-01f, -1.559168494e+00f, 7.773981407e-01f, -1.559168494e+00f, 6.246834866e-01f },
+        { 8.887530065e-01f, -1.320743191e+00f, 6.799130110e-01f, -1.320743191e+00f, 5.686660176e-01f },
+        { 9.641740417e-01f, -6.201969953e-01f, 5.203677125e-01f, -6.201969953e-01f, 4.845417541e-01f },
+        { 1.122323986e+00f, 1.080047577e+00f, 5.368971943e-01f, 1.080047577e+00f, 6.592211806e-01f },
+    } },
+    { { /* 74 % */
+        { 1.001026194e+00f, -1.997713836e+00f, 9.967071270e-01f, -1.997713836e+00f, 9.977333213e-01f },
+        { 1.002432633e+00f, -1.995646716e+00f, 9.932919465e-01f, -1.995646716e+00f, 9.957245797e-01f },
+        { 1.004893678e+00f, -1.991083420e+00f, 9.865055479e-01f, -1.991083420e+00f, 9.913992255e-01f },
+        { 1.009743914e+00f, -1.981617086e+00f, 9.731308868e-01f, -1.981617086e+00f, 9.828748006e-01f },
+        { 1.016259046e+00f, -1.959105082e+00f, 9.478276441e-01f, -1.959105082e+00f, 9.640866899e-01f },
+        { 1.008880594e+00f, -1.892812975e+00f, 9.033076806e-01f, -1.892812975e+00f, 9.121882750e-01f },
+        { 8.450490749e-01f, -1.555787798e+00f, 7.761116616e-01f, -1.555787798e+00f, 6.211607364e-01f },
+        { 8.870492147e-01f, -1.319100833e+00f, 6.796661496e-01f, -1.319100833e+00f, 5.667153643e-01f },
+        { 9.614697760e-01f, -6.192755836e-01f, 5.208664301e-01f, -6.192755836e-01f, 4.823362062e-01f },
+        { 1.119542574e+00f, 1.078986212e+00f, 5.380480865e-01f, 1.078986212e+00f, 6.575906604e-01f },
+    } },
+    { { /* 75 % */
+        { 1.001007249e+00f, -1.997700765e+00f, 9.967130013e-01f, -1.997700765e+00f, 9.977202505e-01f },
+        { 1.002394029e+00f, -1.995622088e+00f, 9.933059215e-01f, -1.995622088e+00f, 9.956999505e-01f },
+        { 1.004815958e+00f, -1.991033990e+00f, 9.865338291e-01f, -1.991033990e+00f, 9.913497875e-01f },
+        { 1.009588929e+00f, -1.981519135e+00f, 9.731878578e-01f, -1.981519135e+00f, 9.827767871e-01f },
+        { 1.015957331e+00f, -1.958902012e+00f, 9.479257730e-01f, -1.958902012e+00f, 9.638831041e-01f },
+        { 1.008322023e+00f, -1.892333323e+00f, 9.033816896e-01f, -1.892333323e+00f, 9.117037130e-01f },
+        { 8.428059246e-01f, -1.552382839e+00f, 7.748067790e-01f, -1.552382839e+00f, 6.176127036e-01f },
+        { 8.853467389e-01f, -1.317453108e+00f, 6.794115982e-01f, -1.317453108e+00f, 5.647583371e-01f },
+        { 9.587726120e-01f, -6.183516099e-01f, 5.213519138e-01f, -6.183516099e-01f, 4.801245259e-01f },
+        { 1.116769918e+00f, 1.077920821e+00f, 5.391840379e-01f, 1.077920821e+00f, 6.559539564e-01f },
+    } },
+    { { /* 76 % */
+        { 1.000988338e+00f, -1.997687619e+00f, 9.967187666e-01f, -1.997687619e+00f, 9.977071045e-01f },
+        { 1.002355505e+00f, -1.995597318e+00f, 9.933196747e-01f, -1.995597318e+00f, 9.956751797e-01f },
+        { 1.004738402e+00f, -1.990984277e+00f, 9.865616645e-01f, -1.990984277e+00f, 9.913000665e-01f },
+        { 1.009434275e+00f, -1.981420628e+00f, 9.732439423e-01f, -1.981420628e+00f, 9.826782176e-01f },
+        { 1.015656198e+00f, -1.958697813e+00f, 9.480221874e-01f, -1.958697813e+00f, 9.636783856e-01f },
+        { 1.007764000e+00f, -1.891851147e+00f, 9.034526015e-01f, -1.891851147e+00f, 9.112166012e-01f },
+        { 8.405558130e-01f, -1.548953583e+00f, 7.734835397e-01f, -1.548953583e+00f, 6.140393527e-01f },
+        { 8.836455545e-01f, -1.315800017e+00f, 6.791493827e-01f, -1.315800017e+00f, 5.627949372e-01f },
+        { 9.560824981e-01f, -6.174250791e-01f, 5.218242264e-01f, -6.174250791e-01f, 4.779067245e-01f },
+        { 1.114005949e+00f, 1.076851401e+00f, 5.403051112e-01f, 1.076851401e+00f, 6.543110605e-01f },
+    } },
+    { { /* 77 % */
+        { 1.000969459e+00f, -1.997674398e+00f, 9.967244233e-01f, -1.997674398e+00f, 9.976938827e-01f },
+        { 1.002317060e+00f, -1.995572406e+00f, 9.933332067e-01f, -1.995572406e+00f, 9.956502665e-01f },
+        { 1.004661006e+00f, -1.990934279e+00f, 9.865890553e-01f, -1.990934279e+00f, 9.912500610e-01f },
+        { 1.009279946e+00f, -1.981321562e+00f, 9.732991424e-01f, -1.981321562e+00f, 9.825790889e-01f },
+        { 1.015355638e+00f, -1.958492478e+00f, 9.481168906e-01f, -1.958492478e+00f, 9.634725283e-01f },
+        { 1.007206507e+00f, -1.891366435e+00f, 9.035204207e-01f, -1.891366435e+00f, 9.107269276e-01f },
+        { 8.382986601e-01f, -1.545499998e+00f, 7.721419909e-01f, -1.545499998e+00f, 6.104406510e-01f },
+        { 8.819456372e-01f, -1.314141562e+00f, 6.788795290e-01f, -1.314141562e+00f, 5.608251662e-01f },
+        { 9.533993832e-01f, -6.164959957e-01f, 5.222834302e-01f, -6.164959957e-01f, 4.756828134e-01f },
+        { 1.111250597e+00f, 1.075777944e+00f, 5.414113684e-01f, 1.075777944e+00f, 6.526619649e-01f },
+    } },
+    { { /* 78 % */
+        { 1.000950613e+00f, -1.997661100e+00f, 9.967299715e-01f, -1.997661100e+00f, 9.976805848e-01f },
+        { 1.002278692e+00f, -1.995547351e+00f, 9.933465179e-01f, -1.995547351e+00f, 9.956252102e-01f },
+        { 1.004583767e+00f, -1.990883996e+00f, 9.866160021e-01f, -1.990883996e+00f, 9.911997693e-01f },
+        { 1.009125938e+00f, -1.981221935e+00f, 9.733534599e-01f, -1.981221935e+00f, 9.824793979e-01f },
+        { 1.015055640e+00f, -1.958286001e+00f, 9.482098862e-01f, -1.958286001e+00f, 9.632655261e-01f },
+        { 1.006649529e+00f, -1.890879175e+00f, 9.035851515e-01f, -1.890879175e+00f, 9.102346801e-01f },
+        { 8.360343882e-01f, -1.542022056e+00f, 7.707821807e-01f, -1.542022056e+00f, 6.068165689e-01f },
+        { 8.802469630e-01f, -1.312477745e+00f, 6.786020628e-01f, -1.312477745e+00f, 5.588490258e-01f },
+        { 9.507232166e-01f, -6.155643649e-01f, 5.227295877e-01f, -6.155643649e-01f, 4.734528043e-01f },
+        { 1.108503791e+00f, 1.074700447e+00f, 5.425028713e-01f, 1.074700447e+00f, 6.510066620e-01f },
+    } },
+    { { /* 79 % */
+        { 1.000931799e+00f, -1.997647725e+00f, 9.967354113e-01f, -1.997647725e+00f, 9.976672103e-01f },
+        { 1.002240401e+00f, -1.995522151e+00f, 9.933596088e-01f, -1.995522151e+00f, 9.956000098e-01f },
+        { 1.004506684e+00f, -1.990833424e+00f, 9.866425061e-01f, -1.990833424e+00f, 9.911491898e-01f },
+        { 1.008972245e+00f, -1.981121742e+00f, 9.734068968e-01f, -1.981121742e+00f, 9.823791416e-01f },
+        { 1.014756195e+00f, -1.958078376e+00f, 9.483011778e-01f, -1.958078376e+00f, 9.630573729e-01f },
+        { 1.006093048e+00f, -1.890389356e+00f, 9.036467981e-01f, -1.890389356e+00f, 9.097398466e-01f },
+        { 8.337629217e-01f, -1.538519732e+00f, 7.694041580e-01f, -1.538519732e+00f, 6.031670796e-01f },
+        { 8.785495080e-01f, -1.310808566e+00f, 6.783170099e-01f, -1.310808566e+00f, 5.568665179e-01f },
+        { 9.480539482e-01f, -6.146301915e-01f, 5.231627611e-01f, -6.146301915e-01f, 4.712167093e-01f },
+        { 1.105765463e+00f, 1.073618905e+00f, 5.435796816e-01f, 1.073618905e+00f, 6.493451443e-01f },
+    } },
+    { { /* 80 % */
+        { 1.000913016e+00f, -1.997634274e+00f, 9.967407431e-01f, -1.997634274e+00f, 9.976537587e-01f },
+        { 1.002202185e+00f, -1.995496807e+00f, 9.933724798e-01f, -1.995496807e+00f, 9.955746646e-01f },
+        { 1.004429753e+00f, -1.990782563e+00f, 9.866685681e-01f, -1.990782563e+00f, 9.910983210e-01f },
+        { 1.008818862e+00f, -1.981020981e+00f, 9.734594548e-01f, -1.981020981e+00f, 9.822783166e-01f },
+        { 1.014457294e+00f, -1.957869596e+00f, 9.483907686e-01f, -1.957869596e+00f, 9.628480625e-01f },
+        { 1.005537050e+00f, -1.889896964e+00f, 9.037053648e-01f, -1.889896964e+00f, 9.092424149e-01f },
+        { 8.314841872e-01f, -1.534993002e+00f, 7.680079723e-01f, -1.534993002e+00f, 5.994921595e-01f },
+        { 8.768532487e-01f, -1.309134028e+00f, 6.780243961e-01f, -1.309134028e+00f, 5.548776447e-01f },
+        { 9.453915282e-01f, -6.136934807e-01f, 5.235830124e-01f, -6.136934807e-01f, 4.689745406e-01f },
+        { 1.103035544e+00f, 1.072533312e+00f, 5.446418604e-01f, 1.072533312e+00f, 6.476774043e-01f },
+    } },
+    { { /* 81 % */
+        { 1.000894263e+00f, -1.997620745e+00f, 9.967459669e-01f, -1.997620745e+00f, 9.976402297e-01f },
+        { 1.002202185e+00f, -1.995496807e+00f, 9.933724798e-01f, -1.995496807e+00f, 9.955746646e-01f },
+        { 1.004429753e+00f, -1.990782563e+00f, 9.866685681e-01f, -1.990782563e+00f, 9.910983210e-01f },
+        { 1.008513007e+00f, -1.980817742e+00f, 9.735619416e-01f, -1.980817742e+00f, 9.820749484e-01f },
+        { 1.014158927e+00f, -1.957659656e+00f, 9.484786620e-01f, -1.957659656e+00f, 9.626375888e-01f },
+        { 1.004981517e+00f, -1.889401989e+00f, 9.037608555e-01f, -1.889401989e+00f, 9.087423728e-01f },
+        { 8.291981138e-01f, -1.531441847e+00f, 7.665936741e-01f, -1.531441847e+00f, 5.957917879e-01f },
+        { 8.751581618e-01f, -1.307454133e+00f, 6.777242470e-01f, -1.307454133e+00f, 5.528824087e-01f },
+        { 9.400870365e-01f, -6.118124678e-01f, 5.243849957e-01f, -6.118124678e-01f, 4.644720323e-01f },
+        { 1.097600662e+00f, 1.070349957e+00f, 5.467225673e-01f, 1.070349957e+00f, 6.443232288e-01f },
+    } },
+    { { /* 82 % */
+        { 1.000875540e+00f, -1.997607138e+00f, 9.967510829e-01f, -1.997607138e+00f, 9.976266228e-01f },
+        { 1.002202185e+00f, -1.995496807e+00f, 9.933724798e-01f, -1.995496807e+00f, 9.955746646e-01f },
+        { 1.004429753e+00f, -1.990782563e+00f, 9.866685681e-01f, -1.990782563e+00f, 9.910983210e-01f },
+        { 1.008208333e+00f, -1.980612191e+00f, 9.736609347e-01f, -1.980612191e+00f, 9.818692677e-01f },
+        { 1.013861084e+00f, -1.957448550e+00f, 9.485648613e-01f, -1.957448550e+00f, 9.624259455e-01f },
+        { 1.004426434e+00f, -1.888904417e+00f, 9.038132744e-01f, -1.888904417e+00f, 9.082397081e-01f },
+        { 8.269046323e-01f, -1.527866250e+00f, 7.651613149e-01f, -1.527866250e+00f, 5.920659472e-01f },
+        { 8.734642242e-01f, -1.305768883e+00f, 6.774165883e-01f, -1.305768883e+00f, 5.508808124e-01f },
+        { 9.348093524e-01f, -6.099213695e-01f, 5.251360305e-01f, -6.099213695e-01f, 4.599453828e-01f },
+        { 1.092198603e+00f, 1.068150345e+00f, 5.487454761e-01f, 1.068150345e+00f, 6.409440795e-01f },
+    } },
+    { { /* 83 % */
+        { 1.000856846e+00f, -1.997593453e+00f, 9.967560914e-01f, -1.997593453e+00f, 9.976129375e-01f },
+        { 1.002202185e+00f, -1.995496807e+00f, 9.933724798e-01f, -1.995496807e+00f, 9.955746646e-01f },
+        { 1.004429753e+00f, -1.990782563e+00f, 9.866685681e-01f, -1.990782563e+00f, 9.910983210e-01f },
+        { 1.007904801e+00f, -1.980404304e+00f, 9.737564480e-01f, -1.980404304e+00f, 9.816612487e-01f },
+        { 1.013563757e+00f, -1.957236270e+00f, 9.486493698e-01f, -1.957236270e+00f, 9.622131265e-01f },
+        { 1.003871783e+00f, -1.888404238e+00f, 9.038626253e-01f, -1.888404238e+00f, 9.077344084e-01f },
+        { 8.246036762e-01f, -1.524266197e+00f, 7.637109468e-01f, -1.524266197e+00f, 5.883146230e-01f },
+        { 8.717714132e-01f, -1.304078280e+00f, 6.771014457e-01f, -1.304078280e+00f, 5.488728588e-01f },
+        { 9.295580932e-01f, -6.080202308e-01f, 5.258366068e-01f, -6.080202308e-01f, 4.553947000e-01f },
+        { 1.086828836e+00f, 1.065934442e+00f, 5.507110665e-01f, 1.065934442e+00f, 6.375399029e-01f },
+    } },
+    { { /* 84 % */
+        { 1.000838181e+00f, -1.997579689e+00f, 9.967609924e-01f, -1.997579689e+00f, 9.975991734e-01f },
+        { 1.002202185e+00f, -1.995496807e+00f, 9.933724798e-01f, -1.995496807e+00f, 9.955746646e-01f },
+        { 1.004429753e+00f, -1.990782563e+00f, 9.866685681e-01f, -1.990782563e+00f, 9.910983210e-01f },
+        { 1.007602371e+00f, -1.980194054e+00f, 9.738484947e-01f, -1.980194054e+00f, 9.814508655e-01f },
+        { 1.013266935e+00f, -1.957022812e+00f, 9.487321906e-01f, -1.957022812e+00f, 9.619991253e-01f },
+        { 1.003317550e+00f, -1.887901437e+00f, 9.039089120e-01f, -1.887901437e+00f, 9.072264615e-01f },
+        { 8.222951812e-01f, -1.520641678e+00f, 7.622426231e-01f, -1.520641678e+00f, 5.845378043e-01f },
+        { 8.700797061e-01f, -1.302382327e+00f, 6.767788448e-01f, -1.302382327e+00f, 5.468585509e-01f },
+        { 9.243328835e-01f, -6.061090985e-01f, 5.264872123e-01f, -6.061090985e-01f, 4.508200958e-01f },
+        { 1.081490835e+00f, 1.063702215e+00f, 5.526198136e-01f, 1.063702215e+00f, 6.341106481e-01f },
+    } },
+    { { /* 85 % */
+        { 1.000819544e+00f, -1.997565846e+00f, 9.967657861e-01f, -1.997565846e+00f, 9.975853300e-01f },
+        { 1.002202185e+00f, -1.995496807e+00f, 9.933724798e-01f, -1.995496807e+00f, 9.955746646e-01f },
+        { 1.004429753e+00f, -1.990782563e+00f, 9.866685681e-01f, -1.990782563e+00f, 9.910983210e-01f },
+        { 1.007301004e+00f, -1.979981416e+00f, 9.739370880e-01f, -1.979981416e+00f, 9.812380916e-01f },
+        { 1.012970609e+00f, -1.956808168e+00f, 9.488133269e-01f, -1.956808168e+00f, 9.617839358e-01f },
+        { 1.002763717e+00f, -1.887396005e+00f, 9.039521384e-01f, -1.887396005e+00f, 9.067158550e-01f },
+        { 8.199790851e-01f, -1.516992684e+00f, 7.607563979e-01f, -1.516992684e+00f, 5.807354830e-01f },
+        { 8.683890807e-01f, -1.300681027e+00f, 6.764488113e-01f, -1.300681027e+00f, 5.448378920e-01f },
+        { 9.191333546e-01f, -6.041880211e-01f, 5.270883322e-01f, -6.041880211e-01f, 4.462216868e-01f },
+        { 1.076184078e+00f, 1.061453633e+00f, 5.544721882e-01f, 1.061453633e+00f, 6.306562666e-01f },
+    } },
+    { { /* 86 % */
+        { 1.000800934e+00f, -1.997551923e+00f, 9.967704727e-01f, -1.997551923e+00f, 9.975714069e-01f },
+        { 1.002202185e+00f, -1.995496807e+00f, 9.933724798e-01f, -1.995496807e+00f, 9.955746646e-01f },
+        { 1.004429753e+00f, -1.990782563e+00f, 9.866685681e-01f, -1.990782563e+00f, 9.910983210e-01f },
+        { 1.007000660e+00f, -1.979766361e+00f, 9.740222404e-01f, -1.979766361e+00f, 9.810229003e-01f },
+        { 1.012674770e+00f, -1.956592333e+00f, 9.488927818e-01f, -1.956592333e+00f, 9.615675517e-01f },
+        { 1.002210268e+00f, -1.886887927e+00f, 9.039923081e-01f, -1.886887927e+00f, 9.062025763e-01f },
+        { 8.176553281e-01f, -1.513319212e+00f, 7.592523265e-01f, -1.513319212e+00f, 5.769076546e-01f },
+        { 8.666995150e-01f, -1.298974383e+00f, 6.761113708e-01f, -1.298974383e+00f, 5.428108857e-01f },
+        { 9.139591445e-01f, -6.022570493e-01f, 5.276404492e-01f, -6.022570493e-01f, 4.415995936e-01f },
+        { 1.070908056e+00f, 1.059188664e+00f, 5.562686569e-01f, 1.059188664e+00f, 6.271767129e-01f },
+    } },
+    { { /* 87 % */
+        { 1.000782351e+00f, -1.997537920e+00f, 9.967750524e-01f, -1.997537920e+00f, 9.975574036e-01f },
+        { 1.002202185e+00f, -1.995496807e+00f, 9.933724798e-01f, -1.995496807e+00f, 9.955746646e-01f },
+        { 1.004429753e+00f, -1.990782563e+00f, 9.866685681e-01f, -1.990782563e+00f, 9.910983210e-01f },
+        { 1.006701301e+00f, -1.979548863e+00f, 9.741039638e-01f, -1.979548863e+00f, 9.808052648e-01f },
+        { 1.012379408e+00f, -1.956375300e+00f, 9.489705583e-01f, -1.956375300e+00f, 9.613499664e-01f },
+        { 1.001657188e+00f, -1.886377192e+00f, 9.040294248e-01f, -1.886377192e+00f, 9.056866132e-01f },
+        { 8.153238527e-01f, -1.509621260e+00f, 7.577304649e-01f, -1.509621260e+00f, 5.730543177e-01f },
+        { 8.650109870e-01f, -1.297262398e+00f, 6.757665488e-01f, -1.297262398e+00f, 5.407775358e-01f },
+        { 9.088098980e-01f, -6.003162354e-01f, 5.281440437e-01f, -6.003162354e-01f, 4.369539417e-01f },
+        { 1.065662262e+00f, 1.056907282e+00f, 5.580096821e-01f, 1.056907282e+00f, 6.236719438e-01f },
+    } },
+    { { /* 88 % */
+        { 1.000763794e+00f, -1.997523836e+00f, 9.967795253e-01f, -1.997523836e+00f, 9.975433196e-01f },
+        { 1.002202185e+00f, -1.995496807e+00f, 9.933724798e-01f, -1.995496807e+00f, 9.955746646e-01f },
+        { 1.004429753e+00f, -1.990782563e+00f, 9.866685681e-01f, -1.990782563e+00f, 9.910983210e-01f },
+        { 1.006402888e+00f, -1.979328896e+00f, 9.741822700e-01f, -1.979328896e+00f, 9.805851579e-01f },
+        { 1.012084514e+00f, -1.956157062e+00f, 9.490466594e-01f, -1.956157062e+00f, 9.611311737e-01f },
+        { 1.001104461e+00f, -1.885863787e+00f, 9.040634919e-01f, -1.885863787e+00f, 9.051679530e-01f },
+        { 8.129846039e-01f, -1.505898830e+00f, 7.561908705e-01f, -1.505898830e+00f, 5.691754744e-01f },
+        { 8.633234753e-01f, -1.295545075e+00f, 6.754143710e-01f, -1.295545075e+00f, 5.387378463e-01f },
+        { 9.036852668e-01f, -5.983656334e-01f, 5.285995938e-01f, -5.983656334e-01f, 4.322848606e-01f },
+        { 1.060446197e+00f, 1.054609460e+00f, 5.596957220e-01f, 1.054609460e+00f, 6.201419190e-01f },
+    } },
+    { { /* 89 % */
+        { 1.000745263e+00f, -1.997509671e+00f, 9.967838915e-01f, -1.997509671e+00f, 9.975291546e-01f },
+        { 1.002202185e+00f, -1.995496807e+00f, 9.933724798e-01f, -1.995496807e+00f, 9.955746646e-01f },
+        { 1.004429753e+00f, -1.990782563e+00f, 9.866685681e-01f, -1.990782563e+00f, 9.910983210e-01f },
+        { 1.006105382e+00f, -1.979106431e+00f, 9.742571703e-01f, -1.979106431e+00f, 9.803625520e-01f },
+        { 1.011790079e+00f, -1.955937613e+00f, 9.491210880e-01f, -1.955937613e+00f, 9.609111671e-01f },
+        { 1.000552070e+00f, -1.885347700e+00f, 9.040945130e-01f, -1.885347700e+00f, 9.046465832e-01f },
+        { 8.106375287e-01f, -1.502151928e+00f, 7.546336015e-01f, -1.502151928e+00f, 5.652711302e-01f },
+        { 8.616369585e-01f, -1.293822418e+00f, 6.750548629e-01f, -1.293822418e+00f, 5.366918215e-01f },
+        { 8.985849088e-01f, -5.964052994e-01f, 5.290075756e-01f, -5.964052994e-01f, 4.275924844e-01f },
+        { 1.055259370e+00f, 1.052295174e+00f, 5.613272309e-01f, 1.052295174e+00f, 6.165866011e-01f },
+    } },
+    { { /* 90 % */
+        { 1.000726757e+00f, -1.997495425e+00f, 9.967881512e-01f, -1.997495425e+00f, 9.975149079e-01f },
+        { 1.002202185e+00f, -1.995496807e+00f, 9.933724798e-01f, -1.995496807e+00f, 9.955746646e-01f },
+        { 1.004429753e+00f, -1.990782563e+00f, 9.866685681e-01f, -1.990782563e+00f, 9.910983210e-01f },
+        { 1.005808744e+00f, -1.978881441e+00f, 9.743286752e-01f, -1.978881441e+00f, 9.801374193e-01f },
+        { 1.011496093e+00f, -1.955716948e+00f, 9.491938471e-01f, -1.955716948e+00f, 9.606899402e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 8.082825767e-01f, -1.498380562e+00f, 7.530587175e-01f, -1.498380562e+00f, 5.613412943e-01f },
+        { 8.599514157e-01f, -1.292094431e+00f, 6.746880501e-01f, -1.292094431e+00f, 5.346394658e-01f },
+        { 8.935084888e-01f, -5.944352913e-01f, 5.293684628e-01f, -5.944352913e-01f, 4.228769516e-01f },
+        { 1.050101296e+00f, 1.049964401e+00f, 5.629046592e-01f, 1.049964401e+00f, 6.130059554e-01f },
+    } },
+    { { /* 91 % */
+        { 1.000708275e+00f, -1.997481096e+00f, 9.967923046e-01f, -1.997481096e+00f, 9.975005793e-01f },
+        { 1.002164042e+00f, -1.995471317e+00f, 9.933851314e-01f, -1.995471317e+00f, 9.955491737e-01f },
+        { 1.004352972e+00f, -1.990731412e+00f, 9.866941890e-01f, -1.990731412e+00f, 9.910471610e-01f },
+        { 1.005660739e+00f, -1.978767991e+00f, 9.743631578e-01f, -1.978767991e+00f, 9.800238967e-01f },
+        { 1.011202547e+00f, -1.955495058e+00f, 9.492649394e-01f, -1.955495058e+00f, 9.604674865e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 8.071021318e-01f, -1.496485708e+00f, 7.522646888e-01f, -1.496485708e+00f, 5.593668206e-01f },
+        { 8.582668259e-01f, -1.290361117e+00f, 6.743139581e-01f, -1.290361117e+00f, 5.325807840e-01f },
+        { 8.909791526e-01f, -5.934466781e-01f, 5.295313934e-01f, -5.934466781e-01f, 4.205105460e-01f },
+        { 1.047532892e+00f, 1.048792826e+00f, 5.636732328e-01f, 1.048792826e+00f, 6.112061245e-01f },
+    } },
+    { { /* 92 % */
+        { 1.000689816e+00f, -1.997466685e+00f, 9.967963517e-01f, -1.997466685e+00f, 9.974861681e-01f },
+        { 1.002125972e+00f, -1.995445681e+00f, 9.933975639e-01f, -1.995445681e+00f, 9.955235363e-01f },
+        { 1.004276339e+00f, -1.990679967e+00f, 9.867193696e-01f, -1.990679967e+00f, 9.909957084e-01f },
+        { 1.005512937e+00f, -1.978653898e+00f, 9.743967953e-01f, -1.978653898e+00f, 9.799097319e-01f },
+        { 1.010909432e+00f, -1.955271938e+00f, 9.493343677e-01f, -1.955271938e+00f, 9.602437995e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 8.059196999e-01f, -1.494584743e+00f, 7.514662791e-01f, -1.494584743e+00f, 5.573859790e-01f },
+        { 8.565831685e-01f, -1.288622482e+00f, 6.739326125e-01f, -1.288622482e+00f, 5.305157810e-01f },
+        { 8.884556782e-01f, -5.924556689e-01f, 5.296827271e-01f, -5.924556689e-01f, 4.181384052e-01f },
+        { 1.044971497e+00f, 1.047617121e+00f, 5.644284534e-01f, 1.047617121e+00f, 6.093999501e-01f },
+    } },
+    { { /* 93 % */
+        { 1.000671381e+00f, -1.997452191e+00f, 9.968002928e-01f, -1.997452191e+00f, 9.974716739e-01f },
+        { 1.002087974e+00f, -1.995419897e+00f, 9.934097778e-01f, -1.995419897e+00f, 9.954977516e-01f },
+        { 1.004199851e+00f, -1.990628228e+00f, 9.867441108e-01f, -1.990628228e+00f, 9.909439615e-01f },
+        { 1.005365332e+00f, -1.978539161e+00f, 9.744295892e-01f, -1.978539161e+00f, 9.797949212e-01f },
+        { 1.010616738e+00f, -1.955047582e+00f, 9.494021348e-01f, -1.955047582e+00f, 9.600188726e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 8.047352752e-01f, -1.492677670e+00f, 7.506634962e-01f, -1.492677670e+00f, 5.553987715e-01f },
+        { 8.549004234e-01f, -1.286878528e+00f, 6.735440387e-01f, -1.286878528e+00f, 5.284444621e-01f },
+        { 8.859380254e-01f, -5.914622714e-01f, 5.298225225e-01f, -5.914622714e-01f, 4.157605479e-01f },
+        { 1.042417052e+00f, 1.046437285e+00f, 5.651703762e-01f, 1.046437285e+00f, 6.075874284e-01f },
+    } },
+    { { /* 94 % */
+        { 1.000652968e+00f, -1.997437613e+00f, 9.968041279e-01f, -1.997437613e+00f, 9.974570963e-01f },
+        { 1.002050045e+00f, -1.995393965e+00f, 9.934217735e-01f, -1.995393965e+00f, 9.954718187e-01f },
+        { 1.004123505e+00f, -1.990576194e+00f, 9.867684135e-01f, -1.990576194e+00f, 9.908919185e-01f },
+        { 1.005217921e+00f, -1.978423774e+00f, 9.744615405e-01f, -1.978423774e+00f, 9.796794611e-01f },
+        { 1.010324456e+00f, -1.954821982e+00f, 9.494682434e-01f, -1.954821982e+00f, 9.597926992e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 8.035488524e-01f, -1.490764489e+00f, 7.498563480e-01f, -1.490764489e+00f, 5.534052004e-01f },
+        { 8.532185704e-01f, -1.285129262e+00f, 6.731482624e-01f, -1.285129262e+00f, 5.263668328e-01f },
+        { 8.834261546e-01f, -5.904664936e-01f, 5.299508382e-01f, -5.904664936e-01f, 4.133769927e-01f },
+        { 1.039869500e+00f, 1.045253314e+00f, 5.658990563e-01f, 1.045253314e+00f, 6.057685563e-01f },
+    } },
+    { { /* 95 % */
+        { 1.000634578e+00f, -1.997422952e+00f, 9.968078572e-01f, -1.997422952e+00f, 9.974424347e-01f },
+        { 1.002012185e+00f, -1.995367884e+00f, 9.934335514e-01f, -1.995367884e+00f, 9.954457367e-01f },
+        { 1.004047299e+00f, -1.990523861e+00f, 9.867922784e-01f, -1.990523861e+00f, 9.908395778e-01f },
+        { 1.005070698e+00f, -1.978307734e+00f, 9.744926504e-01f, -1.978307734e+00f, 9.795633481e-01f },
+        { 1.010032577e+00f, -1.954595133e+00f, 9.495326961e-01f, -1.954595133e+00f, 9.595652728e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 8.023604261e-01f, -1.488845204e+00f, 7.490448423e-01f, -1.488845204e+00f, 5.514052684e-01f },
+        { 8.515375896e-01f, -1.283374687e+00f, 6.727453091e-01f, -1.283374687e+00f, 5.242828987e-01f },
+        { 8.809200265e-01f, -5.894683435e-01f, 5.300677325e-01f, -5.894683435e-01f, 4.109877590e-01f },
+        { 1.037328782e+00f, 1.044065208e+00f, 5.666145484e-01f, 1.044065208e+00f, 6.039433306e-01f },
+    } },
+    { { /* 96 % */
+        { 1.000616208e+00f, -1.997408206e+00f, 9.968114808e-01f, -1.997408206e+00f, 9.974276887e-01f },
+        { 1.001974393e+00f, -1.995341653e+00f, 9.934451119e-01f, -1.995341653e+00f, 9.954195049e-01f },
+        { 1.003971231e+00f, -1.990471229e+00f, 9.868157065e-01f, -1.990471229e+00f, 9.907869377e-01f },
+        { 1.004923658e+00f, -1.978191039e+00f, 9.745229202e-01f, -1.978191039e+00f, 9.794465785e-01f },
+        { 1.009741091e+00f, -1.954367027e+00f, 9.495954954e-01f, -1.954367027e+00f, 9.593365866e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 8.011699911e-01f, -1.486919817e+00f, 7.482289872e-01f, -1.486919817e+00f, 5.493989783e-01f },
+        { 8.498574616e-01f, -1.281614809e+00f, 6.723352042e-01f, -1.281614809e+00f, 5.221926657e-01f },
+        { 8.784196023e-01f, -5.884678290e-01f, 5.301732637e-01f, -5.884678290e-01f, 4.085928660e-01f },
+        { 1.034794841e+00f, 1.042872965e+00f, 5.673169071e-01f, 1.042872965e+00f, 6.021117483e-01f },
+    } },
+    { { /* 97 % */
+        { 1.000597859e+00f, -1.997393375e+00f, 9.968149988e-01f, -1.997393375e+00f, 9.974128578e-01f },
+        { 1.001936667e+00f, -1.995315272e+00f, 9.934564554e-01f, -1.995315272e+00f, 9.953931223e-01f },
+        { 1.003895298e+00f, -1.990418297e+00f, 9.868386984e-01f, -1.990418297e+00f, 9.907339965e-01f },
+        { 1.004776798e+00f, -1.978073683e+00f, 9.745523508e-01f, -1.978073683e+00f, 9.793291487e-01f },
+        { 1.009449990e+00f, -1.954137657e+00f, 9.496566439e-01f, -1.954137657e+00f, 9.591066341e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 7.999775423e-01f, -1.484988331e+00f, 7.474087907e-01f, -1.484988331e+00f, 5.473863331e-01f },
+        { 8.481781669e-01f, -1.279849633e+00f, 6.719179732e-01f, -1.279849633e+00f, 5.200961401e-01f },
+        { 8.759248435e-01f, -5.874649586e-01f, 5.302674901e-01f, -5.874649586e-01f, 4.061923336e-01f },
+        { 1.032267620e+00f, 1.041676581e+00f, 5.680061868e-01f, 1.041676581e+00f, 6.002738067e-01f },
+    } },
+    { { /* 98 % */
+        { 1.000579530e+00f, -1.997378459e+00f, 9.968184114e-01f, -1.997378459e+00f, 9.973979415e-01f },
+        { 1.001899006e+00f, -1.995288739e+00f, 9.934675823e-01f, -1.995288739e+00f, 9.953665881e-01f },
+        { 1.003819498e+00f, -1.990365061e+00f, 9.868612550e-01f, -1.990365061e+00f, 9.906807526e-01f },
+        { 1.004630111e+00f, -1.977955665e+00f, 9.745809435e-01f, -1.977955665e+00f, 9.792110550e-01f },
+        { 1.009159264e+00f, -1.953907018e+00f, 9.497161441e-01f, -1.953907018e+00f, 9.588754084e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 7.987830750e-01f, -1.483050749e+00f, 7.465842610e-01f, -1.483050749e+00f, 5.453673360e-01f },
+        { 8.464996865e-01f, -1.278079164e+00f, 6.714936418e-01f, -1.278079164e+00f, 5.179933283e-01f },
+        { 8.734357119e-01f, -5.864597405e-01f, 5.303504696e-01f, -5.864597405e-01f, 4.037861815e-01f },
+        { 1.029747062e+00f, 1.040476057e+00f, 5.686824415e-01f, 1.040476057e+00f, 5.984295032e-01f },
+    } },
+    { { /* 99 % */
+        { 1.000561221e+00f, -1.997363457e+00f, 9.968217186e-01f, -1.997363457e+00f, 9.973829393e-01f },
+        { 1.001861409e+00f, -1.995262053e+00f, 9.934784929e-01f, -1.995262053e+00f, 9.953399015e-01f },
+        { 1.003743827e+00f, -1.990311521e+00f, 9.868833771e-01f, -1.990311521e+00f, 9.906272041e-01f },
+        { 1.004483594e+00f, -1.977836979e+00f, 9.746086992e-01f, -1.977836979e+00f, 9.790922937e-01f },
+        { 1.008868905e+00f, -1.953675102e+00f, 9.497739985e-01f, -1.953675102e+00f, 9.586429030e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 7.975865843e-01f, -1.481107076e+00f, 7.457554063e-01f, -1.481107076e+00f, 5.433419905e-01f },
+        { 8.448220016e-01f, -1.276303408e+00f, 6.710622354e-01f, -1.276303408e+00f, 5.158842370e-01f },
+        { 8.709521700e-01f, -5.854521832e-01f, 5.304222602e-01f, -5.854521832e-01f, 4.013744302e-01f },
+        { 1.027233110e+00f, 1.039271390e+00f, 5.693457251e-01f, 1.039271390e+00f, 5.965788354e-01f },
+    } },
+    { { /* 100 % */
+        { 1.000542930e+00f, -1.997348369e+00f, 9.968249206e-01f, -1.997348369e+00f, 9.973678508e-01f },
+        { 1.001823874e+00f, -1.995235214e+00f, 9.934891876e-01f, -1.995235214e+00f, 9.953130615e-01f },
+        { 1.003668284e+00f, -1.990257675e+00f, 9.869050654e-01f, -1.990257675e+00f, 9.905733494e-01f },
+        { 1.004337242e+00f, -1.977717622e+00f, 9.746356191e-01f, -1.977717622e+00f, 9.789728612e-01f },
+        { 1.008578902e+00f, -1.953441903e+00f, 9.498302093e-01f, -1.953441903e+00f, 9.584091109e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 7.963880656e-01f, -1.479157313e+00f, 7.449222348e-01f, -1.479157313e+00f, 5.413103004e-01f },
+        { 8.431450936e-01f, -1.274522371e+00f, 6.706237795e-01f, -1.274522371e+00f, 5.137688730e-01f },
+        { 8.684741805e-01f, -5.844422952e-01f, 5.304829196e-01f, -5.844422952e-01f, 3.989571001e-01f },
+        { 1.024725710e+00f, 1.038062578e+00f, 5.699960914e-01f, 1.038062578e+00f, 5.947218011e-01f },
+    } },
+};
+
+static const loudness_coefs_t s_loudness_48000[LOUDNESS_STEPS] = {
+    { { /* 0 % */
+        { 1.001748277e+00f, -1.998366477e+00f, 9.966346535e-01f, -1.998366477e+00f, 9.983829303e-01f },
+        { 1.003493700e+00f, -1.996702741e+00f, 9.932747999e-01f, -1.996702741e+00f, 9.967685000e-01f },
+        { 1.007031969e+00f, -1.993228923e+00f, 9.864638073e-01f, -1.993228923e+00f, 9.934957762e-01f },
+        { 1.012480908e+00f, -1.985209044e+00f, 9.737916107e-01f, -1.985209044e+00f, 9.862725191e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.026107522e+00f, -1.916373332e+00f, 9.068021191e-01f, -1.916373332e+00f, 9.329096415e-01f },
+        { 9.040598471e-01f, -1.660793347e+00f, 8.153199459e-01f, -1.660793347e+00f, 7.193797930e-01f },
+        { 9.491679033e-01f, -1.430587006e+00f, 7.027316824e-01f, -1.430587006e+00f, 6.518995856e-01f },
+        { 1.055640062e+00f, -7.851116213e-01f, 5.145831806e-01f, -7.851116213e-01f, 5.702232426e-01f },
+        { 1.177738643e+00f, 8.214152788e-01f, 4.650919146e-01f, 8.214152788e-01f, 6.428305576e-01f },
+    } },
+    { { /* 1 % */
+        { 1.001740529e+00f, -1.998362752e+00f, 9.966386764e-01f, -1.998362752e+00f, 9.983792056e-01f },
+        { 1.003478211e+00f, -1.996695304e+00f, 9.932828516e-01f, -1.996695304e+00f, 9.967610627e-01f },
+        { 1.007000767e+00f, -1.993213980e+00f, 9.864800645e-01f, -1.993213980e+00f, 9.934808313e-01f },
+        { 1.012450645e+00f, -1.985193348e+00f, 9.738061696e-01f, -1.985193348e+00f, 9.862568144e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.025999237e+00f, -1.916299281e+00f, 9.068357149e-01f, -1.916299281e+00f, 9.328349518e-01f },
+        { 9.036655101e-01f, -1.660256340e+00f, 8.151583325e-01f, -1.660256340e+00f, 7.188238425e-01f },
+        { 9.488358850e-01f, -1.430300233e+00f, 7.027325643e-01f, -1.430300233e+00f, 6.515684493e-01f },
+        { 1.055067610e+00f, -7.849173214e-01f, 5.147670324e-01f, -7.849173214e-01f, 5.698346428e-01f },
+        { 1.176434807e+00f, 8.210772575e-01f, 4.657197079e-01f, 8.210772575e-01f, 6.421545149e-01f },
+    } },
+    { { /* 2 % */
+        { 1.001732791e+00f, -1.998359019e+00f, 9.966426815e-01f, -1.998359019e+00f, 9.983754723e-01f },
+        { 1.003462741e+00f, -1.996687850e+00f, 9.932908677e-01f, -1.996687850e+00f, 9.967536083e-01f },
+        { 1.006969602e+00f, -1.993199003e+00f, 9.864962500e-01f, -1.993199003e+00f, 9.934658521e-01f },
+        { 1.012420398e+00f, -1.985177633e+00f, 9.738206938e-01f, -1.985177633e+00f, 9.862410917e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.025890993e+00f, -1.916225151e+00f, 9.068691887e-01f, -1.916225151e+00f, 9.327601818e-01f },
+        { 9.032709894e-01f, -1.659718444e+00f, 8.149959817e-01f, -1.659718444e+00f, 7.182669711e-01f },
+        { 9.485039439e-01f, -1.430013245e+00f, 7.027331205e-01f, -1.430013245e+00f, 6.512370645e-01f },
+        { 1.054495500e+00f, -7.847228940e-01f, 5.149502884e-01f, -7.847228940e-01f, 5.694457880e-01f },
+        { 1.175132813e+00f, 8.207387360e-01f, 4.663446593e-01f, 8.207387360e-01f, 6.414774719e-01f },
+    } },
+    { { /* 3 % */
+        { 1.001725062e+00f, -1.998355277e+00f, 9.966466687e-01f, -1.998355277e+00f, 9.983717304e-01f },
+        { 1.003447288e+00f, -1.996680378e+00f, 9.932988483e-01f, -1.996680378e+00f, 9.967461367e-01f },
+        { 1.006938475e+00f, -1.993183991e+00f, 9.865123639e-01f, -1.993183991e+00f, 9.934508387e-01f },
+        { 1.012390168e+00f, -1.985161901e+00f, 9.738351833e-01f, -1.985161901e+00f, 9.862253512e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.025782791e+00f, -1.916150941e+00f, 9.069025406e-01f, -1.916150941e+00f, 9.326853316e-01f },
+        { 9.028762842e-01f, -1.659179657e+00f, 8.148328938e-01f, -1.659179657e+00f, 7.177091780e-01f },
+        { 9.481720798e-01f, -1.429726043e+00f, 7.027333513e-01f, -1.429726043e+00f, 6.509054311e-01f },
+        { 1.053923729e+00f, -7.845283391e-01f, 5.151329492e-01f, -7.845283391e-01f, 5.690566781e-01f },
+        { 1.173832654e+00f, 8.203997141e-01f, 4.669667738e-01f, 8.203997141e-01f, 6.407994282e-01f },
+    } },
+    { { /* 4 % */
+        { 1.001717342e+00f, -1.998351527e+00f, 9.966506383e-01f, -1.998351527e+00f, 9.983679800e-01f },
+        { 1.003431855e+00f, -1.996672890e+00f, 9.933067933e-01f, -1.996672890e+00f, 9.967386480e-01f },
+        { 1.006907385e+00f, -1.993168945e+00f, 9.865284063e-01f, -1.993168945e+00f, 9.934357909e-01f },
+        { 1.012359955e+00f, -1.985146151e+00f, 9.738496382e-01f, -1.985146151e+00f, 9.862095929e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.025674630e+00f, -1.916076651e+00f, 9.069357707e-01f, -1.916076651e+00f, 9.326104009e-01f },
+        { 9.024813933e-01f, -1.658639979e+00f, 8.146690689e-01f, -1.658639979e+00f, 7.171504622e-01f },
+        { 9.478402922e-01f, -1.429438624e+00f, 7.027332568e-01f, -1.429438624e+00f, 6.505735491e-01f },
+        { 1.053352298e+00f, -7.843336567e-01f, 5.153150154e-01f, -7.843336567e-01f, 5.686673133e-01f },
+        { 1.172534327e+00f, 8.200601916e-01f, 4.675860564e-01f, 8.200601916e-01f, 6.401203832e-01f },
+    } },
+    { { /* 5 % */
+        { 1.001709631e+00f, -1.998347768e+00f, 9.966545900e-01f, -1.998347768e+00f, 9.983642208e-01f },
+        { 1.003416439e+00f, -1.996665384e+00f, 9.933147028e-01f, -1.996665384e+00f, 9.967311421e-01f },
+        { 1.006876331e+00f, -1.993153865e+00f, 9.865443772e-01f, -1.993153865e+00f, 9.934207086e-01f },
+        { 1.012329758e+00f, -1.985130384e+00f, 9.738640584e-01f, -1.985130384e+00f, 9.861938166e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.025566511e+00f, -1.916002282e+00f, 9.069688791e-01f, -1.916002282e+00f, 9.325353897e-01f },
+        { 9.020863158e-01f, -1.658099409e+00f, 8.145045073e-01f, -1.658099409e+00f, 7.165908231e-01f },
+        { 9.475085811e-01f, -1.429150991e+00f, 7.027328373e-01f, -1.429150991e+00f, 6.502414184e-01f },
+        { 1.052781206e+00f, -7.841388467e-01f, 5.154964874e-01f, -7.841388467e-01f, 5.682776935e-01f },
+        { 1.171237825e+00f, 8.197201683e-01f, 4.682025121e-01f, 8.197201683e-01f, 6.394403366e-01f },
+    } },
+    { { /* 6 % */
+        { 1.001701929e+00f, -1.998344000e+00f, 9.966585240e-01f, -1.998344000e+00f, 9.983604531e-01f },
+        { 1.003401042e+00f, -1.996657861e+00f, 9.933225769e-01f, -1.996657861e+00f, 9.967236190e-01f },
+        { 1.006845315e+00f, -1.993138750e+00f, 9.865602768e-01f, -1.993138750e+00f, 9.934055918e-01f },
+        { 1.012299578e+00f, -1.985114598e+00f, 9.738784439e-01f, -1.985114598e+00f, 9.861780224e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.025458432e+00f, -1.915927832e+00f, 9.070018657e-01f, -1.915927832e+00f, 9.324602979e-01f },
+        { 9.016910506e-01f, -1.657557947e+00f, 8.143392093e-01f, -1.657557947e+00f, 7.160302599e-01f },
+        { 9.471769462e-01f, -1.428863142e+00f, 7.027320928e-01f, -1.428863142e+00f, 6.499090390e-01f },
+        { 1.052210453e+00f, -7.839439093e-01f, 5.156773658e-01f, -7.839439093e-01f, 5.678878187e-01f },
+        { 1.169943142e+00f, 8.193796440e-01f, 4.688161459e-01f, 8.193796440e-01f, 6.387592880e-01f },
+    } },
+    { { /* 7 % */
+        { 1.001694236e+00f, -1.998340224e+00f, 9.966624403e-01f, -1.998340224e+00f, 9.983566766e-01f },
+        { 1.003385663e+00f, -1.996650321e+00f, 9.933304156e-01f, -1.996650321e+00f, 9.967160786e-01f },
+        { 1.006814335e+00f, -1.993123601e+00f, 9.865761052e-01f, -1.993123601e+00f, 9.933904403e-01f },
+        { 1.012269415e+00f, -1.985098794e+00f, 9.738927949e-01f, -1.985098794e+00f, 9.861622103e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.025350395e+00f, -1.915853303e+00f, 9.070347306e-01f, -1.915853303e+00f, 9.323851255e-01f },
+        { 9.012955967e-01f, -1.657015591e+00f, 8.141731750e-01f, -1.657015591e+00f, 7.154687716e-01f },
+        { 9.468453871e-01f, -1.428575077e+00f, 7.027310237e-01f, -1.428575077e+00f, 6.495764108e-01f },
+        { 1.051640038e+00f, -7.837488444e-01f, 5.158576511e-01f, -7.837488444e-01f, 5.674976888e-01f },
+        { 1.168650274e+00f, 8.190386185e-01f, 4.694269629e-01f, 8.190386185e-01f, 6.380772370e-01f },
+    } },
+    { { /* 8 % */
+        { 1.001686553e+00f, -1.998336439e+00f, 9.966663389e-01f, -1.998336439e+00f, 9.983528915e-01f },
+        { 1.003370302e+00f, -1.996642764e+00f, 9.933382189e-01f, -1.996642764e+00f, 9.967085208e-01f },
+        { 1.006783392e+00f, -1.993108417e+00f, 9.865918623e-01f, -1.993108417e+00f, 9.933752542e-01f },
+        { 1.012239269e+00f, -1.985082973e+00f, 9.739071112e-01f, -1.985082973e+00f, 9.861463802e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.025242398e+00f, -1.915778694e+00f, 9.070674740e-01f, -1.915778694e+00f, 9.323098723e-01f },
+        { 9.008999530e-01f, -1.656472340e+00f, 8.140064046e-01f, -1.656472340e+00f, 7.149063576e-01f },
+        { 9.465139037e-01f, -1.428286797e+00f, 7.027296301e-01f, -1.428286797e+00f, 6.492435338e-01f },
+        { 1.051069960e+00f, -7.835536520e-01f, 5.160373438e-01f, -7.835536520e-01f, 5.671073040e-01f },
+        { 1.167359215e+00f, 8.186970916e-01f, 4.700349680e-01f, 8.186970916e-01f, 6.373941832e-01f },
+    } },
+    { { /* 9 % */
+        { 1.001678878e+00f, -1.998332645e+00f, 9.966702198e-01f, -1.998332645e+00f, 9.983490977e-01f },
+        { 1.003354959e+00f, -1.996635189e+00f, 9.933459869e-01f, -1.996635189e+00f, 9.967009457e-01f },
+        { 1.006752485e+00f, -1.993093198e+00f, 9.866075484e-01f, -1.993093198e+00f, 9.933600333e-01f },
+        { 1.012209139e+00f, -1.985067133e+00f, 9.739213930e-01f, -1.985067133e+00f, 9.861305321e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.025134443e+00f, -1.915704004e+00f, 9.071000958e-01f, -1.915704004e+00f, 9.322345384e-01f },
+        { 9.005041186e-01f, -1.655928195e+00f, 8.138388984e-01f, -1.655928195e+00f, 7.143430170e-01f },
+        { 9.461824956e-01f, -1.427998302e+00f, 7.027279122e-01f, -1.427998302e+00f, 6.489104078e-01f },
+        { 1.050500220e+00f, -7.833583321e-01f, 5.162164444e-01f, -7.833583321e-01f, 5.667166643e-01f },
+        { 1.166069960e+00f, 8.183550631e-01f, 4.706401663e-01f, 8.183550631e-01f, 6.367101262e-01f },
+    } },
+    { { /* 10 % */
+        { 1.001671212e+00f, -1.998328842e+00f, 9.966740831e-01f, -1.998328842e+00f, 9.983452951e-01f },
+        { 1.003339634e+00f, -1.996627596e+00f, 9.933537196e-01f, -1.996627596e+00f, 9.966933531e-01f },
+        { 1.006721614e+00f, -1.993077944e+00f, 9.866231634e-01f, -1.993077944e+00f, 9.933447775e-01f },
+        { 1.012179026e+00f, -1.985051275e+00f, 9.739356403e-01f, -1.985051275e+00f, 9.861146660e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.025026527e+00f, -1.915629234e+00f, 9.071325960e-01f, -1.915629234e+00f, 9.321591235e-01f },
+        { 9.001080925e-01f, -1.655383154e+00f, 8.136706566e-01f, -1.655383154e+00f, 7.137787490e-01f },
+        { 9.458511627e-01f, -1.427709591e+00f, 7.027258702e-01f, -1.427709591e+00f, 6.485770329e-01f },
+        { 1.049930816e+00f, -7.831628848e-01f, 5.163949536e-01f, -7.831628848e-01f, 5.663257696e-01f },
+        { 1.164782503e+00f, 8.180125327e-01f, 4.712425627e-01f, 8.180125327e-01f, 6.360250655e-01f },
+    } },
+    { { /* 11 % */
+        { 1.001663555e+00f, -1.998325031e+00f, 9.966779287e-01f, -1.998325031e+00f, 9.983414838e-01f },
+        { 1.003324326e+00f, -1.996619987e+00f, 9.933614171e-01f, -1.996619987e+00f, 9.966857432e-01f },
+        { 1.006690779e+00f, -1.993062656e+00f, 9.866387076e-01f, -1.993062656e+00f, 9.933294868e-01f },
+        { 1.012148929e+00f, -1.985035400e+00f, 9.739498529e-01f, -1.985035400e+00f, 9.860987819e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.024918653e+00f, -1.915554384e+00f, 9.071649749e-01f, -1.915554384e+00f, 9.320836276e-01f },
+        { 8.997118736e-01f, -1.654837217e+00f, 8.135016793e-01f, -1.654837217e+00f, 7.132135529e-01f },
+        { 9.455199047e-01f, -1.427420664e+00f, 7.027235043e-01f, -1.427420664e+00f, 6.482434090e-01f },
+        { 1.049361748e+00f, -7.829673100e-01f, 5.165728717e-01f, -7.829673100e-01f, 5.659346199e-01f },
+        { 1.163496839e+00f, 8.176695004e-01f, 4.718421622e-01f, 8.176695004e-01f, 6.353390008e-01f },
+    } },
+    { { /* 12 % */
+        { 1.001655907e+00f, -1.998321211e+00f, 9.966817567e-01f, -1.998321211e+00f, 9.983376637e-01f },
+        { 1.003309036e+00f, -1.996612360e+00f, 9.933690794e-01f, -1.996612360e+00f, 9.966781157e-01f },
+        { 1.006659980e+00f, -1.993047332e+00f, 9.866541809e-01f, -1.993047332e+00f, 9.933141611e-01f },
+        { 1.012118849e+00f, -1.985019506e+00f, 9.739640311e-01f, -1.985019506e+00f, 9.860828797e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.024810818e+00f, -1.915479454e+00f, 9.071972323e-01f, -1.915479454e+00f, 9.320080507e-01f },
+        { 8.993154609e-01f, -1.654290382e+00f, 8.133319669e-01f, -1.654290382e+00f, 7.126474279e-01f },
+        { 9.451887213e-01f, -1.427131521e+00f, 7.027208147e-01f, -1.427131521e+00f, 6.479095359e-01f },
+        { 1.048793016e+00f, -7.827716077e-01f, 5.167501994e-01f, -7.827716077e-01f, 5.655432153e-01f },
+        { 1.162212962e+00f, 8.173259659e-01f, 4.724389697e-01f, 8.173259659e-01f, 6.346519317e-01f },
+    } },
+    { { /* 13 % */
+        { 1.001648268e+00f, -1.998317382e+00f, 9.966855671e-01f, -1.998317382e+00f, 9.983338348e-01f },
+        { 1.003293764e+00f, -1.996604715e+00f, 9.933767065e-01f, -1.996604715e+00f, 9.966704707e-01f },
+        { 1.006629217e+00f, -1.993031973e+00f, 9.866695834e-01f, -1.993031973e+00f, 9.932988003e-01f },
+        { 1.012088785e+00f, -1.985003594e+00f, 9.739781748e-01f, -1.985003594e+00f, 9.860669595e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.024703024e+00f, -1.915404443e+00f, 9.072293684e-01f, -1.915404443e+00f, 9.319323927e-01f },
+        { 8.989188535e-01f, -1.653742649e+00f, 8.131615196e-01f, -1.653742649e+00f, 7.120803731e-01f },
+        { 9.448576122e-01f, -1.426842163e+00f, 7.027178015e-01f, -1.426842163e+00f, 6.475754138e-01f },
+        { 1.048224619e+00f, -7.825757779e-01f, 5.169269372e-01f, -7.825757779e-01f, 5.651515558e-01f },
+        { 1.160930868e+00f, 8.169819289e-01f, 4.730329902e-01f, 8.169819289e-01f, 6.339638579e-01f },
+    } },
+    { { /* 14 % */
+        { 1.001640637e+00f, -1.998313544e+00f, 9.966893600e-01f, -1.998313544e+00f, 9.983299971e-01f },
+        { 1.003278510e+00f, -1.996597053e+00f, 9.933842985e-01f, -1.996597053e+00f, 9.966628082e-01f },
+        { 1.006598489e+00f, -1.993016579e+00f, 9.866849153e-01f, -1.993016579e+00f, 9.932834043e-01f },
+        { 1.012058737e+00f, -1.984987665e+00f, 9.739922840e-01f, -1.984987665e+00f, 9.860510212e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.024595270e+00f, -1.915329352e+00f, 9.072613832e-01f, -1.915329352e+00f, 9.318566534e-01f },
+        { 8.985220503e-01f, -1.653194017e+00f, 8.129903375e-01f, -1.653194017e+00f, 7.115123878e-01f },
+        { 9.445265773e-01f, -1.426552589e+00f, 7.027144651e-01f, -1.426552589e+00f, 6.472410424e-01f },
+        { 1.047656556e+00f, -7.823798207e-01f, 5.171030855e-01f, -7.823798207e-01f, 5.647596413e-01f },
+        { 1.159650550e+00f, 8.166373894e-01f, 4.736242287e-01f, 8.166373894e-01f, 6.332747789e-01f },
+    } },
+    { { /* 15 % */
+        { 1.001633015e+00f, -1.998309698e+00f, 9.966931353e-01f, -1.998309698e+00f, 9.983261505e-01f },
+        { 1.003263273e+00f, -1.996589373e+00f, 9.933918555e-01f, -1.996589373e+00f, 9.966551280e-01f },
+        { 1.006567797e+00f, -1.993001150e+00f, 9.867001765e-01f, -1.993001150e+00f, 9.932679731e-01f },
+        { 1.012028706e+00f, -1.984971717e+00f, 9.740063587e-01f, -1.984971717e+00f, 9.860350648e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.024487556e+00f, -1.915254180e+00f, 9.072932767e-01f, -1.915254180e+00f, 9.317808328e-01f },
+        { 8.981250503e-01f, -1.652644486e+00f, 8.128184208e-01f, -1.652644486e+00f, 7.109434712e-01f },
+        { 9.441956163e-01f, -1.426262799e+00f, 7.027108055e-01f, -1.426262799e+00f, 6.469064218e-01f },
+        { 1.047088827e+00f, -7.821837360e-01f, 5.172786450e-01f, -7.821837360e-01f, 5.643674720e-01f },
+        { 1.158372004e+00f, 8.162923472e-01f, 4.742126900e-01f, 8.162923472e-01f, 6.325846944e-01f },
+    } },
+    { { /* 16 % */
+        { 1.001625402e+00f, -1.998305843e+00f, 9.966968931e-01f, -1.998305843e+00f, 9.983222952e-01f },
+        { 1.003248053e+00f, -1.996581675e+00f, 9.933993774e-01f, -1.996581675e+00f, 9.966474302e-01f },
+        { 1.006537139e+00f, -1.992985686e+00f, 9.867153673e-01f, -1.992985686e+00f, 9.932525065e-01f },
+        { 1.011998691e+00f, -1.984955751e+00f, 9.740203990e-01f, -1.984955751e+00f, 9.860190903e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.024379882e+00f, -1.915178927e+00f, 9.073250491e-01f, -1.915178927e+00f, 9.317049309e-01f },
+        { 8.977278526e-01f, -1.652094055e+00f, 8.126457699e-01f, -1.652094055e+00f, 7.103736225e-01f },
+        { 9.438647288e-01f, -1.425972793e+00f, 7.027068231e-01f, -1.425972793e+00f, 6.465715519e-01f },
+        { 1.046521432e+00f, -7.819875239e-01f, 5.174536160e-01f, -7.819875239e-01f, 5.639750477e-01f },
+        { 1.157095225e+00f, 8.159468020e-01f, 4.747983790e-01f, 8.159468020e-01f, 6.318936039e-01f },
+    } },
+    { { /* 17 % */
+        { 1.001617798e+00f, -1.998301978e+00f, 9.967006333e-01f, -1.998301978e+00f, 9.983184309e-01f },
+        { 1.003232850e+00f, -1.996573960e+00f, 9.934068643e-01f, -1.996573960e+00f, 9.966397147e-01f },
+        { 1.006506517e+00f, -1.992970186e+00f, 9.867304876e-01f, -1.992970186e+00f, 9.932370045e-01f },
+        { 1.011968693e+00f, -1.984939767e+00f, 9.740344049e-01f, -1.984939767e+00f, 9.860030976e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.024272247e+00f, -1.915103594e+00f, 9.073567003e-01f, -1.915103594e+00f, 9.316289475e-01f },
+        { 8.973304561e-01f, -1.651542722e+00f, 8.124723848e-01f, -1.651542722e+00f, 7.098028409e-01f },
+        { 9.435339148e-01f, -1.425682571e+00f, 7.027025178e-01f, -1.425682571e+00f, 6.462364326e-01f },
+        { 1.045954369e+00f, -7.817911843e-01f, 5.176279993e-01f, -7.817911843e-01f, 5.635823686e-01f },
+        { 1.155820206e+00f, 8.156007536e-01f, 4.753813008e-01f, 8.156007536e-01f, 6.312015073e-01f },
+    } },
+    { { /* 18 % */
+        { 1.001610202e+00f, -1.998298105e+00f, 9.967043561e-01f, -1.998298105e+00f, 9.983145577e-01f },
+        { 1.003217665e+00f, -1.996566227e+00f, 9.934143162e-01f, -1.996566227e+00f, 9.966319815e-01f },
+        { 1.006475929e+00f, -1.992954650e+00f, 9.867455375e-01f, -1.992954650e+00f, 9.932214670e-01f },
+        { 1.011938710e+00f, -1.984923764e+00f, 9.740483764e-01f, -1.984923764e+00f, 9.859870868e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.024164652e+00f, -1.915028180e+00f, 9.073882304e-01f, -1.915028180e+00f, 9.315528825e-01f },
+        { 8.969328598e-01f, -1.650990487e+00f, 8.122982659e-01f, -1.650990487e+00f, 7.092311257e-01f },
+        { 9.432031738e-01f, -1.425392133e+00f, 7.026978901e-01f, -1.425392133e+00f, 6.459010639e-01f },
+        { 1.045387639e+00f, -7.815947173e-01f, 5.178017951e-01f, -7.815947173e-01f, 5.631894346e-01f },
+        { 1.154546944e+00f, 8.152542020e-01f, 4.759614601e-01f, 8.152542020e-01f, 6.305084040e-01f },
+    } },
+    { { /* 19 % */
+        { 1.001602614e+00f, -1.998294223e+00f, 9.967080614e-01f, -1.998294223e+00f, 9.983106757e-01f },
+        { 1.003202497e+00f, -1.996558476e+00f, 9.934217332e-01f, -1.996558476e+00f, 9.966242305e-01f },
+        { 1.006445377e+00f, -1.992939079e+00f, 9.867605172e-01f, -1.992939079e+00f, 9.932058940e-01f },
+        { 1.011908744e+00f, -1.984907744e+00f, 9.740623135e-01f, -1.984907744e+00f, 9.859710577e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.024057096e+00f, -1.914952685e+00f, 9.074196395e-01f, -1.914952685e+00f, 9.314767360e-01f },
+        { 8.965350628e-01f, -1.650437350e+00f, 8.121234132e-01f, -1.650437350e+00f, 7.086584761e-01f },
+        { 9.428725057e-01f, -1.425101480e+00f, 7.026929400e-01f, -1.425101480e+00f, 6.455654457e-01f },
+        { 1.044821241e+00f, -7.813981228e-01f, 5.179750042e-01f, -7.813981228e-01f, 5.627962457e-01f },
+        { 1.153275432e+00f, 8.149071468e-01f, 4.765388620e-01f, 8.149071468e-01f, 6.298142937e-01f },
+    } },
+    { { /* 20 % */
+        { 1.001595035e+00f, -1.998290332e+00f, 9.967117492e-01f, -1.998290332e+00f, 9.983067847e-01f },
+        { 1.003187346e+00f, -1.996550708e+00f, 9.934291154e-01f, -1.996550708e+00f, 9.966164617e-01f },
+        { 1.006414859e+00f, -1.992923473e+00f, 9.867754268e-01f, -1.992923473e+00f, 9.931902853e-01f },
+        { 1.011878794e+00f, -1.984891705e+00f, 9.740762162e-01f, -1.984891705e+00f, 9.859550105e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.023949580e+00f, -1.914877109e+00f, 9.074509276e-01f, -1.914877109e+00f, 9.314005077e-01f },
+        { 8.961370641e-01f, -1.649883310e+00f, 8.119478272e-01f, -1.649883310e+00f, 7.080848913e-01f },
+        { 9.425419102e-01f, -1.424810610e+00f, 7.026876677e-01f, -1.424810610e+00f, 6.452295779e-01f },
+        { 1.044255175e+00f, -7.812014010e-01f, 5.181476270e-01f, -7.812014010e-01f, 5.624028020e-01f },
+        { 1.152005665e+00f, 8.145595880e-01f, 4.771135112e-01f, 8.145595880e-01f, 6.291191761e-01f },
+    } },
+    { { /* 21 % */
+        { 1.001587465e+00f, -1.998286432e+00f, 9.967154196e-01f, -1.998286432e+00f, 9.983028847e-01f },
+        { 1.003172212e+00f, -1.996542921e+00f, 9.934364627e-01f, -1.996542921e+00f, 9.966086751e-01f },
+        { 1.006384375e+00f, -1.992907830e+00f, 9.867902661e-01f, -1.992907830e+00f, 9.931746408e-01f },
+        { 1.011848860e+00f, -1.984875648e+00f, 9.740900846e-01f, -1.984875648e+00f, 9.859389451e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.023842103e+00f, -1.914801451e+00f, 9.074820948e-01f, -1.914801451e+00f, 9.313241976e-01f },
+        { 8.957388627e-01f, -1.649328366e+00f, 8.117715078e-01f, -1.649328366e+00f, 7.075103705e-01f },
+        { 9.422113871e-01f, -1.424519523e+00f, 7.026820735e-01f, -1.424519523e+00f, 6.448934606e-01f },
+        { 1.043689439e+00f, -7.810045517e-01f, 5.183196641e-01f, -7.810045517e-01f, 5.620091034e-01f },
+        { 1.150737638e+00f, 8.142115254e-01f, 4.776854126e-01f, 8.142115254e-01f, 6.284230508e-01f },
+    } },
+    { { /* 22 % */
+        { 1.001579903e+00f, -1.998282523e+00f, 9.967190726e-01f, -1.998282523e+00f, 9.982989758e-01f },
+        { 1.003157095e+00f, -1.996535117e+00f, 9.934437752e-01f, -1.996535117e+00f, 9.966008706e-01f },
+        { 1.006353925e+00f, -1.992892152e+00f, 9.868050355e-01f, -1.992892152e+00f, 9.931589606e-01f },
+        { 1.011818943e+00f, -1.984859573e+00f, 9.741039187e-01f, -1.984859573e+00f, 9.859228614e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.023734665e+00f, -1.914725713e+00f, 9.075131412e-01f, -1.914725713e+00f, 9.312478057e-01f },
+        { 8.953404576e-01f, -1.648772516e+00f, 8.115944555e-01f, -1.648772516e+00f, 7.069349131e-01f },
+        { 9.418809361e-01f, -1.424228221e+00f, 7.026761575e-01f, -1.424228221e+00f, 6.445570936e-01f },
+        { 1.043124034e+00f, -7.808075750e-01f, 5.184911159e-01f, -7.808075750e-01f, 5.616151501e-01f },
+        { 1.149471346e+00f, 8.138629587e-01f, 4.782545711e-01f, 8.138629587e-01f, 6.277259175e-01f },
+    } },
+    { { /* 23 % */
+        { 1.001572350e+00f, -1.998278605e+00f, 9.967227082e-01f, -1.998278605e+00f, 9.982950579e-01f },
+        { 1.003141995e+00f, -1.996527295e+00f, 9.934510530e-01f, -1.996527295e+00f, 9.965930481e-01f },
+        { 1.006323509e+00f, -1.992876438e+00f, 9.868197349e-01f, -1.992876438e+00f, 9.931432444e-01f },
+        { 1.011789041e+00f, -1.984843480e+00f, 9.741177184e-01f, -1.984843480e+00f, 9.859067594e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.023627265e+00f, -1.914649893e+00f, 9.075440666e-01f, -1.914649893e+00f, 9.311713318e-01f },
+        { 8.949418478e-01f, -1.648215762e+00f, 8.114166703e-01f, -1.648215762e+00f, 7.063585182e-01f },
+        { 9.415505570e-01f, -1.423936702e+00f, 7.026699199e-01f, -1.423936702e+00f, 6.442204769e-01f },
+        { 1.042558959e+00f, -7.806104709e-01f, 5.186619830e-01f, -7.806104709e-01f, 5.612209419e-01f },
+        { 1.148206784e+00f, 8.135138879e-01f, 4.788209916e-01f, 8.135138879e-01f, 6.270277758e-01f },
+    } },
+    { { /* 24 % */
+        { 1.001564805e+00f, -1.998274679e+00f, 9.967263264e-01f, -1.998274679e+00f, 9.982911309e-01f },
+        { 1.003126912e+00f, -1.996519455e+00f, 9.934582961e-01f, -1.996519455e+00f, 9.965852077e-01f },
+        { 1.006293128e+00f, -1.992860688e+00f, 9.868343645e-01f, -1.992860688e+00f, 9.931274923e-01f },
+        { 1.011759155e+00f, -1.984827368e+00f, 9.741314839e-01f, -1.984827368e+00f, 9.858906391e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.023519905e+00f, -1.914573992e+00f, 9.075748713e-01f, -1.914573992e+00f, 9.310947759e-01f },
+        { 8.945430324e-01f, -1.647658101e+00f, 8.112381526e-01f, -1.647658101e+00f, 7.057811850e-01f },
+        { 9.412202495e-01f, -1.423644968e+00f, 7.026633610e-01f, -1.423644968e+00f, 6.438836105e-01f },
+        { 1.041994213e+00f, -7.804132395e-01f, 5.188322659e-01f, -7.804132395e-01f, 5.608264789e-01f },
+        { 1.146943947e+00f, 8.131643127e-01f, 4.793846789e-01f, 8.131643127e-01f, 6.263286255e-01f },
+    } },
+    { { /* 25 % */
+        { 1.001557268e+00f, -1.998270743e+00f, 9.967299273e-01f, -1.998270743e+00f, 9.982871950e-01f },
+        { 1.003111845e+00f, -1.996511596e+00f, 9.934655044e-01f, -1.996511596e+00f, 9.965773493e-01f },
+        { 1.006262780e+00f, -1.992844902e+00f, 9.868489242e-01f, -1.992844902e+00f, 9.931117041e-01f },
+        { 1.011729285e+00f, -1.984811238e+00f, 9.741452151e-01f, -1.984811238e+00f, 9.858745006e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.023412583e+00f, -1.914498010e+00f, 9.076055553e-01f, -1.914498010e+00f, 9.310181379e-01f },
+        { 8.941440103e-01f, -1.647099533e+00f, 8.110589025e-01f, -1.647099533e+00f, 7.052029128e-01f },
+        { 9.408900134e-01f, -1.423353016e+00f, 7.026564809e-01f, -1.423353016e+00f, 6.435464943e-01f },
+        { 1.041429796e+00f, -7.802158806e-01f, 5.190019651e-01f, -7.802158806e-01f, 5.604317612e-01f },
+        { 1.145682828e+00f, 8.128142330e-01f, 4.799456378e-01f, 8.128142330e-01f, 6.256284661e-01f },
+    } },
+    { { /* 26 % */
+        { 1.001549739e+00f, -1.998266798e+00f, 9.967335108e-01f, -1.998266798e+00f, 9.982832499e-01f },
+        { 1.003096795e+00f, -1.996503720e+00f, 9.934726781e-01f, -1.996503720e+00f, 9.965694728e-01f },
+        { 1.006232465e+00f, -1.992829080e+00f, 9.868634143e-01f, -1.992829080e+00f, 9.930958797e-01f },
+        { 1.011699432e+00f, -1.984795090e+00f, 9.741589121e-01f, -1.984795090e+00f, 9.858583437e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.023305299e+00f, -1.914421946e+00f, 9.076361186e-01f, -1.914421946e+00f, 9.309414177e-01f },
+        { 8.937447807e-01f, -1.646540057e+00f, 8.108789202e-01f, -1.646540057e+00f, 7.046237009e-01f },
+        { 9.405598483e-01f, -1.423060849e+00f, 7.026492798e-01f, -1.423060849e+00f, 6.432091282e-01f },
+        { 1.040865708e+00f, -7.800183943e-01f, 5.191710812e-01f, -7.800183943e-01f, 5.600367887e-01f },
+        { 1.144423424e+00f, 8.124636487e-01f, 4.805038732e-01f, 8.124636487e-01f, 6.249272973e-01f },
+    } },
+    { { /* 27 % */
+        { 1.001542219e+00f, -1.998262844e+00f, 9.967370770e-01f, -1.998262844e+00f, 9.982792958e-01f },
+        { 1.003081761e+00f, -1.996495826e+00f, 9.934798173e-01f, -1.996495826e+00f, 9.965615782e-01f },
+        { 1.006202185e+00f, -1.992813221e+00f, 9.868778346e-01f, -1.992813221e+00f, 9.930800192e-01f },
+        { 1.011669594e+00f, -1.984778924e+00f, 9.741725748e-01f, -1.984778924e+00f, 9.858421684e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.023198054e+00f, -1.914345801e+00f, 9.076665613e-01f, -1.914345801e+00f, 9.308646152e-01f },
+        { 8.933453425e-01f, -1.645979673e+00f, 8.106982059e-01f, -1.645979673e+00f, 7.040435484e-01f },
+        { 9.402297542e-01f, -1.422768465e+00f, 7.026417579e-01f, -1.422768465e+00f, 6.428715121e-01f },
+        { 1.040301947e+00f, -7.798207807e-01f, 5.193396146e-01f, -7.798207807e-01f, 5.596415614e-01f },
+        { 1.143165729e+00f, 8.121125595e-01f, 4.810593898e-01f, 8.121125595e-01f, 6.242251189e-01f },
+    } },
+    { { /* 28 % */
+        { 1.001534707e+00f, -1.998258880e+00f, 9.967406259e-01f, -1.998258880e+00f, 9.982753326e-01f },
+        { 1.003066744e+00f, -1.996487913e+00f, 9.934869218e-01f, -1.996487913e+00f, 9.965536655e-01f },
+        { 1.006171937e+00f, -1.992797327e+00f, 9.868921855e-01f, -1.992797327e+00f, 9.930641223e-01f },
+        { 1.011639772e+00f, -1.984762739e+00f, 9.741862033e-01f, -1.984762739e+00f, 9.858259748e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.023090847e+00f, -1.914269574e+00f, 9.076968834e-01f, -1.914269574e+00f, 9.307877304e-01f },
+        { 8.929456948e-01f, -1.645418379e+00f, 8.105167599e-01f, -1.645418379e+00f, 7.034624547e-01f },
+        { 9.398997307e-01f, -1.422475864e+00f, 7.026339154e-01f, -1.422475864e+00f, 6.425336461e-01f },
+        { 1.039738514e+00f, -7.796230397e-01f, 5.195075659e-01f, -7.796230397e-01f, 5.592460794e-01f },
+        { 1.141909738e+00f, 8.117609653e-01f, 4.816121926e-01f, 8.117609653e-01f, 6.235219305e-01f },
+    } },
+    { { /* 29 % */
+        { 1.001527203e+00f, -1.998254908e+00f, 9.967441575e-01f, -1.998254908e+00f, 9.982713603e-01f },
+        { 1.003051743e+00f, -1.996479983e+00f, 9.934939918e-01f, -1.996479983e+00f, 9.965457346e-01f },
+        { 1.006141722e+00f, -1.992781395e+00f, 9.869064668e-01f, -1.992781395e+00f, 9.930481890e-01f },
+        { 1.011609965e+00f, -1.984746535e+00f, 9.741997976e-01f, -1.984746535e+00f, 9.858097628e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.022983678e+00f, -1.914193265e+00f, 9.077270850e-01f, -1.914193265e+00f, 9.307107631e-01f },
+        { 8.925458366e-01f, -1.644856176e+00f, 8.103345824e-01f, -1.644856176e+00f, 7.028804190e-01f },
+        { 9.395697776e-01f, -1.422183047e+00f, 7.026257525e-01f, -1.422183047e+00f, 6.421955301e-01f },
+        { 1.039175407e+00f, -7.794251714e-01f, 5.196749355e-01f, -7.794251714e-01f, 5.588503427e-01f },
+        { 1.140655446e+00f, 8.114088659e-01f, 4.821622862e-01f, 8.114088659e-01f, 6.228177318e-01f },
+    } },
+    { { /* 30 % */
+        { 1.001519707e+00f, -1.998250927e+00f, 9.967476719e-01f, -1.998250927e+00f, 9.982673788e-01f },
+        { 1.003036758e+00f, -1.996472034e+00f, 9.935010274e-01f, -1.996472034e+00f, 9.965377854e-01f },
+        { 1.006111540e+00f, -1.992765428e+00f, 9.869206788e-01f, -1.992765428e+00f, 9.930322193e-01f },
+        { 1.011580175e+00f, -1.984730314e+00f, 9.742133577e-01f, -1.984730314e+00f, 9.857935324e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.022876547e+00f, -1.914116874e+00f, 9.077571661e-01f, -1.914116874e+00f, 9.306337134e-01f },
+        { 8.921457670e-01f, -1.644293062e+00f, 8.101516736e-01f, -1.644293062e+00f, 7.022974406e-01f },
+        { 9.392398946e-01f, -1.421890013e+00f, 7.026172694e-01f, -1.421890013e+00f, 6.418571640e-01f },
+        { 1.038612627e+00f, -7.792271757e-01f, 5.198417241e-01f, -7.792271757e-01f, 5.584543513e-01f },
+        { 1.139402847e+00f, 8.110562613e-01f, 4.827096755e-01f, 8.110562613e-01f, 6.221125225e-01f },
+    } },
+    { { /* 31 % */
+        { 1.001512219e+00f, -1.998246936e+00f, 9.967511690e-01f, -1.998246936e+00f, 9.982633882e-01f },
+        { 1.003021790e+00f, -1.996464067e+00f, 9.935080284e-01f, -1.996464067e+00f, 9.965298181e-01f },
+        { 1.006081392e+00f, -1.992749424e+00f, 9.869348214e-01f, -1.992749424e+00f, 9.930162130e-01f },
+        { 1.011550400e+00f, -1.984714074e+00f, 9.742268837e-01f, -1.984714074e+00f, 9.857772836e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.022769454e+00f, -1.914040402e+00f, 9.077871268e-01f, -1.914040402e+00f, 9.305565810e-01f },
+        { 8.917454850e-01f, -1.643729037e+00f, 8.099680336e-01f, -1.643729037e+00f, 7.017135186e-01f },
+        { 9.389100815e-01f, -1.421596763e+00f, 7.026084663e-01f, -1.421596763e+00f, 6.415185478e-01f },
+        { 1.038050173e+00f, -7.790290526e-01f, 5.200079322e-01f, -7.790290526e-01f, 5.580581052e-01f },
+        { 1.138151937e+00f, 8.107031512e-01f, 4.832543653e-01f, 8.107031512e-01f, 6.214063023e-01f },
+    } },
+    { { /* 32 % */
+        { 1.001504739e+00f, -1.998242936e+00f, 9.967546489e-01f, -1.998242936e+00f, 9.982593883e-01f },
+        { 1.003006837e+00f, -1.996456081e+00f, 9.935149951e-01f, -1.996456081e+00f, 9.965218324e-01f },
+        { 1.006051275e+00f, -1.992733383e+00f, 9.869488947e-01f, -1.992733383e+00f, 9.930001700e-01f },
+        { 1.011520641e+00f, -1.984697815e+00f, 9.742403755e-01f, -1.984697815e+00f, 9.857610163e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.022662399e+00f, -1.913963847e+00f, 9.078169671e-01f, -1.913963847e+00f, 9.304793659e-01f },
+        { 8.913449896e-01f, -1.643164099e+00f, 8.097836628e-01f, -1.643164099e+00f, 7.011286524e-01f },
+        { 9.385803381e-01f, -1.421303296e+00f, 7.025993433e-01f, -1.421303296e+00f, 6.411796813e-01f },
+        { 1.037488044e+00f, -7.788308022e-01f, 5.201735602e-01f, -7.788308022e-01f, 5.576616045e-01f },
+        { 1.136902711e+00f, 8.103495354e-01f, 4.837963603e-01f, 8.103495354e-01f, 6.206990709e-01f },
+    } },
+    { { /* 33 % */
+        { 1.001497268e+00f, -1.998238927e+00f, 9.967581116e-01f, -1.998238927e+00f, 9.982553793e-01f },
+        { 1.002991901e+00f, -1.996448078e+00f, 9.935219274e-01f, -1.996448078e+00f, 9.965138283e-01f },
+        { 1.006021191e+00f, -1.992717305e+00f, 9.869628989e-01f, -1.992717305e+00f, 9.929840903e-01f },
+        { 1.011490897e+00f, -1.984681538e+00f, 9.742538332e-01f, -1.984681538e+00f, 9.857447305e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.022555381e+00f, -1.913887211e+00f, 9.078466871e-01f, -1.913887211e+00f, 9.304020681e-01f },
+        { 8.909442799e-01f, -1.642598249e+00f, 8.095985613e-01f, -1.642598249e+00f, 7.005428412e-01f },
+        { 9.382506640e-01f, -1.421009613e+00f, 7.025899007e-01f, -1.421009613e+00f, 6.408405647e-01f },
+        { 1.036926240e+00f, -7.786324245e-01f, 5.203386086e-01f, -7.786324245e-01f, 5.572648491e-01f },
+        { 1.135655163e+00f, 8.099954140e-01f, 4.843356653e-01f, 8.099954140e-01f, 6.199908280e-01f },
+    } },
+    { { /* 34 % */
+        { 1.001489804e+00f, -1.998234909e+00f, 9.967615571e-01f, -1.998234909e+00f, 9.982513611e-01f },
+        { 1.002976981e+00f, -1.996440055e+00f, 9.935288253e-01f, -1.996440055e+00f, 9.965058059e-01f },
+        { 1.005991140e+00f, -1.992701191e+00f, 9.869768340e-01f, -1.992701191e+00f, 9.929679739e-01f },
+        { 1.011461169e+00f, -1.984665242e+00f, 9.742672569e-01f, -1.984665242e+00f, 9.857284263e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.022448401e+00f, -1.913810492e+00f, 9.078762869e-01f, -1.913810492e+00f, 9.303246875e-01f },
+        { 8.905433549e-01f, -1.642031485e+00f, 8.094127294e-01f, -1.642031485e+00f, 6.999560844e-01f },
+        { 9.379210591e-01f, -1.420715712e+00f, 7.025801386e-01f, -1.420715712e+00f, 6.405011977e-01f },
+        { 1.036364761e+00f, -7.784339195e-01f, 5.205030780e-01f, -7.784339195e-01f, 5.568678391e-01f },
+        { 1.134409288e+00f, 8.096407866e-01f, 4.848722851e-01f, 8.096407866e-01f, 6.192815732e-01f },
+    } },
+    { { /* 35 % */
+        { 1.001482348e+00f, -1.998230882e+00f, 9.967649854e-01f, -1.998230882e+00f, 9.982473336e-01f },
+        { 1.002962076e+00f, -1.996432015e+00f, 9.935356890e-01f, -1.996432015e+00f, 9.964977651e-01f },
+        { 1.005961120e+00f, -1.992685040e+00f, 9.869907000e-01f, -1.992685040e+00f, 9.929518205e-01f },
+        { 1.011431457e+00f, -1.984648928e+00f, 9.742806464e-01f, -1.984648928e+00f, 9.857121035e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.022341458e+00f, -1.913733691e+00f, 9.079057664e-01f, -1.913733691e+00f, 9.302472239e-01f },
+        { 8.901422138e-01f, -1.641463808e+00f, 8.092261672e-01f, -1.641463808e+00f, 6.993683810e-01f },
+        { 9.375915231e-01f, -1.420421595e+00f, 7.025700573e-01f, -1.420421595e+00f, 6.401615804e-01f },
+        { 1.035803605e+00f, -7.782352872e-01f, 5.206669690e-01f, -7.782352872e-01f, 5.564705744e-01f },
+        { 1.133165082e+00f, 8.092856532e-01f, 4.854062243e-01f, 8.092856532e-01f, 6.185713064e-01f },
+    } },
+    { { /* 36 % */
+        { 1.001474900e+00f, -1.998226845e+00f, 9.967683966e-01f, -1.998226845e+00f, 9.982432968e-01f },
+        { 1.002947187e+00f, -1.996423956e+00f, 9.935425183e-01f, -1.996423956e+00f, 9.964897058e-01f },
+        { 1.005931133e+00f, -1.992668852e+00f, 9.870044971e-01f, -1.992668852e+00f, 9.929356302e-01f },
+        { 1.011401760e+00f, -1.984632596e+00f, 9.742940018e-01f, -1.984632596e+00f, 9.856957622e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.022234552e+00f, -1.913656808e+00f, 9.079351257e-01f, -1.913656808e+00f, 9.301696773e-01f },
+        { 8.897408555e-01f, -1.640895215e+00f, 8.090388750e-01f, -1.640895215e+00f, 6.987797305e-01f },
+        { 9.372620558e-01f, -1.420127261e+00f, 7.025596569e-01f, -1.420127261e+00f, 6.398217127e-01f },
+        { 1.035242773e+00f, -7.780365276e-01f, 5.208302819e-01f, -7.780365276e-01f, 5.560730552e-01f },
+        { 1.131922539e+00f, 8.089300136e-01f, 4.859374878e-01f, 8.089300136e-01f, 6.178600272e-01f },
+    } },
+    { { /* 37 % */
+        { 1.001467460e+00f, -1.998222799e+00f, 9.967717907e-01f, -1.998222799e+00f, 9.982392508e-01f },
+        { 1.002932314e+00f, -1.996415878e+00f, 9.935493135e-01f, -1.996415878e+00f, 9.964816279e-01f },
+        { 1.005901177e+00f, -1.992652626e+00f, 9.870182253e-01f, -1.992652626e+00f, 9.929194028e-01f },
+        { 1.011372079e+00f, -1.984616245e+00f, 9.743073232e-01f, -1.984616245e+00f, 9.856794023e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.022127683e+00f, -1.913579843e+00f, 9.079643649e-01f, -1.913579843e+00f, 9.300920476e-01f },
+        { 8.893392791e-01f, -1.640325707e+00f, 8.088508530e-01f, -1.640325707e+00f, 6.981901321e-01f },
+        { 9.369326569e-01f, -1.419832710e+00f, 7.025489377e-01f, -1.419832710e+00f, 6.394815946e-01f },
+        { 1.034682264e+00f, -7.778376407e-01f, 5.209930174e-01f, -7.778376407e-01f, 5.556752814e-01f },
+        { 1.130681655e+00f, 8.085738677e-01f, 4.864660803e-01f, 8.085738677e-01f, 6.171477354e-01f },
+    } },
+    { { /* 38 % */
+        { 1.001460028e+00f, -1.998218743e+00f, 9.967751676e-01f, -1.998218743e+00f, 9.982351954e-01f },
+        { 1.002917457e+00f, -1.996407782e+00f, 9.935560744e-01f, -1.996407782e+00f, 9.964735316e-01f },
+        { 1.005871253e+00f, -1.992636364e+00f, 9.870318847e-01f, -1.992636364e+00f, 9.929031382e-01f },
+        { 1.011342413e+00f, -1.984599875e+00f, 9.743206106e-01f, -1.984599875e+00f, 9.856630239e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.022020851e+00f, -1.913502795e+00f, 9.079934840e-01f, -1.913502795e+00f, 9.300143348e-01f },
+        { 8.889374837e-01f, -1.639755282e+00f, 8.086621014e-01f, -1.639755282e+00f, 6.975995851e-01f },
+        { 9.366033262e-01f, -1.419537942e+00f, 7.025378997e-01f, -1.419537942e+00f, 6.391412259e-01f },
+        { 1.034122077e+00f, -7.776386265e-01f, 5.211551759e-01f, -7.776386265e-01f, 5.552772530e-01f },
+        { 1.129442424e+00f, 8.082172153e-01f, 4.869920064e-01f, 8.082172153e-01f, 6.164344307e-01f },
+    } },
+    { { /* 39 % */
+        { 1.001452603e+00f, -1.998214679e+00f, 9.967785275e-01f, -1.998214679e+00f, 9.982311307e-01f },
+        { 1.002902615e+00f, -1.996399667e+00f, 9.935628012e-01f, -1.996399667e+00f, 9.964654166e-01f },
+        { 1.005841361e+00f, -1.992620064e+00f, 9.870454754e-01f, -1.992620064e+00f, 9.928868364e-01f },
+        { 1.011312763e+00f, -1.984583487e+00f, 9.743338640e-01f, -1.984583487e+00f, 9.856466269e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.021914056e+00f, -1.913425664e+00f, 9.080224831e-01f, -1.913425664e+00f, 9.299365387e-01f },
+        { 8.885354684e-01f, -1.639183940e+00f, 8.084726204e-01f, -1.639183940e+00f, 6.970080887e-01f },
+        { 9.362740635e-01f, -1.419242957e+00f, 7.025265433e-01f, -1.419242957e+00f, 6.388006068e-01f },
+        { 1.033562212e+00f, -7.774394851e-01f, 5.213167579e-01f, -7.774394851e-01f, 5.548789702e-01f },
+        { 1.128204842e+00f, 8.078600564e-01f, 4.875152710e-01f, 8.078600564e-01f, 6.157201128e-01f },
+    } },
+    { { /* 40 % */
+        { 1.001445186e+00f, -1.998210605e+00f, 9.967818702e-01f, -1.998210605e+00f, 9.982270566e-01f },
+        { 1.002887789e+00f, -1.996391534e+00f, 9.935694939e-01f, -1.996391534e+00f, 9.964572830e-01f },
+        { 1.005811500e+00f, -1.992603728e+00f, 9.870589974e-01f, -1.992603728e+00f, 9.928704974e-01f },
+        { 1.011283128e+00f, -1.984567080e+00f, 9.743470834e-01f, -1.984567080e+00f, 9.856302112e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.021807297e+00f, -1.913348451e+00f, 9.080513623e-01f, -1.913348451e+00f, 9.298586592e-01f },
+        { 8.881332321e-01f, -1.638611681e+00f, 8.082824102e-01f, -1.638611681e+00f, 6.964156423e-01f },
+        { 9.359448684e-01f, -1.418947755e+00f, 7.025148686e-01f, -1.418947755e+00f, 6.384597370e-01f },
+        { 1.033002669e+00f, -7.772402164e-01f, 5.214777641e-01f, -7.772402164e-01f, 5.544804327e-01f },
+        { 1.126968903e+00f, 8.075023907e-01f, 4.880358786e-01f, 8.075023907e-01f, 6.150047814e-01f },
+    } },
+    { { /* 41 % */
+        { 1.001437777e+00f, -1.998206521e+00f, 9.967851960e-01f, -1.998206521e+00f, 9.982229732e-01f },
+        { 1.002872978e+00f, -1.996383382e+00f, 9.935761524e-01f, -1.996383382e+00f, 9.964491306e-01f },
+        { 1.005781670e+00f, -1.992587353e+00f, 9.870724508e-01f, -1.992587353e+00f, 9.928541209e-01f },
+        { 1.011253508e+00f, -1.984550654e+00f, 9.743602688e-01f, -1.984550654e+00f, 9.856137769e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.021700575e+00f, -1.913271155e+00f, 9.080801215e-01f, -1.913271155e+00f, 9.297806964e-01f },
+        { 8.877307740e-01f, -1.638038503e+00f, 8.080914711e-01f, -1.638038503e+00f, 6.958222451e-01f },
+        { 9.356157408e-01f, -1.418652336e+00f, 7.025028758e-01f, -1.418652336e+00f, 6.381186165e-01f },
+        { 1.032443446e+00f, -7.770408204e-01f, 5.216381948e-01f, -7.770408204e-01f, 5.540816408e-01f },
+        { 1.125734602e+00f, 8.071442182e-01f, 4.885538341e-01f, 8.071442182e-01f, 6.142884364e-01f },
+    } },
+    { { /* 42 % */
+        { 1.001430376e+00f, -1.998202429e+00f, 9.967885046e-01f, -1.998202429e+00f, 9.982188804e-01f },
+        { 1.002858183e+00f, -1.996375211e+00f, 9.935827769e-01f, -1.996375211e+00f, 9.964409596e-01f },
+        { 1.005751871e+00f, -1.992570941e+00f, 9.870858357e-01f, -1.992570941e+00f, 9.928377069e-01f },
+        { 1.011223904e+00f, -1.984534210e+00f, 9.743734202e-01f, -1.984534210e+00f, 9.855973240e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.021593889e+00f, -1.913193776e+00f, 9.081087608e-01f, -1.913193776e+00f, 9.297026500e-01f },
+        { 8.873280932e-01f, -1.637464407e+00f, 8.078998032e-01f, -1.637464407e+00f, 6.952278964e-01f },
+        { 9.352866804e-01f, -1.418356700e+00f, 7.024905650e-01f, -1.418356700e+00f, 6.377772454e-01f },
+        { 1.031884544e+00f, -7.768412972e-01f, 5.217980506e-01f, -7.768412972e-01f, 5.536825945e-01f },
+        { 1.124501935e+00f, 8.067855387e-01f, 4.890691420e-01f, 8.067855387e-01f, 6.135710774e-01f },
+    } },
+    { { /* 43 % */
+        { 1.001422982e+00f, -1.998198326e+00f, 9.967917963e-01f, -1.998198326e+00f, 9.982147782e-01f },
+        { 1.002843402e+00f, -1.996367022e+00f, 9.935893674e-01f, -1.996367022e+00f, 9.964327698e-01f },
+        { 1.005722103e+00f, -1.992554492e+00f, 9.870991521e-01f, -1.992554492e+00f, 9.928212554e-01f },
+        { 1.011194315e+00f, -1.984517747e+00f, 9.743865377e-01f, -1.984517747e+00f, 9.855808524e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.021487240e+00f, -1.913116315e+00f, 9.081372803e-01f, -1.913116315e+00f, 9.296245201e-01f },
+        { 8.869251887e-01f, -1.636889390e+00f, 8.077074068e-01f, -1.636889390e+00f, 6.946325954e-01f },
+        { 9.349576869e-01f, -1.418060847e+00f, 7.024779366e-01f, -1.418060847e+00f, 6.374356235e-01f },
+        { 1.031325962e+00f, -7.766416468e-01f, 5.219573320e-01f, -7.766416468e-01f, 5.532832936e-01f },
+        { 1.123270897e+00f, 8.064263521e-01f, 4.895818071e-01f, 8.064263521e-01f, 6.128527042e-01f },
+    } },
+    { { /* 44 % */
+        { 1.001415596e+00f, -1.998194215e+00f, 9.967950709e-01f, -1.998194215e+00f, 9.982106665e-01f },
+        { 1.002828637e+00f, -1.996358813e+00f, 9.935959240e-01f, -1.996358813e+00f, 9.964245612e-01f },
+        { 1.005692366e+00f, -1.992538005e+00f, 9.871124002e-01f, -1.992538005e+00f, 9.928047662e-01f },
+        { 1.011164741e+00f, -1.984501266e+00f, 9.743996213e-01f, -1.984501266e+00f, 9.855643620e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.021380627e+00f, -1.913038770e+00f, 9.081656800e-01f, -1.913038770e+00f, 9.295463065e-01f },
+        { 8.865220595e-01f, -1.636313453e+00f, 8.075142821e-01f, -1.636313453e+00f, 6.940363416e-01f },
+        { 9.346287602e-01f, -1.417764777e+00f, 7.024649906e-01f, -1.417764777e+00f, 6.370937508e-01f },
+        { 1.030767699e+00f, -7.764418692e-01f, 5.221160396e-01f, -7.764418692e-01f, 5.528837384e-01f },
+        { 1.122041483e+00f, 8.060666583e-01f, 4.900918340e-01f, 8.060666583e-01f, 6.121333166e-01f },
+    } },
+    { { /* 45 % */
+        { 1.001408217e+00f, -1.998190094e+00f, 9.967983285e-01f, -1.998190094e+00f, 9.982065453e-01f },
+        { 1.002813887e+00f, -1.996350586e+00f, 9.936024465e-01f, -1.996350586e+00f, 9.964163337e-01f },
+        { 1.005662659e+00f, -1.992521480e+00f, 9.871255800e-01f, -1.992521480e+00f, 9.927882393e-01f },
+        { 1.011135182e+00f, -1.984484766e+00f, 9.744126709e-01f, -1.984484766e+00f, 9.855478530e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.021274049e+00f, -1.912961143e+00f, 9.081939599e-01f, -1.912961143e+00f, 9.294680091e-01f },
+        { 8.861187049e-01f, -1.635736595e+00f, 8.073204292e-01f, -1.635736595e+00f, 6.934391341e-01f },
+        { 9.342999000e-01f, -1.417468489e+00f, 7.024517273e-01f, -1.417468489e+00f, 6.367516273e-01f },
+        { 1.030209755e+00f, -7.762419643e-01f, 5.222741738e-01f, -7.762419643e-01f, 5.524839287e-01f },
+        { 1.120813687e+00f, 8.057064571e-01f, 4.905992274e-01f, 8.057064571e-01f, 6.114129142e-01f },
+    } },
+    { { /* 46 % */
+        { 1.001400846e+00f, -1.998185963e+00f, 9.968015692e-01f, -1.998185963e+00f, 9.982024147e-01f },
+        { 1.002799152e+00f, -1.996342340e+00f, 9.936089352e-01f, -1.996342340e+00f, 9.964080874e-01f },
+        { 1.005632983e+00f, -1.992504918e+00f, 9.871386915e-01f, -1.992504918e+00f, 9.927716746e-01f },
+        { 1.011105638e+00f, -1.984468247e+00f, 9.744256867e-01f, -1.984468247e+00f, 9.855313252e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.021167508e+00f, -1.912883432e+00f, 9.082221202e-01f, -1.912883432e+00f, 9.293896279e-01f },
+        { 8.857151238e-01f, -1.635158815e+00f, 8.071258485e-01f, -1.635158815e+00f, 6.928409724e-01f },
+        { 9.339711060e-01f, -1.417171984e+00f, 7.024381468e-01f, -1.417171984e+00f, 6.364092529e-01f },
+        { 1.029652130e+00f, -7.760419323e-01f, 5.224317351e-01f, -7.760419323e-01f, 5.520838646e-01f },
+        { 1.119587505e+00f, 8.053457485e-01f, 4.911039920e-01f, 8.053457485e-01f, 6.106914970e-01f },
+    } },
+    { { /* 47 % */
+        { 1.001393482e+00f, -1.998181823e+00f, 9.968047929e-01f, -1.998181823e+00f, 9.981982746e-01f },
+        { 1.002784432e+00f, -1.996334075e+00f, 9.936153900e-01f, -1.996334075e+00f, 9.963998221e-01f },
+        { 1.005603337e+00f, -1.992488318e+00f, 9.871517349e-01f, -1.992488318e+00f, 9.927550719e-01f },
+        { 1.011076110e+00f, -1.984451709e+00f, 9.744386686e-01f, -1.984451709e+00f, 9.855147786e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.021061002e+00f, -1.912805638e+00f, 9.082501608e-01f, -1.912805638e+00f, 9.293111628e-01f },
+        { 8.853113154e-01f, -1.634580113e+00f, 8.069305401e-01f, -1.634580113e+00f, 6.922418555e-01f },
+        { 9.336423781e-01f, -1.416875262e+00f, 7.024242494e-01f, -1.416875262e+00f, 6.360666275e-01f },
+        { 1.029094822e+00f, -7.758417731e-01f, 5.225887241e-01f, -7.758417731e-01f, 5.516835462e-01f },
+        { 1.118362932e+00f, 8.049845323e-01f, 4.916061323e-01f, 8.049845323e-01f, 6.099690646e-01f },
+    } },
+    { { /* 48 % */
+        { 1.001386125e+00f, -1.998177673e+00f, 9.968079997e-01f, -1.998177673e+00f, 9.981941249e-01f },
+        { 1.002769727e+00f, -1.996325791e+00f, 9.936218109e-01f, -1.996325791e+00f, 9.963915378e-01f },
+        { 1.005573721e+00f, -1.992471679e+00f, 9.871647102e-01f, -1.992471679e+00f, 9.927384313e-01f },
+        { 1.011046597e+00f, -1.984435153e+00f, 9.744516167e-01f, -1.984435153e+00f, 9.854982133e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.020954532e+00f, -1.912727761e+00f, 9.082780819e-01f, -1.912727761e+00f, 9.292326138e-01f },
+        { 8.849072787e-01f, -1.634000487e+00f, 8.067345043e-01f, -1.634000487e+00f, 6.916417830e-01f },
+        { 9.333137159e-01f, -1.416578322e+00f, 7.024100352e-01f, -1.416578322e+00f, 6.357237511e-01f },
+        { 1.028537832e+00f, -7.756414867e-01f, 5.227451413e-01f, -7.756414867e-01f, 5.512829734e-01f },
+        { 1.117139964e+00f, 8.046228084e-01f, 4.921056530e-01f, 8.046228084e-01f, 6.092456168e-01f },
+    } },
+    { { /* 49 % */
+        { 1.001378776e+00f, -1.998173514e+00f, 9.968111895e-01f, -1.998173514e+00f, 9.981899657e-01f },
+        { 1.002755036e+00f, -1.996317488e+00f, 9.936281980e-01f, -1.996317488e+00f, 9.963832344e-01f },
+        { 1.005544135e+00f, -1.992455003e+00f, 9.871776175e-01f, -1.992455003e+00f, 9.927217525e-01f },
+        { 1.011017098e+00f, -1.984418577e+00f, 9.744645309e-01f, -1.984418577e+00f, 9.854816291e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.020848097e+00f, -1.912649801e+00f, 9.083058834e-01f, -1.912649801e+00f, 9.291539806e-01f },
+        { 8.845030129e-01f, -1.633419938e+00f, 8.065377412e-01f, -1.633419938e+00f, 6.910407541e-01f },
+        { 9.329851193e-01f, -1.416281165e+00f, 7.023955044e-01f, -1.416281165e+00f, 6.353806237e-01f },
+        { 1.027981159e+00f, -7.754410732e-01f, 5.229009871e-01f, -7.754410732e-01f, 5.508821463e-01f },
+        { 1.115918595e+00f, 8.042605767e-01f, 4.926025588e-01f, 8.042605767e-01f, 6.085211535e-01f },
+    } },
+    { { /* 50 % */
+        { 1.001371434e+00f, -1.998169345e+00f, 9.968143625e-01f, -1.998169345e+00f, 9.981857970e-01f },
+        { 1.002740361e+00f, -1.996309166e+00f, 9.936345514e-01f, -1.996309166e+00f, 9.963749120e-01f },
+        { 1.005514579e+00f, -1.992438288e+00f, 9.871904568e-01f, -1.992438288e+00f, 9.927050356e-01f },
+        { 1.010987615e+00f, -1.984401983e+00f, 9.744774113e-01f, -1.984401983e+00f, 9.854650262e-01f },
+        { 1.027837701e+00f, -1.970024478e+00f, 9.464138014e-01f, -1.970024478e+00f, 9.742515022e-01f },
+        { 1.020741698e+00f, -1.912571757e+00f, 9.083335654e-01f, -1.912571757e+00f, 9.290752633e-01f },
+        { 8.840985169e-01f, -1.632838464e+00f, 8.063402511e-01f, -1.632838464e+00f, 6.904387680e-01f },
+        { 9.326565879e-01f, -1.415983790e+00f, 7.023806573e-01f, -1.415983790e+00f, 6.350372452e-01f },
+        { 1.027424803e+00f, -7.752405325e-01f, 5.230562621e-01f, -7.752405325e-01f, 5.504810649e-01f },
+        { 1.114698820e+00f, 8.038978372e-01f, 4.930968542e-01f, 8.038978372e-01f, 6.077956743e-01f },
+    } },
+    { { /* 51 % */
+        { 1.001353112e+00f, -1.998158882e+00f, 9.968222210e-01f, -1.998158882e+00f, 9.981753330e-01f },
+        { 1.002740361e+00f, -1.996309166e+00f, 9.936345514e-01f, -1.996309166e+00f, 9.963749120e-01f },
+        { 1.005514579e+00f, -1.992438288e+00f, 9.871904568e-01f, -1.992438288e+00f, 9.927050356e-01f },
+        { 1.010987615e+00f, -1.984401983e+00f, 9.744774113e-01f, -1.984401983e+00f, 9.854650262e-01f },
+        { 1.027218541e+00f, -1.969730837e+00f, 9.467386905e-01f, -1.969730837e+00f, 9.739572310e-01f },
+        { 1.020741698e+00f, -1.912571757e+00f, 9.083335654e-01f, -1.912571757e+00f, 9.290752633e-01f },
+        { 8.840985169e-01f, -1.632838464e+00f, 8.063402511e-01f, -1.632838464e+00f, 6.904387680e-01f },
+        { 9.326565879e-01f, -1.415983790e+00f, 7.023806573e-01f, -1.415983790e+00f, 6.350372452e-01f },
+        { 1.027424803e+00f, -7.752405325e-01f, 5.230562621e-01f, -7.752405325e-01f, 5.504810649e-01f },
+        { 1.120813687e+00f, 8.057064571e-01f, 4.905992274e-01f, 8.057064571e-01f, 6.114129142e-01f },
+    } },
+    { { /* 52 % */
+        { 1.001334835e+00f, -1.998148357e+00f, 9.968299742e-01f, -1.998148357e+00f, 9.981648087e-01f },
+        { 1.002740361e+00f, -1.996309166e+00f, 9.936345514e-01f, -1.996309166e+00f, 9.963749120e-01f },
+        { 1.005514579e+00f, -1.992438288e+00f, 9.871904568e-01f, -1.992438288e+00f, 9.927050356e-01f },
+        { 1.010987615e+00f, -1.984401983e+00f, 9.744774113e-01f, -1.984401983e+00f, 9.854650262e-01f },
+        { 1.026603126e+00f, -1.969433885e+00f, 9.470565155e-01f, -1.969433885e+00f, 9.736596416e-01f },
+        { 1.020741698e+00f, -1.912571757e+00f, 9.083335654e-01f, -1.912571757e+00f, 9.290752633e-01f },
+        { 8.840985169e-01f, -1.632838464e+00f, 8.063402511e-01f, -1.632838464e+00f, 6.904387680e-01f },
+        { 9.326565879e-01f, -1.415983790e+00f, 7.023806573e-01f, -1.415983790e+00f, 6.350372452e-01f },
+        { 1.027424803e+00f, -7.752405325e-01f, 5.230562621e-01f, -7.752405325e-01f, 5.504810649e-01f },
+        { 1.126968903e+00f, 8.075023907e-01f, 4.880358786e-01f, 8.075023907e-01f, 6.150047814e-01f },
+    } },
+    { { /* 53 % */
+        { 1.001316601e+00f, -1.998137773e+00f, 9.968376224e-01f, -1.998137773e+00f, 9.981542238e-01f },
+        { 1.002740361e+00f, -1.996309166e+00f, 9.936345514e-01f, -1.996309166e+00f, 9.963749120e-01f },
+        { 1.005514579e+00f, -1.992438288e+00f, 9.871904568e-01f, -1.992438288e+00f, 9.927050356e-01f },
+        { 1.010987615e+00f, -1.984401983e+00f, 9.744774113e-01f, -1.984401983e+00f, 9.854650262e-01f },
+        { 1.025991378e+00f, -1.969133585e+00f, 9.473673199e-01f, -1.969133585e+00f, 9.733586975e-01f },
+        { 1.020741698e+00f, -1.912571757e+00f, 9.083335654e-01f, -1.912571757e+00f, 9.290752633e-01f },
+        { 8.840985169e-01f, -1.632838464e+00f, 8.063402511e-01f, -1.632838464e+00f, 6.904387680e-01f },
+        { 9.326565879e-01f, -1.415983790e+00f, 7.023806573e-01f, -1.415983790e+00f, 6.350372452e-01f },
+        { 1.027424803e+00f, -7.752405325e-01f, 5.230562621e-01f, -7.752405325e-01f, 5.504810649e-01f },
+        { 1.133165082e+00f, 8.092856532e-01f, 4.854062243e-01f, 8.092856532e-01f, 6.185713064e-01f },
+    } },
+    { { /* 54 % */
+        { 1.001298412e+00f, -1.998127127e+00f, 9.968451658e-01f, -1.998127127e+00f, 9.981435780e-01f },
+        { 1.002740361e+00f, -1.996309166e+00f, 9.936345514e-01f, -1.996309166e+00f, 9.963749120e-01f },
+        { 1.005514579e+00f, -1.992438288e+00f, 9.871904568e-01f, -1.992438288e+00f, 9.927050356e-01f },
+        { 1.010987615e+00f, -1.984401983e+00f, 9.744774113e-01f, -1.984401983e+00f, 9.854650262e-01f },
+        { 1.025383215e+00f, -1.968829901e+00f, 9.476711466e-01f, -1.968829901e+00f, 9.730543620e-01f },
+        { 1.020741698e+00f, -1.912571757e+00f, 9.083335654e-01f, -1.912571757e+00f, 9.290752633e-01f },
+        { 8.840985169e-01f, -1.632838464e+00f, 8.063402511e-01f, -1.632838464e+00f, 6.904387680e-01f },
+        { 9.326565879e-01f, -1.415983790e+00f, 7.023806573e-01f, -1.415983790e+00f, 6.350372452e-01f },
+        { 1.027424803e+00f, -7.752405325e-01f, 5.230562621e-01f, -7.752405325e-01f, 5.504810649e-01f },
+        { 1.139402847e+00f, 8.110562613e-01f, 4.827096755e-01f, 8.110562613e-01f, 6.221125225e-01f },
+    } },
+    { { /* 55 % */
+        { 1.001280266e+00f, -1.998116420e+00f, 9.968526047e-01f, -1.998116420e+00f, 9.981328707e-01f },
+        { 1.002740361e+00f, -1.996309166e+00f, 9.936345514e-01f, -1.996309166e+00f, 9.963749120e-01f },
+        { 1.005514579e+00f, -1.992438288e+00f, 9.871904568e-01f, -1.992438288e+00f, 9.927050356e-01f },
+        { 1.010987615e+00f, -1.984401983e+00f, 9.744774113e-01f, -1.984401983e+00f, 9.854650262e-01f },
+        { 1.024778561e+00f, -1.968522796e+00f, 9.479680375e-01f, -1.968522796e+00f, 9.727465980e-01f },
+        { 1.020741698e+00f, -1.912571757e+00f, 9.083335654e-01f, -1.912571757e+00f, 9.290752633e-01f },
+        { 8.840985169e-01f, -1.632838464e+00f, 8.063402511e-01f, -1.632838464e+00f, 6.904387680e-01f },
+        { 9.326565879e-01f, -1.415983790e+00f, 7.023806573e-01f, -1.415983790e+00f, 6.350372452e-01f },
+        { 1.027424803e+00f, -7.752405325e-01f, 5.230562621e-01f, -7.752405325e-01f, 5.504810649e-01f },
+        { 1.145682828e+00f, 8.128142330e-01f, 4.799456378e-01f, 8.128142330e-01f, 6.256284661e-01f },
+    } },
+    { { /* 56 % */
+        { 1.001262162e+00f, -1.998105651e+00f, 9.968599393e-01f, -1.998105651e+00f, 9.981221018e-01f },
+        { 1.002740361e+00f, -1.996309166e+00f, 9.936345514e-01f, -1.996309166e+00f, 9.963749120e-01f },
+        { 1.005514579e+00f, -1.992438288e+00f, 9.871904568e-01f, -1.992438288e+00f, 9.927050356e-01f },
+        { 1.010987615e+00f, -1.984401983e+00f, 9.744774113e-01f, -1.984401983e+00f, 9.854650262e-01f },
+        { 1.024177334e+00f, -1.968212232e+00f, 9.482580334e-01f, -1.968212232e+00f, 9.724353679e-01f },
+        { 1.020741698e+00f, -1.912571757e+00f, 9.083335654e-01f, -1.912571757e+00f, 9.290752633e-01f },
+        { 8.840985169e-01f, -1.632838464e+00f, 8.063402511e-01f, -1.632838464e+00f, 6.904387680e-01f },
+        { 9.326565879e-01f, -1.415983790e+00f, 7.023806573e-01f, -1.415983790e+00f, 6.350372452e-01f },
+        { 1.027424803e+00f, -7.752405325e-01f, 5.230562621e-01f, -7.752405325e-01f, 5.504810649e-01f },
+        { 1.152005665e+00f, 8.145595880e-01f, 4.771135112e-01f, 8.145595880e-01f, 6.291191761e-01f },
+    } },
+    { { /* 57 % */
+        { 1.001244101e+00f, -1.998094820e+00f, 9.968671699e-01f, -1.998094820e+00f, 9.981112708e-01f },
+        { 1.002740361e+00f, -1.996309166e+00f, 9.936345514e-01f, -1.996309166e+00f, 9.963749120e-01f },
+        { 1.005514579e+00f, -1.992438288e+00f, 9.871904568e-01f, -1.992438288e+00f, 9.927050356e-01f },
+        { 1.010987615e+00f, -1.984401983e+00f, 9.744774113e-01f, -1.984401983e+00f, 9.854650262e-01f },
+        { 1.023579459e+00f, -1.967898172e+00f, 9.485411747e-01f, -1.967898172e+00f, 9.721206338e-01f },
+        { 1.020741698e+00f, -1.912571757e+00f, 9.083335654e-01f, -1.912571757e+00f, 9.290752633e-01f },
+        { 8.840985169e-01f, -1.632838464e+00f, 8.063402511e-01f, -1.632838464e+00f, 6.904387680e-01f },
+        { 9.326565879e-01f, -1.415983790e+00f, 7.023806573e-01f, -1.415983790e+00f, 6.350372452e-01f },
+        { 1.027424803e+00f, -7.752405325e-01f, 5.230562621e-01f, -7.752405325e-01f, 5.504810649e-01f },
+        { 1.158372004e+00f, 8.162923472e-01f, 4.742126900e-01f, 8.162923472e-01f, 6.325846944e-01f },
+    } },
+    { { /* 58 % */
+        { 1.001226081e+00f, -1.998083927e+00f, 9.968742967e-01f, -1.998083927e+00f, 9.981003774e-01f },
+        { 1.002740361e+00f, -1.996309166e+00f, 9.936345514e-01f, -1.996309166e+00f, 9.963749120e-01f },
+        { 1.005514579e+00f, -1.992438288e+00f, 9.871904568e-01f, -1.992438288e+00f, 9.927050356e-01f },
+        { 1.010987615e+00f, -1.984401983e+00f, 9.744774113e-01f, -1.984401983e+00f, 9.854650262e-01f },
+        { 1.022984857e+00f, -1.967580577e+00f, 9.488175004e-01f, -1.967580577e+00f, 9.718023574e-01f },
+        { 1.020741698e+00f, -1.912571757e+00f, 9.083335654e-01f, -1.912571757e+00f, 9.290752633e-01f },
+        { 8.840985169e-01f, -1.632838464e+00f, 8.063402511e-01f, -1.632838464e+00f, 6.904387680e-01f },
+        { 9.326565879e-01f, -1.415983790e+00f, 7.023806573e-01f, -1.415983790e+00f, 6.350372452e-01f },
+        { 1.027424803e+00f, -7.752405325e-01f, 5.230562621e-01f, -7.752405325e-01f, 5.504810649e-01f },
+        { 1.164782503e+00f, 8.180125327e-01f, 4.712425627e-01f, 8.180125327e-01f, 6.360250655e-01f },
+    } },
+    { { /* 59 % */
+        { 1.001208101e+00f, -1.998072971e+00f, 9.968813200e-01f, -1.998072971e+00f, 9.980894212e-01f },
+        { 1.002740361e+00f, -1.996309166e+00f, 9.936345514e-01f, -1.996309166e+00f, 9.963749120e-01f },
+        { 1.005514579e+00f, -1.992438288e+00f, 9.871904568e-01f, -1.992438288e+00f, 9.927050356e-01f },
+        { 1.010987615e+00f, -1.984401983e+00f, 9.744774113e-01f, -1.984401983e+00f, 9.854650262e-01f },
+        { 1.022393451e+00f, -1.967259409e+00f, 9.490870490e-01f, -1.967259409e+00f, 9.714805001e-01f },
+        { 1.020741698e+00f, -1.912571757e+00f, 9.083335654e-01f, -1.912571757e+00f, 9.290752633e-01f },
+        { 8.840985169e-01f, -1.632838464e+00f, 8.063402511e-01f, -1.632838464e+00f, 6.904387680e-01f },
+        { 9.326565879e-01f, -1.415983790e+00f, 7.023806573e-01f, -1.415983790e+00f, 6.350372452e-01f },
+        { 1.027424803e+00f, -7.752405325e-01f, 5.230562621e-01f, -7.752405325e-01f, 5.504810649e-01f },
+        { 1.171237825e+00f, 8.197201683e-01f, 4.682025121e-01f, 8.197201683e-01f, 6.394403366e-01f },
+    } },
+    { { /* 60 % */
+        { 1.001190162e+00f, -1.998061951e+00f, 9.968882399e-01f, -1.998061951e+00f, 9.980784019e-01f },
+        { 1.002740361e+00f, -1.996309166e+00f, 9.936345514e-01f, -1.996309166e+00f, 9.963749120e-01f },
+        { 1.005514579e+00f, -1.992438288e+00f, 9.871904568e-01f, -1.992438288e+00f, 9.927050356e-01f },
+        { 1.010987615e+00f, -1.984401983e+00f, 9.744774113e-01f, -1.984401983e+00f, 9.854650262e-01f },
+        { 1.021805165e+00f, -1.966934629e+00f, 9.493498579e-01f, -1.966934629e+00f, 9.711550228e-01f },
+        { 1.020741698e+00f, -1.912571757e+00f, 9.083335654e-01f, -1.912571757e+00f, 9.290752633e-01f },
+        { 8.840985169e-01f, -1.632838464e+00f, 8.063402511e-01f, -1.632838464e+00f, 6.904387680e-01f },
+        { 9.326565879e-01f, -1.415983790e+00f, 7.023806573e-01f, -1.415983790e+00f, 6.350372452e-01f },
+        { 1.027424803e+00f, -7.752405325e-01f, 5.230562621e-01f, -7.752405325e-01f, 5.504810649e-01f },
+        { 1.177738643e+00f, 8.214152788e-01f, 4.650919146e-01f, 8.214152788e-01f, 6.428305576e-01f },
+    } },
+    { { /* 61 % */
+        { 1.001172262e+00f, -1.998050869e+00f, 9.968950567e-01f, -1.998050869e+00f, 9.980673192e-01f },
+        { 1.002703735e+00f, -1.996288277e+00f, 9.936502872e-01f, -1.996288277e+00f, 9.963540223e-01f },
+        { 1.005440818e+00f, -1.992396334e+00f, 9.872222583e-01f, -1.992396334e+00f, 9.926630758e-01f },
+        { 1.010840421e+00f, -1.984318730e+00f, 9.745413067e-01f, -1.984318730e+00f, 9.853817282e-01f },
+        { 1.021219922e+00f, -1.966606196e+00f, 9.496059639e-01f, -1.966606196e+00f, 9.708258859e-01f },
+        { 1.019679619e+00f, -1.911786711e+00f, 9.086038236e-01f, -1.911786711e+00f, 9.282834428e-01f },
+        { 8.820725545e-01f, -1.629917204e+00f, 8.053419026e-01f, -1.629917204e+00f, 6.874144572e-01f },
+        { 9.293748132e-01f, -1.412998076e+00f, 7.022148263e-01f, -1.412998076e+00f, 6.315896396e-01f },
+        { 1.021878540e+00f, -7.732281351e-01f, 5.245777298e-01f, -7.732281351e-01f, 5.464562703e-01f },
+        { 1.174482504e+00f, 8.205692876e-01f, 4.666560709e-01f, 8.205692876e-01f, 6.411385752e-01f },
+    } },
+    { { /* 62 % */
+        { 1.001154402e+00f, -1.998039722e+00f, 9.969017707e-01f, -1.998039722e+00f, 9.980561725e-01f },
+        { 1.002667200e+00f, -1.996267268e+00f, 9.936658127e-01f, -1.996267268e+00f, 9.963330125e-01f },
+        { 1.005367239e+00f, -1.992354139e+00f, 9.872536366e-01f, -1.992354139e+00f, 9.926208756e-01f },
+        { 1.010693597e+00f, -1.984235003e+00f, 9.746043593e-01f, -1.984235003e+00f, 9.852979563e-01f },
+        { 1.020637647e+00f, -1.966274073e+00f, 9.498554028e-01f, -1.966274073e+00f, 9.704930496e-01f },
+        { 1.018620931e+00f, -1.910993229e+00f, 9.088621836e-01f, -1.910993229e+00f, 9.274831146e-01f },
+        { 8.800407058e-01f, -1.626972733e+00f, 8.043254108e-01f, -1.626972733e+00f, 6.843661166e-01f },
+        { 9.260993082e-01f, -1.409990573e+00f, 7.020175655e-01f, -1.409990573e+00f, 6.281168737e-01f },
+        { 1.016363400e+00f, -7.712030374e-01f, 5.260426749e-01f, -7.712030374e-01f, 5.424060747e-01f },
+        { 1.171237825e+00f, 8.197201683e-01f, 4.682025121e-01f, 8.197201683e-01f, 6.394403366e-01f },
+    } },
+    { { /* 63 % */
+        { 1.001136580e+00f, -1.998028511e+00f, 9.969083820e-01f, -1.998028511e+00f, 9.980449616e-01f },
+        { 1.002630753e+00f, -1.996246138e+00f, 9.936811284e-01f, -1.996246138e+00f, 9.963118818e-01f },
+        { 1.005293841e+00f, -1.992311703e+00f, 9.872845927e-01f, -1.992311703e+00f, 9.925784335e-01f },
+        { 1.010547137e+00f, -1.984150800e+00f, 9.746665713e-01f, -1.984150800e+00f, 9.852137080e-01f },
+        { 1.020058264e+00f, -1.965938217e+00f, 9.500982095e-01f, -1.965938217e+00f, 9.701564736e-01f },
+        { 1.017565504e+00f, -1.910191230e+00f, 9.091086906e-01f, -1.910191230e+00f, 9.266741947e-01f },
+        { 8.780028606e-01f, -1.624004971e+00f, 8.032908028e-01f, -1.624004971e+00f, 6.812936633e-01f },
+        { 9.228298403e-01f, -1.406961242e+00f, 7.017890634e-01f, -1.406961242e+00f, 6.246189037e-01f },
+        { 1.010878906e+00f, -7.691652540e-01f, 5.274516017e-01f, -7.691652540e-01f, 5.383305081e-01f },
+        { 1.168004519e+00f, 8.188679177e-01f, 4.697313166e-01f, 8.188679177e-01f, 6.377358355e-01f },
+    } },
+    { { /* 64 % */
+        { 1.001118795e+00f, -1.998017236e+00f, 9.969148909e-01f, -1.998017236e+00f, 9.980336862e-01f },
+        { 1.002594395e+00f, -1.996224886e+00f, 9.936962347e-01f, -1.996224886e+00f, 9.962906295e-01f },
+        { 1.005220621e+00f, -1.992269023e+00f, 9.873151277e-01f, -1.992269023e+00f, 9.925357483e-01f },
+        { 1.010401036e+00f, -1.984066118e+00f, 9.747279447e-01f, -1.984066118e+00f, 9.851289805e-01f },
+        { 1.019481699e+00f, -1.965598590e+00f, 9.503344182e-01f, -1.965598590e+00f, 9.698161172e-01f },
+        { 1.016513210e+00f, -1.909380628e+00f, 9.093433886e-01f, -1.909380628e+00f, 9.258565985e-01f },
+        { 8.759589104e-01f, -1.621013839e+00f, 8.022381057e-01f, -1.621013839e+00f, 6.781970161e-01f },
+        { 9.195661809e-01f, -1.403910048e+00f, 7.015295078e-01f, -1.403910048e+00f, 6.210956887e-01f },
+        { 1.005424593e+00f, -7.671148019e-01f, 5.288050107e-01f, -7.671148019e-01f, 5.342296038e-01f },
+        { 1.164782503e+00f, 8.180125327e-01f, 4.712425627e-01f, 8.180125327e-01f, 6.360250655e-01f },
+    } },
+    { { /* 65 % */
+        { 1.001101048e+00f, -1.998005896e+00f, 9.969212976e-01f, -1.998005896e+00f, 9.980223458e-01f },
+        { 1.002558123e+00f, -1.996203512e+00f, 9.937111322e-01f, -1.996203512e+00f, 9.962692550e-01f },
+        { 1.005147576e+00f, -1.992226099e+00f, 9.873452427e-01f, -1.992226099e+00f, 9.924928184e-01f },
+        { 1.010255289e+00f, -1.983980954e+00f, 9.747884817e-01f, -1.983980954e+00f, 9.850437712e-01f },
+        { 1.018907877e+00f, -1.965255149e+00f, 9.505640622e-01f, -1.965255149e+00f, 9.694719393e-01f },
+        { 1.015463920e+00f, -1.908561340e+00f, 9.095663204e-01f, -1.908561340e+00f, 9.250302407e-01f },
+        { 8.739087485e-01f, -1.617999262e+00f, 8.011673471e-01f, -1.617999262e+00f, 6.750760956e-01f },
+        { 9.163081051e-01f, -1.400836959e+00f, 7.012390853e-01f, -1.400836959e+00f, 6.175471904e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 1.161571692e+00f, 8.171540102e-01f, 4.727363280e-01f, 8.171540102e-01f, 6.343080204e-01f },
+    } },
+    { { /* 66 % */
+        { 1.001083338e+00f, -1.997994490e+00f, 9.969276023e-01f, -1.997994490e+00f, 9.980109400e-01f },
+        { 1.002521936e+00f, -1.996182016e+00f, 9.937258214e-01f, -1.996182016e+00f, 9.962477576e-01f },
+        { 1.005074704e+00f, -1.992182929e+00f, 9.873749386e-01f, -1.992182929e+00f, 9.924496426e-01f },
+        { 1.010109893e+00f, -1.983895306e+00f, 9.748481844e-01f, -1.983895306e+00f, 9.849580773e-01f },
+        { 1.018336724e+00f, -1.964907853e+00f, 9.507871740e-01f, -1.964907853e+00f, 9.691238983e-01f },
+        { 1.014417508e+00f, -1.907733280e+00f, 9.097775274e-01f, -1.907733280e+00f, 9.241950352e-01f },
+        { 8.718522699e-01f, -1.614961163e+00f, 8.000785547e-01f, -1.614961163e+00f, 6.719308246e-01f },
+        { 9.130553916e-01f, -1.397741942e+00f, 7.009179818e-01f, -1.397741942e+00f, 6.139733734e-01f },
+        { 9.946046743e-01f, -7.629759677e-01f, 5.313472611e-01f, -7.629759677e-01f, 5.259519355e-01f },
+        { 1.158372004e+00f, 8.162923472e-01f, 4.742126900e-01f, 8.162923472e-01f, 6.325846944e-01f },
+    } },
+    { { /* 67 % */
+        { 1.001065663e+00f, -1.997983019e+00f, 9.969338052e-01f, -1.997983019e+00f, 9.979994685e-01f },
+        { 1.002485834e+00f, -1.996160395e+00f, 9.937403028e-01f, -1.996160395e+00f, 9.962261365e-01f },
+        { 1.005002003e+00f, -1.992139512e+00f, 9.874042164e-01f, -1.992139512e+00f, 9.924062194e-01f },
+        { 1.009964841e+00f, -1.983809171e+00f, 9.749070547e-01f, -1.983809171e+00f, 9.848718962e-01f },
+        { 1.017768167e+00f, -1.964556660e+00f, 9.510037852e-01f, -1.964556660e+00f, 9.687719524e-01f },
+        { 1.013373846e+00f, -1.906896362e+00f, 9.099770495e-01f, -1.906896362e+00f, 9.233508957e-01f },
+        { 8.697893715e-01f, -1.611899471e+00f, 7.989717565e-01f, -1.611899471e+00f, 6.687611280e-01f },
+        { 9.098078228e-01f, -1.394624971e+00f, 7.005663822e-01f, -1.394624971e+00f, 6.103742050e-01f },
+        { 9.892381705e-01f, -7.608876287e-01f, 5.325370870e-01f, -7.608876287e-01f, 5.217752575e-01f },
+        { 1.155183356e+00f, 8.154275407e-01f, 4.756717255e-01f, 8.154275407e-01f, 6.308550815e-01f },
+    } },
+    { { /* 68 % */
+        { 1.001048024e+00f, -1.997971481e+00f, 9.969399066e-01f, -1.997971481e+00f, 9.979879309e-01f },
+        { 1.002449814e+00f, -1.996138651e+00f, 9.937545768e-01f, -1.996138651e+00f, 9.962043911e-01f },
+        { 1.004929470e+00f, -1.992095846e+00f, 9.874330772e-01f, -1.992095846e+00f, 9.923625474e-01f },
+        { 1.009820130e+00f, -1.983722546e+00f, 9.749650947e-01f, -1.983722546e+00f, 9.847852251e-01f },
+        { 1.017202132e+00f, -1.964201529e+00f, 9.512139267e-01f, -1.964201529e+00f, 9.684160591e-01f },
+        { 1.012332809e+00f, -1.906050500e+00f, 9.101649255e-01f, -1.906050500e+00f, 9.224977346e-01f },
+        { 8.677199520e-01f, -1.608814116e+00f, 7.978469806e-01f, -1.608814116e+00f, 6.655669326e-01f },
+        { 9.065651851e-01f, -1.391486019e+00f, 7.001844706e-01f, -1.391486019e+00f, 6.067496557e-01f },
+        { 9.839000501e-01f, -7.587867071e-01f, 5.336733641e-01f, -7.587867071e-01f, 5.175734142e-01f },
+        { 1.152005665e+00f, 8.145595880e-01f, 4.771135112e-01f, 8.145595880e-01f, 6.291191761e-01f },
+    } },
+    { { /* 69 % */
+        { 1.001030420e+00f, -1.997959877e+00f, 9.969459066e-01f, -1.997959877e+00f, 9.979763269e-01f },
+        { 1.002413877e+00f, -1.996116781e+00f, 9.937686439e-01f, -1.996116781e+00f, 9.961825207e-01f },
+        { 1.004857103e+00f, -1.992051929e+00f, 9.874615219e-01f, -1.992051929e+00f, 9.923186253e-01f },
+        { 1.009675755e+00f, -1.983635429e+00f, 9.750223064e-01f, -1.983635429e+00f, 9.846980613e-01f },
+        { 1.016638547e+00f, -1.963842416e+00f, 9.514176286e-01f, -1.963842416e+00f, 9.680561756e-01f },
+        { 1.011294271e+00f, -1.905195606e+00f, 9.103411930e-01f, -1.905195606e+00f, 9.216354642e-01f },
+        { 8.656439116e-01f, -1.605705027e+00f, 7.967042558e-01f, -1.605705027e+00f, 6.623481674e-01f },
+        { 9.033272683e-01f, -1.388325064e+00f, 6.997724305e-01f, -1.388325064e+00f, 6.030996988e-01f },
+        { 9.785898817e-01f, -7.566732293e-01f, 5.347565769e-01f, -7.566732293e-01f, 5.133464585e-01f },
+        { 1.148838849e+00f, 8.136884864e-01f, 4.785381233e-01f, 8.136884864e-01f, 6.273769727e-01f },
+    } },
+    { { /* 70 % */
+        { 1.001012851e+00f, -1.997948206e+00f, 9.969518054e-01f, -1.997948206e+00f, 9.979646560e-01f },
+        { 1.002378020e+00f, -1.996094785e+00f, 9.937825047e-01f, -1.996094785e+00f, 9.961605244e-01f },
+        { 1.004784900e+00f, -1.992007761e+00f, 9.874895514e-01f, -1.992007761e+00f, 9.922744515e-01f },
+        { 1.009531710e+00f, -1.983547817e+00f, 9.750786918e-01f, -1.983547817e+00f, 9.846104020e-01f },
+        { 1.016077339e+00f, -1.963479279e+00f, 9.516149200e-01f, -1.963479279e+00f, 9.676922587e-01f },
+        { 1.010258108e+00f, -1.904331593e+00f, 9.105058882e-01f, -1.904331593e+00f, 9.207639957e-01f },
+        { 8.635611527e-01f, -1.602572140e+00f, 7.955436109e-01f, -1.602572140e+00f, 6.591047636e-01f },
+        { 9.000938661e-01f, -1.385142084e+00f, 6.993304445e-01f, -1.385142084e+00f, 5.994243106e-01f },
+        { 9.733072408e-01f, -7.545472236e-01f, 5.357872065e-01f, -7.545472236e-01f, 5.090944473e-01f },
+        { 1.145682828e+00f, 8.128142330e-01f, 4.799456378e-01f, 8.128142330e-01f, 6.256284661e-01f },
+    } },
+    { { /* 71 % */
+        { 1.000995315e+00f, -1.997936468e+00f, 9.969576032e-01f, -1.997936468e+00f, 9.979529178e-01f },
+        { 1.002342242e+00f, -1.996072663e+00f, 9.937961595e-01f, -1.996072663e+00f, 9.961384017e-01f },
+        { 1.004712858e+00f, -1.991963341e+00f, 9.875171668e-01f, -1.991963341e+00f, 9.922300247e-01f },
+        { 1.009387992e+00f, -1.983459706e+00f, 9.751342527e-01f, -1.983459706e+00f, 9.845222444e-01f },
+        { 1.015797603e+00f, -1.963296187e+00f, 9.517111708e-01f, -1.963296187e+00f, 9.675087741e-01f },
+        { 1.009740877e+00f, -1.903896140e+00f, 9.105839072e-01f, -1.903896140e+00f, 9.203247844e-01f },
+        { 8.614715794e-01f, -1.599415389e+00f, 7.943650753e-01f, -1.599415389e+00f, 6.558366547e-01f },
+        { 8.984787945e-01f, -1.383542330e+00f, 6.990982786e-01f, -1.383542330e+00f, 5.975770732e-01f },
+        { 9.706761125e-01f, -7.534795323e-01f, 5.362829521e-01f, -7.534795323e-01f, 5.069590647e-01f },
+        { 1.142537521e+00f, 8.119368255e-01f, 4.813361301e-01f, 8.119368255e-01f, 6.238736510e-01f },
+    } },
+    { { /* 72 % */
+        { 1.000977812e+00f, -1.997924663e+00f, 9.969633003e-01f, -1.997924663e+00f, 9.979411121e-01f },
+        { 1.002306543e+00f, -1.996050414e+00f, 9.938096088e-01f, -1.996050414e+00f, 9.961161517e-01f },
+        { 1.004640975e+00f, -1.991918665e+00f, 9.875443688e-01f, -1.991918665e+00f, 9.921853434e-01f },
+        { 1.009244595e+00f, -1.983371095e+00f, 9.751889911e-01f, -1.983371095e+00f, 9.844335858e-01f },
+        { 1.015518435e+00f, -1.963112073e+00f, 9.518058295e-01f, -1.963112073e+00f, 9.673242648e-01f },
+        { 1.009224194e+00f, -1.903458373e+00f, 9.106590461e-01f, -1.903458373e+00f, 9.198832400e-01f },
+        { 8.593750975e-01f, -1.596234713e+00f, 7.931686789e-01f, -1.596234713e+00f, 6.525437764e-01f },
+        { 8.968647759e-01f, -1.381937063e+00f, 6.988586946e-01f, -1.381937063e+00f, 5.957234705e-01f },
+        { 9.680517102e-01f, -7.524087207e-01f, 5.367657312e-01f, -7.524087207e-01f, 5.048174413e-01f },
+        { 1.139402847e+00f, 8.110562613e-01f, 4.827096755e-01f, 8.110562613e-01f, 6.221125225e-01f },
+    } },
+    { { /* 73 % */
+        { 1.000960342e+00f, -1.997912789e+00f, 9.969688967e-01f, -1.997912789e+00f, 9.979292383e-01f },
+        { 1.002270921e+00f, -1.996028037e+00f, 9.938228531e-01f, -1.996028037e+00f, 9.960937738e-01f },
+        { 1.004569248e+00f, -1.991873734e+00f, 9.875711586e-01f, -1.991873734e+00f, 9.921404062e-01f },
+        { 1.009101514e+00f, -1.983281981e+00f, 9.752429089e-01f, -1.983281981e+00f, 9.843444234e-01f },
+        { 1.015239826e+00f, -1.962926930e+00f, 9.518988996e-01f, -1.962926930e+00f, 9.671387252e-01f },
+        { 1.008708042e+00f, -1.903018282e+00f, 9.107313091e-01f, -1.903018282e+00f, 9.194393513e-01f },
+        { 8.572716148e-01f, -1.593030051e+00f, 7.919544519e-01f, -1.593030051e+00f, 6.492260667e-01f },
+        { 8.952517855e-01f, -1.380326282e+00f, 6.986117149e-01f, -1.380326282e+00f, 5.938635004e-01f },
+        { 9.654339826e-01f, -7.513347927e-01f, 5.372356029e-01f, -7.513347927e-01f, 5.026695854e-01f },
+        { 1.136278727e+00f, 8.101725379e-01f, 4.840663487e-01f, 8.101725379e-01f, 6.203450759e-01f },
+    } },
+    { { /* 74 % */
+        { 1.000942903e+00f, -1.997900847e+00f, 9.969743928e-01f, -1.997900847e+00f, 9.979172961e-01f },
+        { 1.002235374e+00f, -1.996005531e+00f, 9.938358928e-01f, -1.996005531e+00f, 9.960712672e-01f },
+        { 1.004497675e+00f, -1.991828546e+00f, 9.875975369e-01f, -1.991828546e+00f, 9.920952116e-01f },
+        { 1.008958746e+00f, -1.983192359e+00f, 9.752960079e-01f, -1.983192359e+00f, 9.842547543e-01f },
+        { 1.014961765e+00f, -1.962740754e+00f, 9.519903846e-01f, -1.962740754e+00f, 9.669521497e-01f },
+        { 1.008192407e+00f, -1.902575855e+00f, 9.108007003e-01f, -1.902575855e+00f, 9.189931070e-01f },
+        { 8.551610411e-01f, -1.589801347e+00f, 7.907224250e-01f, -1.589801347e+00f, 6.458834661e-01f },
+        { 8.936397988e-01f, -1.378709984e+00f, 6.983573623e-01f, -1.378709984e+00f, 5.919971611e-01f },
+        { 9.628228791e-01f, -7.502577528e-01f, 5.376926264e-01f, -7.502577528e-01f, 5.005155055e-01f },
+        { 1.133165082e+00f, 8.092856532e-01f, 4.854062243e-01f, 8.092856532e-01f, 6.185713064e-01f },
+    } },
+    { { /* 75 % */
+        { 1.000925496e+00f, -1.997888836e+00f, 9.969797887e-01f, -1.997888836e+00f, 9.979052851e-01f },
+        { 1.002199903e+00f, -1.995982896e+00f, 9.938487283e-01f, -1.995982896e+00f, 9.960486312e-01f },
+        { 1.004426254e+00f, -1.991783098e+00f, 9.876235046e-01f, -1.991783098e+00f, 9.920497582e-01f },
+        { 1.008816286e+00f, -1.983102229e+00f, 9.753482900e-01f, -1.983102229e+00f, 9.841645757e-01f },
+        { 1.014684245e+00f, -1.962553539e+00f, 9.520802877e-01f, -1.962553539e+00f, 9.667645329e-01f },
+        { 1.007677272e+00f, -1.902131082e+00f, 9.108672238e-01f, -1.902131082e+00f, 9.185444958e-01f },
+        { 8.530432878e-01f, -1.586548545e+00f, 7.894726295e-01f, -1.586548545e+00f, 6.425159173e-01f },
+        { 8.920287915e-01f, -1.377088170e+00f, 6.980956593e-01f, -1.377088170e+00f, 5.901244508e-01f },
+        { 9.602183496e-01f, -7.491776052e-01f, 5.381368608e-01f, -7.491776052e-01f, 4.983552104e-01f },
+        { 1.130061833e+00f, 8.083956048e-01f, 4.867293764e-01f, 8.083956048e-01f, 6.167912097e-01f },
+    } },
+    { { /* 76 % */
+        { 1.000908120e+00f, -1.997876756e+00f, 9.969850845e-01f, -1.997876756e+00f, 9.978932049e-01f },
+        { 1.002164505e+00f, -1.995960130e+00f, 9.938613602e-01f, -1.995960130e+00f, 9.960258651e-01f },
+        { 1.004354982e+00f, -1.991737391e+00f, 9.876490627e-01f, -1.991737391e+00f, 9.920040444e-01f },
+        { 1.008674128e+00f, -1.983011587e+00f, 9.753997569e-01f, -1.983011587e+00f, 9.840738848e-01f },
+        { 1.014407257e+00f, -1.962365279e+00f, 9.521686123e-01f, -1.962365279e+00f, 9.665758690e-01f },
+        { 1.007162623e+00f, -1.901683950e+00f, 9.109308834e-01f, -1.901683950e+00f, 9.180935062e-01f },
+        { 8.509182686e-01f, -1.583271592e+00f, 7.882050972e-01f, -1.583271592e+00f, 6.391233659e-01f },
+        { 8.904187395e-01f, -1.375460836e+00f, 6.978266285e-01f, -1.375460836e+00f, 5.882453680e-01f },
+        { 9.576203442e-01f, -7.480943545e-01f, 5.385683648e-01f, -7.480943545e-01f, 4.961887089e-01f },
+        { 1.126968903e+00f, 8.075023907e-01f, 4.880358786e-01f, 8.075023907e-01f, 6.150047814e-01f },
+    } },
+    { { /* 77 % */
+        { 1.000890775e+00f, -1.997864606e+00f, 9.969902804e-01f, -1.997864606e+00f, 9.978810552e-01f },
+        { 1.002129179e+00f, -1.995937234e+00f, 9.938737887e-01f, -1.995937234e+00f, 9.960029680e-01f },
+        { 1.004283857e+00f, -1.991691421e+00f, 9.876742120e-01f, -1.991691421e+00f, 9.919580689e-01f },
+        { 1.008532268e+00f, -1.982920429e+00f, 9.754504105e-01f, -1.982920429e+00f, 9.839826786e-01f },
+        { 1.014130791e+00f, -1.962175969e+00f, 9.522553614e-01f, -1.962175969e+00f, 9.663861524e-01f },
+        { 1.006648444e+00f, -1.901234450e+00f, 9.109916831e-01f, -1.901234450e+00f, 9.176401268e-01f },
+        { 8.487858988e-01f, -1.579970437e+00f, 7.869198607e-01f, -1.579970437e+00f, 6.357057595e-01f },
+        { 8.888096190e-01f, -1.373827983e+00f, 6.975502924e-01f, -1.373827983e+00f, 5.863599115e-01f },
+        { 9.550288134e-01f, -7.470080053e-01f, 5.389871971e-01f, -7.470080053e-01f, 4.940160105e-01f },
+        { 1.123886213e+00f, 8.066060088e-01f, 4.893258046e-01f, 8.066060088e-01f, 6.132120176e-01f },
+    } },
+    { { /* 78 % */
+        { 1.000873459e+00f, -1.997852386e+00f, 9.969953767e-01f, -1.997852386e+00f, 9.978688354e-01f },
+        { 1.002093925e+00f, -1.995914206e+00f, 9.938860143e-01f, -1.995914206e+00f, 9.959799392e-01f },
+        { 1.004212877e+00f, -1.991645189e+00f, 9.876989533e-01f, -1.991645189e+00f, 9.919118301e-01f },
+        { 1.008390702e+00f, -1.982828754e+00f, 9.755002524e-01f, -1.982828754e+00f, 9.838909544e-01f },
+        { 1.013854839e+00f, -1.961985602e+00f, 9.523405385e-01f, -1.961985602e+00f, 9.661953775e-01f },
+        { 1.006134720e+00f, -1.900782568e+00f, 9.110496267e-01f, -1.900782568e+00f, 9.171843462e-01f },
+        { 8.466460958e-01f, -1.576645034e+00f, 7.856169528e-01f, -1.576645034e+00f, 6.322630486e-01f },
+        { 8.872014066e-01f, -1.372189609e+00f, 6.972666736e-01f, -1.372189609e+00f, 5.844680801e-01f },
+        { 9.524437085e-01f, -7.459185623e-01f, 5.393934162e-01f, -7.459185623e-01f, 4.918371246e-01f },
+        { 1.120813687e+00f, 8.057064571e-01f, 4.905992274e-01f, 8.057064571e-01f, 6.114129142e-01f },
+    } },
+    { { /* 79 % */
+        { 1.000856172e+00f, -1.997840096e+00f, 9.970003734e-01f, -1.997840096e+00f, 9.978565452e-01f },
+        { 1.002058741e+00f, -1.995891046e+00f, 9.938980375e-01f, -1.995891046e+00f, 9.959567781e-01f },
+        { 1.004142039e+00f, -1.991598691e+00f, 9.877232875e-01f, -1.991598691e+00f, 9.918653265e-01f },
+        { 1.008249425e+00f, -1.982736559e+00f, 9.755492845e-01f, -1.982736559e+00f, 9.837987092e-01f },
+        { 1.013579392e+00f, -1.961794174e+00f, 9.524241465e-01f, -1.961794174e+00f, 9.660035386e-01f },
+        { 1.005621435e+00f, -1.900328295e+00f, 9.111047178e-01f, -1.900328295e+00f, 9.167261528e-01f },
+        { 8.444987789e-01f, -1.573295336e+00f, 7.842964074e-01f, -1.573295336e+00f, 6.287951863e-01f },
+        { 8.855940786e-01f, -1.370545713e+00f, 6.969757944e-01f, -1.370545713e+00f, 5.825698731e-01f },
+        { 9.498649807e-01f, -7.448260305e-01f, 5.397870804e-01f, -7.448260305e-01f, 4.896520611e-01f },
+        { 1.117751248e+00f, 8.048037338e-01f, 4.918562198e-01f, 8.048037338e-01f, 6.096074677e-01f },
+    } },
+    { { /* 80 % */
+        { 1.000838914e+00f, -1.997827736e+00f, 9.970052708e-01f, -1.997827736e+00f, 9.978441843e-01f },
+        { 1.002023625e+00f, -1.995867752e+00f, 9.939098586e-01f, -1.995867752e+00f, 9.959334838e-01f },
+        { 1.004071341e+00f, -1.991551928e+00f, 9.877472154e-01f, -1.991551928e+00f, 9.918185566e-01f },
+        { 1.008108432e+00f, -1.982643839e+00f, 9.755975083e-01f, -1.982643839e+00f, 9.837059402e-01f },
+        { 1.013304441e+00f, -1.961601679e+00f, 9.525061886e-01f, -1.961601679e+00f, 9.658106300e-01f },
+        { 1.005108575e+00f, -1.899871618e+00f, 9.111569602e-01f, -1.899871618e+00f, 9.162655351e-01f },
+        { 8.423438694e-01f, -1.569921301e+00f, 7.829582588e-01f, -1.569921301e+00f, 6.253021283e-01f },
+        { 8.839876122e-01f, -1.368896296e+00f, 6.966776774e-01f, -1.368896296e+00f, 5.806652896e-01f },
+        { 9.472925821e-01f, -7.437304149e-01f, 5.401682478e-01f, -7.437304149e-01f, 4.874608298e-01f },
+        { 1.114698820e+00f, 8.038978372e-01f, 4.930968542e-01f, 8.038978372e-01f, 6.077956743e-01f },
+    } },
+    { { /* 81 % */
+        { 1.000821683e+00f, -1.997815303e+00f, 9.970100689e-01f, -1.997815303e+00f, 9.978317521e-01f },
+        { 1.002023625e+00f, -1.995867752e+00f, 9.939098586e-01f, -1.995867752e+00f, 9.959334838e-01f },
+        { 1.004071341e+00f, -1.991551928e+00f, 9.877472154e-01f, -1.991551928e+00f, 9.918185566e-01f },
+        { 1.007827281e+00f, -1.982456818e+00f, 9.756915381e-01f, -1.982456818e+00f, 9.835188187e-01f },
+        { 1.013029978e+00f, -1.961408110e+00f, 9.525866678e-01f, -1.961408110e+00f, 9.656166458e-01f },
+        { 1.004596124e+00f, -1.899412526e+00f, 9.112063573e-01f, -1.899412526e+00f, 9.158024815e-01f },
+        { 8.401812907e-01f, -1.566522889e+00f, 7.816025422e-01f, -1.566522889e+00f, 6.217838330e-01f },
+        { 8.823819843e-01f, -1.367241355e+00f, 6.963723450e-01f, -1.367241355e+00f, 5.787543293e-01f },
+        { 9.421665817e-01f, -7.415299530e-01f, 5.408933243e-01f, -7.415299530e-01f, 4.830599060e-01f },
+        { 1.108623697e+00f, 8.020765171e-01f, 4.955293374e-01f, 8.020765171e-01f, 6.041530342e-01f },
+    } },
+    { { /* 82 % */
+        { 1.000804480e+00f, -1.997802800e+00f, 9.970147681e-01f, -1.997802800e+00f, 9.978192483e-01f },
+        { 1.002023625e+00f, -1.995867752e+00f, 9.939098586e-01f, -1.995867752e+00f, 9.959334838e-01f },
+        { 1.004071341e+00f, -1.991551928e+00f, 9.877472154e-01f, -1.991551928e+00f, 9.918185566e-01f },
+        { 1.007547211e+00f, -1.982267667e+00f, 9.757823549e-01f, -1.982267667e+00f, 9.833295663e-01f },
+        { 1.012755993e+00f, -1.961213462e+00f, 9.526655871e-01f, -1.961213462e+00f, 9.654215804e-01f },
+        { 1.004084068e+00f, -1.898951007e+00f, 9.112529126e-01f, -1.898951007e+00f, 9.153369803e-01f },
+        { 8.380109681e-01f, -1.563100062e+00f, 7.802292935e-01f, -1.563100062e+00f, 6.182402616e-01f },
+        { 8.807771723e-01f, -1.365580893e+00f, 6.960598196e-01f, -1.365580893e+00f, 5.768369919e-01f },
+        { 9.370653310e-01f, -7.393172194e-01f, 5.415691078e-01f, -7.393172194e-01f, 4.786344388e-01f },
+        { 1.102587719e+00f, 8.002424846e-01f, 4.978972502e-01f, 8.002424846e-01f, 6.004849692e-01f },
+    } },
+    { { /* 83 % */
+        { 1.000787304e+00f, -1.997790224e+00f, 9.970193684e-01f, -1.997790224e+00f, 9.978066725e-01f },
+        { 1.002023625e+00f, -1.995867752e+00f, 9.939098586e-01f, -1.995867752e+00f, 9.959334838e-01f },
+        { 1.004071341e+00f, -1.991551928e+00f, 9.877472154e-01f, -1.991551928e+00f, 9.918185566e-01f },
+        { 1.007268188e+00f, -1.982076362e+00f, 9.758699712e-01f, -1.982076362e+00f, 9.831381592e-01f },
+        { 1.012482478e+00f, -1.961017729e+00f, 9.527429495e-01f, -1.961017729e+00f, 9.652254279e-01f },
+        { 1.003572390e+00f, -1.898487050e+00f, 9.112966297e-01f, -1.898487050e+00f, 9.148690199e-01f },
+        { 8.358328289e-01f, -1.559652785e+00f, 7.788385492e-01f, -1.559652785e+00f, 6.146713781e-01f },
+        { 8.791731537e-01f, -1.363914907e+00f, 6.957401235e-01f, -1.363914907e+00f, 5.749132772e-01f },
+        { 9.319884599e-01f, -7.370922590e-01f, 5.421960581e-01f, -7.370922590e-01f, 4.741845180e-01f },
+        { 1.096590297e+00f, 7.983957290e-01f, 5.002011607e-01f, 7.983957290e-01f, 5.967914580e-01f },
+    } },
+    { { /* 84 % */
+        { 1.000770154e+00f, -1.997777576e+00f, 9.970238700e-01f, -1.997777576e+00f, 9.977940242e-01f },
+        { 1.002023625e+00f, -1.995867752e+00f, 9.939098586e-01f, -1.995867752e+00f, 9.959334838e-01f },
+        { 1.004071341e+00f, -1.991551928e+00f, 9.877472154e-01f, -1.991551928e+00f, 9.918185566e-01f },
+        { 1.006990174e+00f, -1.981882880e+00f, 9.759543994e-01f, -1.981882880e+00f, 9.829445734e-01f },
+        { 1.012209425e+00f, -1.960820906e+00f, 9.528187578e-01f, -1.960820906e+00f, 9.650281825e-01f },
+        { 1.003061077e+00f, -1.898020643e+00f, 9.113375118e-01f, -1.898020643e+00f, 9.143985885e-01f },
+        { 8.336468025e-01f, -1.556181027e+00f, 7.774303469e-01f, -1.556181027e+00f, 6.110771495e-01f },
+        { 8.775699064e-01f, -1.362243398e+00f, 6.954132792e-01f, -1.362243398e+00f, 5.729831856e-01f },
+        { 9.269356054e-01f, -7.348551189e-01f, 5.427746323e-01f, -7.348551189e-01f, 4.697102377e-01f },
+        { 1.090630850e+00f, 7.965362411e-01f, 5.024416321e-01f, 7.965362411e-01f, 5.930724822e-01f },
+    } },
+    { { /* 85 % */
+        { 1.000753030e+00f, -1.997764855e+00f, 9.970282730e-01f, -1.997764855e+00f, 9.977813031e-01f },
+        { 1.002023625e+00f, -1.995867752e+00f, 9.939098586e-01f, -1.995867752e+00f, 9.959334838e-01f },
+        { 1.004071341e+00f, -1.991551928e+00f, 9.877472154e-01f, -1.991551928e+00f, 9.918185566e-01f },
+        { 1.006713133e+00f, -1.981687196e+00f, 9.760356513e-01f, -1.981687196e+00f, 9.827487843e-01f },
+        { 1.011936824e+00f, -1.960622987e+00f, 9.528930148e-01f, -1.960622987e+00f, 9.648298384e-01f },
+        { 1.002550112e+00f, -1.897551775e+00f, 9.113755622e-01f, -1.897551775e+00f, 9.139256744e-01f },
+        { 8.314528204e-01f, -1.552684758e+00f, 7.760047249e-01f, -1.552684758e+00f, 6.074575454e-01f },
+        { 8.759674084e-01f, -1.360566368e+00f, 6.950793090e-01f, -1.360566368e+00f, 5.710467174e-01f },
+        { 9.219064107e-01f, -7.326058482e-01f, 5.433052856e-01f, -7.326058482e-01f, 4.652116964e-01f },
+        { 1.084708804e+00f, 7.946640132e-01f, 5.046192227e-01f, 7.946640132e-01f, 5.893280265e-01f },
+    } },
+    { { /* 86 % */
+        { 1.000735931e+00f, -1.997752061e+00f, 9.970325775e-01f, -1.997752061e+00f, 9.977685088e-01f },
+        { 1.002023625e+00f, -1.995867752e+00f, 9.939098586e-01f, -1.995867752e+00f, 9.959334838e-01f },
+        { 1.004071341e+00f, -1.991551928e+00f, 9.877472154e-01f, -1.991551928e+00f, 9.918185566e-01f },
+        { 1.006437029e+00f, -1.981489285e+00f, 9.761137384e-01f, -1.981489285e+00f, 9.825507675e-01f },
+        { 1.011664666e+00f, -1.960423965e+00f, 9.529657235e-01f, -1.960423965e+00f, 9.646303895e-01f },
+        { 1.002039482e+00f, -1.897080433e+00f, 9.114107840e-01f, -1.897080433e+00f, 9.134502657e-01f },
+        { 8.292508162e-01f, -1.549163952e+00f, 7.745617225e-01f, -1.549163952e+00f, 6.038125387e-01f },
+        { 8.743656379e-01f, -1.358883815e+00f, 6.947382352e-01f, -1.358883815e+00f, 5.691038731e-01f },
+        { 9.169005259e-01f, -7.303444983e-01f, 5.437884708e-01f, -7.303444983e-01f, 4.606889966e-01f },
+        { 1.078823593e+00f, 7.927790394e-01f, 5.067344862e-01f, 7.927790394e-01f, 5.855580789e-01f },
+    } },
+    { { /* 87 % */
+        { 1.000718857e+00f, -1.997739193e+00f, 9.970367839e-01f, -1.997739193e+00f, 9.977556407e-01f },
+        { 1.002023625e+00f, -1.995867752e+00f, 9.939098586e-01f, -1.995867752e+00f, 9.959334838e-01f },
+        { 1.004071341e+00f, -1.991551928e+00f, 9.877472154e-01f, -1.991551928e+00f, 9.918185566e-01f },
+        { 1.006161826e+00f, -1.981289123e+00f, 9.761886716e-01f, -1.981289123e+00f, 9.823504980e-01f },
+        { 1.011392944e+00f, -1.960223835e+00f, 9.530368865e-01f, -1.960223835e+00f, 9.644298301e-01f },
+        { 1.001529170e+00f, -1.896606607e+00f, 9.114431805e-01f, -1.896606607e+00f, 9.129723506e-01f },
+        { 8.270407254e-01f, -1.545618585e+00f, 7.731013796e-01f, -1.545618585e+00f, 6.001421050e-01f },
+        { 8.727645735e-01f, -1.357195742e+00f, 6.943900801e-01f, -1.357195742e+00f, 5.671546536e-01f },
+        { 9.119176072e-01f, -7.280711228e-01f, 5.442246384e-01f, -7.280711228e-01f, 4.561422456e-01f },
+        { 1.072974659e+00f, 7.908813153e-01f, 5.087879715e-01f, 7.908813153e-01f, 5.817626305e-01f },
+    } },
+    { { /* 88 % */
+        { 1.000701806e+00f, -1.997726251e+00f, 9.970408920e-01f, -1.997726251e+00f, 9.977426985e-01f },
+        { 1.002023625e+00f, -1.995867752e+00f, 9.939098586e-01f, -1.995867752e+00f, 9.959334838e-01f },
+        { 1.004071341e+00f, -1.991551928e+00f, 9.877472154e-01f, -1.991551928e+00f, 9.918185566e-01f },
+        { 1.005887489e+00f, -1.981086684e+00f, 9.762604615e-01f, -1.981086684e+00f, 9.821479506e-01f },
+        { 1.011121647e+00f, -1.960022591e+00f, 9.531065066e-01f, -1.960022591e+00f, 9.642281541e-01f },
+        { 1.001019163e+00f, -1.896130284e+00f, 9.114727547e-01f, -1.896130284e+00f, 9.124919173e-01f },
+        { 8.248224859e-01f, -1.542048637e+00f, 7.716237374e-01f, -1.542048637e+00f, 5.964462233e-01f },
+        { 8.711641938e-01f, -1.355502148e+00f, 6.940348661e-01f, -1.355502148e+00f, 5.651990599e-01f },
+        { 9.069573176e-01f, -7.257857772e-01f, 5.446142369e-01f, -7.257857772e-01f, 4.515715545e-01f },
+        { 1.067161453e+00f, 7.889708380e-01f, 5.107802231e-01f, 7.889708380e-01f, 5.779416759e-01f },
+    } },
+    { { /* 89 % */
+        { 1.000684780e+00f, -1.997713234e+00f, 9.970449022e-01f, -1.997713234e+00f, 9.977296817e-01f },
+        { 1.002023625e+00f, -1.995867752e+00f, 9.939098586e-01f, -1.995867752e+00f, 9.959334838e-01f },
+        { 1.004071341e+00f, -1.991551928e+00f, 9.877472154e-01f, -1.991551928e+00f, 9.918185566e-01f },
+        { 1.005613981e+00f, -1.980881943e+00f, 9.763291185e-01f, -1.980881943e+00f, 9.819430999e-01f },
+        { 1.010850769e+00f, -1.959820227e+00f, 9.531745864e-01f, -1.959820227e+00f, 9.640253556e-01f },
+        { 1.000509444e+00f, -1.895651452e+00f, 9.114995095e-01f, -1.895651452e+00f, 9.120089537e-01f },
+        { 8.225960375e-01f, -1.538454091e+00f, 7.701288379e-01f, -1.538454091e+00f, 5.927248754e-01f },
+        { 8.695644779e-01f, -1.353803035e+00f, 6.936726154e-01f, -1.353803035e+00f, 5.632370932e-01f },
+        { 9.020193263e-01f, -7.234885196e-01f, 5.449577128e-01f, -7.234885196e-01f, 4.469770391e-01f },
+        { 1.061383432e+00f, 7.870476064e-01f, 5.127117809e-01f, 7.870476064e-01f, 5.740952129e-01f },
+    } },
+    { { /* 90 % */
+        { 1.000667775e+00f, -1.997700142e+00f, 9.970488145e-01f, -1.997700142e+00f, 9.977165900e-01f },
+        { 1.002023625e+00f, -1.995867752e+00f, 9.939098586e-01f, -1.995867752e+00f, 9.959334838e-01f },
+        { 1.004071341e+00f, -1.991551928e+00f, 9.877472154e-01f, -1.991551928e+00f, 9.918185566e-01f },
+        { 1.005341268e+00f, -1.980674874e+00f, 9.763946523e-01f, -1.980674874e+00f, 9.817359203e-01f },
+        { 1.010580300e+00f, -1.959616736e+00f, 9.532411285e-01f, -1.959616736e+00f, 9.638214286e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 8.203613223e-01f, -1.534834932e+00f, 7.686167241e-01f, -1.534834932e+00f, 5.889780463e-01f },
+        { 8.679654048e-01f, -1.352098404e+00f, 6.933033502e-01f, -1.352098404e+00f, 5.612687551e-01f },
+        { 8.971033090e-01f, -7.211794098e-01f, 5.452555106e-01f, -7.211794098e-01f, 4.423588196e-01f },
+        { 1.055640062e+00f, 7.851116213e-01f, 5.145831806e-01f, 7.851116213e-01f, 5.702232426e-01f },
+    } },
+    { { /* 91 % */
+        { 1.000650794e+00f, -1.997686975e+00f, 9.970526291e-01f, -1.997686975e+00f, 9.977034229e-01f },
+        { 1.001988577e+00f, -1.995844325e+00f, 9.939214780e-01f, -1.995844325e+00f, 9.959100555e-01f },
+        { 1.004000781e+00f, -1.991504896e+00f, 9.877707379e-01f, -1.991504896e+00f, 9.917715189e-01f },
+        { 1.005205198e+00f, -1.980570459e+00f, 9.764262510e-01f, -1.980570459e+00f, 9.816314490e-01f },
+        { 1.010310231e+00f, -1.959412114e+00f, 9.533061355e-01f, -1.959412114e+00f, 9.636163670e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 8.192408471e-01f, -1.533016119e+00f, 7.678542255e-01f, -1.533016119e+00f, 5.870950726e-01f },
+        { 8.663669540e-01f, -1.350388257e+00f, 6.929270930e-01f, -1.350388257e+00f, 5.592940471e-01f },
+        { 8.946534409e-01f, -7.200204297e-01f, 5.453874186e-01f, -7.200204297e-01f, 4.400408595e-01f },
+        { 1.052781206e+00f, 7.841388467e-01f, 5.154964874e-01f, 7.841388467e-01f, 5.682776935e-01f },
+    } },
+    { { /* 92 % */
+        { 1.000633834e+00f, -1.997673732e+00f, 9.970563461e-01f, -1.997673732e+00f, 9.976901799e-01f },
+        { 1.001953596e+00f, -1.995820763e+00f, 9.939328962e-01f, -1.995820763e+00f, 9.958864926e-01f },
+        { 1.003930356e+00f, -1.991457596e+00f, 9.877938557e-01f, -1.991457596e+00f, 9.917242120e-01f },
+        { 1.005069313e+00f, -1.980465452e+00f, 9.764570724e-01f, -1.980465452e+00f, 9.815263857e-01f },
+        { 1.010040555e+00f, -1.959206353e+00f, 9.533696099e-01f, -1.959206353e+00f, 9.634101647e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 8.181182844e-01f, -1.531191149e+00f, 7.670874400e-01f, -1.531191149e+00f, 5.852057244e-01f },
+        { 8.647691052e-01f, -1.348672595e+00f, 6.925438659e-01f, -1.348672595e+00f, 5.573129711e-01f },
+        { 8.922089476e-01f, -7.188585102e-01f, 5.455080728e-01f, -7.188585102e-01f, 4.377170204e-01f },
+        { 1.049930816e+00f, 7.831628848e-01f, 5.163949536e-01f, 7.831628848e-01f, 5.663257696e-01f },
+    } },
+    { { /* 93 % */
+        { 1.000616895e+00f, -1.997660413e+00f, 9.970599655e-01f, -1.997660413e+00f, 9.976768606e-01f },
+        { 1.001918681e+00f, -1.995797065e+00f, 9.939441134e-01f, -1.995797065e+00f, 9.958627942e-01f },
+        { 1.003860065e+00f, -1.991410024e+00f, 9.878165695e-01f, -1.991410024e+00f, 9.916766341e-01f },
+        { 1.004933609e+00f, -1.980359850e+00f, 9.764871176e-01f, -1.980359850e+00f, 9.814207271e-01f },
+        { 1.009771262e+00f, -1.958999448e+00f, 9.534315541e-01f, -1.958999448e+00f, 9.632028157e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 8.169936276e-01f, -1.529360021e+00f, 7.663163732e-01f, -1.529360021e+00f, 5.833100009e-01f },
+        { 8.631718382e-01f, -1.346951420e+00f, 6.921536912e-01f, -1.346951420e+00f, 5.553255294e-01f },
+        { 8.897697903e-01f, -7.176936593e-01f, 5.456175283e-01f, -7.176936593e-01f, 4.353873186e-01f },
+        { 1.047088827e+00f, 7.821837360e-01f, 5.172786450e-01f, 7.821837360e-01f, 5.643674720e-01f },
+    } },
+    { { /* 94 % */
+        { 1.000599977e+00f, -1.997647017e+00f, 9.970634877e-01f, -1.997647017e+00f, 9.976634647e-01f },
+        { 1.001883829e+00f, -1.995773231e+00f, 9.939551302e-01f, -1.995773231e+00f, 9.958389595e-01f },
+        { 1.003789904e+00f, -1.991362180e+00f, 9.878388803e-01f, -1.991362180e+00f, 9.916287839e-01f },
+        { 1.004798082e+00f, -1.980253649e+00f, 9.765163878e-01f, -1.980253649e+00f, 9.813144699e-01f },
+        { 1.009502343e+00f, -1.958791392e+00f, 9.534919707e-01f, -1.958791392e+00f, 9.629943139e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 8.158668702e-01f, -1.527522734e+00f, 7.655410309e-01f, -1.527522734e+00f, 5.814079011e-01f },
+        { 8.615751332e-01f, -1.345224734e+00f, 6.917565911e-01f, -1.345224734e+00f, 5.533317243e-01f },
+        { 8.873359305e-01f, -7.165258852e-01f, 5.457158400e-01f, -7.165258852e-01f, 4.330517705e-01f },
+        { 1.044255175e+00f, 7.812014010e-01f, 5.181476270e-01f, 7.812014010e-01f, 5.624028020e-01f },
+    } },
+    { { /* 95 % */
+        { 1.000583079e+00f, -1.997633544e+00f, 9.970669126e-01f, -1.997633544e+00f, 9.976499916e-01f },
+        { 1.001849041e+00f, -1.995749260e+00f, 9.939659467e-01f, -1.995749260e+00f, 9.958149878e-01f },
+        { 1.003719871e+00f, -1.991314063e+00f, 9.878607887e-01f, -1.991314063e+00f, 9.915806598e-01f },
+        { 1.004662727e+00f, -1.980146847e+00f, 9.765448839e-01f, -1.980146847e+00f, 9.812076107e-01f },
+        { 1.009233791e+00f, -1.958582180e+00f, 9.535508619e-01f, -1.958582180e+00f, 9.627846530e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 8.147380059e-01f, -1.525679287e+00f, 7.647614188e-01f, -1.525679287e+00f, 5.794994247e-01f },
+        { 8.599789704e-01f, -1.343492539e+00f, 6.913525879e-01f, -1.343492539e+00f, 5.513315583e-01f },
+        { 8.849073303e-01f, -7.153551965e-01f, 5.458030627e-01f, -7.153551965e-01f, 4.307103930e-01f },
+        { 1.041429796e+00f, 7.802158806e-01f, 5.190019651e-01f, 7.802158806e-01f, 5.604317612e-01f },
+    } },
+    { { /* 96 % */
+        { 1.000566201e+00f, -1.997619994e+00f, 9.970702403e-01f, -1.997619994e+00f, 9.976364408e-01f },
+        { 1.001814315e+00f, -1.995725151e+00f, 9.939765635e-01f, -1.995725151e+00f, 9.957908783e-01f },
+        { 1.003649965e+00f, -1.991265670e+00f, 9.878822955e-01f, -1.991265670e+00f, 9.915322602e-01f },
+        { 1.004527539e+00f, -1.980039440e+00f, 9.765726071e-01f, -1.980039440e+00f, 9.811001463e-01f },
+        { 1.008965597e+00f, -1.958371806e+00f, 9.536082301e-01f, -1.958371806e+00f, 9.625738269e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 8.136070283e-01f, -1.523829681e+00f, 7.639775429e-01f, -1.523829681e+00f, 5.775845712e-01f },
+        { 8.583833305e-01f, -1.341754838e+00f, 6.909417038e-01f, -1.341754838e+00f, 5.493250343e-01f },
+        { 8.824839521e-01f, -7.141816016e-01f, 5.458792511e-01f, -7.141816016e-01f, 4.283632032e-01f },
+        { 1.038612627e+00f, 7.792271757e-01f, 5.198417241e-01f, 7.792271757e-01f, 5.584543513e-01f },
+    } },
+    { { /* 97 % */
+        { 1.000549341e+00f, -1.997606365e+00f, 9.970734711e-01f, -1.997606365e+00f, 9.976228121e-01f },
+        { 1.001779649e+00f, -1.995700904e+00f, 9.939869809e-01f, -1.995700904e+00f, 9.957666303e-01f },
+        { 1.003580182e+00f, -1.991216999e+00f, 9.879034014e-01f, -1.991216999e+00f, 9.914835836e-01f },
+        { 1.004392515e+00f, -1.979931425e+00f, 9.765995583e-01f, -1.979931425e+00f, 9.809920732e-01f },
+        { 1.008697752e+00f, -1.958160262e+00f, 9.536640777e-01f, -1.958160262e+00f, 9.623618293e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 8.124739315e-01f, -1.521973914e+00f, 7.631894090e-01f, -1.521973914e+00f, 5.756633406e-01f },
+        { 8.567881941e-01f, -1.340011634e+00f, 6.905239611e-01f, -1.340011634e+00f, 5.473121553e-01f },
+        { 8.800657586e-01f, -7.130051092e-01f, 5.459444598e-01f, -7.130051092e-01f, 4.260102184e-01f },
+        { 1.035803605e+00f, 7.782352872e-01f, 5.206669690e-01f, 7.782352872e-01f, 5.564705744e-01f },
+    } },
+    { { /* 98 % */
+        { 1.000532500e+00f, -1.997592658e+00f, 9.970766049e-01f, -1.997592658e+00f, 9.976091048e-01f },
+        { 1.001745044e+00f, -1.995676517e+00f, 9.939971991e-01f, -1.995676517e+00f, 9.957422428e-01f },
+        { 1.003510521e+00f, -1.991168051e+00f, 9.879241071e-01f, -1.991168051e+00f, 9.914346284e-01f },
+        { 1.004257650e+00f, -1.979822798e+00f, 9.766257385e-01f, -1.979822798e+00f, 9.808833881e-01f },
+        { 1.008430247e+00f, -1.957947543e+00f, 9.537184067e-01f, -1.957947543e+00f, 9.621486541e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 8.113387095e-01f, -1.520111988e+00f, 7.623970233e-01f, -1.520111988e+00f, 5.737357329e-01f },
+        { 8.551935425e-01f, -1.338262929e+00f, 6.900993820e-01f, -1.338262929e+00f, 5.452929245e-01f },
+        { 8.776527131e-01f, -7.118257282e-01f, 5.459987433e-01f, -7.118257282e-01f, 4.236514563e-01f },
+        { 1.033002669e+00f, 7.772402164e-01f, 5.214777641e-01f, 7.772402164e-01f, 5.544804327e-01f },
+    } },
+    { { /* 99 % */
+        { 1.000515677e+00f, -1.997578872e+00f, 9.970796420e-01f, -1.997578872e+00f, 9.975953186e-01f },
+        { 1.001710496e+00f, -1.995651991e+00f, 9.940072187e-01f, -1.995651991e+00f, 9.957177151e-01f },
+        { 1.003440980e+00f, -1.991118822e+00f, 9.879444134e-01f, -1.991118822e+00f, 9.913853929e-01f },
+        { 1.004122939e+00f, -1.979713556e+00f, 9.766511488e-01f, -1.979713556e+00f, 9.807740876e-01f },
+        { 1.008163075e+00f, -1.957733643e+00f, 9.537712195e-01f, -1.957733643e+00f, 9.619342949e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 8.102013565e-01f, -1.518243903e+00f, 7.616003918e-01f, -1.518243903e+00f, 5.718017483e-01f },
+        { 8.535993567e-01f, -1.336508726e+00f, 6.896679888e-01f, -1.336508726e+00f, 5.432673455e-01f },
+        { 8.752447790e-01f, -7.106434674e-01f, 5.460421558e-01f, -7.106434674e-01f, 4.212869349e-01f },
+        { 1.030209755e+00f, 7.762419643e-01f, 5.222741738e-01f, 7.762419643e-01f, 5.524839287e-01f },
+    } },
+    { { /* 100 % */
+        { 1.000498871e+00f, -1.997565007e+00f, 9.970825823e-01f, -1.997565007e+00f, 9.975814531e-01f },
+        { 1.001676007e+00f, -1.995627323e+00f, 9.940170398e-01f, -1.995627323e+00f, 9.956930464e-01f },
+        { 1.003371555e+00f, -1.991069311e+00f, 9.879643209e-01f, -1.991069311e+00f, 9.913358757e-01f },
+        { 1.003988378e+00f, -1.979603696e+00f, 9.766757900e-01f, -1.979603696e+00f, 9.806641683e-01f },
+        { 1.007896227e+00f, -1.957518555e+00f, 9.538225181e-01f, -1.957518555e+00f, 9.617187455e-01f },
+        { 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f },
+        { 8.090618668e-01f, -1.516369658e+00f, 7.607995207e-01f, -1.516369658e+00f, 5.698613875e-01f },
+        { 8.520056184e-01f, -1.334749029e+00f, 6.892298037e-01f, -1.334749029e+00f, 5.412354221e-01f },
+        { 8.728419204e-01f, -7.094583361e-01f, 5.460747518e-01f, -7.094583361e-01f, 4.189166722e-01f },
+        { 1.027424803e+00f, 7.752405325e-01f, 5.230562621e-01f, 7.752405325e-01f, 5.504810649e-01f },
+    } },
+};
+
+const loudness_rate_t loudness_rates[LOUDNESS_RATE_NUM] = {
+    { 11025, s_loudness_11025 },
+    { 22050, s_loudness_22050 },
+    { 44100, s_loudness_44100 },
+    { 48000, s_loudness_48000 },
+};
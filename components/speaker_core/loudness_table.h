@@ -0,0 +1,21 @@
+/* Generated by tools/gen_loudness_table.py from tools/loudness/curves.json, do not edit */
+#ifndef __LOUDNESS_TABLE_H__
+#define __LOUDNESS_TABLE_H__
+
+#define LOUDNESS_BANDS          (10)
+#define LOUDNESS_STEPS          (101)
+#define LOUDNESS_RATE_NUM       (4)
+
+/* One volume step: a biquad { b0, b1, b2, a1, a2 } per band */
+typedef struct {
+    float   coef[LOUDNESS_BANDS][5];
+} loudness_coefs_t;
+
+typedef struct {
+    int                     sample_rate;
+    const loudness_coefs_t  *steps;     /* LOUDNESS_STEPS sets, indexed by the volume in % */
+} loudness_rate_t;
+
+extern const loudness_rate_t loudness_rates[LOUDNESS_RATE_NUM];
+
+#endif
@@ -0,0 +1,1177 @@
+/* Generated by tools/gen_resampler_table.py, do not edit */
+#include "resampler_table.h"
+
+/* 22050 -> 44100 Hz, up 2 down 1, passband to 8527 Hz */
+static const int16_t s_phases_22050_44100[2][RESAMPLER_TAPS] = {
+    { -11, 21, -29, 28, -8, -42, 127, -249, 396, -544, 655, -675, 521, -34, -1371, 13373, 6005, -2849, 1720, -1024, 535, -195, -22, 136, -174, 162, -125, 81, -43, 18, -4, -1 },
+    { -1, -4, 18, -43, 81, -125, 162, -174, 136, -22, -195, 535, -1024, 1720, -2849, 6005, 13373, -1371, -34, 521, -675, 655, -544, 396, -249, 127, -42, -8, 28, -29, 21, -11 },
+};
+
+/* 32000 -> 44100 Hz, up 441 down 320, passband to 12375 Hz */
+static const int16_t s_phases_32000_44100[441][RESAMPLER_TAPS] = {
+    { -13, 29, -51, 72, -83, 69, -14, -97, 271, -507, 790, -1095, 1388, -1629, 1781, 14528, 1816, -1643, 1394, -1097, 790, -505, 269, -95, -15, 70, -84, 72, -51, 29, -13, 4 },
+    { -13, 29, -51, 72, -83, 68, -12, -99, 273, -509, 791, -1093, 1381, -1615, 1747, 14528, 1851, -1657, 1400, -1099, 789, -503, 267, -93, -17, 71, -84, 73, -51, 29, -13, 4 },
+    { -13, 29, -50, 72, -82, 67, -11, -101, 275, -510, 791, -1091, 1375, -1601, 1712, 14528, 1886, -1671, 1406, -1101, 789, -502, 265, -91, -19, 72, -85, 73, -51, 29, -13, 4 },
+    { -13, 29, -50, 71, -81, 66, -9, -103, 277, -512, 792, -1090, 1369, -1587, 1678, 14527, 1921, -1685, 1412, -1102, 788, -500, 263, -89, -20, 73, -86, 73, -51, 29, -13, 4 },
+    { -13, 29, -50, 71, -81, 65, -8, -104, 279, -513, 792, -1087, 1363, -1573, 1643, 14526, 1956, -1699, 1418, -1104, 787, -498, 261, -87, -22, 74, -86, 74, -51, 29, -13, 4 },
+    { -13, 29, -50, 71, -80, 64, -6, -106, 281, -515, 792, -1085, 1357, -1559, 1609, 14525, 1991, -1712, 1423, -1106, 787, -496, 259, -85, -23, 75, -87, 74, -51, 29, -13, 4 },
+    { -13, 29, -50, 70, -79, 63, -5, -108, 283, -517, 793, -1083, 1350, -1544, 1575, 14524, 2026, -1726, 1429, -1107, 786, -495, 256, -83, -25, 77, -87, 74, -51, 29, -13, 4 },
+    { -13, 29, -50, 70, -79, 62, -3, -110, 285, -518, 793, -1081, 1344, -1530, 1541, 14523, 2062, -1740, 1435, -1109, 785, -493, 254, -81, -26, 78, -88, 74, -51, 29, -12, 3 },
+    { -13, 29, -50, 70, -78, 61, -2, -112, 287, -520, 793, -1079, 1337, -1516, 1507, 14521, 2097, -1754, 1441, -1111, 784, -491, 252, -79, -28, 79, -89, 75, -51, 29, -12, 3 },
+    { -13, 29, -50, 70, -78, 60, 0, -114, 289, -521, 793, -1077, 1331, -1502, 1473, 14519, 2133, -1767, 1446, -1112, 784, -489, 250, -77, -29, 80, -89, 75, -51, 29, -12, 3 },
+    { -13, 29, -50, 69, -77, 59, 1, -116, 291, -522, 794, -1075, 1324, -1488, 1439, 14517, 2168, -1781, 1452, -1113, 783, -487, 248, -75, -31, 81, -90, 75, -51, 29, -12, 3 },
+    { -13, 29, -50, 69, -76, 58, 3, -118, 293, -524, 794, -1072, 1318, -1473, 1405, 14515, 2204, -1795, 1458, -1115, 782, -485, 245, -73, -32, 82, -90, 75, -51, 29, -12, 3 },
+    { -13, 29, -49, 69, -76, 57, 4, -119, 295, -525, 794, -1070, 1311, -1459, 1372, 14513, 2240, -1808, 1463, -1116, 781, -483, 243, -71, -34, 83, -91, 76, -52, 29, -12, 3 },
+    { -13, 29, -49, 68, -75, 55, 6, -121, 297, -527, 794, -1068, 1305, -1445, 1338, 14510, 2275, -1822, 1468, -1117, 780, -481, 241, -69, -35, 84, -92, 76, -52, 29, -12, 3 },
+    { -13, 29, -49, 68, -74, 54, 7, -123, 298, -528, 794, -1065, 1298, -1430, 1305, 14508, 2311, -1835, 1474, -1119, 779, -479, 239, -67, -37, 85, -92, 76, -52, 29, -12, 3 },
+    { -13, 29, -49, 68, -74, 53, 9, -125, 300, -529, 794, -1063, 1291, -1416, 1271, 14505, 2347, -1849, 1479, -1120, 778, -477, 237, -65, -39, 86, -93, 76, -52, 29, -12, 3 },
+    { -13, 29, -49, 67, -73, 52, 10, -127, 302, -531, 794, -1060, 1284, -1401, 1238, 14502, 2383, -1862, 1485, -1121, 777, -475, 234, -63, -40, 87, -93, 77, -52, 29, -12, 3 },
+    { -13, 29, -49, 67, -72, 51, 12, -129, 304, -532, 794, -1058, 1278, -1387, 1205, 14498, 2420, -1875, 1490, -1122, 776, -473, 232, -61, -42, 88, -94, 77, -52, 29, -12, 3 },
+    { -13, 29, -49, 67, -72, 50, 13, -130, 306, -533, 794, -1055, 1271, -1372, 1172, 14495, 2456, -1889, 1495, -1123, 775, -471, 230, -59, -43, 89, -94, 77, -52, 28, -12, 3 },
+    { -13, 29, -49, 66, -71, 49, 15, -132, 308, -535, 794, -1052, 1264, -1358, 1139, 14491, 2492, -1902, 1500, -1124, 774, -469, 227, -57, -45, 90, -95, 77, -52, 28, -12, 3 },
+    { -13, 29, -49, 66, -70, 48, 16, -134, 309, -536, 794, -1050, 1257, -1344, 1106, 14487, 2528, -1915, 1505, -1125, 773, -467, 225, -55, -46, 91, -96, 78, -52, 28, -12, 3 },
+    { -13, 29, -48, 66, -70, 47, 18, -136, 311, -537, 793, -1047, 1250, -1329, 1073, 14483, 2565, -1928, 1510, -1126, 771, -465, 223, -53, -48, 92, -96, 78, -52, 28, -12, 3 },
+    { -13, 29, -48, 65, -69, 46, 19, -137, 313, -538, 793, -1044, 1243, -1314, 1041, 14479, 2601, -1942, 1515, -1127, 770, -462, 220, -51, -49, 93, -97, 78, -52, 28, -12, 3 },
+    { -13, 29, -48, 65, -69, 45, 21, -139, 315, -539, 793, -1042, 1236, -1300, 1008, 14474, 2638, -1955, 1520, -1128, 769, -460, 218, -49, -51, 94, -97, 78, -52, 28, -12, 3 },
+    { -14, 29, -48, 65, -68, 44, 22, -141, 316, -540, 793, -1039, 1229, -1285, 976, 14470, 2675, -1968, 1525, -1129, 768, -458, 216, -47, -53, 95, -98, 79, -52, 28, -12, 3 },
+    { -14, 29, -48, 64, -67, 43, 24, -143, 318, -542, 792, -1036, 1222, -1271, 944, 14465, 2711, -1981, 1530, -1130, 766, -456, 213, -45, -54, 96, -98, 79, -52, 28, -12, 3 },
+    { -14, 29, -48, 64, -67, 42, 25, -144, 320, -543, 792, -1033, 1215, -1256, 911, 14460, 2748, -1994, 1535, -1130, 765, -454, 211, -43, -56, 97, -99, 79, -52, 28, -12, 3 },
+    { -14, 29, -48, 64, -66, 41, 27, -146, 321, -544, 792, -1030, 1208, -1242, 879, 14455, 2785, -2007, 1540, -1131, 764, -451, 208, -41, -57, 98, -99, 79, -52, 28, -12, 3 },
+    { -14, 29, -48, 63, -65, 39, 28, -148, 323, -545, 791, -1027, 1200, -1227, 847, 14449, 2822, -2019, 1544, -1132, 762, -449, 206, -39, -59, 99, -100, 79, -52, 28, -11, 3 },
+    { -14, 29, -47, 63, -65, 38, 29, -150, 325, -546, 791, -1024, 1193, -1212, 815, 14444, 2859, -2032, 1549, -1132, 761, -447, 204, -36, -60, 100, -100, 80, -52, 28, -11, 3 },
+    { -14, 29, -47, 63, -64, 37, 31, -151, 326, -547, 791, -1021, 1186, -1198, 783, 14438, 2896, -2045, 1554, -1133, 759, -444, 201, -34, -62, 101, -101, 80, -52, 28, -11, 3 },
+    { -14, 29, -47, 62, -63, 36, 32, -153, 328, -548, 790, -1018, 1178, -1183, 752, 14432, 2933, -2058, 1558, -1134, 758, -442, 199, -32, -63, 102, -102, 80, -52, 28, -11, 3 },
+    { -14, 29, -47, 62, -63, 35, 34, -155, 329, -549, 790, -1015, 1171, -1168, 720, 14426, 2970, -2070, 1563, -1134, 756, -440, 196, -30, -65, 103, -102, 80, -52, 28, -11, 3 },
+    { -14, 29, -47, 62, -62, 34, 35, -156, 331, -550, 789, -1012, 1164, -1154, 689, 14419, 3008, -2083, 1567, -1134, 755, -437, 194, -28, -66, 104, -103, 80, -52, 28, -11, 3 },
+    { -14, 29, -47, 61, -61, 33, 37, -158, 333, -550, 788, -1009, 1156, -1139, 657, 14413, 3045, -2096, 1571, -1135, 753, -435, 191, -26, -68, 105, -103, 81, -52, 28, -11, 3 },
+    { -14, 29, -47, 61, -60, 32, 38, -160, 334, -551, 788, -1005, 1149, -1124, 626, 14406, 3083, -2108, 1576, -1135, 751, -432, 189, -24, -70, 106, -104, 81, -52, 28, -11, 3 },
+    { -14, 29, -46, 60, -60, 31, 40, -161, 336, -552, 787, -1002, 1141, -1109, 595, 14399, 3120, -2121, 1580, -1135, 750, -430, 186, -22, -71, 107, -104, 81, -52, 28, -11, 3 },
+    { -14, 29, -46, 60, -59, 30, 41, -163, 337, -553, 787, -999, 1134, -1095, 564, 14392, 3158, -2133, 1584, -1136, 748, -427, 184, -20, -73, 108, -105, 81, -52, 28, -11, 3 },
+    { -14, 29, -46, 60, -58, 29, 42, -165, 339, -554, 786, -996, 1126, -1080, 533, 14384, 3195, -2145, 1588, -1136, 746, -425, 181, -17, -74, 109, -105, 81, -52, 27, -11, 2 },
+    { -14, 28, -46, 59, -58, 28, 44, -166, 340, -555, 785, -992, 1119, -1065, 502, 14377, 3233, -2158, 1592, -1136, 744, -422, 179, -15, -76, 110, -106, 82, -52, 27, -11, 2 },
+    { -14, 28, -46, 59, -57, 27, 45, -168, 342, -555, 784, -989, 1111, -1050, 471, 14369, 3271, -2170, 1597, -1136, 743, -420, 176, -13, -77, 111, -106, 82, -52, 27, -11, 2 },
+    { -14, 28, -46, 59, -56, 26, 47, -169, 343, -556, 784, -985, 1103, -1036, 441, 14361, 3308, -2182, 1600, -1136, 741, -417, 174, -11, -79, 112, -107, 82, -52, 27, -11, 2 },
+    { -14, 28, -45, 58, -56, 25, 48, -171, 344, -557, 783, -982, 1096, -1021, 410, 14353, 3346, -2194, 1604, -1136, 739, -415, 171, -9, -80, 113, -107, 82, -52, 27, -11, 2 },
+    { -14, 28, -45, 58, -55, 24, 49, -173, 346, -558, 782, -979, 1088, -1006, 380, 14345, 3384, -2206, 1608, -1136, 737, -412, 169, -7, -82, 114, -108, 82, -52, 27, -11, 2 },
+    { -14, 28, -45, 57, -54, 23, 51, -174, 347, -558, 781, -975, 1080, -991, 349, 14336, 3422, -2218, 1612, -1136, 735, -409, 166, -5, -83, 115, -108, 82, -52, 27, -10, 2 },
+    { -14, 28, -45, 57, -54, 21, 52, -176, 349, -559, 780, -971, 1073, -976, 319, 14327, 3460, -2230, 1616, -1136, 733, -407, 163, -3, -85, 116, -109, 83, -52, 27, -10, 2 },
+    { -14, 28, -45, 57, -53, 20, 54, -177, 350, -559, 779, -968, 1065, -962, 289, 14319, 3498, -2242, 1620, -1136, 731, -404, 161, 0, -87, 116, -109, 83, -52, 27, -10, 2 },
+    { -14, 28, -45, 56, -52, 19, 55, -179, 351, -560, 778, -964, 1057, -947, 259, 14309, 3536, -2254, 1623, -1136, 729, -401, 158, 2, -88, 117, -109, 83, -52, 27, -10, 2 },
+    { -14, 28, -45, 56, -52, 18, 56, -180, 353, -561, 777, -961, 1049, -932, 230, 14300, 3574, -2266, 1627, -1135, 727, -399, 155, 4, -90, 118, -110, 83, -52, 27, -10, 2 },
+    { -14, 28, -44, 56, -51, 17, 58, -182, 354, -561, 776, -957, 1041, -917, 200, 14291, 3613, -2277, 1630, -1135, 725, -396, 153, 6, -91, 119, -110, 83, -52, 27, -10, 2 },
+    { -14, 28, -44, 55, -50, 16, 59, -183, 355, -562, 775, -953, 1033, -902, 170, 14281, 3651, -2289, 1634, -1135, 723, -393, 150, 8, -93, 120, -111, 83, -52, 27, -10, 2 },
+    { -14, 28, -44, 55, -49, 15, 61, -185, 357, -562, 774, -949, 1025, -888, 141, 14271, 3689, -2301, 1637, -1134, 720, -390, 148, 10, -94, 121, -111, 84, -52, 27, -10, 2 },
+    { -14, 28, -44, 54, -49, 14, 62, -186, 358, -563, 773, -946, 1017, -873, 111, 14261, 3728, -2312, 1640, -1134, 718, -388, 145, 13, -96, 122, -112, 84, -52, 26, -10, 2 },
+    { -14, 28, -44, 54, -48, 13, 63, -188, 359, -563, 772, -942, 1009, -858, 82, 14251, 3766, -2324, 1644, -1133, 716, -385, 142, 15, -97, 123, -112, 84, -52, 26, -10, 2 },
+    { -14, 28, -43, 54, -47, 12, 65, -189, 360, -564, 771, -938, 1001, -843, 53, 14241, 3805, -2335, 1647, -1133, 714, -382, 139, 17, -99, 124, -113, 84, -52, 26, -10, 2 },
+    { -14, 28, -43, 53, -47, 11, 66, -191, 362, -564, 769, -934, 993, -828, 24, 14230, 3843, -2346, 1650, -1132, 711, -379, 137, 19, -100, 125, -113, 84, -52, 26, -10, 2 },
+    { -14, 28, -43, 53, -46, 10, 67, -192, 363, -564, 768, -930, 985, -813, -5, 14219, 3882, -2358, 1653, -1132, 709, -376, 134, 21, -102, 126, -114, 84, -52, 26, -10, 2 },
+    { -14, 28, -43, 52, -45, 9, 69, -194, 364, -565, 767, -926, 977, -799, -34, 14208, 3920, -2369, 1656, -1131, 707, -373, 131, 23, -103, 127, -114, 84, -52, 26, -10, 2 },
+    { -14, 28, -43, 52, -45, 8, 70, -195, 365, -565, 766, -922, 969, -784, -62, 14197, 3959, -2380, 1659, -1130, 704, -370, 129, 26, -105, 128, -114, 84, -52, 26, -9, 2 },
+    { -14, 28, -43, 52, -44, 7, 71, -197, 366, -565, 764, -918, 961, -769, -91, 14186, 3998, -2391, 1662, -1129, 702, -368, 126, 28, -106, 129, -115, 85, -52, 26, -9, 2 },
+    { -14, 28, -42, 51, -43, 6, 73, -198, 368, -566, 763, -914, 953, -754, -119, 14174, 4037, -2402, 1665, -1129, 699, -365, 123, 30, -108, 129, -115, 85, -52, 26, -9, 2 },
+    { -14, 27, -42, 51, -43, 5, 74, -200, 369, -566, 761, -910, 944, -739, -147, 14163, 4075, -2413, 1668, -1128, 697, -362, 120, 32, -109, 130, -116, 85, -52, 26, -9, 2 },
+    { -14, 27, -42, 50, -42, 4, 75, -201, 370, -566, 760, -906, 936, -725, -176, 14151, 4114, -2424, 1670, -1127, 694, -359, 118, 34, -111, 131, -116, 85, -52, 26, -9, 1 },
+    { -14, 27, -42, 50, -41, 3, 77, -202, 371, -566, 759, -902, 928, -710, -204, 14139, 4153, -2435, 1673, -1126, 692, -356, 115, 37, -112, 132, -117, 85, -52, 26, -9, 1 },
+    { -14, 27, -42, 50, -40, 2, 78, -204, 372, -567, 757, -898, 920, -695, -232, 14127, 4192, -2445, 1676, -1125, 689, -353, 112, 39, -114, 133, -117, 85, -52, 25, -9, 1 },
+    { -14, 27, -41, 49, -40, 1, 79, -205, 373, -567, 756, -893, 911, -680, -259, 14114, 4231, -2456, 1678, -1124, 687, -350, 109, 41, -115, 134, -117, 85, -52, 25, -9, 1 },
+    { -14, 27, -41, 49, -39, -1, 81, -206, 374, -567, 754, -889, 903, -665, -287, 14101, 4270, -2467, 1681, -1123, 684, -347, 107, 43, -117, 135, -118, 85, -52, 25, -9, 1 },
+    { -14, 27, -41, 48, -38, -2, 82, -208, 375, -567, 753, -885, 895, -651, -315, 14089, 4309, -2477, 1683, -1122, 681, -343, 104, 45, -118, 136, -118, 85, -52, 25, -9, 1 },
+    { -14, 27, -41, 48, -38, -3, 83, -209, 376, -567, 751, -881, 886, -636, -342, 14076, 4348, -2488, 1685, -1120, 679, -340, 101, 48, -120, 136, -119, 85, -52, 25, -9, 1 },
+    { -14, 27, -41, 48, -37, -4, 84, -210, 377, -567, 749, -876, 878, -621, -369, 14062, 4388, -2498, 1688, -1119, 676, -337, 98, 50, -121, 137, -119, 86, -51, 25, -9, 1 },
+    { -14, 27, -41, 47, -36, -5, 86, -212, 378, -567, 748, -872, 870, -606, -396, 14049, 4427, -2508, 1690, -1118, 673, -334, 95, 52, -123, 138, -119, 86, -51, 25, -8, 1 },
+    { -14, 27, -40, 47, -35, -6, 87, -213, 379, -567, 746, -868, 861, -592, -424, 14036, 4466, -2518, 1692, -1117, 670, -331, 92, 54, -124, 139, -120, 86, -51, 25, -8, 1 },
+    { -14, 27, -40, 46, -35, -7, 88, -214, 380, -567, 744, -863, 853, -577, -450, 14022, 4505, -2529, 1694, -1115, 667, -328, 90, 56, -126, 140, -120, 86, -51, 25, -8, 1 },
+    { -14, 27, -40, 46, -34, -8, 89, -216, 381, -567, 743, -859, 844, -562, -477, 14008, 4545, -2539, 1696, -1114, 665, -325, 87, 59, -127, 141, -120, 86, -51, 25, -8, 1 },
+    { -14, 27, -40, 46, -33, -9, 91, -217, 382, -567, 741, -854, 836, -548, -504, 13994, 4584, -2549, 1698, -1112, 662, -321, 84, 61, -129, 142, -121, 86, -51, 24, -8, 1 },
+    { -14, 27, -40, 45, -33, -10, 92, -218, 383, -567, 739, -850, 827, -533, -530, 13980, 4623, -2559, 1700, -1111, 659, -318, 81, 63, -130, 142, -121, 86, -51, 24, -8, 1 },
+    { -14, 27, -39, 45, -32, -11, 93, -219, 384, -567, 737, -845, 819, -518, -557, 13965, 4663, -2568, 1702, -1109, 656, -315, 78, 65, -132, 143, -121, 86, -51, 24, -8, 1 },
+    { -14, 26, -39, 44, -31, -12, 94, -221, 384, -567, 735, -841, 810, -504, -583, 13950, 4702, -2578, 1704, -1108, 653, -312, 75, 67, -133, 144, -122, 86, -51, 24, -8, 1 },
+    { -14, 26, -39, 44, -31, -13, 96, -222, 385, -567, 734, -836, 802, -489, -609, 13936, 4742, -2588, 1705, -1106, 650, -308, 72, 70, -135, 145, -122, 86, -51, 24, -8, 1 },
+    { -14, 26, -39, 43, -30, -14, 97, -223, 386, -567, 732, -832, 793, -474, -635, 13921, 4781, -2597, 1707, -1104, 647, -305, 70, 72, -136, 146, -123, 86, -51, 24, -8, 1 },
+    { -14, 26, -38, 43, -29, -15, 98, -224, 387, -567, 730, -827, 785, -460, -661, 13905, 4821, -2607, 1709, -1102, 644, -302, 67, 74, -138, 147, -123, 86, -51, 24, -8, 1 },
+    { -14, 26, -38, 43, -28, -16, 99, -226, 388, -566, 728, -822, 776, -445, -687, 13890, 4860, -2616, 1710, -1101, 641, -299, 64, 76, -139, 147, -123, 86, -51, 24, -8, 1 },
+    { -14, 26, -38, 42, -28, -17, 101, -227, 389, -566, 726, -818, 767, -430, -713, 13875, 4900, -2626, 1712, -1099, 637, -295, 61, 78, -141, 148, -124, 86, -50, 23, -7, 1 },
+    { -14, 26, -38, 42, -27, -18, 102, -228, 389, -566, 724, -813, 759, -416, -738, 13859, 4939, -2635, 1713, -1097, 634, -292, 58, 81, -142, 149, -124, 86, -50, 23, -7, 0 },
+    { -14, 26, -38, 41, -26, -19, 103, -229, 390, -566, 722, -808, 750, -401, -764, 13843, 4979, -2644, 1714, -1095, 631, -289, 55, 83, -144, 150, -124, 86, -50, 23, -7, 0 },
+    { -14, 26, -37, 41, -26, -20, 104, -230, 391, -565, 720, -804, 741, -387, -789, 13827, 5019, -2653, 1716, -1093, 628, -285, 52, 85, -145, 150, -124, 86, -50, 23, -7, 0 },
+    { -14, 26, -37, 40, -25, -21, 105, -231, 392, -565, 718, -799, 733, -372, -814, 13811, 5058, -2663, 1717, -1091, 625, -282, 49, 87, -146, 151, -125, 86, -50, 23, -7, 0 },
+    { -14, 26, -37, 40, -24, -22, 107, -233, 392, -565, 716, -794, 724, -358, -839, 13794, 5098, -2671, 1718, -1089, 621, -278, 46, 89, -148, 152, -125, 86, -50, 23, -7, 0 },
+    { -14, 26, -37, 40, -23, -23, 108, -234, 393, -564, 714, -789, 715, -343, -864, 13778, 5138, -2680, 1719, -1087, 618, -275, 43, 92, -149, 153, -125, 86, -50, 23, -7, 0 },
+    { -14, 25, -37, 39, -23, -24, 109, -235, 394, -564, 711, -784, 707, -329, -889, 13761, 5177, -2689, 1720, -1085, 615, -272, 40, 94, -151, 154, -126, 87, -50, 23, -7, 0 },
+    { -14, 25, -36, 39, -22, -25, 110, -236, 394, -564, 709, -780, 698, -314, -913, 13744, 5217, -2698, 1721, -1082, 611, -268, 37, 96, -152, 154, -126, 87, -50, 22, -7, 0 },
+    { -13, 25, -36, 38, -21, -26, 111, -237, 395, -563, 707, -775, 689, -300, -938, 13727, 5257, -2706, 1722, -1080, 608, -265, 34, 98, -154, 155, -126, 87, -50, 22, -7, 0 },
+    { -13, 25, -36, 38, -21, -27, 112, -238, 395, -563, 705, -770, 680, -285, -962, 13709, 5297, -2715, 1722, -1078, 604, -261, 31, 100, -155, 156, -127, 87, -49, 22, -6, 0 },
+    { -13, 25, -36, 37, -20, -28, 114, -239, 396, -562, 703, -765, 672, -271, -986, 13692, 5337, -2723, 1723, -1075, 601, -258, 28, 103, -156, 157, -127, 87, -49, 22, -6, 0 },
+    { -13, 25, -35, 37, -19, -29, 115, -240, 397, -562, 700, -760, 663, -257, -1010, 13674, 5376, -2732, 1724, -1073, 597, -254, 25, 105, -158, 157, -127, 87, -49, 22, -6, 0 },
+    { -13, 25, -35, 37, -19, -30, 116, -241, 397, -561, 698, -755, 654, -242, -1034, 13656, 5416, -2740, 1724, -1070, 594, -251, 23, 107, -159, 158, -127, 87, -49, 22, -6, 0 },
+    { -13, 25, -35, 36, -18, -31, 117, -242, 398, -561, 696, -750, 645, -228, -1058, 13638, 5456, -2748, 1725, -1068, 590, -247, 20, 109, -161, 159, -128, 87, -49, 22, -6, 0 },
+    { -13, 25, -35, 36, -17, -31, 118, -243, 398, -560, 693, -745, 636, -214, -1082, 13620, 5496, -2756, 1725, -1065, 587, -243, 17, 111, -162, 160, -128, 86, -49, 22, -6, 0 },
+    { -13, 25, -35, 35, -16, -32, 119, -244, 399, -560, 691, -740, 627, -199, -1105, 13602, 5536, -2764, 1726, -1063, 583, -240, 14, 114, -163, 160, -128, 86, -49, 21, -6, 0 },
+    { -13, 25, -34, 35, -16, -33, 120, -245, 399, -559, 689, -735, 619, -185, -1129, 13583, 5576, -2772, 1726, -1060, 580, -236, 11, 116, -165, 161, -128, 86, -49, 21, -6, 0 },
+    { -13, 25, -34, 34, -15, -34, 121, -246, 400, -559, 686, -730, 610, -171, -1152, 13565, 5616, -2780, 1726, -1057, 576, -233, 8, 118, -166, 162, -129, 86, -48, 21, -6, 0 },
+    { -13, 24, -34, 34, -14, -35, 122, -247, 400, -558, 684, -724, 601, -157, -1175, 13546, 5656, -2788, 1726, -1055, 572, -229, 5, 120, -167, 162, -129, 86, -48, 21, -6, 0 },
+    { -13, 24, -34, 34, -14, -36, 124, -248, 401, -557, 681, -719, 592, -143, -1198, 13527, 5696, -2796, 1726, -1052, 568, -225, 2, 122, -169, 163, -129, 86, -48, 21, -5, 0 },
+    { -13, 24, -33, 33, -13, -37, 125, -249, 401, -557, 679, -714, 583, -128, -1221, 13508, 5736, -2803, 1726, -1049, 565, -222, -2, 125, -170, 164, -129, 86, -48, 21, -5, -1 },
+    { -13, 24, -33, 33, -12, -38, 126, -250, 401, -556, 676, -709, 574, -114, -1244, 13488, 5776, -2811, 1726, -1046, 561, -218, -5, 127, -172, 165, -130, 86, -48, 21, -5, -1 },
+    { -13, 24, -33, 32, -12, -39, 127, -251, 402, -555, 674, -704, 565, -100, -1266, 13469, 5816, -2818, 1726, -1043, 557, -214, -8, 129, -173, 165, -130, 86, -48, 20, -5, -1 },
+    { -13, 24, -33, 32, -11, -40, 128, -252, 402, -554, 671, -698, 556, -86, -1289, 13449, 5856, -2825, 1726, -1040, 553, -211, -11, 131, -174, 166, -130, 86, -48, 20, -5, -1 },
+    { -13, 24, -33, 31, -10, -41, 129, -253, 403, -554, 668, -693, 548, -72, -1311, 13429, 5896, -2832, 1726, -1037, 549, -207, -14, 133, -176, 167, -130, 86, -47, 20, -5, -1 },
+    { -13, 24, -32, 31, -9, -42, 130, -254, 403, -553, 666, -688, 539, -58, -1333, 13409, 5936, -2840, 1725, -1034, 546, -203, -17, 135, -177, 167, -130, 86, -47, 20, -5, -1 },
+    { -13, 24, -32, 30, -9, -43, 131, -255, 403, -552, 663, -683, 530, -44, -1356, 13389, 5976, -2847, 1725, -1031, 542, -200, -20, 138, -178, 168, -131, 86, -47, 20, -5, -1 },
+    { -13, 24, -32, 30, -8, -44, 132, -256, 404, -551, 661, -677, 521, -30, -1377, 13368, 6016, -2853, 1724, -1028, 538, -196, -23, 140, -180, 169, -131, 86, -47, 20, -5, -1 },
+    { -13, 23, -32, 30, -7, -45, 133, -257, 404, -550, 658, -672, 512, -16, -1399, 13348, 6056, -2860, 1724, -1025, 534, -192, -26, 142, -181, 169, -131, 86, -47, 19, -5, -1 },
+    { -13, 23, -31, 29, -7, -46, 134, -257, 404, -550, 655, -667, 503, -2, -1421, 13327, 6096, -2867, 1723, -1021, 530, -188, -29, 144, -182, 170, -131, 86, -47, 19, -4, -1 },
+    { -13, 23, -31, 29, -6, -46, 135, -258, 404, -549, 652, -661, 494, 12, -1442, 13306, 6136, -2874, 1723, -1018, 526, -185, -32, 146, -184, 170, -131, 86, -46, 19, -4, -1 },
+    { -13, 23, -31, 28, -5, -47, 136, -259, 405, -548, 650, -656, 485, 25, -1464, 13285, 6176, -2880, 1722, -1015, 522, -181, -35, 148, -185, 171, -132, 86, -46, 19, -4, -1 },
+    { -13, 23, -31, 28, -5, -48, 137, -260, 405, -547, 647, -650, 476, 39, -1485, 13264, 6216, -2887, 1721, -1011, 518, -177, -38, 151, -186, 172, -132, 86, -46, 19, -4, -1 },
+    { -13, 23, -30, 27, -4, -49, 138, -261, 405, -546, 644, -645, 467, 53, -1506, 13243, 6256, -2893, 1720, -1008, 513, -173, -41, 153, -187, 172, -132, 86, -46, 19, -4, -1 },
+    { -13, 23, -30, 27, -3, -50, 139, -262, 405, -545, 641, -640, 458, 67, -1527, 13221, 6296, -2899, 1719, -1004, 509, -169, -44, 155, -189, 173, -132, 85, -46, 18, -4, -1 },
+    { -13, 23, -30, 26, -3, -51, 140, -262, 405, -544, 638, -634, 449, 80, -1548, 13199, 6336, -2905, 1718, -1001, 505, -165, -47, 157, -190, 174, -132, 85, -46, 18, -4, -1 },
+    { -13, 23, -30, 26, -2, -52, 141, -263, 406, -543, 636, -629, 440, 94, -1569, 13178, 6376, -2911, 1717, -997, 501, -162, -50, 159, -191, 174, -132, 85, -45, 18, -4, -1 },
+    { -13, 23, -29, 26, -1, -53, 142, -264, 406, -542, 633, -623, 431, 108, -1589, 13155, 6416, -2917, 1716, -994, 497, -158, -53, 161, -193, 175, -133, 85, -45, 18, -4, -1 },
+    { -13, 22, -29, 25, -1, -54, 143, -265, 406, -541, 630, -618, 422, 121, -1610, 13133, 6456, -2923, 1715, -990, 492, -154, -56, 163, -194, 175, -133, 85, -45, 18, -3, -2 },
+    { -13, 22, -29, 25, 0, -55, 144, -265, 406, -540, 627, -612, 413, 135, -1630, 13111, 6496, -2929, 1713, -986, 488, -150, -59, 165, -195, 176, -133, 85, -45, 18, -3, -2 },
+    { -13, 22, -29, 24, 1, -55, 145, -266, 406, -539, 624, -607, 404, 148, -1650, 13088, 6536, -2934, 1712, -983, 484, -146, -63, 168, -196, 177, -133, 85, -45, 17, -3, -2 },
+    { -13, 22, -28, 24, 1, -56, 146, -267, 406, -538, 621, -601, 395, 162, -1670, 13066, 6576, -2940, 1710, -979, 480, -142, -66, 170, -198, 177, -133, 85, -44, 17, -3, -2 },
+    { -13, 22, -28, 23, 2, -57, 147, -268, 406, -536, 618, -595, 386, 175, -1690, 13043, 6616, -2945, 1709, -975, 475, -138, -69, 172, -199, 178, -133, 85, -44, 17, -3, -2 },
+    { -13, 22, -28, 23, 3, -58, 148, -268, 406, -535, 615, -590, 377, 189, -1709, 13020, 6656, -2951, 1707, -971, 471, -134, -72, 174, -200, 178, -133, 85, -44, 17, -3, -2 },
+    { -12, 22, -28, 22, 3, -59, 148, -269, 406, -534, 612, -584, 368, 202, -1729, 12997, 6696, -2956, 1706, -967, 467, -130, -75, 176, -201, 179, -133, 84, -44, 17, -3, -2 },
+    { -12, 22, -27, 22, 4, -60, 149, -270, 406, -533, 609, -579, 359, 216, -1748, 12973, 6735, -2961, 1704, -963, 462, -126, -78, 178, -203, 179, -133, 84, -44, 17, -3, -2 },
+    { -12, 22, -27, 22, 5, -61, 150, -270, 406, -532, 606, -573, 350, 229, -1768, 12950, 6775, -2966, 1702, -959, 458, -122, -81, 180, -204, 180, -134, 84, -44, 16, -2, -2 },
+    { -12, 21, -27, 21, 6, -61, 151, -271, 406, -530, 603, -567, 341, 242, -1787, 12926, 6815, -2971, 1700, -955, 453, -118, -84, 182, -205, 180, -134, 84, -43, 16, -2, -2 },
+    { -12, 21, -27, 21, 6, -62, 152, -272, 406, -529, 600, -562, 332, 255, -1806, 12903, 6855, -2975, 1698, -951, 449, -114, -87, 184, -206, 181, -134, 84, -43, 16, -2, -2 },
+    { -12, 21, -26, 20, 7, -63, 153, -272, 406, -528, 596, -556, 323, 269, -1825, 12879, 6895, -2980, 1696, -947, 444, -110, -90, 187, -207, 181, -134, 84, -43, 16, -2, -2 },
+    { -12, 21, -26, 20, 8, -64, 154, -273, 406, -527, 593, -550, 314, 282, -1843, 12855, 6935, -2985, 1694, -943, 440, -106, -93, 189, -209, 182, -134, 84, -43, 16, -2, -2 },
+    { -12, 21, -26, 19, 8, -65, 155, -273, 406, -525, 590, -545, 306, 295, -1862, 12830, 6975, -2989, 1692, -938, 435, -102, -96, 191, -210, 182, -134, 83, -42, 16, -2, -2 },
+    { -12, 21, -26, 19, 9, -66, 155, -274, 406, -524, 587, -539, 297, 308, -1880, 12806, 7015, -2994, 1689, -934, 430, -98, -100, 193, -211, 183, -134, 83, -42, 15, -2, -2 },
+    { -12, 21, -25, 18, 9, -66, 156, -275, 406, -523, 584, -533, 288, 321, -1899, 12781, 7054, -2998, 1687, -930, 426, -94, -103, 195, -212, 183, -134, 83, -42, 15, -2, -2 },
+    { -12, 21, -25, 18, 10, -67, 157, -275, 406, -521, 580, -527, 279, 334, -1917, 12757, 7094, -3002, 1685, -925, 421, -90, -106, 197, -213, 184, -134, 83, -42, 15, -2, -2 },
+    { -12, 20, -25, 18, 11, -68, 158, -276, 406, -520, 577, -522, 270, 347, -1935, 12732, 7134, -3006, 1682, -921, 417, -86, -109, 199, -214, 184, -134, 83, -42, 15, -1, -3 },
+    { -12, 20, -25, 17, 11, -69, 159, -276, 405, -518, 574, -516, 261, 360, -1953, 12707, 7174, -3010, 1680, -916, 412, -82, -112, 201, -216, 185, -134, 83, -41, 15, -1, -3 },
+    { -12, 20, -24, 17, 12, -70, 160, -277, 405, -517, 571, -510, 252, 373, -1970, 12682, 7213, -3014, 1677, -912, 407, -78, -115, 203, -217, 185, -134, 83, -41, 14, -1, -3 },
+    { -12, 20, -24, 16, 13, -71, 160, -277, 405, -516, 567, -504, 243, 386, -1988, 12656, 7253, -3017, 1674, -907, 402, -74, -118, 205, -218, 186, -134, 82, -41, 14, -1, -3 },
+    { -12, 20, -24, 16, 13, -71, 161, -278, 405, -514, 564, -498, 234, 398, -2006, 12631, 7293, -3021, 1672, -903, 398, -70, -121, 207, -219, 186, -134, 82, -41, 14, -1, -3 },
+    { -12, 20, -24, 15, 14, -72, 162, -278, 405, -513, 561, -493, 225, 411, -2023, 12605, 7332, -3024, 1669, -898, 393, -66, -124, 209, -220, 187, -134, 82, -40, 14, -1, -3 },
+    { -12, 20, -23, 15, 15, -73, 163, -279, 404, -511, 557, -487, 216, 424, -2040, 12580, 7372, -3028, 1666, -893, 388, -62, -127, 211, -221, 187, -134, 82, -40, 14, -1, -3 },
+    { -12, 20, -23, 14, 15, -74, 164, -279, 404, -510, 554, -481, 207, 436, -2057, 12554, 7412, -3031, 1663, -889, 383, -58, -130, 213, -222, 188, -134, 82, -40, 13, -1, -3 },
+    { -12, 20, -23, 14, 16, -75, 164, -280, 404, -508, 551, -475, 198, 449, -2074, 12528, 7451, -3034, 1660, -884, 378, -54, -133, 215, -223, 188, -134, 81, -40, 13, 0, -3 },
+    { -12, 19, -23, 14, 17, -75, 165, -280, 404, -506, 547, -469, 189, 462, -2091, 12501, 7491, -3037, 1657, -879, 374, -49, -137, 217, -225, 188, -134, 81, -40, 13, 0, -3 },
+    { -12, 19, -22, 13, 17, -76, 166, -280, 403, -505, 544, -463, 180, 474, -2107, 12475, 7530, -3040, 1654, -874, 369, -45, -140, 219, -226, 189, -134, 81, -39, 13, 0, -3 },
+    { -12, 19, -22, 13, 18, -77, 167, -281, 403, -503, 540, -457, 171, 487, -2124, 12449, 7570, -3043, 1650, -869, 364, -41, -143, 221, -227, 189, -134, 81, -39, 13, 0, -3 },
+    { -12, 19, -22, 12, 19, -78, 167, -281, 403, -502, 537, -451, 163, 499, -2140, 12422, 7609, -3046, 1647, -864, 359, -37, -146, 223, -228, 190, -134, 81, -39, 12, 0, -3 },
+    { -11, 19, -22, 12, 19, -78, 168, -282, 402, -500, 533, -446, 154, 511, -2156, 12395, 7648, -3048, 1643, -859, 354, -33, -149, 225, -229, 190, -134, 80, -39, 12, 0, -3 },
+    { -11, 19, -21, 11, 20, -79, 169, -282, 402, -498, 530, -440, 145, 524, -2172, 12368, 7688, -3051, 1640, -854, 349, -29, -152, 227, -230, 190, -134, 80, -38, 12, 0, -3 },
+    { -11, 19, -21, 11, 20, -80, 169, -282, 401, -497, 526, -434, 136, 536, -2188, 12341, 7727, -3053, 1636, -849, 344, -24, -155, 229, -231, 191, -134, 80, -38, 12, 0, -3 },
+    { -11, 19, -21, 10, 21, -81, 170, -283, 401, -495, 523, -428, 127, 548, -2204, 12314, 7767, -3055, 1633, -844, 339, -20, -158, 231, -232, 191, -134, 80, -38, 12, 1, -4 },
+    { -11, 18, -21, 10, 22, -81, 171, -283, 401, -493, 519, -422, 118, 560, -2219, 12287, 7806, -3057, 1629, -839, 334, -16, -161, 233, -233, 191, -134, 80, -38, 11, 1, -4 },
+    { -11, 18, -20, 10, 22, -82, 172, -283, 400, -492, 516, -416, 109, 573, -2235, 12259, 7845, -3059, 1625, -834, 329, -12, -164, 235, -234, 192, -134, 79, -37, 11, 1, -4 },
+    { -11, 18, -20, 9, 23, -83, 172, -284, 400, -490, 512, -410, 101, 585, -2250, 12232, 7884, -3061, 1621, -828, 324, -8, -167, 237, -235, 192, -134, 79, -37, 11, 1, -4 },
+    { -11, 18, -20, 9, 24, -84, 173, -284, 399, -488, 508, -404, 92, 597, -2265, 12204, 7923, -3063, 1617, -823, 319, -4, -170, 239, -236, 193, -134, 79, -37, 11, 1, -4 },
+    { -11, 18, -19, 8, 24, -84, 174, -284, 399, -486, 505, -398, 83, 609, -2280, 12176, 7962, -3065, 1613, -818, 314, 1, -173, 241, -237, 193, -134, 79, -37, 11, 1, -4 },
+    { -11, 18, -19, 8, 25, -85, 174, -285, 398, -485, 501, -392, 74, 621, -2295, 12148, 8002, -3066, 1609, -812, 308, 5, -176, 243, -238, 193, -134, 78, -36, 10, 1, -4 },
+    { -11, 18, -19, 7, 25, -86, 175, -285, 398, -483, 498, -386, 65, 633, -2310, 12120, 8041, -3067, 1605, -807, 303, 9, -179, 245, -239, 193, -134, 78, -36, 10, 2, -4 },
+    { -11, 18, -19, 7, 26, -87, 175, -285, 397, -481, 494, -380, 57, 644, -2324, 12091, 8080, -3069, 1601, -801, 298, 13, -182, 247, -240, 194, -134, 78, -36, 10, 2, -4 },
+    { -11, 17, -18, 7, 27, -87, 176, -285, 397, -479, 490, -374, 48, 656, -2339, 12063, 8119, -3070, 1597, -796, 293, 18, -186, 248, -241, 194, -134, 78, -35, 10, 2, -4 },
+    { -11, 17, -18, 6, 27, -88, 177, -286, 396, -477, 487, -368, 39, 668, -2353, 12034, 8157, -3071, 1592, -790, 288, 22, -189, 250, -242, 194, -134, 77, -35, 10, 2, -4 },
+    { -11, 17, -18, 6, 28, -89, 177, -286, 396, -475, 483, -362, 30, 680, -2367, 12006, 8196, -3072, 1588, -785, 283, 26, -192, 252, -243, 195, -133, 77, -35, 9, 2, -4 },
+    { -11, 17, -18, 5, 28, -89, 178, -286, 395, -473, 479, -356, 22, 691, -2381, 11977, 8235, -3073, 1583, -779, 277, 30, -195, 254, -244, 195, -133, 77, -35, 9, 2, -4 },
+    { -11, 17, -17, 5, 29, -90, 179, -286, 394, -472, 475, -350, 13, 703, -2395, 11948, 8274, -3073, 1579, -774, 272, 35, -198, 256, -245, 195, -133, 77, -34, 9, 2, -4 },
+    { -11, 17, -17, 4, 30, -91, 179, -287, 394, -470, 472, -344, 4, 714, -2409, 11919, 8313, -3074, 1574, -768, 267, 39, -201, 258, -246, 196, -133, 76, -34, 9, 2, -4 },
+    { -11, 17, -17, 4, 30, -91, 180, -287, 393, -468, 468, -338, -4, 726, -2422, 11890, 8351, -3074, 1569, -762, 261, 43, -204, 260, -247, 196, -133, 76, -34, 8, 3, -4 },
+    { -11, 16, -17, 3, 31, -92, 180, -287, 392, -466, 464, -332, -13, 737, -2436, 11860, 8390, -3075, 1565, -756, 256, 47, -207, 262, -247, 196, -133, 76, -33, 8, 3, -5 },
+    { -10, 16, -16, 3, 31, -93, 181, -287, 392, -464, 460, -326, -22, 749, -2449, 11831, 8429, -3075, 1560, -751, 251, 52, -210, 263, -248, 196, -133, 75, -33, 8, 3, -5 },
+    { -10, 16, -16, 3, 32, -93, 181, -287, 391, -462, 457, -320, -30, 760, -2462, 11801, 8467, -3075, 1555, -745, 245, 56, -213, 265, -249, 196, -133, 75, -33, 8, 3, -5 },
+    { -10, 16, -16, 2, 33, -94, 182, -287, 390, -460, 453, -314, -39, 771, -2475, 11771, 8506, -3075, 1550, -739, 240, 60, -216, 267, -250, 197, -133, 75, -33, 8, 3, -5 },
+    { -10, 16, -16, 2, 33, -95, 183, -287, 390, -458, 449, -308, -47, 782, -2488, 11741, 8544, -3075, 1545, -733, 235, 64, -219, 269, -251, 197, -132, 75, -32, 7, 3, -5 },
+    { -10, 16, -15, 1, 34, -95, 183, -288, 389, -456, 445, -301, -56, 793, -2501, 11711, 8582, -3074, 1539, -727, 229, 69, -222, 271, -252, 197, -132, 74, -32, 7, 3, -5 },
+    { -10, 16, -15, 1, 34, -96, 184, -288, 388, -454, 441, -295, -65, 805, -2514, 11681, 8621, -3074, 1534, -721, 224, 73, -225, 272, -253, 197, -132, 74, -32, 7, 4, -5 },
+    { -10, 16, -15, 0, 35, -97, 184, -288, 387, -452, 437, -289, -73, 816, -2526, 11651, 8659, -3073, 1529, -715, 218, 77, -228, 274, -253, 198, -132, 74, -31, 7, 4, -5 },
+    { -10, 15, -15, 0, 36, -97, 185, -288, 387, -449, 433, -283, -82, 827, -2538, 11620, 8697, -3073, 1524, -709, 213, 82, -231, 276, -254, 198, -132, 73, -31, 6, 4, -5 },
+    { -10, 15, -14, 0, 36, -98, 185, -288, 386, -447, 430, -277, -90, 838, -2550, 11590, 8735, -3072, 1518, -703, 207, 86, -234, 278, -255, 198, -132, 73, -31, 6, 4, -5 },
+    { -10, 15, -14, -1, 37, -99, 186, -288, 385, -445, 426, -271, -99, 848, -2562, 11559, 8773, -3071, 1513, -696, 202, 90, -237, 280, -256, 198, -131, 73, -30, 6, 4, -5 },
+    { -10, 15, -14, -1, 37, -99, 186, -288, 384, -443, 422, -265, -107, 859, -2574, 11529, 8811, -3070, 1507, -690, 196, 94, -240, 281, -257, 198, -131, 72, -30, 6, 4, -5 },
+    { -10, 15, -13, -2, 38, -100, 187, -288, 383, -441, 418, -259, -116, 870, -2586, 11498, 8849, -3069, 1501, -684, 191, 99, -243, 283, -258, 198, -131, 72, -30, 6, 4, -5 },
+    { -10, 15, -13, -2, 38, -100, 187, -288, 383, -439, 414, -253, -124, 881, -2598, 11467, 8887, -3067, 1496, -678, 185, 103, -245, 285, -258, 199, -131, 72, -30, 5, 4, -5 },
+    { -10, 15, -13, -2, 39, -101, 187, -288, 382, -437, 410, -247, -133, 891, -2609, 11435, 8925, -3066, 1490, -671, 180, 107, -248, 287, -259, 199, -131, 71, -29, 5, 5, -5 },
+    { -10, 14, -13, -3, 39, -102, 188, -288, 381, -434, 406, -241, -141, 902, -2620, 11404, 8963, -3064, 1484, -665, 174, 112, -251, 288, -260, 199, -130, 71, -29, 5, 5, -5 },
+    { -10, 14, -12, -3, 40, -102, 188, -288, 380, -432, 402, -235, -149, 912, -2631, 11373, 9001, -3063, 1478, -659, 169, 116, -254, 290, -261, 199, -130, 71, -29, 5, 5, -6 },
+    { -10, 14, -12, -4, 41, -103, 189, -288, 379, -430, 398, -229, -158, 923, -2642, 11341, 9038, -3061, 1472, -652, 163, 120, -257, 292, -261, 199, -130, 70, -28, 4, 5, -6 },
+    { -10, 14, -12, -4, 41, -103, 189, -288, 378, -428, 394, -222, -166, 933, -2653, 11310, 9076, -3059, 1466, -646, 157, 125, -260, 293, -262, 199, -130, 70, -28, 4, 5, -6 },
+    { -10, 14, -12, -5, 42, -104, 190, -288, 377, -425, 390, -216, -174, 944, -2664, 11278, 9114, -3057, 1460, -639, 152, 129, -263, 295, -263, 199, -129, 70, -28, 4, 5, -6 },
+    { -9, 14, -11, -5, 42, -105, 190, -288, 376, -423, 386, -210, -183, 954, -2675, 11246, 9151, -3055, 1453, -633, 146, 133, -266, 297, -264, 199, -129, 69, -27, 4, 5, -6 },
+    { -9, 14, -11, -5, 43, -105, 190, -288, 375, -421, 382, -204, -191, 964, -2685, 11214, 9188, -3052, 1447, -626, 140, 137, -269, 298, -264, 199, -129, 69, -27, 3, 6, -6 },
+    { -9, 13, -11, -6, 43, -106, 191, -288, 374, -419, 378, -198, -199, 974, -2695, 11182, 9226, -3050, 1441, -619, 135, 142, -272, 300, -265, 200, -129, 69, -27, 3, 6, -6 },
+    { -9, 13, -11, -6, 44, -106, 191, -288, 373, -416, 374, -192, -207, 984, -2705, 11150, 9263, -3047, 1434, -613, 129, 146, -275, 302, -266, 200, -128, 68, -26, 3, 6, -6 },
+    { -9, 13, -10, -7, 44, -107, 192, -287, 372, -414, 370, -186, -216, 994, -2715, 11118, 9300, -3044, 1428, -606, 123, 150, -277, 303, -266, 200, -128, 68, -26, 3, 6, -6 },
+    { -9, 13, -10, -7, 45, -107, 192, -287, 371, -412, 366, -180, -224, 1004, -2725, 11085, 9337, -3041, 1421, -599, 118, 155, -280, 305, -267, 200, -128, 68, -26, 3, 6, -6 },
+    { -9, 13, -10, -7, 45, -108, 192, -287, 370, -409, 362, -174, -232, 1014, -2735, 11053, 9374, -3038, 1414, -593, 112, 159, -283, 306, -268, 200, -128, 67, -25, 2, 6, -6 },
+    { -9, 13, -10, -8, 46, -108, 193, -287, 369, -407, 358, -168, -240, 1024, -2745, 11020, 9411, -3035, 1408, -586, 106, 163, -286, 308, -268, 200, -127, 67, -25, 2, 6, -6 },
+    { -9, 13, -9, -8, 46, -109, 193, -287, 368, -405, 354, -162, -248, 1034, -2754, 10987, 9448, -3032, 1401, -579, 100, 168, -289, 310, -269, 200, -127, 66, -25, 2, 7, -6 },
+    { -9, 13, -9, -9, 47, -110, 193, -287, 367, -402, 349, -155, -256, 1044, -2763, 10954, 9485, -3029, 1394, -572, 95, 172, -292, 311, -270, 200, -127, 66, -24, 2, 7, -6 },
+    { -9, 12, -9, -9, 47, -110, 194, -286, 366, -400, 345, -149, -264, 1053, -2773, 10921, 9522, -3025, 1387, -565, 89, 176, -295, 313, -270, 200, -126, 66, -24, 1, 7, -6 },
+    { -9, 12, -8, -9, 48, -111, 194, -286, 365, -397, 341, -143, -273, 1063, -2782, 10888, 9559, -3021, 1380, -558, 83, 180, -297, 314, -271, 200, -126, 65, -24, 1, 7, -6 },
+    { -9, 12, -8, -10, 49, -111, 194, -286, 364, -395, 337, -137, -281, 1073, -2790, 10855, 9595, -3018, 1373, -551, 77, 185, -300, 316, -271, 200, -126, 65, -23, 1, 7, -7 },
+    { -9, 12, -8, -10, 49, -112, 195, -286, 363, -393, 333, -131, -289, 1082, -2799, 10822, 9632, -3014, 1366, -544, 72, 189, -303, 317, -272, 200, -126, 64, -23, 1, 7, -7 },
+    { -9, 12, -8, -11, 50, -112, 195, -286, 362, -390, 329, -125, -297, 1091, -2808, 10788, 9668, -3010, 1358, -537, 66, 193, -306, 319, -273, 200, -125, 64, -23, 0, 7, -7 },
+    { -9, 12, -7, -11, 50, -113, 195, -285, 361, -388, 325, -119, -305, 1101, -2816, 10755, 9705, -3006, 1351, -530, 60, 198, -309, 320, -273, 200, -125, 64, -22, 0, 7, -7 },
+    { -9, 12, -7, -11, 51, -113, 195, -285, 359, -385, 321, -113, -312, 1110, -2825, 10721, 9741, -3001, 1344, -523, 54, 202, -311, 322, -274, 200, -125, 63, -22, 0, 8, -7 },
+    { -8, 11, -7, -12, 51, -114, 196, -285, 358, -383, 316, -107, -320, 1119, -2833, 10687, 9777, -2997, 1336, -516, 48, 206, -314, 323, -274, 200, -124, 63, -22, 0, 8, -7 },
+    { -8, 11, -7, -12, 52, -114, 196, -285, 357, -380, 312, -101, -328, 1129, -2841, 10654, 9813, -2992, 1329, -509, 42, 211, -317, 325, -275, 200, -124, 62, -21, -1, 8, -7 },
+    { -8, 11, -6, -13, 52, -114, 196, -284, 356, -378, 308, -95, -336, 1138, -2849, 10620, 9849, -2987, 1321, -502, 36, 215, -320, 326, -275, 200, -124, 62, -21, -1, 8, -7 },
+    { -8, 11, -6, -13, 52, -115, 196, -284, 355, -375, 304, -89, -344, 1147, -2856, 10586, 9885, -2983, 1314, -495, 31, 219, -322, 328, -276, 200, -123, 62, -20, -1, 8, -7 },
+    { -8, 11, -6, -13, 53, -115, 197, -284, 353, -373, 300, -83, -352, 1156, -2864, 10552, 9921, -2978, 1306, -487, 25, 223, -325, 329, -276, 199, -123, 61, -20, -1, 8, -7 },
+    { -8, 11, -6, -14, 53, -116, 197, -283, 352, -370, 296, -77, -359, 1165, -2872, 10517, 9957, -2972, 1298, -480, 19, 228, -328, 331, -277, 199, -122, 61, -20, -2, 8, -7 },
+    { -8, 11, -5, -14, 54, -116, 197, -283, 351, -368, 291, -71, -367, 1173, -2879, 10483, 9993, -2967, 1290, -473, 13, 232, -331, 332, -277, 199, -122, 60, -19, -2, 9, -7 },
+    { -8, 10, -5, -15, 54, -117, 197, -283, 350, -365, 287, -65, -375, 1182, -2886, 10449, 10028, -2962, 1282, -465, 7, 236, -333, 334, -278, 199, -122, 60, -19, -2, 9, -7 },
+    { -8, 10, -5, -15, 55, -117, 198, -282, 348, -362, 283, -59, -383, 1191, -2893, 10414, 10064, -2956, 1274, -458, 1, 240, -336, 335, -278, 199, -121, 59, -19, -2, 9, -7 },
+    { -8, 10, -5, -15, 55, -118, 198, -282, 347, -360, 279, -53, -390, 1200, -2900, 10379, 10099, -2950, 1266, -451, -5, 245, -339, 336, -279, 199, -121, 59, -18, -3, 9, -7 },
+    { -8, 10, -4, -16, 56, -118, 198, -282, 346, -357, 274, -47, -398, 1208, -2907, 10345, 10135, -2945, 1258, -443, -11, 249, -341, 338, -279, 199, -121, 59, -18, -3, 9, -7 },
+    { -8, 10, -4, -16, 56, -119, 198, -281, 345, -355, 270, -41, -406, 1217, -2913, 10310, 10170, -2939, 1250, -436, -17, 253, -344, 339, -280, 199, -120, 58, -18, -3, 9, -8 },
+    { -8, 10, -4, -16, 57, -119, 198, -281, 343, -352, 266, -35, -413, 1225, -2920, 10275, 10205, -2933, 1242, -428, -23, 257, -347, 341, -280, 199, -120, 58, -17, -3, 9, -8 },
+    { -8, 10, -4, -17, 57, -119, 198, -281, 342, -349, 262, -29, -421, 1234, -2926, 10240, 10240, -2926, 1234, -421, -29, 262, -349, 342, -281, 198, -119, 57, -17, -4, 10, -8 },
+    { -8, 9, -3, -17, 58, -120, 199, -280, 341, -347, 257, -23, -428, 1242, -2933, 10205, 10275, -2920, 1225, -413, -35, 266, -352, 343, -281, 198, -119, 57, -16, -4, 10, -8 },
+    { -8, 9, -3, -18, 58, -120, 199, -280, 339, -344, 253, -17, -436, 1250, -2939, 10170, 10310, -2913, 1217, -406, -41, 270, -355, 345, -281, 198, -119, 56, -16, -4, 10, -8 },
+    { -7, 9, -3, -18, 59, -121, 199, -279, 338, -341, 249, -11, -443, 1258, -2945, 10135, 10345, -2907, 1208, -398, -47, 274, -357, 346, -282, 198, -118, 56, -16, -4, 10, -8 },
+    { -7, 9, -3, -18, 59, -121, 199, -279, 336, -339, 245, -5, -451, 1266, -2950, 10099, 10379, -2900, 1200, -390, -53, 279, -360, 347, -282, 198, -118, 55, -15, -5, 10, -8 },
+    { -7, 9, -2, -19, 59, -121, 199, -278, 335, -336, 240, 1, -458, 1274, -2956, 10064, 10414, -2893, 1191, -383, -59, 283, -362, 348, -282, 198, -117, 55, -15, -5, 10, -8 },
+    { -7, 9, -2, -19, 60, -122, 199, -278, 334, -333, 236, 7, -465, 1282, -2962, 10028, 10449, -2886, 1182, -375, -65, 287, -365, 350, -283, 197, -117, 54, -15, -5, 10, -8 },
+    { -7, 9, -2, -19, 60, -122, 199, -277, 332, -331, 232, 13, -473, 1290, -2967, 9993, 10483, -2879, 1173, -367, -71, 291, -368, 351, -283, 197, -116, 54, -14, -5, 11, -8 },
+    { -7, 8, -2, -20, 61, -122, 199, -277, 331, -328, 228, 19, -480, 1298, -2972, 9957, 10517, -2872, 1165, -359, -77, 296, -370, 352, -283, 197, -116, 53, -14, -6, 11, -8 },
+    { -7, 8, -1, -20, 61, -123, 199, -276, 329, -325, 223, 25, -487, 1306, -2978, 9921, 10552, -2864, 1156, -352, -83, 300, -373, 353, -284, 197, -115, 53, -13, -6, 11, -8 },
+    { -7, 8, -1, -20, 62, -123, 200, -276, 328, -322, 219, 31, -495, 1314, -2983, 9885, 10586, -2856, 1147, -344, -89, 304, -375, 355, -284, 196, -115, 52, -13, -6, 11, -8 },
+    { -7, 8, -1, -21, 62, -124, 200, -275, 326, -320, 215, 36, -502, 1321, -2987, 9849, 10620, -2849, 1138, -336, -95, 308, -378, 356, -284, 196, -114, 52, -13, -6, 11, -8 },
+    { -7, 8, -1, -21, 62, -124, 200, -275, 325, -317, 211, 42, -509, 1329, -2992, 9813, 10654, -2841, 1129, -328, -101, 312, -380, 357, -285, 196, -114, 52, -12, -7, 11, -8 },
+    { -7, 8, 0, -22, 63, -124, 200, -274, 323, -314, 206, 48, -516, 1336, -2997, 9777, 10687, -2833, 1119, -320, -107, 316, -383, 358, -285, 196, -114, 51, -12, -7, 11, -8 },
+    { -7, 8, 0, -22, 63, -125, 200, -274, 322, -311, 202, 54, -523, 1344, -3001, 9741, 10721, -2825, 1110, -312, -113, 321, -385, 359, -285, 195, -113, 51, -11, -7, 12, -9 },
+    { -7, 7, 0, -22, 64, -125, 200, -273, 320, -309, 198, 60, -530, 1351, -3006, 9705, 10755, -2816, 1101, -305, -119, 325, -388, 361, -285, 195, -113, 50, -11, -7, 12, -9 },
+    { -7, 7, 0, -23, 64, -125, 200, -273, 319, -306, 193, 66, -537, 1358, -3010, 9668, 10788, -2808, 1091, -297, -125, 329, -390, 362, -286, 195, -112, 50, -11, -8, 12, -9 },
+    { -7, 7, 1, -23, 64, -126, 200, -272, 317, -303, 189, 72, -544, 1366, -3014, 9632, 10822, -2799, 1082, -289, -131, 333, -393, 363, -286, 195, -112, 49, -10, -8, 12, -9 },
+    { -7, 7, 1, -23, 65, -126, 200, -271, 316, -300, 185, 77, -551, 1373, -3018, 9595, 10855, -2790, 1073, -281, -137, 337, -395, 364, -286, 194, -111, 49, -10, -8, 12, -9 },
+    { -6, 7, 1, -24, 65, -126, 200, -271, 314, -297, 180, 83, -558, 1380, -3021, 9559, 10888, -2782, 1063, -273, -143, 341, -397, 365, -286, 194, -111, 48, -9, -8, 12, -9 },
+    { -6, 7, 1, -24, 66, -126, 200, -270, 313, -295, 176, 89, -565, 1387, -3025, 9522, 10921, -2773, 1053, -264, -149, 345, -400, 366, -286, 194, -110, 47, -9, -9, 12, -9 },
+    { -6, 7, 2, -24, 66, -127, 200, -270, 311, -292, 172, 95, -572, 1394, -3029, 9485, 10954, -2763, 1044, -256, -155, 349, -402, 367, -287, 193, -110, 47, -9, -9, 13, -9 },
+    { -6, 7, 2, -25, 66, -127, 200, -269, 310, -289, 168, 100, -579, 1401, -3032, 9448, 10987, -2754, 1034, -248, -162, 354, -405, 368, -287, 193, -109, 46, -8, -9, 13, -9 },
+    { -6, 6, 2, -25, 67, -127, 200, -268, 308, -286, 163, 106, -586, 1408, -3035, 9411, 11020, -2745, 1024, -240, -168, 358, -407, 369, -287, 193, -108, 46, -8, -10, 13, -9 },
+    { -6, 6, 2, -25, 67, -128, 200, -268, 306, -283, 159, 112, -593, 1414, -3038, 9374, 11053, -2735, 1014, -232, -174, 362, -409, 370, -287, 192, -108, 45, -7, -10, 13, -9 },
+    { -6, 6, 3, -26, 68, -128, 200, -267, 305, -280, 155, 118, -599, 1421, -3041, 9337, 11085, -2725, 1004, -224, -180, 366, -412, 371, -287, 192, -107, 45, -7, -10, 13, -9 },
+    { -6, 6, 3, -26, 68, -128, 200, -266, 303, -277, 150, 123, -606, 1428, -3044, 9300, 11118, -2715, 994, -216, -186, 370, -414, 372, -287, 192, -107, 44, -7, -10, 13, -9 },
+    { -6, 6, 3, -26, 68, -128, 200, -266, 302, -275, 146, 129, -613, 1434, -3047, 9263, 11150, -2705, 984, -207, -192, 374, -416, 373, -288, 191, -106, 44, -6, -11, 13, -9 },
+    { -6, 6, 3, -27, 69, -129, 200, -265, 300, -272, 142, 135, -619, 1441, -3050, 9226, 11182, -2695, 974, -199, -198, 378, -419, 374, -288, 191, -106, 43, -6, -11, 13, -9 },
+    { -6, 6, 3, -27, 69, -129, 199, -264, 298, -269, 137, 140, -626, 1447, -3052, 9188, 11214, -2685, 964, -191, -204, 382, -421, 375, -288, 190, -105, 43, -5, -11, 14, -9 },
+    { -6, 5, 4, -27, 69, -129, 199, -264, 297, -266, 133, 146, -633, 1453, -3055, 9151, 11246, -2675, 954, -183, -210, 386, -423, 376, -288, 190, -105, 42, -5, -11, 14, -9 },
+    { -6, 5, 4, -28, 70, -129, 199, -263, 295, -263, 129, 152, -639, 1460, -3057, 9114, 11278, -2664, 944, -174, -216, 390, -425, 377, -288, 190, -104, 42, -5, -12, 14, -10 },
+    { -6, 5, 4, -28, 70, -130, 199, -262, 293, -260, 125, 157, -646, 1466, -3059, 9076, 11310, -2653, 933, -166, -222, 394, -428, 378, -288, 189, -103, 41, -4, -12, 14, -10 },
+    { -6, 5, 4, -28, 70, -130, 199, -261, 292, -257, 120, 163, -652, 1472, -3061, 9038, 11341, -2642, 923, -158, -229, 398, -430, 379, -288, 189, -103, 41, -4, -12, 14, -10 },
+    { -6, 5, 5, -29, 71, -130, 199, -261, 290, -254, 116, 169, -659, 1478, -3063, 9001, 11373, -2631, 912, -149, -235, 402, -432, 380, -288, 188, -102, 40, -3, -12, 14, -10 },
+    { -5, 5, 5, -29, 71, -130, 199, -260, 288, -251, 112, 174, -665, 1484, -3064, 8963, 11404, -2620, 902, -141, -241, 406, -434, 381, -288, 188, -102, 39, -3, -13, 14, -10 },
+    { -5, 5, 5, -29, 71, -131, 199, -259, 287, -248, 107, 180, -671, 1490, -3066, 8925, 11435, -2609, 891, -133, -247, 410, -437, 382, -288, 187, -101, 39, -2, -13, 15, -10 },
+    { -5, 4, 5, -30, 72, -131, 199, -258, 285, -245, 103, 185, -678, 1496, -3067, 8887, 11467, -2598, 881, -124, -253, 414, -439, 383, -288, 187, -100, 38, -2, -13, 15, -10 },
+    { -5, 4, 6, -30, 72, -131, 198, -258, 283, -243, 99, 191, -684, 1501, -3069, 8849, 11498, -2586, 870, -116, -259, 418, -441, 383, -288, 187, -100, 38, -2, -13, 15, -10 },
+    { -5, 4, 6, -30, 72, -131, 198, -257, 281, -240, 94, 196, -690, 1507, -3070, 8811, 11529, -2574, 859, -107, -265, 422, -443, 384, -288, 186, -99, 37, -1, -14, 15, -10 },
+    { -5, 4, 6, -30, 73, -131, 198, -256, 280, -237, 90, 202, -696, 1513, -3071, 8773, 11559, -2562, 848, -99, -271, 426, -445, 385, -288, 186, -99, 37, -1, -14, 15, -10 },
+    { -5, 4, 6, -31, 73, -132, 198, -255, 278, -234, 86, 207, -703, 1518, -3072, 8735, 11590, -2550, 838, -90, -277, 430, -447, 386, -288, 185, -98, 36, 0, -14, 15, -10 },
+    { -5, 4, 6, -31, 73, -132, 198, -254, 276, -231, 82, 213, -709, 1524, -3073, 8697, 11620, -2538, 827, -82, -283, 433, -449, 387, -288, 185, -97, 36, 0, -15, 15, -10 },
+    { -5, 4, 7, -31, 74, -132, 198, -253, 274, -228, 77, 218, -715, 1529, -3073, 8659, 11651, -2526, 816, -73, -289, 437, -452, 387, -288, 184, -97, 35, 0, -15, 16, -10 },
+    { -5, 4, 7, -32, 74, -132, 197, -253, 272, -225, 73, 224, -721, 1534, -3074, 8621, 11681, -2514, 805, -65, -295, 441, -454, 388, -288, 184, -96, 34, 1, -15, 16, -10 },
+    { -5, 3, 7, -32, 74, -132, 197, -252, 271, -222, 69, 229, -727, 1539, -3074, 8582, 11711, -2501, 793, -56, -301, 445, -456, 389, -288, 183, -95, 34, 1, -15, 16, -10 },
+    { -5, 3, 7, -32, 75, -132, 197, -251, 269, -219, 64, 235, -733, 1545, -3075, 8544, 11741, -2488, 782, -47, -308, 449, -458, 390, -287, 183, -95, 33, 2, -16, 16, -10 },
+    { -5, 3, 8, -33, 75, -133, 197, -250, 267, -216, 60, 240, -739, 1550, -3075, 8506, 11771, -2475, 771, -39, -314, 453, -460, 390, -287, 182, -94, 33, 2, -16, 16, -10 },
+    { -5, 3, 8, -33, 75, -133, 196, -249, 265, -213, 56, 245, -745, 1555, -3075, 8467, 11801, -2462, 760, -30, -320, 457, -462, 391, -287, 181, -93, 32, 3, -16, 16, -10 },
+    { -5, 3, 8, -33, 75, -133, 196, -248, 263, -210, 52, 251, -751, 1560, -3075, 8429, 11831, -2449, 749, -22, -326, 460, -464, 392, -287, 181, -93, 31, 3, -16, 16, -10 },
+    { -5, 3, 8, -33, 76, -133, 196, -247, 262, -207, 47, 256, -756, 1565, -3075, 8390, 11860, -2436, 737, -13, -332, 464, -466, 392, -287, 180, -92, 31, 3, -17, 16, -11 },
+    { -4, 3, 8, -34, 76, -133, 196, -247, 260, -204, 43, 261, -762, 1569, -3074, 8351, 11890, -2422, 726, -4, -338, 468, -468, 393, -287, 180, -91, 30, 4, -17, 17, -11 },
+    { -4, 2, 9, -34, 76, -133, 196, -246, 258, -201, 39, 267, -768, 1574, -3074, 8313, 11919, -2409, 714, 4, -344, 472, -470, 394, -287, 179, -91, 30, 4, -17, 17, -11 },
+    { -4, 2, 9, -34, 77, -133, 195, -245, 256, -198, 35, 272, -774, 1579, -3073, 8274, 11948, -2395, 703, 13, -350, 475, -472, 394, -286, 179, -90, 29, 5, -17, 17, -11 },
+    { -4, 2, 9, -35, 77, -133, 195, -244, 254, -195, 30, 277, -779, 1583, -3073, 8235, 11977, -2381, 691, 22, -356, 479, -473, 395, -286, 178, -89, 28, 5, -18, 17, -11 },
+    { -4, 2, 9, -35, 77, -133, 195, -243, 252, -192, 26, 283, -785, 1588, -3072, 8196, 12006, -2367, 680, 30, -362, 483, -475, 396, -286, 177, -89, 28, 6, -18, 17, -11 },
+    { -4, 2, 10, -35, 77, -134, 194, -242, 250, -189, 22, 288, -790, 1592, -3071, 8157, 12034, -2353, 668, 39, -368, 487, -477, 396, -286, 177, -88, 27, 6, -18, 17, -11 },
+    { -4, 2, 10, -35, 78, -134, 194, -241, 248, -186, 18, 293, -796, 1597, -3070, 8119, 12063, -2339, 656, 48, -374, 490, -479, 397, -285, 176, -87, 27, 7, -18, 17, -11 },
+    { -4, 2, 10, -36, 78, -134, 194, -240, 247, -182, 13, 298, -801, 1601, -3069, 8080, 12091, -2324, 644, 57, -380, 494, -481, 397, -285, 175, -87, 26, 7, -19, 18, -11 },
+    { -4, 2, 10, -36, 78, -134, 193, -239, 245, -179, 9, 303, -807, 1605, -3067, 8041, 12120, -2310, 633, 65, -386, 498, -483, 398, -285, 175, -86, 25, 7, -19, 18, -11 },
+    { -4, 1, 10, -36, 78, -134, 193, -238, 243, -176, 5, 308, -812, 1609, -3066, 8002, 12148, -2295, 621, 74, -392, 501, -485, 398, -285, 174, -85, 25, 8, -19, 18, -11 },
+    { -4, 1, 11, -37, 79, -134, 193, -237, 241, -173, 1, 314, -818, 1613, -3065, 7962, 12176, -2280, 609, 83, -398, 505, -486, 399, -284, 174, -84, 24, 8, -19, 18, -11 },
+    { -4, 1, 11, -37, 79, -134, 193, -236, 239, -170, -4, 319, -823, 1617, -3063, 7923, 12204, -2265, 597, 92, -404, 508, -488, 399, -284, 173, -84, 24, 9, -20, 18, -11 },
+    { -4, 1, 11, -37, 79, -134, 192, -235, 237, -167, -8, 324, -828, 1621, -3061, 7884, 12232, -2250, 585, 101, -410, 512, -490, 400, -284, 172, -83, 23, 9, -20, 18, -11 },
+    { -4, 1, 11, -37, 79, -134, 192, -234, 235, -164, -12, 329, -834, 1625, -3059, 7845, 12259, -2235, 573, 109, -416, 516, -492, 400, -283, 172, -82, 22, 10, -20, 18, -11 },
+    { -4, 1, 11, -38, 80, -134, 191, -233, 233, -161, -16, 334, -839, 1629, -3057, 7806, 12287, -2219, 560, 118, -422, 519, -493, 401, -283, 171, -81, 22, 10, -21, 18, -11 },
+    { -4, 1, 12, -38, 80, -134, 191, -232, 231, -158, -20, 339, -844, 1633, -3055, 7767, 12314, -2204, 548, 127, -428, 523, -495, 401, -283, 170, -81, 21, 10, -21, 19, -11 },
+    { -3, 0, 12, -38, 80, -134, 191, -231, 229, -155, -24, 344, -849, 1636, -3053, 7727, 12341, -2188, 536, 136, -434, 526, -497, 401, -282, 169, -80, 20, 11, -21, 19, -11 },
+    { -3, 0, 12, -38, 80, -134, 190, -230, 227, -152, -29, 349, -854, 1640, -3051, 7688, 12368, -2172, 524, 145, -440, 530, -498, 402, -282, 169, -79, 20, 11, -21, 19, -11 },
+    { -3, 0, 12, -39, 80, -134, 190, -229, 225, -149, -33, 354, -859, 1643, -3048, 7648, 12395, -2156, 511, 154, -446, 533, -500, 402, -282, 168, -78, 19, 12, -22, 19, -11 },
+    { -3, 0, 12, -39, 81, -134, 190, -228, 223, -146, -37, 359, -864, 1647, -3046, 7609, 12422, -2140, 499, 163, -451, 537, -502, 403, -281, 167, -78, 19, 12, -22, 19, -12 },
+    { -3, 0, 13, -39, 81, -134, 189, -227, 221, -143, -41, 364, -869, 1650, -3043, 7570, 12449, -2124, 487, 171, -457, 540, -503, 403, -281, 167, -77, 18, 13, -22, 19, -12 },
+    { -3, 0, 13, -39, 81, -134, 189, -226, 219, -140, -45, 369, -874, 1654, -3040, 7530, 12475, -2107, 474, 180, -463, 544, -505, 403, -280, 166, -76, 17, 13, -22, 19, -12 },
+    { -3, 0, 13, -40, 81, -134, 188, -225, 217, -137, -49, 374, -879, 1657, -3037, 7491, 12501, -2091, 462, 189, -469, 547, -506, 404, -280, 165, -75, 17, 14, -23, 19, -12 },
+    { -3, 0, 13, -40, 81, -134, 188, -223, 215, -133, -54, 378, -884, 1660, -3034, 7451, 12528, -2074, 449, 198, -475, 551, -508, 404, -280, 164, -75, 16, 14, -23, 20, -12 },
+    { -3, -1, 13, -40, 82, -134, 188, -222, 213, -130, -58, 383, -889, 1663, -3031, 7412, 12554, -2057, 436, 207, -481, 554, -510, 404, -279, 164, -74, 15, 14, -23, 20, -12 },
+    { -3, -1, 14, -40, 82, -134, 187, -221, 211, -127, -62, 388, -893, 1666, -3028, 7372, 12580, -2040, 424, 216, -487, 557, -511, 404, -279, 163, -73, 15, 15, -23, 20, -12 },
+    { -3, -1, 14, -40, 82, -134, 187, -220, 209, -124, -66, 393, -898, 1669, -3024, 7332, 12605, -2023, 411, 225, -493, 561, -513, 405, -278, 162, -72, 14, 15, -24, 20, -12 },
+    { -3, -1, 14, -41, 82, -134, 186, -219, 207, -121, -70, 398, -903, 1672, -3021, 7293, 12631, -2006, 398, 234, -498, 564, -514, 405, -278, 161, -71, 13, 16, -24, 20, -12 },
+    { -3, -1, 14, -41, 82, -134, 186, -218, 205, -118, -74, 402, -907, 1674, -3017, 7253, 12656, -1988, 386, 243, -504, 567, -516, 405, -277, 160, -71, 13, 16, -24, 20, -12 },
+    { -3, -1, 14, -41, 83, -134, 185, -217, 203, -115, -78, 407, -912, 1677, -3014, 7213, 12682, -1970, 373, 252, -510, 571, -517, 405, -277, 160, -70, 12, 17, -24, 20, -12 },
+    { -3, -1, 15, -41, 83, -134, 185, -216, 201, -112, -82, 412, -916, 1680, -3010, 7174, 12707, -1953, 360, 261, -516, 574, -518, 405, -276, 159, -69, 11, 17, -25, 20, -12 },
+    { -3, -1, 15, -42, 83, -134, 184, -214, 199, -109, -86, 417, -921, 1682, -3006, 7134, 12732, -1935, 347, 270, -522, 577, -520, 406, -276, 158, -68, 11, 18, -25, 20, -12 },
+    { -2, -2, 15, -42, 83, -134, 184, -213, 197, -106, -90, 421, -925, 1685, -3002, 7094, 12757, -1917, 334, 279, -527, 580, -521, 406, -275, 157, -67, 10, 18, -25, 21, -12 },
+    { -2, -2, 15, -42, 83, -134, 183, -212, 195, -103, -94, 426, -930, 1687, -2998, 7054, 12781, -1899, 321, 288, -533, 584, -523, 406, -275, 156, -66, 9, 18, -25, 21, -12 },
+    { -2, -2, 15, -42, 83, -134, 183, -211, 193, -100, -98, 430, -934, 1689, -2994, 7015, 12806, -1880, 308, 297, -539, 587, -524, 406, -274, 155, -66, 9, 19, -26, 21, -12 },
+    { -2, -2, 16, -42, 83, -134, 182, -210, 191, -96, -102, 435, -938, 1692, -2989, 6975, 12830, -1862, 295, 306, -545, 590, -525, 406, -273, 155, -65, 8, 19, -26, 21, -12 },
+    { -2, -2, 16, -43, 84, -134, 182, -209, 189, -93, -106, 440, -943, 1694, -2985, 6935, 12855, -1843, 282, 314, -550, 593, -527, 406, -273, 154, -64, 8, 20, -26, 21, -12 },
+    { -2, -2, 16, -43, 84, -134, 181, -207, 187, -90, -110, 444, -947, 1696, -2980, 6895, 12879, -1825, 269, 323, -556, 596, -528, 406, -272, 153, -63, 7, 20, -26, 21, -12 },
+    { -2, -2, 16, -43, 84, -134, 181, -206, 184, -87, -114, 449, -951, 1698, -2975, 6855, 12903, -1806, 255, 332, -562, 600, -529, 406, -272, 152, -62, 6, 21, -27, 21, -12 },
+    { -2, -2, 16, -43, 84, -134, 180, -205, 182, -84, -118, 453, -955, 1700, -2971, 6815, 12926, -1787, 242, 341, -567, 603, -530, 406, -271, 151, -61, 6, 21, -27, 21, -12 },
+    { -2, -2, 16, -44, 84, -134, 180, -204, 180, -81, -122, 458, -959, 1702, -2966, 6775, 12950, -1768, 229, 350, -573, 606, -532, 406, -270, 150, -61, 5, 22, -27, 22, -12 },
+    { -2, -3, 17, -44, 84, -133, 179, -203, 178, -78, -126, 462, -963, 1704, -2961, 6735, 12973, -1748, 216, 359, -579, 609, -533, 406, -270, 149, -60, 4, 22, -27, 22, -12 },
+    { -2, -3, 17, -44, 84, -133, 179, -201, 176, -75, -130, 467, -967, 1706, -2956, 6696, 12997, -1729, 202, 368, -584, 612, -534, 406, -269, 148, -59, 3, 22, -28, 22, -12 },
+    { -2, -3, 17, -44, 85, -133, 178, -200, 174, -72, -134, 471, -971, 1707, -2951, 6656, 13020, -1709, 189, 377, -590, 615, -535, 406, -268, 148, -58, 3, 23, -28, 22, -13 },
+    { -2, -3, 17, -44, 85, -133, 178, -199, 172, -69, -138, 475, -975, 1709, -2945, 6616, 13043, -1690, 175, 386, -595, 618, -536, 406, -268, 147, -57, 2, 23, -28, 22, -13 },
+    { -2, -3, 17, -44, 85, -133, 177, -198, 170, -66, -142, 480, -979, 1710, -2940, 6576, 13066, -1670, 162, 395, -601, 621, -538, 406, -267, 146, -56, 1, 24, -28, 22, -13 },
+    { -2, -3, 17, -45, 85, -133, 177, -196, 168, -63, -146, 484, -983, 1712, -2934, 6536, 13088, -1650, 148, 404, -607, 624, -539, 406, -266, 145, -55, 1, 24, -29, 22, -13 },
+    { -2, -3, 18, -45, 85, -133, 176, -195, 165, -59, -150, 488, -986, 1713, -2929, 6496, 13111, -1630, 135, 413, -612, 627, -540, 406, -265, 144, -55, 0, 25, -29, 22, -13 },
+    { -2, -3, 18, -45, 85, -133, 175, -194, 163, -56, -154, 492, -990, 1715, -2923, 6456, 13133, -1610, 121, 422, -618, 630, -541, 406, -265, 143, -54, -1, 25, -29, 22, -13 },
+    { -1, -4, 18, -45, 85, -133, 175, -193, 161, -53, -158, 497, -994, 1716, -2917, 6416, 13155, -1589, 108, 431, -623, 633, -542, 406, -264, 142, -53, -1, 26, -29, 23, -13 },
+    { -1, -4, 18, -45, 85, -132, 174, -191, 159, -50, -162, 501, -997, 1717, -2911, 6376, 13178, -1569, 94, 440, -629, 636, -543, 406, -263, 141, -52, -2, 26, -30, 23, -13 },
+    { -1, -4, 18, -46, 85, -132, 174, -190, 157, -47, -165, 505, -1001, 1718, -2905, 6336, 13199, -1548, 80, 449, -634, 638, -544, 405, -262, 140, -51, -3, 26, -30, 23, -13 },
+    { -1, -4, 18, -46, 85, -132, 173, -189, 155, -44, -169, 509, -1004, 1719, -2899, 6296, 13221, -1527, 67, 458, -640, 641, -545, 405, -262, 139, -50, -3, 27, -30, 23, -13 },
+    { -1, -4, 19, -46, 86, -132, 172, -187, 153, -41, -173, 513, -1008, 1720, -2893, 6256, 13243, -1506, 53, 467, -645, 644, -546, 405, -261, 138, -49, -4, 27, -30, 23, -13 },
+    { -1, -4, 19, -46, 86, -132, 172, -186, 151, -38, -177, 518, -1011, 1721, -2887, 6216, 13264, -1485, 39, 476, -650, 647, -547, 405, -260, 137, -48, -5, 28, -31, 23, -13 },
+    { -1, -4, 19, -46, 86, -132, 171, -185, 148, -35, -181, 522, -1015, 1722, -2880, 6176, 13285, -1464, 25, 485, -656, 650, -548, 405, -259, 136, -47, -5, 28, -31, 23, -13 },
+    { -1, -4, 19, -46, 86, -131, 170, -184, 146, -32, -185, 526, -1018, 1723, -2874, 6136, 13306, -1442, 12, 494, -661, 652, -549, 404, -258, 135, -46, -6, 29, -31, 23, -13 },
+    { -1, -4, 19, -47, 86, -131, 170, -182, 144, -29, -188, 530, -1021, 1723, -2867, 6096, 13327, -1421, -2, 503, -667, 655, -550, 404, -257, 134, -46, -7, 29, -31, 23, -13 },
+    { -1, -5, 19, -47, 86, -131, 169, -181, 142, -26, -192, 534, -1025, 1724, -2860, 6056, 13348, -1399, -16, 512, -672, 658, -550, 404, -257, 133, -45, -7, 30, -32, 23, -13 },
+    { -1, -5, 20, -47, 86, -131, 169, -180, 140, -23, -196, 538, -1028, 1724, -2853, 6016, 13368, -1377, -30, 521, -677, 661, -551, 404, -256, 132, -44, -8, 30, -32, 24, -13 },
+    { -1, -5, 20, -47, 86, -131, 168, -178, 138, -20, -200, 542, -1031, 1725, -2847, 5976, 13389, -1356, -44, 530, -683, 663, -552, 403, -255, 131, -43, -9, 30, -32, 24, -13 },
+    { -1, -5, 20, -47, 86, -130, 167, -177, 135, -17, -203, 546, -1034, 1725, -2840, 5936, 13409, -1333, -58, 539, -688, 666, -553, 403, -254, 130, -42, -9, 31, -32, 24, -13 },
+    { -1, -5, 20, -47, 86, -130, 167, -176, 133, -14, -207, 549, -1037, 1726, -2832, 5896, 13429, -1311, -72, 548, -693, 668, -554, 403, -253, 129, -41, -10, 31, -33, 24, -13 },
+    { -1, -5, 20, -48, 86, -130, 166, -174, 131, -11, -211, 553, -1040, 1726, -2825, 5856, 13449, -1289, -86, 556, -698, 671, -554, 402, -252, 128, -40, -11, 32, -33, 24, -13 },
+    { -1, -5, 20, -48, 86, -130, 165, -173, 129, -8, -214, 557, -1043, 1726, -2818, 5816, 13469, -1266, -100, 565, -704, 674, -555, 402, -251, 127, -39, -12, 32, -33, 24, -13 },
+    { -1, -5, 21, -48, 86, -130, 165, -172, 127, -5, -218, 561, -1046, 1726, -2811, 5776, 13488, -1244, -114, 574, -709, 676, -556, 401, -250, 126, -38, -12, 33, -33, 24, -13 },
+    { -1, -5, 21, -48, 86, -129, 164, -170, 125, -2, -222, 565, -1049, 1726, -2803, 5736, 13508, -1221, -128, 583, -714, 679, -557, 401, -249, 125, -37, -13, 33, -33, 24, -13 },
+    { 0, -5, 21, -48, 86, -129, 163, -169, 122, 2, -225, 568, -1052, 1726, -2796, 5696, 13527, -1198, -143, 592, -719, 681, -557, 401, -248, 124, -36, -14, 34, -34, 24, -13 },
+    { 0, -6, 21, -48, 86, -129, 162, -167, 120, 5, -229, 572, -1055, 1726, -2788, 5656, 13546, -1175, -157, 601, -724, 684, -558, 400, -247, 122, -35, -14, 34, -34, 24, -13 },
+    { 0, -6, 21, -48, 86, -129, 162, -166, 118, 8, -233, 576, -1057, 1726, -2780, 5616, 13565, -1152, -171, 610, -730, 686, -559, 400, -246, 121, -34, -15, 34, -34, 25, -13 },
+    { 0, -6, 21, -49, 86, -128, 161, -165, 116, 11, -236, 580, -1060, 1726, -2772, 5576, 13583, -1129, -185, 619, -735, 689, -559, 399, -245, 120, -33, -16, 35, -34, 25, -13 },
+    { 0, -6, 21, -49, 86, -128, 160, -163, 114, 14, -240, 583, -1063, 1726, -2764, 5536, 13602, -1105, -199, 627, -740, 691, -560, 399, -244, 119, -32, -16, 35, -35, 25, -13 },
+    { 0, -6, 22, -49, 86, -128, 160, -162, 111, 17, -243, 587, -1065, 1725, -2756, 5496, 13620, -1082, -214, 636, -745, 693, -560, 398, -243, 118, -31, -17, 36, -35, 25, -13 },
+    { 0, -6, 22, -49, 87, -128, 159, -161, 109, 20, -247, 590, -1068, 1725, -2748, 5456, 13638, -1058, -228, 645, -750, 696, -561, 398, -242, 117, -31, -18, 36, -35, 25, -13 },
+    { 0, -6, 22, -49, 87, -127, 158, -159, 107, 23, -251, 594, -1070, 1724, -2740, 5416, 13656, -1034, -242, 654, -755, 698, -561, 397, -241, 116, -30, -19, 37, -35, 25, -13 },
+    { 0, -6, 22, -49, 87, -127, 157, -158, 105, 25, -254, 597, -1073, 1724, -2732, 5376, 13674, -1010, -257, 663, -760, 700, -562, 397, -240, 115, -29, -19, 37, -35, 25, -13 },
+    { 0, -6, 22, -49, 87, -127, 157, -156, 103, 28, -258, 601, -1075, 1723, -2723, 5337, 13692, -986, -271, 672, -765, 703, -562, 396, -239, 114, -28, -20, 37, -36, 25, -13 },
+    { 0, -6, 22, -49, 87, -127, 156, -155, 100, 31, -261, 604, -1078, 1722, -2715, 5297, 13709, -962, -285, 680, -770, 705, -563, 395, -238, 112, -27, -21, 38, -36, 25, -13 },
+    { 0, -7, 22, -50, 87, -126, 155, -154, 98, 34, -265, 608, -1080, 1722, -2706, 5257, 13727, -938, -300, 689, -775, 707, -563, 395, -237, 111, -26, -21, 38, -36, 25, -13 },
+    { 0, -7, 22, -50, 87, -126, 154, -152, 96, 37, -268, 611, -1082, 1721, -2698, 5217, 13744, -913, -314, 698, -780, 709, -564, 394, -236, 110, -25, -22, 39, -36, 25, -14 },
+    { 0, -7, 23, -50, 87, -126, 154, -151, 94, 40, -272, 615, -1085, 1720, -2689, 5177, 13761, -889, -329, 707, -784, 711, -564, 394, -235, 109, -24, -23, 39, -37, 25, -14 },
+    { 0, -7, 23, -50, 86, -125, 153, -149, 92, 43, -275, 618, -1087, 1719, -2680, 5138, 13778, -864, -343, 715, -789, 714, -564, 393, -234, 108, -23, -23, 40, -37, 26, -14 },
+    { 0, -7, 23, -50, 86, -125, 152, -148, 89, 46, -278, 621, -1089, 1718, -2671, 5098, 13794, -839, -358, 724, -794, 716, -565, 392, -233, 107, -22, -24, 40, -37, 26, -14 },
+    { 0, -7, 23, -50, 86, -125, 151, -146, 87, 49, -282, 625, -1091, 1717, -2663, 5058, 13811, -814, -372, 733, -799, 718, -565, 392, -231, 105, -21, -25, 40, -37, 26, -14 },
+    { 0, -7, 23, -50, 86, -124, 150, -145, 85, 52, -285, 628, -1093, 1716, -2653, 5019, 13827, -789, -387, 741, -804, 720, -565, 391, -230, 104, -20, -26, 41, -37, 26, -14 },
+    { 0, -7, 23, -50, 86, -124, 150, -144, 83, 55, -289, 631, -1095, 1714, -2644, 4979, 13843, -764, -401, 750, -808, 722, -566, 390, -229, 103, -19, -26, 41, -38, 26, -14 },
+    { 0, -7, 23, -50, 86, -124, 149, -142, 81, 58, -292, 634, -1097, 1713, -2635, 4939, 13859, -738, -416, 759, -813, 724, -566, 389, -228, 102, -18, -27, 42, -38, 26, -14 },
+    { 1, -7, 23, -50, 86, -124, 148, -141, 78, 61, -295, 637, -1099, 1712, -2626, 4900, 13875, -713, -430, 767, -818, 726, -566, 389, -227, 101, -17, -28, 42, -38, 26, -14 },
+    { 1, -8, 24, -51, 86, -123, 147, -139, 76, 64, -299, 641, -1101, 1710, -2616, 4860, 13890, -687, -445, 776, -822, 728, -566, 388, -226, 99, -16, -28, 43, -38, 26, -14 },
+    { 1, -8, 24, -51, 86, -123, 147, -138, 74, 67, -302, 644, -1102, 1709, -2607, 4821, 13905, -661, -460, 785, -827, 730, -567, 387, -224, 98, -15, -29, 43, -38, 26, -14 },
+    { 1, -8, 24, -51, 86, -123, 146, -136, 72, 70, -305, 647, -1104, 1707, -2597, 4781, 13921, -635, -474, 793, -832, 732, -567, 386, -223, 97, -14, -30, 43, -39, 26, -14 },
+    { 1, -8, 24, -51, 86, -122, 145, -135, 70, 72, -308, 650, -1106, 1705, -2588, 4742, 13936, -609, -489, 802, -836, 734, -567, 385, -222, 96, -13, -31, 44, -39, 26, -14 },
+    { 1, -8, 24, -51, 86, -122, 144, -133, 67, 75, -312, 653, -1108, 1704, -2578, 4702, 13950, -583, -504, 810, -841, 735, -567, 384, -221, 94, -12, -31, 44, -39, 26, -14 },
+    { 1, -8, 24, -51, 86, -121, 143, -132, 65, 78, -315, 656, -1109, 1702, -2568, 4663, 13965, -557, -518, 819, -845, 737, -567, 384, -219, 93, -11, -32, 45, -39, 27, -14 },
+    { 1, -8, 24, -51, 86, -121, 142, -130, 63, 81, -318, 659, -1111, 1700, -2559, 4623, 13980, -530, -533, 827, -850, 739, -567, 383, -218, 92, -10, -33, 45, -40, 27, -14 },
+    { 1, -8, 24, -51, 86, -121, 142, -129, 61, 84, -321, 662, -1112, 1698, -2549, 4584, 13994, -504, -548, 836, -854, 741, -567, 382, -217, 91, -9, -33, 46, -40, 27, -14 },
+    { 1, -8, 25, -51, 86, -120, 141, -127, 59, 87, -325, 665, -1114, 1696, -2539, 4545, 14008, -477, -562, 844, -859, 743, -567, 381, -216, 89, -8, -34, 46, -40, 27, -14 },
+    { 1, -8, 25, -51, 86, -120, 140, -126, 56, 90, -328, 667, -1115, 1694, -2529, 4505, 14022, -450, -577, 853, -863, 744, -567, 380, -214, 88, -7, -35, 46, -40, 27, -14 },
+    { 1, -8, 25, -51, 86, -120, 139, -124, 54, 92, -331, 670, -1117, 1692, -2518, 4466, 14036, -424, -592, 861, -868, 746, -567, 379, -213, 87, -6, -35, 47, -40, 27, -14 },
+    { 1, -8, 25, -51, 86, -119, 138, -123, 52, 95, -334, 673, -1118, 1690, -2508, 4427, 14049, -396, -606, 870, -872, 748, -567, 378, -212, 86, -5, -36, 47, -41, 27, -14 },
+    { 1, -9, 25, -51, 86, -119, 137, -121, 50, 98, -337, 676, -1119, 1688, -2498, 4388, 14062, -369, -621, 878, -876, 749, -567, 377, -210, 84, -4, -37, 48, -41, 27, -14 },
+    { 1, -9, 25, -52, 85, -119, 136, -120, 48, 101, -340, 679, -1120, 1685, -2488, 4348, 14076, -342, -636, 886, -881, 751, -567, 376, -209, 83, -3, -38, 48, -41, 27, -14 },
+    { 1, -9, 25, -52, 85, -118, 136, -118, 45, 104, -343, 681, -1122, 1683, -2477, 4309, 14089, -315, -651, 895, -885, 753, -567, 375, -208, 82, -2, -38, 48, -41, 27, -14 },
+    { 1, -9, 25, -52, 85, -118, 135, -117, 43, 107, -347, 684, -1123, 1681, -2467, 4270, 14101, -287, -665, 903, -889, 754, -567, 374, -206, 81, -1, -39, 49, -41, 27, -14 },
+    { 1, -9, 25, -52, 85, -117, 134, -115, 41, 109, -350, 687, -1124, 1678, -2456, 4231, 14114, -259, -680, 911, -893, 756, -567, 373, -205, 79, 1, -40, 49, -41, 27, -14 },
+    { 1, -9, 25, -52, 85, -117, 133, -114, 39, 112, -353, 689, -1125, 1676, -2445, 4192, 14127, -232, -695, 920, -898, 757, -567, 372, -204, 78, 2, -40, 50, -42, 27, -14 },
+    { 1, -9, 26, -52, 85, -117, 132, -112, 37, 115, -356, 692, -1126, 1673, -2435, 4153, 14139, -204, -710, 928, -902, 759, -566, 371, -202, 77, 3, -41, 50, -42, 27, -14 },
+    { 1, -9, 26, -52, 85, -116, 131, -111, 34, 118, -359, 694, -1127, 1670, -2424, 4114, 14151, -176, -725, 936, -906, 760, -566, 370, -201, 75, 4, -42, 50, -42, 27, -14 },
+    { 2, -9, 26, -52, 85, -116, 130, -109, 32, 120, -362, 697, -1128, 1668, -2413, 4075, 14163, -147, -739, 944, -910, 761, -566, 369, -200, 74, 5, -43, 51, -42, 27, -14 },
+    { 2, -9, 26, -52, 85, -115, 129, -108, 30, 123, -365, 699, -1129, 1665, -2402, 4037, 14174, -119, -754, 953, -914, 763, -566, 368, -198, 73, 6, -43, 51, -42, 28, -14 },
+    { 2, -9, 26, -52, 85, -115, 129, -106, 28, 126, -368, 702, -1129, 1662, -2391, 3998, 14186, -91, -769, 961, -918, 764, -565, 366, -197, 71, 7, -44, 52, -43, 28, -14 },
+    { 2, -9, 26, -52, 84, -114, 128, -105, 26, 129, -370, 704, -1130, 1659, -2380, 3959, 14197, -62, -784, 969, -922, 766, -565, 365, -195, 70, 8, -45, 52, -43, 28, -14 },
+    { 2, -10, 26, -52, 84, -114, 127, -103, 23, 131, -373, 707, -1131, 1656, -2369, 3920, 14208, -34, -799, 977, -926, 767, -565, 364, -194, 69, 9, -45, 52, -43, 28, -14 },
+    { 2, -10, 26, -52, 84, -114, 126, -102, 21, 134, -376, 709, -1132, 1653, -2358, 3882, 14219, -5, -813, 985, -930, 768, -564, 363, -192, 67, 10, -46, 53, -43, 28, -14 },
+    { 2, -10, 26, -52, 84, -113, 125, -100, 19, 137, -379, 711, -1132, 1650, -2346, 3843, 14230, 24, -828, 993, -934, 769, -564, 362, -191, 66, 11, -47, 53, -43, 28, -14 },
+    { 2, -10, 26, -52, 84, -113, 124, -99, 17, 139, -382, 714, -1133, 1647, -2335, 3805, 14241, 53, -843, 1001, -938, 771, -564, 360, -189, 65, 12, -47, 54, -43, 28, -14 },
+    { 2, -10, 26, -52, 84, -112, 123, -97, 15, 142, -385, 716, -1133, 1644, -2324, 3766, 14251, 82, -858, 1009, -942, 772, -563, 359, -188, 63, 13, -48, 54, -44, 28, -14 },
+    { 2, -10, 26, -52, 84, -112, 122, -96, 13, 145, -388, 718, -1134, 1640, -2312, 3728, 14261, 111, -873, 1017, -946, 773, -563, 358, -186, 62, 14, -49, 54, -44, 28, -14 },
+    { 2, -10, 27, -52, 84, -111, 121, -94, 10, 148, -390, 720, -1134, 1637, -2301, 3689, 14271, 141, -888, 1025, -949, 774, -562, 357, -185, 61, 15, -49, 55, -44, 28, -14 },
+    { 2, -10, 27, -52, 83, -111, 120, -93, 8, 150, -393, 723, -1135, 1634, -2289, 3651, 14281, 170, -902, 1033, -953, 775, -562, 355, -183, 59, 16, -50, 55, -44, 28, -14 },
+    { 2, -10, 27, -52, 83, -110, 119, -91, 6, 153, -396, 725, -1135, 1630, -2277, 3613, 14291, 200, -917, 1041, -957, 776, -561, 354, -182, 58, 17, -51, 56, -44, 28, -14 },
+    { 2, -10, 27, -52, 83, -110, 118, -90, 4, 155, -399, 727, -1135, 1627, -2266, 3574, 14300, 230, -932, 1049, -961, 777, -561, 353, -180, 56, 18, -52, 56, -45, 28, -14 },
+    { 2, -10, 27, -52, 83, -109, 117, -88, 2, 158, -401, 729, -1136, 1623, -2254, 3536, 14309, 259, -947, 1057, -964, 778, -560, 351, -179, 55, 19, -52, 56, -45, 28, -14 },
+    { 2, -10, 27, -52, 83, -109, 116, -87, 0, 161, -404, 731, -1136, 1620, -2242, 3498, 14319, 289, -962, 1065, -968, 779, -559, 350, -177, 54, 20, -53, 57, -45, 28, -14 },
+    { 2, -10, 27, -52, 83, -109, 116, -85, -3, 163, -407, 733, -1136, 1616, -2230, 3460, 14327, 319, -976, 1073, -971, 780, -559, 349, -176, 52, 21, -54, 57, -45, 28, -14 },
+    { 2, -10, 27, -52, 82, -108, 115, -83, -5, 166, -409, 735, -1136, 1612, -2218, 3422, 14336, 349, -991, 1080, -975, 781, -558, 347, -174, 51, 23, -54, 57, -45, 28, -14 },
+    { 2, -11, 27, -52, 82, -108, 114, -82, -7, 169, -412, 737, -1136, 1608, -2206, 3384, 14345, 380, -1006, 1088, -979, 782, -558, 346, -173, 49, 24, -55, 58, -45, 28, -14 },
+    { 2, -11, 27, -52, 82, -107, 113, -80, -9, 171, -415, 739, -1136, 1604, -2194, 3346, 14353, 410, -1021, 1096, -982, 783, -557, 344, -171, 48, 25, -56, 58, -45, 28, -14 },
+    { 2, -11, 27, -52, 82, -107, 112, -79, -11, 174, -417, 741, -1136, 1600, -2182, 3308, 14361, 441, -1036, 1103, -985, 784, -556, 343, -169, 47, 26, -56, 59, -46, 28, -14 },
+    { 2, -11, 27, -52, 82, -106, 111, -77, -13, 176, -420, 743, -1136, 1597, -2170, 3271, 14369, 471, -1050, 1111, -989, 784, -555, 342, -168, 45, 27, -57, 59, -46, 28, -14 },
+    { 2, -11, 27, -52, 82, -106, 110, -76, -15, 179, -422, 744, -1136, 1592, -2158, 3233, 14377, 502, -1065, 1119, -992, 785, -555, 340, -166, 44, 28, -58, 59, -46, 28, -14 },
+    { 2, -11, 27, -52, 81, -105, 109, -74, -17, 181, -425, 746, -1136, 1588, -2145, 3195, 14384, 533, -1080, 1126, -996, 786, -554, 339, -165, 42, 29, -58, 60, -46, 29, -14 },
+    { 3, -11, 28, -52, 81, -105, 108, -73, -20, 184, -427, 748, -1136, 1584, -2133, 3158, 14392, 564, -1095, 1134, -999, 787, -553, 337, -163, 41, 30, -59, 60, -46, 29, -14 },
+    { 3, -11, 28, -52, 81, -104, 107, -71, -22, 186, -430, 750, -1135, 1580, -2121, 3120, 14399, 595, -1109, 1141, -1002, 787, -552, 336, -161, 40, 31, -60, 60, -46, 29, -14 },
+    { 3, -11, 28, -52, 81, -104, 106, -70, -24, 189, -432, 751, -1135, 1576, -2108, 3083, 14406, 626, -1124, 1149, -1005, 788, -551, 334, -160, 38, 32, -60, 61, -47, 29, -14 },
+    { 3, -11, 28, -52, 81, -103, 105, -68, -26, 191, -435, 753, -1135, 1571, -2096, 3045, 14413, 657, -1139, 1156, -1009, 788, -550, 333, -158, 37, 33, -61, 61, -47, 29, -14 },
+    { 3, -11, 28, -52, 80, -103, 104, -66, -28, 194, -437, 755, -1134, 1567, -2083, 3008, 14419, 689, -1154, 1164, -1012, 789, -550, 331, -156, 35, 34, -62, 62, -47, 29, -14 },
+    { 3, -11, 28, -52, 80, -102, 103, -65, -30, 196, -440, 756, -1134, 1563, -2070, 2970, 14426, 720, -1168, 1171, -1015, 790, -549, 329, -155, 34, 35, -63, 62, -47, 29, -14 },
+    { 3, -11, 28, -52, 80, -102, 102, -63, -32, 199, -442, 758, -1134, 1558, -2058, 2933, 14432, 752, -1183, 1178, -1018, 790, -548, 328, -153, 32, 36, -63, 62, -47, 29, -14 },
+    { 3, -11, 28, -52, 80, -101, 101, -62, -34, 201, -444, 759, -1133, 1554, -2045, 2896, 14438, 783, -1198, 1186, -1021, 791, -547, 326, -151, 31, 37, -64, 63, -47, 29, -14 },
+    { 3, -11, 28, -52, 80, -100, 100, -60, -36, 204, -447, 761, -1132, 1549, -2032, 2859, 14444, 815, -1212, 1193, -1024, 791, -546, 325, -150, 29, 38, -65, 63, -47, 29, -14 },
+    { 3, -11, 28, -52, 79, -100, 99, -59, -39, 206, -449, 762, -1132, 1544, -2019, 2822, 14449, 847, -1227, 1200, -1027, 791, -545, 323, -148, 28, 39, -65, 63, -48, 29, -14 },
+    { 3, -12, 28, -52, 79, -99, 98, -57, -41, 208, -451, 764, -1131, 1540, -2007, 2785, 14455, 879, -1242, 1208, -1030, 792, -544, 321, -146, 27, 41, -66, 64, -48, 29, -14 },
+    { 3, -12, 28, -52, 79, -99, 97, -56, -43, 211, -454, 765, -1130, 1535, -1994, 2748, 14460, 911, -1256, 1215, -1033, 792, -543, 320, -144, 25, 42, -67, 64, -48, 29, -14 },
+    { 3, -12, 28, -52, 79, -98, 96, -54, -45, 213, -456, 766, -1130, 1530, -1981, 2711, 14465, 944, -1271, 1222, -1036, 792, -542, 318, -143, 24, 43, -67, 64, -48, 29, -14 },
+    { 3, -12, 28, -52, 79, -98, 95, -53, -47, 216, -458, 768, -1129, 1525, -1968, 2675, 14470, 976, -1285, 1229, -1039, 793, -540, 316, -141, 22, 44, -68, 65, -48, 29, -14 },
+    { 3, -12, 28, -52, 78, -97, 94, -51, -49, 218, -460, 769, -1128, 1520, -1955, 2638, 14474, 1008, -1300, 1236, -1042, 793, -539, 315, -139, 21, 45, -69, 65, -48, 29, -13 },
+    { 3, -12, 28, -52, 78, -97, 93, -49, -51, 220, -462, 770, -1127, 1515, -1942, 2601, 14479, 1041, -1314, 1243, -1044, 793, -538, 313, -137, 19, 46, -69, 65, -48, 29, -13 },
+    { 3, -12, 28, -52, 78, -96, 92, -48, -53, 223, -465, 771, -1126, 1510, -1928, 2565, 14483, 1073, -1329, 1250, -1047, 793, -537, 311, -136, 18, 47, -70, 66, -48, 29, -13 },
+    { 3, -12, 28, -52, 78, -96, 91, -46, -55, 225, -467, 773, -1125, 1505, -1915, 2528, 14487, 1106, -1344, 1257, -1050, 794, -536, 309, -134, 16, 48, -70, 66, -49, 29, -13 },
+    { 3, -12, 28, -52, 77, -95, 90, -45, -57, 227, -469, 774, -1124, 1500, -1902, 2492, 14491, 1139, -1358, 1264, -1052, 794, -535, 308, -132, 15, 49, -71, 66, -49, 29, -13 },
+    { 3, -12, 28, -52, 77, -94, 89, -43, -59, 230, -471, 775, -1123, 1495, -1889, 2456, 14495, 1172, -1372, 1271, -1055, 794, -533, 306, -130, 13, 50, -72, 67, -49, 29, -13 },
+    { 3, -12, 29, -52, 77, -94, 88, -42, -61, 232, -473, 776, -1122, 1490, -1875, 2420, 14498, 1205, -1387, 1278, -1058, 794, -532, 304, -129, 12, 51, -72, 67, -49, 29, -13 },
+    { 3, -12, 29, -52, 77, -93, 87, -40, -63, 234, -475, 777, -1121, 1485, -1862, 2383, 14502, 1238, -1401, 1284, -1060, 794, -531, 302, -127, 10, 52, -73, 67, -49, 29, -13 },
+    { 3, -12, 29, -52, 76, -93, 86, -39, -65, 237, -477, 778, -1120, 1479, -1849, 2347, 14505, 1271, -1416, 1291, -1063, 794, -529, 300, -125, 9, 53, -74, 68, -49, 29, -13 },
+    { 3, -12, 29, -52, 76, -92, 85, -37, -67, 239, -479, 779, -1119, 1474, -1835, 2311, 14508, 1305, -1430, 1298, -1065, 794, -528, 298, -123, 7, 54, -74, 68, -49, 29, -13 },
+    { 3, -12, 29, -52, 76, -92, 84, -35, -69, 241, -481, 780, -1117, 1468, -1822, 2275, 14510, 1338, -1445, 1305, -1068, 794, -527, 297, -121, 6, 55, -75, 68, -49, 29, -13 },
+    { 3, -12, 29, -52, 76, -91, 83, -34, -71, 243, -483, 781, -1116, 1463, -1808, 2240, 14513, 1372, -1459, 1311, -1070, 794, -525, 295, -119, 4, 57, -76, 69, -49, 29, -13 },
+    { 3, -12, 29, -51, 75, -90, 82, -32, -73, 245, -485, 782, -1115, 1458, -1795, 2204, 14515, 1405, -1473, 1318, -1072, 794, -524, 293, -118, 3, 58, -76, 69, -50, 29, -13 },
+    { 3, -12, 29, -51, 75, -90, 81, -31, -75, 248, -487, 783, -1113, 1452, -1781, 2168, 14517, 1439, -1488, 1324, -1075, 794, -522, 291, -116, 1, 59, -77, 69, -50, 29, -13 },
+    { 3, -12, 29, -51, 75, -89, 80, -29, -77, 250, -489, 784, -1112, 1446, -1767, 2133, 14519, 1473, -1502, 1331, -1077, 793, -521, 289, -114, 0, 60, -78, 70, -50, 29, -13 },
+    { 3, -12, 29, -51, 75, -89, 79, -28, -79, 252, -491, 784, -1111, 1441, -1754, 2097, 14521, 1507, -1516, 1337, -1079, 793, -520, 287, -112, -2, 61, -78, 70, -50, 29, -13 },
+    { 3, -12, 29, -51, 74, -88, 78, -26, -81, 254, -493, 785, -1109, 1435, -1740, 2062, 14523, 1541, -1530, 1344, -1081, 793, -518, 285, -110, -3, 62, -79, 70, -50, 29, -13 },
+    { 4, -13, 29, -51, 74, -87, 77, -25, -83, 256, -495, 786, -1107, 1429, -1726, 2026, 14524, 1575, -1544, 1350, -1083, 793, -517, 283, -108, -5, 63, -79, 70, -50, 29, -13 },
+    { 4, -13, 29, -51, 74, -87, 75, -23, -85, 259, -496, 787, -1106, 1423, -1712, 1991, 14525, 1609, -1559, 1357, -1085, 792, -515, 281, -106, -6, 64, -80, 71, -50, 29, -13 },
+    { 4, -13, 29, -51, 74, -86, 74, -22, -87, 261, -498, 787, -1104, 1418, -1699, 1956, 14526, 1643, -1573, 1363, -1087, 792, -513, 279, -104, -8, 65, -81, 71, -50, 29, -13 },
+    { 4, -13, 29, -51, 73, -86, 73, -20, -89, 263, -500, 788, -1102, 1412, -1685, 1921, 14527, 1678, -1587, 1369, -1090, 792, -512, 277, -103, -9, 66, -81, 71, -50, 29, -13 },
+    { 4, -13, 29, -51, 73, -85, 72, -19, -91, 265, -502, 789, -1101, 1406, -1671, 1886, 14528, 1712, -1601, 1375, -1091, 791, -510, 275, -101, -11, 67, -82, 72, -50, 29, -13 },
+    { 4, -13, 29, -51, 73, -84, 71, -17, -93, 267, -503, 789, -1099, 1400, -1657, 1851, 14528, 1747, -1615, 1381, -1093, 791, -509, 273, -99, -12, 68, -83, 72, -51, 29, -13 },
+    { 4, -13, 29, -51, 72, -84, 70, -15, -95, 269, -505, 790, -1097, 1394, -1643, 1816, 14528, 1781, -1629, 1388, -1095, 790, -507, 271, -97, -14, 69, -83, 72, -51, 29, -13 },
+};
+
+/* 48000 -> 44100 Hz, up 147 down 160, passband to 16613 Hz */
+static const int16_t s_phases_48000_44100[147][RESAMPLER_TAPS] = {
+    { 4, -23, 51, -69, 50, 31, -171, 325, -402, 295, 76, -718, 1534, -2342, 2916, 13197, 3009, -2366, 1531, -705, 63, 305, -406, 325, -169, 28, 52, -70, 51, -23, 4, 2 },
+    { 4, -23, 50, -68, 48, 34, -174, 325, -398, 286, 90, -731, 1537, -2319, 2823, 13195, 3103, -2389, 1528, -692, 49, 314, -410, 324, -166, 25, 54, -71, 51, -23, 4, 2 },
+    { 5, -23, 50, -67, 46, 37, -176, 325, -394, 276, 103, -743, 1539, -2294, 2730, 13193, 3197, -2411, 1524, -678, 35, 324, -414, 324, -163, 22, 56, -72, 51, -22, 3, 3 },
+    { 5, -24, 50, -66, 44, 39, -178, 325, -390, 267, 117, -755, 1541, -2269, 2638, 13189, 3292, -2433, 1520, -664, 21, 333, -418, 323, -161, 19, 58, -72, 51, -22, 3, 3 },
+    { 5, -24, 50, -65, 42, 42, -181, 325, -385, 257, 130, -767, 1542, -2244, 2547, 13184, 3387, -2454, 1515, -650, 7, 342, -421, 322, -158, 16, 60, -73, 51, -22, 3, 3 },
+    { 5, -24, 50, -64, 40, 45, -183, 325, -380, 247, 144, -779, 1542, -2218, 2456, 13177, 3482, -2474, 1509, -636, -7, 352, -425, 321, -155, 13, 62, -74, 51, -21, 3, 3 },
+    { 6, -24, 50, -63, 38, 47, -185, 325, -376, 237, 157, -790, 1542, -2191, 2365, 13169, 3577, -2494, 1504, -621, -21, 361, -428, 321, -152, 11, 64, -75, 51, -21, 2, 3 },
+    { 6, -24, 50, -62, 36, 50, -187, 324, -371, 227, 170, -801, 1542, -2165, 2275, 13160, 3673, -2514, 1497, -606, -35, 370, -432, 320, -149, 8, 66, -76, 51, -21, 2, 3 },
+    { 6, -25, 49, -61, 34, 53, -189, 324, -366, 218, 183, -812, 1541, -2137, 2185, 13149, 3769, -2533, 1490, -591, -49, 379, -435, 318, -146, 5, 68, -76, 51, -21, 2, 3 },
+    { 6, -25, 49, -60, 32, 55, -191, 323, -361, 208, 196, -823, 1540, -2110, 2096, 13138, 3866, -2551, 1483, -576, -64, 388, -438, 317, -143, 2, 69, -77, 51, -20, 2, 3 },
+    { 6, -25, 49, -59, 30, 58, -193, 323, -356, 198, 208, -833, 1539, -2081, 2007, 13125, 3963, -2568, 1475, -560, -78, 397, -441, 316, -140, -2, 71, -78, 51, -20, 1, 4 },
+    { 7, -25, 49, -58, 28, 61, -195, 322, -351, 188, 221, -843, 1536, -2053, 1919, 13110, 4060, -2585, 1467, -545, -92, 405, -443, 314, -136, -5, 73, -78, 51, -20, 1, 4 },
+    { 7, -25, 48, -57, 26, 63, -197, 321, -346, 178, 233, -852, 1534, -2024, 1832, 13094, 4157, -2602, 1458, -529, -107, 414, -446, 313, -133, -8, 75, -79, 50, -19, 1, 4 },
+    { 7, -25, 48, -56, 24, 66, -199, 320, -341, 168, 246, -862, 1531, -1994, 1745, 13077, 4254, -2617, 1449, -512, -121, 423, -449, 311, -130, -11, 77, -80, 50, -19, 0, 4 },
+    { 7, -25, 48, -55, 22, 68, -200, 319, -335, 158, 258, -871, 1527, -1965, 1659, 13059, 4352, -2632, 1439, -496, -135, 431, -451, 310, -126, -14, 79, -80, 50, -18, 0, 4 },
+    { 7, -26, 48, -54, 20, 70, -202, 318, -330, 148, 270, -879, 1523, -1934, 1573, 13039, 4450, -2646, 1429, -479, -150, 440, -453, 308, -123, -17, 81, -81, 50, -18, 0, 4 },
+    { 7, -26, 47, -53, 18, 73, -203, 317, -324, 138, 282, -888, 1519, -1904, 1488, 13019, 4548, -2660, 1418, -462, -164, 448, -456, 306, -120, -20, 83, -82, 50, -18, 0, 4 },
+    { 8, -26, 47, -52, 16, 75, -205, 315, -319, 128, 294, -896, 1514, -1873, 1403, 12996, 4646, -2673, 1407, -445, -179, 456, -458, 304, -116, -23, 84, -82, 50, -17, -1, 5 },
+    { 8, -26, 47, -51, 14, 78, -206, 314, -313, 118, 306, -903, 1509, -1842, 1319, 12973, 4744, -2685, 1396, -427, -193, 464, -460, 302, -112, -26, 86, -83, 50, -17, -1, 5 },
+    { 8, -26, 46, -50, 12, 80, -207, 313, -308, 108, 317, -911, 1504, -1810, 1236, 12948, 4843, -2696, 1383, -410, -208, 472, -461, 299, -109, -29, 88, -83, 49, -16, -1, 5 },
+    { 8, -26, 46, -48, 10, 82, -209, 311, -302, 98, 329, -918, 1498, -1778, 1154, 12922, 4942, -2707, 1371, -392, -222, 480, -463, 297, -105, -32, 90, -84, 49, -16, -2, 5 },
+    { 8, -26, 45, -47, 8, 84, -210, 309, -296, 89, 340, -925, 1491, -1746, 1072, 12895, 5040, -2717, 1358, -374, -237, 488, -465, 295, -101, -36, 91, -84, 49, -16, -2, 5 },
+    { 8, -26, 45, -46, 6, 87, -211, 308, -290, 79, 351, -932, 1484, -1714, 990, 12866, 5139, -2727, 1344, -356, -251, 496, -466, 292, -98, -39, 93, -85, 49, -15, -2, 5 },
+    { 9, -26, 45, -45, 4, 89, -212, 306, -284, 69, 362, -938, 1477, -1681, 910, 12837, 5238, -2735, 1330, -337, -265, 503, -467, 290, -94, -42, 95, -85, 48, -15, -3, 5 },
+    { 9, -26, 44, -44, 2, 91, -213, 304, -278, 59, 373, -944, 1469, -1648, 830, 12806, 5337, -2743, 1315, -319, -280, 511, -468, 287, -90, -45, 97, -85, 48, -14, -3, 5 },
+    { 9, -26, 44, -43, 0, 93, -214, 302, -272, 49, 384, -949, 1461, -1614, 751, 12773, 5436, -2750, 1300, -300, -294, 518, -469, 284, -86, -48, 98, -86, 48, -14, -3, 6 },
+    { 9, -26, 43, -41, -2, 95, -215, 300, -266, 39, 394, -955, 1453, -1581, 672, 12740, 5535, -2756, 1285, -281, -309, 525, -470, 281, -82, -51, 100, -86, 47, -13, -4, 6 },
+    { 9, -26, 43, -40, -4, 97, -215, 298, -259, 29, 405, -960, 1444, -1547, 595, 12705, 5634, -2762, 1269, -262, -323, 532, -471, 278, -78, -54, 102, -86, 47, -13, -4, 6 },
+    { 9, -26, 43, -39, -6, 99, -216, 295, -253, 19, 415, -964, 1435, -1513, 518, 12669, 5733, -2766, 1252, -243, -337, 539, -471, 275, -74, -58, 103, -87, 47, -12, -4, 6 },
+    { 9, -26, 42, -38, -8, 101, -217, 293, -247, 10, 425, -969, 1425, -1479, 441, 12632, 5832, -2770, 1235, -223, -351, 546, -472, 272, -70, -61, 105, -87, 46, -12, -4, 6 },
+    { 10, -26, 42, -37, -9, 103, -217, 291, -240, 0, 435, -973, 1415, -1444, 366, 12594, 5931, -2773, 1218, -204, -366, 552, -472, 268, -66, -64, 106, -87, 46, -11, -5, 6 },
+    { 10, -26, 41, -35, -11, 105, -218, 288, -234, -10, 445, -977, 1405, -1410, 291, 12554, 6030, -2776, 1200, -184, -380, 559, -472, 265, -62, -67, 108, -88, 45, -11, -5, 6 },
+    { 10, -26, 41, -34, -13, 106, -218, 286, -228, -19, 454, -980, 1394, -1375, 217, 12513, 6129, -2777, 1182, -164, -394, 565, -472, 262, -57, -70, 109, -88, 45, -10, -5, 7 },
+    { 10, -26, 40, -33, -15, 108, -219, 283, -221, -29, 464, -983, 1383, -1340, 144, 12471, 6228, -2778, 1163, -144, -408, 571, -472, 258, -53, -73, 111, -88, 45, -10, -6, 7 },
+    { 10, -26, 40, -32, -17, 110, -219, 280, -215, -38, 473, -986, 1372, -1305, 72, 12428, 6326, -2778, 1144, -124, -422, 577, -472, 254, -49, -76, 112, -88, 44, -9, -6, 7 },
+    { 10, -26, 39, -31, -19, 112, -219, 278, -208, -48, 482, -989, 1360, -1269, 0, 12384, 6425, -2777, 1124, -103, -436, 583, -471, 251, -45, -80, 114, -88, 44, -9, -6, 7 },
+    { 10, -26, 39, -29, -20, 113, -219, 275, -201, -57, 491, -991, 1348, -1234, -71, 12338, 6523, -2775, 1104, -83, -450, 589, -471, 247, -40, -83, 115, -88, 43, -8, -7, 7 },
+    { 10, -26, 38, -28, -22, 115, -219, 272, -195, -67, 499, -993, 1335, -1198, -141, 12291, 6622, -2772, 1084, -62, -463, 595, -470, 243, -36, -86, 116, -88, 43, -8, -7, 7 },
+    { 10, -26, 38, -27, -24, 116, -219, 269, -188, -76, 508, -995, 1322, -1162, -210, 12243, 6720, -2768, 1062, -42, -477, 600, -469, 239, -31, -89, 118, -88, 42, -7, -7, 7 },
+    { 10, -26, 37, -26, -26, 118, -219, 266, -181, -85, 516, -996, 1309, -1126, -278, 12194, 6818, -2764, 1041, -21, -491, 605, -468, 235, -27, -92, 119, -88, 41, -7, -8, 7 },
+    { 10, -25, 36, -25, -27, 119, -219, 263, -175, -95, 524, -997, 1296, -1090, -346, 12144, 6915, -2759, 1019, 0, -504, 611, -467, 230, -23, -95, 120, -88, 41, -6, -8, 8 },
+    { 11, -25, 36, -23, -29, 121, -219, 260, -168, -104, 532, -998, 1282, -1054, -412, 12093, 7013, -2753, 997, 21, -518, 616, -466, 226, -18, -98, 122, -88, 40, -5, -8, 8 },
+    { 11, -25, 35, -22, -31, 122, -219, 256, -161, -113, 540, -998, 1268, -1018, -478, 12041, 7110, -2745, 974, 42, -531, 620, -464, 222, -14, -101, 123, -88, 40, -5, -9, 8 },
+    { 11, -25, 35, -21, -33, 123, -218, 253, -154, -122, 547, -998, 1253, -982, -543, 11987, 7207, -2738, 951, 63, -544, 625, -463, 217, -9, -104, 124, -88, 39, -4, -9, 8 },
+    { 11, -25, 34, -20, -34, 125, -218, 250, -147, -131, 555, -998, 1239, -946, -607, 11933, 7304, -2729, 927, 84, -557, 629, -461, 213, -5, -107, 125, -88, 38, -4, -9, 8 },
+    { 11, -25, 34, -18, -36, 126, -218, 246, -140, -140, 562, -998, 1224, -910, -671, 11877, 7400, -2719, 903, 106, -570, 634, -459, 208, 0, -110, 126, -88, 38, -3, -10, 8 },
+    { 11, -25, 33, -17, -37, 127, -217, 243, -134, -148, 569, -997, 1208, -873, -733, 11820, 7496, -2708, 879, 127, -583, 638, -457, 203, 5, -113, 127, -88, 37, -2, -10, 8 },
+    { 11, -25, 32, -16, -39, 128, -216, 239, -127, -157, 575, -996, 1193, -837, -794, 11762, 7592, -2697, 854, 149, -596, 642, -455, 198, 9, -116, 128, -88, 36, -2, -10, 8 },
+    { 11, -24, 32, -15, -41, 129, -216, 236, -120, -166, 582, -994, 1177, -800, -855, 11704, 7688, -2684, 829, 170, -608, 646, -453, 194, 14, -119, 129, -87, 36, -1, -11, 8 },
+    { 11, -24, 31, -14, -42, 131, -215, 232, -113, -174, 588, -993, 1161, -764, -915, 11644, 7783, -2671, 803, 192, -621, 649, -450, 189, 18, -121, 130, -87, 35, -1, -11, 9 },
+    { 11, -24, 30, -12, -44, 132, -214, 228, -106, -183, 594, -991, 1144, -728, -973, 11583, 7878, -2657, 777, 213, -633, 653, -448, 184, 23, -124, 131, -87, 34, 0, -11, 9 },
+    { 11, -24, 30, -11, -45, 133, -214, 224, -99, -191, 600, -989, 1128, -691, -1031, 11521, 7972, -2642, 751, 235, -646, 656, -445, 178, 28, -127, 132, -86, 34, 1, -12, 9 },
+    { 11, -24, 29, -10, -47, 133, -213, 221, -92, -199, 606, -986, 1111, -655, -1088, 11458, 8066, -2626, 724, 257, -658, 659, -442, 173, 32, -130, 133, -86, 33, 1, -12, 9 },
+    { 11, -24, 29, -9, -48, 134, -212, 217, -85, -207, 611, -983, 1094, -619, -1144, 11394, 8160, -2609, 697, 278, -670, 662, -439, 168, 37, -133, 134, -86, 32, 2, -12, 9 },
+    { 11, -23, 28, -8, -50, 135, -211, 213, -78, -216, 617, -980, 1076, -583, -1199, 11329, 8253, -2591, 669, 300, -681, 664, -436, 163, 42, -136, 135, -85, 31, 3, -13, 9 },
+    { 11, -23, 27, -6, -51, 136, -210, 209, -72, -224, 622, -977, 1059, -546, -1254, 11263, 8346, -2572, 641, 322, -693, 667, -432, 157, 47, -138, 136, -85, 30, 3, -13, 9 },
+    { 11, -23, 27, -5, -52, 137, -209, 205, -65, -231, 627, -973, 1041, -510, -1307, 11196, 8438, -2552, 613, 344, -704, 669, -429, 152, 51, -141, 136, -84, 30, 4, -13, 9 },
+    { 11, -23, 26, -4, -54, 137, -207, 201, -58, -239, 631, -969, 1023, -474, -1359, 11128, 8530, -2531, 584, 365, -716, 671, -425, 146, 56, -144, 137, -84, 29, 4, -14, 9 },
+    { 11, -23, 25, -3, -55, 138, -206, 197, -51, -247, 636, -965, 1004, -438, -1411, 11059, 8621, -2509, 555, 387, -727, 673, -422, 141, 61, -146, 138, -83, 28, 5, -14, 10 },
+    { 11, -22, 25, -2, -56, 139, -205, 193, -44, -254, 640, -961, 986, -402, -1461, 10990, 8712, -2487, 526, 409, -738, 675, -418, 135, 65, -149, 138, -83, 27, 6, -14, 10 },
+    { 11, -22, 24, -1, -58, 139, -204, 188, -37, -262, 644, -956, 967, -367, -1511, 10919, 8803, -2463, 497, 431, -749, 676, -414, 129, 70, -151, 139, -82, 26, 6, -15, 10 },
+    { 11, -22, 23, 1, -59, 140, -202, 184, -30, -269, 648, -951, 948, -331, -1559, 10847, 8892, -2438, 467, 452, -759, 678, -409, 123, 75, -154, 139, -82, 25, 7, -15, 10 },
+    { 11, -22, 23, 2, -60, 140, -201, 180, -24, -277, 652, -946, 929, -296, -1607, 10775, 8982, -2413, 436, 474, -770, 679, -405, 118, 80, -156, 140, -81, 24, 8, -15, 10 },
+    { 11, -21, 22, 3, -61, 141, -199, 176, -17, -284, 655, -940, 910, -260, -1654, 10701, 9070, -2386, 406, 496, -780, 680, -401, 112, 84, -159, 140, -80, 24, 8, -16, 10 },
+    { 11, -21, 21, 4, -63, 141, -198, 171, -10, -291, 658, -934, 890, -225, -1700, 10627, 9158, -2359, 375, 517, -790, 681, -396, 106, 89, -161, 141, -80, 23, 9, -16, 10 },
+    { 11, -21, 21, 5, -64, 142, -196, 167, -3, -298, 661, -928, 871, -190, -1744, 10552, 9246, -2330, 344, 539, -800, 681, -391, 100, 94, -164, 141, -79, 22, 10, -16, 10 },
+    { 11, -21, 20, 6, -65, 142, -194, 162, 3, -304, 664, -922, 851, -155, -1788, 10476, 9333, -2301, 312, 560, -810, 681, -386, 93, 98, -166, 142, -78, 21, 10, -17, 10 },
+    { 11, -20, 19, 7, -66, 142, -193, 158, 10, -311, 667, -916, 831, -120, -1831, 10399, 9419, -2271, 280, 581, -819, 681, -381, 87, 103, -168, 142, -78, 20, 11, -17, 10 },
+    { 11, -20, 19, 8, -67, 142, -191, 154, 17, -318, 669, -909, 811, -86, -1873, 10322, 9505, -2239, 248, 603, -828, 681, -376, 81, 108, -171, 142, -77, 19, 12, -17, 10 },
+    { 11, -20, 18, 9, -68, 143, -189, 149, 23, -324, 671, -902, 790, -51, -1914, 10244, 9589, -2207, 216, 624, -837, 681, -371, 75, 112, -173, 142, -76, 18, 13, -18, 10 },
+    { 11, -20, 17, 11, -69, 143, -187, 145, 30, -330, 673, -894, 770, -17, -1954, 10164, 9674, -2174, 183, 645, -846, 681, -366, 69, 117, -175, 143, -75, 17, 13, -18, 10 },
+    { 11, -19, 17, 12, -70, 143, -185, 140, 36, -337, 675, -887, 750, 17, -1993, 10084, 9757, -2140, 151, 666, -855, 680, -360, 62, 122, -177, 143, -74, 16, 14, -18, 11 },
+    { 11, -19, 16, 13, -71, 143, -183, 135, 43, -343, 677, -879, 729, 51, -2031, 10004, 9840, -2104, 118, 687, -863, 679, -354, 56, 126, -179, 143, -73, 15, 15, -18, 11 },
+    { 11, -19, 15, 14, -72, 143, -181, 131, 49, -349, 678, -871, 708, 84, -2068, 9922, 9922, -2068, 84, 708, -871, 678, -349, 49, 131, -181, 143, -72, 14, 15, -19, 11 },
+    { 11, -18, 15, 15, -73, 143, -179, 126, 56, -354, 679, -863, 687, 118, -2104, 9840, 10004, -2031, 51, 729, -879, 677, -343, 43, 135, -183, 143, -71, 13, 16, -19, 11 },
+    { 11, -18, 14, 16, -74, 143, -177, 122, 62, -360, 680, -855, 666, 151, -2140, 9757, 10084, -1993, 17, 750, -887, 675, -337, 36, 140, -185, 143, -70, 12, 17, -19, 11 },
+    { 10, -18, 13, 17, -75, 143, -175, 117, 69, -366, 681, -846, 645, 183, -2174, 9674, 10164, -1954, -17, 770, -894, 673, -330, 30, 145, -187, 143, -69, 11, 17, -20, 11 },
+    { 10, -18, 13, 18, -76, 142, -173, 112, 75, -371, 681, -837, 624, 216, -2207, 9589, 10244, -1914, -51, 790, -902, 671, -324, 23, 149, -189, 143, -68, 9, 18, -20, 11 },
+    { 10, -17, 12, 19, -77, 142, -171, 108, 81, -376, 681, -828, 603, 248, -2239, 9505, 10322, -1873, -86, 811, -909, 669, -318, 17, 154, -191, 142, -67, 8, 19, -20, 11 },
+    { 10, -17, 11, 20, -78, 142, -168, 103, 87, -381, 681, -819, 581, 280, -2271, 9419, 10399, -1831, -120, 831, -916, 667, -311, 10, 158, -193, 142, -66, 7, 19, -20, 11 },
+    { 10, -17, 10, 21, -78, 142, -166, 98, 93, -386, 681, -810, 560, 312, -2301, 9333, 10476, -1788, -155, 851, -922, 664, -304, 3, 162, -194, 142, -65, 6, 20, -21, 11 },
+    { 10, -16, 10, 22, -79, 141, -164, 94, 100, -391, 681, -800, 539, 344, -2330, 9246, 10552, -1744, -190, 871, -928, 661, -298, -3, 167, -196, 142, -64, 5, 21, -21, 11 },
+    { 10, -16, 9, 23, -80, 141, -161, 89, 106, -396, 681, -790, 517, 375, -2359, 9158, 10627, -1700, -225, 890, -934, 658, -291, -10, 171, -198, 141, -63, 4, 21, -21, 11 },
+    { 10, -16, 8, 24, -80, 140, -159, 84, 112, -401, 680, -780, 496, 406, -2386, 9070, 10701, -1654, -260, 910, -940, 655, -284, -17, 176, -199, 141, -61, 3, 22, -21, 11 },
+    { 10, -15, 8, 24, -81, 140, -156, 80, 118, -405, 679, -770, 474, 436, -2413, 8982, 10775, -1607, -296, 929, -946, 652, -277, -24, 180, -201, 140, -60, 2, 23, -22, 11 },
+    { 10, -15, 7, 25, -82, 139, -154, 75, 123, -409, 678, -759, 452, 467, -2438, 8892, 10847, -1559, -331, 948, -951, 648, -269, -30, 184, -202, 140, -59, 1, 23, -22, 11 },
+    { 10, -15, 6, 26, -82, 139, -151, 70, 129, -414, 676, -749, 431, 497, -2463, 8803, 10919, -1511, -367, 967, -956, 644, -262, -37, 188, -204, 139, -58, -1, 24, -22, 11 },
+    { 10, -14, 6, 27, -83, 138, -149, 65, 135, -418, 675, -738, 409, 526, -2487, 8712, 10990, -1461, -402, 986, -961, 640, -254, -44, 193, -205, 139, -56, -2, 25, -22, 11 },
+    { 10, -14, 5, 28, -83, 138, -146, 61, 141, -422, 673, -727, 387, 555, -2509, 8621, 11059, -1411, -438, 1004, -965, 636, -247, -51, 197, -206, 138, -55, -3, 25, -23, 11 },
+    { 9, -14, 4, 29, -84, 137, -144, 56, 146, -425, 671, -716, 365, 584, -2531, 8530, 11128, -1359, -474, 1023, -969, 631, -239, -58, 201, -207, 137, -54, -4, 26, -23, 11 },
+    { 9, -13, 4, 30, -84, 136, -141, 51, 152, -429, 669, -704, 344, 613, -2552, 8438, 11196, -1307, -510, 1041, -973, 627, -231, -65, 205, -209, 137, -52, -5, 27, -23, 11 },
+    { 9, -13, 3, 30, -85, 136, -138, 47, 157, -432, 667, -693, 322, 641, -2572, 8346, 11263, -1254, -546, 1059, -977, 622, -224, -72, 209, -210, 136, -51, -6, 27, -23, 11 },
+    { 9, -13, 3, 31, -85, 135, -136, 42, 163, -436, 664, -681, 300, 669, -2591, 8253, 11329, -1199, -583, 1076, -980, 617, -216, -78, 213, -211, 135, -50, -8, 28, -23, 11 },
+    { 9, -12, 2, 32, -86, 134, -133, 37, 168, -439, 662, -670, 278, 697, -2609, 8160, 11394, -1144, -619, 1094, -983, 611, -207, -85, 217, -212, 134, -48, -9, 29, -24, 11 },
+    { 9, -12, 1, 33, -86, 133, -130, 32, 173, -442, 659, -658, 257, 724, -2626, 8066, 11458, -1088, -655, 1111, -986, 606, -199, -92, 221, -213, 133, -47, -10, 29, -24, 11 },
+    { 9, -12, 1, 34, -86, 132, -127, 28, 178, -445, 656, -646, 235, 751, -2642, 7972, 11521, -1031, -691, 1128, -989, 600, -191, -99, 224, -214, 133, -45, -11, 30, -24, 11 },
+    { 9, -11, 0, 34, -87, 131, -124, 23, 184, -448, 653, -633, 213, 777, -2657, 7878, 11583, -973, -728, 1144, -991, 594, -183, -106, 228, -214, 132, -44, -12, 30, -24, 11 },
+    { 9, -11, -1, 35, -87, 130, -121, 18, 189, -450, 649, -621, 192, 803, -2671, 7783, 11644, -915, -764, 1161, -993, 588, -174, -113, 232, -215, 131, -42, -14, 31, -24, 11 },
+    { 8, -11, -1, 36, -87, 129, -119, 14, 194, -453, 646, -608, 170, 829, -2684, 7688, 11704, -855, -800, 1177, -994, 582, -166, -120, 236, -216, 129, -41, -15, 32, -24, 11 },
+    { 8, -10, -2, 36, -88, 128, -116, 9, 198, -455, 642, -596, 149, 854, -2697, 7592, 11762, -794, -837, 1193, -996, 575, -157, -127, 239, -216, 128, -39, -16, 32, -25, 11 },
+    { 8, -10, -2, 37, -88, 127, -113, 5, 203, -457, 638, -583, 127, 879, -2708, 7496, 11820, -733, -873, 1208, -997, 569, -148, -134, 243, -217, 127, -37, -17, 33, -25, 11 },
+    { 8, -10, -3, 38, -88, 126, -110, 0, 208, -459, 634, -570, 106, 903, -2719, 7400, 11877, -671, -910, 1224, -998, 562, -140, -140, 246, -218, 126, -36, -18, 34, -25, 11 },
+    { 8, -9, -4, 38, -88, 125, -107, -5, 213, -461, 629, -557, 84, 927, -2729, 7304, 11933, -607, -946, 1239, -998, 555, -131, -147, 250, -218, 125, -34, -20, 34, -25, 11 },
+    { 8, -9, -4, 39, -88, 124, -104, -9, 217, -463, 625, -544, 63, 951, -2738, 7207, 11987, -543, -982, 1253, -998, 547, -122, -154, 253, -218, 123, -33, -21, 35, -25, 11 },
+    { 8, -9, -5, 40, -88, 123, -101, -14, 222, -464, 620, -531, 42, 974, -2745, 7110, 12041, -478, -1018, 1268, -998, 540, -113, -161, 256, -219, 122, -31, -22, 35, -25, 11 },
+    { 8, -8, -5, 40, -88, 122, -98, -18, 226, -466, 616, -518, 21, 997, -2753, 7013, 12093, -412, -1054, 1282, -998, 532, -104, -168, 260, -219, 121, -29, -23, 36, -25, 11 },
+    { 8, -8, -6, 41, -88, 120, -95, -23, 230, -467, 611, -504, 0, 1019, -2759, 6915, 12144, -346, -1090, 1296, -997, 524, -95, -175, 263, -219, 119, -27, -25, 36, -25, 10 },
+    { 7, -8, -7, 41, -88, 119, -92, -27, 235, -468, 605, -491, -21, 1041, -2764, 6818, 12194, -278, -1126, 1309, -996, 516, -85, -181, 266, -219, 118, -26, -26, 37, -26, 10 },
+    { 7, -7, -7, 42, -88, 118, -89, -31, 239, -469, 600, -477, -42, 1062, -2768, 6720, 12243, -210, -1162, 1322, -995, 508, -76, -188, 269, -219, 116, -24, -27, 38, -26, 10 },
+    { 7, -7, -8, 43, -88, 116, -86, -36, 243, -470, 595, -463, -62, 1084, -2772, 6622, 12291, -141, -1198, 1335, -993, 499, -67, -195, 272, -219, 115, -22, -28, 38, -26, 10 },
+    { 7, -7, -8, 43, -88, 115, -83, -40, 247, -471, 589, -450, -83, 1104, -2775, 6523, 12338, -71, -1234, 1348, -991, 491, -57, -201, 275, -219, 113, -20, -29, 39, -26, 10 },
+    { 7, -6, -9, 44, -88, 114, -80, -45, 251, -471, 583, -436, -103, 1124, -2777, 6425, 12384, 0, -1269, 1360, -989, 482, -48, -208, 278, -219, 112, -19, -31, 39, -26, 10 },
+    { 7, -6, -9, 44, -88, 112, -76, -49, 254, -472, 577, -422, -124, 1144, -2778, 6326, 12428, 72, -1305, 1372, -986, 473, -38, -215, 280, -219, 110, -17, -32, 40, -26, 10 },
+    { 7, -6, -10, 45, -88, 111, -73, -53, 258, -472, 571, -408, -144, 1163, -2778, 6228, 12471, 144, -1340, 1383, -983, 464, -29, -221, 283, -219, 108, -15, -33, 40, -26, 10 },
+    { 7, -5, -10, 45, -88, 109, -70, -57, 262, -472, 565, -394, -164, 1182, -2777, 6129, 12513, 217, -1375, 1394, -980, 454, -19, -228, 286, -218, 106, -13, -34, 41, -26, 10 },
+    { 6, -5, -11, 45, -88, 108, -67, -62, 265, -472, 559, -380, -184, 1200, -2776, 6030, 12554, 291, -1410, 1405, -977, 445, -10, -234, 288, -218, 105, -11, -35, 41, -26, 10 },
+    { 6, -5, -11, 46, -87, 106, -64, -66, 268, -472, 552, -366, -204, 1218, -2773, 5931, 12594, 366, -1444, 1415, -973, 435, 0, -240, 291, -217, 103, -9, -37, 42, -26, 10 },
+    { 6, -4, -12, 46, -87, 105, -61, -70, 272, -472, 546, -351, -223, 1235, -2770, 5832, 12632, 441, -1479, 1425, -969, 425, 10, -247, 293, -217, 101, -8, -38, 42, -26, 9 },
+    { 6, -4, -12, 47, -87, 103, -58, -74, 275, -471, 539, -337, -243, 1252, -2766, 5733, 12669, 518, -1513, 1435, -964, 415, 19, -253, 295, -216, 99, -6, -39, 43, -26, 9 },
+    { 6, -4, -13, 47, -86, 102, -54, -78, 278, -471, 532, -323, -262, 1269, -2762, 5634, 12705, 595, -1547, 1444, -960, 405, 29, -259, 298, -215, 97, -4, -40, 43, -26, 9 },
+    { 6, -4, -13, 47, -86, 100, -51, -82, 281, -470, 525, -309, -281, 1285, -2756, 5535, 12740, 672, -1581, 1453, -955, 394, 39, -266, 300, -215, 95, -2, -41, 43, -26, 9 },
+    { 6, -3, -14, 48, -86, 98, -48, -86, 284, -469, 518, -294, -300, 1300, -2750, 5436, 12773, 751, -1614, 1461, -949, 384, 49, -272, 302, -214, 93, 0, -43, 44, -26, 9 },
+    { 5, -3, -14, 48, -85, 97, -45, -90, 287, -468, 511, -280, -319, 1315, -2743, 5337, 12806, 830, -1648, 1469, -944, 373, 59, -278, 304, -213, 91, 2, -44, 44, -26, 9 },
+    { 5, -3, -15, 48, -85, 95, -42, -94, 290, -467, 503, -265, -337, 1330, -2735, 5238, 12837, 910, -1681, 1477, -938, 362, 69, -284, 306, -212, 89, 4, -45, 45, -26, 9 },
+    { 5, -2, -15, 49, -85, 93, -39, -98, 292, -466, 496, -251, -356, 1344, -2727, 5139, 12866, 990, -1714, 1484, -932, 351, 79, -290, 308, -211, 87, 6, -46, 45, -26, 8 },
+    { 5, -2, -16, 49, -84, 91, -36, -101, 295, -465, 488, -237, -374, 1358, -2717, 5040, 12895, 1072, -1746, 1491, -925, 340, 89, -296, 309, -210, 84, 8, -47, 45, -26, 8 },
+    { 5, -2, -16, 49, -84, 90, -32, -105, 297, -463, 480, -222, -392, 1371, -2707, 4942, 12922, 1154, -1778, 1498, -918, 329, 98, -302, 311, -209, 82, 10, -48, 46, -26, 8 },
+    { 5, -1, -16, 49, -83, 88, -29, -109, 299, -461, 472, -208, -410, 1383, -2696, 4843, 12948, 1236, -1810, 1504, -911, 317, 108, -308, 313, -207, 80, 12, -50, 46, -26, 8 },
+    { 5, -1, -17, 50, -83, 86, -26, -112, 302, -460, 464, -193, -427, 1396, -2685, 4744, 12973, 1319, -1842, 1509, -903, 306, 118, -313, 314, -206, 78, 14, -51, 47, -26, 8 },
+    { 5, -1, -17, 50, -82, 84, -23, -116, 304, -458, 456, -179, -445, 1407, -2673, 4646, 12996, 1403, -1873, 1514, -896, 294, 128, -319, 315, -205, 75, 16, -52, 47, -26, 8 },
+    { 4, 0, -18, 50, -82, 83, -20, -120, 306, -456, 448, -164, -462, 1418, -2660, 4548, 13019, 1488, -1904, 1519, -888, 282, 138, -324, 317, -203, 73, 18, -53, 47, -26, 7 },
+    { 4, 0, -18, 50, -81, 81, -17, -123, 308, -453, 440, -150, -479, 1429, -2646, 4450, 13039, 1573, -1934, 1523, -879, 270, 148, -330, 318, -202, 70, 20, -54, 48, -26, 7 },
+    { 4, 0, -18, 50, -80, 79, -14, -126, 310, -451, 431, -135, -496, 1439, -2632, 4352, 13059, 1659, -1965, 1527, -871, 258, 158, -335, 319, -200, 68, 22, -55, 48, -25, 7 },
+    { 4, 0, -19, 50, -80, 77, -11, -130, 311, -449, 423, -121, -512, 1449, -2617, 4254, 13077, 1745, -1994, 1531, -862, 246, 168, -341, 320, -199, 66, 24, -56, 48, -25, 7 },
+    { 4, 1, -19, 50, -79, 75, -8, -133, 313, -446, 414, -107, -529, 1458, -2602, 4157, 13094, 1832, -2024, 1534, -852, 233, 178, -346, 321, -197, 63, 26, -57, 48, -25, 7 },
+    { 4, 1, -20, 51, -78, 73, -5, -136, 314, -443, 405, -92, -545, 1467, -2585, 4060, 13110, 1919, -2053, 1536, -843, 221, 188, -351, 322, -195, 61, 28, -58, 49, -25, 7 },
+    { 4, 1, -20, 51, -78, 71, -2, -140, 316, -441, 397, -78, -560, 1475, -2568, 3963, 13125, 2007, -2081, 1539, -833, 208, 198, -356, 323, -193, 58, 30, -59, 49, -25, 6 },
+    { 3, 2, -20, 51, -77, 69, 2, -143, 317, -438, 388, -64, -576, 1483, -2551, 3866, 13138, 2096, -2110, 1540, -823, 196, 208, -361, 323, -191, 55, 32, -60, 49, -25, 6 },
+    { 3, 2, -21, 51, -76, 68, 5, -146, 318, -435, 379, -49, -591, 1490, -2533, 3769, 13149, 2185, -2137, 1541, -812, 183, 218, -366, 324, -189, 53, 34, -61, 49, -25, 6 },
+    { 3, 2, -21, 51, -76, 66, 8, -149, 320, -432, 370, -35, -606, 1497, -2514, 3673, 13160, 2275, -2165, 1542, -801, 170, 227, -371, 324, -187, 50, 36, -62, 50, -24, 6 },
+    { 3, 2, -21, 51, -75, 64, 11, -152, 321, -428, 361, -21, -621, 1504, -2494, 3577, 13169, 2365, -2191, 1542, -790, 157, 237, -376, 325, -185, 47, 38, -63, 50, -24, 6 },
+    { 3, 3, -21, 51, -74, 62, 13, -155, 321, -425, 352, -7, -636, 1509, -2474, 3482, 13177, 2456, -2218, 1542, -779, 144, 247, -380, 325, -183, 45, 40, -64, 50, -24, 5 },
+    { 3, 3, -22, 51, -73, 60, 16, -158, 322, -421, 342, 7, -650, 1515, -2454, 3387, 13184, 2547, -2244, 1542, -767, 130, 257, -385, 325, -181, 42, 42, -65, 50, -24, 5 },
+    { 3, 3, -22, 51, -72, 58, 19, -161, 323, -418, 333, 21, -664, 1520, -2433, 3292, 13189, 2638, -2269, 1541, -755, 117, 267, -390, 325, -178, 39, 44, -66, 50, -24, 5 },
+    { 3, 3, -22, 51, -72, 56, 22, -163, 324, -414, 324, 35, -678, 1524, -2411, 3197, 13193, 2730, -2294, 1539, -743, 103, 276, -394, 325, -176, 37, 46, -67, 50, -23, 5 },
+    { 2, 4, -23, 51, -71, 54, 25, -166, 324, -410, 314, 49, -692, 1528, -2389, 3103, 13195, 2823, -2319, 1537, -731, 90, 286, -398, 325, -174, 34, 48, -68, 50, -23, 4 },
+    { 2, 4, -23, 51, -70, 52, 28, -169, 325, -406, 305, 63, -705, 1531, -2366, 3009, 13197, 2916, -2342, 1534, -718, 76, 295, -402, 325, -171, 31, 50, -69, 51, -23, 4 },
+};
+
+/* 22050 -> 48000 Hz, up 320 down 147, passband to 8527 Hz */
+static const int16_t s_phases_22050_48000[320][RESAMPLER_TAPS] = {
+    { -13, 29, -51, 72, -83, 69, -14, -97, 271, -507, 790, -1095, 1386, -1626, 1775, 14528, 1823, -1646, 1395, -1098, 790, -505, 269, -95, -16, 70, -84, 73, -51, 29, -13, 4 },
+    { -13, 29, -50, 72, -82, 68, -12, -100, 274, -509, 791, -1092, 1378, -1607, 1727, 14528, 1871, -1665, 1403, -1100, 789, -503, 266, -92, -18, 72, -85, 73, -51, 29, -13, 4 },
+    { -13, 29, -50, 71, -81, 66, -9, -102, 277, -512, 792, -1090, 1369, -1588, 1680, 14527, 1919, -1684, 1411, -1102, 788, -500, 263, -89, -20, 73, -86, 73, -51, 29, -13, 4 },
+    { -13, 29, -50, 71, -81, 65, -7, -105, 280, -514, 792, -1087, 1361, -1568, 1632, 14526, 1967, -1703, 1419, -1105, 787, -498, 260, -86, -22, 75, -86, 74, -51, 29, -13, 4 },
+    { -13, 29, -50, 71, -80, 63, -5, -108, 283, -516, 793, -1084, 1352, -1549, 1585, 14524, 2016, -1722, 1427, -1107, 786, -495, 257, -84, -24, 76, -87, 74, -51, 29, -13, 4 },
+    { -13, 29, -50, 70, -79, 62, -3, -110, 285, -518, 793, -1081, 1343, -1529, 1538, 14523, 2065, -1741, 1435, -1109, 785, -493, 254, -81, -26, 78, -88, 74, -51, 29, -12, 3 },
+    { -13, 29, -50, 70, -78, 60, -1, -113, 288, -520, 793, -1078, 1334, -1510, 1491, 14520, 2113, -1760, 1443, -1111, 784, -490, 251, -78, -28, 79, -89, 75, -51, 29, -12, 3 },
+    { -13, 29, -50, 69, -77, 59, 1, -115, 291, -522, 794, -1075, 1325, -1490, 1445, 14518, 2162, -1779, 1451, -1113, 783, -487, 248, -76, -31, 80, -90, 75, -51, 29, -12, 3 },
+    { -13, 29, -50, 69, -76, 57, 3, -118, 293, -524, 794, -1072, 1316, -1470, 1398, 14515, 2212, -1797, 1459, -1115, 782, -485, 245, -73, -33, 82, -91, 76, -52, 29, -12, 3 },
+    { -13, 29, -49, 68, -75, 56, 5, -120, 296, -526, 794, -1068, 1307, -1450, 1352, 14511, 2261, -1816, 1466, -1117, 781, -482, 242, -70, -35, 83, -91, 76, -52, 29, -12, 3 },
+    { -13, 29, -49, 68, -74, 54, 7, -123, 298, -528, 794, -1065, 1298, -1431, 1306, 14508, 2310, -1835, 1474, -1119, 779, -479, 239, -67, -37, 85, -92, 76, -52, 29, -12, 3 },
+    { -13, 29, -49, 68, -74, 53, 9, -126, 301, -530, 794, -1062, 1289, -1411, 1260, 14504, 2360, -1853, 1481, -1120, 778, -477, 236, -65, -39, 86, -93, 77, -52, 29, -12, 3 },
+    { -13, 29, -49, 67, -73, 51, 11, -128, 303, -532, 794, -1058, 1280, -1391, 1214, 14499, 2410, -1872, 1488, -1122, 776, -474, 233, -62, -41, 88, -94, 77, -52, 29, -12, 3 },
+    { -13, 29, -49, 67, -72, 50, 13, -130, 306, -533, 794, -1055, 1270, -1371, 1169, 14494, 2460, -1890, 1496, -1123, 775, -471, 229, -59, -43, 89, -94, 77, -52, 28, -12, 3 },
+    { -13, 29, -49, 66, -71, 49, 15, -133, 308, -535, 794, -1051, 1261, -1351, 1123, 14489, 2510, -1908, 1503, -1125, 773, -468, 226, -56, -45, 90, -95, 78, -52, 28, -12, 3 },
+    { -13, 29, -48, 66, -70, 47, 17, -135, 311, -537, 793, -1047, 1251, -1331, 1078, 14484, 2560, -1927, 1510, -1126, 772, -465, 223, -53, -48, 92, -96, 78, -52, 28, -12, 3 },
+    { -13, 29, -48, 65, -69, 46, 20, -138, 313, -538, 793, -1044, 1241, -1311, 1033, 14478, 2610, -1945, 1517, -1127, 770, -462, 220, -50, -50, 93, -97, 78, -52, 28, -12, 3 },
+    { -13, 29, -48, 65, -68, 44, 22, -140, 316, -540, 793, -1040, 1232, -1291, 988, 14472, 2661, -1963, 1523, -1129, 768, -459, 217, -48, -52, 95, -98, 78, -52, 28, -12, 3 },
+    { -14, 29, -48, 64, -67, 43, 24, -143, 318, -542, 792, -1036, 1222, -1271, 944, 14465, 2711, -1981, 1530, -1130, 766, -456, 213, -45, -54, 96, -98, 79, -52, 28, -12, 3 },
+    { -14, 29, -48, 64, -66, 41, 26, -145, 320, -543, 792, -1032, 1212, -1251, 899, 14458, 2762, -1998, 1537, -1131, 764, -453, 210, -42, -56, 97, -99, 79, -52, 28, -12, 3 },
+    { -14, 29, -48, 63, -65, 40, 28, -147, 323, -544, 792, -1028, 1202, -1231, 855, 14451, 2813, -2016, 1543, -1132, 763, -450, 207, -39, -58, 99, -100, 79, -52, 28, -11, 3 },
+    { -14, 29, -47, 63, -64, 38, 30, -150, 325, -546, 791, -1024, 1192, -1210, 811, 14443, 2864, -2034, 1550, -1133, 761, -446, 203, -36, -60, 100, -101, 80, -52, 28, -11, 3 },
+    { -14, 29, -47, 62, -64, 37, 32, -152, 327, -547, 790, -1020, 1182, -1190, 767, 14435, 2915, -2051, 1556, -1133, 758, -443, 200, -33, -63, 101, -101, 80, -52, 28, -11, 3 },
+    { -14, 29, -47, 62, -63, 35, 34, -154, 329, -549, 790, -1015, 1172, -1170, 724, 14426, 2966, -2069, 1562, -1134, 756, -440, 197, -30, -65, 103, -102, 80, -52, 28, -11, 3 },
+    { -14, 29, -47, 61, -62, 34, 36, -157, 331, -550, 789, -1011, 1162, -1150, 680, 14417, 3018, -2086, 1568, -1134, 754, -437, 193, -27, -67, 104, -103, 81, -52, 28, -11, 3 },
+    { -14, 29, -47, 61, -61, 32, 38, -159, 334, -551, 788, -1007, 1152, -1129, 637, 14408, 3069, -2104, 1574, -1135, 752, -433, 190, -25, -69, 106, -103, 81, -52, 28, -11, 3 },
+    { -14, 29, -46, 60, -60, 31, 40, -161, 336, -552, 787, -1002, 1141, -1109, 594, 14399, 3121, -2121, 1580, -1135, 750, -430, 186, -22, -71, 107, -104, 81, -52, 28, -11, 3 },
+    { -14, 29, -46, 60, -59, 29, 42, -164, 338, -553, 786, -998, 1131, -1089, 551, 14389, 3172, -2138, 1586, -1136, 747, -426, 183, -19, -73, 108, -105, 81, -52, 28, -11, 2 },
+    { -14, 28, -46, 59, -58, 28, 44, -166, 340, -554, 785, -993, 1120, -1068, 509, 14378, 3224, -2155, 1592, -1136, 745, -423, 179, -16, -75, 110, -106, 82, -52, 27, -11, 2 },
+    { -14, 28, -46, 59, -57, 27, 45, -168, 342, -555, 784, -988, 1110, -1048, 467, 14368, 3276, -2172, 1597, -1136, 742, -419, 176, -13, -78, 111, -106, 82, -52, 27, -11, 2 },
+    { -14, 28, -46, 58, -56, 25, 47, -170, 344, -556, 783, -984, 1099, -1028, 424, 14357, 3328, -2188, 1603, -1136, 740, -416, 172, -10, -80, 112, -107, 82, -52, 27, -11, 2 },
+    { -14, 28, -45, 58, -55, 24, 49, -172, 346, -557, 782, -979, 1089, -1007, 382, 14345, 3381, -2205, 1608, -1136, 737, -412, 169, -7, -82, 114, -108, 82, -52, 27, -11, 2 },
+    { -14, 28, -45, 57, -54, 22, 51, -175, 348, -558, 781, -974, 1078, -987, 341, 14334, 3433, -2222, 1613, -1136, 734, -409, 165, -4, -84, 115, -108, 82, -52, 27, -10, 2 },
+    { -14, 28, -45, 57, -53, 21, 53, -177, 350, -559, 779, -969, 1067, -967, 299, 14322, 3485, -2238, 1618, -1136, 732, -405, 162, -1, -86, 116, -109, 83, -52, 27, -10, 2 },
+    { -14, 28, -45, 56, -52, 19, 55, -179, 351, -560, 778, -964, 1057, -946, 258, 14309, 3538, -2254, 1623, -1136, 729, -401, 158, 2, -88, 117, -110, 83, -52, 27, -10, 2 },
+    { -14, 28, -44, 56, -51, 18, 57, -181, 353, -561, 777, -959, 1046, -926, 217, 14296, 3591, -2271, 1628, -1135, 726, -397, 154, 5, -90, 119, -110, 83, -52, 27, -10, 2 },
+    { -14, 28, -44, 55, -50, 16, 59, -183, 355, -562, 775, -954, 1035, -905, 176, 14283, 3643, -2287, 1633, -1135, 723, -394, 151, 8, -92, 120, -111, 83, -52, 27, -10, 2 },
+    { -14, 28, -44, 55, -49, 15, 61, -185, 357, -562, 774, -949, 1024, -885, 135, 14270, 3696, -2303, 1638, -1134, 720, -390, 147, 11, -94, 121, -111, 84, -52, 27, -10, 2 },
+    { -14, 28, -44, 54, -48, 13, 63, -187, 359, -563, 772, -943, 1013, -864, 95, 14256, 3749, -2319, 1642, -1134, 717, -386, 143, 14, -97, 123, -112, 84, -52, 26, -10, 2 },
+    { -14, 28, -44, 54, -47, 12, 65, -189, 360, -563, 771, -938, 1002, -844, 55, 14241, 3802, -2334, 1647, -1133, 714, -382, 140, 17, -99, 124, -113, 84, -52, 26, -10, 2 },
+    { -14, 28, -43, 53, -46, 11, 66, -191, 362, -564, 769, -933, 991, -824, 15, 14227, 3855, -2350, 1651, -1132, 711, -378, 136, 20, -101, 125, -113, 84, -52, 26, -10, 2 },
+    { -14, 28, -43, 53, -46, 9, 68, -193, 364, -565, 767, -927, 980, -803, -25, 14212, 3909, -2365, 1655, -1131, 707, -374, 132, 23, -103, 126, -114, 84, -52, 26, -10, 2 },
+    { -14, 28, -43, 52, -45, 8, 70, -195, 365, -565, 765, -922, 968, -783, -64, 14196, 3962, -2381, 1659, -1130, 704, -370, 128, 26, -105, 128, -114, 84, -52, 26, -9, 2 },
+    { -14, 28, -43, 51, -44, 6, 72, -197, 367, -565, 764, -916, 957, -762, -103, 14181, 4015, -2396, 1663, -1129, 701, -366, 125, 29, -107, 129, -115, 85, -52, 26, -9, 2 },
+    { -14, 27, -42, 51, -43, 5, 74, -199, 368, -566, 762, -911, 946, -742, -143, 14165, 4069, -2411, 1667, -1128, 697, -362, 121, 32, -109, 130, -116, 85, -52, 26, -9, 2 },
+    { -14, 27, -42, 50, -42, 3, 76, -201, 370, -566, 760, -905, 935, -722, -181, 14148, 4122, -2426, 1671, -1127, 694, -358, 117, 35, -111, 131, -116, 85, -52, 26, -9, 1 },
+    { -14, 27, -42, 50, -41, 2, 77, -203, 372, -566, 758, -899, 923, -701, -220, 14132, 4176, -2441, 1675, -1125, 690, -354, 113, 38, -113, 133, -117, 85, -52, 25, -9, 1 },
+    { -14, 27, -41, 49, -40, 1, 79, -205, 373, -567, 756, -894, 912, -681, -258, 14115, 4230, -2456, 1678, -1124, 687, -350, 109, 41, -115, 134, -117, 85, -52, 25, -9, 1 },
+    { -14, 27, -41, 49, -39, -1, 81, -207, 374, -567, 754, -888, 900, -660, -296, 14097, 4283, -2470, 1682, -1122, 683, -345, 106, 44, -117, 135, -118, 85, -52, 25, -9, 1 },
+    { -14, 27, -41, 48, -38, -2, 83, -209, 376, -567, 751, -882, 889, -640, -334, 14079, 4337, -2485, 1685, -1121, 679, -341, 102, 47, -120, 136, -118, 85, -52, 25, -9, 1 },
+    { -14, 27, -41, 48, -37, -4, 85, -211, 377, -567, 749, -876, 877, -620, -372, 14061, 4391, -2499, 1688, -1119, 676, -337, 98, 50, -122, 137, -119, 86, -51, 25, -9, 1 },
+    { -14, 27, -40, 47, -36, -5, 86, -212, 379, -567, 747, -870, 866, -599, -409, 14043, 4445, -2513, 1691, -1117, 672, -333, 94, 53, -124, 139, -119, 86, -51, 25, -8, 1 },
+    { -14, 27, -40, 46, -35, -7, 88, -214, 380, -567, 745, -864, 854, -579, -446, 14024, 4499, -2527, 1694, -1115, 668, -328, 90, 56, -126, 140, -120, 86, -51, 25, -8, 1 },
+    { -14, 27, -40, 46, -34, -8, 90, -216, 381, -567, 742, -858, 842, -559, -483, 14005, 4554, -2541, 1697, -1113, 664, -324, 86, 59, -128, 141, -120, 86, -51, 24, -8, 1 },
+    { -14, 27, -40, 45, -33, -9, 92, -218, 382, -567, 740, -852, 831, -539, -520, 13985, 4608, -2555, 1699, -1111, 660, -319, 82, 62, -130, 142, -121, 86, -51, 24, -8, 1 },
+    { -14, 27, -39, 45, -32, -11, 93, -219, 384, -567, 737, -845, 819, -518, -557, 13965, 4662, -2568, 1702, -1109, 656, -315, 78, 65, -132, 143, -121, 86, -51, 24, -8, 1 },
+    { -14, 26, -39, 44, -31, -12, 95, -221, 385, -567, 735, -839, 807, -498, -593, 13945, 4716, -2582, 1704, -1107, 652, -311, 74, 68, -134, 144, -122, 86, -51, 24, -8, 1 },
+    { -14, 26, -39, 44, -30, -14, 97, -223, 386, -567, 732, -833, 795, -478, -629, 13925, 4771, -2595, 1707, -1105, 648, -306, 70, 71, -136, 145, -122, 86, -51, 24, -8, 1 },
+    { -14, 26, -38, 43, -29, -15, 98, -225, 387, -567, 730, -827, 784, -458, -664, 13904, 4825, -2608, 1709, -1102, 643, -302, 66, 74, -138, 147, -123, 86, -51, 24, -8, 1 },
+    { -14, 26, -38, 42, -28, -16, 100, -226, 388, -566, 727, -820, 772, -438, -700, 13882, 4880, -2621, 1711, -1100, 639, -297, 62, 77, -140, 148, -123, 86, -50, 24, -7, 1 },
+    { -14, 26, -38, 42, -27, -18, 102, -228, 389, -566, 724, -814, 760, -418, -735, 13861, 4934, -2634, 1713, -1097, 635, -292, 58, 80, -142, 149, -124, 86, -50, 23, -7, 1 },
+    { -14, 26, -38, 41, -26, -19, 103, -229, 390, -566, 721, -807, 748, -398, -770, 13839, 4989, -2647, 1715, -1094, 630, -288, 54, 83, -144, 150, -124, 86, -50, 23, -7, 0 },
+    { -14, 26, -37, 41, -25, -20, 105, -231, 391, -565, 719, -801, 736, -378, -805, 13817, 5044, -2659, 1716, -1092, 626, -283, 50, 86, -146, 151, -125, 86, -50, 23, -7, 0 },
+    { -14, 26, -37, 40, -24, -22, 107, -233, 392, -565, 716, -794, 724, -358, -839, 13794, 5098, -2672, 1718, -1089, 621, -278, 46, 89, -148, 152, -125, 86, -50, 23, -7, 0 },
+    { -14, 26, -37, 39, -23, -23, 108, -234, 393, -564, 713, -787, 712, -338, -874, 13771, 5153, -2684, 1719, -1086, 617, -274, 42, 92, -150, 153, -125, 86, -50, 23, -7, 0 },
+    { -14, 25, -36, 39, -22, -24, 110, -236, 394, -564, 710, -781, 700, -318, -908, 13748, 5208, -2696, 1721, -1083, 612, -269, 38, 95, -152, 154, -126, 87, -50, 22, -7, 0 },
+    { -13, 25, -36, 38, -21, -26, 111, -237, 395, -563, 707, -774, 688, -298, -941, 13724, 5263, -2708, 1722, -1080, 607, -264, 34, 99, -154, 155, -126, 87, -49, 22, -7, 0 },
+    { -13, 25, -36, 38, -20, -27, 113, -239, 396, -563, 704, -767, 676, -278, -975, 13700, 5318, -2719, 1723, -1076, 603, -259, 30, 102, -156, 156, -127, 87, -49, 22, -6, 0 },
+    { -13, 25, -35, 37, -19, -28, 115, -240, 397, -562, 701, -760, 664, -258, -1008, 13676, 5373, -2731, 1724, -1073, 598, -254, 26, 105, -158, 157, -127, 87, -49, 22, -6, 0 },
+    { -13, 25, -35, 36, -18, -30, 116, -242, 397, -561, 697, -753, 651, -238, -1041, 13651, 5427, -2742, 1724, -1070, 593, -250, 22, 108, -160, 158, -127, 87, -49, 22, -6, 0 },
+    { -13, 25, -35, 36, -17, -31, 118, -243, 398, -561, 694, -746, 639, -219, -1074, 13627, 5482, -2754, 1725, -1066, 588, -245, 18, 111, -161, 159, -128, 86, -49, 22, -6, 0 },
+    { -13, 25, -35, 35, -16, -32, 119, -244, 399, -560, 691, -739, 627, -199, -1106, 13601, 5537, -2765, 1726, -1063, 583, -240, 13, 114, -163, 160, -128, 86, -49, 21, -6, 0 },
+    { -13, 25, -34, 35, -15, -34, 121, -246, 399, -559, 688, -732, 615, -179, -1138, 13576, 5592, -2776, 1726, -1059, 578, -235, 9, 117, -165, 161, -128, 86, -48, 21, -6, 0 },
+    { -13, 24, -34, 34, -15, -35, 122, -247, 400, -558, 684, -725, 603, -160, -1170, 13550, 5647, -2786, 1726, -1055, 573, -230, 5, 120, -167, 162, -129, 86, -48, 21, -6, 0 },
+    { -13, 24, -34, 33, -14, -36, 124, -249, 401, -557, 681, -718, 591, -140, -1202, 13524, 5703, -2797, 1726, -1051, 568, -225, 1, 123, -169, 163, -129, 86, -48, 21, -5, 0 },
+    { -13, 24, -33, 33, -13, -38, 125, -250, 401, -556, 677, -711, 578, -121, -1234, 13497, 5758, -2807, 1726, -1047, 563, -220, -3, 126, -171, 164, -129, 86, -48, 21, -5, -1 },
+    { -13, 24, -33, 32, -12, -39, 127, -251, 402, -555, 674, -704, 566, -101, -1265, 13470, 5813, -2817, 1726, -1043, 557, -215, -7, 129, -173, 165, -130, 86, -48, 20, -5, -1 },
+    { -13, 24, -33, 32, -11, -40, 128, -252, 402, -554, 670, -697, 554, -82, -1296, 13443, 5868, -2827, 1726, -1039, 552, -210, -12, 132, -175, 166, -130, 86, -47, 20, -5, -1 },
+    { -13, 24, -32, 31, -10, -42, 130, -254, 403, -553, 667, -690, 541, -63, -1326, 13415, 5923, -2837, 1725, -1035, 547, -204, -16, 135, -177, 167, -130, 86, -47, 20, -5, -1 },
+    { -13, 24, -32, 30, -9, -43, 131, -255, 403, -552, 663, -682, 529, -43, -1357, 13388, 5978, -2847, 1725, -1031, 541, -199, -20, 138, -178, 168, -131, 86, -47, 20, -5, -1 },
+    { -13, 24, -32, 30, -8, -44, 132, -256, 404, -551, 659, -675, 517, -24, -1387, 13359, 6033, -2856, 1724, -1026, 536, -194, -24, 141, -180, 169, -131, 86, -47, 20, -5, -1 },
+    { -13, 23, -31, 29, -7, -45, 134, -257, 404, -550, 656, -668, 505, -5, -1417, 13331, 6088, -2866, 1723, -1022, 530, -189, -28, 144, -182, 170, -131, 86, -47, 19, -4, -1 },
+    { -13, 23, -31, 29, -6, -47, 135, -258, 404, -548, 652, -660, 492, 14, -1447, 13302, 6144, -2875, 1722, -1017, 525, -184, -32, 147, -184, 171, -131, 86, -46, 19, -4, -1 },
+    { -13, 23, -31, 28, -5, -48, 137, -260, 405, -547, 648, -653, 480, 33, -1476, 13273, 6199, -2884, 1721, -1013, 519, -179, -37, 150, -186, 171, -132, 86, -46, 19, -4, -1 },
+    { -13, 23, -30, 27, -4, -49, 138, -261, 405, -546, 644, -645, 468, 52, -1505, 13244, 6254, -2893, 1720, -1008, 514, -173, -41, 153, -187, 172, -132, 86, -46, 19, -4, -1 },
+    { -13, 23, -30, 27, -3, -50, 139, -262, 405, -545, 640, -638, 455, 71, -1534, 13214, 6309, -2901, 1719, -1003, 508, -168, -45, 156, -189, 173, -132, 85, -46, 18, -4, -1 },
+    { -13, 23, -30, 26, -2, -52, 141, -263, 406, -543, 636, -630, 443, 90, -1563, 13184, 6364, -2909, 1717, -998, 502, -163, -49, 158, -191, 174, -132, 85, -45, 18, -4, -1 },
+    { -13, 23, -29, 26, -1, -53, 142, -264, 406, -542, 632, -623, 430, 109, -1591, 13154, 6419, -2918, 1716, -993, 496, -157, -54, 161, -193, 175, -133, 85, -45, 18, -3, -1 },
+    { -13, 22, -29, 25, 0, -54, 143, -265, 406, -540, 628, -615, 418, 128, -1619, 13123, 6474, -2926, 1714, -988, 490, -152, -58, 164, -194, 176, -133, 85, -45, 18, -3, -2 },
+    { -13, 22, -29, 24, 1, -55, 145, -266, 406, -539, 624, -607, 406, 146, -1647, 13092, 6529, -2933, 1712, -983, 485, -147, -62, 167, -196, 176, -133, 85, -45, 18, -3, -2 },
+    { -13, 22, -28, 24, 2, -56, 146, -267, 406, -537, 620, -600, 393, 165, -1674, 13061, 6584, -2941, 1710, -978, 479, -141, -66, 170, -198, 177, -133, 85, -44, 17, -3, -2 },
+    { -13, 22, -28, 23, 3, -58, 147, -268, 406, -536, 616, -592, 381, 183, -1702, 13029, 6640, -2948, 1708, -973, 473, -136, -71, 173, -200, 178, -133, 85, -44, 17, -3, -2 },
+    { -12, 22, -28, 22, 3, -59, 148, -269, 406, -534, 612, -584, 369, 202, -1729, 12997, 6695, -2956, 1706, -967, 467, -130, -75, 176, -201, 179, -133, 84, -44, 17, -3, -2 },
+    { -12, 22, -27, 22, 4, -60, 150, -270, 406, -532, 608, -577, 356, 220, -1755, 12965, 6750, -2963, 1703, -962, 461, -125, -79, 179, -203, 179, -134, 84, -44, 17, -3, -2 },
+    { -12, 21, -27, 21, 5, -61, 151, -271, 406, -531, 603, -569, 344, 239, -1782, 12933, 6805, -2969, 1701, -956, 454, -119, -83, 182, -205, 180, -134, 84, -43, 16, -2, -2 },
+    { -12, 21, -27, 21, 6, -62, 152, -272, 406, -529, 599, -561, 331, 257, -1808, 12900, 6860, -2976, 1698, -950, 448, -114, -88, 185, -206, 181, -134, 84, -43, 16, -2, -2 },
+    { -12, 21, -26, 20, 7, -64, 153, -272, 406, -527, 595, -553, 319, 275, -1834, 12867, 6915, -2982, 1695, -945, 442, -108, -92, 188, -208, 182, -134, 84, -43, 16, -2, -2 },
+    { -12, 21, -26, 19, 8, -65, 154, -273, 406, -525, 590, -545, 307, 293, -1860, 12834, 6969, -2989, 1692, -939, 436, -103, -96, 190, -210, 182, -134, 83, -42, 16, -2, -2 },
+    { -12, 21, -26, 19, 9, -66, 156, -274, 406, -524, 586, -537, 294, 311, -1885, 12800, 7024, -2995, 1689, -933, 429, -97, -100, 193, -211, 183, -134, 83, -42, 15, -2, -2 },
+    { -12, 21, -25, 18, 10, -67, 157, -275, 406, -522, 582, -529, 282, 329, -1910, 12766, 7079, -3000, 1686, -927, 423, -92, -105, 196, -213, 184, -134, 83, -42, 15, -2, -2 },
+    { -12, 20, -25, 18, 11, -68, 158, -276, 406, -520, 577, -522, 270, 347, -1935, 12732, 7134, -3006, 1682, -921, 417, -86, -109, 199, -214, 184, -134, 83, -42, 15, -1, -3 },
+    { -12, 20, -25, 17, 12, -69, 159, -276, 405, -518, 573, -514, 257, 365, -1960, 12697, 7189, -3011, 1679, -915, 410, -81, -113, 202, -216, 185, -134, 83, -41, 15, -1, -3 },
+    { -12, 20, -24, 16, 13, -70, 160, -277, 405, -516, 568, -506, 245, 382, -1984, 12663, 7243, -3017, 1675, -908, 404, -75, -117, 205, -218, 186, -134, 82, -41, 14, -1, -3 },
+    { -12, 20, -24, 16, 14, -71, 161, -278, 405, -514, 564, -498, 233, 400, -2008, 12627, 7298, -3021, 1671, -902, 397, -69, -122, 207, -219, 186, -134, 82, -41, 14, -1, -3 },
+    { -12, 20, -23, 15, 14, -73, 162, -278, 404, -512, 559, -490, 220, 418, -2032, 12592, 7353, -3026, 1667, -896, 390, -64, -126, 210, -221, 187, -134, 82, -40, 14, -1, -3 },
+    { -12, 20, -23, 14, 15, -74, 163, -279, 404, -510, 554, -481, 208, 435, -2055, 12557, 7407, -3031, 1663, -889, 384, -58, -130, 213, -222, 188, -134, 82, -40, 13, -1, -3 },
+    { -12, 19, -23, 14, 16, -75, 164, -280, 404, -508, 550, -473, 196, 452, -2078, 12521, 7462, -3035, 1659, -882, 377, -52, -134, 216, -224, 188, -134, 81, -40, 13, 0, -3 },
+    { -12, 19, -22, 13, 17, -76, 166, -280, 403, -505, 545, -465, 183, 470, -2101, 12484, 7516, -3039, 1655, -876, 370, -47, -139, 219, -225, 189, -134, 81, -39, 13, 0, -3 },
+    { -12, 19, -22, 13, 18, -77, 167, -281, 403, -503, 540, -457, 171, 487, -2124, 12448, 7571, -3043, 1650, -869, 364, -41, -143, 221, -227, 189, -134, 81, -39, 13, 0, -3 },
+    { -12, 19, -22, 12, 19, -78, 168, -281, 402, -501, 535, -449, 159, 504, -2146, 12411, 7625, -3047, 1645, -862, 357, -35, -147, 224, -228, 190, -134, 81, -39, 12, 0, -3 },
+    { -11, 19, -21, 11, 20, -79, 169, -282, 402, -499, 531, -441, 147, 521, -2169, 12374, 7679, -3050, 1641, -855, 350, -30, -151, 227, -230, 190, -134, 80, -38, 12, 0, -3 },
+    { -11, 19, -21, 11, 21, -80, 170, -282, 401, -496, 526, -433, 135, 538, -2191, 12337, 7734, -3053, 1636, -848, 343, -24, -155, 229, -231, 191, -134, 80, -38, 12, 1, -3 },
+    { -11, 18, -21, 10, 21, -81, 171, -283, 401, -494, 521, -425, 122, 555, -2212, 12299, 7788, -3056, 1631, -841, 336, -18, -160, 232, -232, 191, -134, 80, -38, 12, 1, -4 },
+    { -11, 18, -20, 10, 22, -82, 171, -283, 400, -492, 516, -416, 110, 572, -2233, 12262, 7842, -3059, 1626, -834, 329, -12, -164, 235, -234, 192, -134, 79, -37, 11, 1, -4 },
+    { -11, 18, -20, 9, 23, -83, 172, -284, 400, -489, 511, -408, 98, 588, -2255, 12223, 7896, -3062, 1620, -827, 322, -6, -168, 238, -235, 192, -134, 79, -37, 11, 1, -4 },
+    { -11, 18, -20, 8, 24, -84, 173, -284, 399, -487, 506, -400, 86, 605, -2275, 12185, 7950, -3064, 1615, -819, 315, -1, -172, 240, -237, 193, -134, 79, -37, 11, 1, -4 },
+    { -11, 18, -19, 8, 25, -85, 174, -285, 398, -484, 501, -392, 74, 621, -2296, 12146, 8004, -3066, 1609, -812, 308, 5, -177, 243, -238, 193, -134, 78, -36, 10, 1, -4 },
+    { -11, 18, -19, 7, 26, -86, 175, -285, 397, -482, 496, -383, 62, 638, -2316, 12108, 8057, -3068, 1603, -805, 301, 11, -181, 245, -239, 194, -134, 78, -36, 10, 2, -4 },
+    { -11, 17, -18, 7, 27, -87, 176, -285, 397, -479, 491, -375, 50, 654, -2336, 12068, 8111, -3070, 1598, -797, 294, 17, -185, 248, -241, 194, -134, 78, -35, 10, 2, -4 },
+    { -11, 17, -18, 6, 27, -88, 177, -286, 396, -477, 486, -367, 38, 670, -2356, 12029, 8165, -3071, 1591, -789, 287, 23, -189, 251, -242, 194, -134, 77, -35, 10, 2, -4 },
+    { -11, 17, -18, 5, 28, -89, 178, -286, 395, -474, 481, -359, 26, 686, -2375, 11989, 8218, -3072, 1585, -782, 280, 28, -193, 253, -243, 195, -133, 77, -35, 9, 2, -4 },
+    { -11, 17, -17, 5, 29, -90, 179, -286, 394, -472, 476, -350, 14, 702, -2394, 11950, 8272, -3073, 1579, -774, 272, 34, -197, 256, -245, 195, -133, 77, -34, 9, 2, -4 },
+    { -11, 17, -17, 4, 30, -91, 179, -287, 393, -469, 470, -342, 2, 718, -2413, 11909, 8325, -3074, 1573, -766, 265, 40, -202, 258, -246, 196, -133, 76, -34, 9, 2, -4 },
+    { -11, 17, -17, 4, 31, -92, 180, -287, 393, -466, 465, -334, -10, 734, -2432, 11869, 8378, -3075, 1566, -758, 258, 46, -206, 261, -247, 196, -133, 76, -34, 8, 3, -5 },
+    { -10, 16, -16, 3, 31, -93, 181, -287, 392, -464, 460, -325, -22, 749, -2450, 11828, 8432, -3075, 1559, -750, 250, 52, -210, 264, -248, 196, -133, 75, -33, 8, 3, -5 },
+    { -10, 16, -16, 2, 32, -94, 182, -287, 391, -461, 455, -317, -34, 765, -2468, 11787, 8485, -3075, 1552, -742, 243, 58, -214, 266, -250, 197, -133, 75, -33, 8, 3, -5 },
+    { -10, 16, -16, 2, 33, -95, 182, -287, 390, -458, 450, -309, -46, 780, -2486, 11746, 8538, -3075, 1545, -734, 235, 64, -218, 269, -251, 197, -132, 75, -32, 7, 3, -5 },
+    { -10, 16, -15, 1, 34, -96, 183, -288, 389, -455, 444, -300, -58, 796, -2504, 11705, 8590, -3074, 1538, -726, 228, 70, -222, 271, -252, 197, -132, 74, -32, 7, 3, -5 },
+    { -10, 16, -15, 1, 35, -96, 184, -288, 388, -452, 439, -292, -70, 811, -2521, 11663, 8643, -3074, 1531, -717, 221, 75, -226, 274, -253, 197, -132, 74, -32, 7, 4, -5 },
+    { -10, 15, -15, 0, 35, -97, 185, -288, 387, -449, 434, -283, -81, 826, -2538, 11621, 8696, -3073, 1524, -709, 213, 81, -231, 276, -254, 198, -132, 73, -31, 6, 4, -5 },
+    { -10, 15, -14, 0, 36, -98, 185, -288, 386, -447, 428, -275, -93, 841, -2555, 11579, 8748, -3072, 1516, -700, 205, 87, -235, 278, -255, 198, -131, 73, -31, 6, 4, -5 },
+    { -10, 15, -14, -1, 37, -99, 186, -288, 384, -444, 423, -267, -105, 856, -2571, 11537, 8801, -3070, 1508, -692, 198, 93, -239, 281, -257, 198, -131, 72, -30, 6, 4, -5 },
+    { -10, 15, -13, -2, 38, -100, 187, -288, 383, -441, 417, -258, -117, 871, -2587, 11494, 8853, -3069, 1501, -683, 190, 99, -243, 283, -258, 198, -131, 72, -30, 6, 4, -5 },
+    { -10, 15, -13, -2, 39, -101, 187, -288, 382, -438, 412, -250, -128, 886, -2603, 11452, 8906, -3067, 1493, -675, 183, 105, -247, 286, -259, 199, -131, 72, -29, 5, 5, -5 },
+    { -10, 14, -13, -3, 39, -102, 188, -288, 381, -435, 407, -242, -140, 900, -2619, 11409, 8958, -3065, 1485, -666, 175, 111, -251, 288, -260, 199, -130, 71, -29, 5, 5, -5 },
+    { -10, 14, -12, -3, 40, -102, 188, -288, 380, -432, 401, -233, -151, 915, -2634, 11365, 9010, -3062, 1476, -657, 167, 117, -255, 290, -261, 199, -130, 71, -29, 5, 5, -6 },
+    { -10, 14, -12, -4, 41, -103, 189, -288, 379, -429, 396, -225, -163, 929, -2649, 11322, 9061, -3060, 1468, -648, 160, 123, -259, 293, -262, 199, -130, 70, -28, 4, 5, -6 },
+    { -10, 14, -12, -5, 42, -104, 190, -288, 377, -426, 390, -216, -174, 944, -2664, 11278, 9113, -3057, 1460, -639, 152, 129, -263, 295, -263, 199, -129, 70, -28, 4, 5, -6 },
+    { -9, 14, -11, -5, 42, -105, 190, -288, 376, -422, 385, -208, -186, 958, -2678, 11234, 9165, -3054, 1451, -630, 144, 135, -267, 297, -264, 199, -129, 69, -27, 4, 5, -6 },
+    { -9, 14, -11, -6, 43, -106, 191, -288, 375, -419, 379, -200, -197, 972, -2693, 11190, 9216, -3050, 1442, -621, 136, 141, -271, 300, -265, 200, -129, 69, -27, 3, 6, -6 },
+    { -9, 13, -11, -6, 44, -106, 191, -287, 373, -416, 373, -191, -208, 986, -2707, 11146, 9268, -3047, 1433, -612, 128, 147, -275, 302, -266, 200, -128, 68, -26, 3, 6, -6 },
+    { -9, 13, -10, -7, 45, -107, 192, -287, 372, -413, 368, -183, -220, 999, -2720, 11101, 9319, -3043, 1424, -603, 120, 153, -279, 304, -267, 200, -128, 68, -26, 3, 6, -6 },
+    { -9, 13, -10, -7, 45, -108, 192, -287, 370, -410, 362, -174, -231, 1013, -2734, 11056, 9370, -3039, 1415, -593, 113, 158, -283, 306, -268, 200, -128, 67, -25, 2, 6, -6 },
+    { -9, 13, -9, -8, 46, -109, 193, -287, 369, -406, 357, -166, -242, 1027, -2747, 11011, 9421, -3034, 1406, -584, 105, 164, -287, 308, -269, 200, -127, 67, -25, 2, 6, -6 },
+    { -9, 13, -9, -8, 47, -109, 193, -287, 368, -403, 351, -158, -253, 1040, -2760, 10966, 9472, -3030, 1396, -575, 97, 170, -291, 311, -269, 200, -127, 66, -24, 2, 7, -6 },
+    { -9, 12, -9, -9, 47, -110, 194, -286, 366, -400, 345, -149, -265, 1054, -2773, 10921, 9522, -3025, 1387, -565, 89, 176, -295, 313, -270, 200, -126, 66, -24, 1, 7, -6 },
+    { -9, 12, -8, -10, 48, -111, 194, -286, 365, -396, 340, -141, -276, 1067, -2785, 10875, 9573, -3020, 1377, -556, 81, 182, -299, 315, -271, 200, -126, 65, -23, 1, 7, -7 },
+    { -9, 12, -8, -10, 49, -111, 195, -286, 363, -393, 334, -133, -287, 1080, -2797, 10829, 9623, -3015, 1367, -546, 73, 188, -302, 317, -272, 200, -126, 65, -23, 1, 7, -7 },
+    { -9, 12, -8, -11, 50, -112, 195, -286, 362, -390, 328, -124, -298, 1093, -2809, 10783, 9674, -3009, 1357, -536, 65, 194, -306, 319, -273, 200, -125, 64, -23, 0, 7, -7 },
+    { -9, 12, -7, -11, 50, -113, 195, -285, 360, -386, 323, -116, -309, 1106, -2821, 10737, 9724, -3003, 1347, -527, 57, 200, -310, 321, -273, 200, -125, 63, -22, 0, 8, -7 },
+    { -8, 11, -7, -12, 51, -113, 196, -285, 358, -383, 317, -108, -320, 1119, -2832, 10691, 9774, -2997, 1337, -517, 49, 206, -314, 323, -274, 200, -124, 63, -22, 0, 8, -7 },
+    { -8, 11, -7, -12, 52, -114, 196, -285, 357, -379, 311, -99, -330, 1131, -2843, 10644, 9823, -2991, 1327, -507, 41, 212, -318, 325, -275, 200, -124, 62, -21, -1, 8, -7 },
+    { -8, 11, -6, -13, 52, -115, 196, -284, 355, -376, 305, -91, -341, 1144, -2854, 10597, 9873, -2984, 1316, -497, 33, 218, -322, 327, -276, 200, -123, 62, -21, -1, 8, -7 },
+    { -8, 11, -6, -13, 53, -115, 197, -284, 353, -373, 300, -83, -352, 1156, -2864, 10550, 9923, -2977, 1306, -487, 24, 224, -325, 329, -276, 199, -123, 61, -20, -1, 8, -7 },
+    { -8, 11, -6, -14, 54, -116, 197, -283, 352, -369, 294, -74, -363, 1168, -2875, 10503, 9972, -2970, 1295, -477, 16, 229, -329, 331, -277, 199, -122, 61, -20, -2, 9, -7 },
+    { -8, 10, -5, -14, 54, -117, 197, -283, 350, -365, 288, -66, -373, 1180, -2885, 10456, 10021, -2963, 1284, -467, 8, 235, -333, 333, -278, 199, -122, 60, -19, -2, 9, -7 },
+    { -8, 10, -5, -15, 55, -117, 198, -282, 348, -362, 282, -58, -384, 1192, -2894, 10408, 10070, -2955, 1273, -457, 0, 241, -336, 335, -278, 199, -121, 59, -19, -2, 9, -7 },
+    { -8, 10, -4, -15, 56, -118, 198, -282, 346, -358, 276, -49, -395, 1204, -2904, 10360, 10119, -2947, 1262, -447, -8, 247, -340, 337, -279, 199, -121, 59, -18, -3, 9, -7 },
+    { -8, 10, -4, -16, 56, -118, 198, -281, 345, -355, 270, -41, -405, 1216, -2913, 10312, 10167, -2939, 1251, -436, -16, 253, -344, 339, -280, 199, -120, 58, -18, -3, 9, -8 },
+    { -8, 10, -4, -17, 57, -119, 198, -281, 343, -351, 265, -33, -416, 1228, -2922, 10264, 10216, -2931, 1239, -426, -25, 259, -348, 341, -280, 199, -120, 57, -17, -3, 9, -8 },
+    { -8, 9, -3, -17, 57, -120, 199, -280, 341, -348, 259, -25, -426, 1239, -2931, 10216, 10264, -2922, 1228, -416, -33, 265, -351, 343, -281, 198, -119, 57, -17, -4, 10, -8 },
+    { -8, 9, -3, -18, 58, -120, 199, -280, 339, -344, 253, -16, -436, 1251, -2939, 10167, 10312, -2913, 1216, -405, -41, 270, -355, 345, -281, 198, -118, 56, -16, -4, 10, -8 },
+    { -7, 9, -3, -18, 59, -121, 199, -279, 337, -340, 247, -8, -447, 1262, -2947, 10119, 10360, -2904, 1204, -395, -49, 276, -358, 346, -282, 198, -118, 56, -15, -4, 10, -8 },
+    { -7, 9, -2, -19, 59, -121, 199, -278, 335, -336, 241, 0, -457, 1273, -2955, 10070, 10408, -2894, 1192, -384, -58, 282, -362, 348, -282, 198, -117, 55, -15, -5, 10, -8 },
+    { -7, 9, -2, -19, 60, -122, 199, -278, 333, -333, 235, 8, -467, 1284, -2963, 10021, 10456, -2885, 1180, -373, -66, 288, -365, 350, -283, 197, -117, 54, -14, -5, 10, -8 },
+    { -7, 9, -2, -20, 61, -122, 199, -277, 331, -329, 229, 16, -477, 1295, -2970, 9972, 10503, -2875, 1168, -363, -74, 294, -369, 352, -283, 197, -116, 54, -14, -6, 11, -8 },
+    { -7, 8, -1, -20, 61, -123, 199, -276, 329, -325, 224, 24, -487, 1306, -2977, 9923, 10550, -2864, 1156, -352, -83, 300, -373, 353, -284, 197, -115, 53, -13, -6, 11, -8 },
+    { -7, 8, -1, -21, 62, -123, 200, -276, 327, -322, 218, 33, -497, 1316, -2984, 9873, 10597, -2854, 1144, -341, -91, 305, -376, 355, -284, 196, -115, 52, -13, -6, 11, -8 },
+    { -7, 8, -1, -21, 62, -124, 200, -275, 325, -318, 212, 41, -507, 1327, -2991, 9823, 10644, -2843, 1131, -330, -99, 311, -379, 357, -285, 196, -114, 52, -12, -7, 11, -8 },
+    { -7, 8, 0, -22, 63, -124, 200, -274, 323, -314, 206, 49, -517, 1337, -2997, 9774, 10691, -2832, 1119, -320, -108, 317, -383, 358, -285, 196, -113, 51, -12, -7, 11, -8 },
+    { -7, 8, 0, -22, 63, -125, 200, -273, 321, -310, 200, 57, -527, 1347, -3003, 9724, 10737, -2821, 1106, -309, -116, 323, -386, 360, -285, 195, -113, 50, -11, -7, 12, -9 },
+    { -7, 7, 0, -23, 64, -125, 200, -273, 319, -306, 194, 65, -536, 1357, -3009, 9674, 10783, -2809, 1093, -298, -124, 328, -390, 362, -286, 195, -112, 50, -11, -8, 12, -9 },
+    { -7, 7, 1, -23, 65, -126, 200, -272, 317, -302, 188, 73, -546, 1367, -3015, 9623, 10829, -2797, 1080, -287, -133, 334, -393, 363, -286, 195, -111, 49, -10, -8, 12, -9 },
+    { -7, 7, 1, -23, 65, -126, 200, -271, 315, -299, 182, 81, -556, 1377, -3020, 9573, 10875, -2785, 1067, -276, -141, 340, -396, 365, -286, 194, -111, 48, -10, -8, 12, -9 },
+    { -6, 7, 1, -24, 66, -126, 200, -270, 313, -295, 176, 89, -565, 1387, -3025, 9522, 10921, -2773, 1054, -265, -149, 345, -400, 366, -286, 194, -110, 47, -9, -9, 12, -9 },
+    { -6, 7, 2, -24, 66, -127, 200, -269, 311, -291, 170, 97, -575, 1396, -3030, 9472, 10966, -2760, 1040, -253, -158, 351, -403, 368, -287, 193, -109, 47, -8, -9, 13, -9 },
+    { -6, 6, 2, -25, 67, -127, 200, -269, 308, -287, 164, 105, -584, 1406, -3034, 9421, 11011, -2747, 1027, -242, -166, 357, -406, 369, -287, 193, -109, 46, -8, -9, 13, -9 },
+    { -6, 6, 2, -25, 67, -128, 200, -268, 306, -283, 158, 113, -593, 1415, -3039, 9370, 11056, -2734, 1013, -231, -174, 362, -410, 370, -287, 192, -108, 45, -7, -10, 13, -9 },
+    { -6, 6, 3, -26, 68, -128, 200, -267, 304, -279, 153, 120, -603, 1424, -3043, 9319, 11101, -2720, 999, -220, -183, 368, -413, 372, -287, 192, -107, 45, -7, -10, 13, -9 },
+    { -6, 6, 3, -26, 68, -128, 200, -266, 302, -275, 147, 128, -612, 1433, -3047, 9268, 11146, -2707, 986, -208, -191, 373, -416, 373, -287, 191, -106, 44, -6, -11, 13, -9 },
+    { -6, 6, 3, -27, 69, -129, 200, -265, 300, -271, 141, 136, -621, 1442, -3050, 9216, 11190, -2693, 972, -197, -200, 379, -419, 375, -288, 191, -106, 43, -6, -11, 14, -9 },
+    { -6, 5, 4, -27, 69, -129, 199, -264, 297, -267, 135, 144, -630, 1451, -3054, 9165, 11234, -2678, 958, -186, -208, 385, -422, 376, -288, 190, -105, 42, -5, -11, 14, -9 },
+    { -6, 5, 4, -28, 70, -129, 199, -263, 295, -263, 129, 152, -639, 1460, -3057, 9113, 11278, -2664, 944, -174, -216, 390, -426, 377, -288, 190, -104, 42, -5, -12, 14, -10 },
+    { -6, 5, 4, -28, 70, -130, 199, -262, 293, -259, 123, 160, -648, 1468, -3060, 9061, 11322, -2649, 929, -163, -225, 396, -429, 379, -288, 189, -103, 41, -4, -12, 14, -10 },
+    { -6, 5, 5, -29, 71, -130, 199, -261, 290, -255, 117, 167, -657, 1476, -3062, 9010, 11365, -2634, 915, -151, -233, 401, -432, 380, -288, 188, -102, 40, -3, -12, 14, -10 },
+    { -5, 5, 5, -29, 71, -130, 199, -260, 288, -251, 111, 175, -666, 1485, -3065, 8958, 11409, -2619, 900, -140, -242, 407, -435, 381, -288, 188, -102, 39, -3, -13, 14, -10 },
+    { -5, 5, 5, -29, 72, -131, 199, -259, 286, -247, 105, 183, -675, 1493, -3067, 8906, 11452, -2603, 886, -128, -250, 412, -438, 382, -288, 187, -101, 39, -2, -13, 15, -10 },
+    { -5, 4, 6, -30, 72, -131, 198, -258, 283, -243, 99, 190, -683, 1501, -3069, 8853, 11494, -2587, 871, -117, -258, 417, -441, 383, -288, 187, -100, 38, -2, -13, 15, -10 },
+    { -5, 4, 6, -30, 72, -131, 198, -257, 281, -239, 93, 198, -692, 1508, -3070, 8801, 11537, -2571, 856, -105, -267, 423, -444, 384, -288, 186, -99, 37, -1, -14, 15, -10 },
+    { -5, 4, 6, -31, 73, -131, 198, -255, 278, -235, 87, 205, -700, 1516, -3072, 8748, 11579, -2555, 841, -93, -275, 428, -447, 386, -288, 185, -98, 36, 0, -14, 15, -10 },
+    { -5, 4, 6, -31, 73, -132, 198, -254, 276, -231, 81, 213, -709, 1524, -3073, 8696, 11621, -2538, 826, -81, -283, 434, -449, 387, -288, 185, -97, 35, 0, -15, 15, -10 },
+    { -5, 4, 7, -32, 74, -132, 197, -253, 274, -226, 75, 221, -717, 1531, -3074, 8643, 11663, -2521, 811, -70, -292, 439, -452, 388, -288, 184, -96, 35, 1, -15, 16, -10 },
+    { -5, 3, 7, -32, 74, -132, 197, -252, 271, -222, 70, 228, -726, 1538, -3074, 8590, 11705, -2504, 796, -58, -300, 444, -455, 389, -288, 183, -96, 34, 1, -15, 16, -10 },
+    { -5, 3, 7, -32, 75, -132, 197, -251, 269, -218, 64, 235, -734, 1545, -3075, 8538, 11746, -2486, 780, -46, -309, 450, -458, 390, -287, 182, -95, 33, 2, -16, 16, -10 },
+    { -5, 3, 8, -33, 75, -133, 197, -250, 266, -214, 58, 243, -742, 1552, -3075, 8485, 11787, -2468, 765, -34, -317, 455, -461, 391, -287, 182, -94, 32, 2, -16, 16, -10 },
+    { -5, 3, 8, -33, 75, -133, 196, -248, 264, -210, 52, 250, -750, 1559, -3075, 8432, 11828, -2450, 749, -22, -325, 460, -464, 392, -287, 181, -93, 31, 3, -16, 16, -10 },
+    { -5, 3, 8, -34, 76, -133, 196, -247, 261, -206, 46, 258, -758, 1566, -3075, 8378, 11869, -2432, 734, -10, -334, 465, -466, 393, -287, 180, -92, 31, 4, -17, 17, -11 },
+    { -4, 2, 9, -34, 76, -133, 196, -246, 258, -202, 40, 265, -766, 1573, -3074, 8325, 11909, -2413, 718, 2, -342, 470, -469, 393, -287, 179, -91, 30, 4, -17, 17, -11 },
+    { -4, 2, 9, -34, 77, -133, 195, -245, 256, -197, 34, 272, -774, 1579, -3073, 8272, 11950, -2394, 702, 14, -350, 476, -472, 394, -286, 179, -90, 29, 5, -17, 17, -11 },
+    { -4, 2, 9, -35, 77, -133, 195, -243, 253, -193, 28, 280, -782, 1585, -3072, 8218, 11989, -2375, 686, 26, -359, 481, -474, 395, -286, 178, -89, 28, 5, -18, 17, -11 },
+    { -4, 2, 10, -35, 77, -134, 194, -242, 251, -189, 23, 287, -789, 1591, -3071, 8165, 12029, -2356, 670, 38, -367, 486, -477, 396, -286, 177, -88, 27, 6, -18, 17, -11 },
+    { -4, 2, 10, -35, 78, -134, 194, -241, 248, -185, 17, 294, -797, 1598, -3070, 8111, 12068, -2336, 654, 50, -375, 491, -479, 397, -285, 176, -87, 27, 7, -18, 17, -11 },
+    { -4, 2, 10, -36, 78, -134, 194, -239, 245, -181, 11, 301, -805, 1603, -3068, 8057, 12108, -2316, 638, 62, -383, 496, -482, 397, -285, 175, -86, 26, 7, -19, 18, -11 },
+    { -4, 1, 10, -36, 78, -134, 193, -238, 243, -177, 5, 308, -812, 1609, -3066, 8004, 12146, -2296, 621, 74, -392, 501, -484, 398, -285, 174, -85, 25, 8, -19, 18, -11 },
+    { -4, 1, 11, -37, 79, -134, 193, -237, 240, -172, -1, 315, -819, 1615, -3064, 7950, 12185, -2275, 605, 86, -400, 506, -487, 399, -284, 173, -84, 24, 8, -20, 18, -11 },
+    { -4, 1, 11, -37, 79, -134, 192, -235, 238, -168, -6, 322, -827, 1620, -3062, 7896, 12223, -2255, 588, 98, -408, 511, -489, 400, -284, 172, -83, 23, 9, -20, 18, -11 },
+    { -4, 1, 11, -37, 79, -134, 192, -234, 235, -164, -12, 329, -834, 1626, -3059, 7842, 12262, -2233, 572, 110, -416, 516, -492, 400, -283, 171, -82, 22, 10, -20, 18, -11 },
+    { -4, 1, 12, -38, 80, -134, 191, -232, 232, -160, -18, 336, -841, 1631, -3056, 7788, 12299, -2212, 555, 122, -425, 521, -494, 401, -283, 171, -81, 21, 10, -21, 18, -11 },
+    { -3, 1, 12, -38, 80, -134, 191, -231, 229, -155, -24, 343, -848, 1636, -3053, 7734, 12337, -2191, 538, 135, -433, 526, -496, 401, -282, 170, -80, 21, 11, -21, 19, -11 },
+    { -3, 0, 12, -38, 80, -134, 190, -230, 227, -151, -30, 350, -855, 1641, -3050, 7679, 12374, -2169, 521, 147, -441, 531, -499, 402, -282, 169, -79, 20, 11, -21, 19, -11 },
+    { -3, 0, 12, -39, 81, -134, 190, -228, 224, -147, -35, 357, -862, 1645, -3047, 7625, 12411, -2146, 504, 159, -449, 535, -501, 402, -281, 168, -78, 19, 12, -22, 19, -12 },
+    { -3, 0, 13, -39, 81, -134, 189, -227, 221, -143, -41, 364, -869, 1650, -3043, 7571, 12448, -2124, 487, 171, -457, 540, -503, 403, -281, 167, -77, 18, 13, -22, 19, -12 },
+    { -3, 0, 13, -39, 81, -134, 189, -225, 219, -139, -47, 370, -876, 1655, -3039, 7516, 12484, -2101, 470, 183, -465, 545, -505, 403, -280, 166, -76, 17, 13, -22, 19, -12 },
+    { -3, 0, 13, -40, 81, -134, 188, -224, 216, -134, -52, 377, -882, 1659, -3035, 7462, 12521, -2078, 452, 196, -473, 550, -508, 404, -280, 164, -75, 16, 14, -23, 19, -12 },
+    { -3, -1, 13, -40, 82, -134, 188, -222, 213, -130, -58, 384, -889, 1663, -3031, 7407, 12557, -2055, 435, 208, -481, 554, -510, 404, -279, 163, -74, 15, 14, -23, 20, -12 },
+    { -3, -1, 14, -40, 82, -134, 187, -221, 210, -126, -64, 390, -896, 1667, -3026, 7353, 12592, -2032, 418, 220, -490, 559, -512, 404, -278, 162, -73, 14, 15, -23, 20, -12 },
+    { -3, -1, 14, -41, 82, -134, 186, -219, 207, -122, -69, 397, -902, 1671, -3021, 7298, 12627, -2008, 400, 233, -498, 564, -514, 405, -278, 161, -71, 14, 16, -24, 20, -12 },
+    { -3, -1, 14, -41, 82, -134, 186, -218, 205, -117, -75, 404, -908, 1675, -3017, 7243, 12663, -1984, 382, 245, -506, 568, -516, 405, -277, 160, -70, 13, 16, -24, 20, -12 },
+    { -3, -1, 15, -41, 83, -134, 185, -216, 202, -113, -81, 410, -915, 1679, -3011, 7189, 12697, -1960, 365, 257, -514, 573, -518, 405, -276, 159, -69, 12, 17, -25, 20, -12 },
+    { -3, -1, 15, -42, 83, -134, 184, -214, 199, -109, -86, 417, -921, 1682, -3006, 7134, 12732, -1935, 347, 270, -522, 577, -520, 406, -276, 158, -68, 11, 18, -25, 20, -12 },
+    { -2, -2, 15, -42, 83, -134, 184, -213, 196, -105, -92, 423, -927, 1686, -3000, 7079, 12766, -1910, 329, 282, -529, 582, -522, 406, -275, 157, -67, 10, 18, -25, 21, -12 },
+    { -2, -2, 15, -42, 83, -134, 183, -211, 193, -100, -97, 429, -933, 1689, -2995, 7024, 12800, -1885, 311, 294, -537, 586, -524, 406, -274, 156, -66, 9, 19, -26, 21, -12 },
+    { -2, -2, 16, -42, 83, -134, 182, -210, 190, -96, -103, 436, -939, 1692, -2989, 6969, 12834, -1860, 293, 307, -545, 590, -525, 406, -273, 154, -65, 8, 19, -26, 21, -12 },
+    { -2, -2, 16, -43, 84, -134, 182, -208, 188, -92, -108, 442, -945, 1695, -2982, 6915, 12867, -1834, 275, 319, -553, 595, -527, 406, -272, 153, -64, 7, 20, -26, 21, -12 },
+    { -2, -2, 16, -43, 84, -134, 181, -206, 185, -88, -114, 448, -950, 1698, -2976, 6860, 12900, -1808, 257, 331, -561, 599, -529, 406, -272, 152, -62, 6, 21, -27, 21, -12 },
+    { -2, -2, 16, -43, 84, -134, 180, -205, 182, -83, -119, 454, -956, 1701, -2969, 6805, 12933, -1782, 239, 344, -569, 603, -531, 406, -271, 151, -61, 5, 21, -27, 21, -12 },
+    { -2, -3, 17, -44, 84, -134, 179, -203, 179, -79, -125, 461, -962, 1703, -2963, 6750, 12965, -1755, 220, 356, -577, 608, -532, 406, -270, 150, -60, 4, 22, -27, 22, -12 },
+    { -2, -3, 17, -44, 84, -133, 179, -201, 176, -75, -130, 467, -967, 1706, -2956, 6695, 12997, -1729, 202, 369, -584, 612, -534, 406, -269, 148, -59, 3, 22, -28, 22, -12 },
+    { -2, -3, 17, -44, 85, -133, 178, -200, 173, -71, -136, 473, -973, 1708, -2948, 6640, 13029, -1702, 183, 381, -592, 616, -536, 406, -268, 147, -58, 3, 23, -28, 22, -13 },
+    { -2, -3, 17, -44, 85, -133, 177, -198, 170, -66, -141, 479, -978, 1710, -2941, 6584, 13061, -1674, 165, 393, -600, 620, -537, 406, -267, 146, -56, 2, 24, -28, 22, -13 },
+    { -2, -3, 18, -45, 85, -133, 176, -196, 167, -62, -147, 485, -983, 1712, -2933, 6529, 13092, -1647, 146, 406, -607, 624, -539, 406, -266, 145, -55, 1, 24, -29, 22, -13 },
+    { -2, -3, 18, -45, 85, -133, 176, -194, 164, -58, -152, 490, -988, 1714, -2926, 6474, 13123, -1619, 128, 418, -615, 628, -540, 406, -265, 143, -54, 0, 25, -29, 22, -13 },
+    { -1, -3, 18, -45, 85, -133, 175, -193, 161, -54, -157, 496, -993, 1716, -2918, 6419, 13154, -1591, 109, 430, -623, 632, -542, 406, -264, 142, -53, -1, 26, -29, 23, -13 },
+    { -1, -4, 18, -45, 85, -132, 174, -191, 158, -49, -163, 502, -998, 1717, -2909, 6364, 13184, -1563, 90, 443, -630, 636, -543, 406, -263, 141, -52, -2, 26, -30, 23, -13 },
+    { -1, -4, 18, -46, 85, -132, 173, -189, 156, -45, -168, 508, -1003, 1719, -2901, 6309, 13214, -1534, 71, 455, -638, 640, -545, 405, -262, 139, -50, -3, 27, -30, 23, -13 },
+    { -1, -4, 19, -46, 86, -132, 172, -187, 153, -41, -173, 514, -1008, 1720, -2893, 6254, 13244, -1505, 52, 468, -645, 644, -546, 405, -261, 138, -49, -4, 27, -30, 23, -13 },
+    { -1, -4, 19, -46, 86, -132, 171, -186, 150, -37, -179, 519, -1013, 1721, -2884, 6199, 13273, -1476, 33, 480, -653, 648, -547, 405, -260, 137, -48, -5, 28, -31, 23, -13 },
+    { -1, -4, 19, -46, 86, -131, 171, -184, 147, -32, -184, 525, -1017, 1722, -2875, 6144, 13302, -1447, 14, 492, -660, 652, -548, 404, -258, 135, -47, -6, 29, -31, 23, -13 },
+    { -1, -4, 19, -47, 86, -131, 170, -182, 144, -28, -189, 530, -1022, 1723, -2866, 6088, 13331, -1417, -5, 505, -668, 656, -550, 404, -257, 134, -45, -7, 29, -31, 23, -13 },
+    { -1, -5, 20, -47, 86, -131, 169, -180, 141, -24, -194, 536, -1026, 1724, -2856, 6033, 13359, -1387, -24, 517, -675, 659, -551, 404, -256, 132, -44, -8, 30, -32, 24, -13 },
+    { -1, -5, 20, -47, 86, -131, 168, -178, 138, -20, -199, 541, -1031, 1725, -2847, 5978, 13388, -1357, -43, 529, -682, 663, -552, 403, -255, 131, -43, -9, 30, -32, 24, -13 },
+    { -1, -5, 20, -47, 86, -130, 167, -177, 135, -16, -204, 547, -1035, 1725, -2837, 5923, 13415, -1326, -63, 541, -690, 667, -553, 403, -254, 130, -42, -10, 31, -32, 24, -13 },
+    { -1, -5, 20, -47, 86, -130, 166, -175, 132, -12, -210, 552, -1039, 1726, -2827, 5868, 13443, -1296, -82, 554, -697, 670, -554, 402, -252, 128, -40, -11, 32, -33, 24, -13 },
+    { -1, -5, 20, -48, 86, -130, 165, -173, 129, -7, -215, 557, -1043, 1726, -2817, 5813, 13470, -1265, -101, 566, -704, 674, -555, 402, -251, 127, -39, -12, 32, -33, 24, -13 },
+    { -1, -5, 21, -48, 86, -129, 164, -171, 126, -3, -220, 563, -1047, 1726, -2807, 5758, 13497, -1234, -121, 578, -711, 677, -556, 401, -250, 125, -38, -13, 33, -33, 24, -13 },
+    { 0, -5, 21, -48, 86, -129, 163, -169, 123, 1, -225, 568, -1051, 1726, -2797, 5703, 13524, -1202, -140, 591, -718, 681, -557, 401, -249, 124, -36, -14, 33, -34, 24, -13 },
+    { 0, -6, 21, -48, 86, -129, 162, -167, 120, 5, -230, 573, -1055, 1726, -2786, 5647, 13550, -1170, -160, 603, -725, 684, -558, 400, -247, 122, -35, -15, 34, -34, 24, -13 },
+    { 0, -6, 21, -48, 86, -128, 161, -165, 117, 9, -235, 578, -1059, 1726, -2776, 5592, 13576, -1138, -179, 615, -732, 688, -559, 399, -246, 121, -34, -15, 35, -34, 25, -13 },
+    { 0, -6, 21, -49, 86, -128, 160, -163, 114, 13, -240, 583, -1063, 1726, -2765, 5537, 13601, -1106, -199, 627, -739, 691, -560, 399, -244, 119, -32, -16, 35, -35, 25, -13 },
+    { 0, -6, 22, -49, 86, -128, 159, -161, 111, 18, -245, 588, -1066, 1725, -2754, 5482, 13627, -1074, -219, 639, -746, 694, -561, 398, -243, 118, -31, -17, 36, -35, 25, -13 },
+    { 0, -6, 22, -49, 87, -127, 158, -160, 108, 22, -250, 593, -1070, 1724, -2742, 5427, 13651, -1041, -238, 651, -753, 697, -561, 397, -242, 116, -30, -18, 36, -35, 25, -13 },
+    { 0, -6, 22, -49, 87, -127, 157, -158, 105, 26, -254, 598, -1073, 1724, -2731, 5373, 13676, -1008, -258, 664, -760, 701, -562, 397, -240, 115, -28, -19, 37, -35, 25, -13 },
+    { 0, -6, 22, -49, 87, -127, 156, -156, 102, 30, -259, 603, -1076, 1723, -2719, 5318, 13700, -975, -278, 676, -767, 704, -563, 396, -239, 113, -27, -20, 38, -36, 25, -13 },
+    { 0, -7, 22, -49, 87, -126, 155, -154, 99, 34, -264, 607, -1080, 1722, -2708, 5263, 13724, -941, -298, 688, -774, 707, -563, 395, -237, 111, -26, -21, 38, -36, 25, -13 },
+    { 0, -7, 22, -50, 87, -126, 154, -152, 95, 38, -269, 612, -1083, 1721, -2696, 5208, 13748, -908, -318, 700, -781, 710, -564, 394, -236, 110, -24, -22, 39, -36, 25, -14 },
+    { 0, -7, 23, -50, 86, -125, 153, -150, 92, 42, -274, 617, -1086, 1719, -2684, 5153, 13771, -874, -338, 712, -787, 713, -564, 393, -234, 108, -23, -23, 39, -37, 26, -14 },
+    { 0, -7, 23, -50, 86, -125, 152, -148, 89, 46, -278, 621, -1089, 1718, -2672, 5098, 13794, -839, -358, 724, -794, 716, -565, 392, -233, 107, -22, -24, 40, -37, 26, -14 },
+    { 0, -7, 23, -50, 86, -125, 151, -146, 86, 50, -283, 626, -1092, 1716, -2659, 5044, 13817, -805, -378, 736, -801, 719, -565, 391, -231, 105, -20, -25, 41, -37, 26, -14 },
+    { 0, -7, 23, -50, 86, -124, 150, -144, 83, 54, -288, 630, -1094, 1715, -2647, 4989, 13839, -770, -398, 748, -807, 721, -566, 390, -229, 103, -19, -26, 41, -38, 26, -14 },
+    { 1, -7, 23, -50, 86, -124, 149, -142, 80, 58, -292, 635, -1097, 1713, -2634, 4934, 13861, -735, -418, 760, -814, 724, -566, 389, -228, 102, -18, -27, 42, -38, 26, -14 },
+    { 1, -7, 24, -50, 86, -123, 148, -140, 77, 62, -297, 639, -1100, 1711, -2621, 4880, 13882, -700, -438, 772, -820, 727, -566, 388, -226, 100, -16, -28, 42, -38, 26, -14 },
+    { 1, -8, 24, -51, 86, -123, 147, -138, 74, 66, -302, 643, -1102, 1709, -2608, 4825, 13904, -664, -458, 784, -827, 730, -567, 387, -225, 98, -15, -29, 43, -38, 26, -14 },
+    { 1, -8, 24, -51, 86, -122, 145, -136, 71, 70, -306, 648, -1105, 1707, -2595, 4771, 13925, -629, -478, 795, -833, 732, -567, 386, -223, 97, -14, -30, 44, -39, 26, -14 },
+    { 1, -8, 24, -51, 86, -122, 144, -134, 68, 74, -311, 652, -1107, 1704, -2582, 4716, 13945, -593, -498, 807, -839, 735, -567, 385, -221, 95, -12, -31, 44, -39, 26, -14 },
+    { 1, -8, 24, -51, 86, -121, 143, -132, 65, 78, -315, 656, -1109, 1702, -2568, 4662, 13965, -557, -518, 819, -845, 737, -567, 384, -219, 93, -11, -32, 45, -39, 27, -14 },
+    { 1, -8, 24, -51, 86, -121, 142, -130, 62, 82, -319, 660, -1111, 1699, -2555, 4608, 13985, -520, -539, 831, -852, 740, -567, 382, -218, 92, -9, -33, 45, -40, 27, -14 },
+    { 1, -8, 24, -51, 86, -120, 141, -128, 59, 86, -324, 664, -1113, 1697, -2541, 4554, 14005, -483, -559, 842, -858, 742, -567, 381, -216, 90, -8, -34, 46, -40, 27, -14 },
+    { 1, -8, 25, -51, 86, -120, 140, -126, 56, 90, -328, 668, -1115, 1694, -2527, 4499, 14024, -446, -579, 854, -864, 745, -567, 380, -214, 88, -7, -35, 46, -40, 27, -14 },
+    { 1, -8, 25, -51, 86, -119, 139, -124, 53, 94, -333, 672, -1117, 1691, -2513, 4445, 14043, -409, -599, 866, -870, 747, -567, 379, -212, 86, -5, -36, 47, -40, 27, -14 },
+    { 1, -9, 25, -51, 86, -119, 137, -122, 50, 98, -337, 676, -1119, 1688, -2499, 4391, 14061, -372, -620, 877, -876, 749, -567, 377, -211, 85, -4, -37, 48, -41, 27, -14 },
+    { 1, -9, 25, -52, 85, -118, 136, -120, 47, 102, -341, 679, -1121, 1685, -2485, 4337, 14079, -334, -640, 889, -882, 751, -567, 376, -209, 83, -2, -38, 48, -41, 27, -14 },
+    { 1, -9, 25, -52, 85, -118, 135, -117, 44, 106, -345, 683, -1122, 1682, -2470, 4283, 14097, -296, -660, 900, -888, 754, -567, 374, -207, 81, -1, -39, 49, -41, 27, -14 },
+    { 1, -9, 25, -52, 85, -117, 134, -115, 41, 109, -350, 687, -1124, 1678, -2456, 4230, 14115, -258, -681, 912, -894, 756, -567, 373, -205, 79, 1, -40, 49, -41, 27, -14 },
+    { 1, -9, 25, -52, 85, -117, 133, -113, 38, 113, -354, 690, -1125, 1675, -2441, 4176, 14132, -220, -701, 923, -899, 758, -566, 372, -203, 77, 2, -41, 50, -42, 27, -14 },
+    { 1, -9, 26, -52, 85, -116, 131, -111, 35, 117, -358, 694, -1127, 1671, -2426, 4122, 14148, -181, -722, 935, -905, 760, -566, 370, -201, 76, 3, -42, 50, -42, 27, -14 },
+    { 2, -9, 26, -52, 85, -116, 130, -109, 32, 121, -362, 697, -1128, 1667, -2411, 4069, 14165, -143, -742, 946, -911, 762, -566, 368, -199, 74, 5, -43, 51, -42, 27, -14 },
+    { 2, -9, 26, -52, 85, -115, 129, -107, 29, 125, -366, 701, -1129, 1663, -2396, 4015, 14181, -103, -762, 957, -916, 764, -565, 367, -197, 72, 6, -44, 51, -43, 28, -14 },
+    { 2, -9, 26, -52, 84, -114, 128, -105, 26, 128, -370, 704, -1130, 1659, -2381, 3962, 14196, -64, -783, 968, -922, 765, -565, 365, -195, 70, 8, -45, 52, -43, 28, -14 },
+    { 2, -10, 26, -52, 84, -114, 126, -103, 23, 132, -374, 707, -1131, 1655, -2365, 3909, 14212, -25, -803, 980, -927, 767, -565, 364, -193, 68, 9, -46, 53, -43, 28, -14 },
+    { 2, -10, 26, -52, 84, -113, 125, -101, 20, 136, -378, 711, -1132, 1651, -2350, 3855, 14227, 15, -824, 991, -933, 769, -564, 362, -191, 66, 11, -46, 53, -43, 28, -14 },
+    { 2, -10, 26, -52, 84, -113, 124, -99, 17, 140, -382, 714, -1133, 1647, -2334, 3802, 14241, 55, -844, 1002, -938, 771, -563, 360, -189, 65, 12, -47, 54, -44, 28, -14 },
+    { 2, -10, 26, -52, 84, -112, 123, -97, 14, 143, -386, 717, -1134, 1642, -2319, 3749, 14256, 95, -864, 1013, -943, 772, -563, 359, -187, 63, 13, -48, 54, -44, 28, -14 },
+    { 2, -10, 27, -52, 84, -111, 121, -94, 11, 147, -390, 720, -1134, 1638, -2303, 3696, 14270, 135, -885, 1024, -949, 774, -562, 357, -185, 61, 15, -49, 55, -44, 28, -14 },
+    { 2, -10, 27, -52, 83, -111, 120, -92, 8, 151, -394, 723, -1135, 1633, -2287, 3643, 14283, 176, -905, 1035, -954, 775, -562, 355, -183, 59, 16, -50, 55, -44, 28, -14 },
+    { 2, -10, 27, -52, 83, -110, 119, -90, 5, 154, -397, 726, -1135, 1628, -2271, 3591, 14296, 217, -926, 1046, -959, 777, -561, 353, -181, 57, 18, -51, 56, -44, 28, -14 },
+    { 2, -10, 27, -52, 83, -110, 117, -88, 2, 158, -401, 729, -1136, 1623, -2254, 3538, 14309, 258, -946, 1057, -964, 778, -560, 351, -179, 55, 19, -52, 56, -45, 28, -14 },
+    { 2, -10, 27, -52, 83, -109, 116, -86, -1, 162, -405, 732, -1136, 1618, -2238, 3485, 14322, 299, -967, 1067, -969, 779, -559, 350, -177, 53, 21, -53, 57, -45, 28, -14 },
+    { 2, -10, 27, -52, 82, -108, 115, -84, -4, 165, -409, 734, -1136, 1613, -2222, 3433, 14334, 341, -987, 1078, -974, 781, -558, 348, -175, 51, 22, -54, 57, -45, 28, -14 },
+    { 2, -11, 27, -52, 82, -108, 114, -82, -7, 169, -412, 737, -1136, 1608, -2205, 3381, 14345, 382, -1007, 1089, -979, 782, -557, 346, -172, 49, 24, -55, 58, -45, 28, -14 },
+    { 2, -11, 27, -52, 82, -107, 112, -80, -10, 172, -416, 740, -1136, 1603, -2188, 3328, 14357, 424, -1028, 1099, -984, 783, -556, 344, -170, 47, 25, -56, 58, -46, 28, -14 },
+    { 2, -11, 27, -52, 82, -106, 111, -78, -13, 176, -419, 742, -1136, 1597, -2172, 3276, 14368, 467, -1048, 1110, -988, 784, -555, 342, -168, 45, 27, -57, 59, -46, 28, -14 },
+    { 2, -11, 27, -52, 82, -106, 110, -75, -16, 179, -423, 745, -1136, 1592, -2155, 3224, 14378, 509, -1068, 1120, -993, 785, -554, 340, -166, 44, 28, -58, 59, -46, 28, -14 },
+    { 2, -11, 28, -52, 81, -105, 108, -73, -19, 183, -426, 747, -1136, 1586, -2138, 3172, 14389, 551, -1089, 1131, -998, 786, -553, 338, -164, 42, 29, -59, 60, -46, 29, -14 },
+    { 3, -11, 28, -52, 81, -104, 107, -71, -22, 186, -430, 750, -1135, 1580, -2121, 3121, 14399, 594, -1109, 1141, -1002, 787, -552, 336, -161, 40, 31, -60, 60, -46, 29, -14 },
+    { 3, -11, 28, -52, 81, -103, 106, -69, -25, 190, -433, 752, -1135, 1574, -2104, 3069, 14408, 637, -1129, 1152, -1007, 788, -551, 334, -159, 38, 32, -61, 61, -47, 29, -14 },
+    { 3, -11, 28, -52, 81, -103, 104, -67, -27, 193, -437, 754, -1134, 1568, -2086, 3018, 14417, 680, -1150, 1162, -1011, 789, -550, 331, -157, 36, 34, -62, 61, -47, 29, -14 },
+    { 3, -11, 28, -52, 80, -102, 103, -65, -30, 197, -440, 756, -1134, 1562, -2069, 2966, 14426, 724, -1170, 1172, -1015, 790, -549, 329, -154, 34, 35, -63, 62, -47, 29, -14 },
+    { 3, -11, 28, -52, 80, -101, 101, -63, -33, 200, -443, 758, -1133, 1556, -2051, 2915, 14435, 767, -1190, 1182, -1020, 790, -547, 327, -152, 32, 37, -64, 62, -47, 29, -14 },
+    { 3, -11, 28, -52, 80, -101, 100, -60, -36, 203, -446, 761, -1133, 1550, -2034, 2864, 14443, 811, -1210, 1192, -1024, 791, -546, 325, -150, 30, 38, -64, 63, -47, 29, -14 },
+    { 3, -11, 28, -52, 79, -100, 99, -58, -39, 207, -450, 763, -1132, 1543, -2016, 2813, 14451, 855, -1231, 1202, -1028, 792, -544, 323, -147, 28, 40, -65, 63, -48, 29, -14 },
+    { 3, -12, 28, -52, 79, -99, 97, -56, -42, 210, -453, 764, -1131, 1537, -1998, 2762, 14458, 899, -1251, 1212, -1032, 792, -543, 320, -145, 26, 41, -66, 64, -48, 29, -14 },
+    { 3, -12, 28, -52, 79, -98, 96, -54, -45, 213, -456, 766, -1130, 1530, -1981, 2711, 14465, 944, -1271, 1222, -1036, 792, -542, 318, -143, 24, 43, -67, 64, -48, 29, -14 },
+    { 3, -12, 28, -52, 78, -98, 95, -52, -48, 217, -459, 768, -1129, 1523, -1963, 2661, 14472, 988, -1291, 1232, -1040, 793, -540, 316, -140, 22, 44, -68, 65, -48, 29, -13 },
+    { 3, -12, 28, -52, 78, -97, 93, -50, -50, 220, -462, 770, -1127, 1517, -1945, 2610, 14478, 1033, -1311, 1241, -1044, 793, -538, 313, -138, 20, 46, -69, 65, -48, 29, -13 },
+    { 3, -12, 28, -52, 78, -96, 92, -48, -53, 223, -465, 772, -1126, 1510, -1927, 2560, 14484, 1078, -1331, 1251, -1047, 793, -537, 311, -135, 17, 47, -70, 66, -48, 29, -13 },
+    { 3, -12, 28, -52, 78, -95, 90, -45, -56, 226, -468, 773, -1125, 1503, -1908, 2510, 14489, 1123, -1351, 1261, -1051, 794, -535, 308, -133, 15, 49, -71, 66, -49, 29, -13 },
+    { 3, -12, 28, -52, 77, -94, 89, -43, -59, 229, -471, 775, -1123, 1496, -1890, 2460, 14494, 1169, -1371, 1270, -1055, 794, -533, 306, -130, 13, 50, -72, 67, -49, 29, -13 },
+    { 3, -12, 29, -52, 77, -94, 88, -41, -62, 233, -474, 776, -1122, 1488, -1872, 2410, 14499, 1214, -1391, 1280, -1058, 794, -532, 303, -128, 11, 51, -73, 67, -49, 29, -13 },
+    { 3, -12, 29, -52, 77, -93, 86, -39, -65, 236, -477, 778, -1120, 1481, -1853, 2360, 14504, 1260, -1411, 1289, -1062, 794, -530, 301, -126, 9, 53, -74, 68, -49, 29, -13 },
+    { 3, -12, 29, -52, 76, -92, 85, -37, -67, 239, -479, 779, -1119, 1474, -1835, 2310, 14508, 1306, -1431, 1298, -1065, 794, -528, 298, -123, 7, 54, -74, 68, -49, 29, -13 },
+    { 3, -12, 29, -52, 76, -91, 83, -35, -70, 242, -482, 781, -1117, 1466, -1816, 2261, 14511, 1352, -1450, 1307, -1068, 794, -526, 296, -120, 5, 56, -75, 68, -49, 29, -13 },
+    { 3, -12, 29, -52, 76, -91, 82, -33, -73, 245, -485, 782, -1115, 1459, -1797, 2212, 14515, 1398, -1470, 1316, -1072, 794, -524, 293, -118, 3, 57, -76, 69, -50, 29, -13 },
+    { 3, -12, 29, -51, 75, -90, 80, -31, -76, 248, -487, 783, -1113, 1451, -1779, 2162, 14518, 1445, -1490, 1325, -1075, 794, -522, 291, -115, 1, 59, -77, 69, -50, 29, -13 },
+    { 3, -12, 29, -51, 75, -89, 79, -28, -78, 251, -490, 784, -1111, 1443, -1760, 2113, 14520, 1491, -1510, 1334, -1078, 793, -520, 288, -113, -1, 60, -78, 70, -50, 29, -13 },
+    { 3, -12, 29, -51, 74, -88, 78, -26, -81, 254, -493, 785, -1109, 1435, -1741, 2065, 14523, 1538, -1529, 1343, -1081, 793, -518, 285, -110, -3, 62, -79, 70, -50, 29, -13 },
+    { 4, -13, 29, -51, 74, -87, 76, -24, -84, 257, -495, 786, -1107, 1427, -1722, 2016, 14524, 1585, -1549, 1352, -1084, 793, -516, 283, -108, -5, 63, -80, 71, -50, 29, -13 },
+    { 4, -13, 29, -51, 74, -86, 75, -22, -86, 260, -498, 787, -1105, 1419, -1703, 1967, 14526, 1632, -1568, 1361, -1087, 792, -514, 280, -105, -7, 65, -81, 71, -50, 29, -13 },
+    { 4, -13, 29, -51, 73, -86, 73, -20, -89, 263, -500, 788, -1102, 1411, -1684, 1919, 14527, 1680, -1588, 1369, -1090, 792, -512, 277, -102, -9, 66, -81, 71, -50, 29, -13 },
+    { 4, -13, 29, -51, 73, -85, 72, -18, -92, 266, -503, 789, -1100, 1403, -1665, 1871, 14528, 1727, -1607, 1378, -1092, 791, -509, 274, -100, -12, 68, -82, 72, -50, 29, -13 },
+    { 4, -13, 29, -51, 73, -84, 70, -16, -95, 269, -505, 790, -1098, 1395, -1646, 1823, 14528, 1775, -1626, 1386, -1095, 790, -507, 271, -97, -14, 69, -83, 72, -51, 29, -13 },
+};
+
+/* 32000 -> 48000 Hz, up 3 down 2, passband to 12375 Hz */
+static const int16_t s_phases_32000_48000[3][RESAMPLER_TAPS] = {
+    { -12, 25, -38, 44, -33, -7, 88, -212, 376, -562, 738, -856, 843, -562, -477, 14008, 4544, -2537, 1693, -1110, 661, -322, 86, 58, -125, 137, -117, 82, -49, 23, -7, 1 },
+    { -7, 9, -3, -16, 55, -116, 194, -276, 337, -346, 260, -29, -420, 1232, -2925, 10240, 10240, -2925, 1232, -420, -29, 260, -346, 337, -276, 194, -116, 55, -16, -3, 9, -7 },
+    { 1, -7, 23, -49, 82, -117, 137, -125, 58, 86, -322, 661, -1110, 1693, -2537, 4544, 14008, -477, -562, 843, -856, 738, -562, 376, -212, 88, -7, -33, 44, -38, 25, -12 },
+};
+
+/* 44100 -> 48000 Hz, up 160 down 147, passband to 17055 Hz */
+static const int16_t s_phases_44100_48000[160][RESAMPLER_TAPS] = {
+    { -13, 29, -51, 72, -83, 68, -13, -98, 273, -508, 791, -1094, 1382, -1617, 1751, 14528, 1847, -1655, 1399, -1099, 789, -504, 267, -93, -17, 71, -84, 73, -51, 29, -13, 4 },
+    { -13, 29, -50, 71, -81, 65, -8, -104, 278, -513, 792, -1088, 1365, -1578, 1656, 14527, 1943, -1694, 1415, -1104, 788, -499, 261, -88, -21, 74, -86, 73, -51, 29, -13, 4 },
+    { -13, 29, -50, 70, -79, 62, -4, -109, 284, -517, 793, -1082, 1348, -1539, 1562, 14524, 2040, -1732, 1431, -1108, 786, -494, 255, -82, -25, 77, -88, 74, -51, 29, -13, 3 },
+    { -13, 29, -50, 69, -77, 60, 0, -114, 289, -521, 793, -1076, 1330, -1500, 1468, 14519, 2138, -1769, 1447, -1112, 784, -489, 250, -77, -30, 80, -89, 75, -51, 29, -12, 3 },
+    { -13, 29, -49, 69, -76, 57, 4, -119, 294, -525, 794, -1070, 1312, -1460, 1375, 14513, 2236, -1807, 1462, -1116, 781, -483, 243, -71, -34, 83, -91, 76, -52, 29, -12, 3 },
+    { -13, 29, -49, 68, -74, 54, 8, -124, 300, -529, 794, -1063, 1293, -1421, 1283, 14506, 2335, -1844, 1477, -1119, 778, -478, 237, -66, -38, 85, -92, 76, -52, 29, -12, 3 },
+    { -13, 29, -49, 67, -72, 51, 12, -129, 305, -533, 794, -1056, 1275, -1381, 1191, 14497, 2435, -1881, 1492, -1123, 776, -472, 231, -60, -42, 88, -94, 77, -52, 28, -12, 3 },
+    { -13, 29, -49, 66, -70, 48, 16, -134, 310, -536, 794, -1049, 1256, -1341, 1101, 14487, 2535, -1917, 1506, -1126, 772, -466, 225, -55, -47, 91, -96, 78, -52, 28, -12, 3 },
+    { -13, 29, -48, 65, -69, 45, 21, -139, 314, -539, 793, -1042, 1237, -1301, 1011, 14475, 2635, -1954, 1520, -1128, 769, -460, 218, -49, -51, 94, -97, 78, -52, 28, -12, 3 },
+    { -14, 29, -48, 64, -67, 42, 25, -144, 319, -542, 792, -1034, 1217, -1261, 921, 14462, 2737, -1990, 1533, -1130, 765, -454, 212, -43, -55, 97, -99, 79, -52, 28, -12, 3 },
+    { -14, 29, -47, 63, -65, 39, 29, -149, 324, -545, 791, -1026, 1197, -1220, 833, 14447, 2838, -2025, 1546, -1132, 762, -448, 205, -38, -59, 99, -100, 80, -52, 28, -11, 3 },
+    { -14, 29, -47, 62, -63, 36, 33, -153, 328, -548, 790, -1017, 1177, -1180, 745, 14431, 2941, -2060, 1559, -1134, 757, -441, 198, -32, -64, 102, -102, 80, -52, 28, -11, 3 },
+    { -14, 29, -47, 61, -61, 33, 37, -158, 332, -550, 788, -1009, 1157, -1139, 659, 14413, 3043, -2095, 1571, -1135, 753, -435, 191, -26, -68, 105, -103, 81, -52, 28, -11, 3 },
+    { -14, 29, -46, 60, -59, 30, 41, -162, 337, -553, 787, -1000, 1136, -1099, 573, 14394, 3147, -2129, 1583, -1136, 748, -428, 185, -20, -72, 108, -104, 81, -52, 28, -11, 3 },
+    { -14, 28, -46, 59, -57, 27, 44, -167, 341, -555, 785, -991, 1115, -1058, 488, 14373, 3250, -2163, 1594, -1136, 743, -421, 178, -14, -76, 110, -106, 82, -52, 27, -11, 2 },
+    { -14, 28, -45, 58, -56, 24, 48, -171, 345, -557, 783, -981, 1094, -1017, 403, 14351, 3355, -2197, 1605, -1136, 738, -414, 170, -8, -81, 113, -107, 82, -52, 27, -11, 2 },
+    { -14, 28, -45, 57, -54, 21, 52, -176, 349, -559, 780, -971, 1073, -977, 320, 14328, 3459, -2230, 1616, -1136, 733, -407, 163, -3, -85, 115, -108, 83, -52, 27, -10, 2 },
+    { -14, 28, -45, 56, -52, 19, 56, -180, 352, -560, 777, -962, 1051, -936, 237, 14303, 3564, -2263, 1626, -1135, 727, -399, 156, 3, -89, 118, -110, 83, -52, 27, -10, 2 },
+    { -14, 28, -44, 55, -50, 16, 60, -184, 356, -562, 775, -951, 1029, -895, 156, 14276, 3670, -2295, 1635, -1134, 721, -392, 149, 9, -93, 121, -111, 83, -52, 27, -10, 2 },
+    { -14, 28, -44, 54, -48, 13, 64, -188, 359, -563, 771, -941, 1007, -854, 75, 14249, 3776, -2326, 1644, -1133, 715, -384, 141, 15, -98, 123, -112, 84, -52, 26, -10, 2 },
+    { -14, 28, -43, 53, -46, 10, 67, -192, 363, -564, 768, -930, 985, -813, -5, 14219, 3882, -2358, 1653, -1132, 709, -376, 134, 21, -102, 126, -114, 84, -52, 26, -10, 2 },
+    { -14, 28, -43, 52, -44, 7, 71, -196, 366, -565, 764, -919, 963, -773, -84, 14189, 3988, -2388, 1661, -1130, 702, -368, 127, 27, -106, 128, -115, 84, -52, 26, -9, 2 },
+    { -14, 27, -42, 51, -42, 4, 75, -200, 369, -566, 761, -908, 940, -732, -162, 14157, 4095, -2419, 1669, -1127, 696, -360, 119, 33, -110, 131, -116, 85, -52, 26, -9, 2 },
+    { -14, 27, -42, 49, -40, 1, 78, -204, 372, -567, 757, -897, 917, -691, -239, 14123, 4203, -2448, 1676, -1125, 689, -352, 111, 39, -114, 133, -117, 85, -52, 25, -9, 1 },
+    { -14, 27, -41, 48, -38, -2, 82, -208, 375, -567, 752, -885, 895, -650, -315, 14088, 4310, -2477, 1683, -1122, 681, -343, 104, 45, -119, 136, -118, 85, -52, 25, -9, 1 },
+    { -14, 27, -41, 47, -36, -4, 85, -211, 378, -567, 748, -873, 871, -610, -391, 14052, 4418, -2506, 1689, -1118, 674, -335, 96, 51, -123, 138, -119, 86, -51, 25, -8, 1 },
+    { -14, 27, -40, 46, -34, -7, 89, -215, 380, -567, 743, -861, 848, -569, -465, 14014, 4526, -2534, 1695, -1114, 666, -326, 88, 58, -127, 140, -120, 86, -51, 25, -8, 1 },
+    { -14, 27, -39, 45, -32, -10, 92, -219, 383, -567, 739, -849, 825, -529, -538, 13975, 4635, -2561, 1701, -1110, 658, -317, 80, 64, -131, 143, -121, 86, -51, 24, -8, 1 },
+    { -14, 26, -39, 44, -30, -13, 96, -222, 385, -567, 733, -836, 801, -488, -611, 13935, 4744, -2588, 1705, -1106, 650, -308, 72, 70, -135, 145, -122, 86, -51, 24, -8, 1 },
+    { -14, 26, -38, 43, -29, -16, 99, -225, 388, -566, 728, -823, 778, -448, -682, 13893, 4853, -2615, 1710, -1101, 641, -299, 64, 76, -139, 147, -123, 86, -51, 24, -8, 1 },
+    { -14, 26, -38, 41, -27, -18, 102, -229, 390, -566, 723, -810, 754, -408, -753, 13850, 4962, -2640, 1714, -1096, 632, -290, 56, 82, -143, 149, -124, 86, -50, 23, -7, 0 },
+    { -14, 26, -37, 40, -25, -21, 106, -232, 392, -565, 717, -797, 730, -368, -822, 13805, 5071, -2665, 1717, -1090, 623, -281, 48, 88, -147, 151, -125, 86, -50, 23, -7, 0 },
+    { -14, 25, -37, 39, -23, -24, 109, -235, 394, -564, 711, -784, 706, -328, -891, 13760, 5181, -2690, 1720, -1084, 614, -271, 40, 94, -151, 154, -126, 86, -50, 23, -7, 0 },
+    { -13, 25, -36, 38, -21, -26, 112, -238, 395, -563, 705, -770, 682, -288, -958, 13712, 5290, -2714, 1722, -1078, 605, -262, 32, 100, -155, 156, -126, 86, -49, 22, -6, 0 },
+    { -13, 25, -35, 37, -19, -29, 115, -241, 397, -562, 699, -757, 658, -248, -1025, 13664, 5400, -2737, 1724, -1071, 595, -252, 24, 106, -159, 158, -127, 86, -49, 22, -6, 0 },
+    { -13, 25, -35, 36, -17, -32, 118, -244, 398, -560, 692, -743, 633, -209, -1090, 13614, 5510, -2759, 1725, -1064, 586, -242, 15, 112, -162, 160, -128, 86, -49, 21, -6, 0 },
+    { -13, 24, -34, 34, -15, -34, 121, -246, 400, -558, 686, -729, 609, -170, -1155, 13563, 5620, -2781, 1726, -1057, 575, -232, 7, 118, -166, 162, -129, 86, -48, 21, -6, 0 },
+    { -13, 24, -33, 33, -13, -37, 124, -249, 401, -557, 679, -715, 584, -130, -1218, 13510, 5730, -2802, 1726, -1049, 565, -222, -1, 124, -170, 164, -129, 86, -48, 21, -5, -1 },
+    { -13, 24, -33, 32, -11, -40, 127, -252, 402, -555, 672, -700, 560, -92, -1280, 13457, 5840, -2822, 1726, -1041, 555, -212, -9, 130, -174, 166, -130, 86, -48, 20, -5, -1 },
+    { -13, 24, -32, 31, -9, -42, 130, -254, 403, -553, 665, -686, 535, -53, -1342, 13402, 5951, -2842, 1725, -1033, 544, -202, -18, 136, -177, 167, -130, 86, -47, 20, -5, -1 },
+    { -13, 23, -32, 29, -7, -45, 133, -257, 404, -550, 657, -671, 511, -14, -1402, 13345, 6061, -2861, 1724, -1024, 533, -192, -26, 142, -181, 169, -131, 86, -47, 19, -4, -1 },
+    { -13, 23, -31, 28, -5, -47, 136, -259, 405, -548, 650, -656, 486, 24, -1461, 13288, 6171, -2879, 1722, -1015, 522, -181, -35, 148, -185, 171, -131, 86, -46, 19, -4, -1 },
+    { -13, 23, -30, 27, -4, -50, 139, -261, 405, -545, 642, -642, 461, 62, -1520, 13229, 6281, -2897, 1719, -1006, 511, -171, -43, 154, -188, 173, -132, 85, -46, 19, -4, -1 },
+    { -13, 23, -30, 26, -2, -52, 141, -263, 406, -542, 634, -626, 437, 100, -1577, 13169, 6392, -2914, 1717, -996, 499, -160, -51, 160, -192, 174, -132, 85, -45, 18, -4, -1 },
+    { -13, 22, -29, 25, 0, -55, 144, -265, 406, -540, 626, -611, 412, 137, -1633, 13108, 6502, -2930, 1713, -986, 488, -149, -60, 166, -195, 176, -133, 85, -45, 18, -3, -2 },
+    { -13, 22, -28, 23, 2, -57, 146, -267, 406, -536, 618, -596, 387, 174, -1688, 13045, 6612, -2945, 1709, -975, 476, -139, -68, 172, -199, 178, -133, 85, -44, 17, -3, -2 },
+    { -12, 22, -27, 22, 4, -59, 149, -269, 406, -533, 610, -580, 362, 211, -1742, 12981, 6722, -2959, 1704, -964, 464, -128, -77, 177, -202, 179, -133, 84, -44, 17, -3, -2 },
+    { -12, 21, -27, 21, 6, -62, 151, -271, 406, -530, 601, -565, 338, 248, -1795, 12916, 6832, -2973, 1699, -953, 451, -117, -85, 183, -205, 181, -134, 84, -43, 16, -2, -2 },
+    { -12, 21, -26, 20, 8, -64, 154, -273, 406, -526, 593, -549, 313, 284, -1847, 12850, 6942, -2986, 1694, -942, 439, -106, -94, 189, -209, 182, -134, 84, -43, 16, -2, -2 },
+    { -12, 21, -25, 18, 9, -66, 156, -274, 406, -523, 584, -533, 288, 320, -1898, 12783, 7052, -2998, 1687, -930, 426, -95, -102, 195, -212, 183, -134, 83, -42, 15, -2, -2 },
+    { -12, 20, -25, 17, 11, -69, 158, -276, 405, -519, 575, -518, 263, 356, -1947, 12715, 7161, -3009, 1680, -918, 413, -83, -111, 200, -215, 185, -134, 83, -41, 15, -1, -3 },
+    { -12, 20, -24, 16, 13, -71, 161, -277, 405, -515, 566, -502, 239, 391, -1996, 12645, 7271, -3019, 1673, -905, 400, -72, -119, 206, -218, 186, -134, 82, -41, 14, -1, -3 },
+    { -12, 20, -23, 15, 15, -73, 163, -279, 404, -511, 557, -485, 214, 426, -2043, 12574, 7380, -3028, 1665, -892, 387, -61, -128, 212, -221, 187, -134, 82, -40, 14, -1, -3 },
+    { -12, 19, -23, 14, 17, -75, 165, -280, 403, -506, 547, -469, 190, 461, -2090, 12503, 7489, -3037, 1657, -879, 374, -50, -136, 217, -224, 188, -134, 81, -40, 13, 0, -3 },
+    { -12, 19, -22, 12, 18, -77, 167, -281, 403, -502, 538, -453, 165, 495, -2135, 12430, 7598, -3045, 1648, -866, 360, -38, -145, 223, -227, 189, -134, 81, -39, 13, 0, -3 },
+    { -11, 19, -21, 11, 20, -80, 169, -282, 402, -498, 528, -437, 141, 530, -2180, 12356, 7706, -3052, 1638, -852, 347, -27, -153, 228, -230, 191, -134, 80, -38, 12, 0, -3 },
+    { -11, 18, -20, 10, 22, -82, 171, -283, 400, -493, 518, -420, 116, 563, -2223, 12280, 7815, -3058, 1628, -838, 333, -15, -162, 233, -233, 192, -134, 79, -37, 11, 1, -4 },
+    { -11, 18, -20, 9, 24, -84, 173, -284, 399, -488, 508, -404, 92, 596, -2265, 12204, 7923, -3063, 1617, -823, 319, -4, -170, 239, -236, 192, -134, 79, -37, 11, 1, -4 },
+    { -11, 18, -19, 7, 25, -86, 175, -285, 398, -483, 498, -388, 68, 629, -2306, 12127, 8030, -3067, 1606, -808, 305, 8, -179, 244, -239, 193, -134, 78, -36, 10, 1, -4 },
+    { -11, 17, -18, 6, 27, -88, 176, -286, 396, -478, 488, -371, 44, 662, -2346, 12049, 8138, -3070, 1595, -793, 290, 20, -187, 249, -241, 194, -134, 77, -35, 10, 2, -4 },
+    { -11, 17, -18, 5, 29, -89, 178, -286, 395, -473, 478, -354, 20, 694, -2385, 11970, 8245, -3073, 1582, -778, 276, 31, -195, 255, -244, 195, -133, 77, -35, 9, 2, -4 },
+    { -11, 17, -17, 4, 30, -91, 180, -287, 393, -468, 468, -338, -4, 726, -2423, 11889, 8352, -3074, 1569, -762, 261, 43, -204, 260, -246, 196, -133, 76, -34, 8, 3, -4 },
+    { -10, 16, -16, 3, 32, -93, 181, -287, 391, -462, 457, -321, -28, 757, -2459, 11808, 8458, -3075, 1556, -746, 247, 55, -212, 265, -249, 196, -133, 75, -33, 8, 3, -5 },
+    { -10, 16, -15, 2, 33, -95, 183, -287, 389, -457, 447, -304, -52, 788, -2495, 11726, 8564, -3074, 1542, -730, 232, 67, -220, 270, -251, 197, -132, 74, -32, 7, 3, -5 },
+    { -10, 15, -15, 0, 35, -97, 184, -288, 387, -451, 436, -288, -76, 819, -2529, 11642, 8670, -3073, 1527, -713, 217, 78, -228, 275, -254, 198, -132, 73, -31, 7, 4, -5 },
+    { -10, 15, -14, -1, 37, -99, 186, -288, 385, -445, 425, -271, -99, 849, -2563, 11558, 8775, -3071, 1512, -696, 202, 90, -237, 280, -256, 198, -131, 73, -30, 6, 4, -5 },
+    { -10, 15, -13, -2, 38, -100, 187, -288, 383, -439, 415, -254, -122, 878, -2595, 11473, 8879, -3068, 1497, -679, 186, 102, -245, 284, -258, 198, -131, 72, -30, 5, 4, -5 },
+    { -10, 14, -13, -3, 40, -102, 188, -288, 380, -433, 404, -237, -146, 908, -2626, 11387, 8984, -3063, 1481, -661, 171, 114, -253, 289, -260, 199, -130, 71, -29, 5, 5, -5 },
+    { -10, 14, -12, -4, 41, -104, 189, -288, 378, -427, 393, -221, -169, 936, -2657, 11300, 9087, -3058, 1464, -644, 156, 126, -261, 294, -262, 199, -130, 70, -28, 4, 5, -6 },
+    { -9, 14, -11, -5, 43, -105, 190, -288, 375, -421, 382, -204, -191, 965, -2686, 11212, 9191, -3052, 1447, -626, 140, 138, -269, 298, -264, 199, -129, 69, -27, 3, 6, -6 },
+    { -9, 13, -10, -7, 44, -107, 191, -287, 373, -414, 371, -187, -214, 993, -2714, 11123, 9293, -3045, 1429, -607, 124, 150, -277, 303, -266, 200, -128, 68, -26, 3, 6, -6 },
+    { -9, 13, -10, -8, 46, -108, 192, -287, 370, -408, 359, -170, -237, 1020, -2741, 11034, 9396, -3037, 1410, -589, 109, 161, -285, 307, -268, 200, -127, 67, -25, 2, 6, -6 },
+    { -9, 12, -9, -9, 47, -110, 193, -287, 367, -401, 348, -153, -259, 1047, -2766, 10943, 9497, -3028, 1392, -570, 93, 173, -293, 312, -270, 200, -127, 66, -24, 2, 7, -6 },
+    { -9, 12, -8, -10, 49, -111, 194, -286, 364, -395, 337, -137, -281, 1073, -2791, 10852, 9598, -3017, 1372, -551, 77, 185, -300, 316, -271, 200, -126, 65, -23, 1, 7, -7 },
+    { -9, 12, -7, -11, 50, -112, 195, -285, 361, -388, 325, -120, -303, 1099, -2815, 10760, 9699, -3006, 1352, -531, 61, 197, -308, 320, -273, 200, -125, 64, -22, 0, 7, -7 },
+    { -8, 11, -7, -12, 51, -114, 196, -285, 357, -381, 314, -103, -325, 1125, -2838, 10667, 9799, -2994, 1332, -512, 45, 209, -316, 324, -275, 200, -124, 63, -21, -1, 8, -7 },
+    { -8, 11, -6, -13, 53, -115, 197, -284, 354, -374, 302, -87, -347, 1150, -2859, 10574, 9898, -2981, 1311, -492, 28, 221, -323, 328, -276, 199, -123, 61, -20, -1, 8, -7 },
+    { -8, 11, -5, -14, 54, -116, 197, -283, 351, -367, 291, -70, -368, 1174, -2880, 10479, 9996, -2966, 1289, -472, 12, 232, -331, 332, -277, 199, -122, 60, -19, -2, 9, -7 },
+    { -8, 10, -5, -15, 55, -118, 198, -282, 347, -360, 279, -54, -389, 1198, -2899, 10384, 10094, -2951, 1267, -452, -4, 244, -338, 336, -279, 199, -121, 59, -18, -3, 9, -7 },
+    { -8, 10, -4, -16, 57, -119, 198, -281, 344, -353, 268, -37, -410, 1222, -2918, 10288, 10192, -2935, 1245, -431, -21, 256, -346, 340, -280, 199, -120, 58, -17, -3, 9, -8 },
+    { -8, 9, -3, -17, 58, -120, 199, -280, 340, -346, 256, -21, -431, 1245, -2935, 10192, 10288, -2918, 1222, -410, -37, 268, -353, 344, -281, 198, -119, 57, -16, -4, 10, -8 },
+    { -7, 9, -3, -18, 59, -121, 199, -279, 336, -338, 244, -4, -452, 1267, -2951, 10094, 10384, -2899, 1198, -389, -54, 279, -360, 347, -282, 198, -118, 55, -15, -5, 10, -8 },
+    { -7, 9, -2, -19, 60, -122, 199, -277, 332, -331, 232, 12, -472, 1289, -2966, 9996, 10479, -2880, 1174, -368, -70, 291, -367, 351, -283, 197, -116, 54, -14, -5, 11, -8 },
+    { -7, 8, -1, -20, 61, -123, 199, -276, 328, -323, 221, 28, -492, 1311, -2981, 9898, 10574, -2859, 1150, -347, -87, 302, -374, 354, -284, 197, -115, 53, -13, -6, 11, -8 },
+    { -7, 8, -1, -21, 63, -124, 200, -275, 324, -316, 209, 45, -512, 1332, -2994, 9799, 10667, -2838, 1125, -325, -103, 314, -381, 357, -285, 196, -114, 51, -12, -7, 11, -8 },
+    { -7, 7, 0, -22, 64, -125, 200, -273, 320, -308, 197, 61, -531, 1352, -3006, 9699, 10760, -2815, 1099, -303, -120, 325, -388, 361, -285, 195, -112, 50, -11, -7, 12, -9 },
+    { -7, 7, 1, -23, 65, -126, 200, -271, 316, -300, 185, 77, -551, 1372, -3017, 9598, 10852, -2791, 1073, -281, -137, 337, -395, 364, -286, 194, -111, 49, -10, -8, 12, -9 },
+    { -6, 7, 2, -24, 66, -127, 200, -270, 312, -293, 173, 93, -570, 1392, -3028, 9497, 10943, -2766, 1047, -259, -153, 348, -401, 367, -287, 193, -110, 47, -9, -9, 12, -9 },
+    { -6, 6, 2, -25, 67, -127, 200, -268, 307, -285, 161, 109, -589, 1410, -3037, 9396, 11034, -2741, 1020, -237, -170, 359, -408, 370, -287, 192, -108, 46, -8, -10, 13, -9 },
+    { -6, 6, 3, -26, 68, -128, 200, -266, 303, -277, 150, 124, -607, 1429, -3045, 9293, 11123, -2714, 993, -214, -187, 371, -414, 373, -287, 191, -107, 44, -7, -10, 13, -9 },
+    { -6, 6, 3, -27, 69, -129, 199, -264, 298, -269, 138, 140, -626, 1447, -3052, 9191, 11212, -2686, 965, -191, -204, 382, -421, 375, -288, 190, -105, 43, -5, -11, 14, -9 },
+    { -6, 5, 4, -28, 70, -130, 199, -262, 294, -261, 126, 156, -644, 1464, -3058, 9087, 11300, -2657, 936, -169, -221, 393, -427, 378, -288, 189, -104, 41, -4, -12, 14, -10 },
+    { -5, 5, 5, -29, 71, -130, 199, -260, 289, -253, 114, 171, -661, 1481, -3063, 8984, 11387, -2626, 908, -146, -237, 404, -433, 380, -288, 188, -102, 40, -3, -13, 14, -10 },
+    { -5, 4, 5, -30, 72, -131, 198, -258, 284, -245, 102, 186, -679, 1497, -3068, 8879, 11473, -2595, 878, -122, -254, 415, -439, 383, -288, 187, -100, 38, -2, -13, 15, -10 },
+    { -5, 4, 6, -30, 73, -131, 198, -256, 280, -237, 90, 202, -696, 1512, -3071, 8775, 11558, -2563, 849, -99, -271, 425, -445, 385, -288, 186, -99, 37, -1, -14, 15, -10 },
+    { -5, 4, 7, -31, 73, -132, 198, -254, 275, -228, 78, 217, -713, 1527, -3073, 8670, 11642, -2529, 819, -76, -288, 436, -451, 387, -288, 184, -97, 35, 0, -15, 15, -10 },
+    { -5, 3, 7, -32, 74, -132, 197, -251, 270, -220, 67, 232, -730, 1542, -3074, 8564, 11726, -2495, 788, -52, -304, 447, -457, 389, -287, 183, -95, 33, 2, -15, 16, -10 },
+    { -5, 3, 8, -33, 75, -133, 196, -249, 265, -212, 55, 247, -746, 1556, -3075, 8458, 11808, -2459, 757, -28, -321, 457, -462, 391, -287, 181, -93, 32, 3, -16, 16, -10 },
+    { -4, 3, 8, -34, 76, -133, 196, -246, 260, -204, 43, 261, -762, 1569, -3074, 8352, 11889, -2423, 726, -4, -338, 468, -468, 393, -287, 180, -91, 30, 4, -17, 17, -11 },
+    { -4, 2, 9, -35, 77, -133, 195, -244, 255, -195, 31, 276, -778, 1582, -3073, 8245, 11970, -2385, 694, 20, -354, 478, -473, 395, -286, 178, -89, 29, 5, -18, 17, -11 },
+    { -4, 2, 10, -35, 77, -134, 194, -241, 249, -187, 20, 290, -793, 1595, -3070, 8138, 12049, -2346, 662, 44, -371, 488, -478, 396, -286, 176, -88, 27, 6, -18, 17, -11 },
+    { -4, 1, 10, -36, 78, -134, 193, -239, 244, -179, 8, 305, -808, 1606, -3067, 8030, 12127, -2306, 629, 68, -388, 498, -483, 398, -285, 175, -86, 25, 7, -19, 18, -11 },
+    { -4, 1, 11, -37, 79, -134, 192, -236, 239, -170, -4, 319, -823, 1617, -3063, 7923, 12204, -2265, 596, 92, -404, 508, -488, 399, -284, 173, -84, 24, 9, -20, 18, -11 },
+    { -4, 1, 11, -37, 79, -134, 192, -233, 233, -162, -15, 333, -838, 1628, -3058, 7815, 12280, -2223, 563, 116, -420, 518, -493, 400, -283, 171, -82, 22, 10, -20, 18, -11 },
+    { -3, 0, 12, -38, 80, -134, 191, -230, 228, -153, -27, 347, -852, 1638, -3052, 7706, 12356, -2180, 530, 141, -437, 528, -498, 402, -282, 169, -80, 20, 11, -21, 19, -11 },
+    { -3, 0, 13, -39, 81, -134, 189, -227, 223, -145, -38, 360, -866, 1648, -3045, 7598, 12430, -2135, 495, 165, -453, 538, -502, 403, -281, 167, -77, 18, 12, -22, 19, -12 },
+    { -3, 0, 13, -40, 81, -134, 188, -224, 217, -136, -50, 374, -879, 1657, -3037, 7489, 12503, -2090, 461, 190, -469, 547, -506, 403, -280, 165, -75, 17, 14, -23, 19, -12 },
+    { -3, -1, 14, -40, 82, -134, 187, -221, 212, -128, -61, 387, -892, 1665, -3028, 7380, 12574, -2043, 426, 214, -485, 557, -511, 404, -279, 163, -73, 15, 15, -23, 20, -12 },
+    { -3, -1, 14, -41, 82, -134, 186, -218, 206, -119, -72, 400, -905, 1673, -3019, 7271, 12645, -1996, 391, 239, -502, 566, -515, 405, -277, 161, -71, 13, 16, -24, 20, -12 },
+    { -3, -1, 15, -41, 83, -134, 185, -215, 200, -111, -83, 413, -918, 1680, -3009, 7161, 12715, -1947, 356, 263, -518, 575, -519, 405, -276, 158, -69, 11, 17, -25, 20, -12 },
+    { -2, -2, 15, -42, 83, -134, 183, -212, 195, -102, -95, 426, -930, 1687, -2998, 7052, 12783, -1898, 320, 288, -533, 584, -523, 406, -274, 156, -66, 9, 18, -25, 21, -12 },
+    { -2, -2, 16, -43, 84, -134, 182, -209, 189, -94, -106, 439, -942, 1694, -2986, 6942, 12850, -1847, 284, 313, -549, 593, -526, 406, -273, 154, -64, 8, 20, -26, 21, -12 },
+    { -2, -2, 16, -43, 84, -134, 181, -205, 183, -85, -117, 451, -953, 1699, -2973, 6832, 12916, -1795, 248, 338, -565, 601, -530, 406, -271, 151, -62, 6, 21, -27, 21, -12 },
+    { -2, -3, 17, -44, 84, -133, 179, -202, 177, -77, -128, 464, -964, 1704, -2959, 6722, 12981, -1742, 211, 362, -580, 610, -533, 406, -269, 149, -59, 4, 22, -27, 22, -12 },
+    { -2, -3, 17, -44, 85, -133, 178, -199, 172, -68, -139, 476, -975, 1709, -2945, 6612, 13045, -1688, 174, 387, -596, 618, -536, 406, -267, 146, -57, 2, 23, -28, 22, -13 },
+    { -2, -3, 18, -45, 85, -133, 176, -195, 166, -60, -149, 488, -986, 1713, -2930, 6502, 13108, -1633, 137, 412, -611, 626, -540, 406, -265, 144, -55, 0, 25, -29, 22, -13 },
+    { -1, -4, 18, -45, 85, -132, 174, -192, 160, -51, -160, 499, -996, 1717, -2914, 6392, 13169, -1577, 100, 437, -626, 634, -542, 406, -263, 141, -52, -2, 26, -30, 23, -13 },
+    { -1, -4, 19, -46, 85, -132, 173, -188, 154, -43, -171, 511, -1006, 1719, -2897, 6281, 13229, -1520, 62, 461, -642, 642, -545, 405, -261, 139, -50, -4, 27, -30, 23, -13 },
+    { -1, -4, 19, -46, 86, -131, 171, -185, 148, -35, -181, 522, -1015, 1722, -2879, 6171, 13288, -1461, 24, 486, -656, 650, -548, 405, -259, 136, -47, -5, 28, -31, 23, -13 },
+    { -1, -4, 19, -47, 86, -131, 169, -181, 142, -26, -192, 533, -1024, 1724, -2861, 6061, 13345, -1402, -14, 511, -671, 657, -550, 404, -257, 133, -45, -7, 29, -32, 23, -13 },
+    { -1, -5, 20, -47, 86, -130, 167, -177, 136, -18, -202, 544, -1033, 1725, -2842, 5951, 13402, -1342, -53, 535, -686, 665, -553, 403, -254, 130, -42, -9, 31, -32, 24, -13 },
+    { -1, -5, 20, -48, 86, -130, 166, -174, 130, -9, -212, 555, -1041, 1726, -2822, 5840, 13457, -1280, -92, 560, -700, 672, -555, 402, -252, 127, -40, -11, 32, -33, 24, -13 },
+    { -1, -5, 21, -48, 86, -129, 164, -170, 124, -1, -222, 565, -1049, 1726, -2802, 5730, 13510, -1218, -130, 584, -715, 679, -557, 401, -249, 124, -37, -13, 33, -33, 24, -13 },
+    { 0, -6, 21, -48, 86, -129, 162, -166, 118, 7, -232, 575, -1057, 1726, -2781, 5620, 13563, -1155, -170, 609, -729, 686, -558, 400, -246, 121, -34, -15, 34, -34, 24, -13 },
+    { 0, -6, 21, -49, 86, -128, 160, -162, 112, 15, -242, 586, -1064, 1725, -2759, 5510, 13614, -1090, -209, 633, -743, 692, -560, 398, -244, 118, -32, -17, 36, -35, 25, -13 },
+    { 0, -6, 22, -49, 86, -127, 158, -159, 106, 24, -252, 595, -1071, 1724, -2737, 5400, 13664, -1025, -248, 658, -757, 699, -562, 397, -241, 115, -29, -19, 37, -35, 25, -13 },
+    { 0, -6, 22, -49, 86, -126, 156, -155, 100, 32, -262, 605, -1078, 1722, -2714, 5290, 13712, -958, -288, 682, -770, 705, -563, 395, -238, 112, -26, -21, 38, -36, 25, -13 },
+    { 0, -7, 23, -50, 86, -126, 154, -151, 94, 40, -271, 614, -1084, 1720, -2690, 5181, 13760, -891, -328, 706, -784, 711, -564, 394, -235, 109, -24, -23, 39, -37, 25, -14 },
+    { 0, -7, 23, -50, 86, -125, 151, -147, 88, 48, -281, 623, -1090, 1717, -2665, 5071, 13805, -822, -368, 730, -797, 717, -565, 392, -232, 106, -21, -25, 40, -37, 26, -14 },
+    { 0, -7, 23, -50, 86, -124, 149, -143, 82, 56, -290, 632, -1096, 1714, -2640, 4962, 13850, -753, -408, 754, -810, 723, -566, 390, -229, 102, -18, -27, 41, -38, 26, -14 },
+    { 1, -8, 24, -51, 86, -123, 147, -139, 76, 64, -299, 641, -1101, 1710, -2615, 4853, 13893, -682, -448, 778, -823, 728, -566, 388, -225, 99, -16, -29, 43, -38, 26, -14 },
+    { 1, -8, 24, -51, 86, -122, 145, -135, 70, 72, -308, 650, -1106, 1705, -2588, 4744, 13935, -611, -488, 801, -836, 733, -567, 385, -222, 96, -13, -30, 44, -39, 26, -14 },
+    { 1, -8, 24, -51, 86, -121, 143, -131, 64, 80, -317, 658, -1110, 1701, -2561, 4635, 13975, -538, -529, 825, -849, 739, -567, 383, -219, 92, -10, -32, 45, -39, 27, -14 },
+    { 1, -8, 25, -51, 86, -120, 140, -127, 58, 88, -326, 666, -1114, 1695, -2534, 4526, 14014, -465, -569, 848, -861, 743, -567, 380, -215, 89, -7, -34, 46, -40, 27, -14 },
+    { 1, -8, 25, -51, 86, -119, 138, -123, 51, 96, -335, 674, -1118, 1689, -2506, 4418, 14052, -391, -610, 871, -873, 748, -567, 378, -211, 85, -4, -36, 47, -41, 27, -14 },
+    { 1, -9, 25, -52, 85, -118, 136, -119, 45, 104, -343, 681, -1122, 1683, -2477, 4310, 14088, -315, -650, 895, -885, 752, -567, 375, -208, 82, -2, -38, 48, -41, 27, -14 },
+    { 1, -9, 25, -52, 85, -117, 133, -114, 39, 111, -352, 689, -1125, 1676, -2448, 4203, 14123, -239, -691, 917, -897, 757, -567, 372, -204, 78, 1, -40, 49, -42, 27, -14 },
+    { 2, -9, 26, -52, 85, -116, 131, -110, 33, 119, -360, 696, -1127, 1669, -2419, 4095, 14157, -162, -732, 940, -908, 761, -566, 369, -200, 75, 4, -42, 51, -42, 27, -14 },
+    { 2, -9, 26, -52, 84, -115, 128, -106, 27, 127, -368, 702, -1130, 1661, -2388, 3988, 14189, -84, -773, 963, -919, 764, -565, 366, -196, 71, 7, -44, 52, -43, 28, -14 },
+    { 2, -10, 26, -52, 84, -114, 126, -102, 21, 134, -376, 709, -1132, 1653, -2358, 3882, 14219, -5, -813, 985, -930, 768, -564, 363, -192, 67, 10, -46, 53, -43, 28, -14 },
+    { 2, -10, 26, -52, 84, -112, 123, -98, 15, 141, -384, 715, -1133, 1644, -2326, 3776, 14249, 75, -854, 1007, -941, 771, -563, 359, -188, 64, 13, -48, 54, -44, 28, -14 },
+    { 2, -10, 27, -52, 83, -111, 121, -93, 9, 149, -392, 721, -1134, 1635, -2295, 3670, 14276, 156, -895, 1029, -951, 775, -562, 356, -184, 60, 16, -50, 55, -44, 28, -14 },
+    { 2, -10, 27, -52, 83, -110, 118, -89, 3, 156, -399, 727, -1135, 1626, -2263, 3564, 14303, 237, -936, 1051, -962, 777, -560, 352, -180, 56, 19, -52, 56, -45, 28, -14 },
+    { 2, -10, 27, -52, 83, -108, 115, -85, -3, 163, -407, 733, -1136, 1616, -2230, 3459, 14328, 320, -977, 1073, -971, 780, -559, 349, -176, 52, 21, -54, 57, -45, 28, -14 },
+    { 2, -11, 27, -52, 82, -107, 113, -81, -8, 170, -414, 738, -1136, 1605, -2197, 3355, 14351, 403, -1017, 1094, -981, 783, -557, 345, -171, 48, 24, -56, 58, -45, 28, -14 },
+    { 2, -11, 27, -52, 82, -106, 110, -76, -14, 178, -421, 743, -1136, 1594, -2163, 3250, 14373, 488, -1058, 1115, -991, 785, -555, 341, -167, 44, 27, -57, 59, -46, 28, -14 },
+    { 3, -11, 28, -52, 81, -104, 108, -72, -20, 185, -428, 748, -1136, 1583, -2129, 3147, 14394, 573, -1099, 1136, -1000, 787, -553, 337, -162, 41, 30, -59, 60, -46, 29, -14 },
+    { 3, -11, 28, -52, 81, -103, 105, -68, -26, 191, -435, 753, -1135, 1571, -2095, 3043, 14413, 659, -1139, 1157, -1009, 788, -550, 332, -158, 37, 33, -61, 61, -47, 29, -14 },
+    { 3, -11, 28, -52, 80, -102, 102, -64, -32, 198, -441, 757, -1134, 1559, -2060, 2941, 14431, 745, -1180, 1177, -1017, 790, -548, 328, -153, 33, 36, -63, 62, -47, 29, -14 },
+    { 3, -11, 28, -52, 80, -100, 99, -59, -38, 205, -448, 762, -1132, 1546, -2025, 2838, 14447, 833, -1220, 1197, -1026, 791, -545, 324, -149, 29, 39, -65, 63, -47, 29, -14 },
+    { 3, -12, 28, -52, 79, -99, 97, -55, -43, 212, -454, 765, -1130, 1533, -1990, 2737, 14462, 921, -1261, 1217, -1034, 792, -542, 319, -144, 25, 42, -67, 64, -48, 29, -14 },
+    { 3, -12, 28, -52, 78, -97, 94, -51, -49, 218, -460, 769, -1128, 1520, -1954, 2635, 14475, 1011, -1301, 1237, -1042, 793, -539, 314, -139, 21, 45, -69, 65, -48, 29, -13 },
+    { 3, -12, 28, -52, 78, -96, 91, -47, -55, 225, -466, 772, -1126, 1506, -1917, 2535, 14487, 1101, -1341, 1256, -1049, 794, -536, 310, -134, 16, 48, -70, 66, -49, 29, -13 },
+    { 3, -12, 28, -52, 77, -94, 88, -42, -60, 231, -472, 776, -1123, 1492, -1881, 2435, 14497, 1191, -1381, 1275, -1056, 794, -533, 305, -129, 12, 51, -72, 67, -49, 29, -13 },
+    { 3, -12, 29, -52, 76, -92, 85, -38, -66, 237, -478, 778, -1119, 1477, -1844, 2335, 14506, 1283, -1421, 1293, -1063, 794, -529, 300, -124, 8, 54, -74, 68, -49, 29, -13 },
+    { 3, -12, 29, -52, 76, -91, 83, -34, -71, 243, -483, 781, -1116, 1462, -1807, 2236, 14513, 1375, -1460, 1312, -1070, 794, -525, 294, -119, 4, 57, -76, 69, -49, 29, -13 },
+    { 3, -12, 29, -51, 75, -89, 80, -30, -77, 250, -489, 784, -1112, 1447, -1769, 2138, 14519, 1468, -1500, 1330, -1076, 793, -521, 289, -114, 0, 60, -77, 69, -50, 29, -13 },
+    { 3, -13, 29, -51, 74, -88, 77, -25, -82, 255, -494, 786, -1108, 1431, -1732, 2040, 14524, 1562, -1539, 1348, -1082, 793, -517, 284, -109, -4, 62, -79, 70, -50, 29, -13 },
+    { 4, -13, 29, -51, 73, -86, 74, -21, -88, 261, -499, 788, -1104, 1415, -1694, 1943, 14527, 1656, -1578, 1365, -1088, 792, -513, 278, -104, -8, 65, -81, 71, -50, 29, -13 },
+    { 4, -13, 29, -51, 73, -84, 71, -17, -93, 267, -504, 789, -1099, 1399, -1655, 1847, 14528, 1751, -1617, 1382, -1094, 791, -508, 273, -98, -13, 68, -83, 72, -51, 29, -13 },
+};
+
+const resampler_ratio_t resampler_ratios[RESAMPLER_RATIO_NUM] = {
+    { 22050, 44100, 2, 1, s_phases_22050_44100 },
+    { 32000, 44100, 441, 320, s_phases_32000_44100 },
+    { 48000, 44100, 147, 160, s_phases_48000_44100 },
+    { 22050, 48000, 320, 147, s_phases_22050_48000 },
+    { 32000, 48000, 3, 2, s_phases_32000_48000 },
+    { 44100, 48000, 160, 147, s_phases_44100_48000 },
+};
+
+/* Fractional delay at ratio 1, passband to 39% of the input rate */
+const int16_t resampler_frac_phases[RESAMPLER_FRAC_PHASES + 1][RESAMPLER_TAPS] = {
+    { -13, 29, -50, 71, -81, 66, -9, -102, 277, -512, 791, -1089, 1369, -1588, 1680, 14527, 1919, -1684, 1411, -1102, 788, -500, 263, -89, -20, 73, -86, 73, -51, 29, -13, 4 },
+    { -13, 29, -50, 69, -77, 59, 1, -115, 290, -522, 793, -1075, 1325, -1490, 1445, 14518, 2162, -1779, 1451, -1113, 783, -487, 248, -76, -31, 80, -90, 75, -51, 29, -12, 3 },
+    { -13, 29, -49, 67, -73, 51, 11, -128, 303, -532, 794, -1058, 1279, -1391, 1214, 14499, 2410, -1872, 1488, -1122, 776, -474, 232, -62, -41, 87, -94, 77, -52, 28, -12, 3 },
+    { -13, 29, -48, 65, -68, 44, 22, -140, 315, -540, 793, -1040, 1232, -1291, 988, 14472, 2661, -1963, 1523, -1129, 768, -459, 216, -48, -52, 94, -97, 78, -52, 28, -12, 3 },
+    { -14, 29, -47, 62, -63, 37, 32, -152, 327, -547, 790, -1019, 1182, -1190, 767, 14435, 2915, -2051, 1556, -1133, 758, -443, 200, -33, -63, 101, -101, 80, -52, 28, -11, 3 },
+    { -14, 28, -46, 60, -59, 29, 42, -163, 338, -553, 786, -997, 1131, -1089, 551, 14389, 3172, -2138, 1586, -1136, 747, -426, 183, -19, -73, 108, -105, 81, -52, 27, -11, 2 },
+    { -14, 28, -45, 57, -54, 22, 51, -175, 348, -558, 781, -974, 1078, -987, 341, 14334, 3433, -2222, 1613, -1136, 734, -408, 165, -4, -84, 115, -108, 82, -52, 27, -10, 2 },
+    { -14, 28, -44, 55, -49, 15, 61, -185, 357, -562, 774, -949, 1024, -885, 135, 14270, 3696, -2303, 1638, -1134, 720, -390, 147, 11, -94, 121, -111, 83, -52, 26, -10, 2 },
+    { -14, 28, -43, 52, -45, 8, 70, -195, 365, -565, 765, -922, 968, -783, -64, 14196, 3962, -2381, 1659, -1130, 704, -370, 128, 26, -105, 128, -114, 84, -52, 26, -9, 2 },
+    { -14, 27, -41, 49, -40, 1, 79, -205, 373, -567, 756, -894, 912, -681, -258, 14115, 4230, -2456, 1678, -1124, 687, -350, 109, 41, -115, 134, -117, 85, -52, 25, -9, 1 },
+    { -14, 27, -40, 46, -35, -7, 88, -214, 380, -567, 744, -864, 854, -579, -446, 14024, 4499, -2527, 1694, -1115, 668, -328, 90, 56, -126, 140, -120, 86, -51, 25, -8, 1 },
+    { -14, 26, -39, 43, -30, -13, 97, -223, 386, -567, 732, -833, 795, -478, -629, 13925, 4771, -2595, 1707, -1104, 647, -306, 70, 71, -136, 145, -122, 86, -51, 24, -8, 1 },
+    { -14, 26, -37, 41, -25, -20, 105, -231, 391, -565, 718, -800, 736, -378, -805, 13817, 5044, -2659, 1716, -1092, 626, -283, 50, 86, -146, 151, -125, 86, -50, 23, -7, 0 },
+    { -13, 25, -36, 38, -20, -27, 113, -239, 396, -562, 703, -767, 676, -278, -975, 13700, 5318, -2719, 1723, -1076, 602, -259, 30, 102, -156, 156, -127, 86, -49, 22, -6, 0 },
+    { -13, 24, -34, 35, -15, -34, 121, -246, 399, -559, 687, -732, 615, -179, -1138, 13576, 5592, -2776, 1726, -1059, 578, -235, 9, 117, -165, 161, -128, 86, -48, 21, -6, 0 },
+    { -13, 24, -33, 32, -11, -40, 128, -252, 402, -554, 670, -697, 554, -82, -1296, 13443, 5868, -2827, 1726, -1039, 552, -210, -12, 132, -175, 166, -130, 86, -47, 20, -5, -1 },
+    { -13, 23, -31, 29, -6, -47, 135, -258, 404, -548, 652, -660, 492, 14, -1447, 13302, 6143, -2875, 1722, -1017, 525, -184, -32, 147, -184, 170, -131, 86, -46, 19, -4, -1 },
+    { -13, 22, -29, 25, -1, -53, 142, -264, 406, -542, 632, -623, 430, 109, -1591, 13154, 6419, -2918, 1716, -993, 496, -157, -54, 161, -193, 175, -132, 85, -45, 18, -3, -1 },
+    { -12, 22, -28, 22, 3, -59, 148, -269, 406, -534, 612, -584, 369, 202, -1729, 12997, 6695, -2956, 1705, -967, 467, -130, -75, 176, -201, 179, -133, 84, -44, 17, -3, -2 },
+    { -12, 21, -26, 19, 8, -65, 154, -273, 406, -525, 590, -545, 307, 293, -1860, 12834, 6969, -2989, 1692, -939, 436, -103, -96, 190, -209, 182, -134, 83, -42, 16, -2, -2 },
+    { -12, 20, -24, 16, 13, -70, 160, -277, 405, -516, 568, -506, 245, 382, -1984, 12663, 7243, -3016, 1675, -908, 404, -75, -117, 205, -217, 186, -134, 82, -41, 14, -1, -3 },
+    { -12, 19, -22, 13, 17, -76, 165, -280, 403, -505, 545, -465, 183, 470, -2101, 12484, 7516, -3039, 1655, -876, 370, -47, -138, 218, -225, 188, -134, 81, -39, 13, 0, -3 },
+    { -11, 18, -21, 10, 21, -81, 170, -283, 401, -494, 521, -424, 122, 555, -2212, 12299, 7788, -3056, 1631, -841, 336, -18, -160, 232, -232, 191, -134, 79, -38, 12, 1, -4 },
+    { -11, 18, -19, 7, 26, -86, 175, -285, 397, -482, 496, -383, 62, 638, -2316, 12108, 8057, -3068, 1603, -804, 301, 11, -181, 245, -239, 193, -134, 78, -36, 10, 2, -4 },
+    { -11, 17, -17, 4, 30, -91, 179, -286, 393, -469, 470, -342, 2, 718, -2413, 11909, 8325, -3074, 1573, -766, 265, 40, -202, 258, -246, 195, -133, 76, -34, 9, 2, -4 },
+    { -10, 16, -15, 1, 34, -95, 183, -287, 389, -455, 444, -300, -58, 796, -2504, 11705, 8590, -3074, 1538, -726, 228, 70, -222, 271, -252, 197, -132, 74, -32, 7, 3, -5 },
+    { -10, 15, -13, -2, 38, -100, 186, -288, 383, -441, 417, -258, -117, 871, -2587, 11494, 8853, -3068, 1501, -683, 190, 99, -243, 283, -257, 198, -131, 72, -30, 6, 4, -5 },
+    { -9, 14, -12, -5, 42, -104, 189, -288, 377, -425, 390, -216, -174, 943, -2664, 11278, 9113, -3057, 1460, -639, 152, 129, -263, 295, -263, 199, -129, 70, -28, 4, 5, -6 },
+    { -9, 13, -10, -7, 45, -108, 192, -287, 370, -409, 362, -174, -231, 1013, -2734, 11056, 9370, -3039, 1415, -593, 113, 158, -283, 306, -267, 200, -128, 67, -25, 2, 6, -6 },
+    { -9, 12, -8, -10, 49, -111, 194, -286, 363, -393, 334, -133, -287, 1080, -2797, 10829, 9623, -3015, 1367, -546, 73, 188, -302, 317, -272, 200, -125, 64, -23, 1, 7, -7 },
+    { -8, 11, -6, -13, 52, -115, 196, -284, 355, -376, 305, -91, -341, 1144, -2854, 10597, 9873, -2984, 1316, -497, 33, 218, -321, 327, -276, 199, -123, 62, -21, -1, 8, -7 },
+    { -8, 10, -4, -15, 56, -118, 198, -282, 346, -358, 276, -49, -395, 1204, -2904, 10360, 10119, -2947, 1262, -446, -8, 247, -340, 337, -279, 199, -121, 59, -18, -3, 9, -7 },
+    { -7, 9, -3, -18, 59, -121, 199, -279, 337, -340, 247, -8, -446, 1262, -2947, 10119, 10360, -2904, 1204, -395, -49, 276, -358, 346, -282, 198, -118, 56, -15, -4, 10, -8 },
+    { -7, 8, -1, -21, 62, -123, 199, -276, 327, -321, 218, 33, -497, 1316, -2984, 9873, 10597, -2854, 1144, -341, -91, 305, -376, 355, -284, 196, -115, 52, -13, -6, 11, -8 },
+    { -7, 7, 1, -23, 64, -125, 200, -272, 317, -302, 188, 73, -546, 1367, -3015, 9623, 10829, -2797, 1080, -287, -133, 334, -393, 363, -286, 194, -111, 49, -10, -8, 12, -9 },
+    { -6, 6, 2, -25, 67, -128, 200, -267, 306, -283, 158, 113, -593, 1415, -3039, 9370, 11056, -2734, 1013, -231, -174, 362, -409, 370, -287, 192, -108, 45, -7, -10, 13, -9 },
+    { -6, 5, 4, -28, 70, -129, 199, -263, 295, -263, 129, 152, -639, 1460, -3057, 9113, 11278, -2664, 943, -174, -216, 390, -425, 377, -288, 189, -104, 42, -5, -12, 14, -9 },
+    { -5, 4, 6, -30, 72, -131, 198, -257, 283, -243, 99, 190, -683, 1501, -3068, 8853, 11494, -2587, 871, -117, -258, 417, -441, 383, -288, 186, -100, 38, -2, -13, 15, -10 },
+    { -5, 3, 7, -32, 74, -132, 197, -252, 271, -222, 70, 228, -726, 1538, -3074, 8590, 11705, -2504, 796, -58, -300, 444, -455, 389, -287, 183, -95, 34, 1, -15, 16, -10 },
+    { -4, 2, 9, -34, 76, -133, 195, -246, 258, -202, 40, 265, -766, 1573, -3074, 8325, 11909, -2413, 718, 2, -342, 470, -469, 393, -286, 179, -91, 30, 4, -17, 17, -11 },
+    { -4, 2, 10, -36, 78, -134, 193, -239, 245, -181, 11, 301, -804, 1603, -3068, 8057, 12108, -2316, 638, 62, -383, 496, -482, 397, -285, 175, -86, 26, 7, -19, 18, -11 },
+    { -4, 1, 12, -38, 79, -134, 191, -232, 232, -160, -18, 336, -841, 1631, -3056, 7788, 12299, -2212, 555, 122, -424, 521, -494, 401, -283, 170, -81, 21, 10, -21, 18, -11 },
+    { -3, 0, 13, -39, 81, -134, 188, -225, 218, -138, -47, 370, -876, 1655, -3039, 7516, 12484, -2101, 470, 183, -465, 545, -505, 403, -280, 165, -76, 17, 13, -22, 19, -12 },
+    { -3, -1, 14, -41, 82, -134, 186, -217, 205, -117, -75, 404, -908, 1675, -3016, 7243, 12663, -1984, 382, 245, -506, 568, -516, 405, -277, 160, -70, 13, 16, -24, 20, -12 },
+    { -2, -2, 16, -42, 83, -134, 182, -209, 190, -96, -103, 436, -939, 1692, -2989, 6969, 12834, -1860, 293, 307, -545, 590, -525, 406, -273, 154, -65, 8, 19, -26, 21, -12 },
+    { -2, -3, 17, -44, 84, -133, 179, -201, 176, -75, -130, 467, -967, 1705, -2956, 6695, 12997, -1729, 202, 369, -584, 612, -534, 406, -269, 148, -59, 3, 22, -28, 22, -12 },
+    { -1, -3, 18, -45, 85, -132, 175, -193, 161, -54, -157, 496, -993, 1716, -2918, 6419, 13154, -1591, 109, 430, -623, 632, -542, 406, -264, 142, -53, -1, 25, -29, 22, -13 },
+    { -1, -4, 19, -46, 86, -131, 170, -184, 147, -32, -184, 525, -1017, 1722, -2875, 6143, 13302, -1447, 14, 492, -660, 652, -548, 404, -258, 135, -47, -6, 29, -31, 23, -13 },
+    { -1, -5, 20, -47, 86, -130, 166, -175, 132, -12, -210, 552, -1039, 1726, -2827, 5868, 13443, -1296, -82, 554, -697, 670, -554, 402, -252, 128, -40, -11, 32, -33, 24, -13 },
+    { 0, -6, 21, -48, 86, -128, 161, -165, 117, 9, -235, 578, -1059, 1726, -2776, 5592, 13576, -1138, -179, 615, -732, 687, -559, 399, -246, 121, -34, -15, 35, -34, 24, -13 },
+    { 0, -6, 22, -49, 86, -127, 156, -156, 102, 30, -259, 602, -1076, 1723, -2719, 5318, 13700, -975, -278, 676, -767, 703, -562, 396, -239, 113, -27, -20, 38, -36, 25, -13 },
+    { 0, -7, 23, -50, 86, -125, 151, -146, 86, 50, -283, 626, -1092, 1716, -2659, 5044, 13817, -805, -378, 736, -800, 718, -565, 391, -231, 105, -20, -25, 41, -37, 26, -14 },
+    { 1, -8, 24, -51, 86, -122, 145, -136, 71, 70, -306, 647, -1104, 1707, -2595, 4771, 13925, -629, -478, 795, -833, 732, -567, 386, -223, 97, -13, -30, 43, -39, 26, -14 },
+    { 1, -8, 25, -51, 86, -120, 140, -126, 56, 90, -328, 668, -1115, 1694, -2527, 4499, 14024, -446, -579, 854, -864, 744, -567, 380, -214, 88, -7, -35, 46, -40, 27, -14 },
+    { 1, -9, 25, -52, 85, -117, 134, -115, 41, 109, -350, 687, -1124, 1678, -2456, 4230, 14115, -258, -681, 912, -894, 756, -567, 373, -205, 79, 1, -40, 49, -41, 27, -14 },
+    { 2, -9, 26, -52, 84, -114, 128, -105, 26, 128, -370, 704, -1130, 1659, -2381, 3962, 14196, -64, -783, 968, -922, 765, -565, 365, -195, 70, 8, -45, 52, -43, 28, -14 },
+    { 2, -10, 26, -52, 83, -111, 121, -94, 11, 147, -390, 720, -1134, 1638, -2303, 3696, 14270, 135, -885, 1024, -949, 774, -562, 357, -185, 61, 15, -49, 55, -44, 28, -14 },
+    { 2, -10, 27, -52, 82, -108, 115, -84, -4, 165, -408, 734, -1136, 1613, -2222, 3433, 14334, 341, -987, 1078, -974, 781, -558, 348, -175, 51, 22, -54, 57, -45, 28, -14 },
+    { 2, -11, 27, -52, 81, -105, 108, -73, -19, 183, -426, 747, -1136, 1586, -2138, 3172, 14389, 551, -1089, 1131, -997, 786, -553, 338, -163, 42, 29, -59, 60, -46, 28, -14 },
+    { 3, -11, 28, -52, 80, -101, 101, -63, -33, 200, -443, 758, -1133, 1556, -2051, 2915, 14435, 767, -1190, 1182, -1019, 790, -547, 327, -152, 32, 37, -63, 62, -47, 29, -14 },
+    { 3, -12, 28, -52, 78, -97, 94, -52, -48, 216, -459, 768, -1129, 1523, -1963, 2661, 14472, 988, -1291, 1232, -1040, 793, -540, 315, -140, 22, 44, -68, 65, -48, 29, -13 },
+    { 3, -12, 28, -52, 77, -94, 87, -41, -62, 232, -474, 776, -1122, 1488, -1872, 2410, 14499, 1214, -1391, 1279, -1058, 794, -532, 303, -128, 11, 51, -73, 67, -49, 29, -13 },
+    { 3, -12, 29, -51, 75, -90, 80, -31, -76, 248, -487, 783, -1113, 1451, -1779, 2162, 14518, 1445, -1490, 1325, -1075, 793, -522, 290, -115, 1, 59, -77, 69, -50, 29, -13 },
+    { 4, -13, 29, -51, 73, -86, 73, -20, -89, 263, -500, 788, -1102, 1411, -1684, 1919, 14527, 1680, -1588, 1369, -1089, 791, -512, 277, -102, -9, 66, -81, 71, -50, 29, -13 },
+    { 0, -13, 29, -50, 71, -81, 66, -9, -102, 277, -512, 791, -1089, 1369, -1588, 1680, 14527, 1919, -1684, 1411, -1102, 788, -500, 263, -89, -20, 73, -86, 73, -51, 29, -13 },
+};
@@ -0,0 +1,27 @@
+/* Generated by tools/gen_resampler_table.py, do not edit */
+#ifndef __RESAMPLER_TABLE_H__
+#define __RESAMPLER_TABLE_H__
+
+#include <stdint.h>
+
+#define RESAMPLER_TAPS          (32)
+#define RESAMPLER_Q             (14)
+#define RESAMPLER_RATIO_NUM     (6)
+#define RESAMPLER_MAX_RATIO_Q8  (558)     /* Largest up/down, rounded up, in 1/256 */
+#define RESAMPLER_FRAC_PHASES   (64)      /* Positions between two input frames of the fractional bank */
+
+/* Output rate = input rate x up / down, `up` phases of RESAMPLER_TAPS coefficients, oldest input first */
+typedef struct {
+    int             in_rate;
+    int             out_rate;
+    int             up;
+    int             down;
+    const int16_t   (*phases)[RESAMPLER_TAPS];
+} resampler_ratio_t;
+
+extern const resampler_ratio_t resampler_ratios[RESAMPLER_RATIO_NUM];
+
+/* Ratio 1 at RESAMPLER_FRAC_PHASES positions between two input frames and the next frame itself */
+extern const int16_t resampler_frac_phases[RESAMPLER_FRAC_PHASES + 1][RESAMPLER_TAPS];
+
+#endif
@@ -0,0 +1,86 @@
+#include <string.h>
+#include "speaker_asrc.h"
+
+#define ASRC_PHASE_SHIFT    (26)    /* Top 6 bits of the position pick the phase, 64 phases */
+#define ASRC_WEIGHT_SHIFT   (10)    /* The next 16 bits weigh it against the following one */
+
+static inline int16_t asrc_sat(int32_t v)
+{
+    v >>= RESAMPLER_Q;
+    return v > 32767 ? 32767 : (v < -32768 ? -32768 : (int16_t)v);
+}
+
+/* The phase at `frac`, between two phases of the table */
+static inline void asrc_coefs(uint32_t frac, int16_t *h)
+{
+    const int16_t *h0 = resampler_frac_phases[frac >> ASRC_PHASE_SHIFT];
+    const int16_t *h1 = h0 + RESAMPLER_TAPS;
+    int32_t w = (frac >> ASRC_WEIGHT_SHIFT) & 0xFFFF;
+    for (int k = 0; k < RESAMPLER_TAPS; k++) {
+        h[k] = (int16_t)(h0[k] + (((h1[k] - h0[k]) * w) >> 16));
+    }
+}
+
+void speaker_asrc_reset(speaker_asrc_t *asrc, int channels)
+{
+    asrc->channels = channels;
+    asrc->frac = 0;
+    asrc->pos = 0;
+    memset(asrc->win, 0, sizeof(asrc->win));
+}
+
+/* Filter the chunk that follows the history in the window, returns the frames written */
+static int asrc_chunk(speaker_asrc_t *asrc, int frames, int16_t *out, uint64_t step)
+{
+    int16_t h[RESAMPLER_TAPS];
+    int channels = asrc->channels;
+    uint32_t frac = asrc->frac;
+    int pos = asrc->pos;
+    int n = 0;
+    while (pos < frames) {
+        asrc_coefs(frac, h);
+        const int16_t *x = asrc->win + channels * pos;
+        if (channels == 2) {
+            int32_t left = 1 << (RESAMPLER_Q - 1);
+            int32_t right = left;
+            for (int k = 0; k < RESAMPLER_TAPS; k++) {
+                left += x[2 * k] * h[k];
+                right += x[2 * k + 1] * h[k];
+            }
+            out[2 * n] = asrc_sat(left);
+            out[2 * n + 1] = asrc_sat(right);
+        } else {
+            int32_t acc = 1 << (RESAMPLER_Q - 1);
+            for (int k = 0; k < RESAMPLER_TAPS; k++) {
+                acc += x[k] * h[k];
+            }
+            out[n] = asrc_sat(acc);
+        }
+        n++;
+        uint64_t next = (uint64_t)frac + step;
+        pos += (int)(next >> 32);
+        frac = (uint32_t)next;
+    }
+    asrc->frac = frac;
+    asrc->pos = pos - frames;
+    /* The last RESAMPLER_TAPS - 1 frames are the history of the next chunk */
+    memmove(asrc->win, asrc->win + frames * channels, (RESAMPLER_TAPS - 1) * channels * sizeof(int16_t));
+    return n;
+}
+
+int speaker_asrc_run(speaker_asrc_t *asrc, const int16_t *in, int in_frames, int16_t *out, float ppm)
+{
+    int channels = asrc->channels;
+    ppm = ppm > SPEAKER_ASRC_MAX_PPM ? SPEAKER_ASRC_MAX_PPM : (ppm < -SPEAKER_ASRC_MAX_PPM ? -SPEAKER_ASRC_MAX_PPM : ppm);
+    /* Input frames per output frame, in 1/2^32 */
+    uint64_t step = (uint64_t)(4294967296.0 * (1.0 + ppm * 1e-6));
+    int produced = 0;
+    while (in_frames > 0) {
+        int frames = in_frames < SPEAKER_RESAMPLER_CHUNK ? in_frames : SPEAKER_RESAMPLER_CHUNK;
+        memcpy(asrc->win + (RESAMPLER_TAPS - 1) * channels, in, frames * channels * sizeof(int16_t));
+        produced += asrc_chunk(asrc, frames, out + produced * channels, step);
+        in += frames * channels;
+        in_frames -= frames;
+    }
+    return produced;
+}
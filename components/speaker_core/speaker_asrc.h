@@ -0,0 +1,51 @@
+#ifndef __SPEAKER_ASRC_H__
+#define __SPEAKER_ASRC_H__
+
+#include <stdint.h>
+#include "resampler_table.h"
+#include "speaker_kernel.h"
+#include "speaker_resampler.h"
+
+/*
+ * Asynchronous resampler for clock drift: ratio 1 give or take SPEAKER_ASRC_MAX_PPM, interleaved 16-bit frames.
+ *
+ * The position of every output frame between two input frames is kept in
+ * 1/2^32 of a frame and steps by 1 + ppm * 1e-6 input frames, so the ratio
+ * can change from block to block without a seam. Each output frame is the
+ * RESAMPLER_TAPS-frame FIR of the two neighbouring phases of
+ * resampler_frac_phases, interpolated at that position; a positive ppm
+ * takes the input faster than the output goes out.
+ */
+
+#define SPEAKER_ASRC_MAX_PPM    (500)
+
+typedef struct {
+    int         channels;
+    uint32_t    frac;           /* Position of the next output between two input frames, in 1/2^32 */
+    int         pos;            /* Input frame of the next output, relative to the chunk */
+    int16_t     win[(RESAMPLER_TAPS - 1 + SPEAKER_RESAMPLER_CHUNK) * SPEAKER_KERNEL_MAX_CH];
+} speaker_asrc_t;
+
+/**
+ * @brief Start from silence
+ */
+void speaker_asrc_reset(speaker_asrc_t *asrc, int channels);
+
+/**
+ * @brief Output frames `in_frames` can produce at most, at any ratio within SPEAKER_ASRC_MAX_PPM
+ */
+static inline int speaker_asrc_max_out(int in_frames)
+{
+    return in_frames + in_frames / 1000 + 2;
+}
+
+/**
+ * @brief Convert a block, `out` takes speaker_asrc_max_out(in_frames) frames
+ *
+ * @param ppm   Clamped to +-SPEAKER_ASRC_MAX_PPM
+ *
+ * @return Frames written to `out`
+ */
+int speaker_asrc_run(speaker_asrc_t *asrc, const int16_t *in, int in_frames, int16_t *out, float ppm);
+
+#endif
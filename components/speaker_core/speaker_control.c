@@ -0,0 +1,170 @@
+#include <stddef.h>
+#include "speaker_control.h"
+
+typedef struct {
+    service_mode_t  from;
+    speaker_event_t event;
+    service_mode_t  to;
+} speaker_transition_t;
+
+static const speaker_transition_t s_transitions[] = {
+    { SD_CARD_DET,      SPEAKER_EVENT_SD_READY,     SD_MODE_INIT },
+    { SD_CARD_DET,      SPEAKER_EVENT_SD_NONE,      BT_MODE_INIT },
+    { SD_MODE_INIT,     SPEAKER_EVENT_READY,        SD_MODE },
+    { SD_MODE,          SPEAKER_EVENT_MODE_KEY,     BT_MODE_INIT },
+    { BT_MODE_INIT,     SPEAKER_EVENT_READY,        BT_MODE },
+    { BT_MODE,          SPEAKER_EVENT_MODE_KEY,     WIFI_MODE_INIT },
+    { WIFI_MODE_INIT,   SPEAKER_EVENT_READY,        WIFI_MODE },
+    { WIFI_MODE,        SPEAKER_EVENT_MODE_KEY,     SD_CARD_DET },
+};
+
+static const char *const s_mode_names[] = {
+    "none", "SD card detection", "SD init", "SD", "BT init", "BT", "Wi-Fi init", "Wi-Fi", "restart",
+};
+
+static void speaker_control_apply_volume(speaker_control_t *ctl, int volume)
+{
+    ctl->volume = volume;
+    ctl->hal->set_volume(ctl->hal->ctx, volume);
+}
+
+void speaker_control_init(speaker_control_t *ctl, const speaker_hal_t *hal, int station_count)
+{
+    ctl->hal = hal;
+    ctl->mode = SD_CARD_DET;
+    ctl->volume = SPEAKER_VOL_INIT;
+    ctl->station = 0;
+    ctl->station_count = station_count;
+    ctl->resume_mode = 0;
+    ctl->resume_volume = -1;
+}
+
+void speaker_control_resume(speaker_control_t *ctl, service_mode_t mode, int volume, int station)
+{
+    if (mode == SD_MODE || mode == BT_MODE || mode == WIFI_MODE) {
+        ctl->resume_mode = mode;
+    }
+    if (volume >= 0 && volume <= SPEAKER_VOL_UPPER_TRH) {
+        ctl->resume_volume = volume;
+    }
+    if (station >= 0 && station < ctl->station_count) {
+        ctl->station = station;
+    }
+}
+
+void speaker_control_set_station_count(speaker_control_t *ctl, int station_count)
+{
+    ctl->station_count = station_count;
+    if (ctl->station >= station_count) {
+        ctl->station = 0;
+    }
+}
+
+/* The init the first card detection leaves for, 0 to follow the transition table */
+static service_mode_t speaker_control_resume_target(speaker_control_t *ctl, speaker_event_t event)
+{
+    service_mode_t mode = ctl->resume_mode;
+    if (ctl->mode != SD_CARD_DET || (event != SPEAKER_EVENT_SD_READY && event != SPEAKER_EVENT_SD_NONE)) {
+        return 0;
+    }
+    ctl->resume_mode = 0;
+    if (mode == BT_MODE) {
+        return BT_MODE_INIT;
+    }
+    if (mode == WIFI_MODE) {
+        return WIFI_MODE_INIT;
+    }
+    return 0;
+}
+
+service_mode_t speaker_control_event(speaker_control_t *ctl, speaker_event_t event)
+{
+    service_mode_t resumed = speaker_control_resume_target(ctl, event);
+    for (size_t i = 0; i < sizeof(s_transitions) / sizeof(s_transitions[0]); i++) {
+        const speaker_transition_t *t = &s_transitions[i];
+        if (t->from != ctl->mode || t->event != event) {
+            continue;
+        }
+        if (event == SPEAKER_EVENT_MODE_KEY) {
+            ctl->hal->set_amp(ctl->hal->ctx, false);
+        }
+        ctl->mode = resumed ? resumed : t->to;
+        if (ctl->mode == SD_MODE_INIT || ctl->mode == BT_MODE_INIT || ctl->mode == WIFI_MODE_INIT) {
+            int volume = ctl->resume_volume >= 0 ? ctl->resume_volume : SPEAKER_VOL_INIT;
+            ctl->resume_volume = -1;
+            speaker_control_apply_volume(ctl, volume);
+        }
+        break;
+    }
+    return ctl->mode;
+}
+
+void speaker_control_volume_up(speaker_control_t *ctl, bool paused)
+{
+    ctl->hal->set_amp(ctl->hal->ctx, !paused);
+    int volume = ctl->volume;
+    if (volume == 0) {
+        volume = SPEAKER_VOL_BOTTOM_TRH;
+    }
+    if (volume <= SPEAKER_VOL_TRH) {
+        volume += SPEAKER_VOL_INCREASE_LOW;
+    } else {
+        volume += SPEAKER_VOL_INCREASE_UP;
+    }
+    if (volume >= SPEAKER_VOL_UPPER_TRH) {
+        volume = SPEAKER_VOL_UPPER_TRH;
+        ctl->hal->play_prompt(ctl->hal->ctx, SPEAKER_PROMPT_VOLUME_MAX);
+    }
+    speaker_control_apply_volume(ctl, volume);
+}
+
+void speaker_control_volume_down(speaker_control_t *ctl)
+{
+    int volume = ctl->volume;
+    if (volume <= SPEAKER_VOL_TRH) {
+        volume -= SPEAKER_VOL_DECREASE_LOW;
+    } else {
+        volume -= SPEAKER_VOL_DECREASE_UP;
+    }
+    if (volume <= SPEAKER_VOL_BOTTOM_TRH) {
+        volume = 0;
+        ctl->hal->set_amp(ctl->hal->ctx, false);
+    }
+    speaker_control_apply_volume(ctl, volume);
+}
+
+void speaker_control_set_volume(speaker_control_t *ctl, int volume)
+{
+    if (volume < 0) {
+        volume = 0;
+    } else if (volume > SPEAKER_VOL_UPPER_TRH) {
+        volume = SPEAKER_VOL_UPPER_TRH;
+    }
+    /* The codec already has it, only the step keys and the resume state go on from here */
+    ctl->volume = volume;
+}
+
+void speaker_control_unmute(speaker_control_t *ctl)
+{
+    ctl->hal->set_amp(ctl->hal->ctx, ctl->volume > 0);
+}
+
+void speaker_control_station_step(speaker_control_t *ctl, int step)
+{
+    int count = ctl->station_count;
+    if (count <= 0) {
+        return;
+    }
+    /* The amplifier stays as it is: the switch fades, or restarts over silence the board gates the amplifier on */
+    ctl->station = ((ctl->station + step) % count + count) % count;
+    ctl->hal->tune(ctl->hal->ctx, ctl->station);
+    ctl->hal->play_prompt(ctl->hal->ctx, SPEAKER_PROMPT_STATION_CHANGED);
+}
+
+const char *speaker_control_mode_name(service_mode_t mode)
+{
+    if (mode < 0 || mode > RESTART_MODE) {
+        return "unknown";
+    }
+    return s_mode_names[mode];
+}
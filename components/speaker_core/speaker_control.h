@@ -0,0 +1,127 @@
+#ifndef __SPEAKER_CONTROL_H__
+#define __SPEAKER_CONTROL_H__
+
+#include <stdbool.h>
+
+/*
+ * The control logic of the speaker without the board behind it: the service
+ * mode transitions, the volume stepping and the station cycling.
+ *
+ * Everything that touches hardware or the pipeline goes through the ops in
+ * speaker_hal_t, so the same logic drives the board from app_main and a stub
+ * on a Linux host (components/speaker_core/bench).
+ */
+
+#define SPEAKER_VOL_INIT            50
+#define SPEAKER_VOL_BOTTOM_TRH      0
+#define SPEAKER_VOL_UPPER_TRH       100
+#define SPEAKER_VOL_TRH             100
+#define SPEAKER_VOL_INCREASE_LOW    5
+#define SPEAKER_VOL_DECREASE_LOW    5
+#define SPEAKER_VOL_INCREASE_UP     5
+#define SPEAKER_VOL_DECREASE_UP     5
+
+typedef enum {
+    SD_CARD_DET = 1,
+    SD_MODE_INIT,
+    SD_MODE,
+    BT_MODE_INIT,
+    BT_MODE,
+    WIFI_MODE_INIT,
+    WIFI_MODE,
+    RESTART_MODE
+} service_mode_t;
+
+typedef enum {
+    SPEAKER_EVENT_SD_READY,     /* The card holds music */
+    SPEAKER_EVENT_SD_NONE,      /* No card or no music on it */
+    SPEAKER_EVENT_READY,        /* The mode announcement finished */
+    SPEAKER_EVENT_MODE_KEY,
+} speaker_event_t;
+
+typedef enum {
+    SPEAKER_PROMPT_VOLUME_MAX,
+    SPEAKER_PROMPT_STATION_CHANGED,
+} speaker_prompt_t;
+
+typedef struct {
+    void    (*set_volume)(void *ctx, int volume);   /* Codec and DSP, in % */
+    void    (*set_amp)(void *ctx, bool on);
+    void    (*play_prompt)(void *ctx, speaker_prompt_t prompt);
+    void    (*tune)(void *ctx, int station);        /* Play the station at this index */
+    void    *ctx;
+} speaker_hal_t;
+
+typedef struct {
+    const speaker_hal_t *hal;
+    service_mode_t      mode;
+    int                 volume;
+    int                 station;
+    int                 station_count;
+    service_mode_t      resume_mode;    /* Mode the first card detection goes on to, 0 for none */
+    int                 resume_volume;  /* Volume of the next *_MODE_INIT, -1 for SPEAKER_VOL_INIT */
+} speaker_control_t;
+
+/**
+ * @brief Start in SD_CARD_DET at the initial volume, the hal must outlive the control
+ */
+void speaker_control_init(speaker_control_t *ctl, const speaker_hal_t *hal, int station_count);
+
+/**
+ * @brief Pick up where the last power cycle left off, call right after speaker_control_init()
+ *
+ * The next exit from SD_CARD_DET goes to the init of `mode` (one of SD_MODE,
+ * BT_MODE, WIFI_MODE) instead of following the card; SD is only resumed when
+ * the card holds music. That init sets `volume` instead of the initial one.
+ * Anything out of range is ignored.
+ */
+void speaker_control_resume(speaker_control_t *ctl, service_mode_t mode, int volume, int station);
+
+/**
+ * @brief Take a new station list of `station_count` stations, back to the first when the current one is gone
+ */
+void speaker_control_set_station_count(speaker_control_t *ctl, int station_count);
+
+/**
+ * @brief Take the mode transition for an event
+ *
+ * The mode key turns the amplifier off. Every *_MODE_INIT mode entered resets the volume,
+ * to the resumed one on the first.
+ *
+ * @return The new mode, the current one when the event does not apply to it
+ */
+service_mode_t speaker_control_event(speaker_control_t *ctl, speaker_event_t event);
+
+/**
+ * @brief One volume step up, the amplifier stays off while paused
+ */
+void speaker_control_volume_up(speaker_control_t *ctl, bool paused);
+
+/**
+ * @brief One volume step down, the amplifier turns off at 0
+ */
+void speaker_control_volume_down(speaker_control_t *ctl);
+
+/**
+ * @brief Follow a volume set elsewhere, e.g. by the Bluetooth source
+ *
+ * Only the volume is recorded, the hal is not called again.
+ */
+void speaker_control_set_volume(speaker_control_t *ctl, int volume);
+
+/**
+ * @brief Turn the amplifier on, unless the volume is 0
+ */
+void speaker_control_unmute(speaker_control_t *ctl);
+
+/**
+ * @brief Tune `step` stations forward (or back when negative), wrapping around the list
+ */
+void speaker_control_station_step(speaker_control_t *ctl, int step);
+
+/**
+ * @brief Name of a mode for the logs
+ */
+const char *speaker_control_mode_name(service_mode_t mode);
+
+#endif
@@ -0,0 +1,65 @@
+#include <string.h>
+#include "speaker_crossfade.h"
+
+#define CROSSFADE_PHASE_END     ((uint32_t)SPEAKER_CROSSFADE_STEPS << 24)
+
+/* round(32767 * sin(i * pi / 128)), i = 0..64 */
+static const int16_t s_quarter_sine[SPEAKER_CROSSFADE_STEPS + 1] = {
+        0,   804,  1608,  2410,  3212,  4011,  4808,  5602,
+     6393,  7179,  7962,  8739,  9512, 10278, 11039, 11793,
+    12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530,
+    18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594,
+    23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790,
+    27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956,
+    30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971,
+    32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757,
+    32767,
+};
+
+/* Q15 gain at a Q24 phase between 0 and CROSSFADE_PHASE_END */
+static inline int32_t crossfade_gain(uint32_t phase)
+{
+    uint32_t i = phase >> 24;
+    if (i >= SPEAKER_CROSSFADE_STEPS) {
+        return s_quarter_sine[SPEAKER_CROSSFADE_STEPS];
+    }
+    int32_t frac = (phase >> 9) & 0x7FFF;
+    int32_t a = s_quarter_sine[i];
+    return a + (((s_quarter_sine[i + 1] - a) * frac) >> 15);
+}
+
+static inline int16_t crossfade_sat(int32_t v)
+{
+    v = (v + (1 << 14)) >> 15;
+    return v > 32767 ? 32767 : (v < -32768 ? -32768 : (int16_t)v);
+}
+
+void speaker_crossfade_start(speaker_crossfade_t *x, uint32_t frames)
+{
+    x->pos = 0;
+    x->len = frames;
+    x->step = frames ? CROSSFADE_PHASE_END / frames : 0;
+}
+
+bool speaker_crossfade_run(speaker_crossfade_t *x, int16_t *out, const int16_t *in, int frames, int channels)
+{
+    int mixed = 0;
+    if (x->pos < x->len) {
+        uint32_t left = x->len - x->pos;
+        mixed = (uint32_t)frames < left ? frames : (int)left;
+        uint32_t phase = x->pos * x->step;
+        for (int i = 0; i < mixed; i++, phase += x->step) {
+            int32_t g_in = crossfade_gain(phase);
+            int32_t g_out = crossfade_gain(CROSSFADE_PHASE_END - phase);
+            for (int ch = 0; ch < channels; ch++) {
+                int k = i * channels + ch;
+                out[k] = crossfade_sat(out[k] * g_out + in[k] * g_in);
+            }
+        }
+        x->pos += mixed;
+    }
+    if (mixed < frames) {
+        memcpy(out + mixed * channels, in + mixed * channels, (frames - mixed) * channels * sizeof(int16_t));
+    }
+    return speaker_crossfade_done(x);
+}
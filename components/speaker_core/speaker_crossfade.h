@@ -0,0 +1,45 @@
+#ifndef __SPEAKER_CROSSFADE_H__
+#define __SPEAKER_CROSSFADE_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Equal-power crossfade of two interleaved 16-bit programmes of the same format.
+ *
+ * The outgoing programme follows cos and the incoming one sin over a quarter
+ * period, so the summed power of two unrelated programmes stays constant
+ * through the fade. Both gains come from one 65-entry Q15 quarter-sine table,
+ * linearly interpolated at every frame from a Q24 phase, so a fade of any
+ * length is smooth and nothing is computed in floating point. The sum is
+ * saturated: two correlated programmes can reach +3 dB at the middle.
+ */
+
+#define SPEAKER_CROSSFADE_STEPS     (64)    /* Segments of the quarter sine */
+
+typedef struct {
+    uint32_t    pos;        /* Frames already mixed */
+    uint32_t    len;        /* Frames of the whole fade */
+    uint32_t    step;       /* Phase advance per frame, SPEAKER_CROSSFADE_STEPS in Q24 over `len` */
+} speaker_crossfade_t;
+
+/**
+ * @brief Start a fade over `frames` frames, 0 switches to the incoming programme at once
+ */
+void speaker_crossfade_start(speaker_crossfade_t *x, uint32_t frames);
+
+/**
+ * @brief Mix a block: `out` holds the outgoing frames and receives the mix, `in` holds the incoming ones
+ *
+ * Frames past the end of the fade are the incoming programme alone.
+ *
+ * @return true once the whole fade has been mixed
+ */
+bool speaker_crossfade_run(speaker_crossfade_t *x, int16_t *out, const int16_t *in, int frames, int channels);
+
+static inline bool speaker_crossfade_done(const speaker_crossfade_t *x)
+{
+    return x->pos >= x->len;
+}
+
+#endif
@@ -0,0 +1,66 @@
+#include "speaker_drift.h"
+#include "speaker_asrc.h"
+
+/*
+ * Gains in ppm per ms of error at the end of a period. A ppm held for a
+ * second moves the fill by 1/1000 ms, so KP = 20 closes 2% of the error per
+ * period and KI = 0.1 leaves the loop critically damped, with a time constant
+ * of about 50 periods. The bursts of a Bluetooth link still leave a ms or two
+ * of noise on the average, which moves the ratio by a few tens of ppm: far
+ * below a pitch anyone hears, where a faster loop would wobble.
+ */
+#define DRIFT_KP    (20.0f)
+#define DRIFT_KI    (0.1f)
+
+static inline float drift_clamp(float ppm)
+{
+    return ppm > SPEAKER_ASRC_MAX_PPM ? SPEAKER_ASRC_MAX_PPM : (ppm < -SPEAKER_ASRC_MAX_PPM ? -SPEAKER_ASRC_MAX_PPM : ppm);
+}
+
+void speaker_drift_init(speaker_drift_t *d, int rate, int target_ms, bool keep)
+{
+    float drift_ppm = keep ? d->drift_ppm : 0.0f;
+    uint32_t slips = keep ? d->slips : 0;
+    int slip_ms = target_ms / 2 > SPEAKER_DRIFT_SLIP_MS ? target_ms / 2 : SPEAKER_DRIFT_SLIP_MS;
+    d->rate = rate;
+    d->target = (int)((int64_t)rate * target_ms / 1000);
+    d->slip = (int)((int64_t)rate * slip_ms / 1000);
+    d->fill_sum = 0;
+    d->samples = 0;
+    d->frames = 0;
+    d->settled = false;
+    d->fill_ms = target_ms;
+    d->drift_ppm = drift_ppm;
+    d->ratio_ppm = drift_ppm;
+    d->slips = slips;
+}
+
+int speaker_drift_update(speaker_drift_t *d, int fill_frames, int played_frames)
+{
+    d->fill_sum += fill_frames;
+    d->samples++;
+    d->frames += played_frames;
+    if (d->frames < (uint32_t)d->rate * SPEAKER_DRIFT_PERIOD_MS / 1000) {
+        return 0;
+    }
+    float fill = (float)d->fill_sum / d->samples;
+    d->fill_sum = 0;
+    d->samples = 0;
+    d->frames = 0;
+    d->fill_ms = fill * 1000 / d->rate;
+    float err = fill - d->target;
+    if (err > d->slip || err < -d->slip) {
+        /* The integral keeps what it found, the next period starts at the target again */
+        d->slips++;
+        d->ratio_ppm = d->drift_ppm;
+        return (int)err;
+    }
+    float err_ms = err * 1000 / d->rate;
+    if (d->settled) {
+        d->drift_ppm = drift_clamp(d->drift_ppm + DRIFT_KI * err_ms);
+    }
+    /* The first period straddles the start of the stream, only the fill is corrected on it */
+    d->settled = true;
+    d->ratio_ppm = drift_clamp(d->drift_ppm + DRIFT_KP * err_ms);
+    return 0;
+}
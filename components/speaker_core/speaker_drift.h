@@ -0,0 +1,53 @@
+#ifndef __SPEAKER_DRIFT_H__
+#define __SPEAKER_DRIFT_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Clock drift of a source that pushes audio at its own pace, estimated from the fill of the buffer it pushes into.
+ *
+ * The fill is sampled at every block and averaged over a period of
+ * SPEAKER_DRIFT_PERIOD_MS of played frames, so the bursts the source sends
+ * in cancel out and the time base is the output clock. At the end of each
+ * period a PI loop turns the error of the average against the target depth
+ * into the ratio the asynchronous resampler runs at (speaker_asrc.h): the
+ * integral settles on the drift of the source against the output, the
+ * proportional part brings the fill back to the target. A positive ratio
+ * takes the input faster.
+ *
+ * An error the resampler cannot catch up with in reasonable time, after a
+ * stall or a burst the buffer took whole, is slipped instead: the caller
+ * drops or waits for the frames returned by speaker_drift_update().
+ */
+
+#define SPEAKER_DRIFT_PERIOD_MS     (1000)
+#define SPEAKER_DRIFT_SLIP_MS       (20)    /* Least error that is slipped, half the target when that is more */
+
+typedef struct {
+    int         rate;
+    int         target;         /* Fill aimed at, in frames */
+    int         slip;           /* Error in frames that is slipped */
+    int64_t     fill_sum;       /* Over the current period */
+    uint32_t    samples;
+    uint32_t    frames;         /* Played in the current period */
+    bool        settled;        /* A whole period was measured, the integral runs */
+    float       fill_ms;        /* Average of the last period */
+    float       drift_ppm;      /* Source clock against the output clock */
+    float       ratio_ppm;      /* Ratio the resampler runs at */
+    uint32_t    slips;
+} speaker_drift_t;
+
+/**
+ * @brief Start estimating at `rate` with a target depth of `target_ms`, the drift found so far is kept when `keep`
+ */
+void speaker_drift_init(speaker_drift_t *d, int rate, int target_ms, bool keep);
+
+/**
+ * @brief Take the fill in front of a block and the frames that block played
+ *
+ * @return Frames to drop when positive, to wait for when negative, 0 when the resampler keeps up
+ */
+int speaker_drift_update(speaker_drift_t *d, int fill_frames, int played_frames);
+
+#endif
@@ -0,0 +1,127 @@
+#include <string.h>
+#include "speaker_icy.h"
+
+#define ICY_TITLE_KEY       "StreamTitle"
+#define ICY_TITLE_KEY_LEN   (sizeof(ICY_TITLE_KEY) - 1)
+#define ICY_KEY_MISMATCH    (0xFF)
+
+enum {
+    ICY_KEY = 0,        /* Field name, up to the '=' */
+    ICY_OPEN,           /* The opening quote of the value */
+    ICY_VALUE,
+    ICY_QUOTE,          /* A quote in the value, the end of it when a ';' follows */
+};
+
+static void icy_append(speaker_icy_t *icy, char c)
+{
+    if (icy->key_pos == ICY_TITLE_KEY_LEN && icy->len < SPEAKER_ICY_TITLE_MAX - 1) {
+        icy->next[icy->len++] = c;
+    }
+}
+
+static void icy_end_field(speaker_icy_t *icy)
+{
+    if (icy->key_pos == ICY_TITLE_KEY_LEN) {
+        icy->next[icy->len] = '\0';
+        if (strcmp(icy->next, icy->title) != 0) {
+            memcpy(icy->title, icy->next, icy->len + 1);
+            icy->changed = true;
+        }
+    }
+    icy->state = ICY_KEY;
+    icy->key_pos = 0;
+}
+
+static void icy_scan(speaker_icy_t *icy, char c)
+{
+    switch (icy->state) {
+        case ICY_KEY:
+            if (c == '=') {
+                icy->state = ICY_OPEN;
+                icy->len = 0;
+            } else if (c != '\0') {
+                bool match = icy->key_pos < ICY_TITLE_KEY_LEN && c == ICY_TITLE_KEY[icy->key_pos];
+                icy->key_pos = match ? icy->key_pos + 1 : ICY_KEY_MISMATCH;
+            }
+            break;
+        case ICY_OPEN:
+            icy->state = ICY_VALUE;
+            if (c != '\'') {
+                icy_append(icy, c);
+            }
+            break;
+        case ICY_VALUE:
+            if (c == '\'') {
+                icy->state = ICY_QUOTE;
+            } else {
+                icy_append(icy, c);
+            }
+            break;
+        case ICY_QUOTE:
+            if (c == ';' || c == '\0') {
+                icy_end_field(icy);
+            } else {
+                /* The quote was part of the value */
+                icy_append(icy, '\'');
+                if (c != '\'') {
+                    icy_append(icy, c);
+                    icy->state = ICY_VALUE;
+                }
+            }
+            break;
+    }
+}
+
+void speaker_icy_init(speaker_icy_t *icy, uint32_t metaint)
+{
+    memset(icy, 0, sizeof(*icy));
+    icy->metaint = metaint;
+    icy->audio_left = metaint;
+}
+
+int speaker_icy_strip(speaker_icy_t *icy, uint8_t *buf, int len)
+{
+    if (icy->metaint == 0) {
+        return len;
+    }
+    int pos = 0;
+    int out = 0;
+    while (pos < len) {
+        if (icy->audio_left > 0) {
+            int n = len - pos;
+            n = (uint32_t)n < icy->audio_left ? n : (int)icy->audio_left;
+            if (out != pos) {
+                memmove(buf + out, buf + pos, n);
+            }
+            out += n;
+            pos += n;
+            icy->audio_left -= n;
+        } else if (icy->meta_left == 0) {
+            /* The length byte, 0 for no metadata this time */
+            icy->meta_left = buf[pos++] * 16;
+            icy->state = ICY_KEY;
+            icy->key_pos = 0;
+            if (icy->meta_left == 0) {
+                icy->audio_left = icy->metaint;
+            } else {
+                icy->blocks++;
+            }
+        } else {
+            int n = len - pos;
+            n = (uint32_t)n < icy->meta_left ? n : (int)icy->meta_left;
+            for (int i = 0; i < n; i++) {
+                icy_scan(icy, (char)buf[pos + i]);
+            }
+            pos += n;
+            icy->meta_left -= n;
+            if (icy->meta_left == 0) {
+                /* A value cut short by the end of the block is still the title */
+                if (icy->state == ICY_QUOTE || icy->state == ICY_VALUE) {
+                    icy_end_field(icy);
+                }
+                icy->audio_left = icy->metaint;
+            }
+        }
+    }
+    return out;
+}
@@ -0,0 +1,57 @@
+#ifndef __SPEAKER_ICY_H__
+#define __SPEAKER_ICY_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Streaming parser of the ICY (SHOUTcast/Icecast) in-band metadata.
+ *
+ * A server that got `Icy-MetaData: 1` and answered with `icy-metaint: N`
+ * follows every N audio bytes with one length byte L and 16 * L bytes of
+ * metadata, `StreamTitle='...';StreamUrl='...';` padded with NULs. The parser
+ * takes the stream in reads of any size and compacts the audio of each read
+ * to the front of the same buffer: a read without a metadata block is left
+ * untouched, one with a block only moves the audio that follows it. The
+ * metadata is scanned byte by byte as it passes, only the stream title is
+ * kept. A title may contain apostrophes, it ends at `';` or the end of its block.
+ */
+
+#define SPEAKER_ICY_TITLE_MAX   (128)   /* Longer titles are cut, bytes with the terminating NUL */
+
+typedef struct {
+    uint32_t    metaint;        /* Audio bytes between two blocks, 0 passes everything through */
+    uint32_t    audio_left;     /* Audio bytes before the next length byte */
+    uint32_t    meta_left;      /* Metadata bytes left of the current block */
+    uint8_t     state;          /* Where the scan of the current block is */
+    uint8_t     key_pos;        /* Bytes of the field name that matched "StreamTitle" */
+    uint16_t    len;            /* Bytes of the title being read */
+    char        next[SPEAKER_ICY_TITLE_MAX];
+    char        title[SPEAKER_ICY_TITLE_MAX];   /* The last complete title, empty before the first */
+    bool        changed;        /* A title different from the previous one completed */
+    uint32_t    blocks;         /* Metadata blocks with content seen */
+} speaker_icy_t;
+
+/**
+ * @brief Start on a new connection, `metaint` from its icy-metaint header, 0 without one
+ */
+void speaker_icy_init(speaker_icy_t *icy, uint32_t metaint);
+
+/**
+ * @brief Strip the metadata out of the next `len` bytes of the stream, in place
+ *
+ * @return The audio bytes left at the start of `buf`
+ */
+int speaker_icy_strip(speaker_icy_t *icy, uint8_t *buf, int len);
+
+/**
+ * @brief Whether a new title completed since the last call, the title is in `icy->title`
+ */
+static inline bool speaker_icy_take_title(speaker_icy_t *icy)
+{
+    bool changed = icy->changed;
+    icy->changed = false;
+    return changed;
+}
+
+#endif
@@ -0,0 +1,107 @@
+#include <math.h>
+#include <string.h>
+#include "speaker_kernel.h"
+#ifdef ESP_PLATFORM
+#include "sdkconfig.h"
+#endif
+
+#if defined(ESP_PLATFORM) && !CONFIG_IDF_TARGET_LINUX
+#include "dsps_biquad.h"
+#define speaker_biquad(x, n, coef, w)   dsps_biquad_f32(x, x, n, coef, w)
+#else
+/* Direct form II, the same structure and coefficient layout as dsps_biquad_f32 */
+static void speaker_biquad(float *x, int n, const float *coef, float *w)
+{
+    for (int i = 0; i < n; i++) {
+        float d0 = x[i] - coef[3] * w[0] - coef[4] * w[1];
+        x[i] = coef[0] * d0 + coef[1] * w[0] + coef[2] * w[1];
+        w[1] = w[0];
+        w[0] = d0;
+    }
+}
+#endif
+
+void speaker_kernel_init(speaker_kernel_t *k, float gain_db, float limit_db, int release_ms)
+{
+    memset(k, 0, sizeof(*k));
+    k->cur_slot = SPEAKER_KERNEL_NO_EQ;
+    k->gain = powf(10.0f, gain_db / 20.0f);
+    k->ceiling = 32767.0f * powf(10.0f, limit_db / 20.0f);
+    k->release_ms = release_ms > 0 ? release_ms : 1;
+    k->env = 1.0f;
+    speaker_kernel_set_rate(k, 44100);
+}
+
+void speaker_kernel_reset(speaker_kernel_t *k)
+{
+    memset(k->w, 0, sizeof(k->w));
+    k->env = 1.0f;
+}
+
+int speaker_kernel_set_rate(speaker_kernel_t *k, int rate)
+{
+    if (rate <= 0) {
+        return SPEAKER_KERNEL_NO_EQ;
+    }
+    /* 1 - e^-t/tau, with tau set so the release takes release_ms for 20 dB */
+    k->release = 1.0f - expf(-2.3f * 1000.0f / (k->release_ms * rate));
+    for (int i = 0; i < LOUDNESS_RATE_NUM; i++) {
+        if (loudness_rates[i].sample_rate == rate) {
+            return i;
+        }
+    }
+    return SPEAKER_KERNEL_NO_EQ;
+}
+
+void speaker_kernel_sync(speaker_kernel_t *k, int slot, int target)
+{
+    if (slot != k->cur_slot) {
+        speaker_kernel_reset(k);
+        k->cur_slot = slot;
+        k->cur_step = target;
+    } else if (k->cur_step < target) {
+        k->cur_step = (target - k->cur_step > SPEAKER_KERNEL_RAMP_STEPS) ? k->cur_step + SPEAKER_KERNEL_RAMP_STEPS : target;
+    } else if (k->cur_step > target) {
+        k->cur_step = (k->cur_step - target > SPEAKER_KERNEL_RAMP_STEPS) ? k->cur_step - SPEAKER_KERNEL_RAMP_STEPS : target;
+    }
+    k->coefs = (slot == SPEAKER_KERNEL_NO_EQ) ? NULL : &loudness_rates[slot].steps[k->cur_step];
+}
+
+void speaker_kernel_run(speaker_kernel_t *k, int16_t *pcm, int frames, int channels)
+{
+    while (frames > 0) {
+        int n = frames < SPEAKER_KERNEL_CHUNK ? frames : SPEAKER_KERNEL_CHUNK;
+        for (int ch = 0; ch < channels; ch++) {
+            float *x = k->buf[ch];
+            for (int i = 0; i < n; i++) {
+                x[i] = pcm[i * channels + ch];
+            }
+            if (k->coefs) {
+                for (int b = 0; b < LOUDNESS_BANDS; b++) {
+                    speaker_biquad(x, n, (float *)k->coefs->coef[b], k->w[ch][b]);
+                }
+            }
+        }
+        /* Gain and limiter in one pass; the limiter follows the louder channel so the image does not shift */
+        for (int i = 0; i < n; i++) {
+            float peak = 0.0f;
+            for (int ch = 0; ch < channels; ch++) {
+                float v = fabsf(k->buf[ch][i]);
+                peak = v > peak ? v : peak;
+            }
+            peak *= k->gain;
+            float env = k->env + (1.0f - k->env) * k->release;
+            if (peak * env > k->ceiling) {
+                env = k->ceiling / peak;
+            }
+            k->env = env;
+            float g = k->gain * env;
+            for (int ch = 0; ch < channels; ch++) {
+                float v = k->buf[ch][i] * g;
+                pcm[ch] = v > INT16_MAX ? INT16_MAX : (v < INT16_MIN ? INT16_MIN : (int16_t)v);
+            }
+            pcm += channels;
+        }
+        frames -= n;
+    }
+}
@@ -0,0 +1,70 @@
+#ifndef __SPEAKER_KERNEL_H__
+#define __SPEAKER_KERNEL_H__
+
+#include <stdint.h>
+#include "loudness_table.h"
+
+/*
+ * The programme processing of the dsp element without the element around it:
+ * loudness EQ, gain and a stereo-linked peak limiter over interleaved 16-bit
+ * frames, in place.
+ *
+ * The state is a plain struct so the same code runs in the element task, in the
+ * on-target benchmark and on a Linux host (components/speaker_core/bench). On
+ * target the biquads run on the ESP-DSP kernels, elsewhere on a portable loop
+ * with the same coefficient layout.
+ */
+
+#define SPEAKER_KERNEL_MAX_CH       (2)
+#define SPEAKER_KERNEL_CHUNK        (256)   /* Frames split into the channel buffers at a time */
+#define SPEAKER_KERNEL_RAMP_STEPS   (2)     /* Volume steps walked per block towards the target */
+#define SPEAKER_KERNEL_NO_EQ        (-1)
+
+typedef struct {
+    int                     cur_slot;       /* Index into loudness_rates, SPEAKER_KERNEL_NO_EQ without a table */
+    int                     cur_step;
+    const loudness_coefs_t  *coefs;         /* Set used by all channels, swapped at block boundaries only */
+    float                   w[SPEAKER_KERNEL_MAX_CH][LOUDNESS_BANDS][2];
+    float                   gain;
+    float                   ceiling;
+    float                   release;        /* Per frame recovery of the limiter gain */
+    float                   release_ms;
+    float                   env;            /* Limiter gain */
+    float                   buf[SPEAKER_KERNEL_MAX_CH][SPEAKER_KERNEL_CHUNK];
+} speaker_kernel_t;
+
+/**
+ * @brief Set up the kernel for 44.1 kHz without EQ until the first speaker_kernel_sync()
+ *
+ * @param gain_db       Gain in front of the limiter
+ * @param limit_db      Limiter ceiling in dBFS
+ * @param release_ms    Time the limiter takes to recover about 20 dB
+ */
+void speaker_kernel_init(speaker_kernel_t *k, float gain_db, float limit_db, int release_ms);
+
+/**
+ * @brief Clear the filter and limiter state, for a new programme
+ */
+void speaker_kernel_reset(speaker_kernel_t *k);
+
+/**
+ * @brief Table slot of a sample rate and the limiter release for it
+ *
+ * @return Index into loudness_rates, SPEAKER_KERNEL_NO_EQ when the rate has no table
+ */
+int speaker_kernel_set_rate(speaker_kernel_t *k, int rate);
+
+/**
+ * @brief Pick up the rate slot and volume before a block
+ *
+ * A new slot starts from clean state right on the target curve, otherwise the
+ * curve walks SPEAKER_KERNEL_RAMP_STEPS towards the target.
+ */
+void speaker_kernel_sync(speaker_kernel_t *k, int slot, int target);
+
+/**
+ * @brief EQ, gain and limiter over interleaved 16-bit frames, in place
+ */
+void speaker_kernel_run(speaker_kernel_t *k, int16_t *pcm, int frames, int channels);
+
+#endif
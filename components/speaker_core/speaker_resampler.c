@@ -0,0 +1,102 @@
+#include <string.h>
+#include "speaker_resampler.h"
+
+static inline int16_t resampler_sat(int32_t v)
+{
+    v >>= RESAMPLER_Q;
+    return v > 32767 ? 32767 : (v < -32768 ? -32768 : (int16_t)v);
+}
+
+/* One output frame from the RESAMPLER_TAPS frames at `x`, the loop length is a constant for the compiler */
+static inline void resampler_fir_mono(const int16_t *x, const int16_t *h, int16_t *out)
+{
+    int32_t acc = 1 << (RESAMPLER_Q - 1);
+    for (int k = 0; k < RESAMPLER_TAPS; k++) {
+        acc += x[k] * h[k];
+    }
+    out[0] = resampler_sat(acc);
+}
+
+static inline void resampler_fir_stereo(const int16_t *x, const int16_t *h, int16_t *out)
+{
+    int32_t left = 1 << (RESAMPLER_Q - 1);
+    int32_t right = left;
+    for (int k = 0; k < RESAMPLER_TAPS; k++) {
+        left += x[2 * k] * h[k];
+        right += x[2 * k + 1] * h[k];
+    }
+    out[0] = resampler_sat(left);
+    out[1] = resampler_sat(right);
+}
+
+const resampler_ratio_t *speaker_resampler_find(int in_rate, int out_rate)
+{
+    for (int i = 0; i < RESAMPLER_RATIO_NUM; i++) {
+        if (resampler_ratios[i].in_rate == in_rate && resampler_ratios[i].out_rate == out_rate) {
+            return &resampler_ratios[i];
+        }
+    }
+    return NULL;
+}
+
+void speaker_resampler_set(speaker_resampler_t *r, const resampler_ratio_t *ratio, int channels)
+{
+    r->ratio = ratio;
+    r->channels = channels;
+    r->phase = 0;
+    r->pos = 0;
+    memset(r->win, 0, sizeof(r->win));
+}
+
+/* Filter the chunk that follows the history in the window, returns the frames written */
+static int resampler_chunk(speaker_resampler_t *r, int frames, int16_t *out)
+{
+    const resampler_ratio_t *ratio = r->ratio;
+    int up = ratio->up;
+    int down = ratio->down;
+    int phase = r->phase;
+    int pos = r->pos;
+    int n = 0;
+    if (r->channels == 2) {
+        while (pos < frames) {
+            resampler_fir_stereo(r->win + 2 * pos, ratio->phases[phase], out + 2 * n++);
+            phase += down;
+            while (phase >= up) {
+                phase -= up;
+                pos++;
+            }
+        }
+    } else {
+        while (pos < frames) {
+            resampler_fir_mono(r->win + pos, ratio->phases[phase], out + n++);
+            phase += down;
+            while (phase >= up) {
+                phase -= up;
+                pos++;
+            }
+        }
+    }
+    r->phase = phase;
+    r->pos = pos - frames;
+    /* The last RESAMPLER_TAPS - 1 frames are the history of the next chunk */
+    memmove(r->win, r->win + frames * r->channels, (RESAMPLER_TAPS - 1) * r->channels * sizeof(int16_t));
+    return n;
+}
+
+int speaker_resampler_run(speaker_resampler_t *r, const int16_t *in, int in_frames, int16_t *out)
+{
+    int channels = r->channels;
+    if (r->ratio == NULL) {
+        memcpy(out, in, in_frames * channels * sizeof(int16_t));
+        return in_frames;
+    }
+    int produced = 0;
+    while (in_frames > 0) {
+        int frames = in_frames < SPEAKER_RESAMPLER_CHUNK ? in_frames : SPEAKER_RESAMPLER_CHUNK;
+        memcpy(r->win + (RESAMPLER_TAPS - 1) * channels, in, frames * channels * sizeof(int16_t));
+        produced += resampler_chunk(r, frames, out + produced * channels);
+        in += frames * channels;
+        in_frames -= frames;
+    }
+    return produced;
+}
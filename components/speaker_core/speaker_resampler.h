@@ -0,0 +1,57 @@
+#ifndef __SPEAKER_RESAMPLER_H__
+#define __SPEAKER_RESAMPLER_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "resampler_table.h"
+#include "speaker_kernel.h"
+
+/*
+ * Polyphase sample rate converter of the fixed-rate output, interleaved 16-bit frames.
+ *
+ * Only the ratios of resampler_table.c are converted: programme rates of 22.05,
+ * 32, 44.1 and 48 kHz to an output of 44.1 or 48 kHz. Each output frame is one
+ * phase of RESAMPLER_TAPS Q14 coefficients over the last RESAMPLER_TAPS input
+ * frames; the inner loop has a constant length and separate mono and stereo
+ * versions, so the compiler unrolls it. The state carries the filter history
+ * from block to block, a gapless track change at the same rate does not reset it.
+ */
+
+#define SPEAKER_RESAMPLER_CHUNK     (256)   /* Input frames filtered at a time */
+
+typedef struct {
+    const resampler_ratio_t *ratio;         /* NULL passes the frames through */
+    int                     channels;
+    int                     phase;          /* Output position within the current input frame, in 1/up */
+    int                     pos;            /* Input frame of the next output, relative to the chunk */
+    int16_t                 win[(RESAMPLER_TAPS - 1 + SPEAKER_RESAMPLER_CHUNK) * SPEAKER_KERNEL_MAX_CH];
+} speaker_resampler_t;
+
+/**
+ * @brief Table of the ratio from `in_rate` to `out_rate`
+ *
+ * @return NULL when the rates are equal or the ratio has no table
+ */
+const resampler_ratio_t *speaker_resampler_find(int in_rate, int out_rate);
+
+/**
+ * @brief Start converting with a ratio from clean state, NULL to pass through
+ */
+void speaker_resampler_set(speaker_resampler_t *r, const resampler_ratio_t *ratio, int channels);
+
+/**
+ * @brief Output frames `in_frames` can produce at most, for any ratio of the table
+ */
+static inline int speaker_resampler_max_out(int in_frames)
+{
+    return (int)(((int64_t)in_frames * RESAMPLER_MAX_RATIO_Q8 + 255) >> 8) + 1;
+}
+
+/**
+ * @brief Convert a block, `out` takes speaker_resampler_max_out(in_frames) frames
+ *
+ * @return Frames written to `out`
+ */
+int speaker_resampler_run(speaker_resampler_t *r, const int16_t *in, int in_frames, int16_t *out);
+
+#endif
@@ -0,0 +1,128 @@
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "audio_mem.h"
+#include "audio_error.h"
+#include "boot_sequence.h"
+
+static const char *TAG = "BOOT_SEQUENCE";
+
+#define BOOT_PHASE_MAX  (24)
+
+typedef struct {
+    const char  *name;
+    const char  *task;
+    int64_t     start_us;
+    int64_t     end_us;     /* 0 while the phase runs */
+} boot_phase_t;
+
+struct boot_job {
+    const char          *name;
+    boot_job_fn_t       fn;
+    void                *arg;
+    esp_err_t           ret;
+    SemaphoreHandle_t   done;
+};
+
+static boot_phase_t s_phases[BOOT_PHASE_MAX];
+static int s_phase_num;
+static bool s_logged;
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+
+int boot_phase_begin(const char *name)
+{
+    int64_t now = esp_timer_get_time();
+    int phase = -1;
+    portENTER_CRITICAL(&s_lock);
+    if (s_phase_num < BOOT_PHASE_MAX) {
+        phase = s_phase_num++;
+    }
+    portEXIT_CRITICAL(&s_lock);
+    if (phase >= 0) {
+        s_phases[phase].name = name;
+        s_phases[phase].task = pcTaskGetTaskName(NULL);
+        s_phases[phase].start_us = now;
+        s_phases[phase].end_us = 0;
+    }
+    return phase;
+}
+
+void boot_phase_end(int phase)
+{
+    if (phase >= 0 && phase < BOOT_PHASE_MAX) {
+        s_phases[phase].end_us = esp_timer_get_time();
+    }
+}
+
+static void boot_job_run(boot_job_handle_t job)
+{
+    int phase = boot_phase_begin(job->name);
+    job->ret = job->fn(job->arg);
+    boot_phase_end(phase);
+    xSemaphoreGive(job->done);
+}
+
+static void boot_job_task(void *arg)
+{
+    boot_job_run((boot_job_handle_t)arg);
+    vTaskDelete(NULL);
+}
+
+boot_job_handle_t boot_job_start(const char *name, boot_job_fn_t fn, void *arg, int stack)
+{
+    boot_job_handle_t job = audio_calloc(1, sizeof(struct boot_job));
+    AUDIO_MEM_CHECK(TAG, job, return NULL);
+    job->name = name;
+    job->fn = fn;
+    job->arg = arg;
+    job->done = xSemaphoreCreateBinary();
+    AUDIO_MEM_CHECK(TAG, job->done, {
+        audio_free(job);
+        return NULL;
+    });
+    if (xTaskCreatePinnedToCore(boot_job_task, name, stack, job, BOOT_JOB_PRIO, NULL, tskNO_AFFINITY) != pdPASS) {
+        ESP_LOGW(TAG, "No task for %s, it runs in line", name);
+        boot_job_run(job);
+    }
+    return job;
+}
+
+esp_err_t boot_job_join(boot_job_handle_t job)
+{
+    if (job == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    xSemaphoreTake(job->done, portMAX_DELAY);
+    esp_err_t ret = job->ret;
+    vSemaphoreDelete(job->done);
+    audio_free(job);
+    return ret;
+}
+
+void boot_sequence_log(int64_t first_audio_us)
+{
+    if (s_logged || first_audio_us == 0) {
+        return;
+    }
+    s_logged = true;
+    ESP_LOGI(TAG, "Boot timeline, ms since the app started:");
+    ESP_LOGI(TAG, "   start      end     took  %-16s phase", "task");
+    for (int i = 0; i < s_phase_num; i++) {
+        const boot_phase_t *p = &s_phases[i];
+        if (p->end_us == 0) {
+            ESP_LOGI(TAG, "  %6d  running           %-16s %s", (int)(p->start_us / 1000), p->task, p->name);
+            continue;
+        }
+        ESP_LOGI(TAG, "  %6d   %6d   %6d  %-16s %s", (int)(p->start_us / 1000), (int)(p->end_us / 1000),
+                 (int)((p->end_us - p->start_us) / 1000), p->task, p->name);
+    }
+    int ttfa_ms = (int)(first_audio_us / 1000);
+    if (ttfa_ms > CONFIG_SPEAKER_BOOT_TARGET_MS) {
+        ESP_LOGW(TAG, "Time to first audio %d ms, over the %d ms target", ttfa_ms, CONFIG_SPEAKER_BOOT_TARGET_MS);
+    } else {
+        ESP_LOGI(TAG, "Time to first audio %d ms, target %d ms", ttfa_ms, CONFIG_SPEAKER_BOOT_TARGET_MS);
+    }
+}
@@ -0,0 +1,56 @@
+#ifndef __BOOT_SEQUENCE_H__
+#define __BOOT_SEQUENCE_H__
+
+#include <stdint.h>
+#include "esp_err.h"
+
+/*
+ * Boot steps run side by side, and the timeline of the boot.
+ *
+ * A boot job runs one init step in a task of its own while app_main goes on
+ * with the next ones, and is joined where its result is first needed. Every
+ * job and every step app_main brackets with boot_phase_begin()/_end() is
+ * stamped with esp_timer, which starts with the app (the bootloader before it
+ * is not counted). The timeline is logged once per boot, together with the
+ * time to the first audio written to the codec.
+ */
+
+typedef struct boot_job *boot_job_handle_t;
+
+typedef esp_err_t (*boot_job_fn_t)(void *arg);
+
+#define BOOT_JOB_STACK  (4 * 1024)
+#define BOOT_JOB_PRIO   (5)
+
+/**
+ * @brief Run `fn(arg)` in a task of its own, timed as a phase named after the job
+ *
+ * When no task can be created `fn` runs on the caller before this returns.
+ *
+ * @return The job to join, NULL when out of memory (`fn` did not run)
+ */
+boot_job_handle_t boot_job_start(const char *name, boot_job_fn_t fn, void *arg, int stack);
+
+/**
+ * @brief Wait for the job to finish and free it
+ *
+ * @return What the job function returned, ESP_ERR_NO_MEM for a NULL job
+ */
+esp_err_t boot_job_join(boot_job_handle_t job);
+
+/**
+ * @brief Open a phase of the timeline on the calling task
+ *
+ * @return The phase to close, -1 when the timeline is full
+ */
+int boot_phase_begin(const char *name);
+void boot_phase_end(int phase);
+
+/**
+ * @brief Log the timeline and the time to first audio, only the first call logs
+ *
+ * @param first_audio_us    esp_timer time of the first audio block, 0 while there was none (nothing is logged)
+ */
+void boot_sequence_log(int64_t first_audio_us);
+
+#endif
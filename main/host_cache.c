@@ -0,0 +1,188 @@
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "lwip/netdb.h"
+#include "sdkconfig.h"
+#include "host_cache.h"
+
+static const char *TAG = "HOST_CACHE";
+
+typedef struct {
+    char                        key[HOST_CACHE_KEY_MAX];    /* Empty while the entry is free */
+    esp_http_client_handle_t    client;
+    int64_t                     used_us;
+} host_cache_entry_t;
+
+typedef struct {
+    SemaphoreHandle_t   lock;
+    host_cache_entry_t  entries[HOST_CACHE_SIZE];
+} host_cache_t;
+
+static host_cache_t s_cache;
+
+/* "scheme://host[:port]" of a URL, false when it does not fit a key */
+static bool host_cache_key(const char *url, char *key)
+{
+    const char *host = strstr(url, "://");
+    host = host ? host + 3 : url;
+    size_t len = (host - url) + strcspn(host, "/?#");
+    if (len >= HOST_CACHE_KEY_MAX) {
+        return false;
+    }
+    memcpy(key, url, len);
+    key[len] = '\0';
+    return true;
+}
+
+/* Ask for the name now, so the connect that follows gets it from lwIP's table without waiting */
+static int host_cache_resolve(const char *key)
+{
+    char name[HOST_CACHE_KEY_MAX];
+    const char *host = strstr(key, "://");
+    host = host ? host + 3 : key;
+    const char *at = strchr(host, '@');
+    host = at ? at + 1 : host;
+    size_t len = strcspn(host, ":");
+    memcpy(name, host, len);
+    name[len] = '\0';
+
+    struct addrinfo hints = {
+        .ai_family = AF_INET,
+        .ai_socktype = SOCK_STREAM,
+    };
+    struct addrinfo *res = NULL;
+    int64_t start_us = esp_timer_get_time();
+    int err = getaddrinfo(name, NULL, &hints, &res);
+    int dns_ms = (int)((esp_timer_get_time() - start_us) / 1000);
+    if (err != 0 || res == NULL) {
+        /* The connect looks it up again and reports the failure */
+        ESP_LOGW(TAG, "No address for %s after %d ms", name, dns_ms);
+    }
+    if (res) {
+        freeaddrinfo(res);
+    }
+    return dns_ms;
+}
+
+static host_cache_entry_t *host_cache_find(host_cache_t *cache, const char *key)
+{
+    for (int i = 0; i < HOST_CACHE_SIZE; i++) {
+        if (cache->entries[i].key[0] && strcmp(cache->entries[i].key, key) == 0) {
+            return &cache->entries[i];
+        }
+    }
+    return NULL;
+}
+
+esp_err_t host_cache_init(void)
+{
+    host_cache_t *cache = &s_cache;
+    if (cache->lock) {
+        return ESP_OK;
+    }
+    cache->lock = xSemaphoreCreateMutex();
+    if (cache->lock == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+#if CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS
+    ESP_LOGI(TAG, "Up to %d hosts keep their connection and TLS session", HOST_CACHE_SIZE);
+#else
+    ESP_LOGI(TAG, "Up to %d hosts keep their connection, CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS is off", HOST_CACHE_SIZE);
+#endif
+    return ESP_OK;
+}
+
+esp_err_t host_cache_take(const esp_http_client_config_t *cfg, host_cache_conn_t *conn)
+{
+    host_cache_t *cache = &s_cache;
+    char key[HOST_CACHE_KEY_MAX];
+    memset(conn, 0, sizeof(*conn));
+    bool keyed = host_cache_key(cfg->url, key);
+    if (keyed) {
+        conn->dns_ms = host_cache_resolve(key);
+    }
+    if (keyed && cache->lock) {
+        xSemaphoreTake(cache->lock, portMAX_DELAY);
+        host_cache_entry_t *entry = host_cache_find(cache, key);
+        if (entry) {
+            conn->client = entry->client;
+            entry->client = NULL;
+            entry->key[0] = '\0';
+        }
+        xSemaphoreGive(cache->lock);
+    }
+    if (conn->client) {
+        esp_http_client_set_url(conn->client, cfg->url);
+        esp_http_client_set_user_data(conn->client, cfg->user_data);
+#if CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS
+        conn->reused = true;
+#endif
+        ESP_LOGD(TAG, "Parked client of %s taken", key);
+        return ESP_OK;
+    }
+    esp_http_client_config_t config = *cfg;
+#if CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS
+    config.save_client_session = true;
+#endif
+    conn->client = esp_http_client_init(&config);
+    return conn->client ? ESP_OK : ESP_ERR_NO_MEM;
+}
+
+void host_cache_put(esp_http_client_handle_t client, const char *url)
+{
+    host_cache_t *cache = &s_cache;
+    char key[HOST_CACHE_KEY_MAX];
+    esp_http_client_close(client);
+    if (cache->lock == NULL || url == NULL || !host_cache_key(url, key)) {
+        esp_http_client_cleanup(client);
+        return;
+    }
+    esp_http_client_handle_t drop = NULL;
+    xSemaphoreTake(cache->lock, portMAX_DELAY);
+    host_cache_entry_t *entry = host_cache_find(cache, key);
+    if (entry == NULL) {
+        /* A free entry, or else the host that was used the longest ago */
+        for (int i = 0; i < HOST_CACHE_SIZE; i++) {
+            host_cache_entry_t *e = &cache->entries[i];
+            if (e->key[0] == '\0') {
+                entry = e;
+                break;
+            }
+            if (entry == NULL || e->used_us < entry->used_us) {
+                entry = e;
+            }
+        }
+        strcpy(entry->key, key);
+    }
+    /* One client per host, the one that connected last has the freshest session */
+    drop = entry->client;
+    entry->client = client;
+    entry->used_us = esp_timer_get_time();
+    xSemaphoreGive(cache->lock);
+    if (drop) {
+        esp_http_client_cleanup(drop);
+    }
+}
+
+void host_cache_flush(void)
+{
+    host_cache_t *cache = &s_cache;
+    esp_http_client_handle_t drop[HOST_CACHE_SIZE] = { 0 };
+    if (cache->lock == NULL) {
+        return;
+    }
+    xSemaphoreTake(cache->lock, portMAX_DELAY);
+    for (int i = 0; i < HOST_CACHE_SIZE; i++) {
+        drop[i] = cache->entries[i].client;
+        cache->entries[i].client = NULL;
+        cache->entries[i].key[0] = '\0';
+    }
+    xSemaphoreGive(cache->lock);
+    for (int i = 0; i < HOST_CACHE_SIZE; i++) {
+        if (drop[i]) {
+            esp_http_client_cleanup(drop[i]);
+        }
+    }
+}
@@ -0,0 +1,57 @@
+#ifndef __HOST_CACHE_H__
+#define __HOST_CACHE_H__
+
+#include <stdbool.h>
+#include "esp_err.h"
+#include "esp_http_client.h"
+
+/*
+ * Connections of the last hosts the radio talked to, kept for the next connect to the same host.
+ *
+ * A closed client is parked under its host instead of being freed. With
+ * CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS the client keeps the TLS session of
+ * its last connection, so the next connect to that host through it resumes
+ * the session instead of doing a full handshake. At most HOST_CACHE_SIZE
+ * hosts are kept, the least recently used one goes first.
+ *
+ * The name of a host is looked up ahead of every connect and timed: lwIP
+ * keeps the answer in its own table for the TTL the server gave, which the
+ * connect right after reads it from, so the log can tell the lookup from the
+ * handshake. A second DNS table above lwIP's would not be used, esp-tls
+ * resolves the name itself.
+ *
+ * Thread safe, the element and the standby task of the radio connect at the same time.
+ */
+
+#define HOST_CACHE_SIZE     (4)
+#define HOST_CACHE_KEY_MAX  (64)    /* scheme://host:port, longer hosts are never cached */
+
+typedef struct {
+    esp_http_client_handle_t    client;
+    bool        reused;     /* Parked after an earlier connection to the host, its TLS session is tried */
+    int         dns_ms;     /* Lookup of the host name, 0 for a name lwIP had */
+} host_cache_conn_t;
+
+/**
+ * @brief Create the cache lock, does nothing when the cache is already up
+ */
+esp_err_t host_cache_init(void);
+
+/**
+ * @brief Look the host of `cfg->url` up and take a client for it, a parked one when the cache has it
+ *
+ * The parked client gets the url and the user data of `cfg`, the rest of its settings stay as they were.
+ */
+esp_err_t host_cache_take(const esp_http_client_config_t *cfg, host_cache_conn_t *conn);
+
+/**
+ * @brief Close the client of a connection to `url` and park it, or free it when it cannot be cached
+ */
+void host_cache_put(esp_http_client_handle_t client, const char *url);
+
+/**
+ * @brief Free every parked client, when the network goes away
+ */
+void host_cache_flush(void);
+
+#endif
@@ -0,0 +1,264 @@
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "audio_mem.h"
+#include "audio_error.h"
+#include "periph_touch.h"
+#include "periph_button.h"
+#include "periph_adc_button.h"
+#include "input_router.h"
+
+static const char *TAG = "INPUT_ROUTER";
+
+#define IR_MODE_NUM     (RESTART_MODE + 1)
+
+static const char *const s_key_names[INPUT_KEY_NUM] = { "Mode", "Play", "Rec", "Set", "Vol+", "Vol-" };
+static const char *const s_gesture_names[INPUT_GESTURE_NUM] = { "tap", "long press", "repeat" };
+
+typedef struct {
+    bool                    held;
+    bool                    long_done;  /* Held past long_press_ms */
+    int64_t                 next_us;    /* Long press or repeat due, 0 for none */
+    int                     repeat;
+    input_router_stats_t    stats;
+} input_key_state_t;
+
+struct input_router {
+    input_router_cfg_t  cfg;
+    int8_t              key_of_id[INPUT_ROUTER_MAX_ID];
+    input_action_t      table[IR_MODE_NUM][INPUT_KEY_NUM][INPUT_GESTURE_NUM];
+    service_mode_t      mode;
+    input_key_state_t   keys[INPUT_KEY_NUM];
+    int64_t             next_tick_us;
+};
+
+typedef enum {
+    IR_NONE,
+    IR_PRESS,
+    IR_RELEASE,
+} ir_phase_t;
+
+/* The three peripherals number their events alike, so the command only means something with its source */
+static ir_phase_t ir_phase(int source_type, int cmd)
+{
+    switch (source_type) {
+        case PERIPH_ID_TOUCH:
+            return cmd == PERIPH_TOUCH_TAP ? IR_PRESS
+                   : (cmd == PERIPH_TOUCH_RELEASE || cmd == PERIPH_TOUCH_LONG_RELEASE) ? IR_RELEASE : IR_NONE;
+        case PERIPH_ID_BUTTON:
+            return cmd == PERIPH_BUTTON_PRESSED ? IR_PRESS
+                   : (cmd == PERIPH_BUTTON_RELEASE || cmd == PERIPH_BUTTON_LONG_RELEASE) ? IR_RELEASE : IR_NONE;
+        case PERIPH_ID_ADC_BTN:
+            return cmd == PERIPH_ADC_BUTTON_PRESSED ? IR_PRESS
+                   : (cmd == PERIPH_ADC_BUTTON_RELEASE || cmd == PERIPH_ADC_BUTTON_LONG_RELEASE) ? IR_RELEASE : IR_NONE;
+        default:
+            return IR_NONE;
+    }
+}
+
+static input_action_t ir_action(input_router_handle_t router, input_key_t key, input_gesture_t gesture)
+{
+    return router->table[router->mode][key][gesture];
+}
+
+static void ir_run(input_router_handle_t router, input_key_t key, input_gesture_t gesture, int64_t time_us)
+{
+    input_action_t action = ir_action(router, key, gesture);
+    if (action == NULL) {
+        return;
+    }
+    input_key_state_t *st = &router->keys[key];
+    input_event_t event = {
+        .key = key,
+        .gesture = gesture,
+        .repeat = gesture == INPUT_GESTURE_REPEAT ? st->repeat : 0,
+        .time_us = time_us,
+    };
+    action(router->cfg.ctx, &event);
+
+    uint32_t elapsed = (uint32_t)(esp_timer_get_time() - time_us);
+    st->stats.actions++;
+    st->stats.last_us = elapsed;
+    if (elapsed > st->stats.max_us) {
+        st->stats.max_us = elapsed;
+    }
+    ESP_LOGI(TAG, "[ * ] [%s] %s handled %u us after the input", s_key_names[key], s_gesture_names[gesture], elapsed);
+}
+
+static void ir_press(input_router_handle_t router, input_key_t key, int64_t now)
+{
+    input_key_state_t *st = &router->keys[key];
+    bool has_long = ir_action(router, key, INPUT_GESTURE_LONG) != NULL;
+    bool has_repeat = ir_action(router, key, INPUT_GESTURE_REPEAT) != NULL;
+    st->held = true;
+    st->long_done = false;
+    st->repeat = 0;
+    st->next_us = (has_long || has_repeat) ? now + router->cfg.long_press_ms * 1000LL : 0;
+    /* A tap only has to wait for the release when the same key also has a long press */
+    if (!has_long) {
+        ir_run(router, key, INPUT_GESTURE_TAP, now);
+    }
+}
+
+static void ir_release(input_router_handle_t router, input_key_t key, int64_t now)
+{
+    input_key_state_t *st = &router->keys[key];
+    if (!st->held) {
+        return;
+    }
+    st->held = false;
+    st->next_us = 0;
+    if (!st->long_done && ir_action(router, key, INPUT_GESTURE_LONG) != NULL) {
+        ir_run(router, key, INPUT_GESTURE_TAP, now);
+    }
+}
+
+static bool ir_run_due(input_router_handle_t router, int64_t now)
+{
+    for (int key = 0; key < INPUT_KEY_NUM; key++) {
+        input_key_state_t *st = &router->keys[key];
+        if (!st->held || st->next_us == 0 || st->next_us > now) {
+            continue;
+        }
+        int64_t due_us = st->next_us;
+        if (!st->long_done) {
+            st->long_done = true;
+            ir_run(router, key, INPUT_GESTURE_LONG, due_us);
+        }
+        if (ir_action(router, key, INPUT_GESTURE_REPEAT) != NULL) {
+            st->repeat++;
+            /* Skip the repeats missed while an action blocked, rather than firing them back to back */
+            st->next_us = due_us + router->cfg.repeat_ms * 1000LL;
+            if (st->next_us <= now) {
+                st->next_us = now + router->cfg.repeat_ms * 1000LL;
+            }
+            ir_run(router, key, INPUT_GESTURE_REPEAT, due_us);
+        } else {
+            st->next_us = 0;
+        }
+        return true;
+    }
+    return false;
+}
+
+static TickType_t ir_wait_ticks(input_router_handle_t router, int64_t now)
+{
+    int64_t wake_us = router->next_tick_us;
+    for (int key = 0; key < INPUT_KEY_NUM; key++) {
+        if (router->keys[key].held && router->keys[key].next_us != 0 && router->keys[key].next_us < wake_us) {
+            wake_us = router->keys[key].next_us;
+        }
+    }
+    if (wake_us == INT64_MAX) {
+        return portMAX_DELAY;
+    }
+    int64_t wait_ms = (wake_us - now + 999) / 1000;
+    return (wait_ms + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS;
+}
+
+input_router_handle_t input_router_init(const input_router_cfg_t *config)
+{
+    AUDIO_NULL_CHECK(TAG, config, return NULL);
+    input_router_handle_t router = audio_calloc(1, sizeof(struct input_router));
+    AUDIO_MEM_CHECK(TAG, router, return NULL);
+    router->cfg = *config;
+    if (router->cfg.long_press_ms <= 0) {
+        router->cfg.long_press_ms = INPUT_ROUTER_LONG_PRESS_MS;
+    }
+    if (router->cfg.repeat_ms <= 0) {
+        router->cfg.repeat_ms = INPUT_ROUTER_REPEAT_MS;
+    }
+    memset(router->key_of_id, -1, sizeof(router->key_of_id));
+    router->mode = SD_CARD_DET;
+    router->next_tick_us = router->cfg.tick_ms > 0 ? esp_timer_get_time() + router->cfg.tick_ms * 1000LL : INT64_MAX;
+    return router;
+}
+
+void input_router_deinit(input_router_handle_t router)
+{
+    audio_free(router);
+}
+
+esp_err_t input_router_map(input_router_handle_t router, int input_id, input_key_t key)
+{
+    if (input_id < 0 || input_id >= INPUT_ROUTER_MAX_ID || key >= INPUT_KEY_NUM) {
+        ESP_LOGE(TAG, "Input id %d does not fit the router", input_id);
+        return ESP_ERR_INVALID_ARG;
+    }
+    router->key_of_id[input_id] = key;
+    return ESP_OK;
+}
+
+esp_err_t input_router_bind(input_router_handle_t router, const input_binding_t *bindings, int count)
+{
+    for (int i = 0; i < count; i++) {
+        const input_binding_t *b = &bindings[i];
+        if (b->mode < 0 || b->mode >= IR_MODE_NUM || b->key >= INPUT_KEY_NUM || b->gesture >= INPUT_GESTURE_NUM) {
+            ESP_LOGE(TAG, "Binding %d is out of range", i);
+            return ESP_ERR_INVALID_ARG;
+        }
+        router->table[b->mode][b->key][b->gesture] = b->action;
+    }
+    return ESP_OK;
+}
+
+void input_router_set_mode(input_router_handle_t router, service_mode_t mode)
+{
+    if (mode < 0 || mode >= IR_MODE_NUM) {
+        return;
+    }
+    router->mode = mode;
+    for (int key = 0; key < INPUT_KEY_NUM; key++) {
+        router->keys[key].held = false;
+        router->keys[key].next_us = 0;
+    }
+}
+
+esp_err_t input_router_listen(input_router_handle_t router, audio_event_iface_handle_t evt, audio_event_iface_msg_t *msg)
+{
+    int64_t now = esp_timer_get_time();
+    if (ir_run_due(router, now)) {
+        return ESP_ERR_TIMEOUT;
+    }
+    if (now >= router->next_tick_us) {
+        router->next_tick_us = now + router->cfg.tick_ms * 1000LL;
+        if (router->cfg.tick) {
+            router->cfg.tick(router->cfg.ctx);
+        }
+        return ESP_ERR_TIMEOUT;
+    }
+
+    if (audio_event_iface_listen(evt, msg, ir_wait_ticks(router, now)) != ESP_OK) {
+        return ESP_ERR_TIMEOUT;
+    }
+    if (msg->source_type != PERIPH_ID_TOUCH && msg->source_type != PERIPH_ID_BUTTON && msg->source_type != PERIPH_ID_ADC_BTN) {
+        return ESP_OK;
+    }
+    now = esp_timer_get_time();
+    int id = (int)msg->data;
+    if (id < 0 || id >= INPUT_ROUTER_MAX_ID || router->key_of_id[id] < 0) {
+        return ESP_ERR_TIMEOUT;
+    }
+    input_key_t key = router->key_of_id[id];
+    /* The peripherals' own long press comes seconds late, the router times it from the press */
+    switch (ir_phase(msg->source_type, msg->cmd)) {
+        case IR_PRESS:
+            ir_press(router, key, now);
+            break;
+        case IR_RELEASE:
+            ir_release(router, key, now);
+            break;
+        default:
+            break;
+    }
+    return ESP_ERR_TIMEOUT;
+}
+
+void input_router_get_stats(input_router_handle_t router, input_key_t key, input_router_stats_t *stats)
+{
+    if (key < INPUT_KEY_NUM) {
+        *stats = router->keys[key].stats;
+    }
+}
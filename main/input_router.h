@@ -0,0 +1,114 @@
+#ifndef __INPUT_ROUTER_H__
+#define __INPUT_ROUTER_H__
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "audio_event_iface.h"
+#include "speaker_control.h"
+
+/*
+ * Routes the board keys to the actions of the current service mode.
+ *
+ * The actions are looked up in a table indexed by mode, key and gesture, so
+ * every mode loop shares one dispatcher instead of its own chain of input id
+ * compares. The router tells a tap from a long press and repeats a held key
+ * itself, from the press and release events of the touch, button and ADC
+ * button peripherals. Its wait on the event interface is bounded by the next
+ * repeat and the housekeeping tick, so both run whether or not an event comes
+ * in. Every input is stamped when it is taken off the queue and the time to
+ * the end of its action is kept per key.
+ */
+
+typedef struct input_router *input_router_handle_t;
+
+typedef enum {
+    INPUT_KEY_MODE,
+    INPUT_KEY_PLAY,
+    INPUT_KEY_REC,
+    INPUT_KEY_SET,
+    INPUT_KEY_VOLUP,
+    INPUT_KEY_VOLDOWN,
+    INPUT_KEY_NUM,
+} input_key_t;
+
+typedef enum {
+    INPUT_GESTURE_TAP,      /* On press, or on release when the key has a long press action */
+    INPUT_GESTURE_LONG,     /* Held for long_press_ms, once */
+    INPUT_GESTURE_REPEAT,   /* Held for long_press_ms, then every repeat_ms until released */
+    INPUT_GESTURE_NUM,
+} input_gesture_t;
+
+typedef struct {
+    input_key_t     key;
+    input_gesture_t gesture;
+    int             repeat;     /* Repeats so far, 0 for tap and long */
+    int64_t         time_us;    /* When the input was taken off the queue or the repeat fell due */
+} input_event_t;
+
+typedef void (*input_action_t)(void *ctx, const input_event_t *event);
+
+typedef struct {
+    service_mode_t  mode;
+    input_key_t     key;
+    input_gesture_t gesture;
+    input_action_t  action;
+} input_binding_t;
+
+typedef struct {
+    int     long_press_ms;
+    int     repeat_ms;
+    int     tick_ms;            /* Housekeeping period */
+    void    (*tick)(void *ctx); /* Housekeeping, NULL for none */
+    void    *ctx;               /* Passed to the actions and the tick */
+} input_router_cfg_t;
+
+typedef struct {
+    uint32_t    actions;
+    uint32_t    last_us;    /* Input to end of action */
+    uint32_t    max_us;
+} input_router_stats_t;
+
+#define INPUT_ROUTER_MAX_ID         (64)    /* Board input ids are below this */
+#define INPUT_ROUTER_LONG_PRESS_MS  (600)
+#define INPUT_ROUTER_REPEAT_MS      (150)
+#define INPUT_ROUTER_TICK_MS        (1000)
+
+#define DEFAULT_INPUT_ROUTER_CONFIG() {                 \
+    .long_press_ms  = INPUT_ROUTER_LONG_PRESS_MS,       \
+    .repeat_ms      = INPUT_ROUTER_REPEAT_MS,           \
+    .tick_ms        = INPUT_ROUTER_TICK_MS,             \
+    .tick           = NULL,                             \
+    .ctx            = NULL,                             \
+}
+
+input_router_handle_t input_router_init(const input_router_cfg_t *config);
+void input_router_deinit(input_router_handle_t router);
+
+/**
+ * @brief Tell which board input id (get_input_*_id()) is which key
+ */
+esp_err_t input_router_map(input_router_handle_t router, int input_id, input_key_t key);
+
+/**
+ * @brief Add actions to the table, a later binding of the same slot replaces the earlier one
+ */
+esp_err_t input_router_bind(input_router_handle_t router, const input_binding_t *bindings, int count);
+
+/**
+ * @brief Dispatch with the table of this mode from now on, keys held so far are dropped
+ */
+void input_router_set_mode(input_router_handle_t router, service_mode_t mode);
+
+/**
+ * @brief Wait for the next event, run the actions of the keys and the tick on the way
+ *
+ * Returns after every action, so the caller sees a mode change right away.
+ *
+ * @return ESP_OK when `msg` holds an event that is not a key for the caller,
+ *         ESP_ERR_TIMEOUT when there is nothing for the caller
+ */
+esp_err_t input_router_listen(input_router_handle_t router, audio_event_iface_handle_t evt, audio_event_iface_msg_t *msg);
+
+void input_router_get_stats(input_router_handle_t router, input_key_t key, input_router_stats_t *stats);
+
+#endif
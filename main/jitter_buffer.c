@@ -0,0 +1,265 @@
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "mem_policy.h"
+#include "jitter_buffer.h"
+
+static const char *TAG = "JITTER_BUFFER";
+
+#define JB_WINDOW_US        (1000 * 1000)
+#define JB_STEADY_US        (60 * 1000 * 1000LL)
+#define JB_HORIZON_MS       (8000)  /* Shortfall the depth covers: a link at 90 % needs 800 ms more */
+#define JB_KBPS_MIN         (8)     /* Announced bitrates outside this are not believed */
+#define JB_KBPS_MAX         (640)
+#define JB_LOW_DIV          (4)     /* Low watermark at a quarter of the pre-roll */
+
+typedef enum {
+    JB_BUFFERING,
+    JB_PLAYING,
+} jb_state_t;
+
+struct jitter_buffer {
+    uint8_t     *buf;
+    int         capacity;
+    int         head;           /* Oldest byte */
+    int         fill;
+    jb_state_t  state;
+    bool        eof;
+    bool        starved;
+    int         min_ms;
+    int         max_ms;
+    int         base_ms;        /* Grows on every rebuffer, decays on a steady link */
+    int         target_ms;
+    int         stream_bps;     /* Bytes per second */
+    int         in_bps;
+    int64_t     window_us;
+    int         window_in;
+    int         window_out;
+    bool        window_played;  /* No buffering in the window, so the output rate is the stream rate */
+    int64_t     buffering_us;
+    int64_t     rebuffer_us;
+    uint32_t    underruns;
+    uint32_t    rebuffers;
+};
+
+static int jb_ms_to_bytes(jitter_buffer_handle_t jb, int ms)
+{
+    return (int)((int64_t)ms * jb->stream_bps / 1000);
+}
+
+static int jb_capacity_ms(jitter_buffer_handle_t jb)
+{
+    /* Leave one receive block of headroom above the pre-roll */
+    return (int)((int64_t)(jb->capacity - jb->capacity / 8) * 1000 / jb->stream_bps);
+}
+
+static void jb_update_target(jitter_buffer_handle_t jb)
+{
+    int target = jb->base_ms;
+    if (jb->in_bps > 0 && jb->in_bps < jb->stream_bps) {
+        target += (int)((int64_t)(jb->stream_bps - jb->in_bps) * JB_HORIZON_MS / jb->stream_bps);
+    }
+    if (target > jb->max_ms) {
+        target = jb->max_ms;
+    }
+    int cap = jb_capacity_ms(jb);
+    if (target > cap) {
+        target = cap;
+    }
+    jb->target_ms = target;
+}
+
+static void jb_window(jitter_buffer_handle_t jb, int64_t now_us)
+{
+    int64_t elapsed = now_us - jb->window_us;
+    if (elapsed < JB_WINDOW_US) {
+        return;
+    }
+    int in_bps = (int)((int64_t)jb->window_in * 1000000 / elapsed);
+    /* A weighted average so one slow second is not taken for a slow link */
+    jb->in_bps = jb->in_bps ? (jb->in_bps * 3 + in_bps) / 4 : in_bps;
+    if (jb->window_played && !jb->eof && jb->window_out > 0) {
+        int out_bps = (int)((int64_t)jb->window_out * 1000000 / elapsed);
+        jb->stream_bps = (jb->stream_bps * 7 + out_bps) / 8;
+        /* A window that barely played, a stall or a pause, must not drag the rate towards 0 */
+        if (jb->stream_bps < JB_KBPS_MIN * 1000 / 8) {
+            jb->stream_bps = JB_KBPS_MIN * 1000 / 8;
+        }
+    }
+    if (jb->base_ms > jb->min_ms && now_us - jb->rebuffer_us > JB_STEADY_US) {
+        jb->base_ms = jb->base_ms * 3 / 4;
+        if (jb->base_ms < jb->min_ms) {
+            jb->base_ms = jb->min_ms;
+        }
+        jb->rebuffer_us = now_us;
+    }
+    jb_update_target(jb);
+    jb->window_us = now_us;
+    jb->window_in = 0;
+    jb->window_out = 0;
+    jb->window_played = jb->state == JB_PLAYING;
+}
+
+jitter_buffer_handle_t jitter_buffer_create(const jitter_buffer_cfg_t *config)
+{
+    jitter_buffer_handle_t jb = calloc(1, sizeof(struct jitter_buffer));
+    if (jb == NULL) {
+        return NULL;
+    }
+    jb->buf = mem_policy_malloc(MEM_BULK, config->capacity);
+    if (jb->buf == NULL) {
+        free(jb);
+        return NULL;
+    }
+    jb->capacity = config->capacity;
+    jb->min_ms = config->min_ms;
+    jb->max_ms = config->max_ms;
+    jb->base_ms = config->min_ms;
+    jb->stream_bps = config->stream_kbps * 1000 / 8;
+    jitter_buffer_reset(jb, 0, 0);
+    return jb;
+}
+
+void jitter_buffer_destroy(jitter_buffer_handle_t jb)
+{
+    if (jb == NULL) {
+        return;
+    }
+    mem_policy_free(jb->buf);
+    free(jb);
+}
+
+void jitter_buffer_reset(jitter_buffer_handle_t jb, int stream_kbps, int64_t now_us)
+{
+    jb->head = 0;
+    jb->fill = 0;
+    jb->state = JB_BUFFERING;
+    jb->eof = false;
+    jb->starved = false;
+    if (stream_kbps >= JB_KBPS_MIN && stream_kbps <= JB_KBPS_MAX) {
+        jb->stream_bps = stream_kbps * 1000 / 8;
+    }
+    /* The link is the same for every station, so the measured rate and the depth carry over */
+    jb->window_us = now_us;
+    jb->window_in = 0;
+    jb->window_out = 0;
+    jb->window_played = false;
+    jb->buffering_us = now_us;
+    jb_update_target(jb);
+}
+
+void jitter_buffer_play_now(jitter_buffer_handle_t jb)
+{
+    if (jb->fill > 0) {
+        jb->state = JB_PLAYING;
+    }
+}
+
+int jitter_buffer_write_ptr(jitter_buffer_handle_t jb, uint8_t **ptr)
+{
+    int tail = (jb->head + jb->fill) % jb->capacity;
+    int free = jb->capacity - jb->fill;
+    int run = jb->capacity - tail;
+    *ptr = jb->buf + tail;
+    return free < run ? free : run;
+}
+
+void jitter_buffer_commit(jitter_buffer_handle_t jb, int len, int64_t now_us)
+{
+    jb->fill += len;
+    jb->window_in += len;
+    jb_window(jb, now_us);
+}
+
+int jitter_buffer_push(jitter_buffer_handle_t jb, const uint8_t *data, int len, int64_t now_us)
+{
+    int done = 0;
+    while (done < len) {
+        uint8_t *dst;
+        int run = jitter_buffer_write_ptr(jb, &dst);
+        if (run == 0) {
+            break;
+        }
+        if (run > len - done) {
+            run = len - done;
+        }
+        memcpy(dst, data + done, run);
+        jb->fill += run;
+        done += run;
+    }
+    /* Data that was already downloaded says nothing about the link */
+    jb_window(jb, now_us);
+    return done;
+}
+
+int jitter_buffer_read_ptr(jitter_buffer_handle_t jb, const uint8_t **ptr, int64_t now_us)
+{
+    if (jb->state == JB_BUFFERING) {
+        if (jb->fill == 0 || (!jb->eof && jb->fill < jb_ms_to_bytes(jb, jb->target_ms))) {
+            return 0;
+        }
+        jb->state = JB_PLAYING;
+        jb->starved = false;
+        ESP_LOGI(TAG, "Playing after %d ms of buffering, %d ms deep",
+                 (int)((now_us - jb->buffering_us) / 1000), (int)((int64_t)jb->fill * 1000 / jb->stream_bps));
+    }
+    int run = jb->capacity - jb->head;
+    *ptr = jb->buf + jb->head;
+    return jb->fill < run ? jb->fill : run;
+}
+
+void jitter_buffer_consume(jitter_buffer_handle_t jb, int len, int64_t now_us)
+{
+    jb->head = (jb->head + len) % jb->capacity;
+    jb->fill -= len;
+    jb->window_out += len;
+    if (!jb->eof && jb->state == JB_PLAYING && jb->fill <= jb_ms_to_bytes(jb, jb->target_ms) / JB_LOW_DIV) {
+        jb->state = JB_BUFFERING;
+        jb->window_played = false;
+        jb->rebuffers++;
+        jb->buffering_us = now_us;
+        jb->rebuffer_us = now_us;
+        /* The target is capped anyway, a base past max_ms would only take longer to decay or overflow */
+        jb->base_ms = jb->base_ms * 3 / 2;
+        if (jb->base_ms > jb->max_ms) {
+            jb->base_ms = jb->max_ms;
+        }
+        jb_update_target(jb);
+        ESP_LOGW(TAG, "Rebuffering, %d kbps in for %d kbps, pre-roll now %d ms",
+                 jb->in_bps * 8 / 1000, jb->stream_bps * 8 / 1000, jb->target_ms);
+    }
+    jb_window(jb, now_us);
+}
+
+void jitter_buffer_set_eof(jitter_buffer_handle_t jb)
+{
+    jb->eof = true;
+}
+
+void jitter_buffer_starved(jitter_buffer_handle_t jb)
+{
+    if (!jb->starved) {
+        jb->starved = true;
+        jb->underruns++;
+    }
+}
+
+bool jitter_buffer_is_buffering(jitter_buffer_handle_t jb)
+{
+    return jb->state == JB_BUFFERING;
+}
+
+int jitter_buffer_fill(jitter_buffer_handle_t jb)
+{
+    return jb->fill;
+}
+
+void jitter_buffer_get_stats(jitter_buffer_handle_t jb, jitter_buffer_stats_t *stats)
+{
+    stats->underruns = jb->underruns;
+    stats->rebuffers = jb->rebuffers;
+    stats->target_ms = jb->target_ms;
+    stats->fill_ms = (uint32_t)((int64_t)jb->fill * 1000 / jb->stream_bps);
+    stats->in_kbps = jb->in_bps * 8 / 1000;
+    stats->stream_kbps = jb->stream_bps * 8 / 1000;
+}
@@ -0,0 +1,100 @@
+#ifndef __JITTER_BUFFER_H__
+#define __JITTER_BUFFER_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+/*
+ * Adaptive jitter buffer between the radio connection and the decoder.
+ *
+ * Playback waits until the buffer holds the pre-roll depth and goes back to
+ * buffering when it drains to the low watermark, so a weak link gives a clean
+ * pause instead of the decoder stuttering on every late packet. The depth
+ * follows the link: the download rate is measured against the stream bitrate
+ * and the depth grows with the shortfall, and again after every rebuffer, up
+ * to the capacity. A steady link brings it back to the minimum.
+ *
+ * The buffer does no I/O and takes the time from the caller, the network side
+ * writes straight into it and the decoder side reads straight out of it.
+ */
+
+typedef struct jitter_buffer *jitter_buffer_handle_t;
+
+typedef struct {
+    int     capacity;       /* Bytes */
+    int     min_ms;         /* Pre-roll on a steady link */
+    int     max_ms;         /* Pre-roll the depth never grows past, capped by the capacity */
+    int     stream_kbps;    /* Bitrate assumed until the stream tells or it is measured */
+} jitter_buffer_cfg_t;
+
+typedef struct {
+    uint32_t    underruns;      /* The decoder ran dry */
+    uint32_t    rebuffers;      /* Playback paused at the low watermark */
+    uint32_t    target_ms;      /* Current pre-roll depth */
+    uint32_t    fill_ms;
+    uint32_t    in_kbps;        /* Measured download rate */
+    uint32_t    stream_kbps;
+} jitter_buffer_stats_t;
+
+#define JITTER_BUFFER_CAPACITY      (32 * 1024)
+#define JITTER_BUFFER_MIN_MS        (750)
+#define JITTER_BUFFER_MAX_MS        (4000)
+#define JITTER_BUFFER_STREAM_KBPS   (128)
+
+#define DEFAULT_JITTER_BUFFER_CONFIG() {                \
+    .capacity       = JITTER_BUFFER_CAPACITY,           \
+    .min_ms         = JITTER_BUFFER_MIN_MS,             \
+    .max_ms         = JITTER_BUFFER_MAX_MS,             \
+    .stream_kbps    = JITTER_BUFFER_STREAM_KBPS,        \
+}
+
+jitter_buffer_handle_t jitter_buffer_create(const jitter_buffer_cfg_t *config);
+void jitter_buffer_destroy(jitter_buffer_handle_t jb);
+
+/**
+ * @brief Empty the buffer for a new stream and wait for the pre-roll again
+ *
+ * @param stream_kbps   Bitrate announced by the stream, 0 when unknown
+ */
+void jitter_buffer_reset(jitter_buffer_handle_t jb, int stream_kbps, int64_t now_us);
+
+/**
+ * @brief Start playing what is buffered without waiting for the pre-roll
+ */
+void jitter_buffer_play_now(jitter_buffer_handle_t jb);
+
+/**
+ * @brief Contiguous free space to receive into, 0 when full
+ */
+int jitter_buffer_write_ptr(jitter_buffer_handle_t jb, uint8_t **ptr);
+void jitter_buffer_commit(jitter_buffer_handle_t jb, int len, int64_t now_us);
+
+/**
+ * @brief Copy `len` bytes in, as far as they fit
+ *
+ * @return Bytes copied
+ */
+int jitter_buffer_push(jitter_buffer_handle_t jb, const uint8_t *data, int len, int64_t now_us);
+
+/**
+ * @brief Contiguous data the decoder may take, 0 while buffering
+ */
+int jitter_buffer_read_ptr(jitter_buffer_handle_t jb, const uint8_t **ptr, int64_t now_us);
+void jitter_buffer_consume(jitter_buffer_handle_t jb, int len, int64_t now_us);
+
+/**
+ * @brief The stream ended, let the rest play out without waiting for the watermarks
+ */
+void jitter_buffer_set_eof(jitter_buffer_handle_t jb);
+
+/**
+ * @brief The decoder side found its input empty, counted once per buffering period
+ */
+void jitter_buffer_starved(jitter_buffer_handle_t jb);
+
+bool jitter_buffer_is_buffering(jitter_buffer_handle_t jb);
+int jitter_buffer_fill(jitter_buffer_handle_t jb);
+void jitter_buffer_get_stats(jitter_buffer_handle_t jb, jitter_buffer_stats_t *stats);
+
+#endif
@@ -0,0 +1,238 @@
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include "media_probe.h"
+
+#define WAV_FORMAT_PCM          (0x0001)
+#define WAV_FORMAT_EXTENSIBLE   (0xFFFE)
+#define FLAC_STREAMINFO         (0)
+#define FLAC_VORBIS_COMMENT     (4)
+#define FLAC_STREAMINFO_LEN     (34)
+
+static const char *const s_format_names[MEDIA_FORMAT_MAX] = { "mp3", "wav", "raw", "flac" };
+
+static uint16_t read_le16(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8);
+}
+
+static uint32_t read_le32(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static bool has_extension(const char *name, const char *ext)
+{
+    size_t len = strlen(name);
+    size_t ext_len = strlen(ext);
+    return len > ext_len && name[len - ext_len - 1] == '.' && strcasecmp(name + len - ext_len, ext) == 0;
+}
+
+static bool read_at(int fd, uint32_t offset, uint8_t *buf, int len)
+{
+    return lseek(fd, offset, SEEK_SET) >= 0 && read(fd, buf, len) == len;
+}
+
+static void copy_title(const uint8_t *text, uint32_t len, char *title, int title_len)
+{
+    if (title == NULL || title_len <= 0) {
+        return;
+    }
+    int n = len < (uint32_t)title_len - 1 ? (int)len : title_len - 1;
+    memcpy(title, text, n);
+    title[n] = 0;
+}
+
+static void set_pcm(mp3_info_t *info, int rate, int channels, int bits)
+{
+    info->sample_rate = rate;
+    info->channels = channels;
+    info->bits = bits;
+    info->samples_per_frame = 1;
+    info->frames = (info->audio_end - info->audio_start) / media_probe_block_align(info);
+    info->bitrate = rate * channels * bits / 1000;
+}
+
+/* Title from the INAM entry of a LIST/INFO chunk held in `buf` */
+static void wav_list_title(const uint8_t *buf, uint32_t len, char *title, int title_len)
+{
+    if (len < 4 || memcmp(buf, "INFO", 4) != 0) {
+        return;
+    }
+    for (uint32_t p = 4; p + 8 <= len;) {
+        uint32_t size = read_le32(buf + p + 4);
+        if (size > len - p - 8) {
+            return;
+        }
+        if (memcmp(buf + p, "INAM", 4) == 0) {
+            copy_title(buf + p + 8, size, title, title_len);
+            return;
+        }
+        p += 8 + size + (size & 1);
+    }
+}
+
+/* Walk the RIFF chunks for "fmt " and "data", the header may be followed by any number of other chunks */
+static int probe_wav(int fd, uint32_t file_size, uint8_t *buf, int len, mp3_info_t *info, char *title, int title_len)
+{
+    int format = 0, channels = 0, rate = 0, bits = 0;
+    uint32_t p = 12;
+    while (p + 8 <= file_size) {
+        uint8_t hdr[8];
+        if (!read_at(fd, p, hdr, sizeof(hdr))) {
+            return -1;
+        }
+        uint32_t size = read_le32(hdr + 4);
+        if (memcmp(hdr, "fmt ", 4) == 0 && size >= 16) {
+            int n = size < (uint32_t)len ? (int)size : len;
+            if (!read_at(fd, p + 8, buf, n)) {
+                return -1;
+            }
+            format = read_le16(buf);
+            channels = read_le16(buf + 2);
+            rate = read_le32(buf + 4);
+            bits = read_le16(buf + 14);
+            if (format == WAV_FORMAT_EXTENSIBLE && n >= 26) {
+                format = read_le16(buf + 24);   /* First two bytes of the sub-format GUID */
+            }
+        } else if (memcmp(hdr, "LIST", 4) == 0 && size <= (uint32_t)len && read_at(fd, p + 8, buf, size)) {
+            wav_list_title(buf, size, title, title_len);
+        } else if (memcmp(hdr, "data", 4) == 0) {
+            info->audio_start = p + 8;
+            /* A streamed recording leaves the size at 0 or at its maximum, it then runs to the end of the file */
+            if (size > 0 && size <= file_size - info->audio_start) {
+                info->audio_end = info->audio_start + size;
+            }
+            break;
+        }
+        if (size > file_size - p - 8) {
+            return -1;
+        }
+        p += 8 + size + (size & 1);
+    }
+    if (info->audio_start == 0 || format != WAV_FORMAT_PCM || bits != 16
+        || channels < 1 || channels > 2 || rate <= 0) {
+        return -1;
+    }
+    set_pcm(info, rate, channels, bits);
+    return 0;
+}
+
+/* Title from a Vorbis comment block held in `buf` */
+static void flac_comment_title(const uint8_t *buf, uint32_t len, char *title, int title_len)
+{
+    if (len < 8) {
+        return;
+    }
+    uint32_t p = 4 + read_le32(buf);       /* Vendor string */
+    if (p + 4 > len) {
+        return;
+    }
+    uint32_t count = read_le32(buf + p);
+    p += 4;
+    for (uint32_t i = 0; i < count && p + 4 <= len; i++) {
+        uint32_t size = read_le32(buf + p);
+        p += 4;
+        if (size > len - p) {
+            return;
+        }
+        if (size > 6 && strncasecmp((const char *)buf + p, "TITLE=", 6) == 0) {
+            copy_title(buf + p + 6, size - 6, title, title_len);
+            return;
+        }
+        p += size;
+    }
+}
+
+/* The decoder gets the stream from the "fLaC" marker on, it needs the STREAMINFO block */
+static int probe_flac(int fd, uint32_t start, uint32_t file_size, uint8_t *buf, int len,
+                      mp3_info_t *info, char *title, int title_len)
+{
+    info->audio_start = start;
+    uint32_t p = start + 4;
+    bool last = false;
+    while (!last && p + 4 <= file_size) {
+        uint8_t hdr[4];
+        if (!read_at(fd, p, hdr, sizeof(hdr))) {
+            return -1;
+        }
+        last = hdr[0] & 0x80;
+        int type = hdr[0] & 0x7F;
+        uint32_t size = (hdr[1] << 16) | (hdr[2] << 8) | hdr[3];
+        if (type == FLAC_STREAMINFO && size >= FLAC_STREAMINFO_LEN) {
+            if (!read_at(fd, p + 4, buf, FLAC_STREAMINFO_LEN)) {
+                return -1;
+            }
+            /* 20 bits rate, 3 bits channels - 1, 5 bits bits - 1, 36 bits of samples */
+            info->sample_rate = (buf[10] << 12) | (buf[11] << 4) | (buf[12] >> 4);
+            info->channels = ((buf[12] >> 1) & 7) + 1;
+            uint64_t samples = ((uint64_t)(buf[13] & 0x0F) << 32) | ((uint32_t)buf[14] << 24)
+                               | (buf[15] << 16) | (buf[16] << 8) | buf[17];
+            info->samples_per_frame = 1;
+            info->frames = samples > UINT32_MAX ? 0 : (uint32_t)samples;
+        } else if (type == FLAC_VORBIS_COMMENT && size <= (uint32_t)len && read_at(fd, p + 4, buf, size)) {
+            flac_comment_title(buf, size, title, title_len);
+        }
+        p += 4 + size;
+    }
+    if (info->sample_rate == 0) {
+        return -1;
+    }
+    if (info->frames) {
+        info->bitrate = (uint64_t)(file_size - start) * 8 * info->sample_rate / info->frames / 1000;
+    }
+    return 0;
+}
+
+bool media_probe_is_audio(const char *name)
+{
+    return has_extension(name, "mp3") || has_extension(name, "wav") || has_extension(name, "flac")
+           || has_extension(name, "pcm") || has_extension(name, "raw");
+}
+
+int media_probe(int fd, const char *name, uint32_t file_size, uint8_t *buf, int len,
+                mp3_info_t *info, char *title, int title_len)
+{
+    memset(info, 0, sizeof(mp3_info_t));
+    info->audio_end = file_size;
+    if (title && title_len > 0) {
+        title[0] = 0;
+    }
+    uint8_t head[MP3_INFO_ID3V2_HEADER + 4];
+    int n = lseek(fd, 0, SEEK_SET) < 0 ? -1 : read(fd, head, sizeof(head));
+    if (n <= 0) {
+        return -1;
+    }
+    if (n >= 12 && memcmp(head, "RIFF", 4) == 0 && memcmp(head + 8, "WAVE", 4) == 0) {
+        info->format = MEDIA_FORMAT_WAV;
+        return probe_wav(fd, file_size, buf, len, info, title, title_len);
+    }
+    uint32_t start = mp3_info_id3v2_size(head, n);
+    uint8_t marker[4];
+    if (start + 4 < file_size && read_at(fd, start, marker, sizeof(marker)) && memcmp(marker, "fLaC", 4) == 0) {
+        info->format = MEDIA_FORMAT_FLAC;
+        return probe_flac(fd, start, file_size, buf, len, info, title, title_len);
+    }
+    if (has_extension(name, "pcm") || has_extension(name, "raw")) {
+        info->format = MEDIA_FORMAT_RAW;
+        set_pcm(info, MEDIA_RAW_SAMPLE_RATE, MEDIA_RAW_CHANNELS, MEDIA_RAW_BITS);
+        return 0;
+    }
+    return mp3_info_probe(fd, file_size, buf, len, info, title, title_len);
+}
+
+uint32_t media_probe_block_align(const mp3_info_t *info)
+{
+    if (!media_format_is_pcm(info->format) || info->channels <= 0 || info->bits <= 0) {
+        return 1;
+    }
+    return info->channels * info->bits / 8;
+}
+
+const char *media_format_name(int format)
+{
+    if (format < 0 || format >= MEDIA_FORMAT_MAX) {
+        return "unknown";
+    }
+    return s_format_names[format];
+}
@@ -0,0 +1,66 @@
+#ifndef __MEDIA_PROBE_H__
+#define __MEDIA_PROBE_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "mp3_info.h"
+
+/*
+ * Format probe of the SD card music, plain C with no ESP dependencies.
+ *
+ * The first bytes of a file tell its format: a RIFF/WAVE header, a FLAC
+ * stream marker (an ID3v2 tag may precede it) or, for anything else, MPEG
+ * frames handed to mp3_info. Headerless PCM is only recognized by its file
+ * extension and is taken as MEDIA_RAW_*. The result is an mp3_info_t whose
+ * `format` selects the chain the track is played through: MP3 and FLAC go
+ * through their decoder, WAV and raw PCM go straight to the DSP element.
+ *
+ * For the PCM formats the frame is one sample per channel: `samples_per_frame`
+ * is 1 and `frames` counts the samples, so the length and trim helpers of
+ * mp3_info work unchanged.
+ */
+
+typedef enum {
+    MEDIA_FORMAT_MP3 = 0,
+    MEDIA_FORMAT_WAV,
+    MEDIA_FORMAT_RAW,
+    MEDIA_FORMAT_FLAC,
+    MEDIA_FORMAT_MAX,
+} media_format_t;
+
+#define MEDIA_RAW_SAMPLE_RATE   (44100)
+#define MEDIA_RAW_CHANNELS      (2)
+#define MEDIA_RAW_BITS          (16)
+
+/**
+ * @brief Whether the file name has the extension of a playable format, filters the card scan
+ */
+bool media_probe_is_audio(const char *name);
+
+/**
+ * @brief Probe an open file: format, stream parameters, title and the range of the audio data
+ *
+ * `buf` is scratch space, 2 KB are enough. `name` is only used to recognize headerless PCM.
+ * The file position is unspecified afterwards.
+ *
+ * @return 0 when the file can be played, -1 otherwise; `format`, `audio_start` and `audio_end` are set in both cases
+ */
+int media_probe(int fd, const char *name, uint32_t file_size, uint8_t *buf, int len,
+                mp3_info_t *info, char *title, int title_len);
+
+/**
+ * @brief Whether the format is PCM that bypasses the decoders
+ */
+static inline bool media_format_is_pcm(int format)
+{
+    return format == MEDIA_FORMAT_WAV || format == MEDIA_FORMAT_RAW;
+}
+
+/**
+ * @brief Bytes of one frame of PCM (all channels), the position of a seek is a multiple of it; 1 otherwise
+ */
+uint32_t media_probe_block_align(const mp3_info_t *info);
+
+const char *media_format_name(int format);
+
+#endif
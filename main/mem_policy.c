@@ -0,0 +1,97 @@
+#include <string.h>
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "soc/soc_memory_layout.h"
+#include "mem_policy.h"
+
+static const char *TAG = "MEM_POLICY";
+
+static size_t s_bulk_external;  /* Bytes of bulk buffers that would otherwise take internal RAM */
+static size_t s_block_low[2];   /* Smallest largest-free-block after a transition, internal and PSRAM */
+
+static void *mem_alloc_caps(mem_class_t cls, size_t size)
+{
+    switch (cls) {
+        case MEM_BULK: {
+            void *ptr = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+            if (ptr) {
+                s_bulk_external += heap_caps_get_allocated_size(ptr);
+                return ptr;
+            }
+            return heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        }
+        case MEM_HOT:
+            return heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        case MEM_DMA:
+            return heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA);
+        default:
+            return NULL;
+    }
+}
+
+void *mem_policy_malloc(mem_class_t cls, size_t size)
+{
+    void *ptr = mem_alloc_caps(cls, size);
+    if (ptr == NULL) {
+        ESP_LOGE(TAG, "No room for %u bytes of class %d", size, cls);
+    }
+    return ptr;
+}
+
+void *mem_policy_calloc(mem_class_t cls, size_t n, size_t size)
+{
+    void *ptr = mem_policy_malloc(cls, n * size);
+    if (ptr) {
+        memset(ptr, 0, n * size);
+    }
+    return ptr;
+}
+
+void mem_policy_free(void *ptr)
+{
+    if (ptr && esp_ptr_external_ram(ptr)) {
+        s_bulk_external -= heap_caps_get_allocated_size(ptr);
+    }
+    heap_caps_free(ptr);
+}
+
+static void mem_log_caps(const char *name, uint32_t caps)
+{
+    size_t total = heap_caps_get_total_size(caps);
+    if (total == 0) {
+        ESP_LOGI(TAG, "  %-8s none", name);
+        return;
+    }
+    ESP_LOGI(TAG, "  %-8s %7u of %7u free, %7u low, %7u block", name, heap_caps_get_free_size(caps), total,
+             heap_caps_get_minimum_free_size(caps), heap_caps_get_largest_free_block(caps));
+}
+
+void mem_policy_log(const char *when)
+{
+    ESP_LOGI(TAG, "Heap after %s, %u bytes of buffers moved out of internal RAM:", when, s_bulk_external);
+    mem_log_caps("internal", MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    mem_log_caps("dma", MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA);
+    mem_log_caps("psram", MALLOC_CAP_SPIRAM);
+}
+
+static void mem_log_fragmentation(const char *name, uint32_t caps, size_t *block_low)
+{
+    size_t free = heap_caps_get_free_size(caps);
+    if (free == 0) {
+        return;
+    }
+    size_t block = heap_caps_get_largest_free_block(caps);
+    if (*block_low == 0 || block < *block_low) {
+        *block_low = block;
+    }
+    /* 0 % when all the free memory is one block, near 100 % when it is scattered */
+    ESP_LOGI(TAG, "  %-8s %7u free, %7u block (lowest %7u), fragmentation %u %%", name, free, block, *block_low,
+             (unsigned)(100 - (uint64_t)block * 100 / free));
+}
+
+void mem_policy_log_transition(const char *from, const char *to)
+{
+    ESP_LOGI(TAG, "Heap after %s -> %s:", from, to);
+    mem_log_fragmentation("internal", MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT, &s_block_low[0]);
+    mem_log_fragmentation("psram", MALLOC_CAP_SPIRAM, &s_block_low[1]);
+}
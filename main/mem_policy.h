@@ -0,0 +1,48 @@
+#ifndef __MEM_POLICY_H__
+#define __MEM_POLICY_H__
+
+#include <stddef.h>
+
+/*
+ * Where the buffers of the speaker live.
+ *
+ * Large buffers that are filled and drained a block at a time (the radio
+ * jitter and standby buffers, the playlist read-ahead, the music index) go to
+ * PSRAM when the board has some, and to internal RAM when it has not. State
+ * touched on every sample stays in internal RAM, and the DMA-capable part of
+ * it is kept for what a DMA engine reads. ADF places its own ringbuffers and
+ * element buffers in PSRAM once CONFIG_SPIRAM_BOOT_INIT is set; Bluedroid,
+ * Wi-Fi, lwIP and mbedTLS follow their own SPIRAM options in sdkconfig.
+ */
+
+typedef enum {
+    MEM_BULK,   /* Large and latency tolerant, PSRAM first */
+    MEM_HOT,    /* Touched per sample, internal RAM */
+    MEM_DMA,    /* Read or written by DMA, internal DMA-capable RAM */
+} mem_class_t;
+
+void *mem_policy_malloc(mem_class_t cls, size_t size);
+void *mem_policy_calloc(mem_class_t cls, size_t n, size_t size);
+
+/**
+ * @brief Free a buffer from mem_policy_malloc() or mem_policy_calloc()
+ */
+void mem_policy_free(void *ptr);
+
+/**
+ * @brief Log free, low-water and largest block of internal, DMA-capable and external RAM
+ *
+ * @param when  What the report follows, e.g. "boot" or "BT up"
+ */
+void mem_policy_log(const char *when);
+
+/**
+ * @brief Log the largest free block and the fragmentation of internal RAM and PSRAM after a mode change
+ *
+ * The fragmentation is the share of the free memory outside the largest block.
+ * The smallest largest-block seen after any transition is kept, a value that
+ * keeps falling over many mode cycles means the heap is being cut up.
+ */
+void mem_policy_log_transition(const char *from, const char *to);
+
+#endif
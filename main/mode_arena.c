@@ -0,0 +1,201 @@
+#include <stdbool.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "audio_mem.h"
+#include "audio_error.h"
+#include "mem_policy.h"
+#include "mode_arena.h"
+
+static const char *TAG = "MODE_ARENA";
+
+#define ARENA_ALIGN     (8)
+#define ARENA_NONE      (UINT32_MAX)
+#define ARENA_FREED     (0x80000000u)
+
+/* Precedes every block of the region, the blocks form a stack through `prev` */
+typedef struct {
+    uint32_t    size;   /* Payload bytes, ARENA_FREED once freed below the top */
+    uint32_t    prev;   /* Offset of the block under this one */
+} arena_block_t;
+
+struct mode_arena {
+    SemaphoreHandle_t   lock;
+    uint8_t             *base;
+    size_t              size;
+    size_t              used;
+    uint32_t            top;    /* Offset of the topmost block, ARENA_NONE when empty */
+    mode_arena_stats_t  stats;
+};
+
+static inline size_t arena_round(size_t size)
+{
+    return (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+}
+
+static inline bool arena_owns(mode_arena_handle_t arena, const void *ptr)
+{
+    return (const uint8_t *)ptr >= arena->base && (const uint8_t *)ptr < arena->base + arena->size;
+}
+
+static inline arena_block_t *arena_block(mode_arena_handle_t arena, uint32_t offset)
+{
+    return (arena_block_t *)(arena->base + offset);
+}
+
+static inline arena_block_t *arena_block_of(const void *ptr)
+{
+    return (arena_block_t *)((uint8_t *)ptr - sizeof(arena_block_t));
+}
+
+/* Called with the lock held */
+static void *arena_push(mode_arena_handle_t arena, size_t size)
+{
+    size = arena_round(size);
+    if (size >= ARENA_FREED || arena->used + sizeof(arena_block_t) + size > arena->size) {
+        return NULL;
+    }
+    arena_block_t *block = arena_block(arena, arena->used);
+    block->size = size;
+    block->prev = arena->top;
+    arena->top = arena->used;
+    arena->used += sizeof(arena_block_t) + size;
+    if (arena->used > arena->stats.peak) {
+        arena->stats.peak = arena->used;
+    }
+    return block + 1;
+}
+
+/* Called with the lock held, unwinds every freed block on the top */
+static void arena_pop(mode_arena_handle_t arena)
+{
+    while (arena->top != ARENA_NONE && (arena_block(arena, arena->top)->size & ARENA_FREED)) {
+        arena->used = arena->top;
+        arena->top = arena_block(arena, arena->top)->prev;
+    }
+}
+
+mode_arena_handle_t mode_arena_create(size_t size)
+{
+    mode_arena_handle_t arena = audio_calloc(1, sizeof(struct mode_arena));
+    AUDIO_MEM_CHECK(TAG, arena, return NULL);
+    arena->lock = xSemaphoreCreateMutex();
+    arena->base = mem_policy_malloc(MEM_BULK, size);
+    AUDIO_MEM_CHECK(TAG, arena->lock && arena->base, {
+        mode_arena_destroy(arena);
+        return NULL;
+    });
+    arena->size = size;
+    arena->top = ARENA_NONE;
+    arena->stats.size = size;
+    return arena;
+}
+
+void mode_arena_destroy(mode_arena_handle_t arena)
+{
+    if (arena == NULL) {
+        return;
+    }
+    if (arena->lock) {
+        vSemaphoreDelete(arena->lock);
+    }
+    mem_policy_free(arena->base);
+    audio_free(arena);
+}
+
+void *mode_arena_calloc(mode_arena_handle_t arena, size_t n, size_t size)
+{
+    if (arena == NULL) {
+        return audio_calloc(n, size);
+    }
+    xSemaphoreTake(arena->lock, portMAX_DELAY);
+    void *ptr = arena_push(arena, n * size);
+    if (ptr == NULL) {
+        arena->stats.spills++;
+    }
+    xSemaphoreGive(arena->lock);
+    if (ptr == NULL) {
+        ESP_LOGW(TAG, "%u bytes do not fit the arena, taken from the heap", n * size);
+        return audio_calloc(n, size);
+    }
+    memset(ptr, 0, n * size);
+    return ptr;
+}
+
+void *mode_arena_realloc(mode_arena_handle_t arena, void *ptr, size_t size)
+{
+    if (arena == NULL || (ptr && !arena_owns(arena, ptr))) {
+        return audio_realloc(ptr, size);
+    }
+    if (ptr == NULL) {
+        return mode_arena_calloc(arena, 1, size);
+    }
+    arena_block_t *block = arena_block_of(ptr);
+    size_t old = block->size;
+    if (size <= old) {
+        return ptr;
+    }
+    xSemaphoreTake(arena->lock, portMAX_DELAY);
+    /* The topmost block grows in place */
+    uint32_t offset = (uint8_t *)block - arena->base;
+    if (offset == arena->top && offset + sizeof(arena_block_t) + arena_round(size) <= arena->size) {
+        block->size = arena_round(size);
+        arena->used = offset + sizeof(arena_block_t) + block->size;
+        if (arena->used > arena->stats.peak) {
+            arena->stats.peak = arena->used;
+        }
+        xSemaphoreGive(arena->lock);
+        return ptr;
+    }
+    xSemaphoreGive(arena->lock);
+    void *grown = mode_arena_calloc(arena, 1, size);
+    if (grown) {
+        memcpy(grown, ptr, old);
+        mode_arena_free(arena, ptr);
+    }
+    return grown;
+}
+
+void mode_arena_free(mode_arena_handle_t arena, void *ptr)
+{
+    if (ptr == NULL) {
+        return;
+    }
+    if (arena == NULL || !arena_owns(arena, ptr)) {
+        audio_free(ptr);
+        return;
+    }
+    xSemaphoreTake(arena->lock, portMAX_DELAY);
+    arena_block_of(ptr)->size |= ARENA_FREED;
+    arena_pop(arena);
+    xSemaphoreGive(arena->lock);
+}
+
+void mode_arena_reset(mode_arena_handle_t arena, const char *mode)
+{
+    if (arena == NULL) {
+        return;
+    }
+    xSemaphoreTake(arena->lock, portMAX_DELAY);
+    ESP_LOGI(TAG, "%s arena reset: %u of %u bytes at the peak, %u still held, %u allocations spilled to the heap",
+             mode, arena->stats.peak, arena->size, arena->used, arena->stats.spills);
+    arena->used = 0;
+    arena->top = ARENA_NONE;
+    arena->stats.peak = 0;
+    arena->stats.spills = 0;
+    arena->stats.resets++;
+    xSemaphoreGive(arena->lock);
+}
+
+void mode_arena_get_stats(mode_arena_handle_t arena, mode_arena_stats_t *stats)
+{
+    if (arena == NULL) {
+        memset(stats, 0, sizeof(*stats));
+        return;
+    }
+    xSemaphoreTake(arena->lock, portMAX_DELAY);
+    *stats = arena->stats;
+    stats->used = arena->used;
+    xSemaphoreGive(arena->lock);
+}
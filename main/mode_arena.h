@@ -0,0 +1,53 @@
+#ifndef __MODE_ARENA_H__
+#define __MODE_ARENA_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Memory that lives as long as one service mode.
+ *
+ * The arena is one region reserved at boot. What a mode allocates for itself
+ * is carved from the top of the region and the whole region is given back in
+ * one step when the mode exits, so those buffers never leave holes in the
+ * heap between the long-lived allocations of the other modes. A block freed
+ * while it is the topmost one is reclaimed at once, which covers buffers that
+ * are taken and dropped in nested order (a directory walk); other frees wait
+ * for the reset. An allocation that does not fit spills to the heap and is
+ * counted, the arena size in Kconfig should leave none.
+ *
+ * Every function takes a NULL arena and then works on the heap.
+ */
+
+typedef struct mode_arena *mode_arena_handle_t;
+
+typedef struct {
+    size_t      size;
+    size_t      used;
+    size_t      peak;       /* Highest use since the last reset */
+    uint32_t    spills;     /* Allocations served by the heap since the last reset */
+    uint32_t    resets;
+} mode_arena_stats_t;
+
+/**
+ * @brief Reserve the region, best done at boot before the heap is cut up
+ */
+mode_arena_handle_t mode_arena_create(size_t size);
+void mode_arena_destroy(mode_arena_handle_t arena);
+
+void *mode_arena_calloc(mode_arena_handle_t arena, size_t n, size_t size);
+void *mode_arena_realloc(mode_arena_handle_t arena, void *ptr, size_t size);
+void mode_arena_free(mode_arena_handle_t arena, void *ptr);
+
+/**
+ * @brief Give back everything allocated from the region at once and log its use
+ *
+ * Blocks that spilled to the heap are not affected, their owner frees them.
+ *
+ * @param mode  Mode that owned the arena, for the log
+ */
+void mode_arena_reset(mode_arena_handle_t arena, const char *mode);
+
+void mode_arena_get_stats(mode_arena_handle_t arena, mode_arena_stats_t *stats);
+
+#endif
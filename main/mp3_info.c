@@ -0,0 +1,317 @@
+#include <string.h>
+#include <unistd.h>
+#include "mp3_info.h"
+
+static const uint16_t s_bitrate[2][16] = {
+    { 0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 0 },   /* MPEG 1 */
+    { 0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160, 0 },        /* MPEG 2 and 2.5 */
+};
+
+static const uint16_t s_sample_rate[3] = { 44100, 48000, 32000 };
+
+typedef struct {
+    int version;        /* 3 = MPEG 1, 2 = MPEG 2, 0 = MPEG 2.5 */
+    int sample_rate;
+    int bitrate;
+    int channels;
+    int frame_size;
+} mp3_frame_t;
+
+static uint32_t read_be32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+/* ID3v2 sync-safe integer, 7 bits per byte */
+static uint32_t read_syncsafe(const uint8_t *p)
+{
+    return ((uint32_t)(p[0] & 0x7F) << 21) | ((uint32_t)(p[1] & 0x7F) << 14) | ((p[2] & 0x7F) << 7) | (p[3] & 0x7F);
+}
+
+/* Decode a layer III frame header, free format is not supported */
+static bool parse_header(const uint8_t *p, mp3_frame_t *frame)
+{
+    uint32_t h = read_be32(p);
+    if ((h & 0xFFE00000) != 0xFFE00000) {
+        return false;
+    }
+    int version = (h >> 19) & 3;
+    int layer = (h >> 17) & 3;
+    int br_idx = (h >> 12) & 0xF;
+    int sr_idx = (h >> 10) & 3;
+    if (version == 1 || layer != 1 || br_idx == 0 || br_idx == 15 || sr_idx == 3) {
+        return false;
+    }
+    frame->version = version;
+    frame->bitrate = s_bitrate[version == 3 ? 0 : 1][br_idx];
+    frame->sample_rate = s_sample_rate[sr_idx] >> (version == 3 ? 0 : (version == 2 ? 1 : 2));
+    frame->channels = ((h >> 6) & 3) == 3 ? 1 : 2;
+    int padding = (h >> 9) & 1;
+    frame->frame_size = (version == 3 ? 144000 : 72000) * frame->bitrate / frame->sample_rate + padding;
+    return true;
+}
+
+uint32_t mp3_info_id3v2_size(const uint8_t *buf, int len)
+{
+    if (len < MP3_INFO_ID3V2_HEADER || memcmp(buf, "ID3", 3) != 0) {
+        return 0;
+    }
+    if ((buf[6] | buf[7] | buf[8] | buf[9]) & 0x80) {
+        return 0;
+    }
+    uint32_t size = read_syncsafe(buf + 6) + MP3_INFO_ID3V2_HEADER;
+    if (buf[5] & 0x10) {
+        size += MP3_INFO_ID3V2_HEADER;      /* Footer present */
+    }
+    return size;
+}
+
+static void parse_xing(const uint8_t *buf, int len, const mp3_frame_t *frame, mp3_info_t *info)
+{
+    int side_info;
+    if (frame->version == 3) {
+        side_info = frame->channels == 1 ? 17 : 32;
+    } else {
+        side_info = frame->channels == 1 ? 9 : 17;
+    }
+    int p = info->frame_offset + 4 + side_info;
+    if (p + 8 > len || (memcmp(buf + p, "Xing", 4) != 0 && memcmp(buf + p, "Info", 4) != 0)) {
+        return;
+    }
+    uint32_t flags = read_be32(buf + p + 4);
+    p += 8;
+    if (flags & 0x1) {
+        if (p + 4 > len) {
+            return;
+        }
+        info->frames = read_be32(buf + p);
+        p += 4;
+    }
+    if (flags & 0x2) {
+        p += 4;         /* Byte count */
+    }
+    if (flags & 0x4) {
+        p += 100;       /* Seek table */
+    }
+    if (flags & 0x8) {
+        p += 4;         /* Quality */
+    }
+    info->has_xing = true;
+    info->data_offset = info->frame_offset + frame->frame_size;
+
+    /* LAME extension, also written by libavcodec */
+    if (p + 24 > len) {
+        return;
+    }
+    if (memcmp(buf + p, "LAME", 4) != 0 && memcmp(buf + p, "Lavf", 4) != 0 && memcmp(buf + p, "Lavc", 4) != 0) {
+        return;
+    }
+    info->enc_delay = (buf[p + 21] << 4) | (buf[p + 22] >> 4);
+    info->enc_padding = ((buf[p + 22] & 0x0F) << 8) | buf[p + 23];
+    info->has_lame = true;
+}
+
+int mp3_info_parse(const uint8_t *buf, int len, mp3_info_t *info)
+{
+    memset(info, 0, sizeof(mp3_info_t));
+    mp3_frame_t frame, next;
+    for (int i = 0; i + 4 <= len; i++) {
+        if (buf[i] != 0xFF || !parse_header(buf + i, &frame)) {
+            continue;
+        }
+        /* Confirm the sync with the following header when it is in the buffer */
+        int n = i + frame.frame_size;
+        if (n + 4 <= len && (!parse_header(buf + n, &next)
+                             || next.version != frame.version || next.sample_rate != frame.sample_rate)) {
+            continue;
+        }
+        info->frame_offset = i;
+        info->data_offset = i;
+        info->sample_rate = frame.sample_rate;
+        info->channels = frame.channels;
+        info->samples_per_frame = frame.version == 3 ? 1152 : 576;
+        info->bitrate = frame.bitrate;
+        parse_xing(buf, len, &frame, info);
+        return 0;
+    }
+    return -1;
+}
+
+/* Append one code point to `out` as UTF-8, returns false when it does not fit */
+static bool put_utf8(char *out, int len, int *pos, uint32_t cp)
+{
+    int n = cp < 0x80 ? 1 : (cp < 0x800 ? 2 : 3);
+    if (*pos + n >= len) {
+        return false;
+    }
+    if (n == 1) {
+        out[(*pos)++] = cp;
+    } else if (n == 2) {
+        out[(*pos)++] = 0xC0 | (cp >> 6);
+        out[(*pos)++] = 0x80 | (cp & 0x3F);
+    } else {
+        out[(*pos)++] = 0xE0 | (cp >> 12);
+        out[(*pos)++] = 0x80 | ((cp >> 6) & 0x3F);
+        out[(*pos)++] = 0x80 | (cp & 0x3F);
+    }
+    return true;
+}
+
+/* Convert an ID3v2 text frame body to UTF-8, characters outside the BMP are dropped */
+static void copy_text(const uint8_t *p, int size, char *out, int len)
+{
+    int pos = 0;
+    int enc = p[0];
+    p++;
+    size--;
+    if (enc == 1 || enc == 2) {
+        bool be = enc == 2;
+        int i = 0;
+        if (enc == 1 && size >= 2) {
+            be = p[0] == 0xFE && p[1] == 0xFF;
+            i = 2;
+        }
+        for (; i + 1 < size; i += 2) {
+            uint32_t cp = be ? (p[i] << 8) | p[i + 1] : (p[i + 1] << 8) | p[i];
+            if (cp == 0) {
+                break;
+            }
+            if (cp >= 0xD800 && cp < 0xE000) {
+                continue;       /* Half of a surrogate pair */
+            }
+            if (!put_utf8(out, len, &pos, cp)) {
+                break;
+            }
+        }
+    } else if (enc == 3) {
+        for (int i = 0; i < size && p[i] && pos + 1 < len; i++) {
+            out[pos++] = p[i];
+        }
+    } else {
+        /* ISO-8859-1 maps one to one onto the first code points */
+        for (int i = 0; i < size && p[i]; i++) {
+            if (!put_utf8(out, len, &pos, p[i])) {
+                break;
+            }
+        }
+    }
+    out[pos] = 0;
+}
+
+static void parse_title(const uint8_t *tag, int len, char *title, int title_len)
+{
+    int version = tag[3];
+    int hdr = version == 2 ? 6 : 10;
+    int p = MP3_INFO_ID3V2_HEADER;
+    if (version < 2 || version > 4 || (tag[5] & 0x80)) {
+        return;     /* Unsynchronised tags are not worth the trouble for a title */
+    }
+    if (version > 2 && (tag[5] & 0x40) && p + 4 <= len) {
+        /* The v2.4 size covers the size field itself, the v2.3 one does not */
+        uint32_t ext = version == 4 ? read_syncsafe(tag + p) : read_be32(tag + p) + 4;
+        if (ext > (uint32_t)len) {
+            return;
+        }
+        p += ext;
+    }
+    while (p + hdr <= len && tag[p] != 0) {
+        uint32_t size;
+        if (version == 2) {
+            size = (tag[p + 3] << 16) | (tag[p + 4] << 8) | tag[p + 5];
+        } else {
+            size = version == 4 ? read_syncsafe(tag + p + 4) : read_be32(tag + p + 4);
+        }
+        if (size == 0 || size > (uint32_t)len || p + hdr + size > (uint32_t)len) {
+            return;
+        }
+        if (memcmp(tag + p, version == 2 ? "TT2" : "TIT2", version == 2 ? 3 : 4) == 0) {
+            copy_text(tag + p + hdr, size, title, title_len);
+            return;
+        }
+        p += hdr + size;
+    }
+}
+
+int mp3_info_probe(int fd, uint32_t file_size, uint8_t *buf, int len, mp3_info_t *info, char *title, int title_len)
+{
+    memset(info, 0, sizeof(mp3_info_t));
+    info->audio_end = file_size;
+    if (title && title_len > 0) {
+        title[0] = 0;
+    }
+    if (lseek(fd, 0, SEEK_SET) < 0) {
+        return -1;
+    }
+    int n = read(fd, buf, len);
+    if (n <= 0) {
+        return -1;
+    }
+    uint32_t start = mp3_info_id3v2_size(buf, n);
+    if (start >= file_size) {
+        start = 0;
+    }
+    if (start > 0) {
+        if (title && title_len > 0) {
+            parse_title(buf, start < (uint32_t)n ? start : n, title, title_len);
+        }
+        if (lseek(fd, start, SEEK_SET) < 0) {
+            return -1;
+        }
+        n = read(fd, buf, len);
+        if (n <= 0) {
+            return -1;
+        }
+    }
+    int ret = mp3_info_parse(buf, n, info);
+    info->audio_start = start + (ret == 0 ? info->data_offset : 0);
+    info->audio_end = file_size;
+
+    uint8_t tag[3];
+    if (file_size > MP3_INFO_ID3V1_SIZE + info->audio_start
+        && lseek(fd, file_size - MP3_INFO_ID3V1_SIZE, SEEK_SET) >= 0
+        && read(fd, tag, sizeof(tag)) == sizeof(tag) && memcmp(tag, "TAG", 3) == 0) {
+        info->audio_end -= MP3_INFO_ID3V1_SIZE;
+    }
+    return ret;
+}
+
+uint32_t mp3_info_duration_ms(const mp3_info_t *info)
+{
+    if (info->sample_rate == 0) {
+        return 0;
+    }
+    uint64_t total = mp3_info_total_samples(info);
+    if (total) {
+        uint32_t head, keep;
+        mp3_info_trim(info, &head, &keep);
+        return (uint64_t)keep * 1000 / info->sample_rate;
+    }
+    if (info->bitrate == 0 || info->audio_end <= info->audio_start) {
+        return 0;
+    }
+    /* Constant bitrate assumed */
+    return (uint64_t)(info->audio_end - info->audio_start) * 8 / info->bitrate;
+}
+
+uint64_t mp3_info_total_samples(const mp3_info_t *info)
+{
+    return (uint64_t)info->frames * info->samples_per_frame;
+}
+
+void mp3_info_trim(const mp3_info_t *info, uint32_t *head, uint32_t *keep)
+{
+    uint64_t total = mp3_info_total_samples(info);
+    *head = 0;
+    *keep = (uint32_t)total;
+    if (!info->has_lame || total == 0) {
+        return;
+    }
+    uint64_t skip = info->enc_delay + MP3_INFO_DECODER_DELAY;
+    uint64_t valid = total > (uint64_t)(info->enc_delay + info->enc_padding) ? total - info->enc_delay - info->enc_padding : 0;
+    if (skip >= total) {
+        *keep = 0;
+        return;
+    }
+    *head = (uint32_t)skip;
+    *keep = (uint32_t)(valid < total - skip ? valid : total - skip);
+}
@@ -0,0 +1,78 @@
+#ifndef __MP3_INFO_H__
+#define __MP3_INFO_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Minimal MP3 header parser, plain C with no ESP dependencies.
+ *
+ * It skips the ID3v2 tag, decodes the first frame header and reads the
+ * Xing/Info and LAME tags when present, which is enough to know the exact
+ * length of a track and the encoder delay and padding to trim from it.
+ */
+
+#define MP3_INFO_ID3V2_HEADER   (10)
+#define MP3_INFO_ID3V1_SIZE     (128)
+#define MP3_INFO_DECODER_DELAY  (529)   /* Samples every layer III decoder adds in front of the stream */
+
+typedef struct {
+    uint32_t    frame_offset;       /* Offset of the first frame, relative to the parsed buffer */
+    uint32_t    data_offset;        /* First audio frame, after the Xing/Info frame when there is one */
+    int         sample_rate;
+    int         channels;
+    int         samples_per_frame;
+    int         bitrate;            /* kbit/s of the first frame */
+    uint32_t    frames;             /* Audio frames from the Xing/Info tag, 0 when unknown */
+    int         enc_delay;          /* From the LAME tag, 0 without one */
+    int         enc_padding;
+    bool        has_xing;
+    bool        has_lame;
+    uint32_t    audio_start;        /* File offset of the first audio frame, set by mp3_info_probe() */
+    uint32_t    audio_end;          /* End of the audio data, a trailing ID3v1 tag is left out */
+    uint8_t     format;             /* media_format_t, MP3 unless probed by media_probe() */
+    uint8_t     bits;               /* Sample size of the PCM formats, 0 for the decoded ones */
+} mp3_info_t;
+
+/**
+ * @brief Size of the ID3v2 tag at the start of `buf`, header and footer included
+ *
+ * @return 0 when the buffer does not start with a tag
+ */
+uint32_t mp3_info_id3v2_size(const uint8_t *buf, int len);
+
+/**
+ * @brief Find the first frame in `buf` and parse its header and Xing/LAME tags
+ *
+ * @return 0 on success, -1 when no valid frame header was found
+ */
+int mp3_info_parse(const uint8_t *buf, int len, mp3_info_t *info);
+
+/**
+ * @brief Probe an open file: tags, first frame and the range of the audio data
+ *
+ * `buf` is scratch space, 2 KB are enough for any first frame. The title is taken from the ID3v2
+ * tag when `title` is given and left empty without one. The file position is unspecified afterwards.
+ *
+ * @return 0 when a frame was found, -1 otherwise; `audio_start` and `audio_end` are set in both cases
+ */
+int mp3_info_probe(int fd, uint32_t file_size, uint8_t *buf, int len, mp3_info_t *info, char *title, int title_len);
+
+/**
+ * @brief Duration of the track in milliseconds, estimated from the bitrate without a Xing/Info tag
+ */
+uint32_t mp3_info_duration_ms(const mp3_info_t *info);
+
+/**
+ * @brief Samples per channel the decoder produces for the whole track, 0 when unknown
+ */
+uint64_t mp3_info_total_samples(const mp3_info_t *info);
+
+/**
+ * @brief Samples per channel to drop in front of the track and to keep after that
+ *
+ * Without a LAME tag nothing is trimmed and `keep` covers the whole track.
+ */
+void mp3_info_trim(const mp3_info_t *info, uint32_t *head, uint32_t *keep);
+
+#endif
@@ -15,22 +15,16 @@
 #include "i2s_stream.h"
 #include "mp3_decoder.h"
 #include "esp_peripherals.h"
-#include "periph_wifi.h"
 #include "board.h"
 #include "periph_touch.h"
 #include "periph_adc_button.h"
 #include "periph_button.h"
 #include "audio_mem.h"
 #include "bluetooth_service.h"
-#include "fatfs_stream.h" 
 #include "periph_sdcard.h"
-#include "sdcard_list.h"
-#include "sdcard_scan.h"
 #include <stdio.h>
 #include "audio_error.h"
-#include "tone_stream.h"
-#include "audio_tone_uri.h"
-#include "equalizer.h"
+#include "prompt_player.h"
 #include "esp_netif.h"
 #include "sdcard.h"
 #include "driver/gpio.h"
@@ -44,185 +38,466 @@
 #include "esp_a2dp_api.h"
 #include "esp_avrc_api.h"
 #include "a2dp_stream.h"
-#include "audio_alc.h"
-
-#define INIT_VOLUME         50
-#define VOL_BOTTOM_TRH      0
-#define VOL_UPPER_TRH       100
-#define VOL_TRH             100
-#define VOL_INCREASE_LOW    5
-#define VOL_DECREASE_LOW    5
-#define VOL_INCREASE_UP     5
-#define VOL_DECREASE_UP     5
+#include "player_pipeline.h"
+#include "music_index.h"
+#include "output_stage.h"
+#include "radio_reader.h"
+#include "speaker_dsp.h"
+#include "telemetry.h"
+#include "speaker_control.h"
+#include "input_router.h"
+#include "mem_policy.h"
+#include "mode_arena.h"
+#include "wifi_link.h"
+#include "boot_sequence.h"
+#include "resume_state.h"
+#include "playlist_reader.h"
+#include "power_manager.h"
+#include "station_list.h"
+#include "esp_event.h"
 
 #define SHUTDOWN_GPIO       22
 #define PA_GPIO             21
+#define SD_DETECT_GPIO      34
 #define LOW_LVL             0
 #define HIGH_LVL            1
 
-#define ALC_VOLUME_SET      (0)
-
-#define	F31Hz	0
-#define F62Hz	1
-#define	F125Hz	2
-#define	F250Hz	3
-#define	F500Hz	4
-#define	F1kHz	5
-#define	F2kHz	6
-#define	F4kHz	7
-#define	F8kHz	8
-#define	F16kHz	9
-
 static const char *TAG = "MULTIFUNCTION_SPEAKER";
 
-audio_pipeline_handle_t pipeline_init_mode;
-audio_pipeline_handle_t pipeline_sd;
-audio_pipeline_handle_t pipeline_http;
-audio_pipeline_handle_t pipeline_bt;
-audio_element_handle_t tone_stream_reader, http_stream_reader, fatfs_stream_reader, bt_stream_reader, i2s_stream_writer, mp3_decoder, equalizer, alc_el;
+static player_pipeline_handle_t player;
+#if CONFIG_SPEAKER_TELEMETRY
+static telemetry_handle_t telemetry = NULL;
+#endif
 
-playlist_operator_handle_t sdcard_list_handle = NULL;
+static music_index_handle_t music_index = NULL;
+static mode_arena_handle_t sd_arena = NULL;
+static music_track_t sd_track;
 bool sd_card_cb = false;
-bool vol90, vol80, vol70, vol60 = false;
 
-static const char *radio_stations[] = {
+/* Played until a card brings stations.m3u or stations.pls, that list is kept in NVS from then on */
+static const char *const s_default_stations[] = {
 	"http://icecast7.play.cz:8000/casradio128.mp3",
     "https://ice.actve.net/fm-evropa2-128",	 
     "https://icecast4.play.cz/kissjc128.mp3",
 };
+static station_list_handle_t stations = NULL;
+static station_list_handle_t card_stations = NULL;     /* Read with the card, taken over on the main task */
 
-typedef enum {
-    SD_CARD_DET = 1,
-    SD_MODE_INIT,
-    SD_MODE,
-    BT_MODE_INIT,
-    BT_MODE,
-    WIFI_MODE_INIT,
-    WIFI_MODE,
-    RESTART_MODE
-} service_mode_t;
-
-static void adapt_equalizer(int player_volume) 
+static speaker_control_t control;
+static esp_periph_handle_t bt_periph = NULL;
+static int64_t mode_key_us;
+static resume_state_t resume;           /* Where playback is, handed to resume_state every tick */
+static bool resume_pending;             /* The first card detection still has to go back to the saved mode */
+static bool skip_mode_tone;             /* The resumed mode starts without its announcement */
+static uint32_t sd_resume_offset;       /* Where the first SD track starts, 0 for its beginning */
+
+static void bt_app_avrc_tg_cb(esp_avrc_tg_cb_event_t event, esp_avrc_tg_cb_param_t *p_param)
 {
-    if (player_volume >= 90) {
-        if (vol90 == false) {
-            //                31 62 .12 .25 .5 1k 2k  4k  8k 16k
-            int set_gain[] = { 4, 6, 6, 4, 4, 0, -18, -8, -4, 2};
-            equalizer_set_gain_info(equalizer,F31Hz , set_gain[0],1);
-            equalizer_set_gain_info(equalizer,F62Hz , set_gain[1],1); 
-            equalizer_set_gain_info(equalizer,F125Hz, set_gain[2],1);
-            equalizer_set_gain_info(equalizer,F250Hz, set_gain[3],1);
-            equalizer_set_gain_info(equalizer,F500Hz, set_gain[4],1);
-            equalizer_set_gain_info(equalizer,F1kHz , set_gain[5],1);
-            equalizer_set_gain_info(equalizer,F2kHz , set_gain[6],1);
-            equalizer_set_gain_info(equalizer,F4kHz , set_gain[7],1);
-            equalizer_set_gain_info(equalizer,F8kHz , set_gain[8],1);
-            equalizer_set_gain_info(equalizer,F16kHz, set_gain[9],1);
-            ESP_LOGI(TAG, "The equalizer is set");
-            vol90 = true;
-            vol80 = false;
+    esp_avrc_tg_cb_param_t *rc = p_param;
+    switch (event) {
+        case ESP_AVRC_TG_SET_ABSOLUTE_VOLUME_CMD_EVT: {
+            ESP_LOGI(TAG, "AVRC set absolute volume: %d%%", (int)rc->set_abs_vol.volume * 100/ 0x7f);
+            player_pipeline_set_volume(player, (int)rc->set_abs_vol.volume * 100/ 0x7f);
+            break;
         }
+        default:
+            break;
     }
-    if (player_volume < 90 && player_volume >= 80) {
-        if (vol80 == false) {
-            //                31 62 .12 .25 .5 1k 2k  4k  8k 16k
-            int set_gain[] = { 5, 6, 6, 6, 5, 1, -16, -7, -2, 4};
-            equalizer_set_gain_info(equalizer,F31Hz , set_gain[0],1);
-            equalizer_set_gain_info(equalizer,F62Hz , set_gain[1],1); 
-            equalizer_set_gain_info(equalizer,F125Hz, set_gain[2],1);
-            equalizer_set_gain_info(equalizer,F250Hz, set_gain[3],1);
-            equalizer_set_gain_info(equalizer,F500Hz, set_gain[4],1);
-            equalizer_set_gain_info(equalizer,F1kHz , set_gain[5],1);
-            equalizer_set_gain_info(equalizer,F2kHz , set_gain[6],1);
-            equalizer_set_gain_info(equalizer,F4kHz , set_gain[7],1);
-            equalizer_set_gain_info(equalizer,F8kHz , set_gain[8],1);
-            equalizer_set_gain_info(equalizer,F16kHz, set_gain[9],1);
-            ESP_LOGI(TAG, "The equalizer is set");
-            vol80 = true;
-            vol90 = false;
-            vol70 = false;
-        }
+}
+
+/* Logged once, as soon as the first audio of this boot is out */
+static void log_boot_timeline(void)
+{
+    output_stage_stats_t stats;
+    output_stage_get_stats(player->output, &stats);
+    boot_sequence_log(stats.first_audio_us);
+}
+
+/* Only a playing mode is worth coming back to, the SD position is kept while another mode plays */
+static void save_resume_state(void)
+{
+    if (control.mode != SD_MODE && control.mode != BT_MODE && control.mode != WIFI_MODE) {
+        return;
     }
-    if (player_volume < 80 && player_volume >= 70) {
-        if (vol70 == false) {
-            //                31 62 .12 .25 .5 1k 2k  4k  8k 16k
-            int set_gain[] = { 6, 7, 7, 7, 6, 2, -14, -6, -1, 5};
-            equalizer_set_gain_info(equalizer,F31Hz , set_gain[0],1);
-            equalizer_set_gain_info(equalizer,F62Hz , set_gain[1],1); 
-            equalizer_set_gain_info(equalizer,F125Hz, set_gain[2],1);
-            equalizer_set_gain_info(equalizer,F250Hz, set_gain[3],1);
-            equalizer_set_gain_info(equalizer,F500Hz, set_gain[4],1);
-            equalizer_set_gain_info(equalizer,F1kHz , set_gain[5],1);
-            equalizer_set_gain_info(equalizer,F2kHz , set_gain[6],1);
-            equalizer_set_gain_info(equalizer,F4kHz , set_gain[7],1);
-            equalizer_set_gain_info(equalizer,F8kHz , set_gain[8],1);
-            equalizer_set_gain_info(equalizer,F16kHz, set_gain[9],1);
-            ESP_LOGI(TAG, "The equalizer is set");
-            vol70 = true;
-            vol80 = false;
-            vol60 = false;
-        }
+    resume.mode = control.mode;
+    resume.volume = control.volume;
+    resume.station = control.station;
+    if (control.mode == SD_MODE && music_index) {
+        /* The reader does not advance the playlist in between, the offset is within this track */
+        audio_element_handle_t sd_reader = player_pipeline_sd_reader(player);
+        playlist_reader_lock(sd_reader);
+        resume.track = music_index_current_id(music_index);
+        resume.offset = playlist_reader_get_offset(sd_reader);
+        playlist_reader_unlock(sd_reader);
     }
-    if (player_volume < 70 && player_volume >= 60) {
-        if (vol60 == false) {
-            //                31 62 .12 .25 .5 1k 2k  4k  8k 16k
-            int set_gain[] = { 7, 8, 8, 8, 8, 4, -12, -4, 1, 6};
-            equalizer_set_gain_info(equalizer,F31Hz , set_gain[0],1);
-            equalizer_set_gain_info(equalizer,F62Hz , set_gain[1],1); 
-            equalizer_set_gain_info(equalizer,F125Hz, set_gain[2],1);
-            equalizer_set_gain_info(equalizer,F250Hz, set_gain[3],1);
-            equalizer_set_gain_info(equalizer,F500Hz, set_gain[4],1);
-            equalizer_set_gain_info(equalizer,F1kHz , set_gain[5],1);
-            equalizer_set_gain_info(equalizer,F2kHz , set_gain[6],1);
-            equalizer_set_gain_info(equalizer,F4kHz , set_gain[7],1);
-            equalizer_set_gain_info(equalizer,F8kHz , set_gain[8],1);
-            equalizer_set_gain_info(equalizer,F16kHz, set_gain[9],1);
-            ESP_LOGI(TAG, "The equalizer is set");
-            vol60 = true;
-            vol70 = false;
+    resume_state_set(&resume);
+    resume_state_flush(false);
+}
+
+static void on_tick(void *ctx)
+{
+    log_boot_timeline();
+    save_resume_state();
+}
+
+static void play_mode_tone(audio_event_iface_handle_t evt, tone_type_t tone)
+{
+    if (skip_mode_tone) {
+        /* Back to the music of the last power cycle straight away, the tones come with the next mode key */
+        skip_mode_tone = false;
+        return;
+    }
+    ESP_LOGI(TAG, "[ * ] Link [flash_tone]-->output_stage-->i2s_stream-->[codec_chip]");
+    if (player_pipeline_switch(player, PLAYER_SOURCE_PROMPT, NULL) != ESP_OK) {
+        return;
+    }
+    if (prompt_player_play(tone) != ESP_OK) {
+        return;
+    }
+
+    power_manager_allow_amp(true);
+    player_pipeline_run(player);
+
+    while (1) {
+        audio_event_iface_msg_t msg = { 0 };
+        esp_err_t ret = audio_event_iface_listen(evt, &msg, portMAX_DELAY);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "[ * ] Event interface error : %d", ret);
+            continue;
+        }
+
+        /* Stop when the last pipeline element (player->sink) receives stop event */
+        if (msg.source_type == AUDIO_ELEMENT_TYPE_ELEMENT && msg.source == (void *) player->sink
+            && msg.cmd == AEL_MSG_CMD_REPORT_STATUS
+            && (((int)msg.data == AEL_STATUS_STATE_STOPPED) || ((int)msg.data == AEL_STATUS_STATE_FINISHED))) {
+            ESP_LOGW(TAG, "[ * ] Stop event received");
+            break;
         }
     }
+    power_manager_allow_amp(false);
+    player_pipeline_stop(player);
+    log_boot_timeline();
 }
 
-void sdcard_url_save_cb(void *user_data, char *url)
+static void board_set_volume(void *ctx, int volume)
 {
-    playlist_operator_handle_t sdcard_handle = (playlist_operator_handle_t)user_data;
-    esp_err_t ret = sdcard_list_save(sdcard_handle, url);
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Fail to save sdcard url to sdcard playlist");
+    audio_board_handle_t board_handle = (audio_board_handle_t)ctx;
+    audio_hal_set_volume(board_handle->audio_hal, volume);
+    player_pipeline_set_volume(player, volume);
+    ESP_LOGI(TAG, "[ * ] Volume set to %d %%", volume);
+}
+
+static void board_set_amp(void *ctx, bool on)
+{
+    power_manager_allow_amp(on);
+}
+
+/* The only place the SHUTDOWN pin is driven, the power manager decides when */
+static void board_drive_amp(void *ctx, bool on)
+{
+    ESP_LOGD(TAG, "[ * ] Turn the SHUTDOWN %s", on ? "HIGH" : "LOW");
+    gpio_set_level(SHUTDOWN_GPIO, on ? HIGH_LVL : LOW_LVL);
+}
+
+static void board_play_prompt(void *ctx, speaker_prompt_t prompt)
+{
+    prompt_player_play(prompt == SPEAKER_PROMPT_VOLUME_MAX ? TONE_TYPE_VOLUME_MAX : TONE_TYPE_STATION_CHANGED);
+}
+
+static void board_tune(void *ctx, int station)
+{
+    ESP_LOGI(TAG, "Station: %s %s and index position is: %d", station_list_url(stations, station),
+             station_list_name(stations, station), station);
+    player_pipeline_crossfade(player, station_list_url(stations, station));
+}
+
+/* Posted by the player on the default event loop, from the task of the radio reader */
+static void on_stream_title(void *arg, esp_event_base_t base, int32_t id, void *data)
+{
+    const char *name = station_list_name(stations, control.station);
+    ESP_LOGI(TAG, "[ * ] Now playing on %s: %s", name[0] ? name : station_list_url(stations, control.station),
+             (const char *)data);
+}
+
+/* The stations of the card replace the current ones, the radio is stopped whenever the card is looked at */
+static void adopt_card_stations(void)
+{
+    if (card_stations == NULL) {
+        return;
     }
+    station_list_save_nvs(card_stations);
+    player_pipeline_set_stations(player, NULL, 0);
+    station_list_destroy(stations);
+    stations = card_stations;
+    card_stations = NULL;
+    speaker_control_set_station_count(&control, station_list_count(stations));
 }
 
-static void bt_app_avrc_tg_cb(esp_avrc_tg_cb_event_t event, esp_avrc_tg_cb_param_t *p_param)
+static void on_mode_key(void *ctx, const input_event_t *event)
 {
-    esp_avrc_tg_cb_param_t *rc = p_param;
-    switch (event) {
-        case ESP_AVRC_TG_SET_ABSOLUTE_VOLUME_CMD_EVT: {
-            ESP_LOGI(TAG, "AVRC set absolute volume: %d%%", (int)rc->set_abs_vol.volume * 100/ 0x7f);
-            adapt_equalizer((int)rc->set_abs_vol.volume * 100/ 0x7f);
+    mode_key_us = event->time_us;
+    speaker_control_event(&control, SPEAKER_EVENT_MODE_KEY);
+}
+
+/* The mode key to the audio of the next mode, tone included: what a mode change costs the listener */
+static void log_mode_ready(void)
+{
+    if (mode_key_us) {
+        ESP_LOGI(TAG, "[ * ] %s mode playing %d ms after the mode key", speaker_control_mode_name(control.mode),
+                 (int)((esp_timer_get_time() - mode_key_us) / 1000));
+        mode_key_us = 0;
+    }
+}
+
+static void on_play_key(void *ctx, const input_event_t *event)
+{
+    audio_element_state_t el_state = audio_element_get_state(player->sink);
+    switch (el_state) {
+        case AEL_STATE_INIT :
+            ESP_LOGI(TAG, "[ * ] Starting audio pipeline");
+            speaker_control_unmute(&control);
+            if (control.mode == WIFI_MODE) {
+                player_pipeline_restart(player, NULL);
+            } else {
+                player_pipeline_run(player);
+            }
             break;
-        }
-        default:
+        case AEL_STATE_RUNNING :
+            ESP_LOGI(TAG, "[ * ] Pausing audio pipeline");
+            player_pipeline_pause(player);
             break;
+        case AEL_STATE_PAUSED :
+            ESP_LOGI(TAG, "[ * ] Resuming audio pipeline");
+            speaker_control_unmute(&control);
+            player_pipeline_resume(player);
+            break;
+        default :
+            ESP_LOGI(TAG, "[ * ] Not supported state %d", el_state);
+    }
+}
+
+static void on_volume_up(void *ctx, const input_event_t *event)
+{
+    bool paused = audio_element_get_state(player->sink) == AEL_STATE_PAUSED;
+    speaker_control_volume_up(&control, paused);
+}
+
+static void on_volume_down(void *ctx, const input_event_t *event)
+{
+    speaker_control_volume_down(&control);
+}
+
+static void sd_step(int step)
+{
+    ESP_LOGI(TAG, "[ * ] Advancing to the %s song", step > 0 ? "next" : "prev");
+    music_index_step(music_index, step, &sd_track);
+    ESP_LOGW(TAG, "URL: %s", sd_track.path);
+    player_pipeline_select_format(player, sd_track.info.format);
+    player_pipeline_crossfade(player, sd_track.path);
+}
+
+static void sd_on_prev(void *ctx, const input_event_t *event)
+{
+    sd_step(-1);
+}
+
+static void sd_on_next(void *ctx, const input_event_t *event)
+{
+    sd_step(1);
+}
+
+static void bt_on_mode(void *ctx, const input_event_t *event)
+{
+    periph_bluetooth_stop(bt_periph);
+    on_mode_key(ctx, event);
+}
+
+static void bt_on_play(void *ctx, const input_event_t *event)
+{
+    periph_bluetooth_play_pause(bt_periph);
+}
+
+/* Between the music depth and the video depth of the Bluetooth buffer */
+static void bt_on_latency(void *ctx, const input_event_t *event)
+{
+    int depth = player_pipeline_set_bt_low_latency(player, !player->bt_low_latency);
+    ESP_LOGI(TAG, "[ * ] Bluetooth buffer %d ms, %s", depth, player->bt_low_latency ? "low latency for video" : "music");
+}
+
+static void bt_on_prev(void *ctx, const input_event_t *event)
+{
+    periph_bluetooth_prev(bt_periph);
+}
+
+static void bt_on_next(void *ctx, const input_event_t *event)
+{
+    periph_bluetooth_next(bt_periph);
+}
+
+static void bt_follow_volume(void)
+{
+    int volume;
+    audio_hal_get_volume(audio_board_get_handle()->audio_hal, &volume);
+    speaker_control_set_volume(&control, volume);
+}
+
+static void bt_on_volume_up(void *ctx, const input_event_t *event)
+{
+    periph_bluetooth_volume_up(bt_periph);
+    bt_follow_volume();
+}
+
+static void bt_on_volume_down(void *ctx, const input_event_t *event)
+{
+    periph_bluetooth_volume_down(bt_periph);
+    bt_follow_volume();
+}
+
+static void radio_on_prev(void *ctx, const input_event_t *event)
+{
+    speaker_control_station_step(&control, -1);
+}
+
+static void radio_on_next(void *ctx, const input_event_t *event)
+{
+    speaker_control_station_step(&control, 1);
+}
+
+/* Boot job: the codec's I2C setup runs while NVS, the keys and the SD card come up */
+static esp_err_t boot_start_codec(void *arg)
+{
+    audio_board_handle_t *board = (audio_board_handle_t *)arg;
+    *board = audio_board_init();
+    if (*board == NULL) {
+        return ESP_FAIL;
     }
+    return audio_hal_ctrl_codec((*board)->audio_hal, AUDIO_HAL_CODEC_MODE_DECODE, AUDIO_HAL_CTRL_START);
 }
 
+/* Mount the card, start the keys and load the music index, ESP_OK when there is music to play */
+static esp_err_t sd_prepare(void *arg)
+{
+    esp_periph_set_handle_t set = (esp_periph_set_handle_t)arg;
+    audio_board_sdcard_init(set, SD_MODE_1_LINE);
+    audio_board_key_init(set);
+    card_stations = station_list_load_card();
+    if (music_index_open(&music_index, sd_arena) == ESP_OK && music_index_count(music_index) > 0) {
+        return ESP_OK;
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+/*
+ * Take Bluedroid and the controller down to idle so the next BT mode can start
+ * them again. Whatever bluetooth_service_destroy() leaves up is stopped here.
+ */
+static void bt_release(void)
+{
+    int64_t start_us = esp_timer_get_time();
+    bluetooth_service_destroy();
+    if (esp_bluedroid_get_status() == ESP_BLUEDROID_STATUS_ENABLED) {
+        esp_bluedroid_disable();
+    }
+    if (esp_bluedroid_get_status() == ESP_BLUEDROID_STATUS_INITIALIZED) {
+        esp_bluedroid_deinit();
+    }
+    if (esp_bt_controller_get_status() == ESP_BT_CONTROLLER_STATUS_ENABLED) {
+        esp_bt_controller_disable();
+    }
+    if (esp_bt_controller_get_status() == ESP_BT_CONTROLLER_STATUS_INITED) {
+        esp_bt_controller_deinit();
+    }
+    bt_periph = NULL;
+    ESP_LOGI(TAG, "[ * ] Bluetooth released in %d ms", (int)((esp_timer_get_time() - start_us) / 1000));
+}
+
+/* Held volume keys repeat, every other key acts once on press */
+static const input_binding_t s_key_bindings[] = {
+    { SD_MODE,      INPUT_KEY_MODE,     INPUT_GESTURE_TAP,      on_mode_key },
+    { SD_MODE,      INPUT_KEY_PLAY,     INPUT_GESTURE_TAP,      on_play_key },
+    { SD_MODE,      INPUT_KEY_REC,      INPUT_GESTURE_TAP,      sd_on_prev },
+    { SD_MODE,      INPUT_KEY_SET,      INPUT_GESTURE_TAP,      sd_on_next },
+    { SD_MODE,      INPUT_KEY_VOLUP,    INPUT_GESTURE_TAP,      on_volume_up },
+    { SD_MODE,      INPUT_KEY_VOLUP,    INPUT_GESTURE_REPEAT,   on_volume_up },
+    { SD_MODE,      INPUT_KEY_VOLDOWN,  INPUT_GESTURE_TAP,      on_volume_down },
+    { SD_MODE,      INPUT_KEY_VOLDOWN,  INPUT_GESTURE_REPEAT,   on_volume_down },
+
+    { BT_MODE,      INPUT_KEY_MODE,     INPUT_GESTURE_TAP,      bt_on_mode },
+    { BT_MODE,      INPUT_KEY_PLAY,     INPUT_GESTURE_TAP,      bt_on_play },
+    { BT_MODE,      INPUT_KEY_PLAY,     INPUT_GESTURE_LONG,     bt_on_latency },
+    { BT_MODE,      INPUT_KEY_REC,      INPUT_GESTURE_TAP,      bt_on_prev },
+    { BT_MODE,      INPUT_KEY_SET,      INPUT_GESTURE_TAP,      bt_on_next },
+    { BT_MODE,      INPUT_KEY_VOLUP,    INPUT_GESTURE_TAP,      bt_on_volume_up },
+    { BT_MODE,      INPUT_KEY_VOLUP,    INPUT_GESTURE_REPEAT,   bt_on_volume_up },
+    { BT_MODE,      INPUT_KEY_VOLDOWN,  INPUT_GESTURE_TAP,      bt_on_volume_down },
+    { BT_MODE,      INPUT_KEY_VOLDOWN,  INPUT_GESTURE_REPEAT,   bt_on_volume_down },
+
+    { WIFI_MODE,    INPUT_KEY_MODE,     INPUT_GESTURE_TAP,      on_mode_key },
+    { WIFI_MODE,    INPUT_KEY_PLAY,     INPUT_GESTURE_TAP,      on_play_key },
+    { WIFI_MODE,    INPUT_KEY_REC,      INPUT_GESTURE_TAP,      radio_on_prev },
+    { WIFI_MODE,    INPUT_KEY_SET,      INPUT_GESTURE_TAP,      radio_on_next },
+    { WIFI_MODE,    INPUT_KEY_VOLUP,    INPUT_GESTURE_TAP,      on_volume_up },
+    { WIFI_MODE,    INPUT_KEY_VOLUP,    INPUT_GESTURE_REPEAT,   on_volume_up },
+    { WIFI_MODE,    INPUT_KEY_VOLDOWN,  INPUT_GESTURE_TAP,      on_volume_down },
+    { WIFI_MODE,    INPUT_KEY_VOLDOWN,  INPUT_GESTURE_REPEAT,   on_volume_down },
+};
+
 void app_main(void)
 {
     ESP_LOGI(TAG, "[ 0.0 ] Configure the IOMUX register for SHUTDOWN_GPIO");
     gpio_pad_select_gpio(SHUTDOWN_GPIO);
     gpio_set_direction(SHUTDOWN_GPIO, GPIO_MODE_OUTPUT);
 
-    ESP_LOGI(TAG, "[ 0.1 ] Turn the SHUTDOWN pin LOW");
-    gpio_set_level(SHUTDOWN_GPIO, LOW_LVL);
+    ESP_LOGI(TAG, "[ 0.1 ] Hand the SHUTDOWN pin to the power manager, it starts LOW");
+    power_manager_cfg_t power_cfg = DEFAULT_POWER_MANAGER_CONFIG();
+    power_cfg.set_amp = board_drive_amp;
+    power_manager_init(&power_cfg);
     gpio_set_level(PA_GPIO, LOW_LVL);
 
     ESP_LOGI(TAG, "[ 0.2 ] SD card detection");
-    if (gpio_get_level(34) == 0) {
+    if (gpio_get_level(SD_DETECT_GPIO) == 0) {
         sd_card_cb = true;
     }
     ESP_LOGI(TAG, "%i", sd_card_cb);
 
+    esp_log_level_set("*", ESP_LOG_WARN);
+    esp_log_level_set(TAG, ESP_LOG_DEBUG);
+    esp_log_level_set("PLAYER_PIPELINE", ESP_LOG_INFO);
+    esp_log_level_set("OUTPUT_STAGE", ESP_LOG_INFO);
+    esp_log_level_set("RADIO_READER", ESP_LOG_INFO);
+    esp_log_level_set("JITTER_BUFFER", ESP_LOG_INFO);
+    esp_log_level_set("INPUT_ROUTER", ESP_LOG_INFO);
+    esp_log_level_set("MEM_POLICY", ESP_LOG_INFO);
+    esp_log_level_set("MODE_ARENA", ESP_LOG_INFO);
+    esp_log_level_set("WIFI_LINK", ESP_LOG_INFO);
+    esp_log_level_set("BOOT_SEQUENCE", ESP_LOG_INFO);
+    esp_log_level_set("RESUME_STATE", ESP_LOG_INFO);
+    esp_log_level_set("POWER_MANAGER", ESP_LOG_INFO);
+    esp_log_level_set("STATION_LIST", ESP_LOG_INFO);
+    esp_log_level_set("HOST_CACHE", ESP_LOG_INFO);
+
+    /* Each step that does not need the codec runs while it starts, the SD card alongside both */
+    ESP_LOGI(TAG, "[ 0.3 ] Start audio codec chip in the background");
+    audio_board_handle_t board_handle = NULL;
+    boot_job_handle_t boot_codec = boot_job_start("boot_codec", boot_start_codec, &board_handle, BOOT_JOB_STACK);
+
+    ESP_LOGI(TAG, "[ 0.4 ] Reserve the arena of the SD mode");
+    sd_arena = mode_arena_create(CONFIG_SPEAKER_MODE_ARENA_KB * 1024);
+    if (sd_arena == NULL) {
+        ESP_LOGW(TAG, "[ * ] No arena, the music index uses the heap");
+    }
+
+    ESP_LOGI(TAG, "[ 1.0 ] Initialize peripherals management");
+    esp_periph_config_t periph_cfg = DEFAULT_ESP_PERIPH_SET_CONFIG();
+    esp_periph_set_handle_t set = esp_periph_set_init(&periph_cfg);
+
+    boot_job_handle_t boot_sd = NULL;
+    if (sd_card_cb == true) {
+        ESP_LOGI(TAG, "[ 1.1 ] Mount the SD card and load the music index in the background");
+        boot_sd = boot_job_start("boot_sd", sd_prepare, set, BOOT_JOB_STACK + 2 * 1024);
+    }
+
+    int phase = boot_phase_begin("nvs, netif");
     esp_err_t err = nvs_flash_init();
     if (err == ESP_ERR_NVS_NO_FREE_PAGES) {
         // NVS partition was truncated and needs to be erased
@@ -230,519 +505,242 @@ void app_main(void)
         ESP_ERROR_CHECK(nvs_flash_erase());
         err = nvs_flash_init();
     }
+    resume_pending = resume_state_init(&resume) == ESP_OK;
+    stations = station_list_load_nvs();
+    if (stations == NULL) {
+        stations = station_list_from_array(s_default_stations, sizeof(s_default_stations) / sizeof(s_default_stations[0]));
+    }
     ESP_ERROR_CHECK(esp_netif_init());
 
-    esp_log_level_set("*", ESP_LOG_WARN);
-    esp_log_level_set(TAG, ESP_LOG_DEBUG);
-
-    ESP_LOGI(TAG, "[ 1.0 ] Initialize peripherals management");
-    esp_periph_config_t periph_cfg = DEFAULT_ESP_PERIPH_SET_CONFIG();
-    esp_periph_set_handle_t set = esp_periph_set_init(&periph_cfg);
-
-    ESP_LOGI(TAG, "[ 2.0 ] Start audio codec chip");
-    audio_board_handle_t board_handle = audio_board_init();
-    audio_hal_ctrl_codec(board_handle->audio_hal, AUDIO_HAL_CODEC_MODE_DECODE, AUDIO_HAL_CTRL_START);
-
-    ESP_LOGI(TAG, "[ 3.0 ] Setup the volume");
-    int player_volume;
-    audio_hal_get_volume(board_handle->audio_hal, &player_volume);
-    player_volume = INIT_VOLUME;
-    audio_hal_set_volume(board_handle->audio_hal, player_volume);
-    ESP_LOGI(TAG, "[ * ] Volume set to %d %%", player_volume);
+    /* Only Classic BT is used, the BLE part of the controller memory goes back to the heap for good */
+    esp_bt_controller_mem_release(ESP_BT_MODE_BLE);
+    boot_phase_end(phase);
+
+    ESP_LOGI(TAG, "[ 2.0 ] Set up event listener");
+    audio_event_iface_cfg_t evt_cfg = AUDIO_EVENT_IFACE_DEFAULT_CFG();
+    audio_event_iface_handle_t evt = audio_event_iface_init(&evt_cfg);
+
+    ESP_LOGI(TAG, "[ 2.1 ] Route the keys of every mode");
+    input_router_cfg_t router_cfg = DEFAULT_INPUT_ROUTER_CONFIG();
+    router_cfg.tick = on_tick;
+    input_router_handle_t router = input_router_init(&router_cfg);
+    AUDIO_NULL_CHECK(TAG, router, return);
+    input_router_map(router, get_input_mode_id(), INPUT_KEY_MODE);
+    input_router_map(router, get_input_play_id(), INPUT_KEY_PLAY);
+    input_router_map(router, get_input_rec_id(), INPUT_KEY_REC);
+    input_router_map(router, get_input_set_id(), INPUT_KEY_SET);
+    input_router_map(router, get_input_volup_id(), INPUT_KEY_VOLUP);
+    input_router_map(router, get_input_voldown_id(), INPUT_KEY_VOLDOWN);
+    input_router_bind(router, s_key_bindings, sizeof(s_key_bindings) / sizeof(s_key_bindings[0]));
+
+    ESP_LOGI(TAG, "[ 2.2 ] Map the prompt tones from the flash_tone partition");
+    phase = boot_phase_begin("prompt tones");
+    if (prompt_player_init() != ESP_OK) {
+        ESP_LOGW(TAG, "[ * ] No prompt tones, flash tools/audio_tone_pcm.bin to the flash_tone partition");
+    }
+    boot_phase_end(phase);
 
+    ESP_LOGI(TAG, "[ 3.0 ] Wait for the audio codec chip");
+    phase = boot_phase_begin("wait for codec");
+    if (boot_job_join(boot_codec) != ESP_OK || board_handle == NULL) {
+        ESP_LOGE(TAG, "[ * ] The audio codec did not start");
+        return;
+    }
+    boot_phase_end(phase);
+
+    ESP_LOGI(TAG, "[ 3.1 ] Setup the volume");
+    static speaker_hal_t board_hal = {
+        .set_volume = board_set_volume,
+        .set_amp = board_set_amp,
+        .play_prompt = board_play_prompt,
+        .tune = board_tune,
+    };
+    board_hal.ctx = board_handle;
+    speaker_control_init(&control, &board_hal, station_list_count(stations));
+    if (resume_pending) {
+        speaker_control_resume(&control, resume.mode, resume.volume, resume.station);
+    }
+    audio_hal_set_volume(board_handle->audio_hal, control.volume);
+    ESP_LOGI(TAG, "[ * ] Volume set to %d %%", control.volume);
+
+#if CONFIG_SPEAKER_DSP_BENCHMARK
+    ESP_LOGI(TAG, "[ 3.2 ] Benchmark the DSP element");
+    esp_log_level_set("SPEAKER_DSP", ESP_LOG_INFO);
+    speaker_dsp_benchmark();
+#endif
+
+    ESP_LOGI(TAG, "[ 4.0 ] Create the playback pipeline shared by all modes");
+    phase = boot_phase_begin("pipeline");
+    player = player_pipeline_init(evt);
+    AUDIO_NULL_CHECK(TAG, player, return);
+    boot_phase_end(phase);
+    mem_policy_log("boot");
+
+#if CONFIG_SPEAKER_TELEMETRY
+    ESP_LOGI(TAG, "[ 4.1 ] Start the pipeline telemetry");
+    esp_log_level_set("TELEMETRY", ESP_LOG_INFO);
+    telemetry = telemetry_start(player, CONFIG_SPEAKER_TELEMETRY_PERIOD_S);
+#endif
+
+    service_mode_t last_mode = control.mode;
     while (1) {
-        static service_mode_t mode = SD_CARD_DET;
-        switch (mode) {
+        if (control.mode != last_mode) {
+            mem_policy_log_transition(speaker_control_mode_name(last_mode), speaker_control_mode_name(control.mode));
+            power_manager_log(speaker_control_mode_name(last_mode));
+            last_mode = control.mode;
+        }
+        switch (control.mode) {
             case SD_CARD_DET: {
-                if (sd_card_cb == true) {
-                    ESP_LOGI(TAG, "Initialize and start peripherals");
-                    audio_board_sdcard_init(set, SD_MODE_1_LINE);
-                    audio_board_key_init(set);
-
-                    ESP_LOGI(TAG, "Set up a sdcard playlist and scan sdcard music save to it");
-                    sdcard_list_create(&sdcard_list_handle);
-                    sdcard_scan(sdcard_url_save_cb, "/sdcard", 0, (const char *[]) {"mp3"}, 1, sdcard_list_handle);
-                    sdcard_list_show(sdcard_list_handle);
-
-                    mode = SD_MODE_INIT;
+                esp_err_t sd_ret = ESP_ERR_NOT_FOUND;
+                if (boot_sd) {
+                    /* The first pass takes what the boot job prepared */
+                    phase = boot_phase_begin("wait for SD card");
+                    sd_ret = boot_job_join(boot_sd);
+                    boot_phase_end(phase);
+                    boot_sd = NULL;
+                } else {
+                    /* Every cycle comes back here, the card may have been put in or taken out meanwhile */
+                    sd_card_cb = gpio_get_level(SD_DETECT_GPIO) == 0;
+                    if (sd_card_cb == true) {
+                        if (set == NULL) {
+                            set = esp_periph_set_init(&periph_cfg);
+                        }
+                        ESP_LOGI(TAG, "Initialize and start peripherals, load the music index");
+                        sd_ret = sd_prepare(set);
+                    }
+                }
+                adopt_card_stations();
+                if (resume_pending && sd_ret == ESP_OK && resume.mode == SD_MODE && resume.offset
+                    && resume.track == music_index_current_id(music_index)) {
+                    sd_resume_offset = resume.offset;
+                }
+                speaker_control_event(&control, sd_ret == ESP_OK ? SPEAKER_EVENT_SD_READY : SPEAKER_EVENT_SD_NONE);
+                if (resume_pending) {
+                    /* Every *_MODE_INIT directly precedes its mode */
+                    skip_mode_tone = control.mode + 1 == resume.mode;
+                    resume_pending = false;
+                }
+                if (control.mode == SD_MODE_INIT) {
+                    ESP_LOGI(TAG, "The music index is loaded, the card is verified in the background");
+                    music_index_refresh(music_index);
+                    break;
                 }
-                if (sd_card_cb == false) {
-                    mode = BT_MODE_INIT;
+                if (sd_card_cb == true) {
+                    if (sd_ret == ESP_OK) {
+                        ESP_LOGI(TAG, "[ * ] Resuming the %s mode, the SD card is released",
+                                 speaker_control_mode_name(resume.mode));
+                    } else {
+                        ESP_LOGW(TAG, "[ * ] No music on the SD card");
+                    }
+                    music_index_close(music_index);
+                    music_index = NULL;
+                    mode_arena_reset(sd_arena, "SD");
+                    esp_periph_set_destroy(set);
+                    set = NULL;
+                    sd_card_cb = false;
                 }
                 break;
             }
             case SD_MODE_INIT: {
                 ESP_LOGI(TAG, "SD MODE INIT");
-                player_volume = INIT_VOLUME;
-                audio_hal_set_volume(board_handle->audio_hal, player_volume);
-                ESP_LOGI(TAG, "[ * ] Volume set to %d %%", player_volume);
-                
-                ESP_LOGI(TAG, "[ 1.0 ] Create audio pipeline for playback");
-                audio_pipeline_cfg_t pipeline_cfg = DEFAULT_AUDIO_PIPELINE_CONFIG();
-                pipeline_init_mode = audio_pipeline_init(&pipeline_cfg);
-                AUDIO_NULL_CHECK(TAG, pipeline_init_mode, return);
-
-                ESP_LOGI(TAG, "[ 1.1 ] Create tone stream to read data from flash");
-                tone_stream_cfg_t tone_cfg = TONE_STREAM_CFG_DEFAULT();
-                tone_cfg.type = AUDIO_STREAM_READER;
-                tone_stream_reader = tone_stream_init(&tone_cfg);
-                AUDIO_NULL_CHECK(TAG, tone_stream_reader, return);
-
-                ESP_LOGI(TAG, "[ 1.2 ] Create i2s stream to write data to codec chip");
-                i2s_stream_cfg_t i2s_cfg = I2S_STREAM_CFG_DEFAULT();
-                i2s_cfg.type = AUDIO_STREAM_WRITER;
-                i2s_stream_writer = i2s_stream_init(&i2s_cfg);
-                AUDIO_NULL_CHECK(TAG, i2s_stream_writer, return);
-
-                ESP_LOGI(TAG, "[ 1.3 ] Create mp3 decoder to decode mp3 file");
-                mp3_decoder_cfg_t mp3_cfg = DEFAULT_MP3_DECODER_CONFIG();
-                mp3_decoder = mp3_decoder_init(&mp3_cfg);
-                AUDIO_NULL_CHECK(TAG, mp3_decoder, return);
-
-                ESP_LOGI(TAG, "[ 2.0 ] Register all elements to audio pipeline");
-                audio_pipeline_register(pipeline_init_mode, tone_stream_reader, "tone");
-                audio_pipeline_register(pipeline_init_mode, mp3_decoder, "mp3");
-                audio_pipeline_register(pipeline_init_mode, i2s_stream_writer, "i2s");
-
-                ESP_LOGI(TAG, "[ 2.1 ] Link it together [flash]-->tone_stream-->mp3_decoder-->i2s_stream-->[codec_chip]");
-                const char *link_tag[3] = {"tone", "mp3", "i2s"};
-                audio_pipeline_link(pipeline_init_mode, &link_tag[0], 3);
-
-                ESP_LOGI(TAG, "[ 2.2 ] Set up  uri (file as tone_stream, mp3 as mp3 decoder, and default output is i2s)");
-                audio_element_set_uri(tone_stream_reader, tone_uri[TONE_TYPE_SD_MODE]);
-
-                ESP_LOGI(TAG, "[ 3 ] Set up event listener");
-                audio_event_iface_cfg_t evt_cfg = AUDIO_EVENT_IFACE_DEFAULT_CFG();
-                audio_event_iface_handle_t evt = audio_event_iface_init(&evt_cfg);
-
-                ESP_LOGI(TAG, "[ 3.1 ] Listening event from all elements of pipeline");
-                audio_pipeline_set_listener(pipeline_init_mode, evt);
-
-                ESP_LOGI(TAG, "[ 3.2 ] Turn the SHUTDOWN HIGH");
-                gpio_set_level(SHUTDOWN_GPIO, HIGH_LVL);
-
-                ESP_LOGI(TAG, "[ 4 ] Start audio_pipeline");
-                audio_pipeline_run(pipeline_init_mode);
-
-                ESP_LOGI(TAG, "[ 5 ] Listen for all pipeline events");
-                while (1) {
-                    audio_event_iface_msg_t msg = { 0 };
-                    esp_err_t ret = audio_event_iface_listen(evt, &msg, portMAX_DELAY);
-                    if (ret != ESP_OK) {
-                        ESP_LOGE(TAG, "[ * ] Event interface error : %d", ret);
-                        continue;
-                    }
-
-                    if (msg.source_type == AUDIO_ELEMENT_TYPE_ELEMENT && msg.source == (void *) mp3_decoder
-                        && msg.cmd == AEL_MSG_CMD_REPORT_MUSIC_INFO) {
-                        audio_element_info_t music_info = {0};
-                        audio_element_getinfo(mp3_decoder, &music_info);
-
-                        ESP_LOGI(TAG, "[ * ] Receive music info from mp3 decoder, sample_rates=%d, bits=%d, ch=%d",
-                                music_info.sample_rates, music_info.bits, music_info.channels);
-
-                        audio_element_setinfo(i2s_stream_writer, &music_info);
-                        i2s_stream_set_clk(i2s_stream_writer, music_info.sample_rates, music_info.bits, music_info.channels);
-                        continue;
-                    }
-
-                    /* Stop when the last pipeline element (i2s_stream_writer in this case) receives stop event */
-                    if (msg.source_type == AUDIO_ELEMENT_TYPE_ELEMENT && msg.source == (void *) i2s_stream_writer
-                        && msg.cmd == AEL_MSG_CMD_REPORT_STATUS
-                        && (((int)msg.data == AEL_STATUS_STATE_STOPPED) || ((int)msg.data == AEL_STATUS_STATE_FINISHED))) {
-                        ESP_LOGW(TAG, "[ * ] Stop event received");
-                        break;
-                    }
-                }
-                ESP_LOGI(TAG, "[ 6 ] Turn the SHUTDOWN LOW");
-                gpio_set_level(SHUTDOWN_GPIO, LOW_LVL);
-
-                ESP_LOGI(TAG, "[ 7 ] Stop audio_pipeline");
-                audio_pipeline_stop(pipeline_init_mode);
-                audio_pipeline_wait_for_stop(pipeline_init_mode);
-                audio_pipeline_terminate(pipeline_init_mode);
-
-                audio_pipeline_unregister(pipeline_init_mode, tone_stream_reader);
-                audio_pipeline_unregister(pipeline_init_mode, i2s_stream_writer);
-                audio_pipeline_unregister(pipeline_init_mode, mp3_decoder);
-
-                /* Terminal the pipeline before removing the listener */
-                audio_pipeline_remove_listener(pipeline_init_mode);
-
-                /* Make sure audio_pipeline_remove_listener & audio_event_iface_remove_listener are called before destroying event_iface */
-                audio_event_iface_destroy(evt);
-
-                /* Release all resources */
-                audio_pipeline_deinit(pipeline_init_mode);
-                audio_element_deinit(tone_stream_reader);
-                audio_element_deinit(i2s_stream_writer);
-                audio_element_deinit(mp3_decoder);
-                mode = SD_MODE;
+                play_mode_tone(evt, TONE_TYPE_SD_MODE);
+                speaker_control_event(&control, SPEAKER_EVENT_READY);
                 break;
             }
             case SD_MODE: {
                 ESP_LOGI(TAG, "SD CARD MODE");
-                ESP_LOGI(TAG, "[ 1.0 ] Create audio pipeline for playback");
-                audio_pipeline_cfg_t pipeline_cfg = DEFAULT_AUDIO_PIPELINE_CONFIG();
-                pipeline_sd = audio_pipeline_init(&pipeline_cfg);
-                mem_assert(pipeline_sd);
-
-                ESP_LOGI(TAG, "[ 1.1 ] Create i2s stream to write data to codec chip");
-                i2s_stream_cfg_t i2s_cfg = I2S_STREAM_CFG_DEFAULT();
-                i2s_cfg.type = AUDIO_STREAM_WRITER;
-                i2s_cfg.use_alc = true;
-                i2s_stream_writer = i2s_stream_init(&i2s_cfg);
-
-                ESP_LOGI(TAG, "[ 1.2 ] Create mp3 decoder to decode mp3 file");
-                mp3_decoder_cfg_t mp3_cfg = DEFAULT_MP3_DECODER_CONFIG();
-                mp3_decoder = mp3_decoder_init(&mp3_cfg);
-
-                ESP_LOGI(TAG, "[ 1.3 ] Create ALC");
-                alc_volume_setup_cfg_t alc_cfg = DEFAULT_ALC_VOLUME_SETUP_CONFIG();
-                alc_el = alc_volume_setup_init(&alc_cfg);
-
-                ESP_LOGI(TAG, "[ 1.4 ] Create equalizer");
-                equalizer_cfg_t eq_cfg = DEFAULT_EQUALIZER_CONFIG();
-                /*                  31   62  125 250  500  1k   2k   4k   8k  16k  31   62  125 250  500  1k   2k   4k   8k  16k  [Hz]                   */
-                int set_gain[] = { 8, 8, 8, 8, 10, 4, -12, -4, 1, 4, 8, 8, 8, 8, 10, 4, -12, -4, 1, 4 };
-                eq_cfg.set_gain =
-                    set_gain; // The size of gain array should be the multiplication of NUMBER_BAND and number channels of audio stream data. The minimum of gain is -10 dB.
-                equalizer = equalizer_init(&eq_cfg);
-
-                ESP_LOGI(TAG, "[ 1.5 ] Create fatfs stream to read data from sdcard");
-                char *url = NULL;
-                sdcard_list_current(sdcard_list_handle, &url);
-                fatfs_stream_cfg_t fatfs_cfg = FATFS_STREAM_CFG_DEFAULT();
-                fatfs_cfg.type = AUDIO_STREAM_READER;
-                fatfs_stream_reader = fatfs_stream_init(&fatfs_cfg);
-                audio_element_set_uri(fatfs_stream_reader, url);
-
-                ESP_LOGI(TAG, "[ 2.0 ] Register all elements to audio pipeline");
-                audio_pipeline_register(pipeline_sd, fatfs_stream_reader, "file");
-                audio_pipeline_register(pipeline_sd, mp3_decoder, "mp3");
-                audio_pipeline_register(pipeline_sd, equalizer, "equalizer");
-                audio_pipeline_register(pipeline_sd, alc_el, "alc");
-                audio_pipeline_register(pipeline_sd, i2s_stream_writer, "i2s");
-
-                ESP_LOGI(TAG, "[ 2.1 ] Link it together [sdcard]-->fatfs_stream-->mp3_decoder-->resample-->i2s_stream-->[codec_chip]");
-                const char *link_tag[5] = {"file", "mp3", "equalizer", "alc", "i2s"};
-                audio_pipeline_link(pipeline_sd, &link_tag[0], 5);
-
-                ESP_LOGI(TAG, "[ 3.0 ] Set up  event listener");
-                audio_event_iface_cfg_t evt_cfg = AUDIO_EVENT_IFACE_DEFAULT_CFG();
-                audio_event_iface_handle_t evt = audio_event_iface_init(&evt_cfg);
-
-                ESP_LOGI(TAG, "[ 3.1 ] Listen for all pipeline events");
-                audio_pipeline_set_listener(pipeline_sd, evt);
-
-                ESP_LOGI(TAG, "[ 4 ] Listening event from peripherals");
+                music_index_current(music_index, &sd_track);
+                const char *decoder = sd_track.info.format == MEDIA_FORMAT_FLAC ? "flac_decoder-->"
+                                      : media_format_is_pcm(sd_track.info.format) ? "" : "mp3_decoder-->";
+                ESP_LOGI(TAG, "[ 1.0 ] Link [sdcard]-->playlist_reader-->%sdsp-->output_stage-->i2s_stream-->[codec_chip]", decoder);
+                ESP_LOGI(TAG, "[ * ] Track: %s (%s, %u s)", sd_track.path, sd_track.title, sd_track.duration_ms / 1000);
+                player_pipeline_select_format(player, sd_track.info.format);
+                player_pipeline_switch(player, PLAYER_SOURCE_SDCARD, sd_track.path);
+                if (sd_resume_offset) {
+                    playlist_reader_seek_once(player->file_reader, sd_resume_offset);
+                    sd_resume_offset = 0;
+                }
+                playlist_reader_ops_t playlist_ops;
+                music_index_playlist_ops(music_index, &playlist_ops);
+                player_pipeline_set_playlist(player, &playlist_ops);
+
+                ESP_LOGI(TAG, "[ 2.0 ] Listening event from peripherals");
                 audio_event_iface_set_listener(esp_periph_set_get_event_iface(set), evt);
 
-                ESP_LOGI(TAG, "[ 4.1 ] Turn the SHUTDOWN HIGH");
-                if (player_volume == 0) {
-                    gpio_set_level(SHUTDOWN_GPIO, LOW_LVL);
-                } else {
-                    gpio_set_level(SHUTDOWN_GPIO, HIGH_LVL);
-                }
+                ESP_LOGI(TAG, "[ 2.1 ] Unmute, the amplifier follows the programme");
+                speaker_control_unmute(&control);
 
-                ESP_LOGI(TAG, "[ 5 ] Start audio_pipeline");
-                audio_pipeline_run(pipeline_sd);
+                ESP_LOGI(TAG, "[ 3 ] Start audio_pipeline");
+                player_pipeline_run(player);
+                log_mode_ready();
 
-                while (mode == SD_MODE) {
+                input_router_set_mode(router, SD_MODE);
+                while (control.mode == SD_MODE) {
                     /* Handle event interface messages from pipeline
                     to set music info and to advance to the next song
                     */
                     audio_event_iface_msg_t msg;
-                    esp_err_t ret = audio_event_iface_listen(evt, &msg, portMAX_DELAY);
-                    if (ret != ESP_OK) {
-                        ESP_LOGE(TAG, "[ * ] Event interface error : %d", ret);
+                    if (input_router_listen(router, evt, &msg) != ESP_OK) {
+                        continue;
+                    }
+                    if (player_pipeline_crossfade_event(player, &msg)) {
                         continue;
                     }
                     if (msg.source_type == AUDIO_ELEMENT_TYPE_ELEMENT) {
-                        // Set music info for a new song to be played
-                        if (msg.source == (void *) mp3_decoder
+                        // Set music info for a new song to be played, from the decoder or the reader of PCM
+                        audio_element_handle_t info_src = player_pipeline_info_source(player);
+                        if (msg.source == (void *) info_src
                             && msg.cmd == AEL_MSG_CMD_REPORT_MUSIC_INFO) {
-                            audio_element_info_t music_info = {0};
-                            audio_element_getinfo(mp3_decoder, &music_info);
-                            ESP_LOGI(TAG, "[ * ] Received music info from mp3 decoder, sample_rates=%d, bits=%d, ch=%d",
-                                    music_info.sample_rates, music_info.bits, music_info.channels);
-                            audio_element_setinfo(i2s_stream_writer, &music_info);
-
-                            if (equalizer_set_info(equalizer, music_info.sample_rates, music_info.channels) != ESP_OK) {
-                                break;
-                            }
-
-                            alc_volume_setup_set_channel(alc_el, music_info.channels);
-                            alc_volume_setup_set_volume(alc_el, ALC_VOLUME_SET);
-
+                            player_pipeline_apply_music_info(player, info_src);
                             continue;
                         }
                         // Advance to the next song when previous finishes
-                        if (msg.source == (void *) i2s_stream_writer
+                        if (msg.source == (void *) player->sink
                             && msg.cmd == AEL_MSG_CMD_REPORT_STATUS) {
-                            audio_element_state_t el_state = audio_element_get_state(i2s_stream_writer);
+                            audio_element_state_t el_state = audio_element_get_state(player->sink);
                             if (el_state == AEL_STATE_FINISHED) {
                                 ESP_LOGI(TAG, "[ * ] Finished, advancing to the next song");
-                                sdcard_list_next(sdcard_list_handle, 1, &url);
-                                ESP_LOGW(TAG, "URL: %s", url);
-                                audio_element_set_uri(fatfs_stream_reader, url);
-                                audio_pipeline_reset_ringbuffer(pipeline_sd);
-                                audio_pipeline_reset_elements(pipeline_sd);
-                                audio_pipeline_change_state(pipeline_sd, AEL_STATE_INIT);
-                                audio_pipeline_run(pipeline_sd);
+                                music_index_step(music_index, 1, &sd_track);
+                                ESP_LOGW(TAG, "URL: %s", sd_track.path);
+                                player_pipeline_select_format(player, sd_track.info.format);
+                                player_pipeline_restart(player, sd_track.path);
                             }
                             continue;
                         }
                     }
-                    if ((msg.source_type == PERIPH_ID_TOUCH || msg.source_type == PERIPH_ID_BUTTON || msg.source_type == PERIPH_ID_ADC_BTN)
-                        && (msg.cmd == PERIPH_TOUCH_TAP || msg.cmd == PERIPH_BUTTON_PRESSED || msg.cmd == PERIPH_ADC_BUTTON_PRESSED)) {
-
-                        if ((int) msg.data == get_input_mode_id()) {
-                            ESP_LOGI(TAG, "[ * ] [Mode] touch tap event");
-                            gpio_set_level(SHUTDOWN_GPIO, LOW_LVL);
-                            mode = BT_MODE_INIT;
-                        } else if ((int) msg.data == get_input_play_id()) {
-                            ESP_LOGI(TAG, "[ * ] [Play] touch tap event");
-                            audio_element_state_t el_state = audio_element_get_state(i2s_stream_writer);
-                            switch (el_state) {
-                                case AEL_STATE_INIT :
-                                    ESP_LOGI(TAG, "[ * ] Starting audio pipeline");
-                                    if (player_volume == 0) {
-                                        gpio_set_level(SHUTDOWN_GPIO, LOW_LVL);
-                                    } else {
-                                        gpio_set_level(SHUTDOWN_GPIO, HIGH_LVL);
-                                    }
-                                    audio_pipeline_run(pipeline_sd);
-                                    break;
-                                case AEL_STATE_RUNNING :
-                                    ESP_LOGI(TAG, "[ * ] Pausing audio pipeline");
-                                    gpio_set_level(SHUTDOWN_GPIO, LOW_LVL);
-                                    audio_pipeline_pause(pipeline_sd);
-                                    break;
-                                case AEL_STATE_PAUSED :
-                                    ESP_LOGI(TAG, "[ * ] Resuming audio pipeline");
-                                    if (player_volume == 0) {
-                                        gpio_set_level(SHUTDOWN_GPIO, LOW_LVL);
-                                    } else {
-                                        gpio_set_level(SHUTDOWN_GPIO, HIGH_LVL);
-                                    }
-                                    audio_pipeline_resume(pipeline_sd);
-                                    break;
-                                default :
-                                    ESP_LOGI(TAG, "[ * ] Not supported state %d", el_state);
-                            }
-                        } else if ((int) msg.data == get_input_rec_id()) {
-                            ESP_LOGI(TAG, "[ * ] [Rec] touch tap event");
-                            ESP_LOGI(TAG, "[ * ] Stopped, advancing to the prev song");
-                            gpio_set_level(SHUTDOWN_GPIO, LOW_LVL);
-                            char *url = NULL;
-                            audio_pipeline_stop(pipeline_sd);
-                            audio_pipeline_wait_for_stop(pipeline_sd);
-                            audio_pipeline_terminate(pipeline_sd);
-                            sdcard_list_prev(sdcard_list_handle, 1, &url);
-                            ESP_LOGW(TAG, "URL: %s", url);
-                            audio_element_set_uri(fatfs_stream_reader, url);
-                            audio_pipeline_reset_ringbuffer(pipeline_sd);
-                            audio_pipeline_reset_elements(pipeline_sd);
-                            audio_pipeline_run(pipeline_sd);
-                            break;
-                        } else if ((int) msg.data == get_input_set_id()) {
-                            ESP_LOGI(TAG, "[ * ] [Set] touch tap event");
-                            ESP_LOGI(TAG, "[ * ] Stopped, advancing to the next song");
-                            gpio_set_level(SHUTDOWN_GPIO, LOW_LVL);
-                            char *url = NULL;
-                            audio_pipeline_stop(pipeline_sd);
-                            audio_pipeline_wait_for_stop(pipeline_sd);
-                            audio_pipeline_terminate(pipeline_sd);
-                            sdcard_list_next(sdcard_list_handle, 1, &url);
-                            ESP_LOGW(TAG, "URL: %s", url);
-                            audio_element_set_uri(fatfs_stream_reader, url);
-                            audio_pipeline_reset_ringbuffer(pipeline_sd);
-                            audio_pipeline_reset_elements(pipeline_sd);
-                            audio_pipeline_run(pipeline_sd);
-                            break;
-                        } else if ((int) msg.data == get_input_volup_id()) {
-                            ESP_LOGI(TAG, "[ * ] [Vol+] touch tap event");
-                            audio_element_state_t el_state = audio_element_get_state(i2s_stream_writer);
-                            if (el_state == AEL_STATE_PAUSED) {
-                                gpio_set_level(SHUTDOWN_GPIO, LOW_LVL);
-                            } else {
-                                gpio_set_level(SHUTDOWN_GPIO, HIGH_LVL);
-                            }
-                            if (player_volume == 0) {
-                                player_volume = VOL_BOTTOM_TRH;
-                            }
-                            if (player_volume <= VOL_TRH) {
-                                player_volume += VOL_INCREASE_LOW;
-                            } else {
-                                player_volume += VOL_INCREASE_UP;
-                            }
-                            if (player_volume >= VOL_UPPER_TRH) {
-                                player_volume = VOL_UPPER_TRH;
-                            }
-                            adapt_equalizer(player_volume);
-                            audio_hal_set_volume(board_handle->audio_hal, player_volume);
-                            ESP_LOGI(TAG, "[ * ] Volume set to %d %%", player_volume);
-                        } else if ((int) msg.data == get_input_voldown_id()) {
-                            ESP_LOGI(TAG, "[ * ] [Vol-] touch tap event");
-                            if (player_volume <= VOL_TRH) {
-                                player_volume -= VOL_DECREASE_LOW;
-                            } else {
-                                player_volume -= VOL_DECREASE_UP;
-                            }
-                            if (player_volume <= VOL_BOTTOM_TRH) {
-                                player_volume = 0;
-                                gpio_set_level(SHUTDOWN_GPIO, LOW_LVL);
-                            }
-                            adapt_equalizer(player_volume);
-                            audio_hal_set_volume(board_handle->audio_hal, player_volume);
-                            ESP_LOGI(TAG, "[ * ] Volume set to %d %%", player_volume);
-                        }
-                    }
                 }
 
-                ESP_LOGI(TAG, "[ 7 ] Stop audio_pipeline");
-                audio_pipeline_stop(pipeline_sd);
-                audio_pipeline_wait_for_stop(pipeline_sd);
-                audio_pipeline_terminate(pipeline_sd);
-
-                audio_pipeline_unregister(pipeline_sd, mp3_decoder);
-                audio_pipeline_unregister(pipeline_sd, alc_el);
-                audio_pipeline_unregister(pipeline_sd, equalizer);
-                audio_pipeline_unregister(pipeline_sd, i2s_stream_writer);
-
-                /* Terminate the pipeline before removing the listener */
-                audio_pipeline_remove_listener(pipeline_sd);
-
-                /* Stop all peripherals before removing the listener */
+                ESP_LOGI(TAG, "[ 4 ] Stop audio_pipeline");
+                /* The position of the last tick goes to flash now, the next save would be a period away */
+                resume_state_flush(true);
+                player_pipeline_stop(player);
+                player_pipeline_set_playlist(player, NULL);
+
+                output_stage_stats_t gap_stats;
+                output_stage_get_stats(player->output, &gap_stats);
+                ESP_LOGI(TAG, "[ * ] Inter-track silence: %u samples over %u track changes, last %u",
+                         (uint32_t)gap_stats.gap_samples, gap_stats.boundaries, gap_stats.last_gap);
+#if CONFIG_SPEAKER_TELEMETRY
+                telemetry_log_stacks(telemetry);
+#endif
+
+                /* Stop listening to the peripherals, the pipeline itself stays alive for the next mode */
                 audio_event_iface_remove_listener(esp_periph_set_get_event_iface(set), evt);
 
-                /* Make sure audio_pipeline_remove_listener & audio_event_iface_remove_listener are called before destroying event_iface */
-                audio_event_iface_destroy(evt);
-
-                /* Release all resources */
-                audio_pipeline_deinit(pipeline_sd);
-                audio_element_deinit(i2s_stream_writer);
-                audio_element_deinit(mp3_decoder);
-                audio_element_deinit(alc_el);
-                audio_element_deinit(equalizer);
-
-                if (mode != SD_MODE) {
+                if (control.mode != SD_MODE) {
                     ESP_LOGW(TAG, "[ * ] SD card destroyed");
-                    sdcard_list_destroy(sdcard_list_handle);
+                    music_index_close(music_index);
+                    music_index = NULL;
+                    mode_arena_reset(sd_arena, "SD");
                     esp_periph_set_destroy(set);
+                    set = NULL;
                 }
                 break;
             }
             case BT_MODE_INIT: {
                 ESP_LOGI(TAG, "BT MODE INIT");
-                ESP_LOGI(TAG, "[ 0.0 ] Setup the volume");
-                player_volume = INIT_VOLUME;
-                audio_hal_set_volume(board_handle->audio_hal, player_volume);
-                ESP_LOGI(TAG, "[ * ] Volume set to %d %%", player_volume);
-
-                ESP_LOGI(TAG, "[ 1.0 ] Create audio pipeline for playback");
-                audio_pipeline_cfg_t pipeline_cfg = DEFAULT_AUDIO_PIPELINE_CONFIG();
-                pipeline_init_mode = audio_pipeline_init(&pipeline_cfg);
-                AUDIO_NULL_CHECK(TAG, pipeline_init_mode, return);
-
-                ESP_LOGI(TAG, "[ 1.1 ] Create tone stream to read data from flash");
-                tone_stream_cfg_t tone_cfg = TONE_STREAM_CFG_DEFAULT();
-                tone_cfg.type = AUDIO_STREAM_READER;
-                tone_stream_reader = tone_stream_init(&tone_cfg);
-                AUDIO_NULL_CHECK(TAG, tone_stream_reader, return);
-
-                ESP_LOGI(TAG, "[ 1.2 ] Create i2s stream to write data to codec chip");
-                i2s_stream_cfg_t i2s_cfg = I2S_STREAM_CFG_DEFAULT();
-                i2s_cfg.type = AUDIO_STREAM_WRITER;
-                i2s_stream_writer = i2s_stream_init(&i2s_cfg);
-                AUDIO_NULL_CHECK(TAG, i2s_stream_writer, return);
-
-                ESP_LOGI(TAG, "[ 1.3 ] Create mp3 decoder to decode mp3 file");
-                mp3_decoder_cfg_t mp3_cfg = DEFAULT_MP3_DECODER_CONFIG();
-                mp3_decoder = mp3_decoder_init(&mp3_cfg);
-                AUDIO_NULL_CHECK(TAG, mp3_decoder, return);
-
-                ESP_LOGI(TAG, "[ 2.0 ] Register all elements to audio pipeline");
-                audio_pipeline_register(pipeline_init_mode, tone_stream_reader, "tone");
-                audio_pipeline_register(pipeline_init_mode, mp3_decoder, "mp3");
-                audio_pipeline_register(pipeline_init_mode, i2s_stream_writer, "i2s");
-
-                ESP_LOGI(TAG, "[ 2.1 ] Link it together [flash]-->tone_stream-->mp3_decoder-->i2s_stream-->[codec_chip]");
-                const char *link_tag[3] = {"tone", "mp3", "i2s"};
-                audio_pipeline_link(pipeline_init_mode, &link_tag[0], 3);
-
-                ESP_LOGI(TAG, "[ 2.2 ] Set up  uri (file as tone_stream, mp3 as mp3 decoder, and default output is i2s)");
-                audio_element_set_uri(tone_stream_reader, tone_uri[TONE_TYPE_BT_MODE]);
-
-                ESP_LOGI(TAG, "[ 3 ] Set up event listener");
-                audio_event_iface_cfg_t evt_cfg = AUDIO_EVENT_IFACE_DEFAULT_CFG();
-                audio_event_iface_handle_t evt = audio_event_iface_init(&evt_cfg);
-
-                ESP_LOGI(TAG, "[ 3.1 ] Listening event from all elements of pipeline");
-                audio_pipeline_set_listener(pipeline_init_mode, evt);
-
-                ESP_LOGI(TAG, "[ 3.2 ] Turn the SHUTDOWN HIGH");
-                gpio_set_level(SHUTDOWN_GPIO, HIGH_LVL);
-
-                ESP_LOGI(TAG, "[ 4 ] Start audio_pipeline");
-                audio_pipeline_run(pipeline_init_mode);
-
-                ESP_LOGI(TAG, "[ 5 ] Listen for all pipeline events");
-                while (1) {
-                    audio_event_iface_msg_t msg = { 0 };
-                    esp_err_t ret = audio_event_iface_listen(evt, &msg, portMAX_DELAY);
-                    if (ret != ESP_OK) {
-                        ESP_LOGE(TAG, "[ * ] Event interface error : %d", ret);
-                        continue;
-                    }
-
-                    if (msg.source_type == AUDIO_ELEMENT_TYPE_ELEMENT && msg.source == (void *) mp3_decoder
-                        && msg.cmd == AEL_MSG_CMD_REPORT_MUSIC_INFO) {
-                        audio_element_info_t music_info = {0};
-                        audio_element_getinfo(mp3_decoder, &music_info);
-
-                        ESP_LOGI(TAG, "[ * ] Receive music info from mp3 decoder, sample_rates=%d, bits=%d, ch=%d",
-                                music_info.sample_rates, music_info.bits, music_info.channels);
-
-                        audio_element_setinfo(i2s_stream_writer, &music_info);
-                        i2s_stream_set_clk(i2s_stream_writer, music_info.sample_rates, music_info.bits, music_info.channels);
-                        continue;
-                    }
-
-                    /* Stop when the last pipeline element (i2s_stream_writer in this case) receives stop event */
-                    if (msg.source_type == AUDIO_ELEMENT_TYPE_ELEMENT && msg.source == (void *) i2s_stream_writer
-                        && msg.cmd == AEL_MSG_CMD_REPORT_STATUS
-                        && (((int)msg.data == AEL_STATUS_STATE_STOPPED) || ((int)msg.data == AEL_STATUS_STATE_FINISHED))) {
-                        ESP_LOGW(TAG, "[ * ] Stop event received");
-                        break;
-                    }
-                }
-
-                ESP_LOGI(TAG, "[ 6 ] Turn the SHUTDOWN LOW");
-                gpio_set_level(SHUTDOWN_GPIO, LOW_LVL);
-
-                ESP_LOGI(TAG, "[ 7 ] Stop audio_pipeline");
-                audio_pipeline_stop(pipeline_init_mode);
-                audio_pipeline_wait_for_stop(pipeline_init_mode);
-                audio_pipeline_terminate(pipeline_init_mode);
-
-                audio_pipeline_unregister(pipeline_init_mode, tone_stream_reader);
-                audio_pipeline_unregister(pipeline_init_mode, i2s_stream_writer);
-                audio_pipeline_unregister(pipeline_init_mode, mp3_decoder);
-
-                /* Terminal the pipeline before removing the listener */
-                audio_pipeline_remove_listener(pipeline_init_mode);
-
-                /* Make sure audio_pipeline_remove_listener & audio_event_iface_remove_listener are called before destroying event_iface */
-                audio_event_iface_destroy(evt);
-
-                /* Release all resources */
-                audio_pipeline_deinit(pipeline_init_mode);
-                audio_element_deinit(tone_stream_reader);
-                audio_element_deinit(i2s_stream_writer);
-                audio_element_deinit(mp3_decoder);
-                mode = BT_MODE;
+                play_mode_tone(evt, TONE_TYPE_BT_MODE);
+                speaker_control_event(&control, SPEAKER_EVENT_READY);
                 break;
             }
             case BT_MODE: {
@@ -763,120 +761,41 @@ void app_main(void)
                 ESP_LOGI(TAG, "[ 1.2 ] Initialize and start peripherals");
                 audio_board_key_init(set);
 
-                ESP_LOGI(TAG, "[ 2.0 ] Create audio pipeline for playback");
-                audio_pipeline_cfg_t pipeline_cfg = DEFAULT_AUDIO_PIPELINE_CONFIG();
-                pipeline_bt = audio_pipeline_init(&pipeline_cfg);
-
-                ESP_LOGI(TAG, "[ 2.2 ] Create ALC");
-                alc_volume_setup_cfg_t alc_cfg = DEFAULT_ALC_VOLUME_SETUP_CONFIG();
-                alc_el = alc_volume_setup_init(&alc_cfg);
-
-                ESP_LOGI(TAG, "[ 2.1 ] Create equalizer");
-                equalizer_cfg_t eq_cfg = DEFAULT_EQUALIZER_CONFIG();
-                /*                  31   62  125 250  500  1k   2k   4k   8k  16k  31   62  125 250  500  1k   2k   4k   8k  16k  [Hz]                   */
-                int set_gain[] = { 8, 8, 8, 8, 10, 4, -12, -4, 1, 4, 8, 8, 8, 8, 10, 4, -12, -4, 1, 4 };
-                eq_cfg.set_gain =
-                    set_gain; // The size of gain array should be the multiplication of NUMBER_BAND and number channels of audio stream data. The minimum of gain is -10 dB.
-                equalizer = equalizer_init(&eq_cfg);
-
-                ESP_LOGI(TAG, "[ 2.2 ] Create i2s stream to write data to codec chip");
-                i2s_stream_cfg_t i2s_cfg = I2S_STREAM_CFG_DEFAULT();
-                i2s_cfg.type = AUDIO_STREAM_WRITER;
-                i2s_stream_writer = i2s_stream_init(&i2s_cfg);
-
-                ESP_LOGI(TAG, "[ 2.3 ] Get Bluetooth stream");
-                bt_stream_reader = bluetooth_service_create_stream();
+                ESP_LOGI(TAG, "[ 2.0 ] Get Bluetooth stream and attach it to the playback pipeline");
+                audio_element_handle_t bt_stream_reader = bluetooth_service_create_stream();
+                player_pipeline_attach_bt(player, bt_stream_reader);
 
-                ESP_LOGI(TAG, "[ 3.0 ] Register all elements to audio pipeline");
-                audio_pipeline_register(pipeline_bt, bt_stream_reader, "bt");
-                audio_pipeline_register(pipeline_bt, equalizer, "equalizer");
-                audio_pipeline_register(pipeline_bt, alc_el, "alc");
-                audio_pipeline_register(pipeline_bt, i2s_stream_writer, "i2s");
+                ESP_LOGI(TAG, "[ 2.1 ] Link [Bluetooth]-->bt_stream_reader-->dsp-->output_stage-->i2s_stream-->[codec_chip]");
+                player_pipeline_switch(player, PLAYER_SOURCE_BT, NULL);
 
-                ESP_LOGI(TAG, "[ 3.1 ] Link it together [Bluetooth]-->bt_stream_reader-->i2s_stream_writer-->[codec_chip]");
-                const char *link_tag[4] = {"bt", "equalizer", "alc", "i2s"};
-                audio_pipeline_link(pipeline_bt, &link_tag[0], 4);
+                ESP_LOGI(TAG, "[ 3.0 ] Create Bluetooth peripheral");
+                bt_periph = bluetooth_service_create_periph();
 
-                ESP_LOGI(TAG, "[ 4.0 ] Create Bluetooth peripheral");
-                esp_periph_handle_t bt_periph = bluetooth_service_create_periph();
-
-                ESP_LOGI(TAG, "[ 4.1 ] Start all peripherals");
+                ESP_LOGI(TAG, "[ 3.1 ] Start all peripherals");
                 esp_periph_start(set, bt_periph);
 
-                ESP_LOGI(TAG, "[ 5.0 ] Set up  event listener");
-                audio_event_iface_cfg_t evt_cfg = AUDIO_EVENT_IFACE_DEFAULT_CFG();
-                audio_event_iface_handle_t evt = audio_event_iface_init(&evt_cfg);
-
-                ESP_LOGI(TAG, "[ 5.1 ] Listening event from all elements of pipeline");
-                audio_pipeline_set_listener(pipeline_bt, evt);
-
-                ESP_LOGI(TAG, "[ 5.2 ] Listening event from peripherals");
+                ESP_LOGI(TAG, "[ 4.0 ] Listening event from peripherals");
                 audio_event_iface_set_listener(esp_periph_set_get_event_iface(set), evt);
 
-                ESP_LOGI(TAG, "[ 6 ] Start audio_pipeline");
-                audio_pipeline_run(pipeline_bt);
+                ESP_LOGI(TAG, "[ 5 ] Start audio_pipeline");
+                player_pipeline_run(player);
+                log_mode_ready();
+                mem_policy_log("Bluetooth start");
 
-                ESP_LOGI(TAG, "[ 7 ] Listen for all pipeline events");
-                while (mode == BT_MODE) {
+                ESP_LOGI(TAG, "[ 6 ] Listen for all pipeline events");
+                input_router_set_mode(router, BT_MODE);
+                while (control.mode == BT_MODE) {
                     audio_event_iface_msg_t msg;
-                    esp_err_t ret = audio_event_iface_listen(evt, &msg, portMAX_DELAY);
-                    if (ret != ESP_OK) {
-                        ESP_LOGE(TAG, "[ * ] Event interface error : %d", ret);
+                    if (input_router_listen(router, evt, &msg) != ESP_OK) {
                         continue;
                     }
 
                     if (msg.source_type == AUDIO_ELEMENT_TYPE_ELEMENT && msg.source == (void *) bt_stream_reader
                         && msg.cmd == AEL_MSG_CMD_REPORT_MUSIC_INFO) {
-                        audio_element_info_t music_info = {0};
-                        audio_element_getinfo(bt_stream_reader, &music_info);
-
-                        ESP_LOGI(TAG, "[ * ] Receive music info from Bluetooth, sample_rates=%d, bits=%d, ch=%d",
-                                music_info.sample_rates, music_info.bits, music_info.channels);
-
-                        if (equalizer_set_info(equalizer, music_info.sample_rates, music_info.channels) != ESP_OK) {
-                            break;
-                        }
-                        
-                        audio_element_setinfo(i2s_stream_writer, &music_info);
-
-                        alc_volume_setup_set_channel(alc_el, music_info.channels);
-                        alc_volume_setup_set_volume(alc_el, ALC_VOLUME_SET);
-
-                        i2s_stream_set_clk(i2s_stream_writer, music_info.sample_rates, music_info.bits, music_info.channels);
+                        player_pipeline_apply_music_info(player, bt_stream_reader);
                         continue;
                     }
 
-                    if ((msg.source_type == PERIPH_ID_TOUCH || msg.source_type == PERIPH_ID_BUTTON || msg.source_type == PERIPH_ID_ADC_BTN)
-                        && (msg.cmd == PERIPH_TOUCH_TAP || msg.cmd == PERIPH_BUTTON_PRESSED || msg.cmd == PERIPH_ADC_BUTTON_PRESSED)) {
-                        if ((int) msg.data == get_input_mode_id()) {
-                            ESP_LOGI(TAG, "[ * ] [Mode] touch tap event");
-                            periph_bluetooth_stop(bt_periph);
-                            gpio_set_level(SHUTDOWN_GPIO, LOW_LVL);
-                            mode = WIFI_MODE_INIT;
-                        } else if ((int) msg.data == get_input_play_id()) {
-                            ESP_LOGI(TAG, "[ * ] [Play] touch tap event");
-                            periph_bluetooth_play_pause(bt_periph);
-                        } else if ((int) msg.data == get_input_rec_id()) {
-                            ESP_LOGI(TAG, "[ * ] [Rec] touch tap event");
-                            periph_bluetooth_prev(bt_periph);
-                        } else if ((int) msg.data == get_input_set_id()) {
-                            ESP_LOGI(TAG, "[ * ] [Set] touch tap event");
-                            periph_bluetooth_next(bt_periph);
-                        } else if ((int) msg.data == get_input_volup_id()) {
-                            ESP_LOGI(TAG, "[ * ] [Vol+] touch tap event");
-                            periph_bluetooth_volume_up(bt_periph);
-                            audio_hal_get_volume(board_handle->audio_hal, &player_volume);
-                            adapt_equalizer(player_volume);
-                            ESP_LOGI(TAG, "[ * ] Volume set to %d %%", player_volume);
-                        } else if ((int) msg.data == get_input_voldown_id()) {
-                            ESP_LOGI(TAG, "[ * ] [Vol-] touch tap event");
-                            periph_bluetooth_volume_down(bt_periph);
-                            audio_hal_get_volume(board_handle->audio_hal, &player_volume);
-                            adapt_equalizer(player_volume);
-                            ESP_LOGI(TAG, "[ * ] Volume set to %d %%", player_volume);
-                        }
-                    }
-
                     /* Stop when the Bluetooth is disconnected or suspended */
                     if (msg.source_type == PERIPH_ID_BLUETOOTH
                         && msg.source == (void *)bt_periph) {
@@ -885,8 +804,8 @@ void app_main(void)
                             break;
                         }
                     }
-                    /* Stop when the last pipeline element (i2s_stream_writer in this case) receives stop event */
-                    if (msg.source_type == AUDIO_ELEMENT_TYPE_ELEMENT && msg.source == (void *) i2s_stream_writer
+                    /* Stop when the last pipeline element (player->sink) receives stop event */
+                    if (msg.source_type == AUDIO_ELEMENT_TYPE_ELEMENT && msg.source == (void *) player->sink
                         && msg.cmd == AEL_MSG_CMD_REPORT_STATUS
                         && (((int)msg.data == AEL_STATUS_STATE_STOPPED) || ((int)msg.data == AEL_STATUS_STATE_FINISHED))) {
                         ESP_LOGW(TAG, "[ * ] Stop event received");
@@ -894,155 +813,40 @@ void app_main(void)
                     }
                 }
 
-                ESP_LOGI(TAG, "[ 8 ] Stop audio_pipeline");
-                audio_pipeline_stop(pipeline_bt);
-                audio_pipeline_wait_for_stop(pipeline_bt);
-                audio_pipeline_terminate(pipeline_bt);
-
-                audio_pipeline_unregister(pipeline_bt, bt_stream_reader);
-                audio_pipeline_unregister(pipeline_bt, alc_el);
-                audio_pipeline_unregister(pipeline_bt, equalizer);
-                audio_pipeline_unregister(pipeline_bt, i2s_stream_writer);
-
-                /* Terminate the pipeline before removing the listener */
-                audio_pipeline_remove_listener(pipeline_bt);
+                ESP_LOGI(TAG, "[ 7 ] Stop audio_pipeline and detach the Bluetooth stream");
+                player_pipeline_stop(player);
+                speaker_dsp_drift_stats_t drift_stats;
+                speaker_dsp_get_drift_stats(player->dsp, &drift_stats);
+                if (drift_stats.active) {
+                    ESP_LOGI(TAG, "[ * ] Bluetooth clock %+.1f ppm against ours, held at %.0f of %d ms, %u slips",
+                             drift_stats.drift_ppm, drift_stats.depth_ms, drift_stats.target_ms, drift_stats.slips);
+                }
+#if CONFIG_SPEAKER_TELEMETRY
+                telemetry_log_stacks(telemetry);
+#endif
+                player_pipeline_attach_bt(player, NULL);
 
                 /* Stop all peripherals before removing the listener */
                 esp_periph_set_stop_all(set);
                 audio_event_iface_remove_listener(esp_periph_set_get_event_iface(set), evt);
 
-                /* Make sure audio_pipeline_remove_listener & audio_event_iface_remove_listener are called before destroying event_iface */
-                audio_event_iface_destroy(evt);
-
-                /* Release all resources */
-                audio_pipeline_deinit(pipeline_bt);
+                /* Release the Bluetooth resources, the output chain stays alive */
                 audio_element_deinit(bt_stream_reader);
-                audio_element_deinit(alc_el);
-                audio_element_deinit(equalizer);
-                audio_element_deinit(i2s_stream_writer);
                 esp_periph_set_destroy(set);
-                bluetooth_service_destroy();
+                bt_release();
                 ESP_LOGW(TAG, "[ * ] Bluetooth destroyed");
                 break;
             }
             case WIFI_MODE_INIT: {
                 ESP_LOGI(TAG, "WIFI MODE INIT");
-
-                ESP_LOGI(TAG, "[ 0.0 ] Setup the volume");
-                player_volume = INIT_VOLUME;
-                audio_hal_set_volume(board_handle->audio_hal, player_volume);
-                ESP_LOGI(TAG, "[ * ] Volume set to %d %%", player_volume);
-
-                ESP_LOGI(TAG, "[ 1.0 ] Create audio pipeline for playback");
-                audio_pipeline_cfg_t pipeline_cfg = DEFAULT_AUDIO_PIPELINE_CONFIG();
-                pipeline_init_mode = audio_pipeline_init(&pipeline_cfg);
-                AUDIO_NULL_CHECK(TAG, pipeline_init_mode, return);
-
-                ESP_LOGI(TAG, "[ 1.1 ] Create tone stream to read data from flash");
-                tone_stream_cfg_t tone_cfg = TONE_STREAM_CFG_DEFAULT();
-                tone_cfg.type = AUDIO_STREAM_READER;
-                tone_stream_reader = tone_stream_init(&tone_cfg);
-                AUDIO_NULL_CHECK(TAG, tone_stream_reader, return);
-
-                ESP_LOGI(TAG, "[ 1.2 ] Create i2s stream to write data to codec chip");
-                i2s_stream_cfg_t i2s_cfg = I2S_STREAM_CFG_DEFAULT();
-                i2s_cfg.type = AUDIO_STREAM_WRITER;
-                i2s_stream_writer = i2s_stream_init(&i2s_cfg);
-                AUDIO_NULL_CHECK(TAG, i2s_stream_writer, return);
-
-                ESP_LOGI(TAG, "[ 1.3 ] Create mp3 decoder to decode mp3 file");
-                mp3_decoder_cfg_t mp3_cfg = DEFAULT_MP3_DECODER_CONFIG();
-                mp3_decoder = mp3_decoder_init(&mp3_cfg);
-                AUDIO_NULL_CHECK(TAG, mp3_decoder, return);
-
-                ESP_LOGI(TAG, "[ 2.0 ] Register all elements to audio pipeline");
-                audio_pipeline_register(pipeline_init_mode, tone_stream_reader, "tone");
-                audio_pipeline_register(pipeline_init_mode, mp3_decoder, "mp3");
-                audio_pipeline_register(pipeline_init_mode, i2s_stream_writer, "i2s");
-
-                ESP_LOGI(TAG, "[ 2.1 ] Link it together [flash]-->tone_stream-->mp3_decoder-->i2s_stream-->[codec_chip]");
-                const char *link_tag[3] = {"tone", "mp3", "i2s"};
-                audio_pipeline_link(pipeline_init_mode, &link_tag[0], 3);
-
-                ESP_LOGI(TAG, "[ 2.2 ] Set up  uri (file as tone_stream, mp3 as mp3 decoder, and default output is i2s)");
-                audio_element_set_uri(tone_stream_reader, tone_uri[TONE_TYPE_WIFI_MODE]);
-
-                ESP_LOGI(TAG, "[ 3.0 ] Set up event listener");
-                audio_event_iface_cfg_t evt_cfg = AUDIO_EVENT_IFACE_DEFAULT_CFG();
-                audio_event_iface_handle_t evt = audio_event_iface_init(&evt_cfg);
-
-                ESP_LOGI(TAG, "[ 3.1 ] Listening event from all elements of pipeline");
-                audio_pipeline_set_listener(pipeline_init_mode, evt);
-
-                ESP_LOGI(TAG, "[ 3.2 ] Turn the SHUTDOWN HIGH");
-                gpio_set_level(SHUTDOWN_GPIO, HIGH_LVL);
-
-                ESP_LOGI(TAG, "[ 4 ] Start audio_pipeline");
-                audio_pipeline_run(pipeline_init_mode);
-
-                ESP_LOGI(TAG, "[ 5 ] Listen for all pipeline events");
-                while (1) {
-                    audio_event_iface_msg_t msg = { 0 };
-                    esp_err_t ret = audio_event_iface_listen(evt, &msg, portMAX_DELAY);
-                    if (ret != ESP_OK) {
-                        ESP_LOGE(TAG, "[ * ] Event interface error : %d", ret);
-                        continue;
-                    }
-
-                    if (msg.source_type == AUDIO_ELEMENT_TYPE_ELEMENT && msg.source == (void *) mp3_decoder
-                        && msg.cmd == AEL_MSG_CMD_REPORT_MUSIC_INFO) {
-                        audio_element_info_t music_info = {0};
-                        audio_element_getinfo(mp3_decoder, &music_info);
-
-                        ESP_LOGI(TAG, "[ * ] Receive music info from mp3 decoder, sample_rates=%d, bits=%d, ch=%d",
-                                music_info.sample_rates, music_info.bits, music_info.channels);
-
-                        audio_element_setinfo(i2s_stream_writer, &music_info);
-                        i2s_stream_set_clk(i2s_stream_writer, music_info.sample_rates, music_info.bits, music_info.channels);
-                        continue;
-                    }
-
-                    /* Stop when the last pipeline element (i2s_stream_writer in this case) receives stop event */
-                    if (msg.source_type == AUDIO_ELEMENT_TYPE_ELEMENT && msg.source == (void *) i2s_stream_writer
-                        && msg.cmd == AEL_MSG_CMD_REPORT_STATUS
-                        && (((int)msg.data == AEL_STATUS_STATE_STOPPED) || ((int)msg.data == AEL_STATUS_STATE_FINISHED))) {
-                        ESP_LOGW(TAG, "[ * ] Stop event received");
-                        break;
-                    }
-                }
-
-                ESP_LOGI(TAG, "[ 6 ] Turn the SHUTDOWN LOW");
-                gpio_set_level(SHUTDOWN_GPIO, LOW_LVL);
-
-                ESP_LOGI(TAG, "[ 7 ] Stop audio_pipeline");
-                audio_pipeline_stop(pipeline_init_mode);
-                audio_pipeline_wait_for_stop(pipeline_init_mode);
-                audio_pipeline_terminate(pipeline_init_mode);
-
-                audio_pipeline_unregister(pipeline_init_mode, tone_stream_reader);
-                audio_pipeline_unregister(pipeline_init_mode, i2s_stream_writer);
-                audio_pipeline_unregister(pipeline_init_mode, mp3_decoder);
-
-                /* Terminal the pipeline before removing the listener */
-                audio_pipeline_remove_listener(pipeline_init_mode);
-
-                /* Make sure audio_pipeline_remove_listener & audio_event_iface_remove_listener are called before destroying event_iface */
-                audio_event_iface_destroy(evt);
-
-                /* Release all resources */
-                audio_pipeline_deinit(pipeline_init_mode);
-                audio_element_deinit(tone_stream_reader);
-                audio_element_deinit(i2s_stream_writer);
-                audio_element_deinit(mp3_decoder);
-                mode = WIFI_MODE;
+                /* The association runs while the mode tone plays */
+                wifi_link_start(CONFIG_WIFI_SSID, CONFIG_WIFI_PASSWORD);
+                play_mode_tone(evt, TONE_TYPE_WIFI_MODE);
+                speaker_control_event(&control, SPEAKER_EVENT_READY);
                 break;
             }
             case WIFI_MODE: {
                 ESP_LOGI(TAG, "WIFI MODE");
-                ESP_LOGI(TAG, "[ 0.0 ] Initialize variables");
-                static uint8_t radio_stations_count = (sizeof(radio_stations)/sizeof(char*));
-                static uint8_t radio_station_index = 0;
-
                 ESP_LOGI(TAG, "[ 1.0 ] Initialize peripherals management");
                 esp_periph_config_t periph_cfg = DEFAULT_ESP_PERIPH_SET_CONFIG();
                 esp_periph_set_handle_t set = esp_periph_set_init(&periph_cfg);
@@ -1050,280 +854,78 @@ void app_main(void)
                 ESP_LOGI(TAG, "[ 1.1 ] Initialize and start peripherals");
                 audio_board_key_init(set);
 
-                ESP_LOGI(TAG, "[ 1.2 ] Start and wait for Wi-Fi network");
-                periph_wifi_cfg_t wifi_cfg = {
-                    .ssid = CONFIG_WIFI_SSID,
-                    .password = CONFIG_WIFI_PASSWORD,
-                };
+                ESP_LOGI(TAG, "[ 1.2 ] Wait for Wi-Fi network");
+                wifi_link_wait_connected(portMAX_DELAY);
 
-                ESP_LOGI(TAG, "[ 1.3 ] Init periph");
-                esp_periph_handle_t wifi_handle = periph_wifi_init(&wifi_cfg);
-                esp_periph_start(set, wifi_handle);
-                periph_wifi_wait_for_connected(wifi_handle, portMAX_DELAY);
-                
-                ESP_LOGI(TAG, "[ 2.0 ] Create audio pipeline for playback");
-                audio_pipeline_cfg_t pipeline_cfg = DEFAULT_AUDIO_PIPELINE_CONFIG();
-                pipeline_http = audio_pipeline_init(&pipeline_cfg);
-                mem_assert(pipeline_http);
-
-                ESP_LOGI(TAG, "[ 2.1 ] Create http stream to read data");
-                http_stream_cfg_t http_cfg = HTTP_STREAM_CFG_DEFAULT();
-                http_stream_reader = http_stream_init(&http_cfg);
-
-                ESP_LOGI(TAG, "[ 2.2 ] Create equalizer");
-                equalizer_cfg_t eq_cfg = DEFAULT_EQUALIZER_CONFIG();
-                /*                  31   62  125 250  500  1k   2k   4k   8k  16k  31   62  125 250  500  1k   2k   4k   8k  16k  [Hz]                   */
-                int set_gain[] = { 8, 8, 8, 8, 10, 4, -12, -4, 1, 4, 8, 8, 8, 8, 10, 4, -12, -4, 1, 4 };
-                eq_cfg.set_gain =
-                    set_gain; // The size of gain array should be the multiplication of NUMBER_BAND and number channels of audio stream data. The minimum of gain is -10 dB.
-                equalizer = equalizer_init(&eq_cfg);
-
-                ESP_LOGI(TAG, "[ 2.3 ] Create i2s stream to write data to codec chip");
-                i2s_stream_cfg_t i2s_cfg = I2S_STREAM_CFG_DEFAULT();
-                i2s_cfg.type = AUDIO_STREAM_WRITER;
-                i2s_stream_writer = i2s_stream_init(&i2s_cfg);
-
-                ESP_LOGI(TAG, "[ 2.4 ] Create mp3 decoder to decode mp3 file");
-                mp3_decoder_cfg_t mp3_cfg = DEFAULT_MP3_DECODER_CONFIG();
-                mp3_decoder = mp3_decoder_init(&mp3_cfg);
-
-                //ESP_LOGI(TAG, "[ 2.5 ] Create ALC");
-                //alc_volume_setup_cfg_t alc_cfg = DEFAULT_ALC_VOLUME_SETUP_CONFIG();
-                //alc_el = alc_volume_setup_init(&alc_cfg);
-
-                ESP_LOGI(TAG, "[ 3.0 ] Register all elements to audio pipeline");
-                audio_pipeline_register(pipeline_http, http_stream_reader, "http");
-                audio_pipeline_register(pipeline_http, mp3_decoder, "mp3");
-                audio_pipeline_register(pipeline_http, equalizer, "equalizer");
-                //audio_pipeline_register(pipeline_http, alc_el, "alc");
-                audio_pipeline_register(pipeline_http, i2s_stream_writer, "i2s");
-
-                ESP_LOGI(TAG, "[ 3.1 ] Link it together http_stream-->mp3_decoder-->i2s_stream-->[codec_chip]");
-                const char *link_tag[4] = {"http", "mp3", "equalizer", "i2s"};
-                audio_pipeline_link(pipeline_http, &link_tag[0], 4);
-
-                ESP_LOGI(TAG, "[ 3.2 ] Set up  uri (http as http_stream, mp3 as mp3 decoder, and default output is i2s)");
-                audio_element_set_uri(http_stream_reader, radio_stations[radio_station_index]);
-                ESP_LOGI(TAG, "Station: %s and index position is: %d", radio_stations[radio_station_index], radio_station_index);
-                
-                ESP_LOGI(TAG, "[ 4.0 ] Set up  event listener");
-                audio_event_iface_cfg_t evt_cfg = AUDIO_EVENT_IFACE_DEFAULT_CFG();
-                audio_event_iface_handle_t evt = audio_event_iface_init(&evt_cfg);
-
-                ESP_LOGI(TAG, "[ 4.1 ] Listening event from all elements of pipeline");
-                audio_pipeline_set_listener(pipeline_http, evt);
-
-                ESP_LOGI(TAG, "[ 4.2 ] Listening event from peripherals");
+                ESP_LOGI(TAG, "[ 2.0 ] Link radio_reader-->mp3_decoder-->dsp-->output_stage-->i2s_stream-->[codec_chip]");
+                player_pipeline_set_stations(player, station_list_urls(stations), station_list_count(stations));
+                player_pipeline_switch(player, PLAYER_SOURCE_HTTP, station_list_url(stations, control.station));
+                ESP_LOGI(TAG, "Station: %s %s and index position is: %d", station_list_url(stations, control.station),
+                         station_list_name(stations, control.station), control.station);
+                esp_event_handler_register(PLAYER_EVENT, PLAYER_EVENT_TITLE, on_stream_title, NULL);
+
+                ESP_LOGI(TAG, "[ 3.0 ] Listening event from peripherals");
                 audio_event_iface_set_listener(esp_periph_set_get_event_iface(set), evt);
 
-                ESP_LOGI(TAG, "[ 4.3 ] Turn the SHUTDOWN HIGH");
-                if (player_volume == 0) {
-                    gpio_set_level(SHUTDOWN_GPIO, LOW_LVL);
-                } else {
-                    gpio_set_level(SHUTDOWN_GPIO, HIGH_LVL);
-                }
+                ESP_LOGI(TAG, "[ 3.1 ] Unmute, the amplifier follows the programme");
+                speaker_control_unmute(&control);
 
-                ESP_LOGI(TAG, "[ 5 ] Start audio_pipeline");
-                audio_pipeline_run(pipeline_http);
+                ESP_LOGI(TAG, "[ 4 ] Start audio_pipeline");
+                player_pipeline_run(player);
+                log_mode_ready();
+                mem_policy_log("Wi-Fi start");
 
-                while (mode == WIFI_MODE) {
+                input_router_set_mode(router, WIFI_MODE);
+                while (control.mode == WIFI_MODE) {
                     audio_event_iface_msg_t msg;
-                    esp_err_t ret = audio_event_iface_listen(evt, &msg, portMAX_DELAY);
-                    if (ret != ESP_OK) {
-                        ESP_LOGE(TAG, "[ * ] Event interface error : %d", ret);
+                    if (input_router_listen(router, evt, &msg) != ESP_OK) {
+                        continue;
+                    }
+                    if (player_pipeline_crossfade_event(player, &msg)) {
                         continue;
                     }
 
+                    /* The decoder of the incoming deck while a station change fades */
+                    audio_element_handle_t info_src = player_pipeline_info_source(player);
                     if (msg.source_type == AUDIO_ELEMENT_TYPE_ELEMENT
-                        && msg.source == (void *) mp3_decoder
+                        && msg.source == (void *) info_src
                         && msg.cmd == AEL_MSG_CMD_REPORT_MUSIC_INFO) {
-                        audio_element_info_t music_info = {0};
-                        audio_element_getinfo(mp3_decoder, &music_info);
+                        player_pipeline_apply_music_info(player, info_src);
 
-                        ESP_LOGI(TAG, "[ * ] Receive music info from mp3 decoder, sample_rates=%d, bits=%d, ch=%d",
-                                music_info.sample_rates, music_info.bits, music_info.channels);
-                        if (equalizer_set_info(equalizer, music_info.sample_rates, music_info.channels) != ESP_OK) {
-                            break;
-                        }
-                        audio_element_setinfo(i2s_stream_writer, &music_info);
-                        i2s_stream_set_clk(i2s_stream_writer, music_info.sample_rates, music_info.bits, music_info.channels);
-
-                        //alc_volume_setup_set_channel(alc_el, music_info.channels);
-                        //alc_volume_setup_set_volume(alc_el, ALC_VOLUME_SET);
-
-                        if (player_volume == 0) {
-                            gpio_set_level(SHUTDOWN_GPIO, LOW_LVL);
-                        } else {
-                            gpio_set_level(SHUTDOWN_GPIO, HIGH_LVL);
-                        }
+                        speaker_control_unmute(&control);
                         continue;
                     }
 
-                    if ((msg.source_type == PERIPH_ID_TOUCH || msg.source_type == PERIPH_ID_BUTTON || msg.source_type == PERIPH_ID_ADC_BTN)
-                        && (msg.cmd == PERIPH_TOUCH_TAP || msg.cmd == PERIPH_BUTTON_PRESSED || msg.cmd == PERIPH_ADC_BUTTON_PRESSED)) {
-
-                        if ((int) msg.data == get_input_mode_id()) {
-                            ESP_LOGI(TAG, "[ * ] [Mode] touch tap event");
-                            gpio_set_level(SHUTDOWN_GPIO, LOW_LVL);
-                            mode = RESTART_MODE;
-                        } else if ((int) msg.data == get_input_play_id()) {
-                            ESP_LOGI(TAG, "[ * ] [Play] touch tap event");
-                            audio_element_state_t el_state = audio_element_get_state(i2s_stream_writer);
-                            switch (el_state) {
-                                case AEL_STATE_INIT :
-                                    ESP_LOGI(TAG, "[ * ] Starting audio pipeline");
-                                    audio_element_reset_state(mp3_decoder);
-                                    audio_element_reset_state(i2s_stream_writer);
-                                    audio_pipeline_reset_ringbuffer(pipeline_http);
-                                    if (player_volume == 0) {
-                                        gpio_set_level(SHUTDOWN_GPIO, LOW_LVL);
-                                    } else {
-                                        gpio_set_level(SHUTDOWN_GPIO, HIGH_LVL);
-                                    }
-                                    audio_pipeline_run(pipeline_http);
-                                    break;
-                                case AEL_STATE_RUNNING :
-                                    ESP_LOGI(TAG, "[ * ] Pausing audio pipeline");
-                                    gpio_set_level(SHUTDOWN_GPIO, LOW_LVL);
-                                    audio_pipeline_pause(pipeline_http);
-                                    break;
-                                case AEL_STATE_PAUSED :
-                                    ESP_LOGI(TAG, "[ * ] Resuming audio pipeline");
-                                    if (player_volume == 0) {
-                                        gpio_set_level(SHUTDOWN_GPIO, LOW_LVL);
-                                    } else {
-                                        gpio_set_level(SHUTDOWN_GPIO, HIGH_LVL);
-                                    }
-                                    audio_pipeline_resume(pipeline_http);
-                                    break;
-                                default :
-                                    ESP_LOGI(TAG, "[ * ] Not supported state %d", el_state);
-                            }
-                        } else if ((int) msg.data == get_input_rec_id()) {
-                            ESP_LOGI(TAG, "[ * ] [Rec] touch tap event");
-                            gpio_set_level(SHUTDOWN_GPIO, LOW_LVL);
-                            audio_pipeline_stop(pipeline_http);
-                            audio_pipeline_wait_for_stop(pipeline_http);
-                            audio_element_reset_state(mp3_decoder);
-                            audio_element_reset_state(equalizer);
-                            //audio_element_reset_state(alc_el);
-                            audio_element_reset_state(i2s_stream_writer);
-                            audio_pipeline_reset_ringbuffer(pipeline_http);
-                            audio_pipeline_reset_items_state(pipeline_http);
-                            if (radio_station_index > 0) {
-                                radio_station_index--;
-                                audio_element_set_uri(http_stream_reader, radio_stations[radio_station_index]);
-                                ESP_LOGI(TAG, "Station: %s and index position is: %d", radio_stations[radio_station_index], radio_station_index);
-                            } else if (radio_station_index == 0) {
-                                radio_station_index = radio_stations_count - 1;
-                                audio_element_set_uri(http_stream_reader, radio_stations[radio_station_index]);
-                                ESP_LOGI(TAG, "Station: %s and index position is: %d", radio_stations[radio_station_index], radio_station_index);
-                            }
-                            audio_pipeline_change_state(pipeline_http, AEL_STATE_INIT);
-                            audio_pipeline_run(pipeline_http);
-			                vTaskDelay(500 / portTICK_RATE_MS);
-                        } else if ((int) msg.data == get_input_set_id()) {
-                            ESP_LOGI(TAG, "[ * ] [Set] touch tap event");
-                            ESP_LOGI(TAG, "[ * ] [Rec] touch tap event");
-                            gpio_set_level(SHUTDOWN_GPIO, LOW_LVL);
-                            audio_pipeline_stop(pipeline_http);
-                            audio_pipeline_wait_for_stop(pipeline_http);
-                            audio_element_reset_state(mp3_decoder);
-                            audio_element_reset_state(equalizer);
-                            //audio_element_reset_state(alc_el);
-                            audio_element_reset_state(i2s_stream_writer);
-                            audio_pipeline_reset_ringbuffer(pipeline_http);
-                            audio_pipeline_reset_items_state(pipeline_http);
-                            if (radio_station_index < radio_stations_count && radio_station_index != (radio_stations_count - 1)) {
-                                radio_station_index++;
-                                audio_element_set_uri(http_stream_reader, radio_stations[radio_station_index]);
-                                ESP_LOGI(TAG, "Station: %s and index position is: %d", radio_stations[radio_station_index], radio_station_index);
-                            } else {
-                                radio_station_index = 0;
-                                audio_element_set_uri(http_stream_reader, radio_stations[radio_station_index]);
-                                ESP_LOGI(TAG, "Station: %s and index position is: %d", radio_stations[radio_station_index], radio_station_index);
-                            }
-                            audio_pipeline_change_state(pipeline_http, AEL_STATE_INIT);
-                            audio_pipeline_run(pipeline_http);
-			                vTaskDelay(500 / portTICK_RATE_MS);
-                        } else if ((int) msg.data == get_input_volup_id()) {
-                            ESP_LOGI(TAG, "[ * ] [Vol+] touch tap event");
-                            audio_element_state_t el_state = audio_element_get_state(i2s_stream_writer);
-                            if (el_state == AEL_STATE_PAUSED) {
-                                gpio_set_level(SHUTDOWN_GPIO, LOW_LVL);
-                            } else {
-                                gpio_set_level(SHUTDOWN_GPIO, HIGH_LVL);
-                            }
-                            if (player_volume == 0) {
-                                player_volume = VOL_BOTTOM_TRH;
-                            }
-                            if (player_volume <= VOL_TRH) {
-                                player_volume += VOL_INCREASE_LOW;
-                            } else {
-                                player_volume += VOL_INCREASE_UP;
-                            }
-                            if (player_volume >= VOL_UPPER_TRH) {
-                                player_volume = VOL_UPPER_TRH;
-                            }
-                            adapt_equalizer(player_volume);
-                            audio_hal_set_volume(board_handle->audio_hal, player_volume);
-                            ESP_LOGI(TAG, "[ * ] Volume set to %d %%", player_volume);
-                        } else if ((int) msg.data == get_input_voldown_id()) {
-                            ESP_LOGI(TAG, "[ * ] [Vol-] touch tap event");
-                            if (player_volume <= VOL_TRH) {
-                                player_volume -= VOL_DECREASE_LOW;
-                            } else {
-                                player_volume -= VOL_DECREASE_UP;
-                            }
-                            if (player_volume <= VOL_BOTTOM_TRH) {
-                                gpio_set_level(SHUTDOWN_GPIO, LOW_LVL);
-                                player_volume = 0;
-                            }
-                            adapt_equalizer(player_volume);
-                            audio_hal_set_volume(board_handle->audio_hal, player_volume);
-                            ESP_LOGI(TAG, "[ * ] Volume set to %d %%", player_volume);
-                        }
-                    }
-
-                    /* Stop when the last pipeline element (i2s_stream_writer in this case) receives stop event */
-                    // if (msg.source_type == AUDIO_ELEMENT_TYPE_ELEMENT && msg.source == (void *) i2s_stream_writer
-                    //     && msg.cmd == AEL_MSG_CMD_REPORT_STATUS
-                    //     && (((int)msg.data == AEL_STATUS_STATE_STOPPED) || ((int)msg.data == AEL_STATUS_STATE_FINISHED))) {
-                    //     ESP_LOGW(TAG, "[ * ] Stop event received");
-                    //     break;
-                    // }
+                    /* No stop event to wait for: a dropped station is reconnected by the radio reader */
                 }
 
-                ESP_LOGI(TAG, "[ 6 ] Stop audio_pipeline");
-                audio_pipeline_stop(pipeline_http);
-                audio_pipeline_wait_for_stop(pipeline_http);
-                audio_pipeline_terminate(pipeline_http);
-
-                /* Terminate the pipeline before removing the listener */
-                audio_pipeline_unregister(pipeline_http, http_stream_reader);
-                audio_pipeline_unregister(pipeline_http, i2s_stream_writer);
-                audio_pipeline_unregister(pipeline_http, equalizer);
-                //audio_pipeline_unregister(pipeline_http, alc_el);
-                audio_pipeline_unregister(pipeline_http, mp3_decoder);
-
-                audio_pipeline_remove_listener(pipeline_http);
+                ESP_LOGI(TAG, "[ 5 ] Stop audio_pipeline");
+                esp_event_handler_unregister(PLAYER_EVENT, PLAYER_EVENT_TITLE, on_stream_title);
+                player_pipeline_stop(player);
+
+                jitter_buffer_stats_t radio_stats;
+                radio_reader_get_stats(player->http_reader, &radio_stats);
+                ESP_LOGI(TAG, "[ * ] Radio: %u underruns, %u rebuffers, pre-roll %u ms, %u kbps in for %u kbps",
+                         radio_stats.underruns, radio_stats.rebuffers, radio_stats.target_ms,
+                         radio_stats.in_kbps, radio_stats.stream_kbps);
+                radio_link_stats_t link_stats;
+                radio_reader_get_link_stats(player->http_reader, &link_stats);
+                ESP_LOGI(TAG, "[ * ] Radio link: %u drops, %u reconnects after %u failed tries, %u ms without data (longest %u ms)",
+                         link_stats.drops, link_stats.reconnects, link_stats.retries, link_stats.outage_total_ms,
+                         link_stats.outage_max_ms);
+#if CONFIG_SPEAKER_TELEMETRY
+                telemetry_log_stacks(telemetry);
+#endif
 
                 /* Stop all peripherals before removing the listener */
                 audio_event_iface_remove_listener(esp_periph_set_get_event_iface(set), evt);
 
-                /* Make sure audio_pipeline_remove_listener & audio_event_iface_remove_listener are called before destroying event_iface */
-                audio_event_iface_destroy(evt);
-
-                /* Release all resources */
-                audio_pipeline_deinit(pipeline_http);
-                audio_element_deinit(http_stream_reader);
-                audio_element_deinit(equalizer);
-                //audio_element_deinit(alc_el);
-                audio_element_deinit(i2s_stream_writer);
-                audio_element_deinit(mp3_decoder);
-                if (mode != WIFI_MODE) {
+                if (control.mode != WIFI_MODE) {
                     esp_periph_set_stop_all(set);
                     esp_periph_set_destroy(set);
+                    /* Close the radio connections while the link is still up, then release the link itself */
+                    radio_reader_release(player->http_reader);
+                    wifi_link_stop();
                     ESP_LOGW(TAG, "[ * ] Wi-Fi destroyed");
                 }
                 break;
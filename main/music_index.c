@@ -0,0 +1,608 @@
+#include <stdio.h>
+#include <string.h>
+#include <stddef.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "ff.h"
+#include "audio_error.h"
+#include "audio_mem.h"
+#include "media_probe.h"
+#include "music_index.h"
+
+#define MUSIC_INDEX_MAGIC       "MIDX"
+#define MUSIC_INDEX_VERSION     (2)
+#define MUSIC_INDEX_TMP_FILE    MUSIC_INDEX_ROOT "/.music_index.tmp"
+#define MUSIC_INDEX_PROBE_LEN   (2048)
+#define MUSIC_INDEX_TASK_STACK  (4 * 1024)
+#define MUSIC_INDEX_TASK_PRIO   (2)
+#define MUSIC_INDEX_TASK_CORE   (0)
+
+#define FNV_OFFSET              (2166136261u)
+#define FNV_PRIME               (16777619u)
+
+static const char *TAG = "MUSIC_INDEX";
+
+typedef struct {
+    char        magic[4];
+    uint16_t    version;
+    uint16_t    track_size;     /* sizeof(music_track_t), an index from another layout is rebuilt */
+    uint32_t    track_num;
+    uint32_t    dir_num;
+    uint32_t    dir_offset;     /* The directory table follows the track records */
+    uint32_t    current;
+} music_index_header_t;
+
+typedef struct {
+    uint32_t    path_hash;
+    uint32_t    fingerprint;
+    uint32_t    first_track;
+    uint32_t    track_num;
+} music_index_dir_t;
+
+struct music_index {
+    mode_arena_handle_t     arena;
+    SemaphoreHandle_t       lock;
+    FILE                    *file;
+    music_index_header_t    hdr;
+    music_index_dir_t       *dirs;
+    music_track_t           scratch;        /* Record buffer of the playlist operations */
+    TaskHandle_t            refresh_task;
+    SemaphoreHandle_t       refresh_done;
+    volatile bool           abort;
+};
+
+typedef struct {
+    mode_arena_handle_t     arena;
+    music_index_handle_t    idx;            /* Index to reuse records from, NULL for a full scan */
+    FILE                    *out;           /* NULL only verifies the fingerprints */
+    music_index_dir_t       *dirs;
+    uint32_t                dir_num;
+    uint32_t                dir_cap;
+    uint32_t                track_num;
+    uint32_t                changed;
+    uint32_t                old_hint;
+    music_track_t           rec;
+    uint8_t                 probe[MUSIC_INDEX_PROBE_LEN];
+    char                    path[MUSIC_INDEX_PATH_LEN];
+    char                    fat_path[MUSIC_INDEX_PATH_LEN];
+} music_index_builder_t;
+
+static uint32_t fnv_hash(uint32_t hash, const void *data, size_t len)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    while (len--) {
+        hash = (hash ^ *p++) * FNV_PRIME;
+    }
+    return hash;
+}
+
+static uint32_t path_hash(const char *path, size_t len)
+{
+    return fnv_hash(FNV_OFFSET, path, len);
+}
+
+static bool index_skip_entry(const FILINFO *fno)
+{
+    /* Hidden and system entries, the index itself included */
+    return fno->fname[0] == '.' || (fno->fattrib & (AM_HID | AM_SYS));
+}
+
+static esp_err_t index_read_track(music_index_handle_t idx, uint32_t id, music_track_t *track)
+{
+    if (id >= idx->hdr.track_num) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    if (fseek(idx->file, sizeof(music_index_header_t) + id * sizeof(music_track_t), SEEK_SET) != 0
+        || fread(track, sizeof(music_track_t), 1, idx->file) != 1) {
+        ESP_LOGE(TAG, "Failed to read track %u", id);
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+static void index_save_current(music_index_handle_t idx)
+{
+    if (fseek(idx->file, offsetof(music_index_header_t, current), SEEK_SET) == 0
+        && fwrite(&idx->hdr.current, sizeof(idx->hdr.current), 1, idx->file) == 1) {
+        fflush(idx->file);
+        fsync(fileno(idx->file));
+    }
+}
+
+static void index_unload(music_index_handle_t idx)
+{
+    if (idx->file) {
+        fclose(idx->file);
+        idx->file = NULL;
+    }
+    mode_arena_free(idx->arena, idx->dirs);
+    idx->dirs = NULL;
+    memset(&idx->hdr, 0, sizeof(idx->hdr));
+}
+
+static esp_err_t index_load(music_index_handle_t idx)
+{
+    idx->file = fopen(MUSIC_INDEX_FILE, "rb+");
+    if (idx->file == NULL) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    music_index_header_t *hdr = &idx->hdr;
+    if (fread(hdr, sizeof(*hdr), 1, idx->file) != 1
+        || memcmp(hdr->magic, MUSIC_INDEX_MAGIC, 4) != 0
+        || hdr->version != MUSIC_INDEX_VERSION
+        || hdr->track_size != sizeof(music_track_t)) {
+        ESP_LOGW(TAG, "Index is missing or from another firmware");
+        index_unload(idx);
+        return ESP_ERR_INVALID_VERSION;
+    }
+    if (hdr->dir_num) {
+        idx->dirs = mode_arena_calloc(idx->arena, hdr->dir_num, sizeof(music_index_dir_t));
+        AUDIO_MEM_CHECK(TAG, idx->dirs, {index_unload(idx); return ESP_ERR_NO_MEM;});
+        if (fseek(idx->file, hdr->dir_offset, SEEK_SET) != 0
+            || fread(idx->dirs, sizeof(music_index_dir_t), hdr->dir_num, idx->file) != hdr->dir_num) {
+            index_unload(idx);
+            return ESP_FAIL;
+        }
+    }
+    if (hdr->current >= hdr->track_num) {
+        hdr->current = 0;
+    }
+    return ESP_OK;
+}
+
+static const music_index_dir_t *builder_find_old_dir(music_index_builder_t *b, uint32_t hash)
+{
+    if (b->idx == NULL || b->idx->dirs == NULL) {
+        return NULL;
+    }
+    /* Directories are walked in the same order every time, try the next one first */
+    uint32_t num = b->idx->hdr.dir_num;
+    for (uint32_t i = 0; i < num; i++) {
+        uint32_t n = (b->old_hint + i) % num;
+        if (b->idx->dirs[n].path_hash == hash) {
+            b->old_hint = n + 1;
+            return &b->idx->dirs[n];
+        }
+    }
+    return NULL;
+}
+
+static esp_err_t builder_add_dir(music_index_builder_t *b, const music_index_dir_t *dir)
+{
+    if (b->dir_num == b->dir_cap) {
+        uint32_t cap = b->dir_cap ? b->dir_cap * 2 : 16;
+        music_index_dir_t *dirs = mode_arena_realloc(b->arena, b->dirs, cap * sizeof(music_index_dir_t));
+        AUDIO_MEM_CHECK(TAG, dirs, return ESP_ERR_NO_MEM);
+        b->dirs = dirs;
+        b->dir_cap = cap;
+    }
+    b->dirs[b->dir_num++] = *dir;
+    return ESP_OK;
+}
+
+/* Probe every music file of the open directory and append its record */
+static esp_err_t builder_scan_files(music_index_builder_t *b, FF_DIR *dir, FILINFO *fno)
+{
+    f_readdir(dir, NULL);
+    while (f_readdir(dir, fno) == FR_OK && fno->fname[0]) {
+        if (index_skip_entry(fno) || (fno->fattrib & AM_DIR) || !media_probe_is_audio(fno->fname)) {
+            continue;
+        }
+        music_track_t *rec = &b->rec;
+        memset(rec, 0, sizeof(music_track_t));
+        if (snprintf(rec->path, sizeof(rec->path), "%s/%s", b->path, fno->fname) >= (int)sizeof(rec->path)) {
+            ESP_LOGW(TAG, "Path too long, skip %s", fno->fname);
+            continue;
+        }
+        int fd = open(rec->path, O_RDONLY);
+        if (fd < 0) {
+            continue;
+        }
+        int probed = media_probe(fd, fno->fname, fno->fsize, b->probe, sizeof(b->probe),
+                                 &rec->info, rec->title, sizeof(rec->title));
+        close(fd);
+        if (probed != 0 && rec->info.format != MEDIA_FORMAT_MP3) {
+            /* An unsupported WAV or FLAC variant, there is no chain that plays it */
+            ESP_LOGW(TAG, "Unsupported %s, skip %s", media_format_name(rec->info.format), rec->path);
+            continue;
+        }
+        if (probed != 0) {
+            ESP_LOGW(TAG, "No MPEG frame in %s", rec->path);
+        }
+        rec->duration_ms = mp3_info_duration_ms(&rec->info);
+        rec->bitrate = rec->info.bitrate;
+        if (fwrite(rec, sizeof(music_track_t), 1, b->out) != 1) {
+            return ESP_FAIL;
+        }
+        b->track_num++;
+    }
+    return ESP_OK;
+}
+
+/* Copy the records of an unchanged directory from the current index */
+static esp_err_t builder_copy_files(music_index_builder_t *b, const music_index_dir_t *old)
+{
+    for (uint32_t i = 0; i < old->track_num; i++) {
+        xSemaphoreTake(b->idx->lock, portMAX_DELAY);
+        esp_err_t ret = index_read_track(b->idx, old->first_track + i, &b->rec);
+        xSemaphoreGive(b->idx->lock);
+        if (ret != ESP_OK || fwrite(&b->rec, sizeof(music_track_t), 1, b->out) != 1) {
+            return ESP_FAIL;
+        }
+        b->track_num++;
+    }
+    return ESP_OK;
+}
+
+/*
+ * Walk the directory in b->path. In verify mode (no output file) it returns
+ * ESP_ERR_INVALID_STATE as soon as a fingerprint differs from the index.
+ */
+static esp_err_t builder_walk(music_index_builder_t *b, int depth, volatile bool *abort)
+{
+    if (*abort) {
+        return ESP_ERR_TIMEOUT;
+    }
+    FF_DIR *dir = mode_arena_calloc(b->arena, 1, sizeof(FF_DIR));
+    FILINFO *fno = mode_arena_calloc(b->arena, 1, sizeof(FILINFO));
+    esp_err_t ret = ESP_OK;
+    AUDIO_MEM_CHECK(TAG, dir && fno, {ret = ESP_ERR_NO_MEM; goto _walk_exit;});
+
+    snprintf(b->fat_path, sizeof(b->fat_path), MUSIC_INDEX_DRIVE "%s", b->path + strlen(MUSIC_INDEX_ROOT));
+    if (f_opendir(dir, b->fat_path) != FR_OK) {
+        ESP_LOGW(TAG, "Cannot open %s", b->path);
+        goto _walk_exit;
+    }
+
+    /* Fingerprint of the entries, a directory's own timestamp is not updated by FAT */
+    uint32_t fp = FNV_OFFSET;
+    while (f_readdir(dir, fno) == FR_OK && fno->fname[0]) {
+        if (index_skip_entry(fno)) {
+            continue;
+        }
+        uint32_t size = fno->fsize;
+        fp = fnv_hash(fp, fno->fname, strlen(fno->fname));
+        fp = fnv_hash(fp, &size, sizeof(size));
+        fp = fnv_hash(fp, &fno->fdate, sizeof(fno->fdate));
+        fp = fnv_hash(fp, &fno->ftime, sizeof(fno->ftime));
+        fp = fnv_hash(fp, &fno->fattrib, sizeof(fno->fattrib));
+    }
+    uint32_t hash = path_hash(b->path, strlen(b->path));
+    const music_index_dir_t *old = builder_find_old_dir(b, hash);
+    bool same = old && old->fingerprint == fp;
+
+    if (b->out == NULL) {
+        /* Verify: the directories must come in the same order with the same fingerprints */
+        if (!same || old != &b->idx->dirs[b->dir_num]) {
+            ret = ESP_ERR_INVALID_STATE;
+            goto _walk_close;
+        }
+        b->dir_num++;
+    } else {
+        music_index_dir_t rec = {
+            .path_hash = hash,
+            .fingerprint = fp,
+            .first_track = b->track_num,
+        };
+        if (same) {
+            ret = builder_copy_files(b, old);
+        } else {
+            b->changed++;
+            ret = builder_scan_files(b, dir, fno);
+        }
+        if (ret != ESP_OK) {
+            goto _walk_close;
+        }
+        rec.track_num = b->track_num - rec.first_track;
+        ret = builder_add_dir(b, &rec);
+        if (ret != ESP_OK) {
+            goto _walk_close;
+        }
+    }
+
+    if (depth < MUSIC_INDEX_MAX_DEPTH) {
+        size_t base = strlen(b->path);
+        f_readdir(dir, NULL);
+        while (ret == ESP_OK && f_readdir(dir, fno) == FR_OK && fno->fname[0]) {
+            if (index_skip_entry(fno) || !(fno->fattrib & AM_DIR)) {
+                continue;
+            }
+            if (base + 1 + strlen(fno->fname) >= sizeof(b->path)) {
+                continue;
+            }
+            snprintf(b->path + base, sizeof(b->path) - base, "/%s", fno->fname);
+            ret = builder_walk(b, depth + 1, abort);
+            b->path[base] = 0;
+        }
+    }
+
+_walk_close:
+    f_closedir(dir);
+_walk_exit:
+    mode_arena_free(b->arena, fno);
+    mode_arena_free(b->arena, dir);
+    return ret;
+}
+
+/* Write a new index next to the current one, reusing the records of unchanged directories */
+static esp_err_t builder_build(music_index_builder_t *b, volatile bool *abort)
+{
+    music_index_header_t hdr = { 0 };
+    memcpy(hdr.magic, MUSIC_INDEX_MAGIC, 4);
+    hdr.version = MUSIC_INDEX_VERSION;
+    hdr.track_size = sizeof(music_track_t);
+
+    b->out = fopen(MUSIC_INDEX_TMP_FILE, "wb");
+    if (b->out == NULL) {
+        ESP_LOGE(TAG, "Cannot create %s", MUSIC_INDEX_TMP_FILE);
+        return ESP_FAIL;
+    }
+    esp_err_t ret = ESP_FAIL;
+    if (fwrite(&hdr, sizeof(hdr), 1, b->out) != 1) {
+        goto _build_exit;
+    }
+    strcpy(b->path, MUSIC_INDEX_ROOT);
+    ret = builder_walk(b, 0, abort);
+    if (ret != ESP_OK) {
+        goto _build_exit;
+    }
+    hdr.track_num = b->track_num;
+    hdr.dir_num = b->dir_num;
+    hdr.dir_offset = sizeof(hdr) + b->track_num * sizeof(music_track_t);
+    if (fwrite(b->dirs, sizeof(music_index_dir_t), b->dir_num, b->out) != b->dir_num
+        || fseek(b->out, 0, SEEK_SET) != 0
+        || fwrite(&hdr, sizeof(hdr), 1, b->out) != 1) {
+        ret = ESP_FAIL;
+    }
+
+_build_exit:
+    if (fclose(b->out) != 0 && ret == ESP_OK) {
+        ret = ESP_FAIL;
+    }
+    b->out = NULL;
+    if (ret != ESP_OK) {
+        unlink(MUSIC_INDEX_TMP_FILE);
+    }
+    return ret;
+}
+
+/* Find a track by path after a rebuild, only the records of its directory are read */
+static uint32_t index_find(music_index_handle_t idx, const char *path)
+{
+    const char *slash = strrchr(path, '/');
+    if (slash == NULL) {
+        return 0;
+    }
+    uint32_t hash = path_hash(path, slash - path);
+    for (uint32_t d = 0; d < idx->hdr.dir_num; d++) {
+        if (idx->dirs[d].path_hash != hash) {
+            continue;
+        }
+        for (uint32_t i = 0; i < idx->dirs[d].track_num; i++) {
+            uint32_t id = idx->dirs[d].first_track + i;
+            if (index_read_track(idx, id, &idx->scratch) == ESP_OK && strcmp(idx->scratch.path, path) == 0) {
+                return id;
+            }
+        }
+    }
+    return 0;
+}
+
+/* Replace the index file by the freshly built one, the cursor follows its track */
+static esp_err_t index_swap(music_index_handle_t idx)
+{
+    xSemaphoreTake(idx->lock, portMAX_DELAY);
+    char *path = idx->scratch.path;
+    bool had_current = idx->file && index_read_track(idx, idx->hdr.current, &idx->scratch) == ESP_OK;
+    index_unload(idx);
+    unlink(MUSIC_INDEX_FILE);
+    esp_err_t ret = ESP_FAIL;
+    if (rename(MUSIC_INDEX_TMP_FILE, MUSIC_INDEX_FILE) == 0) {
+        ret = index_load(idx);
+    }
+    if (ret == ESP_OK && had_current) {
+        char current[MUSIC_INDEX_PATH_LEN];
+        strcpy(current, path);
+        idx->hdr.current = index_find(idx, current);
+        index_save_current(idx);
+    }
+    xSemaphoreGive(idx->lock);
+    return ret;
+}
+
+static music_index_builder_t *builder_create(mode_arena_handle_t arena, music_index_handle_t old)
+{
+    music_index_builder_t *b = mode_arena_calloc(arena, 1, sizeof(music_index_builder_t));
+    AUDIO_MEM_CHECK(TAG, b, return NULL);
+    b->arena = arena;
+    b->idx = old;
+    return b;
+}
+
+static void builder_destroy(music_index_builder_t *b)
+{
+    mode_arena_free(b->arena, b->dirs);
+    mode_arena_free(b->arena, b);
+}
+
+static void music_index_refresh_task(void *arg)
+{
+    music_index_handle_t idx = (music_index_handle_t)arg;
+    int64_t start_us = esp_timer_get_time();
+    music_index_builder_t *b = builder_create(idx->arena, idx);
+    if (b == NULL) {
+        goto _refresh_exit;
+    }
+    strcpy(b->path, MUSIC_INDEX_ROOT);
+    esp_err_t ret = builder_walk(b, 0, &idx->abort);
+    if (ret == ESP_OK && b->dir_num == idx->hdr.dir_num) {
+        ESP_LOGI(TAG, "Index up to date, %u directories verified in %d ms",
+                 b->dir_num, (int)((esp_timer_get_time() - start_us) / 1000));
+        goto _refresh_exit;
+    }
+    if (ret != ESP_OK && ret != ESP_ERR_INVALID_STATE) {
+        goto _refresh_exit;
+    }
+    b->dir_num = 0;
+    b->old_hint = 0;
+    if (builder_build(b, &idx->abort) == ESP_OK && index_swap(idx) == ESP_OK) {
+        ESP_LOGI(TAG, "Index rebuilt in %d ms, %u tracks, %u of %u directories rescanned",
+                 (int)((esp_timer_get_time() - start_us) / 1000), b->track_num, b->changed, b->dir_num);
+    }
+
+_refresh_exit:
+    if (b) {
+        builder_destroy(b);
+    }
+    xSemaphoreGive(idx->refresh_done);
+    vTaskDelete(NULL);
+}
+
+esp_err_t music_index_open(music_index_handle_t *handle, mode_arena_handle_t arena)
+{
+    AUDIO_NULL_CHECK(TAG, handle, return ESP_ERR_INVALID_ARG);
+    int64_t start_us = esp_timer_get_time();
+    music_index_handle_t idx = mode_arena_calloc(arena, 1, sizeof(struct music_index));
+    AUDIO_MEM_CHECK(TAG, idx, return ESP_ERR_NO_MEM);
+    idx->arena = arena;
+    idx->lock = xSemaphoreCreateMutex();
+    idx->refresh_done = xSemaphoreCreateBinary();
+    AUDIO_MEM_CHECK(TAG, idx->lock && idx->refresh_done, goto _open_failed);
+
+    if (index_load(idx) != ESP_OK) {
+        ESP_LOGI(TAG, "Building the music index");
+        music_index_builder_t *b = builder_create(arena, NULL);
+        AUDIO_MEM_CHECK(TAG, b, goto _open_failed);
+        esp_err_t ret = builder_build(b, &idx->abort);
+        builder_destroy(b);
+        if (ret != ESP_OK || index_swap(idx) != ESP_OK) {
+            goto _open_failed;
+        }
+    }
+    ESP_LOGI(TAG, "Index ready in %d ms, %u tracks in %u directories",
+             (int)((esp_timer_get_time() - start_us) / 1000), idx->hdr.track_num, idx->hdr.dir_num);
+    *handle = idx;
+    return ESP_OK;
+
+_open_failed:
+    music_index_close(idx);
+    return ESP_FAIL;
+}
+
+esp_err_t music_index_refresh(music_index_handle_t idx)
+{
+    AUDIO_NULL_CHECK(TAG, idx, return ESP_ERR_INVALID_ARG);
+    if (idx->refresh_task) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    idx->abort = false;
+    if (xTaskCreatePinnedToCore(music_index_refresh_task, "music_index", MUSIC_INDEX_TASK_STACK, idx,
+                                MUSIC_INDEX_TASK_PRIO, &idx->refresh_task, MUSIC_INDEX_TASK_CORE) != pdPASS) {
+        idx->refresh_task = NULL;
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+int music_index_count(music_index_handle_t idx)
+{
+    return idx ? idx->hdr.track_num : 0;
+}
+
+uint32_t music_index_current_id(music_index_handle_t idx)
+{
+    return idx ? idx->hdr.current : 0;
+}
+
+esp_err_t music_index_current(music_index_handle_t idx, music_track_t *track)
+{
+    AUDIO_NULL_CHECK(TAG, idx, return ESP_ERR_INVALID_ARG);
+    xSemaphoreTake(idx->lock, portMAX_DELAY);
+    esp_err_t ret = index_read_track(idx, idx->hdr.current, track);
+    xSemaphoreGive(idx->lock);
+    return ret;
+}
+
+esp_err_t music_index_step(music_index_handle_t idx, int step, music_track_t *track)
+{
+    AUDIO_NULL_CHECK(TAG, idx, return ESP_ERR_INVALID_ARG);
+    esp_err_t ret = ESP_ERR_NOT_FOUND;
+    xSemaphoreTake(idx->lock, portMAX_DELAY);
+    int num = idx->hdr.track_num;
+    if (num > 0) {
+        idx->hdr.current = ((int)idx->hdr.current + step % num + num) % num;
+        index_save_current(idx);
+        ret = track ? index_read_track(idx, idx->hdr.current, track) : ESP_OK;
+    }
+    xSemaphoreGive(idx->lock);
+    return ret;
+}
+
+static bool index_peek_next(void *ctx, char *uri, int len, mp3_info_t *info)
+{
+    music_index_handle_t idx = (music_index_handle_t)ctx;
+    bool found = false;
+    xSemaphoreTake(idx->lock, portMAX_DELAY);
+    if (idx->hdr.track_num > 0
+        && index_read_track(idx, (idx->hdr.current + 1) % idx->hdr.track_num, &idx->scratch) == ESP_OK) {
+        snprintf(uri, len, "%s", idx->scratch.path);
+        *info = idx->scratch.info;
+        found = true;
+    }
+    xSemaphoreGive(idx->lock);
+    return found;
+}
+
+static void index_advance(void *ctx)
+{
+    music_index_step((music_index_handle_t)ctx, 1, NULL);
+}
+
+static bool index_lookup(void *ctx, const char *uri, mp3_info_t *info)
+{
+    music_index_handle_t idx = (music_index_handle_t)ctx;
+    const char *path = strstr(uri, MUSIC_INDEX_ROOT);
+    bool found = false;
+    xSemaphoreTake(idx->lock, portMAX_DELAY);
+    if (path && index_read_track(idx, idx->hdr.current, &idx->scratch) == ESP_OK
+        && strcmp(idx->scratch.path, path) == 0 && idx->scratch.info.samples_per_frame) {
+        *info = idx->scratch.info;
+        found = true;
+    }
+    xSemaphoreGive(idx->lock);
+    return found;
+}
+
+void music_index_playlist_ops(music_index_handle_t idx, playlist_reader_ops_t *ops)
+{
+    ops->peek_next = index_peek_next;
+    ops->advance = index_advance;
+    ops->lookup = index_lookup;
+    ops->ctx = idx;
+}
+
+void music_index_close(music_index_handle_t idx)
+{
+    if (idx == NULL) {
+        return;
+    }
+    if (idx->refresh_task) {
+        idx->abort = true;
+        xSemaphoreTake(idx->refresh_done, portMAX_DELAY);
+        idx->refresh_task = NULL;
+    }
+    index_unload(idx);
+    if (idx->lock) {
+        vSemaphoreDelete(idx->lock);
+    }
+    if (idx->refresh_done) {
+        vSemaphoreDelete(idx->refresh_done);
+    }
+    mode_arena_free(idx->arena, idx);
+}
@@ -0,0 +1,93 @@
+#ifndef __MUSIC_INDEX_H__
+#define __MUSIC_INDEX_H__
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "mp3_info.h"
+#include "playlist_reader.h"
+#include "mode_arena.h"
+
+/*
+ * Persistent index of the music on the SD card.
+ *
+ * The index lives on the card next to the music. Every track is one fixed-size
+ * record with its path and the metadata collected when it was indexed (title,
+ * duration, bitrate and the full header info), so playing a track never parses
+ * its header again and any entry is one seek away. Every directory is stored
+ * with a fingerprint of its entries (names, sizes and modification times).
+ *
+ * At boot the stored index is loaded and playback can start right away from
+ * the last track. A background task then walks the directories and compares
+ * the fingerprints; only directories that changed are scanned again, the
+ * records of the others are copied over, and the new index replaces the old
+ * one while the music keeps playing.
+ *
+ * The handle, the directory table and the buffers of the walk are taken from
+ * the arena of the SD mode when one is given.
+ */
+
+#define MUSIC_INDEX_ROOT        "/sdcard"
+#define MUSIC_INDEX_DRIVE       "0:"
+#define MUSIC_INDEX_FILE        "/sdcard/.music_index"
+#define MUSIC_INDEX_PATH_LEN    (256)
+#define MUSIC_INDEX_TITLE_LEN   (64)
+#define MUSIC_INDEX_MAX_DEPTH   (4)
+
+typedef struct {
+    char        path[MUSIC_INDEX_PATH_LEN];     /* "/sdcard/..." */
+    char        title[MUSIC_INDEX_TITLE_LEN];   /* Title tag in UTF-8 (ID3, RIFF INFO or Vorbis comment), empty without one */
+    uint32_t    duration_ms;
+    uint32_t    bitrate;                        /* kbit/s, of the first frame for MP3 */
+    mp3_info_t  info;                           /* Format and header info, see media_probe.h */
+} music_track_t;
+
+typedef struct music_index *music_index_handle_t;
+
+/**
+ * @brief Load the index from the card, it is built first when there is none
+ *
+ * @param[out] handle   The index handle
+ * @param[in]  arena    Arena of the mode, reset only after music_index_close(); NULL for the heap
+ *
+ * @return ESP_OK on success
+ */
+esp_err_t music_index_open(music_index_handle_t *handle, mode_arena_handle_t arena);
+
+/**
+ * @brief Verify the index against the card in the background and rebuild what changed
+ */
+esp_err_t music_index_refresh(music_index_handle_t handle);
+
+/**
+ * @brief Number of indexed tracks
+ */
+int music_index_count(music_index_handle_t handle);
+
+/**
+ * @brief Number of the track under the cursor, 0 for an empty index
+ */
+uint32_t music_index_current_id(music_index_handle_t handle);
+
+/**
+ * @brief Read the track under the cursor, the cursor survives reboots
+ */
+esp_err_t music_index_current(music_index_handle_t handle, music_track_t *track);
+
+/**
+ * @brief Move the cursor by `step` tracks, wrapping around, and read the new track
+ *
+ * @param track     May be NULL
+ */
+esp_err_t music_index_step(music_index_handle_t handle, int step, music_track_t *track);
+
+/**
+ * @brief Fill the playlist operations that let the playlist reader follow the index
+ */
+void music_index_playlist_ops(music_index_handle_t handle, playlist_reader_ops_t *ops);
+
+/**
+ * @brief Stop a running refresh and release the index
+ */
+void music_index_close(music_index_handle_t handle);
+
+#endif
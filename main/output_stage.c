@@ -0,0 +1,518 @@
+#include <string.h>
+#include <sys/param.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "driver/i2s.h"
+#include "audio_error.h"
+#include "audio_mem.h"
+#include "audio_element.h"
+#include "ringbuf.h"
+#include "mem_policy.h"
+#include "output_stage.h"
+#include "prompt_player.h"
+
+#define OUTPUT_STAGE_IDLE_WAIT      pdMS_TO_TICKS(50)
+#define OUTPUT_STAGE_PROMPT_WAIT    (1)
+#define OUTPUT_STAGE_MAX_FRAME      (8)
+#define OUTPUT_STAGE_TRACK_QUEUE    (2)
+#define OUTPUT_STAGE_SILENCE_LEVEL  (16)    /* Peak of a 16-bit block that still counts as silence, about -66 dBFS */
+#define OUTPUT_STAGE_RAMP_MS        (8)     /* Gain ramp before the amplifier is gated and after it wakes */
+#define OUTPUT_STAGE_GAIN_ONE       (1 << 15)
+
+static const char *TAG = "OUTPUT_STAGE";
+
+typedef struct {
+    output_stage_track_t    track;
+    uint64_t                at;         /* Input frame of the run the track started at */
+} output_stage_swap_t;
+
+typedef struct output_stage {
+    int     sample_rate;
+    int     channels;
+    int     bits;
+    int     carry_len;
+    char    carry[OUTPUT_STAGE_MAX_FRAME];
+
+    QueueHandle_t           tracks;
+    output_stage_track_t    track;
+    bool                    track_active;
+    uint32_t                track_pos;
+    bool                    track_ended;    /* The previous track played to its end */
+    int64_t                 finish_us;      /* When the run ended with the previous track, 0 if it did not */
+    uint32_t                zero_run;       /* Silent frames at the end of the output so far */
+    bool                    gap_open;       /* Counting the silence of a track change */
+    uint32_t                gap;
+    output_stage_stats_t    stats;
+    volatile int64_t        latency_since_us;   /* Request the next programme block is timed against, 0 when idle */
+    bool                    fed;                /* Wrote since the open, so an empty output is an underrun */
+    QueueHandle_t           swaps;
+    output_stage_swap_t     swap;
+    bool                    swap_pending;
+    uint64_t                in_frames;          /* Frames taken from the input since the open */
+
+    int                     silence_ms;
+    output_stage_activity_cb on_activity;
+    void                    *activity_ctx;
+    output_stage_activity_t activity;
+    uint32_t                quiet;              /* Silent frames in a row */
+    int64_t                 starved_us;         /* When the input last ran dry, 0 while it delivers */
+    int32_t                 gain;               /* Q15 gain of the amplifier gate ramp */
+    int32_t                 gain_target;
+
+    int                     i2s_port;           /* -1 when the stage fills its output ring buffer */
+    int                     sink_frames;
+    int64_t                 drain_us;           /* When the DMA buffers play out what was written to them */
+} output_stage_t;
+
+static void output_stage_close_gap(output_stage_t *stage)
+{
+    stage->gap_open = false;
+    stage->stats.boundaries++;
+    stage->stats.last_gap = stage->gap;
+    stage->stats.gap_samples += stage->gap;
+    ESP_LOGI(TAG, "Inter-track silence %u samples", stage->gap);
+}
+
+/* Track the silent frames around a track change, only 16-bit samples are inspected */
+static void output_stage_scan(output_stage_t *stage, const char *buf, uint32_t frames)
+{
+    if (stage->bits != 16) {
+        return;
+    }
+    const int16_t *pcm = (const int16_t *)buf;
+    int n = frames * stage->channels;
+    int first = 0;
+    while (first < n && pcm[first] == 0) {
+        first++;
+    }
+    if (first == n) {
+        stage->zero_run += frames;
+        if (stage->gap_open) {
+            stage->gap += frames;
+        }
+        return;
+    }
+    if (stage->gap_open) {
+        stage->gap += first / stage->channels;
+        output_stage_close_gap(stage);
+    }
+    int last = n - 1;
+    while (pcm[last] == 0) {
+        last--;
+    }
+    stage->zero_run = frames - 1 - last / stage->channels;
+}
+
+static void output_stage_begin_track(output_stage_t *stage)
+{
+    if (stage->track_ended) {
+        stage->gap = stage->zero_run;
+        if (stage->finish_us) {
+            /* The output ran dry while the source was restarted */
+            stage->gap += (esp_timer_get_time() - stage->finish_us) * stage->sample_rate / 1000000;
+        }
+        stage->gap_open = true;
+    }
+    stage->track_ended = false;
+    stage->finish_us = 0;
+    stage->zero_run = 0;
+    stage->track_pos = 0;
+    stage->track_active = true;
+}
+
+/* The track of the swap is `offset` frames in, whatever the queue or the previous track said */
+static void output_stage_take_swap(output_stage_t *stage, uint64_t offset)
+{
+    xQueueReset(stage->tracks);
+    stage->swap_pending = false;
+    stage->track = stage->swap.track;
+    /* The encoder delay went out under the outgoing programme, cutting it would cut the mix */
+    if (stage->track.total) {
+        stage->track.keep += stage->track.head;
+    }
+    stage->track.head = 0;
+    stage->track_pos = offset > UINT32_MAX ? UINT32_MAX : (uint32_t)offset;
+    stage->track_active = stage->track.total == 0 || stage->track_pos < stage->track.total;
+    stage->track_ended = !stage->track_active;
+    stage->gap_open = false;
+    stage->finish_us = 0;
+    stage->zero_run = 0;
+}
+
+static void output_stage_report(output_stage_t *stage, output_stage_activity_t activity)
+{
+    stage->activity = activity;
+    if (stage->on_activity) {
+        stage->on_activity(stage->activity_ctx, activity);
+    }
+}
+
+/*
+ * Report the programme going silent and coming back. Before silence is reported
+ * the output is ramped to zero, so the amplifier is gated on digital silence and
+ * the DAC never steps; a block with signal reports it at once and ramps back up,
+ * while the ring buffer ahead of the I2S writer still gives the amplifier time to wake.
+ */
+static void output_stage_gate(output_stage_t *stage, int16_t *pcm, int frames)
+{
+    int channels = stage->channels;
+    int peak = 0;
+    for (int i = 0; i < frames * channels; i++) {
+        int v = pcm[i] < 0 ? -pcm[i] : pcm[i];
+        peak = v > peak ? v : peak;
+    }
+    if (peak > OUTPUT_STAGE_SILENCE_LEVEL) {
+        stage->quiet = 0;
+        stage->gain_target = OUTPUT_STAGE_GAIN_ONE;
+        if (stage->activity != OUTPUT_STAGE_SIGNAL) {
+            output_stage_report(stage, OUTPUT_STAGE_SIGNAL);
+        }
+    } else {
+        stage->quiet += frames;
+        if (stage->activity == OUTPUT_STAGE_STARVED) {
+            output_stage_report(stage, OUTPUT_STAGE_SILENCE);
+        } else if (stage->silence_ms && stage->quiet >= (uint32_t)stage->silence_ms * stage->sample_rate / 1000) {
+            stage->gain_target = 0;
+        }
+    }
+    if (stage->gain != OUTPUT_STAGE_GAIN_ONE || stage->gain_target != OUTPUT_STAGE_GAIN_ONE) {
+        int32_t step = OUTPUT_STAGE_GAIN_ONE / MAX(1, stage->sample_rate * OUTPUT_STAGE_RAMP_MS / 1000) + 1;
+        for (int i = 0; i < frames; i++) {
+            if (stage->gain < stage->gain_target) {
+                stage->gain = MIN(stage->gain + step, stage->gain_target);
+            } else if (stage->gain > stage->gain_target) {
+                stage->gain = MAX(stage->gain - step, stage->gain_target);
+            }
+            for (int ch = 0; ch < channels; ch++) {
+                pcm[i * channels + ch] = (int16_t)((pcm[i * channels + ch] * stage->gain) >> 15);
+            }
+        }
+    }
+    if (stage->gain == 0 && stage->activity == OUTPUT_STAGE_SIGNAL) {
+        output_stage_report(stage, OUTPUT_STAGE_SILENCE);
+    }
+}
+
+/* An input that stays dry as long as the silence hold is reported, e.g. a Bluetooth source paused on the phone */
+static void output_stage_starving(output_stage_t *stage)
+{
+    int64_t now = esp_timer_get_time();
+    if (stage->starved_us == 0) {
+        stage->starved_us = now;
+    } else if (stage->silence_ms && stage->activity != OUTPUT_STAGE_STARVED
+               && now - stage->starved_us >= stage->silence_ms * 1000LL) {
+        /* Nothing is written, the I2S writer already plays silence: ramp up from zero when it comes back */
+        stage->gain = 0;
+        output_stage_report(stage, OUTPUT_STAGE_STARVED);
+    }
+}
+
+/* Drop the encoder delay and padding of the queued tracks, returns the frames left at the start of `buf` */
+static int output_stage_trim(output_stage_t *stage, char *buf, int frames, int frame_bytes)
+{
+    int in = 0;
+    int out = 0;
+    while (in < frames) {
+        uint32_t limit = frames - in;
+        if (stage->swap_pending) {
+            uint64_t pos = stage->in_frames + in;
+            if (pos >= stage->swap.at) {
+                output_stage_take_swap(stage, pos - stage->swap.at);
+                continue;
+            }
+            limit = MIN(limit, stage->swap.at - pos);
+        }
+        if (!stage->track_active) {
+            if (xQueueReceive(stage->tracks, &stage->track, 0) != pdTRUE) {
+                /* No track info, pass through up to the swap or the end of the block */
+                memmove(buf + out * frame_bytes, buf + in * frame_bytes, limit * frame_bytes);
+                out += limit;
+                in += limit;
+                continue;
+            }
+            output_stage_begin_track(stage);
+        }
+        output_stage_track_t *track = &stage->track;
+        uint32_t n = limit;
+        bool keep = false;
+        if (stage->track_pos < track->head) {
+            n = MIN(n, track->head - stage->track_pos);
+        } else if (track->total == 0) {
+            keep = true;
+        } else if (stage->track_pos < track->head + track->keep) {
+            n = MIN(n, track->head + track->keep - stage->track_pos);
+            keep = true;
+        } else {
+            n = MIN(n, track->total - stage->track_pos);
+        }
+        if (keep) {
+            if (out != in) {
+                memmove(buf + out * frame_bytes, buf + in * frame_bytes, n * frame_bytes);
+            }
+            output_stage_scan(stage, buf + out * frame_bytes, n);
+            out += n;
+        }
+        in += n;
+        stage->track_pos += n;
+        if (track->total && stage->track_pos >= track->total) {
+            stage->track_active = false;
+            stage->track_ended = true;
+        }
+    }
+    return out;
+}
+
+static esp_err_t _output_stage_destroy(audio_element_handle_t self)
+{
+    output_stage_t *stage = (output_stage_t *)audio_element_getdata(self);
+    vQueueDelete(stage->tracks);
+    vQueueDelete(stage->swaps);
+    mem_policy_free(stage);
+    return ESP_OK;
+}
+
+static esp_err_t _output_stage_open(audio_element_handle_t self)
+{
+    output_stage_t *stage = (output_stage_t *)audio_element_getdata(self);
+    stage->carry_len = 0;
+    stage->fed = false;
+    stage->swap_pending = false;
+    stage->in_frames = 0;
+    /* Every run starts out as signal, the amplifier is on before the first block */
+    stage->quiet = 0;
+    stage->starved_us = 0;
+    stage->gain = OUTPUT_STAGE_GAIN_ONE;
+    stage->gain_target = OUTPUT_STAGE_GAIN_ONE;
+    stage->drain_us = 0;
+    stage->stats.queued_max_us = 0;
+    output_stage_report(stage, OUTPUT_STAGE_SIGNAL);
+    return ESP_OK;
+}
+
+/* Pass a block on and account for the audio waiting after the stage, the underrun test runs before it lands */
+static int output_stage_write(audio_element_handle_t self, output_stage_t *stage, char *buf, int len)
+{
+    int frame_bytes = stage->channels * (stage->bits >> 3);
+    int64_t queued_us;
+    int w_size;
+    if (stage->i2s_port >= 0) {
+        /* The DMA buffers cannot be looked into, they ran dry once the audio written so far had played */
+        if (stage->fed && esp_timer_get_time() > stage->drain_us) {
+            stage->stats.underruns++;
+        }
+        size_t written = 0;
+        if (i2s_write(stage->i2s_port, buf, len, &written, portMAX_DELAY) != ESP_OK) {
+            ESP_LOGE(TAG, "I2S write failed");
+            return AEL_IO_FAIL;
+        }
+        w_size = written;
+        /* i2s_write returns once the block fits, so the DMA buffers hold at most their size */
+        int64_t now = esp_timer_get_time();
+        int64_t drain_us = MAX(now, stage->drain_us) + (int64_t)(written / frame_bytes) * 1000000 / stage->sample_rate;
+        stage->drain_us = MIN(drain_us, now + (int64_t)stage->sink_frames * 1000000 / stage->sample_rate);
+        queued_us = stage->drain_us - now;
+    } else {
+        ringbuf_handle_t out_rb = audio_element_get_output_ringbuf(self);
+        if (stage->fed && out_rb && rb_bytes_filled(out_rb) == 0) {
+            stage->stats.underruns++;
+        }
+        w_size = audio_element_output(self, buf, len);
+        int filled = out_rb ? rb_bytes_filled(out_rb) : 0;
+        queued_us = ((int64_t)filled / frame_bytes + stage->sink_frames) * 1000000 / stage->sample_rate;
+    }
+    stage->fed = true;
+    if (w_size > 0) {
+        stage->stats.queued_us = queued_us;
+        stage->stats.queued_max_us = MAX(stage->stats.queued_max_us, (uint32_t)queued_us);
+    }
+    return w_size;
+}
+
+static esp_err_t _output_stage_close(audio_element_handle_t self)
+{
+    return ESP_OK;
+}
+
+static int _output_stage_process(audio_element_handle_t self, char *in_buffer, int in_len)
+{
+    output_stage_t *stage = (output_stage_t *)audio_element_getdata(self);
+    int frame_bytes = stage->channels * (stage->bits >> 3);
+    bool prompt = prompt_player_is_active();
+    int64_t since_us = 0;
+    int r_size;
+
+    if (audio_element_get_input_ringbuf(self) == NULL) {
+        /* Linked without a source: render the queued prompts and finish */
+        if (!prompt) {
+            return AEL_IO_DONE;
+        }
+        r_size = in_len - in_len % frame_bytes;
+        memset(in_buffer, 0, r_size);
+    } else {
+        /* Never block for long, a prompt queued while the source is idle must still start */
+        audio_element_set_input_timeout(self, prompt ? OUTPUT_STAGE_PROMPT_WAIT : OUTPUT_STAGE_IDLE_WAIT);
+        int carried = stage->carry_len;
+        memcpy(in_buffer, stage->carry, carried);
+        r_size = audio_element_input(self, in_buffer + carried, in_len - carried);
+        if (r_size > 0) {
+            stage->starved_us = 0;
+            if (!stage->swap_pending && xQueueReceive(stage->swaps, &stage->swap, 0) == pdTRUE) {
+                stage->swap_pending = true;
+            }
+            since_us = stage->latency_since_us;
+            r_size += carried;
+            int frames_in = r_size / frame_bytes;
+            int kept = output_stage_trim(stage, in_buffer, frames_in, frame_bytes);
+            stage->in_frames += frames_in;
+            if (kept < frames_in) {
+                /* Keep the split frame right behind the frames left */
+                memmove(in_buffer + kept * frame_bytes, in_buffer + frames_in * frame_bytes, r_size - frames_in * frame_bytes);
+                r_size -= (frames_in - kept) * frame_bytes;
+            }
+        } else if (r_size == AEL_IO_TIMEOUT && prompt) {
+            /* The source is starving, keep the prompt going over silence */
+            r_size = in_len - in_len % frame_bytes;
+            memset(in_buffer, 0, r_size);
+        } else {
+            if (r_size == AEL_IO_TIMEOUT) {
+                output_stage_starving(stage);
+            }
+            if ((r_size == AEL_IO_DONE || r_size == AEL_IO_OK) && (stage->track_active || stage->track_ended)) {
+                /* The source finished, the gap to the next track runs until it is restarted */
+                stage->track_active = false;
+                stage->track_ended = true;
+                stage->finish_us = esp_timer_get_time();
+            }
+            return r_size;
+        }
+        stage->carry_len = 0;
+    }
+
+    /* Only whole frames are processed, a split frame waits for the next block */
+    int frames = r_size / frame_bytes;
+    int out_len = frames * frame_bytes;
+    if (r_size > out_len) {
+        stage->carry_len = r_size - out_len;
+        memcpy(stage->carry, in_buffer + out_len, stage->carry_len);
+    }
+    if (out_len == 0) {
+        return AEL_IO_TIMEOUT;
+    }
+    if (stage->bits == 16) {
+        prompt_player_mix((int16_t *)in_buffer, frames, stage->channels, stage->sample_rate);
+        output_stage_gate(stage, (int16_t *)in_buffer, frames);
+    }
+    int w_size = output_stage_write(self, stage, in_buffer, out_len);
+    if (since_us && w_size > 0) {
+        stage->latency_since_us = 0;
+        /* Reaches the speaker once the audio queued in front of it has played */
+        ESP_LOGI(TAG, "First audio %d ms after the request, %d ms queued to the codec",
+                 (int)((esp_timer_get_time() - since_us) / 1000), (int)(stage->stats.queued_us / 1000));
+    }
+    if (w_size > 0) {
+        audio_element_update_byte_pos(self, w_size);
+        if (stage->stats.first_audio_us == 0) {
+            stage->stats.first_audio_us = esp_timer_get_time();
+        }
+    }
+    return w_size;
+}
+
+esp_err_t output_stage_queue_track(audio_element_handle_t self, const output_stage_track_t *track)
+{
+    output_stage_t *stage = (output_stage_t *)audio_element_getdata(self);
+    if (xQueueSend(stage->tracks, track, 0) != pdTRUE) {
+        ESP_LOGW(TAG, "Track queue full");
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+esp_err_t output_stage_swap_track(audio_element_handle_t self, const output_stage_track_t *track, uint64_t at_frame)
+{
+    output_stage_t *stage = (output_stage_t *)audio_element_getdata(self);
+    output_stage_swap_t swap = { .at = at_frame };
+    if (track) {
+        swap.track = *track;
+    }
+    xQueueOverwrite(stage->swaps, &swap);
+    return ESP_OK;
+}
+
+void output_stage_reset_tracks(audio_element_handle_t self, bool keep_gap)
+{
+    output_stage_t *stage = (output_stage_t *)audio_element_getdata(self);
+    xQueueReset(stage->tracks);
+    xQueueReset(stage->swaps);
+    stage->track_active = false;
+    stage->gap_open = false;
+    if (!keep_gap) {
+        stage->track_ended = false;
+        stage->finish_us = 0;
+    }
+}
+
+void output_stage_arm_latency(audio_element_handle_t self, int64_t since_us)
+{
+    output_stage_t *stage = (output_stage_t *)audio_element_getdata(self);
+    stage->latency_since_us = since_us;
+}
+
+void output_stage_get_stats(audio_element_handle_t self, output_stage_stats_t *stats)
+{
+    output_stage_t *stage = (output_stage_t *)audio_element_getdata(self);
+    *stats = stage->stats;
+}
+
+esp_err_t output_stage_set_info(audio_element_handle_t self, int rate, int ch, int bits)
+{
+    output_stage_t *stage = (output_stage_t *)audio_element_getdata(self);
+    if (ch <= 0 || bits <= 0 || ch * (bits >> 3) > OUTPUT_STAGE_MAX_FRAME) {
+        ESP_LOGE(TAG, "Unsupported format, ch=%d, bits=%d", ch, bits);
+        return ESP_ERR_INVALID_ARG;
+    }
+    stage->sample_rate = rate;
+    stage->channels = ch;
+    stage->bits = bits;
+    return audio_element_set_music_info(self, rate, ch, bits);
+}
+
+audio_element_handle_t output_stage_init(output_stage_cfg_t *config)
+{
+    AUDIO_NULL_CHECK(TAG, config, return NULL);
+    output_stage_t *stage = mem_policy_calloc(MEM_HOT, 1, sizeof(output_stage_t));
+    AUDIO_MEM_CHECK(TAG, stage, return NULL);
+    stage->tracks = xQueueCreate(OUTPUT_STAGE_TRACK_QUEUE, sizeof(output_stage_track_t));
+    AUDIO_MEM_CHECK(TAG, stage->tracks, {mem_policy_free(stage); return NULL;});
+    stage->swaps = xQueueCreate(1, sizeof(output_stage_swap_t));
+    AUDIO_MEM_CHECK(TAG, stage->swaps, {vQueueDelete(stage->tracks); mem_policy_free(stage); return NULL;});
+    stage->silence_ms = config->silence_ms;
+    stage->on_activity = config->on_activity;
+    stage->activity_ctx = config->activity_ctx;
+    stage->i2s_port = config->i2s_port;
+    stage->sink_frames = config->sink_frames;
+    stage->sample_rate = 44100;
+    stage->channels = 2;
+    stage->bits = 16;
+
+    audio_element_cfg_t cfg = DEFAULT_AUDIO_ELEMENT_CONFIG();
+    cfg.destroy = _output_stage_destroy;
+    cfg.process = _output_stage_process;
+    cfg.open = _output_stage_open;
+    cfg.close = _output_stage_close;
+    cfg.buffer_len = config->buffer_len;
+    cfg.task_stack = config->task_stack;
+    cfg.task_prio = config->task_prio;
+    cfg.task_core = config->task_core;
+    cfg.out_rb_size = config->out_rb_size;
+    cfg.stack_in_ext = config->stack_in_ext;
+    cfg.tag = "output";
+
+    audio_element_handle_t el = audio_element_init(&cfg);
+    AUDIO_MEM_CHECK(TAG, el, {vQueueDelete(stage->swaps); vQueueDelete(stage->tracks); mem_policy_free(stage); return NULL;});
+    audio_element_setdata(el, stage);
+    audio_element_set_music_info(el, stage->sample_rate, stage->channels, stage->bits);
+    return el;
+}
@@ -0,0 +1,135 @@
+#ifndef __OUTPUT_STAGE_H__
+#define __OUTPUT_STAGE_H__
+
+#include "audio_element.h"
+
+/*
+ * Last processing element in front of the i2s writer, or the last element of
+ * the chain when it writes to the I2S DMA buffers itself.
+ *
+ * It mixes prompt tones into the programme. While a prompt is playing and the
+ * upstream chain has nothing to deliver, it renders the prompt over silence so
+ * prompts never wait for the source. Linked as the first element of a chain it
+ * plays the queued prompts standalone and finishes when they are done.
+ *
+ * Sources that know the exact length of their tracks queue a track descriptor
+ * before its audio reaches the stage; the stage then drops the encoder delay
+ * and padding at the track edges and measures the silence between tracks.
+ * A crossfade swaps the track in at the frame its audio started at, the
+ * queued tracks of the outgoing deck no longer apply from there.
+ *
+ * The stage also tells the power manager whether there is anything to hear:
+ * a 16-bit programme that stays below OUTPUT_STAGE_SILENCE_LEVEL for
+ * `silence_ms` is ramped to zero and reported silent, an input that stays dry
+ * that long is reported starved, and the first block with signal is reported
+ * at once and ramped back in.
+ *
+ * With `i2s_port` set the stage has no output ring buffer: every block goes
+ * from its buffer straight into the DMA buffers of the port with i2s_write(),
+ * so the i2s writer task, its ring buffer and its copy drop out and the audio
+ * queued after the stage is never more than the DMA buffers hold.
+ */
+
+typedef enum {
+    OUTPUT_STAGE_SIGNAL = 0,
+    OUTPUT_STAGE_SILENCE,           /* The programme runs, but below the silence level */
+    OUTPUT_STAGE_STARVED,           /* The source delivers nothing */
+} output_stage_activity_t;
+
+/* Called from the stage task when the activity changes, and as signal at every open */
+typedef void (*output_stage_activity_cb)(void *ctx, output_stage_activity_t activity);
+
+typedef struct {
+    int                         out_rb_size;
+    int                         task_stack;
+    int                         task_core;
+    int                         task_prio;
+    bool                        stack_in_ext;
+    int                         buffer_len;
+    int                         silence_ms;     /* Silence or starvation reported after that long, 0 never */
+    output_stage_activity_cb    on_activity;
+    void                        *activity_ctx;
+    int                         i2s_port;       /* Write into the DMA buffers of that port, -1 to fill the output ring buffer */
+    int                         sink_frames;    /* Frames held after the stage out of its sight: DMA buffers, writer buffer */
+} output_stage_cfg_t;
+
+typedef struct {
+    uint32_t    head;       /* Frames to drop at the start of the track */
+    uint32_t    keep;       /* Frames to play after that */
+    uint32_t    total;      /* Frames the decoder produces for the track, 0 when unknown */
+} output_stage_track_t;
+
+typedef struct {
+    uint32_t    boundaries;         /* Track changes measured */
+    uint32_t    last_gap;           /* Silence at the last track change, in samples per channel */
+    uint64_t    gap_samples;        /* Silence summed over all track changes */
+    uint32_t    underruns;          /* Times the I2S output had drained the stage output before the next block */
+    int64_t     first_audio_us;     /* esp_timer time of the first block written since boot, prompts included */
+    uint32_t    queued_us;          /* Audio queued between the stage and the codec after the last block */
+    uint32_t    queued_max_us;      /* Most of it since the open */
+} output_stage_stats_t;
+
+#define OUTPUT_STAGE_TASK_STACK     (3 * 1024)
+#define OUTPUT_STAGE_TASK_CORE      (0)
+#define OUTPUT_STAGE_TASK_PRIO      (5)
+#define OUTPUT_STAGE_RINGBUFFER     (8 * 1024)
+#define OUTPUT_STAGE_BUFFER_LEN     (4 * 1024)
+
+#define DEFAULT_OUTPUT_STAGE_CONFIG() {                 \
+    .out_rb_size    = OUTPUT_STAGE_RINGBUFFER,          \
+    .task_stack     = OUTPUT_STAGE_TASK_STACK,          \
+    .task_core      = OUTPUT_STAGE_TASK_CORE,           \
+    .task_prio      = OUTPUT_STAGE_TASK_PRIO,           \
+    .stack_in_ext   = false,                            \
+    .buffer_len     = OUTPUT_STAGE_BUFFER_LEN,          \
+    .silence_ms     = 0,                                \
+    .on_activity    = NULL,                             \
+    .activity_ctx   = NULL,                             \
+    .i2s_port       = -1,                               \
+    .sink_frames    = 0,                                \
+}
+
+/**
+ * @brief Create the output stage element
+ */
+audio_element_handle_t output_stage_init(output_stage_cfg_t *config);
+
+/**
+ * @brief Set the format of the programme passing through the stage
+ */
+esp_err_t output_stage_set_info(audio_element_handle_t self, int rate, int ch, int bits);
+
+/**
+ * @brief Queue the trim of the next track, called by the source when it opens the track
+ */
+esp_err_t output_stage_queue_track(audio_element_handle_t self, const output_stage_track_t *track);
+
+/**
+ * @brief Play `track` from input frame `at_frame` of the current run on, dropping the queued tracks
+ *
+ * Safe to call while the stage runs, also when it is already past `at_frame`:
+ * the track then continues at the right position. A NULL track passes the rest through.
+ */
+esp_err_t output_stage_swap_track(audio_element_handle_t self, const output_stage_track_t *track, uint64_t at_frame);
+
+/**
+ * @brief Drop the queued tracks, only while the stage is stopped
+ *
+ * @param keep_gap  Keep measuring the gap when the previous track played to its end,
+ *                  false when the source changes
+ */
+void output_stage_reset_tracks(audio_element_handle_t self, bool keep_gap);
+
+/**
+ * @brief Log the time from `since_us` to the first programme block written after it
+ *
+ * Called when a source is (re)started, e.g. right after a button press.
+ */
+void output_stage_arm_latency(audio_element_handle_t self, int64_t since_us);
+
+/**
+ * @brief Read the inter-track silence counters
+ */
+void output_stage_get_stats(audio_element_handle_t self, output_stage_stats_t *stats);
+
+#endif
@@ -0,0 +1,997 @@
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "esp_event.h"
+#include "audio_error.h"
+#include "audio_mem.h"
+#include "i2s_stream.h"
+#include "mp3_decoder.h"
+#include "flac_decoder.h"
+#include "speaker_dsp.h"
+#include "speaker_resampler.h"
+#include "output_stage.h"
+#include "playlist_reader.h"
+#include "radio_reader.h"
+#include "power_manager.h"
+#include "player_pipeline.h"
+
+#define PLAYER_MAX_LINK     (6)
+#define PLAYER_DECK_WAIT    pdMS_TO_TICKS(2000)     /* For an element of a deck to start */
+#define PLAYER_BT_MAX_MS    (CONFIG_SPEAKER_BT_BUFFER_MS > CONFIG_SPEAKER_BT_VIDEO_BUFFER_MS ? \
+                             CONFIG_SPEAKER_BT_BUFFER_MS : CONFIG_SPEAKER_BT_VIDEO_BUFFER_MS)
+#define PLAYER_BT_RB_SIZE   (PLAYER_BT_MAX_MS * 2 * 48 * 4)     /* Twice the deepest depth of 48 kHz stereo */
+
+#if CONFIG_SPEAKER_DIRECT_I2S
+#define PLAYER_DIRECT_I2S   (true)
+#else
+#define PLAYER_DIRECT_I2S   (false)
+#endif
+
+static const char *TAG = "PLAYER_PIPELINE";
+
+ESP_EVENT_DEFINE_BASE(PLAYER_EVENT);
+
+typedef struct {
+    const char  *name;
+    const char  *tags[PLAYER_MAX_LINK];
+    int         num;
+} player_link_t;
+
+static const player_link_t s_links[PLAYER_SOURCE_MAX] = {
+    [PLAYER_SOURCE_NONE]   = { "none",   { NULL },                                                  0 },
+    [PLAYER_SOURCE_PROMPT] = { "prompt", { "output", "i2s" },                                       2 },
+    [PLAYER_SOURCE_SDCARD] = { "sdcard", { NULL },                                                  0 },   /* Per format, s_sd_links */
+    [PLAYER_SOURCE_HTTP]   = { "http",   { "http", "mp3", "dsp", "output", "i2s" },                 5 },
+    [PLAYER_SOURCE_BT]     = { "bt",     { "bt", "dsp", "output", "i2s" },                          4 },
+};
+
+/* The SD chain is the cheapest one for the format of the track, PCM needs no decoder at all */
+static const player_link_t s_sd_links[MEDIA_FORMAT_MAX] = {
+    [MEDIA_FORMAT_MP3]     = { "sdcard", { "file", "mp3", "dsp", "output", "i2s" },                 5 },
+    [MEDIA_FORMAT_WAV]     = { "sdcard", { "file", "dsp", "output", "i2s" },                        4 },
+    [MEDIA_FORMAT_RAW]     = { "sdcard", { "file", "dsp", "output", "i2s" },                        4 },
+    [MEDIA_FORMAT_FLAC]    = { "sdcard", { "file", "flac", "dsp", "output", "i2s" },                5 },
+};
+
+typedef struct {
+    const char  *tag;
+    int         core;
+    int         prio;
+    int         stack;
+} player_task_plan_t;
+
+/* Where every element task runs, menuconfig → Example Configuration → Audio task plan */
+static const player_task_plan_t s_task_plan[] = {
+    { "file",   CONFIG_SPEAKER_FILE_TASK_CORE,      CONFIG_SPEAKER_FILE_TASK_PRIO,      CONFIG_SPEAKER_FILE_TASK_STACK },
+    { "http",   CONFIG_SPEAKER_HTTP_TASK_CORE,      CONFIG_SPEAKER_HTTP_TASK_PRIO,      CONFIG_SPEAKER_HTTP_TASK_STACK },
+    { "mp3",    CONFIG_SPEAKER_MP3_TASK_CORE,       CONFIG_SPEAKER_MP3_TASK_PRIO,       CONFIG_SPEAKER_MP3_TASK_STACK },
+    { "flac",   CONFIG_SPEAKER_FLAC_TASK_CORE,      CONFIG_SPEAKER_FLAC_TASK_PRIO,      CONFIG_SPEAKER_FLAC_TASK_STACK },
+    { "dsp",    CONFIG_SPEAKER_DSP_TASK_CORE,       CONFIG_SPEAKER_DSP_TASK_PRIO,       CONFIG_SPEAKER_DSP_TASK_STACK },
+    { "output", CONFIG_SPEAKER_OUTPUT_TASK_CORE,    CONFIG_SPEAKER_OUTPUT_TASK_PRIO,    CONFIG_SPEAKER_OUTPUT_TASK_STACK },
+    { "i2s",    CONFIG_SPEAKER_I2S_TASK_CORE,       CONFIG_SPEAKER_I2S_TASK_PRIO,       CONFIG_SPEAKER_I2S_TASK_STACK },
+    /* The second deck runs next to its counterpart of the first one */
+    { "file_b", CONFIG_SPEAKER_FILE_TASK_CORE,      CONFIG_SPEAKER_FILE_TASK_PRIO,      CONFIG_SPEAKER_FILE_TASK_STACK },
+    { "http_b", CONFIG_SPEAKER_HTTP_TASK_CORE,      CONFIG_SPEAKER_HTTP_TASK_PRIO,      CONFIG_SPEAKER_HTTP_TASK_STACK },
+    { "mp3_b",  CONFIG_SPEAKER_MP3_TASK_CORE,       CONFIG_SPEAKER_MP3_TASK_PRIO,       CONFIG_SPEAKER_MP3_TASK_STACK },
+};
+
+static const player_task_plan_t *player_task_plan(const char *tag)
+{
+    for (int i = 0; i < sizeof(s_task_plan) / sizeof(s_task_plan[0]); i++) {
+        if (strcmp(s_task_plan[i].tag, tag) == 0) {
+            return &s_task_plan[i];
+        }
+    }
+    return NULL;
+}
+
+static void player_plan_task(const char *tag, int *core, int *prio, int *stack)
+{
+    const player_task_plan_t *plan = player_task_plan(tag);
+    *core = plan->core;
+    *prio = plan->prio;
+    *stack = plan->stack;
+    ESP_LOGI(TAG, "Task %s: core %d, priority %d, %d bytes of stack", tag, plan->core, plan->prio, plan->stack);
+}
+
+/*
+ * Runs in the reader task, the descriptor is queued well before the track's audio reaches the output stage.
+ * During a fade the first track of the incoming deck waits for the mix mark, the outgoing deck's are dropped.
+ */
+static void player_on_track(void *ctx, const mp3_info_t *info, bool chained)
+{
+    player_deck_ctx_t *deck = (player_deck_ctx_t *)ctx;
+    player_pipeline_handle_t player = deck->player;
+    output_stage_track_t track = { 0 };
+    if (info) {
+        mp3_info_trim(info, &track.head, &track.keep);
+        track.total = (uint32_t)mp3_info_total_samples(info);
+        /* The output stage counts frames after the DSP element, at the output rate */
+        const resampler_ratio_t *ratio = speaker_resampler_find(info->sample_rate, CONFIG_SPEAKER_OUTPUT_RATE);
+        if (ratio) {
+            track.head = (uint64_t)track.head * ratio->up / ratio->down;
+            track.keep = (uint64_t)track.keep * ratio->up / ratio->down;
+            track.total = (uint64_t)track.total * ratio->up / ratio->down;
+        }
+        ESP_LOGI(TAG, "Track %s: %u frames, trim %u head, %u tail", chained ? "chained" : "opened",
+                 track.total, track.head, track.total ? track.total - track.head - track.keep : 0);
+    }
+    if (player->fade != PLAYER_FADE_IDLE && deck->deck != player->live) {
+        if (!player->fade_track_set) {
+            player->fade_track = track;
+            player->fade_track_set = true;
+        }
+        return;
+    }
+    if (player->fade == PLAYER_FADE_IDLE && deck->deck == player->live) {
+        output_stage_queue_track(player->output, &track);
+    }
+}
+
+/* Only the playing deck continues with the playlist, and not while a fade is changing decks */
+static bool player_peek_next(void *ctx, char *uri, int len, mp3_info_t *info)
+{
+    player_deck_ctx_t *deck = (player_deck_ctx_t *)ctx;
+    player_pipeline_handle_t player = deck->player;
+    if (!player->has_playlist || player->playlist.peek_next == NULL
+        || player->fade != PLAYER_FADE_IDLE || deck->deck != player->live) {
+        return false;
+    }
+    return player->playlist.peek_next(player->playlist.ctx, uri, len, info);
+}
+
+static void player_advance(void *ctx)
+{
+    player_pipeline_handle_t player = ((player_deck_ctx_t *)ctx)->player;
+    if (player->has_playlist && player->playlist.advance) {
+        player->playlist.advance(player->playlist.ctx);
+    }
+}
+
+static bool player_lookup(void *ctx, const char *uri, mp3_info_t *info)
+{
+    player_pipeline_handle_t player = ((player_deck_ctx_t *)ctx)->player;
+    if (!player->has_playlist || player->playlist.lookup == NULL) {
+        return false;
+    }
+    return player->playlist.lookup(player->playlist.ctx, uri, info);
+}
+
+static void player_on_activity(void *ctx, output_stage_activity_t activity)
+{
+    power_manager_set_activity(activity == OUTPUT_STAGE_SIGNAL ? POWER_ACTIVITY_SIGNAL
+                               : activity == OUTPUT_STAGE_SILENCE ? POWER_ACTIVITY_SILENCE : POWER_ACTIVITY_STARVED);
+}
+
+/* The title of the station being listened to, during a fade that is the incoming one */
+static void player_on_title(void *ctx, const char *title)
+{
+    player_deck_ctx_t *deck = (player_deck_ctx_t *)ctx;
+    player_pipeline_handle_t player = deck->player;
+    player_deck_t listened = player->fade == PLAYER_FADE_IDLE ? player->live : !player->live;
+    if (deck->deck != listened) {
+        return;
+    }
+    /* Never wait in the reader task, a title dropped on a full loop is sent again with the next change */
+    esp_event_post(PLAYER_EVENT, PLAYER_EVENT_TITLE, (void *)title, strlen(title) + 1, 0);
+}
+
+static const player_link_t *player_link(player_source_t source, media_format_t format)
+{
+    return source == PLAYER_SOURCE_SDCARD ? &s_sd_links[format] : &s_links[source];
+}
+
+/* Every chain ends with the i2s writer, it stays out when the output stage writes to the DMA buffers itself */
+static int player_link_num(player_pipeline_handle_t player, const player_link_t *link)
+{
+    return player->sink == player->output ? link->num - 1 : link->num;
+}
+
+static bool player_link_has(const player_link_t *link, const char *tag)
+{
+    for (int i = 0; i < link->num; i++) {
+        if (strcmp(link->tags[i], tag) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static audio_element_handle_t player_front_end(player_pipeline_handle_t player, player_source_t source)
+{
+    switch (source) {
+        case PLAYER_SOURCE_PROMPT:
+            return player->output;
+        case PLAYER_SOURCE_SDCARD:
+            return player->file_reader;
+        case PLAYER_SOURCE_HTTP:
+            return player->http_reader;
+        case PLAYER_SOURCE_BT:
+            return player->bt_reader;
+        default:
+            return NULL;
+    }
+}
+
+/* Depth the Bluetooth stream is held at, 0 without the drift correction */
+static int player_bt_depth(player_pipeline_handle_t player)
+{
+    if (CONFIG_SPEAKER_BT_BUFFER_MS == 0) {
+        return 0;
+    }
+    return player->bt_low_latency ? CONFIG_SPEAKER_BT_VIDEO_BUFFER_MS : CONFIG_SPEAKER_BT_BUFFER_MS;
+}
+
+/* Terminate the tasks of elements that are not part of the next chain, so an idle front end holds no stack */
+static void player_release_unused(player_pipeline_handle_t player, const player_link_t *prev, const player_link_t *next)
+{
+    for (int i = 0; i < prev->num; i++) {
+        if (!player_link_has(next, prev->tags[i])) {
+            audio_element_handle_t el = audio_pipeline_get_el_by_tag(player->pipeline, prev->tags[i]);
+            if (el) {
+                audio_element_terminate(el);
+            }
+        }
+    }
+}
+
+/* Link the next chain in place of the current one, the pipeline is stopped */
+static void player_relink(player_pipeline_handle_t player, const player_link_t *next)
+{
+    if (player->linked) {
+        player_release_unused(player, player_link(player->source, player->linked_format), next);
+        audio_pipeline_breakup_elements(player->pipeline, NULL);
+        audio_pipeline_relink(player->pipeline, (const char **)next->tags, player_link_num(player, next));
+    } else {
+        audio_pipeline_link(player->pipeline, (const char **)next->tags, player_link_num(player, next));
+        player->linked = true;
+    }
+}
+
+/* Elements of the main front end: the linked chain up to the DSP element */
+static int player_main_front(player_pipeline_handle_t player, audio_element_handle_t *els)
+{
+    const player_link_t *link = player_link(player->source, player->linked_format);
+    int num = 0;
+    for (int i = 0; i < link->num && strcmp(link->tags[i], "dsp") != 0; i++) {
+        els[num++] = audio_pipeline_get_el_by_tag(player->pipeline, link->tags[i]);
+    }
+    return num;
+}
+
+/* Start the main front end on its own while the output chain plays the side deck */
+static esp_err_t player_main_start(player_pipeline_handle_t player, const char *uri)
+{
+    audio_element_handle_t els[PLAYER_MAX_LINK];
+    int num = player_main_front(player, els);
+    for (int i = 0; i < num; i++) {
+        audio_element_reset_state(els[i]);
+        audio_element_reset_output_ringbuf(els[i]);
+    }
+    audio_element_set_uri(player_front_end(player, player->source), uri);
+    player->main_parked = false;
+    for (int i = 0; i < num; i++) {
+        audio_element_run(els[i]);
+        if (audio_element_resume(els[i], 0, PLAYER_DECK_WAIT) != ESP_OK) {
+            ESP_LOGE(TAG, "%s did not start", audio_element_get_tag(els[i]));
+            return ESP_FAIL;
+        }
+    }
+    return ESP_OK;
+}
+
+/* Stop the main front end and leave the output chain running */
+static void player_main_park(player_pipeline_handle_t player)
+{
+    audio_element_handle_t els[PLAYER_MAX_LINK];
+    int num = player_main_front(player, els);
+    for (int i = 0; i < num; i++) {
+        audio_element_stop(els[i]);
+    }
+    for (int i = 0; i < num; i++) {
+        audio_element_wait_for_stop(els[i]);
+    }
+    player->main_parked = true;
+}
+
+/* Link the side deck for the current source and run it into the second input of the DSP element */
+static esp_err_t player_side_start(player_pipeline_handle_t player, const char *uri)
+{
+    const char *tags[2] = { player->source == PLAYER_SOURCE_HTTP ? "http_b" : "file_b", "mp3_b" };
+    media_format_t format = player->source == PLAYER_SOURCE_HTTP ? MEDIA_FORMAT_MP3 : player->sd_format;
+    int num = media_format_is_pcm(format) ? 1 : 2;
+    if (player->side_front == NULL) {
+        audio_pipeline_link(player->side, tags, num);
+    } else if (strcmp(player->side_front, tags[0]) != 0 || media_format_is_pcm(player->side_format) != (num == 1)) {
+        audio_pipeline_remove_listener(player->side);
+        audio_pipeline_breakup_elements(player->side, NULL);
+        audio_pipeline_relink(player->side, tags, num);
+    }
+    player->side_front = tags[0];
+    player->side_format = format;
+    audio_pipeline_set_listener(player->side, player->evt);
+    audio_element_set_output_ringbuf(audio_pipeline_get_el_by_tag(player->side, tags[num - 1]), player->side_rb);
+    audio_pipeline_reset_ringbuffer(player->side);
+    audio_pipeline_reset_elements(player->side);
+    audio_pipeline_change_state(player->side, AEL_STATE_INIT);
+    rb_reset(player->side_rb);
+    audio_element_set_uri(audio_pipeline_get_el_by_tag(player->side, tags[0]), uri);
+    player->side_running = true;
+    return audio_pipeline_run(player->side);
+}
+
+static void player_side_stop(player_pipeline_handle_t player)
+{
+    if (!player->side_running) {
+        return;
+    }
+    audio_pipeline_stop(player->side);
+    audio_pipeline_wait_for_stop(player->side);
+    player->side_running = false;
+}
+
+/* Back to the main deck alone, the pipeline is stopped; `release` also ends the side deck's tasks */
+static void player_fade_reset(player_pipeline_handle_t player, bool release)
+{
+    if (player->side == NULL) {
+        return;
+    }
+    player_side_stop(player);
+    if (release && player->side_front) {
+        audio_pipeline_terminate(player->side);
+    }
+    player->live = PLAYER_DECK_MAIN;
+    player->fade = PLAYER_FADE_IDLE;
+    player->main_parked = false;
+    free(player->fade_uri);
+    player->fade_uri = NULL;
+}
+
+/* Pause or resume what plays; a parked main front end stays stopped, a pipeline-wide resume would restart it */
+static esp_err_t player_hold(player_pipeline_handle_t player, bool pause)
+{
+    esp_err_t ret = ESP_OK;
+    if (player->main_parked) {
+        const player_link_t *link = player_link(player->source, player->linked_format);
+        bool back = false;
+        for (int i = 0; i < player_link_num(player, link); i++) {
+            back = back || strcmp(link->tags[i], "dsp") == 0;
+            if (back) {
+                audio_element_handle_t el = audio_pipeline_get_el_by_tag(player->pipeline, link->tags[i]);
+                ret |= pause ? audio_element_pause(el) : audio_element_resume(el, 0, PLAYER_DECK_WAIT);
+            }
+        }
+    } else {
+        ret = pause ? audio_pipeline_pause(player->pipeline) : audio_pipeline_resume(player->pipeline);
+    }
+    if (player->side_running) {
+        ret |= pause ? audio_pipeline_pause(player->side) : audio_pipeline_resume(player->side);
+    }
+    return ret;
+}
+
+/* Stop both decks and the output chain, a restart keeps the power state as it is */
+static void player_stop_chain(player_pipeline_handle_t player)
+{
+    audio_element_state_t state = audio_element_get_state(player->sink);
+    if (state == AEL_STATE_INIT || state == AEL_STATE_STOPPED) {
+        player_fade_reset(player, false);
+        return;
+    }
+    /* A paused pipeline does not accept a stop command, wake it up first */
+    if (state == AEL_STATE_PAUSED) {
+        player_hold(player, false);
+    }
+    audio_pipeline_stop(player->pipeline);
+    audio_pipeline_wait_for_stop(player->pipeline);
+    player_fade_reset(player, false);
+}
+
+/* The second deck: its own reader and decoder, sharing the radio connections of the first */
+static esp_err_t player_side_init(player_pipeline_handle_t player)
+{
+    audio_pipeline_cfg_t pipeline_cfg = DEFAULT_AUDIO_PIPELINE_CONFIG();
+    player->side = audio_pipeline_init(&pipeline_cfg);
+    AUDIO_NULL_CHECK(TAG, player->side, return ESP_FAIL);
+
+    playlist_reader_cfg_t file_cfg = DEFAULT_PLAYLIST_READER_CONFIG();
+    file_cfg.on_track = player_on_track;
+    file_cfg.track_ctx = &player->deck_ctx[PLAYER_DECK_SIDE];
+    player_plan_task("file_b", &file_cfg.task_core, &file_cfg.task_prio, &file_cfg.task_stack);
+    player->side_file = playlist_reader_init(&file_cfg);
+    AUDIO_NULL_CHECK(TAG, player->side_file, return ESP_FAIL);
+
+    radio_reader_cfg_t http_cfg = DEFAULT_RADIO_READER_CONFIG();
+    http_cfg.share = player->http_reader;
+    http_cfg.on_title = player_on_title;
+    http_cfg.title_ctx = &player->deck_ctx[PLAYER_DECK_SIDE];
+    http_cfg.jitter_size = CONFIG_RADIO_JITTER_BUFFER_KB * 1024;
+    http_cfg.preroll_ms = CONFIG_RADIO_PREROLL_MS;
+    player_plan_task("http_b", &http_cfg.task_core, &http_cfg.task_prio, &http_cfg.task_stack);
+    player->side_http = radio_reader_init(&http_cfg);
+    AUDIO_NULL_CHECK(TAG, player->side_http, return ESP_FAIL);
+
+    mp3_decoder_cfg_t mp3_cfg = DEFAULT_MP3_DECODER_CONFIG();
+    player_plan_task("mp3_b", &mp3_cfg.task_core, &mp3_cfg.task_prio, &mp3_cfg.task_stack);
+    player->side_mp3 = mp3_decoder_init(&mp3_cfg);
+    AUDIO_NULL_CHECK(TAG, player->side_mp3, return ESP_FAIL);
+
+    player->side_rb = rb_create(mp3_cfg.out_rb_size, 1);
+    AUDIO_NULL_CHECK(TAG, player->side_rb, return ESP_FAIL);
+    audio_element_set_multi_input_ringbuf(player->dsp, player->side_rb, 0);
+
+    audio_pipeline_register(player->side, player->side_file, "file_b");
+    audio_pipeline_register(player->side, player->side_http, "http_b");
+    audio_pipeline_register(player->side, player->side_mp3, "mp3_b");
+    ESP_LOGI(TAG, "Crossfade of %d ms on a second deck", CONFIG_SPEAKER_CROSSFADE_MS);
+    return ESP_OK;
+}
+
+/* Deinit every element and pipeline that exists, for a failed init as well as a full teardown */
+static void player_free(player_pipeline_handle_t player)
+{
+    /* The side reader shares the connections of http_reader, so it goes first */
+    audio_element_handle_t side_els[] = { player->side_mp3, player->side_http, player->side_file };
+    audio_element_handle_t main_els[] = {
+        player->i2s_writer, player->output, player->dsp, player->flac_decoder,
+        player->mp3_decoder, player->http_reader, player->file_reader,
+    };
+    if (player->side) {
+        audio_pipeline_terminate(player->side);
+    }
+    if (player->pipeline) {
+        audio_pipeline_terminate(player->pipeline);
+    }
+    for (int i = 0; i < sizeof(side_els) / sizeof(side_els[0]); i++) {
+        if (side_els[i]) {
+            if (player->side) {
+                audio_pipeline_unregister(player->side, side_els[i]);
+            }
+            audio_element_deinit(side_els[i]);
+        }
+    }
+    for (int i = 0; i < sizeof(main_els) / sizeof(main_els[0]); i++) {
+        if (main_els[i]) {
+            if (player->pipeline) {
+                audio_pipeline_unregister(player->pipeline, main_els[i]);
+            }
+            audio_element_deinit(main_els[i]);
+        }
+    }
+    if (player->side) {
+        audio_pipeline_deinit(player->side);
+    }
+    if (player->pipeline) {
+        audio_pipeline_deinit(player->pipeline);
+    }
+    if (player->side_rb) {
+        rb_destroy(player->side_rb);
+    }
+    free(player->fade_uri);
+    audio_free(player);
+}
+
+player_pipeline_handle_t player_pipeline_init(audio_event_iface_handle_t evt)
+{
+    player_pipeline_handle_t player = audio_calloc(1, sizeof(struct player_pipeline));
+    AUDIO_MEM_CHECK(TAG, player, return NULL);
+    player->evt = evt;
+    player->deck_ctx[PLAYER_DECK_MAIN] = (player_deck_ctx_t) { player, PLAYER_DECK_MAIN };
+    player->deck_ctx[PLAYER_DECK_SIDE] = (player_deck_ctx_t) { player, PLAYER_DECK_SIDE };
+
+    audio_pipeline_cfg_t pipeline_cfg = DEFAULT_AUDIO_PIPELINE_CONFIG();
+    player->pipeline = audio_pipeline_init(&pipeline_cfg);
+    AUDIO_NULL_CHECK(TAG, player->pipeline, goto _init_failed);
+
+    playlist_reader_cfg_t file_cfg = DEFAULT_PLAYLIST_READER_CONFIG();
+    file_cfg.on_track = player_on_track;
+    file_cfg.track_ctx = &player->deck_ctx[PLAYER_DECK_MAIN];
+    player_plan_task("file", &file_cfg.task_core, &file_cfg.task_prio, &file_cfg.task_stack);
+    player->file_reader = playlist_reader_init(&file_cfg);
+    AUDIO_NULL_CHECK(TAG, player->file_reader, goto _init_failed);
+
+    radio_reader_cfg_t http_cfg = DEFAULT_RADIO_READER_CONFIG();
+    http_cfg.standby_num = CONFIG_RADIO_STANDBY_STATIONS;
+    http_cfg.standby_size = CONFIG_RADIO_STANDBY_BUFFER_KB * 1024;
+    http_cfg.jitter_size = CONFIG_RADIO_JITTER_BUFFER_KB * 1024;
+    http_cfg.preroll_ms = CONFIG_RADIO_PREROLL_MS;
+    player_plan_task("http", &http_cfg.task_core, &http_cfg.task_prio, &http_cfg.task_stack);
+    http_cfg.standby_core = http_cfg.task_core;
+    http_cfg.on_title = player_on_title;
+    http_cfg.title_ctx = &player->deck_ctx[PLAYER_DECK_MAIN];
+    player->http_reader = radio_reader_init(&http_cfg);
+    AUDIO_NULL_CHECK(TAG, player->http_reader, goto _init_failed);
+
+    mp3_decoder_cfg_t mp3_cfg = DEFAULT_MP3_DECODER_CONFIG();
+    player_plan_task("mp3", &mp3_cfg.task_core, &mp3_cfg.task_prio, &mp3_cfg.task_stack);
+    player->mp3_decoder = mp3_decoder_init(&mp3_cfg);
+    AUDIO_NULL_CHECK(TAG, player->mp3_decoder, goto _init_failed);
+
+    flac_decoder_cfg_t flac_cfg = DEFAULT_FLAC_DECODER_CONFIG();
+    player_plan_task("flac", &flac_cfg.task_core, &flac_cfg.task_prio, &flac_cfg.task_stack);
+    player->flac_decoder = flac_decoder_init(&flac_cfg);
+    AUDIO_NULL_CHECK(TAG, player->flac_decoder, goto _init_failed);
+
+    speaker_dsp_cfg_t dsp_cfg = DEFAULT_SPEAKER_DSP_CONFIG();
+    dsp_cfg.out_rate = CONFIG_SPEAKER_OUTPUT_RATE;
+    dsp_cfg.crossfade = CONFIG_SPEAKER_CROSSFADE_MS > 0;
+    dsp_cfg.drift = CONFIG_SPEAKER_BT_BUFFER_MS > 0;
+    player_plan_task("dsp", &dsp_cfg.task_core, &dsp_cfg.task_prio, &dsp_cfg.task_stack);
+    player->dsp = speaker_dsp_init(&dsp_cfg);
+    AUDIO_NULL_CHECK(TAG, player->dsp, goto _init_failed);
+
+    /* The only place the I2S driver and its DMA buffers get allocated */
+    i2s_stream_cfg_t i2s_cfg = I2S_STREAM_CFG_DEFAULT();
+    i2s_cfg.type = AUDIO_STREAM_WRITER;
+    if (CONFIG_SPEAKER_OUTPUT_RATE) {
+        /* Start at the fixed rate, the clock is then only reprogrammed for a rate without a resampler */
+        i2s_cfg.i2s_config.sample_rate = CONFIG_SPEAKER_OUTPUT_RATE;
+        player->sample_rate = CONFIG_SPEAKER_OUTPUT_RATE;
+        player->bits = 16;
+        player->channels = 2;
+    }
+    if (PLAYER_DIRECT_I2S) {
+        /* Nothing refills a DMA buffer the output stage is late for, it must play silence and not the last block */
+        i2s_cfg.i2s_config.tx_desc_auto_clear = true;
+    }
+    player_plan_task("i2s", &i2s_cfg.task_core, &i2s_cfg.task_prio, &i2s_cfg.task_stack);
+    player->i2s_writer = i2s_stream_init(&i2s_cfg);
+    AUDIO_NULL_CHECK(TAG, player->i2s_writer, goto _init_failed);
+
+    /* Frames of 16-bit stereo, the format of the output chain at a fixed rate */
+    int dma_frames = i2s_cfg.i2s_config.dma_buf_count * i2s_cfg.i2s_config.dma_buf_len;
+    output_stage_cfg_t output_cfg = DEFAULT_OUTPUT_STAGE_CONFIG();
+    output_cfg.silence_ms = CONFIG_SPEAKER_AMP_SILENCE_MS;
+    output_cfg.on_activity = player_on_activity;
+    player_plan_task("output", &output_cfg.task_core, &output_cfg.task_prio, &output_cfg.task_stack);
+    if (PLAYER_DIRECT_I2S) {
+        /* The stage feeds the DMA buffers in place of the i2s writer, so it runs where the writer would */
+        output_cfg.task_core = i2s_cfg.task_core;
+        output_cfg.task_prio = i2s_cfg.task_prio;
+        output_cfg.i2s_port = i2s_cfg.i2s_port;
+        output_cfg.sink_frames = dma_frames;
+    } else {
+        output_cfg.sink_frames = dma_frames + i2s_cfg.buffer_len / 4;
+    }
+    player->output = output_stage_init(&output_cfg);
+    AUDIO_NULL_CHECK(TAG, player->output, goto _init_failed);
+    player->sink = PLAYER_DIRECT_I2S ? player->output : player->i2s_writer;
+    int ring_frames = PLAYER_DIRECT_I2S ? 0 : output_cfg.out_rb_size / 4;
+    int rate = CONFIG_SPEAKER_OUTPUT_RATE ? CONFIG_SPEAKER_OUTPUT_RATE : 44100;
+    ESP_LOGI(TAG, "Output after the output stage: %s, up to %d ms queued, %d ms of it in DMA buffers",
+             PLAYER_DIRECT_I2S ? "direct to I2S DMA" : "ring buffer and i2s writer",
+             (ring_frames + output_cfg.sink_frames) * 1000 / rate, dma_frames * 1000 / rate);
+
+    audio_pipeline_register(player->pipeline, player->file_reader, "file");
+    audio_pipeline_register(player->pipeline, player->http_reader, "http");
+    audio_pipeline_register(player->pipeline, player->mp3_decoder, "mp3");
+    audio_pipeline_register(player->pipeline, player->flac_decoder, "flac");
+    audio_pipeline_register(player->pipeline, player->dsp, "dsp");
+    audio_pipeline_register(player->pipeline, player->output, "output");
+    audio_pipeline_register(player->pipeline, player->i2s_writer, "i2s");
+
+    if (CONFIG_SPEAKER_CROSSFADE_MS > 0 && player_side_init(player) != ESP_OK) {
+        goto _init_failed;
+    }
+
+    player->source = PLAYER_SOURCE_NONE;
+#if CONFIG_SPEAKER_BT_LOW_LATENCY
+    player->bt_low_latency = true;
+#endif
+    return player;
+
+_init_failed:
+    ESP_LOGE(TAG, "Failed to create the playback pipeline");
+    player_free(player);
+    return NULL;
+}
+
+esp_err_t player_pipeline_deinit(player_pipeline_handle_t player)
+{
+    AUDIO_NULL_CHECK(TAG, player, return ESP_FAIL);
+    player_pipeline_stop(player);
+    /* The Bluetooth reader belongs to the Bluetooth service, it is only detached */
+    player_pipeline_attach_bt(player, NULL);
+    player_free(player);
+    return ESP_OK;
+}
+
+esp_err_t player_pipeline_switch(player_pipeline_handle_t player, player_source_t source, const char *uri)
+{
+    AUDIO_NULL_CHECK(TAG, player, return ESP_FAIL);
+    if (source <= PLAYER_SOURCE_NONE || source >= PLAYER_SOURCE_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    audio_element_handle_t front = player_front_end(player, source);
+    if (front == NULL) {
+        ESP_LOGE(TAG, "No front end for source %s", s_links[source].name);
+        return ESP_ERR_INVALID_STATE;
+    }
+    int64_t start_us = esp_timer_get_time();
+    const player_link_t *next = player_link(source, player->sd_format);
+
+    if (player->linked) {
+        /* Detach first so the stop reports of the old chain never reach the mode loops */
+        audio_pipeline_remove_listener(player->pipeline);
+        player_pipeline_stop(player);
+        player_fade_reset(player, true);
+        if (player->source == PLAYER_SOURCE_HTTP && source != PLAYER_SOURCE_HTTP) {
+            radio_reader_release(player->http_reader);
+        }
+    }
+    player_relink(player, next);
+    audio_pipeline_set_listener(player->pipeline, player->evt);
+    audio_event_iface_discard(player->evt);
+    audio_pipeline_reset_ringbuffer(player->pipeline);
+    audio_pipeline_reset_elements(player->pipeline);
+    audio_pipeline_change_state(player->pipeline, AEL_STATE_INIT);
+    output_stage_reset_tracks(player->output, false);
+    if (uri) {
+        audio_element_set_uri(front, uri);
+    }
+    player->source = source;
+    player->linked_format = player->sd_format;
+    /* Only the Bluetooth stream comes on a clock of its own, every other source is pulled at the output rate */
+    speaker_dsp_set_drift(player->dsp, source == PLAYER_SOURCE_BT ? player_bt_depth(player) : 0);
+    output_stage_arm_latency(player->output, start_us);
+
+    ESP_LOGI(TAG, "Source switched to %s in %d ms, %u bytes of internal RAM free", next->name,
+             (int)((esp_timer_get_time() - start_us) / 1000), heap_caps_get_free_size(MALLOC_CAP_INTERNAL));
+    return ESP_OK;
+}
+
+esp_err_t player_pipeline_restart(player_pipeline_handle_t player, const char *uri)
+{
+    AUDIO_NULL_CHECK(TAG, player, return ESP_FAIL);
+    audio_element_handle_t front = player_front_end(player, player->source);
+    AUDIO_NULL_CHECK(TAG, front, return ESP_ERR_INVALID_STATE);
+
+    output_stage_arm_latency(player->output, esp_timer_get_time());
+    player_stop_chain(player);
+    if (player->source == PLAYER_SOURCE_SDCARD && player->sd_format != player->linked_format) {
+        /* The decoders stay registered, only the chain in front of the DSP changes */
+        audio_pipeline_remove_listener(player->pipeline);
+        player_relink(player, &s_sd_links[player->sd_format]);
+        audio_pipeline_set_listener(player->pipeline, player->evt);
+        audio_event_iface_discard(player->evt);
+        ESP_LOGI(TAG, "SD chain relinked for %s", media_format_name(player->sd_format));
+        player->linked_format = player->sd_format;
+    }
+    if (uri) {
+        audio_element_set_uri(front, uri);
+    }
+    audio_pipeline_reset_ringbuffer(player->pipeline);
+    audio_pipeline_reset_elements(player->pipeline);
+    audio_pipeline_change_state(player->pipeline, AEL_STATE_INIT);
+    output_stage_reset_tracks(player->output, true);
+    return player_pipeline_run(player);
+}
+
+esp_err_t player_pipeline_select_format(player_pipeline_handle_t player, int format)
+{
+    AUDIO_NULL_CHECK(TAG, player, return ESP_FAIL);
+    if (format < 0 || format >= MEDIA_FORMAT_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    player->sd_format = format;
+    return ESP_OK;
+}
+
+esp_err_t player_pipeline_run(player_pipeline_handle_t player)
+{
+    AUDIO_NULL_CHECK(TAG, player, return ESP_FAIL);
+    power_manager_set_playing(true);
+    return audio_pipeline_run(player->pipeline);
+}
+
+esp_err_t player_pipeline_stop(player_pipeline_handle_t player)
+{
+    AUDIO_NULL_CHECK(TAG, player, return ESP_FAIL);
+    power_manager_set_playing(false);
+    player_stop_chain(player);
+    return ESP_OK;
+}
+
+esp_err_t player_pipeline_pause(player_pipeline_handle_t player)
+{
+    AUDIO_NULL_CHECK(TAG, player, return ESP_FAIL);
+    power_manager_set_playing(false);
+    return player_hold(player, true);
+}
+
+esp_err_t player_pipeline_resume(player_pipeline_handle_t player)
+{
+    AUDIO_NULL_CHECK(TAG, player, return ESP_FAIL);
+    power_manager_set_playing(true);
+    return player_hold(player, false);
+}
+
+esp_err_t player_pipeline_attach_bt(player_pipeline_handle_t player, audio_element_handle_t bt_reader)
+{
+    AUDIO_NULL_CHECK(TAG, player, return ESP_FAIL);
+    if (player->bt_reader) {
+        if (player->source == PLAYER_SOURCE_BT) {
+            player_pipeline_stop(player);
+        }
+        audio_element_terminate(player->bt_reader);
+        audio_pipeline_unregister(player->pipeline, player->bt_reader);
+        player->bt_reader = NULL;
+    }
+    if (bt_reader) {
+        if (CONFIG_SPEAKER_BT_BUFFER_MS > 0) {
+            /* The ring buffer to the DSP element is where the depth is held, it is created when the chain is linked */
+            audio_element_set_output_ringbuf_size(bt_reader, PLAYER_BT_RB_SIZE);
+        }
+        audio_pipeline_register(player->pipeline, bt_reader, "bt");
+        player->bt_reader = bt_reader;
+    }
+    return ESP_OK;
+}
+
+esp_err_t player_pipeline_set_stations(player_pipeline_handle_t player, const char *const *urls, int count)
+{
+    AUDIO_NULL_CHECK(TAG, player, return ESP_FAIL);
+    return radio_reader_set_stations(player->http_reader, urls, count);
+}
+
+esp_err_t player_pipeline_set_playlist(player_pipeline_handle_t player, const playlist_reader_ops_t *ops)
+{
+    AUDIO_NULL_CHECK(TAG, player, return ESP_FAIL);
+    if (player->side == NULL) {
+        return playlist_reader_set_playlist(player->file_reader, ops);
+    }
+    /* Each reader goes through the player, so the deck that is not playing never takes the next entry */
+    player->has_playlist = ops != NULL;
+    if (ops) {
+        player->playlist = *ops;
+    }
+    for (int deck = PLAYER_DECK_MAIN; deck <= PLAYER_DECK_SIDE; deck++) {
+        playlist_reader_ops_t deck_ops = {
+            .peek_next = player_peek_next,
+            .advance = player_advance,
+            .lookup = player_lookup,
+            .ctx = &player->deck_ctx[deck],
+        };
+        playlist_reader_set_playlist(deck == PLAYER_DECK_MAIN ? player->file_reader : player->side_file,
+                                     ops ? &deck_ops : NULL);
+    }
+    return ESP_OK;
+}
+
+/* Whether `el` belongs to the front end of `deck` */
+static bool player_deck_has(player_pipeline_handle_t player, player_deck_t deck, audio_element_handle_t el)
+{
+    if (deck == PLAYER_DECK_SIDE) {
+        return el && (el == player->side_file || el == player->side_http || el == player->side_mp3);
+    }
+    audio_element_handle_t els[PLAYER_MAX_LINK];
+    int num = player_main_front(player, els);
+    for (int i = 0; i < num; i++) {
+        if (els[i] == el) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* The deck that faded out goes back to waiting, the output chain plays the other one alone */
+static void player_fade_done(player_pipeline_handle_t player, player_deck_t live)
+{
+    player_deck_t outgoing = player->live;
+    player->live = live;
+    player->fade = PLAYER_FADE_IDLE;
+    if (outgoing == PLAYER_DECK_MAIN) {
+        player_main_park(player);
+    } else {
+        player_side_stop(player);
+    }
+
+    speaker_dsp_fade_stats_t stats;
+    speaker_dsp_get_fade_stats(player->dsp, &stats);
+    int64_t elapsed_us = esp_timer_get_time() - player->fade_start_us;
+    uint32_t mix_us = stats.mix_us - player->fade_stats.mix_us;
+    ESP_LOGI(TAG, "Crossfade to the %s deck in %d ms: %u frames mixed, %u of them without the outgoing stream, "
+             "mixer %d.%02d %% of a core, %d bytes of internal RAM and %d of PSRAM taken", live == PLAYER_DECK_SIDE ? "second" : "first",
+             (int)(elapsed_us / 1000), stats.mixed_frames - player->fade_stats.mixed_frames,
+             stats.silent_frames - player->fade_stats.silent_frames,
+             (int)(mix_us * 100 / elapsed_us), (int)(mix_us * 10000 / elapsed_us % 100),
+             player->fade_heap - (int)heap_caps_get_free_size(MALLOC_CAP_INTERNAL),
+             player->fade_spiram - (int)heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
+    free(player->fade_uri);
+    player->fade_uri = NULL;
+}
+
+/* Give up the fade and change the hard way, the restart resets both decks */
+static esp_err_t player_fade_fallback(player_pipeline_handle_t player)
+{
+    char *uri = player->fade_uri;
+    player->fade_uri = NULL;
+    speaker_dsp_fade_cancel(player->dsp);
+    esp_err_t ret = player_pipeline_restart(player, uri);
+    free(uri);
+    return ret;
+}
+
+esp_err_t player_pipeline_crossfade(player_pipeline_handle_t player, const char *uri)
+{
+    AUDIO_NULL_CHECK(TAG, player, return ESP_FAIL);
+    AUDIO_NULL_CHECK(TAG, uri, return ESP_ERR_INVALID_ARG);
+    player_deck_t incoming = !player->live;
+    const char *reason = NULL;
+    if (player->side == NULL) {
+        return player_pipeline_restart(player, uri);
+    } else if (player->fade != PLAYER_FADE_IDLE) {
+        reason = "a fade is running";
+    } else if (player->source != PLAYER_SOURCE_SDCARD && player->source != PLAYER_SOURCE_HTTP) {
+        reason = "the source has no second deck";
+    } else if (audio_element_get_state(player->sink) != AEL_STATE_RUNNING) {
+        reason = "nothing plays";
+    } else if (player->source == PLAYER_SOURCE_SDCARD && player->sd_format == MEDIA_FORMAT_FLAC) {
+        reason = "the second deck has no FLAC decoder";
+    } else if (incoming == PLAYER_DECK_MAIN && player->source == PLAYER_SOURCE_SDCARD
+               && player->sd_format != player->linked_format) {
+        reason = "the first deck is linked for another format";
+    }
+    if (reason) {
+        ESP_LOGI(TAG, "No crossfade, %s", reason);
+        return player_pipeline_restart(player, uri);
+    }
+
+    player->fade_uri = strdup(uri);
+    AUDIO_MEM_CHECK(TAG, player->fade_uri, return player_pipeline_restart(player, uri));
+    player->fade = PLAYER_FADE_PENDING;
+    player->fade_track_set = false;
+    player->track_swapped = false;
+    player->fade_start_us = esp_timer_get_time();
+    player->fade_heap = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    player->fade_spiram = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+    speaker_dsp_get_fade_stats(player->dsp, &player->fade_stats);
+    /* The end of the playing stream must not finish the output chain while the next one starts */
+    speaker_dsp_fade_prepare(player->dsp);
+    esp_err_t ret = incoming == PLAYER_DECK_MAIN ? player_main_start(player, uri) : player_side_start(player, uri);
+    if (ret != ESP_OK) {
+        return player_fade_fallback(player);
+    }
+    return ESP_OK;
+}
+
+bool player_pipeline_crossfade_event(player_pipeline_handle_t player, const audio_event_iface_msg_t *msg)
+{
+    if (player->fade == PLAYER_FADE_IDLE || msg->source_type != AUDIO_ELEMENT_TYPE_ELEMENT) {
+        return false;
+    }
+    if (msg->source == (void *)player->dsp && msg->cmd == AEL_MSG_CMD_REPORT_POSITION) {
+        player_deck_t live = speaker_dsp_side_live(player->dsp) ? PLAYER_DECK_SIDE : PLAYER_DECK_MAIN;
+        if (!player->track_swapped && player->fade == PLAYER_FADE_MIXING) {
+            /* The mix started, the output stage follows the incoming track from the frame it started at */
+            speaker_dsp_fade_stats_t stats;
+            speaker_dsp_get_fade_stats(player->dsp, &stats);
+            output_stage_swap_track(player->output, player->fade_track_set ? &player->fade_track : NULL, stats.mark);
+            player->track_swapped = true;
+        }
+        if (live != player->live) {
+            player_fade_done(player, live);
+        }
+        return true;
+    }
+    if (msg->cmd == AEL_MSG_CMD_REPORT_STATUS && player_deck_has(player, !player->live, msg->source)) {
+        int status = (int)msg->data;
+        if (status >= AEL_STATUS_ERROR_OPEN && status <= AEL_STATUS_ERROR_UNKNOWN) {
+            ESP_LOGW(TAG, "The incoming %s failed, restarting", audio_element_get_tag((audio_element_handle_t)msg->source));
+            player_fade_fallback(player);
+            return true;
+        }
+    }
+    return false;
+}
+
+audio_element_handle_t player_pipeline_sd_reader(player_pipeline_handle_t player)
+{
+    return player->live == PLAYER_DECK_SIDE ? player->side_file : player->file_reader;
+}
+
+esp_err_t player_pipeline_apply_music_info(player_pipeline_handle_t player, audio_element_handle_t src)
+{
+    AUDIO_NULL_CHECK(TAG, player, return ESP_FAIL);
+    audio_element_info_t music_info = {0};
+    audio_element_getinfo(src, &music_info);
+    ESP_LOGI(TAG, "[ * ] Receive music info from %s, sample_rates=%d, bits=%d, ch=%d",
+             audio_element_get_tag(src), music_info.sample_rates, music_info.bits, music_info.channels);
+
+    if (player->fade != PLAYER_FADE_IDLE && player_deck_has(player, !player->live, src)) {
+        if (player->fade != PLAYER_FADE_PENDING) {
+            return ESP_OK;
+        }
+        /* Both streams go through one DSP setting, only the same format can be mixed */
+        if (music_info.sample_rates != player->programme_rate || music_info.channels != player->programme_channels
+            || music_info.bits != player->programme_bits || music_info.bits != 16) {
+            ESP_LOGI(TAG, "No crossfade from %d Hz, %d bits, ch=%d", player->programme_rate,
+                     player->programme_bits, player->programme_channels);
+            return player_fade_fallback(player);
+        }
+        player->fade = PLAYER_FADE_MIXING;
+        speaker_dsp_fade_start(player->dsp, CONFIG_SPEAKER_CROSSFADE_MS);
+        return ESP_OK;
+    }
+
+    speaker_dsp_set_info(player->dsp, music_info.sample_rates, music_info.channels, music_info.bits);
+    player->programme_rate = music_info.sample_rates;
+    player->programme_channels = music_info.channels;
+    player->programme_bits = music_info.bits;
+
+    /* Everything after the DSP element runs at the format it reports, the output rate when it converts */
+    audio_element_info_t out_info = {0};
+    audio_element_getinfo(player->dsp, &out_info);
+    audio_element_setinfo(player->i2s_writer, &out_info);
+    output_stage_set_info(player->output, out_info.sample_rates, out_info.channels, out_info.bits);
+
+    if (out_info.sample_rates != player->sample_rate
+        || out_info.bits != player->bits
+        || out_info.channels != player->channels) {
+        /* The i2s writer pauses itself around the clock change, the output stage writing in its place must too */
+        bool hold = player->sink == player->output && audio_element_get_state(player->output) == AEL_STATE_RUNNING;
+        if (hold) {
+            audio_element_pause(player->output);
+        }
+        i2s_stream_set_clk(player->i2s_writer, out_info.sample_rates, out_info.bits, out_info.channels);
+        if (hold) {
+            audio_element_resume(player->output, 0, PLAYER_DECK_WAIT);
+        }
+        player->sample_rate = out_info.sample_rates;
+        player->bits = out_info.bits;
+        player->channels = out_info.channels;
+    }
+    return ESP_OK;
+}
+
+audio_element_handle_t player_pipeline_info_source(player_pipeline_handle_t player)
+{
+    if (player->source == PLAYER_SOURCE_BT) {
+        return player->bt_reader;
+    }
+    player_deck_t deck = player->fade == PLAYER_FADE_PENDING ? !player->live : player->live;
+    if (deck == PLAYER_DECK_SIDE) {
+        return media_format_is_pcm(player->side_format) ? player->side_file : player->side_mp3;
+    }
+    if (player->source == PLAYER_SOURCE_SDCARD) {
+        if (media_format_is_pcm(player->linked_format)) {
+            return player->file_reader;
+        }
+        if (player->linked_format == MEDIA_FORMAT_FLAC) {
+            return player->flac_decoder;
+        }
+    }
+    return player->mp3_decoder;
+}
+
+int player_pipeline_set_bt_low_latency(player_pipeline_handle_t player, bool low_latency)
+{
+    AUDIO_NULL_CHECK(TAG, player, return 0);
+    player->bt_low_latency = low_latency;
+    int depth = player_bt_depth(player);
+    if (player->source == PLAYER_SOURCE_BT) {
+        speaker_dsp_set_drift(player->dsp, depth);
+    }
+    return depth;
+}
+
+void player_pipeline_set_volume(player_pipeline_handle_t player, int volume)
+{
+    speaker_dsp_set_volume(player->dsp, volume);
+}
+
+const char *player_pipeline_source_name(player_source_t source)
+{
+    if (source < PLAYER_SOURCE_NONE || source >= PLAYER_SOURCE_MAX) {
+        return "unknown";
+    }
+    return s_links[source].name;
+}
+
+int player_pipeline_task_stack(const char *tag)
+{
+    const player_task_plan_t *plan = tag ? player_task_plan(tag) : NULL;
+    return plan ? plan->stack : 0;
+}
@@ -0,0 +1,245 @@
+#ifndef __PLAYER_PIPELINE_H__
+#define __PLAYER_PIPELINE_H__
+
+#include "audio_element.h"
+#include "audio_pipeline.h"
+#include "audio_event_iface.h"
+#include "esp_event.h"
+#include "ringbuf.h"
+#include "playlist_reader.h"
+#include "media_probe.h"
+#include "output_stage.h"
+#include "speaker_dsp.h"
+
+/*
+ * One long-lived playback pipeline shared by every mode.
+ *
+ * The output chain (dsp --> output --> i2s) is created once at boot and is
+ * never deinitialized, so the I2S driver and its DMA buffers are allocated
+ * exactly once. Switching between sources only stops the pipeline, breaks up
+ * the links and relinks the reader/decoder front end in front of the output chain.
+ * The prompt source links the output stage alone, to play mode chimes with no programme.
+ * With CONFIG_SPEAKER_DIRECT_I2S the output stage writes to the I2S DMA buffers
+ * itself and the i2s writer is never linked, it only keeps the driver and the clock.
+ *
+ * The SD source links the chain the format of the track needs: MP3 and FLAC
+ * through their decoder, WAV and raw PCM straight from the reader into the
+ * DSP element. Every decoder is created once and kept registered, a track of
+ * the format that is already linked only restarts the chain.
+ *
+ * With CONFIG_SPEAKER_CROSSFADE_MS a second deck, its own reader and MP3
+ * decoder in a pipeline of their own, feeds the second input of the DSP
+ * element. A skip or a station change then starts the next stream on the
+ * deck that is not playing and crossfades to it once it reports the same
+ * format, the output chain never stops. The deck that faded out is stopped
+ * element by element and waits for the next change. Whatever cannot be mixed
+ * (FLAC, another format, Bluetooth, a change during a fade) restarts as before.
+ */
+
+typedef enum {
+    PLAYER_SOURCE_NONE = 0,
+    PLAYER_SOURCE_PROMPT,
+    PLAYER_SOURCE_SDCARD,
+    PLAYER_SOURCE_HTTP,
+    PLAYER_SOURCE_BT,
+    PLAYER_SOURCE_MAX,
+} player_source_t;
+
+typedef enum {
+    PLAYER_DECK_MAIN = 0,       /* The front end linked in the main pipeline */
+    PLAYER_DECK_SIDE,           /* The second deck, only with a crossfade */
+} player_deck_t;
+
+typedef enum {
+    PLAYER_FADE_IDLE = 0,
+    PLAYER_FADE_PENDING,        /* The incoming deck runs, waiting for its music info */
+    PLAYER_FADE_MIXING,
+} player_fade_t;
+
+struct player_pipeline;
+
+typedef struct {
+    struct player_pipeline      *player;
+    player_deck_t               deck;
+} player_deck_ctx_t;
+
+typedef struct player_pipeline {
+    audio_pipeline_handle_t     pipeline;
+    audio_element_handle_t      file_reader;    /* Plays the SD playlist gapless, see playlist_reader.h */
+    audio_element_handle_t      http_reader;    /* Keeps the neighbouring stations warm, see radio_reader.h */
+    audio_element_handle_t      bt_reader;      /* Attached only while the Bluetooth service is up */
+    audio_element_handle_t      mp3_decoder;
+    audio_element_handle_t      flac_decoder;
+    audio_element_handle_t      dsp;            /* Loudness EQ, gain and limiter, see speaker_dsp.h */
+    audio_element_handle_t      output;         /* Mixes the prompt tones, see output_stage.h */
+    audio_element_handle_t      i2s_writer;     /* Only installs the I2S driver when the output stage writes to it */
+    audio_element_handle_t      sink;           /* Last element of every chain, its stop ends a run */
+    audio_event_iface_handle_t  evt;
+    player_source_t             source;
+    media_format_t              sd_format;      /* Format the next SD chain is linked for */
+    media_format_t              linked_format;  /* Format the linked SD chain plays */
+    bool                        linked;
+    int                         programme_rate; /* Rate of the source, the DSP element may convert it */
+    int                         sample_rate;    /* Rate the I2S clock runs at */
+    int                         bits;
+    int                         channels;
+    int                         programme_channels;
+    int                         programme_bits;
+
+    audio_pipeline_handle_t     side;           /* The second deck, NULL without a crossfade */
+    audio_element_handle_t      side_file;
+    audio_element_handle_t      side_http;      /* Shares the connections of http_reader */
+    audio_element_handle_t      side_mp3;
+    ringbuf_handle_t            side_rb;        /* Second input of the DSP element */
+    const char                  *side_front;    /* Tag of the linked side front end, NULL before the first link */
+    media_format_t              side_format;
+    bool                        side_running;
+    bool                        main_parked;    /* The main front end is stopped while the side deck plays */
+    volatile player_deck_t      live;           /* Also read by the reader tasks */
+    volatile player_fade_t      fade;
+    char                        *fade_uri;      /* Restarted from when the fade cannot complete */
+    int64_t                     fade_start_us;
+    output_stage_track_t        fade_track;     /* First track of the incoming deck, swapped in at the mix mark */
+    bool                        fade_track_set;
+    bool                        track_swapped;
+    speaker_dsp_fade_stats_t    fade_stats;     /* Snapshot at the start of the fade */
+    int                         fade_heap;      /* Free internal RAM at the start of the fade */
+    int                         fade_spiram;
+    playlist_reader_ops_t       playlist;       /* The ops both readers go through, see player_pipeline_set_playlist() */
+    bool                        has_playlist;
+    player_deck_ctx_t           deck_ctx[2];
+    bool                        bt_low_latency; /* Bluetooth plays at the video depth */
+} *player_pipeline_handle_t;
+
+/**
+ * @brief Create every element of the playback pipeline and register it once
+ *
+ * @param evt   Event interface that listens to the linked elements
+ *
+ * @return The pipeline handle, NULL on failure
+ */
+player_pipeline_handle_t player_pipeline_init(audio_event_iface_handle_t evt);
+
+/**
+ * @brief Stop playback and destroy every element and pipeline created by player_pipeline_init()
+ *
+ * An attached Bluetooth reader is detached, it is left to its owner to deinit.
+ *
+ * @param player    The pipeline handle
+ *
+ * @return ESP_OK on success
+ */
+esp_err_t player_pipeline_deinit(player_pipeline_handle_t player);
+
+/**
+ * @brief Stop the current front end and relink the pipeline for a new source
+ *
+ * The pipeline is left stopped; call player_pipeline_run() to start it.
+ *
+ * @param player    The pipeline handle
+ * @param source    The source to link in front of the output chain
+ * @param uri       The uri for the reader, may be NULL for the Bluetooth and prompt sources
+ *
+ * @return ESP_OK on success
+ */
+esp_err_t player_pipeline_switch(player_pipeline_handle_t player, player_source_t source, const char *uri);
+
+/**
+ * @brief Restart the current source from a new uri without relinking
+ */
+esp_err_t player_pipeline_restart(player_pipeline_handle_t player, const char *uri);
+
+/**
+ * @brief Change to `uri` on the other deck with a crossfade, or restart when it cannot be mixed
+ *
+ * The fade starts when the incoming deck reports its music info through
+ * player_pipeline_apply_music_info(); until then the playing stream goes on.
+ */
+esp_err_t player_pipeline_crossfade(player_pipeline_handle_t player, const char *uri);
+
+/**
+ * @brief Follow a fade from the pipeline events, call it first for every message of the mode loop
+ *
+ * @return true when the message belonged to the fade and needs nothing else
+ */
+bool player_pipeline_crossfade_event(player_pipeline_handle_t player, const audio_event_iface_msg_t *msg);
+
+/**
+ * @brief The playlist reader of the deck that plays the SD card
+ */
+audio_element_handle_t player_pipeline_sd_reader(player_pipeline_handle_t player);
+
+/**
+ * @brief Select the SD chain for a media_format_t
+ *
+ * Takes effect on the next player_pipeline_switch() to the SD source, or on the
+ * next player_pipeline_restart() of it, which relinks only when the format changed.
+ */
+esp_err_t player_pipeline_select_format(player_pipeline_handle_t player, int format);
+
+/**
+ * @brief Run, stop, pause or resume the linked chain
+ */
+esp_err_t player_pipeline_run(player_pipeline_handle_t player);
+esp_err_t player_pipeline_stop(player_pipeline_handle_t player);
+esp_err_t player_pipeline_pause(player_pipeline_handle_t player);
+esp_err_t player_pipeline_resume(player_pipeline_handle_t player);
+
+/**
+ * @brief Register the Bluetooth stream as a front end, or drop it again with NULL
+ */
+esp_err_t player_pipeline_attach_bt(player_pipeline_handle_t player, audio_element_handle_t bt_reader);
+
+/**
+ * @brief Hold the Bluetooth stream at the video depth instead of the music depth, takes effect at the next block
+ *
+ * @return The depth in ms the stream is now held at, 0 when it is taken as it comes
+ */
+int player_pipeline_set_bt_low_latency(player_pipeline_handle_t player, bool low_latency);
+
+/**
+ * @brief Set the playlist the SD source continues with when a track ends
+ *
+ * Both decks read through it, only the playing deck outside a fade continues with the next entry.
+ */
+esp_err_t player_pipeline_set_playlist(player_pipeline_handle_t player, const playlist_reader_ops_t *ops);
+
+/* Posted to the default event loop, which the Wi-Fi link creates before the radio plays */
+ESP_EVENT_DECLARE_BASE(PLAYER_EVENT);
+
+typedef enum {
+    PLAYER_EVENT_TITLE,         /* The radio station plays a new title, the data is the NUL-terminated title */
+} player_event_t;
+
+/**
+ * @brief Set the station list the HTTP source keeps the neighbours of the playing station warm from
+ */
+esp_err_t player_pipeline_set_stations(player_pipeline_handle_t player, const char *const *urls, int count);
+
+/**
+ * @brief Propagate the music info of the front end to the output chain
+ *
+ * The I2S clock is only reprogrammed when the format actually changes.
+ */
+esp_err_t player_pipeline_apply_music_info(player_pipeline_handle_t player, audio_element_handle_t src);
+
+/**
+ * @brief Make the loudness compensation follow the volume, safe to call from any task
+ */
+void player_pipeline_set_volume(player_pipeline_handle_t player, int volume);
+
+/**
+ * @brief Return the element that reports the music info for the current source
+ *
+ * During a crossfade that is the element of the incoming deck.
+ */
+audio_element_handle_t player_pipeline_info_source(player_pipeline_handle_t player);
+
+const char *player_pipeline_source_name(player_source_t source);
+
+/**
+ * @brief Stack the element task with this pipeline tag is created with, 0 when it has no planned task
+ */
+int player_pipeline_task_stack(const char *tag);
+
+#endif
@@ -0,0 +1,376 @@
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/param.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "audio_error.h"
+#include "audio_mem.h"
+#include "audio_element.h"
+#include "mem_policy.h"
+#include "media_probe.h"
+#include "playlist_reader.h"
+
+#define PLAYLIST_URI_LEN        (256)
+#define PLAYLIST_HEAD_LEN       (2048)
+
+static const char *TAG = "PLAYLIST_READER";
+
+typedef struct {
+    int         fd;
+    mp3_info_t  info;
+    bool        parsed;
+    uint32_t    pos;            /* File offset of the next read */
+    uint32_t    end;            /* End of the audio data, a trailing ID3v1 tag is left out */
+    uint8_t     *head;          /* First block of audio data, read when the track is opened */
+    int         head_pos;
+    int         head_len;
+} playlist_track_t;
+
+typedef struct {
+    SemaphoreHandle_t       lock;           /* Held while `cur` changes, see playlist_reader_lock() */
+    playlist_track_t        cur;
+    playlist_track_t        next;
+    bool                    next_tried;
+    int                     prefetch_margin;
+    playlist_reader_ops_t   ops;
+    playlist_reader_track_cb on_track;
+    void                    *track_ctx;
+    uint32_t                seek;           /* File offset the next open of the uri starts at, 0 for the audio start */
+    char                    uri[PLAYLIST_URI_LEN];
+} playlist_reader_t;
+
+static void track_close(playlist_track_t *track)
+{
+    if (track->fd >= 0) {
+        close(track->fd);
+        track->fd = -1;
+    }
+}
+
+/*
+ * Open a track and pre-read its first block, the header is only probed when `known` is NULL.
+ * Reading starts at `seek` when it falls inside the audio data, at the audio start otherwise.
+ */
+static esp_err_t track_open(playlist_track_t *track, const char *uri, const mp3_info_t *known, uint32_t seek)
+{
+    /* Same mapping as fatfs_stream, "file://sdcard/a.mp3" is opened as "/sdcard/a.mp3" */
+    const char *path = strstr(uri, "/sdcard");
+    if (path == NULL) {
+        path = uri;
+    }
+    track->fd = open(path, O_RDONLY);
+    if (track->fd < 0) {
+        ESP_LOGE(TAG, "Failed to open %s", path);
+        return ESP_FAIL;
+    }
+    if (known) {
+        track->info = *known;
+        track->parsed = true;
+    } else {
+        struct stat st;
+        if (fstat(track->fd, &st) != 0) {
+            goto _open_failed;
+        }
+        track->parsed = media_probe(track->fd, path, st.st_size, track->head, PLAYLIST_HEAD_LEN,
+                                    &track->info, NULL, 0) == 0;
+    }
+    track->end = track->info.audio_end;
+    uint32_t start = track->info.audio_start;
+    /* A FLAC decoder needs the stream header, PCM is entered on a frame boundary */
+    if (seek > start && seek < track->end && track->info.format != MEDIA_FORMAT_FLAC) {
+        uint32_t align = media_probe_block_align(&track->info);
+        start += (seek - start) / align * align;
+    }
+    if (lseek(track->fd, start, SEEK_SET) < 0) {
+        goto _open_failed;
+    }
+    /* A short file must not hand its ID3v1 tag or trailing chunks to the decoder, nor leave pos past end */
+    int n = start < track->end ? read(track->fd, track->head, MIN(PLAYLIST_HEAD_LEN, track->end - start)) : 0;
+    if (n < 0) {
+        goto _open_failed;
+    }
+    track->head_pos = 0;
+    track->head_len = n;
+    track->pos = start + n;
+    return ESP_OK;
+
+_open_failed:
+    ESP_LOGE(TAG, "Failed to read %s", path);
+    track_close(track);
+    return ESP_FAIL;
+}
+
+static int track_read(playlist_track_t *track, char *buffer, int len)
+{
+    if (track->head_pos < track->head_len) {
+        int n = track->head_len - track->head_pos;
+        n = n < len ? n : len;
+        memcpy(buffer, track->head + track->head_pos, n);
+        track->head_pos += n;
+        return n;
+    }
+    if (track->pos >= track->end) {
+        return 0;
+    }
+    int want = track->end - track->pos;
+    want = want < len ? want : len;
+    int n = read(track->fd, buffer, want);
+    if (n > 0) {
+        track->pos += n;
+    }
+    return n;
+}
+
+/* Open the next entry once the playing one is close to its end */
+static void playlist_prefetch(playlist_reader_t *reader)
+{
+    playlist_track_t *cur = &reader->cur;
+    if (reader->next_tried || reader->ops.peek_next == NULL
+        || cur->end - cur->pos > reader->prefetch_margin) {
+        return;
+    }
+    reader->next_tried = true;
+    if (!cur->parsed || cur->info.frames == 0) {
+        ESP_LOGI(TAG, "Track length unknown, no gapless transition");
+        return;
+    }
+    mp3_info_t info = { 0 };
+    if (!reader->ops.peek_next(reader->ops.ctx, reader->uri, sizeof(reader->uri), &info)) {
+        return;
+    }
+    playlist_track_t *next = &reader->next;
+    if (track_open(next, reader->uri, info.samples_per_frame ? &info : NULL, 0) != ESP_OK) {
+        return;
+    }
+    /* Every FLAC file is a stream of its own, the decoder does not take a second header mid-stream */
+    if (!next->parsed || next->info.format != cur->info.format || next->info.format == MEDIA_FORMAT_FLAC
+        || next->info.sample_rate != cur->info.sample_rate || next->info.channels != cur->info.channels
+        || next->info.bits != cur->info.bits) {
+        ESP_LOGI(TAG, "Format changes at %s, no gapless transition", reader->uri);
+        track_close(next);
+        return;
+    }
+    ESP_LOGI(TAG, "Prefetched %s", reader->uri);
+}
+
+/* Continue with the prefetched entry, the head buffers are swapped along with the tracks */
+static bool playlist_take_next(playlist_reader_t *reader)
+{
+    if (reader->next.fd < 0) {
+        return false;
+    }
+    /* The advance is in the lock too, so the playlist's current entry and `cur` change as one */
+    xSemaphoreTakeRecursive(reader->lock, portMAX_DELAY);
+    track_close(&reader->cur);
+    playlist_track_t done = reader->cur;
+    reader->cur = reader->next;
+    reader->next = done;
+    reader->next_tried = false;
+    if (reader->ops.advance) {
+        reader->ops.advance(reader->ops.ctx);
+    }
+    xSemaphoreGiveRecursive(reader->lock);
+    if (reader->on_track) {
+        reader->on_track(reader->track_ctx, &reader->cur.info, true);
+    }
+    ESP_LOGI(TAG, "Gapless transition to %s", reader->uri);
+    return true;
+}
+
+static esp_err_t _playlist_reader_open(audio_element_handle_t self)
+{
+    playlist_reader_t *reader = (playlist_reader_t *)audio_element_getdata(self);
+    const char *uri = audio_element_get_uri(self);
+    AUDIO_NULL_CHECK(TAG, uri, return ESP_FAIL);
+    if (reader->cur.fd >= 0) {
+        /* Resumed after a pause, the track is still open */
+        return ESP_OK;
+    }
+    mp3_info_t info;
+    bool known = reader->ops.lookup && reader->ops.lookup(reader->ops.ctx, uri, &info);
+    uint32_t seek = reader->seek;
+    reader->seek = 0;
+    xSemaphoreTakeRecursive(reader->lock, portMAX_DELAY);
+    esp_err_t ret = track_open(&reader->cur, uri, known ? &info : NULL, seek);
+    xSemaphoreGiveRecursive(reader->lock);
+    if (ret != ESP_OK) {
+        return ESP_FAIL;
+    }
+    reader->next_tried = false;
+    audio_element_set_total_bytes(self, reader->cur.end);
+    bool resumed = reader->cur.pos - reader->cur.head_len != reader->cur.info.audio_start;
+    if (resumed) {
+        ESP_LOGI(TAG, "Resumed %s at byte %u", uri, reader->cur.pos - reader->cur.head_len);
+    }
+    if (reader->cur.parsed && media_format_is_pcm(reader->cur.info.format)) {
+        /* No decoder behind the reader, it reports the format itself */
+        audio_element_set_music_info(self, reader->cur.info.sample_rate, reader->cur.info.channels, reader->cur.info.bits);
+        audio_element_report_info(self);
+    }
+    if (reader->on_track) {
+        /* The delay and padding trim counts from the first frame, a resumed track is played as it comes */
+        reader->on_track(reader->track_ctx, (reader->cur.parsed && !resumed) ? &reader->cur.info : NULL, false);
+    }
+    return ESP_OK;
+}
+
+static int _playlist_reader_read(audio_element_handle_t self, char *buffer, int len, TickType_t ticks_to_wait, void *context)
+{
+    playlist_reader_t *reader = (playlist_reader_t *)audio_element_getdata(self);
+    xSemaphoreTakeRecursive(reader->lock, portMAX_DELAY);
+    int rlen = track_read(&reader->cur, buffer, len);
+    xSemaphoreGiveRecursive(reader->lock);
+    if (rlen == 0 && playlist_take_next(reader)) {
+        xSemaphoreTakeRecursive(reader->lock, portMAX_DELAY);
+        rlen = track_read(&reader->cur, buffer, len);
+        xSemaphoreGiveRecursive(reader->lock);
+    }
+    if (rlen < 0) {
+        ESP_LOGE(TAG, "Read failed, %d", rlen);
+        return ESP_FAIL;
+    }
+    if (rlen == 0) {
+        ESP_LOGW(TAG, "No more data");
+        return 0;
+    }
+    audio_element_update_byte_pos(self, rlen);
+    playlist_prefetch(reader);
+    return rlen;
+}
+
+static int _playlist_reader_process(audio_element_handle_t self, char *in_buffer, int in_len)
+{
+    int r_size = audio_element_input(self, in_buffer, in_len);
+    int w_size = 0;
+    if (r_size > 0) {
+        w_size = audio_element_output(self, in_buffer, r_size);
+    } else {
+        w_size = r_size;
+    }
+    return w_size;
+}
+
+static esp_err_t _playlist_reader_close(audio_element_handle_t self)
+{
+    playlist_reader_t *reader = (playlist_reader_t *)audio_element_getdata(self);
+    if (AEL_STATE_PAUSED != audio_element_get_state(self)) {
+        xSemaphoreTakeRecursive(reader->lock, portMAX_DELAY);
+        track_close(&reader->cur);
+        xSemaphoreGiveRecursive(reader->lock);
+        track_close(&reader->next);
+        audio_element_report_pos(self);
+        audio_element_set_byte_pos(self, 0);
+    }
+    return ESP_OK;
+}
+
+static esp_err_t _playlist_reader_destroy(audio_element_handle_t self)
+{
+    playlist_reader_t *reader = (playlist_reader_t *)audio_element_getdata(self);
+    track_close(&reader->cur);
+    track_close(&reader->next);
+    mem_policy_free(reader->cur.head);
+    mem_policy_free(reader->next.head);
+    vSemaphoreDelete(reader->lock);
+    audio_free(reader);
+    return ESP_OK;
+}
+
+esp_err_t playlist_reader_set_playlist(audio_element_handle_t self, const playlist_reader_ops_t *ops)
+{
+    playlist_reader_t *reader = (playlist_reader_t *)audio_element_getdata(self);
+    if (ops) {
+        reader->ops = *ops;
+    } else {
+        memset(&reader->ops, 0, sizeof(reader->ops));
+    }
+    return ESP_OK;
+}
+
+audio_element_handle_t playlist_reader_init(playlist_reader_cfg_t *config)
+{
+    AUDIO_NULL_CHECK(TAG, config, return NULL);
+    playlist_reader_t *reader = audio_calloc(1, sizeof(playlist_reader_t));
+    AUDIO_MEM_CHECK(TAG, reader, return NULL);
+    reader->cur.fd = -1;
+    reader->next.fd = -1;
+    reader->cur.head = mem_policy_malloc(MEM_BULK, PLAYLIST_HEAD_LEN);
+    reader->next.head = mem_policy_malloc(MEM_BULK, PLAYLIST_HEAD_LEN);
+    AUDIO_MEM_CHECK(TAG, reader->cur.head && reader->next.head, goto _reader_init_failed);
+    reader->lock = xSemaphoreCreateRecursiveMutex();
+    AUDIO_MEM_CHECK(TAG, reader->lock, goto _reader_init_failed);
+    reader->prefetch_margin = config->prefetch_margin;
+    reader->on_track = config->on_track;
+    reader->track_ctx = config->track_ctx;
+
+    audio_element_cfg_t cfg = DEFAULT_AUDIO_ELEMENT_CONFIG();
+    cfg.open = _playlist_reader_open;
+    cfg.close = _playlist_reader_close;
+    cfg.process = _playlist_reader_process;
+    cfg.read = _playlist_reader_read;
+    cfg.destroy = _playlist_reader_destroy;
+    cfg.buffer_len = config->buffer_len;
+    cfg.task_stack = config->task_stack;
+    cfg.task_prio = config->task_prio;
+    cfg.task_core = config->task_core;
+    cfg.out_rb_size = config->out_rb_size;
+    cfg.stack_in_ext = config->stack_in_ext;
+    cfg.tag = "file";
+
+    audio_element_handle_t el = audio_element_init(&cfg);
+    AUDIO_MEM_CHECK(TAG, el, goto _reader_init_failed);
+    audio_element_setdata(el, reader);
+    return el;
+
+_reader_init_failed:
+    if (reader->lock) {
+        vSemaphoreDelete(reader->lock);
+    }
+    mem_policy_free(reader->cur.head);
+    mem_policy_free(reader->next.head);
+    audio_free(reader);
+    return NULL;
+}
+
+void playlist_reader_seek_once(audio_element_handle_t self, uint32_t offset)
+{
+    playlist_reader_t *reader = (playlist_reader_t *)audio_element_getdata(self);
+    reader->seek = offset;
+}
+
+uint32_t playlist_reader_get_offset(audio_element_handle_t self)
+{
+    playlist_reader_t *reader = (playlist_reader_t *)audio_element_getdata(self);
+    xSemaphoreTakeRecursive(reader->lock, portMAX_DELAY);
+    playlist_track_t cur = reader->cur;
+    xSemaphoreGiveRecursive(reader->lock);
+    if (cur.fd < 0) {
+        return 0;
+    }
+    /* Leave out what is read ahead: the unread head and the output ringbuffer */
+    uint32_t pending = cur.head_len - cur.head_pos;
+    ringbuf_handle_t out_rb = audio_element_get_output_ringbuf(self);
+    if (out_rb) {
+        pending += rb_bytes_filled(out_rb);
+    }
+    /* Right after a gapless switch the ringbuffer still holds the end of the previous track */
+    if (pending >= cur.pos || cur.pos - pending < cur.info.audio_start) {
+        return cur.info.audio_start;
+    }
+    return cur.pos - pending;
+}
+
+void playlist_reader_lock(audio_element_handle_t self)
+{
+    playlist_reader_t *reader = (playlist_reader_t *)audio_element_getdata(self);
+    xSemaphoreTakeRecursive(reader->lock, portMAX_DELAY);
+}
+
+void playlist_reader_unlock(audio_element_handle_t self)
+{
+    playlist_reader_t *reader = (playlist_reader_t *)audio_element_getdata(self);
+    xSemaphoreGiveRecursive(reader->lock);
+}
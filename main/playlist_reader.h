@@ -0,0 +1,112 @@
+#ifndef __PLAYLIST_READER_H__
+#define __PLAYLIST_READER_H__
+
+#include "audio_element.h"
+#include "mp3_info.h"
+
+/*
+ * SD card reader that plays a playlist back to back.
+ *
+ * Near the end of a track it opens the next playlist entry and reads its first
+ * block ahead of time. When the current file runs out the reader carries on
+ * with the prefetched one inside the same run, so the decoder sees one
+ * continuous stream and the output never drains between tracks. The ID3 tags
+ * and the Xing/Info frame are kept away from the decoder and every opened
+ * track is reported with its header info, so the encoder delay and padding
+ * can be trimmed further down the chain. Headers the playlist already knows
+ * are used as they are, the others are probed when the file is opened.
+ *
+ * Tracks are only chained when the playing one has a known length (Xing/Info
+ * tag) and the next one has the same format; otherwise the reader finishes as
+ * a plain file reader would. FLAC files are never chained.
+ *
+ * WAV and raw PCM tracks have no decoder behind the reader: their audio data
+ * goes to the DSP element as it is read, and the reader reports the music info
+ * of such a track when it opens it.
+ */
+
+typedef struct {
+    /* Copy the uri of the entry after the playing one, return false when nothing follows.
+       Leave `info` zeroed when the header of the entry is not known in advance */
+    bool (*peek_next)(void *ctx, char *uri, int len, mp3_info_t *info);
+    /* The prefetched entry took over from the finished one */
+    void (*advance)(void *ctx);
+    /* Header info of `uri` known in advance, may be NULL */
+    bool (*lookup)(void *ctx, const char *uri, mp3_info_t *info);
+    void *ctx;
+} playlist_reader_ops_t;
+
+typedef void (*playlist_reader_track_cb)(void *ctx, const mp3_info_t *info, bool chained);
+
+typedef struct {
+    int                         out_rb_size;
+    int                         task_stack;
+    int                         task_core;
+    int                         task_prio;
+    bool                        stack_in_ext;
+    int                         buffer_len;
+    int                         prefetch_margin;    /* Bytes left in the current file when the next one is opened */
+    playlist_reader_track_cb    on_track;           /* Called from the reader task for every opened track */
+    void                        *track_ctx;
+} playlist_reader_cfg_t;
+
+#define PLAYLIST_READER_TASK_STACK      (3 * 1024)
+#define PLAYLIST_READER_TASK_CORE       (0)
+#define PLAYLIST_READER_TASK_PRIO       (4)
+#define PLAYLIST_READER_RINGBUFFER      (8 * 1024)
+#define PLAYLIST_READER_BUFFER_LEN      (2048)
+#define PLAYLIST_READER_PREFETCH        (64 * 1024)
+
+#define DEFAULT_PLAYLIST_READER_CONFIG() {              \
+    .out_rb_size        = PLAYLIST_READER_RINGBUFFER,   \
+    .task_stack         = PLAYLIST_READER_TASK_STACK,   \
+    .task_core          = PLAYLIST_READER_TASK_CORE,    \
+    .task_prio          = PLAYLIST_READER_TASK_PRIO,    \
+    .stack_in_ext       = false,                        \
+    .buffer_len         = PLAYLIST_READER_BUFFER_LEN,   \
+    .prefetch_margin    = PLAYLIST_READER_PREFETCH,     \
+}
+
+/**
+ * @brief Create the playlist reader, the first track is the element uri
+ */
+audio_element_handle_t playlist_reader_init(playlist_reader_cfg_t *config);
+
+/**
+ * @brief Set the playlist the next tracks are taken from, NULL plays single files
+ *
+ * Only call it while the reader is stopped.
+ */
+esp_err_t playlist_reader_set_playlist(audio_element_handle_t self, const playlist_reader_ops_t *ops);
+
+/**
+ * @brief Start the next track opened from the element uri `offset` bytes into the file, once
+ *
+ * Used to resume a track. The decoder finds the next frame from there; the
+ * track is reported without its header info, so nothing is trimmed from it.
+ * An offset outside the audio data of the file is ignored.
+ */
+void playlist_reader_seek_once(audio_element_handle_t self, uint32_t offset);
+
+/**
+ * @brief File offset of the first byte not yet taken by the decoder, 0 when no track is open
+ *
+ * Meant to be polled from another task, the value may lag the reader by one block.
+ * Call it between playlist_reader_lock() and playlist_reader_unlock() to pair it
+ * with the playlist's current entry.
+ */
+uint32_t playlist_reader_get_offset(audio_element_handle_t self);
+
+/**
+ * @brief Hold the playing track: no track change, and so no playlist advance, until playlist_reader_unlock()
+ *
+ * The lock is recursive, playlist_reader_get_offset() may be called with it held.
+ */
+void playlist_reader_lock(audio_element_handle_t self);
+
+/**
+ * @brief Let the reader change tracks again
+ */
+void playlist_reader_unlock(audio_element_handle_t self);
+
+#endif
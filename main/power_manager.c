@@ -0,0 +1,214 @@
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "sdkconfig.h"
+#if CONFIG_PM_ENABLE
+#include "esp_pm.h"
+#endif
+#include "power_manager.h"
+
+static const char *TAG = "POWER_MANAGER";
+
+static const char *s_state_names[POWER_STATE_MAX] = {
+    [POWER_STATE_IDLE]      = "idle",
+    [POWER_STATE_SILENT]    = "silent",
+    [POWER_STATE_PLAYING]   = "playing",
+};
+
+typedef struct {
+    SemaphoreHandle_t       lock;
+    power_manager_cfg_t     cfg;
+    bool                    amp_allowed;
+    bool                    amp_on;
+    bool                    playing;
+    power_activity_t        activity;
+    power_state_t           state;
+    int64_t                 since_us;       /* When the current state was entered */
+    power_manager_stats_t   stats;
+#if CONFIG_PM_ENABLE
+    esp_pm_lock_handle_t    cpu_lock;
+    esp_pm_lock_handle_t    sleep_lock;
+    bool                    locked;
+#endif
+} power_manager_t;
+
+static power_manager_t s_power;
+
+static power_state_t power_state_of(const power_manager_t *pm)
+{
+    if (!pm->playing || pm->activity == POWER_ACTIVITY_STARVED) {
+        return POWER_STATE_IDLE;
+    }
+    return pm->activity == POWER_ACTIVITY_SILENCE ? POWER_STATE_SILENT : POWER_STATE_PLAYING;
+}
+
+/* Bring the amplifier and the locks in line with the inputs, the state lock is held */
+static void power_update(power_manager_t *pm)
+{
+    power_state_t state = power_state_of(pm);
+    if (state != pm->state) {
+        int64_t now = esp_timer_get_time();
+        pm->stats.state_us[pm->state] += now - pm->since_us;
+        pm->since_us = now;
+        ESP_LOGD(TAG, "%s -> %s", s_state_names[pm->state], s_state_names[state]);
+        pm->state = state;
+    }
+#if CONFIG_PM_ENABLE
+    bool locked = state != POWER_STATE_IDLE;
+    if (locked != pm->locked && pm->cpu_lock) {
+        if (locked) {
+            esp_pm_lock_acquire(pm->cpu_lock);
+            esp_pm_lock_acquire(pm->sleep_lock);
+        } else {
+            esp_pm_lock_release(pm->sleep_lock);
+            esp_pm_lock_release(pm->cpu_lock);
+        }
+        pm->locked = locked;
+    }
+#endif
+    bool amp_on = pm->amp_allowed && state == POWER_STATE_PLAYING;
+    if (amp_on != pm->amp_on) {
+        if (pm->cfg.set_amp) {
+            pm->cfg.set_amp(pm->cfg.amp_ctx, amp_on);
+        }
+        pm->amp_on = amp_on;
+        pm->stats.amp_switches += amp_on;
+    }
+}
+
+esp_err_t power_manager_init(const power_manager_cfg_t *config)
+{
+    power_manager_t *pm = &s_power;
+    if (config == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (pm->lock) {
+        return ESP_OK;
+    }
+    pm->cfg = *config;
+    pm->lock = xSemaphoreCreateMutex();
+    if (pm->lock == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    pm->state = POWER_STATE_IDLE;
+    pm->since_us = esp_timer_get_time();
+    if (pm->cfg.set_amp) {
+        pm->cfg.set_amp(pm->cfg.amp_ctx, false);
+    }
+
+#if CONFIG_PM_ENABLE
+    esp_pm_config_esp32_t pm_config = {
+        .max_freq_mhz = config->max_freq_mhz,
+        .min_freq_mhz = config->min_freq_mhz,
+        .light_sleep_enable = config->light_sleep,
+    };
+    esp_err_t ret = esp_pm_configure(&pm_config);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "No frequency scaling (%s), only the amplifier is managed", esp_err_to_name(ret));
+        return ESP_OK;
+    }
+    if (esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "audio_cpu", &pm->cpu_lock) != ESP_OK
+        || esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "audio_sleep", &pm->sleep_lock) != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create the power locks");
+        if (pm->cpu_lock) {
+            esp_pm_lock_delete(pm->cpu_lock);
+            pm->cpu_lock = NULL;
+        }
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_LOGI(TAG, "CPU at %d MHz while audio runs, down to %d MHz%s while idle", config->max_freq_mhz,
+             config->min_freq_mhz, config->light_sleep ? " and light sleep" : "");
+#else
+    ESP_LOGI(TAG, "CONFIG_PM_ENABLE is off, only the amplifier is managed");
+#endif
+    return ESP_OK;
+}
+
+void power_manager_allow_amp(bool allow)
+{
+    power_manager_t *pm = &s_power;
+    if (pm->lock == NULL) {
+        return;
+    }
+    xSemaphoreTake(pm->lock, portMAX_DELAY);
+    pm->amp_allowed = allow;
+    power_update(pm);
+    xSemaphoreGive(pm->lock);
+}
+
+void power_manager_set_playing(bool playing)
+{
+    power_manager_t *pm = &s_power;
+    if (pm->lock == NULL) {
+        return;
+    }
+    xSemaphoreTake(pm->lock, portMAX_DELAY);
+    pm->playing = playing;
+    if (playing) {
+        /* A run starts out as signal, the output stage reports otherwise once it knows */
+        pm->activity = POWER_ACTIVITY_SIGNAL;
+    }
+    power_update(pm);
+    xSemaphoreGive(pm->lock);
+}
+
+void power_manager_set_activity(power_activity_t activity)
+{
+    power_manager_t *pm = &s_power;
+    if (pm->lock == NULL) {
+        return;
+    }
+    xSemaphoreTake(pm->lock, portMAX_DELAY);
+    pm->activity = activity;
+    power_update(pm);
+    xSemaphoreGive(pm->lock);
+}
+
+power_state_t power_manager_state(void)
+{
+    return s_power.state;
+}
+
+void power_manager_get_stats(power_manager_stats_t *stats)
+{
+    power_manager_t *pm = &s_power;
+    memset(stats, 0, sizeof(*stats));
+    if (pm->lock == NULL) {
+        return;
+    }
+    xSemaphoreTake(pm->lock, portMAX_DELAY);
+    *stats = pm->stats;
+    stats->state_us[pm->state] += esp_timer_get_time() - pm->since_us;
+    stats->state = pm->state;
+    xSemaphoreGive(pm->lock);
+}
+
+void power_manager_log(const char *when)
+{
+    if (s_power.lock == NULL) {
+        return;
+    }
+    power_manager_stats_t stats;
+    power_manager_get_stats(&stats);
+    int64_t total_us = 0;
+    for (int i = 0; i < POWER_STATE_MAX; i++) {
+        total_us += stats.state_us[i];
+    }
+    total_us = total_us > 0 ? total_us : 1;
+    ESP_LOGI(TAG, "%s: %s now, idle %d s (%d%%), silent %d s (%d%%), playing %d s (%d%%), amplifier on %u times",
+             when, s_state_names[stats.state],
+             (int)(stats.state_us[POWER_STATE_IDLE] / 1000000), (int)(stats.state_us[POWER_STATE_IDLE] * 100 / total_us),
+             (int)(stats.state_us[POWER_STATE_SILENT] / 1000000), (int)(stats.state_us[POWER_STATE_SILENT] * 100 / total_us),
+             (int)(stats.state_us[POWER_STATE_PLAYING] / 1000000), (int)(stats.state_us[POWER_STATE_PLAYING] * 100 / total_us),
+             stats.amp_switches);
+}
+
+const char *power_manager_state_name(power_state_t state)
+{
+    if (state < POWER_STATE_IDLE || state >= POWER_STATE_MAX) {
+        return "unknown";
+    }
+    return s_state_names[state];
+}
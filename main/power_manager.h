@@ -0,0 +1,99 @@
+#ifndef __POWER_MANAGER_H__
+#define __POWER_MANAGER_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+/*
+ * One owner for the amplifier enable pin and the CPU power locks.
+ *
+ * The speaker is in one of three states. PLAYING: the pipeline runs and the
+ * output carries signal, the amplifier is on and the CPU is held at its full
+ * clock with light sleep blocked. SILENT: the pipeline runs but the output
+ * stage found nothing to hear, the amplifier is off and the locks stay held
+ * so the signal can come back at any block. IDLE: nothing runs, or the source
+ * delivers nothing; the amplifier is off and the locks are released, so with
+ * CONFIG_PM_ENABLE the CPU scales down and the idle task enters light sleep.
+ *
+ * The amplifier is only switched on when speaker_control allows it, a muted
+ * speaker stays off whatever plays. The time spent in every state is kept
+ * for power_manager_log().
+ */
+
+typedef enum {
+    POWER_STATE_IDLE = 0,
+    POWER_STATE_SILENT,
+    POWER_STATE_PLAYING,
+    POWER_STATE_MAX,
+} power_state_t;
+
+typedef enum {
+    POWER_ACTIVITY_SIGNAL = 0,
+    POWER_ACTIVITY_SILENCE,     /* Output below the silence level */
+    POWER_ACTIVITY_STARVED,     /* The source delivers nothing */
+} power_activity_t;
+
+typedef struct {
+    void    (*set_amp)(void *ctx, bool on);     /* Drives the amplifier enable, called with the state lock held */
+    void    *amp_ctx;
+    int     max_freq_mhz;
+    int     min_freq_mhz;                       /* Clock the CPU may drop to while idle */
+    bool    light_sleep;                        /* Let the idle task enter light sleep while idle */
+} power_manager_cfg_t;
+
+typedef struct {
+    int64_t     state_us[POWER_STATE_MAX];      /* Time spent in every state since the init */
+    uint32_t    amp_switches;                   /* Times the amplifier was switched on */
+    power_state_t state;
+} power_manager_stats_t;
+
+#if CONFIG_SPEAKER_PM_LIGHT_SLEEP
+#define POWER_MANAGER_LIGHT_SLEEP   (true)
+#else
+#define POWER_MANAGER_LIGHT_SLEEP   (false)
+#endif
+
+#define DEFAULT_POWER_MANAGER_CONFIG() {                        \
+    .set_amp        = NULL,                                     \
+    .amp_ctx        = NULL,                                     \
+    .max_freq_mhz   = CONFIG_ESP32_DEFAULT_CPU_FREQ_MHZ,        \
+    .min_freq_mhz   = CONFIG_SPEAKER_PM_MIN_FREQ_MHZ,           \
+    .light_sleep    = POWER_MANAGER_LIGHT_SLEEP,                \
+}
+
+/**
+ * @brief Configure dynamic frequency scaling and take the amplifier to off
+ *
+ * Without CONFIG_PM_ENABLE only the amplifier is managed. Every other call does nothing before the init.
+ */
+esp_err_t power_manager_init(const power_manager_cfg_t *config);
+
+/**
+ * @brief Whether the amplifier may be on at all, false mutes the speaker
+ */
+void power_manager_allow_amp(bool allow);
+
+/**
+ * @brief The pipeline runs, false when it is stopped or paused
+ */
+void power_manager_set_playing(bool playing);
+
+/**
+ * @brief What the output stage finds in the programme, safe to call from its task
+ */
+void power_manager_set_activity(power_activity_t activity);
+
+power_state_t power_manager_state(void);
+
+void power_manager_get_stats(power_manager_stats_t *stats);
+
+/**
+ * @brief Log the share of time spent in every state, `when` names the moment
+ */
+void power_manager_log(const char *when);
+
+const char *power_manager_state_name(power_state_t state);
+
+#endif
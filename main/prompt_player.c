@@ -0,0 +1,126 @@
+#include <math.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "esp_log.h"
+#include "sdkconfig.h"
+#include "prompt_player.h"
+
+#define PROMPT_QUEUE_LEN        (4)
+#define PROMPT_UNITY_Q15        (32768)
+#define PROMPT_RAMP_MS          (20)
+
+static const char *TAG = "PROMPT_PLAYER";
+
+typedef struct {
+    QueueHandle_t       queue;
+    audio_tone_pcm_t    tone;
+    uint32_t            pos_q16;
+    int32_t             duck_gain;      /* Current programme gain, Q15 */
+    int32_t             duck_level;     /* Programme gain while a prompt plays, Q15 */
+    volatile bool       playing;
+    volatile bool       stop_req;
+} prompt_player_t;
+
+static prompt_player_t s_prompt = {
+    .duck_gain = PROMPT_UNITY_Q15,
+    .duck_level = PROMPT_UNITY_Q15,
+};
+
+esp_err_t prompt_player_init(void)
+{
+    if (s_prompt.queue) {
+        return ESP_OK;
+    }
+    esp_err_t ret = audio_tone_pcm_map();
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    s_prompt.queue = xQueueCreate(PROMPT_QUEUE_LEN, sizeof(tone_type_t));
+    if (s_prompt.queue == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    s_prompt.duck_level = (int32_t)(PROMPT_UNITY_Q15 * powf(10.0f, -CONFIG_PROMPT_DUCK_DB / 20.0f));
+    ESP_LOGI(TAG, "Prompts duck the programme by %d dB", CONFIG_PROMPT_DUCK_DB);
+    return ESP_OK;
+}
+
+esp_err_t prompt_player_play(tone_type_t tone)
+{
+    if (s_prompt.queue == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (tone < 0 || tone >= TONE_TYPE_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (xQueueSend(s_prompt.queue, &tone, 0) != pdTRUE) {
+        ESP_LOGW(TAG, "Prompt queue full, drop tone %d", tone);
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+void prompt_player_stop(void)
+{
+    if (s_prompt.queue) {
+        xQueueReset(s_prompt.queue);
+    }
+    s_prompt.stop_req = true;
+}
+
+bool prompt_player_is_active(void)
+{
+    return s_prompt.playing || (s_prompt.queue && uxQueueMessagesWaiting(s_prompt.queue) > 0);
+}
+
+bool prompt_player_mix(int16_t *buf, int frames, int channels, int sample_rate)
+{
+    prompt_player_t *p = &s_prompt;
+    if (p->stop_req) {
+        p->stop_req = false;
+        p->playing = false;
+    }
+    if (!p->playing && p->queue) {
+        tone_type_t next;
+        if (xQueueReceive(p->queue, &next, 0) == pdTRUE && audio_tone_pcm_get(next, &p->tone) == ESP_OK) {
+            p->pos_q16 = 0;
+            p->playing = true;
+        }
+    }
+    if (!p->playing && p->duck_gain == PROMPT_UNITY_Q15) {
+        return false;
+    }
+    if (sample_rate <= 0 || channels <= 0) {
+        return false;
+    }
+
+    int32_t target = p->playing ? p->duck_level : PROMPT_UNITY_Q15;
+    int32_t ramp = (PROMPT_UNITY_Q15 - p->duck_level) / (sample_rate * PROMPT_RAMP_MS / 1000) + 1;
+    uint32_t step_q16 = (uint32_t)(((uint64_t)p->tone.sample_rate << 16) / sample_rate);
+
+    for (int i = 0; i < frames; i++) {
+        if (p->duck_gain > target) {
+            p->duck_gain = (p->duck_gain - ramp < target) ? target : p->duck_gain - ramp;
+        } else if (p->duck_gain < target) {
+            p->duck_gain = (p->duck_gain + ramp > target) ? target : p->duck_gain + ramp;
+        }
+        int32_t prompt = 0;
+        if (p->playing) {
+            uint32_t idx = p->pos_q16 >> 16;
+            if (idx + 1 < p->tone.samples) {
+                int32_t s0 = p->tone.pcm[idx];
+                int32_t s1 = p->tone.pcm[idx + 1];
+                prompt = s0 + (((s1 - s0) * (int32_t)((p->pos_q16 & 0xffff) >> 1)) >> 15);
+                p->pos_q16 += step_q16;
+            } else {
+                p->playing = false;
+                target = PROMPT_UNITY_Q15;
+            }
+        }
+        for (int ch = 0; ch < channels; ch++) {
+            int32_t v = ((buf[ch] * p->duck_gain) >> 15) + prompt;
+            buf[ch] = v > INT16_MAX ? INT16_MAX : (v < INT16_MIN ? INT16_MIN : v);
+        }
+        buf += channels;
+    }
+    return true;
+}
@@ -0,0 +1,46 @@
+#ifndef __PROMPT_PLAYER_H__
+#define __PROMPT_PLAYER_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "audio_tone_pcm.h"
+
+/*
+ * Prompt tones mixed over the running programme.
+ *
+ * The tones are read in place from the mapped flash_tone partition and mixed by
+ * the output stage, which ducks the programme while a prompt is playing.
+ */
+
+/**
+ * @brief Map the tone partition and create the request queue
+ */
+esp_err_t prompt_player_init(void);
+
+/**
+ * @brief Queue a prompt, it starts on the next block rendered by the output stage
+ */
+esp_err_t prompt_player_play(tone_type_t tone);
+
+/**
+ * @brief Drop the playing prompt and everything queued behind it
+ */
+void prompt_player_stop(void);
+
+/**
+ * @brief True while a prompt is playing or queued
+ */
+bool prompt_player_is_active(void);
+
+/**
+ * @brief Mix the active prompt into a block of interleaved 16-bit frames
+ *
+ * Called from the output stage task only. The programme in `buf` is ducked while a prompt plays and ramped
+ * back afterwards, a block without prompt and at unity gain is left untouched.
+ *
+ * @return true when the block was modified
+ */
+bool prompt_player_mix(int16_t *buf, int frames, int channels, int sample_rate);
+
+#endif
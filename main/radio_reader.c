@@ -0,0 +1,808 @@
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_http_client.h"
+#include "audio_error.h"
+#include "audio_mem.h"
+#include "audio_element.h"
+#include "jitter_buffer.h"
+#include "mem_policy.h"
+#include "speaker_icy.h"
+#include "host_cache.h"
+#include "radio_reader.h"
+
+#define RADIO_SLOT_MAX              (4)     /* Two readers of a shared pool and two neighbours */
+#define RADIO_NO_STATION            (-1)
+#define RADIO_HTTP_BUFFER           (1024)
+#define RADIO_CONNECT_TIMEOUT_MS    (5000)
+#define RADIO_STANDBY_TIMEOUT_MS    (20)    /* A standby read never holds up the other neighbours for longer */
+#define RADIO_STANDBY_CHUNK         (1024)
+#define RADIO_STANDBY_IDLE          pdMS_TO_TICKS(20)
+#define RADIO_STANDBY_STALL_US      (5 * 1000 * 1000)
+#define RADIO_POLL_TIMEOUT_MS       (50)    /* The playing station is polled so the decoder is fed meanwhile */
+#define RADIO_STALL_US              (RADIO_CONNECT_TIMEOUT_MS * 1000LL)
+#define RADIO_WARM_START            (2048)  /* Buffered bytes a warm station starts playing with, no pre-roll */
+#define RADIO_IDLE                  pdMS_TO_TICKS(10)
+#define RADIO_MAX_REDIRECT          (3)
+#define RADIO_RECONNECT_MIN_MS      (500)   /* Wait after the first failed reconnect, doubled after each one */
+#define RADIO_RECONNECT_MAX_MS      (30000)
+
+static const char *TAG = "RADIO_READER";
+
+typedef struct {
+    SemaphoreHandle_t           lock;       /* Held while the slot does I/O or changes role */
+    esp_http_client_handle_t    client;
+    int                         station;    /* Index into the station list, RADIO_NO_STATION when free */
+    bool                        active;     /* Read by the element, the standby task leaves it alone */
+    uint8_t                     *buf;       /* Rolling buffer with the latest audio of a standby */
+    int                         head;
+    int                         len;
+    int64_t                     last_data_us;
+    int                         kbps;       /* From the icy-br header, 0 when not announced */
+    int                         metaint;    /* From the icy-metaint header, 0 without in-band metadata */
+    speaker_icy_t               icy;        /* Follows the metadata of the connection, standby or playing */
+    const char                  *url;       /* Of the last connect, what a reconnect goes back to */
+    volatile bool               lost;       /* The playing connection dropped, the standby task reconnects it */
+    int64_t                     lost_us;    /* Last data before the drop */
+    int64_t                     retry_us;   /* When the next reconnect is tried */
+    int                         backoff_ms; /* Wait after the next failed try */
+} radio_slot_t;
+
+/* The connections and the standby task, owned by one reader and possibly shared with a second one */
+typedef struct {
+    radio_slot_t        slots[RADIO_SLOT_MAX];
+    int                 slot_num;
+    const char *const   *urls;
+    int                 count;
+    int                 standby_num;
+    int                 standby_size;
+    int                 standby_stack;
+    int                 standby_prio;
+    int                 standby_core;
+    TaskHandle_t        task;
+    SemaphoreHandle_t   task_done;
+    volatile bool       quit;
+    volatile int        tuned;          /* Station the neighbours are picked around */
+    volatile bool       retarget;
+    radio_link_stats_t  link;           /* Drops and reconnects of the playing stations */
+} radio_pool_t;
+
+typedef struct {
+    radio_pool_t        *pool;
+    bool                own_pool;
+    radio_slot_t        *active;
+    jitter_buffer_handle_t  jb;         /* Between the playing station and the decoder */
+    bool                started;        /* Fed the decoder since it opened, so an empty ringbuffer is an underrun */
+    radio_title_cb      on_title;
+    void                *title_ctx;
+} radio_reader_t;
+
+static void slot_disconnect(radio_slot_t *slot)
+{
+    if (slot->client) {
+        /* Parked for the next connect to the host, with its TLS session */
+        host_cache_put(slot->client, slot->url);
+        slot->client = NULL;
+    }
+    slot->head = 0;
+    slot->len = 0;
+}
+
+/* A client that failed or dropped is not parked, its connection or TLS session may be dead or half open */
+static void slot_discard(radio_slot_t *slot)
+{
+    if (slot->client) {
+        esp_http_client_cleanup(slot->client);
+        slot->client = NULL;
+    }
+    slot->head = 0;
+    slot->len = 0;
+}
+
+/* What a connect learned, apart from the slot so the connect can run without holding its lock */
+typedef struct {
+    esp_http_client_handle_t    client;
+    int                         kbps;       /* From the icy-br header, 0 when not announced */
+    int                         metaint;    /* From the icy-metaint header, 0 without in-band metadata */
+} radio_conn_t;
+
+static esp_err_t radio_http_event(esp_http_client_event_t *evt)
+{
+    radio_conn_t *conn = (radio_conn_t *)evt->user_data;
+    if (evt->event_id != HTTP_EVENT_ON_HEADER || conn == NULL) {
+        return ESP_OK;
+    }
+    if (strcasecmp(evt->header_key, "icy-br") == 0) {
+        conn->kbps = atoi(evt->header_value);
+    } else if (strcasecmp(evt->header_key, "icy-metaint") == 0) {
+        conn->metaint = atoi(evt->header_value);
+    }
+    return ESP_OK;
+}
+
+static esp_err_t radio_connect(radio_conn_t *conn, const char *url)
+{
+    int64_t start_us = esp_timer_get_time();
+    esp_http_client_config_t cfg = {
+        .url = url,
+        .timeout_ms = RADIO_CONNECT_TIMEOUT_MS,
+        .buffer_size = RADIO_HTTP_BUFFER,
+        .event_handler = radio_http_event,
+        .user_data = conn,
+    };
+    memset(conn, 0, sizeof(*conn));
+    host_cache_conn_t cached;
+    host_cache_take(&cfg, &cached);
+    conn->client = cached.client;
+    AUDIO_MEM_CHECK(TAG, conn->client, return ESP_ERR_NO_MEM);
+    /* Ask for the stream title, the metadata is stripped out again before the audio is buffered */
+    esp_http_client_set_header(conn->client, "Icy-MetaData", "1");
+
+    int status = 0;
+    int64_t handshake_us = 0;
+    for (int i = 0; i <= RADIO_MAX_REDIRECT; i++) {
+        int64_t open_us = esp_timer_get_time();
+        esp_err_t ret = esp_http_client_open(conn->client, 0);
+        handshake_us += esp_timer_get_time() - open_us;
+        if (ret != ESP_OK) {
+            break;
+        }
+        esp_http_client_fetch_headers(conn->client);
+        status = esp_http_client_get_status_code(conn->client);
+        if (status != 301 && status != 302 && status != 307 && status != 308) {
+            break;
+        }
+        esp_http_client_set_redirection(conn->client);
+        esp_http_client_close(conn->client);
+    }
+    /* The headers are in, the conn may go out of scope before the client does */
+    esp_http_client_set_user_data(conn->client, NULL);
+    if (status != 200) {
+        ESP_LOGE(TAG, "Failed to connect %s, status %d", url, status);
+        esp_http_client_cleanup(conn->client);
+        conn->client = NULL;
+        return ESP_FAIL;
+    }
+    /* The handshake is TCP and TLS up to the request sent, redirects included */
+    ESP_LOGI(TAG, "Connected %s in %d ms: lookup %d ms, handshake %d ms%s, metadata every %d bytes", url,
+             (int)((esp_timer_get_time() - start_us) / 1000), cached.dns_ms, (int)(handshake_us / 1000),
+             cached.reused ? " with the cached session" : "", conn->metaint);
+    return ESP_OK;
+}
+
+/* Hand a connect that is no longer wanted to the host cache */
+static void radio_conn_drop(radio_conn_t *conn, const char *url)
+{
+    if (conn && conn->client) {
+        host_cache_put(conn->client, url);
+        conn->client = NULL;
+    }
+}
+
+/* Give the slot the client of a connect, with the slot's lock held */
+static void slot_install(radio_slot_t *slot, radio_conn_t *conn, const char *url)
+{
+    slot->client = conn->client;
+    conn->client = NULL;
+    slot->kbps = conn->kbps;
+    slot->metaint = conn->metaint;
+    slot->url = url;
+    slot->head = 0;
+    slot->len = 0;
+    slot->last_data_us = esp_timer_get_time();
+    speaker_icy_init(&slot->icy, slot->metaint);
+}
+
+static esp_err_t slot_connect(radio_slot_t *slot, const char *url)
+{
+    radio_conn_t conn;
+    if (radio_connect(&conn, url) != ESP_OK) {
+        return ESP_FAIL;
+    }
+    slot_install(slot, &conn, url);
+    return ESP_OK;
+}
+
+/* Keep the latest audio of a standby station, the oldest bytes are overwritten */
+static void slot_fill(radio_pool_t *pool, radio_slot_t *slot)
+{
+    int n = pool->standby_size - slot->head;
+    n = n < RADIO_STANDBY_CHUNK ? n : RADIO_STANDBY_CHUNK;
+    int rlen = esp_http_client_read(slot->client, (char *)slot->buf + slot->head, n);
+    int64_t now = esp_timer_get_time();
+    if (rlen > 0) {
+        /* A standby follows the metadata too, it has the title ready when it is tuned to */
+        int audio = speaker_icy_strip(&slot->icy, slot->buf + slot->head, rlen);
+        slot->head = (slot->head + audio) % pool->standby_size;
+        slot->len = (slot->len + audio > pool->standby_size) ? pool->standby_size : slot->len + audio;
+        slot->last_data_us = now;
+    } else if (rlen < 0 || now - slot->last_data_us > RADIO_STANDBY_STALL_US) {
+        /* Dropped or stalled, the standby task reconnects it on its next round */
+        ESP_LOGW(TAG, "Standby %s lost", pool->urls[slot->station]);
+        slot_discard(slot);
+    }
+}
+
+/* Hand the buffered audio of a promoted standby to the jitter buffer, oldest first */
+static void slot_hand_over(radio_reader_t *reader, radio_slot_t *slot, int64_t now_us)
+{
+    int size = reader->pool->standby_size;
+    while (slot->len > 0) {
+        int start = (slot->head - slot->len + size) % size;
+        int n = size - start;
+        n = n < slot->len ? n : slot->len;
+        int done = jitter_buffer_push(reader->jb, slot->buf + start, n, now_us);
+        slot->len -= done;
+        if (done < n) {
+            break;
+        }
+    }
+    slot->head = 0;
+    slot->len = 0;
+}
+
+/* A tune steps to a neighbour of the station that played, so those are looked at before the whole list */
+static int radio_station_of(radio_pool_t *pool, const char *uri)
+{
+    int cur = pool->tuned;
+    if (cur >= 0 && cur < pool->count) {
+        int near[3] = { (cur + 1) % pool->count, (cur + pool->count - 1) % pool->count, cur };
+        for (int i = 0; i < 3; i++) {
+            if (strcmp(pool->urls[near[i]], uri) == 0) {
+                return near[i];
+            }
+        }
+    }
+    for (int i = 0; i < pool->count; i++) {
+        if (strcmp(pool->urls[i], uri) == 0) {
+            return i;
+        }
+    }
+    return RADIO_NO_STATION;
+}
+
+static bool radio_wanted(radio_pool_t *pool, int station, int cur)
+{
+    if (station == RADIO_NO_STATION || cur == RADIO_NO_STATION || pool->count < 2) {
+        return false;
+    }
+    int next = (cur + 1) % pool->count;
+    int prev = (cur + pool->count - 1) % pool->count;
+    return station == next || (pool->standby_num > 1 && station == prev);
+}
+
+/* Point the standby slots at the neighbours of `cur`, slots already on a neighbour stay connected.
+   Runs in the standby task, so a slot that is still connecting never holds up the element */
+static void radio_retarget(radio_pool_t *pool, int cur)
+{
+    int wanted[2] = { RADIO_NO_STATION, RADIO_NO_STATION };
+    if (cur != RADIO_NO_STATION && pool->count > 1 && pool->standby_num > 0) {
+        wanted[0] = (cur + 1) % pool->count;
+        int prev = (cur + pool->count - 1) % pool->count;
+        if (pool->standby_num > 1 && prev != wanted[0]) {
+            wanted[1] = prev;
+        }
+    }
+    for (int i = 0; i < pool->slot_num; i++) {
+        radio_slot_t *slot = &pool->slots[i];
+        xSemaphoreTake(slot->lock, portMAX_DELAY);
+        if (slot->active) {
+            xSemaphoreGive(slot->lock);
+            continue;
+        }
+        if (radio_wanted(pool, slot->station, cur)) {
+            for (int w = 0; w < 2; w++) {
+                if (wanted[w] == slot->station) {
+                    wanted[w] = RADIO_NO_STATION;
+                }
+            }
+        } else {
+            slot_disconnect(slot);
+            slot->station = RADIO_NO_STATION;
+        }
+        xSemaphoreGive(slot->lock);
+    }
+    for (int i = 0; i < pool->slot_num; i++) {
+        radio_slot_t *slot = &pool->slots[i];
+        xSemaphoreTake(slot->lock, portMAX_DELAY);
+        for (int w = 0; w < 2 && !slot->active && slot->station == RADIO_NO_STATION; w++) {
+            if (wanted[w] != RADIO_NO_STATION) {
+                slot->station = wanted[w];
+                wanted[w] = RADIO_NO_STATION;
+            }
+        }
+        xSemaphoreGive(slot->lock);
+    }
+}
+
+/*
+ * Take a reconnect of the playing station, `conn` is NULL when it failed. The element may have
+ * closed the slot or tuned it elsewhere while the connect ran, the client is dropped then.
+ */
+static void radio_reconnected(radio_pool_t *pool, radio_slot_t *slot, const char *url, radio_conn_t *conn)
+{
+    if (!slot->active || !slot->lost || slot->url != url) {
+        radio_conn_drop(conn, url);
+        return;
+    }
+    if (conn == NULL) {
+        pool->link.retries++;
+        ESP_LOGW(TAG, "Reconnect failed, next try in %d ms", slot->backoff_ms);
+        slot->retry_us = esp_timer_get_time() + slot->backoff_ms * 1000LL;
+        slot->backoff_ms = slot->backoff_ms * 2 < RADIO_RECONNECT_MAX_MS ? slot->backoff_ms * 2 : RADIO_RECONNECT_MAX_MS;
+        return;
+    }
+    slot_install(slot, conn, url);
+    esp_http_client_set_timeout_ms(slot->client, RADIO_POLL_TIMEOUT_MS);
+    uint32_t outage_ms = (slot->last_data_us - slot->lost_us) / 1000;
+    pool->link.reconnects++;
+    pool->link.outage_ms = outage_ms;
+    pool->link.outage_total_ms += outage_ms;
+    if (outage_ms > pool->link.outage_max_ms) {
+        pool->link.outage_max_ms = outage_ms;
+    }
+    ESP_LOGI(TAG, "Back on %s after %u ms without data", slot->url, outage_ms);
+    /* The client is complete before the element sees it again */
+    slot->lost = false;
+}
+
+/* Take the connect of a standby, unless the slot was tuned to or pointed at another station meanwhile */
+static void radio_standby_connected(radio_pool_t *pool, radio_slot_t *slot, int station, radio_conn_t *conn)
+{
+    const char *url = pool->urls[station];
+    if (slot->active || slot->station != station || slot->client != NULL) {
+        radio_conn_drop(conn, url);
+        return;
+    }
+    if (conn == NULL) {
+        /* Unreachable, leave it for the next tune */
+        slot->station = RADIO_NO_STATION;
+        return;
+    }
+    slot_install(slot, conn, url);
+    esp_http_client_set_timeout_ms(slot->client, RADIO_STANDBY_TIMEOUT_MS);
+}
+
+static void radio_standby_task(void *pv)
+{
+    radio_pool_t *pool = (radio_pool_t *)pv;
+    while (!pool->quit) {
+        if (pool->retarget) {
+            pool->retarget = false;
+            radio_retarget(pool, pool->tuned);
+        }
+        bool busy = false;
+        for (int i = 0; i < pool->slot_num && !pool->quit; i++) {
+            radio_slot_t *slot = &pool->slots[i];
+            if (xSemaphoreTake(slot->lock, 0) != pdTRUE) {
+                continue;
+            }
+            /* A connect takes up to RADIO_CONNECT_TIMEOUT_MS, it runs with the lock given back */
+            const char *url = NULL;
+            int station = slot->station;
+            if (slot->active) {
+                if (slot->lost && esp_timer_get_time() >= slot->retry_us) {
+                    url = slot->url;
+                }
+            } else if (station != RADIO_NO_STATION) {
+                if (slot->client == NULL) {
+                    url = pool->urls[station];
+                } else {
+                    slot_fill(pool, slot);
+                }
+                busy = true;
+            }
+            bool reconnect = slot->active;
+            xSemaphoreGive(slot->lock);
+            if (url == NULL) {
+                continue;
+            }
+            radio_conn_t conn;
+            bool connected = radio_connect(&conn, url) == ESP_OK;
+            xSemaphoreTake(slot->lock, portMAX_DELAY);
+            if (reconnect) {
+                radio_reconnected(pool, slot, url, connected ? &conn : NULL);
+            } else {
+                radio_standby_connected(pool, slot, station, connected ? &conn : NULL);
+            }
+            xSemaphoreGive(slot->lock);
+            busy = true;
+        }
+        if (!busy) {
+            vTaskDelay(RADIO_STANDBY_IDLE);
+        }
+    }
+    xSemaphoreGive(pool->task_done);
+    vTaskDelete(NULL);
+}
+
+static esp_err_t radio_start_task(radio_pool_t *pool)
+{
+    if (pool->task) {
+        return ESP_OK;
+    }
+    pool->quit = false;
+    if (xTaskCreatePinnedToCore(radio_standby_task, "radio_standby", pool->standby_stack, pool,
+                                pool->standby_prio, &pool->task, pool->standby_core) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to start the standby task");
+        pool->task = NULL;
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+/* Without neighbours to keep warm the task only runs once a playing station has to be reconnected */
+static esp_err_t radio_start_standby(radio_pool_t *pool)
+{
+    return pool->standby_num > 0 ? radio_start_task(pool) : ESP_OK;
+}
+
+static void radio_publish_title(radio_reader_t *reader, radio_slot_t *slot)
+{
+    ESP_LOGD(TAG, "Title of station %d: %s", slot->station, slot->icy.title);
+    if (reader->on_title) {
+        reader->on_title(reader->title_ctx, slot->icy.title);
+    }
+}
+
+static esp_err_t _radio_reader_open(audio_element_handle_t self)
+{
+    radio_reader_t *reader = (radio_reader_t *)audio_element_getdata(self);
+    const char *uri = audio_element_get_uri(self);
+    AUDIO_NULL_CHECK(TAG, uri, return ESP_FAIL);
+    if (reader->active) {
+        /* Resumed after a pause, the station is still playing */
+        reader->active->last_data_us = esp_timer_get_time();
+        return ESP_OK;
+    }
+    radio_pool_t *pool = reader->pool;
+    int station = radio_station_of(pool, uri);
+    radio_slot_t *slot = NULL;
+    for (int i = 0; i < pool->slot_num && station != RADIO_NO_STATION; i++) {
+        if (pool->slots[i].station == station && !pool->slots[i].active) {
+            slot = &pool->slots[i];
+            break;
+        }
+    }
+    if (slot == NULL) {
+        /* Cold start: take a free slot, or the first standby when none is free; the other reader of a shared pool keeps its own */
+        for (int i = 0; i < pool->slot_num && slot == NULL; i++) {
+            if (pool->slots[i].station == RADIO_NO_STATION && !pool->slots[i].active) {
+                slot = &pool->slots[i];
+            }
+        }
+        for (int i = 0; i < pool->slot_num && slot == NULL; i++) {
+            if (!pool->slots[i].active) {
+                slot = &pool->slots[i];
+            }
+        }
+        AUDIO_NULL_CHECK(TAG, slot, return ESP_FAIL);
+    }
+
+    xSemaphoreTake(slot->lock, portMAX_DELAY);
+    bool warm = slot->client != NULL && slot->station == station && station != RADIO_NO_STATION;
+    if (!warm) {
+        slot_disconnect(slot);
+        slot->station = station;
+        if (slot_connect(slot, uri) != ESP_OK) {
+            slot->station = RADIO_NO_STATION;
+            xSemaphoreGive(slot->lock);
+            return ESP_FAIL;
+        }
+    } else {
+        ESP_LOGI(TAG, "Tuned to the warm standby %s, %d bytes buffered", uri, slot->len);
+    }
+    int64_t now = esp_timer_get_time();
+    jitter_buffer_reset(reader->jb, slot->kbps, now);
+    if (warm) {
+        slot_hand_over(reader, slot, now);
+        if (jitter_buffer_fill(reader->jb) >= RADIO_WARM_START) {
+            /* The neighbour was buffered ahead of time, waiting for the pre-roll would undo that */
+            jitter_buffer_play_now(reader->jb);
+        }
+    }
+    esp_http_client_set_timeout_ms(slot->client, RADIO_POLL_TIMEOUT_MS);
+    slot->last_data_us = now;
+    slot->active = true;
+    reader->active = slot;
+    reader->started = false;
+    /* A warm standby already knows what its station plays */
+    speaker_icy_take_title(&slot->icy);
+    bool titled = slot->icy.title[0] != '\0';
+    xSemaphoreGive(slot->lock);
+    if (titled) {
+        radio_publish_title(reader, slot);
+    }
+
+    pool->tuned = station;
+    pool->retarget = true;
+    radio_start_standby(pool);
+    return ESP_OK;
+}
+
+/* A live stream has no end: whatever stops it is a drop, the decoder goes on with what is buffered meanwhile */
+static void radio_lost(radio_reader_t *reader, radio_slot_t *slot, const char *why)
+{
+    jitter_buffer_stats_t stats;
+    jitter_buffer_get_stats(reader->jb, &stats);
+    ESP_LOGW(TAG, "Lost %s (%s), reconnecting while %u ms play from the buffer", slot->url, why, stats.fill_ms);
+    xSemaphoreTake(slot->lock, portMAX_DELAY);
+    slot_discard(slot);
+    slot->lost_us = slot->last_data_us;
+    slot->retry_us = esp_timer_get_time();
+    slot->backoff_ms = RADIO_RECONNECT_MIN_MS;
+    slot->lost = true;
+    xSemaphoreGive(slot->lock);
+    reader->pool->link.drops++;
+    radio_start_task(reader->pool);
+}
+
+/* Receive what the playing station has into the jitter buffer, waits RADIO_POLL_TIMEOUT_MS at most */
+static int radio_receive(radio_reader_t *reader, radio_slot_t *slot)
+{
+    uint8_t *dst;
+    int room = jitter_buffer_write_ptr(reader->jb, &dst);
+    if (room == 0) {
+        return 0;
+    }
+    int rlen = esp_http_client_read(slot->client, (char *)dst, room);
+    int64_t now_us = esp_timer_get_time();
+    if (rlen > 0) {
+        jitter_buffer_commit(reader->jb, speaker_icy_strip(&slot->icy, dst, rlen), now_us);
+        slot->last_data_us = now_us;
+        if (speaker_icy_take_title(&slot->icy)) {
+            radio_publish_title(reader, slot);
+        }
+        return rlen;
+    }
+    if (rlen < 0) {
+        radio_lost(reader, slot, "read failed");
+    } else if (esp_http_client_is_complete_data_received(slot->client)) {
+        radio_lost(reader, slot, "closed by the server");
+    } else if (now_us - slot->last_data_us > RADIO_STALL_US) {
+        radio_lost(reader, slot, "stalled");
+    }
+    return rlen;
+}
+
+static int _radio_reader_process(audio_element_handle_t self, char *in_buffer, int in_len)
+{
+    radio_reader_t *reader = (radio_reader_t *)audio_element_getdata(self);
+    radio_slot_t *slot = reader->active;
+    AUDIO_NULL_CHECK(TAG, slot, return AEL_IO_FAIL);
+    ringbuf_handle_t out_rb = audio_element_get_output_ringbuf(self);
+
+    int received = 0;
+    if (!slot->lost) {
+        received = radio_receive(reader, slot);
+    }
+    if (reader->started && rb_bytes_filled(out_rb) == 0 && jitter_buffer_is_buffering(reader->jb)) {
+        jitter_buffer_starved(reader->jb);
+    }
+
+    /* Hand the decoder as much as its ringbuffer takes without blocking, the network is polled in between */
+    int sent = 0;
+    const uint8_t *src;
+    int len;
+    while ((len = jitter_buffer_read_ptr(reader->jb, &src, esp_timer_get_time())) > 0) {
+        int space = rb_bytes_available(out_rb);
+        len = len < space ? len : space;
+        if (len <= 0) {
+            break;
+        }
+        int w_size = audio_element_output(self, (char *)src, len);
+        if (w_size <= 0) {
+            return w_size;
+        }
+        jitter_buffer_consume(reader->jb, w_size, esp_timer_get_time());
+        sent += w_size;
+    }
+    if (sent > 0) {
+        reader->started = true;
+        audio_element_update_byte_pos(self, sent);
+        return sent;
+    }
+    if (received <= 0) {
+        /* Nothing in and nothing out, the receive did not wait when the buffer is full */
+        vTaskDelay(RADIO_IDLE);
+    }
+    return AEL_IO_TIMEOUT;
+}
+
+static esp_err_t _radio_reader_close(audio_element_handle_t self)
+{
+    radio_reader_t *reader = (radio_reader_t *)audio_element_getdata(self);
+    if (AEL_STATE_PAUSED != audio_element_get_state(self) && reader->active) {
+        /* The station stays connected as a standby, it is the neighbour of the next one tuned */
+        radio_slot_t *slot = reader->active;
+        xSemaphoreTake(slot->lock, portMAX_DELAY);
+        if (reader->pool->task && slot->client && slot->station != RADIO_NO_STATION && !slot->lost) {
+            esp_http_client_set_timeout_ms(slot->client, RADIO_STANDBY_TIMEOUT_MS);
+            slot->head = 0;
+            slot->len = 0;
+            slot->last_data_us = esp_timer_get_time();
+        } else {
+            slot_disconnect(slot);
+            slot->station = RADIO_NO_STATION;
+        }
+        slot->lost = false;
+        slot->active = false;
+        reader->active = NULL;
+        xSemaphoreGive(slot->lock);
+        audio_element_report_pos(self);
+        audio_element_set_byte_pos(self, 0);
+    }
+    return ESP_OK;
+}
+
+void radio_reader_release(audio_element_handle_t self)
+{
+    radio_reader_t *reader = (radio_reader_t *)audio_element_getdata(self);
+    radio_pool_t *pool = reader->pool;
+    if (pool->task) {
+        pool->quit = true;
+        xSemaphoreTake(pool->task_done, portMAX_DELAY);
+        pool->task = NULL;
+    }
+    for (int i = 0; i < pool->slot_num; i++) {
+        slot_disconnect(&pool->slots[i]);
+        pool->slots[i].station = RADIO_NO_STATION;
+        pool->slots[i].active = false;
+        pool->slots[i].lost = false;
+    }
+    reader->active = NULL;
+    /* The sessions would not outlive the link by much, their memory goes back to the next mode */
+    host_cache_flush();
+}
+
+static void radio_pool_free(radio_pool_t *pool)
+{
+    for (int i = 0; i < pool->slot_num; i++) {
+        if (pool->slots[i].lock) {
+            vSemaphoreDelete(pool->slots[i].lock);
+        }
+        mem_policy_free(pool->slots[i].buf);
+    }
+    if (pool->task_done) {
+        vSemaphoreDelete(pool->task_done);
+    }
+    audio_free(pool);
+}
+
+static esp_err_t _radio_reader_destroy(audio_element_handle_t self)
+{
+    radio_reader_t *reader = (radio_reader_t *)audio_element_getdata(self);
+    if (reader->own_pool) {
+        radio_reader_release(self);
+        radio_pool_free(reader->pool);
+    }
+    jitter_buffer_destroy(reader->jb);
+    audio_free(reader);
+    return ESP_OK;
+}
+
+esp_err_t radio_reader_set_stations(audio_element_handle_t self, const char *const *urls, int count)
+{
+    radio_reader_t *reader = (radio_reader_t *)audio_element_getdata(self);
+    radio_reader_release(self);
+    reader->pool->urls = urls;
+    reader->pool->count = urls ? count : 0;
+    return ESP_OK;
+}
+
+void radio_reader_get_stats(audio_element_handle_t self, jitter_buffer_stats_t *stats)
+{
+    radio_reader_t *reader = (radio_reader_t *)audio_element_getdata(self);
+    jitter_buffer_get_stats(reader->jb, stats);
+}
+
+void radio_reader_get_link_stats(audio_element_handle_t self, radio_link_stats_t *stats)
+{
+    radio_pool_t *pool = ((radio_reader_t *)audio_element_getdata(self))->pool;
+    *stats = pool->link;
+    stats->down = false;
+    for (int i = 0; i < pool->slot_num; i++) {
+        stats->down |= pool->slots[i].active && pool->slots[i].lost;
+    }
+}
+
+/* A slot of the pool, with the rolling buffer it needs as a standby */
+static esp_err_t radio_pool_add_slot(radio_pool_t *pool)
+{
+    radio_slot_t *slot = &pool->slots[pool->slot_num];
+    slot->station = RADIO_NO_STATION;
+    slot->lock = xSemaphoreCreateMutex();
+    AUDIO_MEM_CHECK(TAG, slot->lock, return ESP_ERR_NO_MEM);
+    pool->slot_num++;
+    if (pool->standby_num > 0) {
+        slot->buf = mem_policy_malloc(MEM_BULK, pool->standby_size);
+        AUDIO_MEM_CHECK(TAG, slot->buf, return ESP_ERR_NO_MEM);
+    }
+    return ESP_OK;
+}
+
+static radio_pool_t *radio_pool_create(radio_reader_cfg_t *config)
+{
+    radio_pool_t *pool = audio_calloc(1, sizeof(radio_pool_t));
+    AUDIO_MEM_CHECK(TAG, pool, return NULL);
+    pool->standby_num = config->standby_num < 0 ? 0 : (config->standby_num > 2 ? 2 : config->standby_num);
+    pool->standby_size = config->standby_size;
+    pool->standby_stack = config->standby_stack;
+    pool->standby_prio = config->standby_prio;
+    pool->standby_core = config->standby_core;
+    pool->task_done = xSemaphoreCreateBinary();
+    AUDIO_MEM_CHECK(TAG, pool->task_done, goto _pool_create_failed);
+    for (int i = 0; i < 1 + pool->standby_num; i++) {
+        if (radio_pool_add_slot(pool) != ESP_OK) {
+            goto _pool_create_failed;
+        }
+    }
+    return pool;
+
+_pool_create_failed:
+    radio_pool_free(pool);
+    return NULL;
+}
+
+audio_element_handle_t radio_reader_init(radio_reader_cfg_t *config)
+{
+    AUDIO_NULL_CHECK(TAG, config, return NULL);
+    if (host_cache_init() != ESP_OK) {
+        ESP_LOGW(TAG, "No host cache, every connect starts from scratch");
+    }
+    radio_reader_t *reader = audio_calloc(1, sizeof(radio_reader_t));
+    AUDIO_MEM_CHECK(TAG, reader, return NULL);
+    reader->on_title = config->on_title;
+    reader->title_ctx = config->title_ctx;
+    if (config->share) {
+        /* The second reader plays from a slot of its own and tunes to the standbys of the first one */
+        reader->pool = ((radio_reader_t *)audio_element_getdata(config->share))->pool;
+        if (reader->pool->slot_num >= RADIO_SLOT_MAX) {
+            ESP_LOGE(TAG, "The shared pool has no room for another reader");
+            goto _reader_init_failed;
+        }
+        if (radio_pool_add_slot(reader->pool) != ESP_OK) {
+            goto _reader_init_failed;
+        }
+    } else {
+        reader->pool = radio_pool_create(config);
+        AUDIO_MEM_CHECK(TAG, reader->pool, goto _reader_init_failed);
+        reader->own_pool = true;
+    }
+    jitter_buffer_cfg_t jb_cfg = DEFAULT_JITTER_BUFFER_CONFIG();
+    jb_cfg.capacity = config->jitter_size;
+    jb_cfg.min_ms = config->preroll_ms;
+    reader->jb = jitter_buffer_create(&jb_cfg);
+    AUDIO_MEM_CHECK(TAG, reader->jb, goto _reader_init_failed);
+
+    audio_element_cfg_t cfg = DEFAULT_AUDIO_ELEMENT_CONFIG();
+    cfg.open = _radio_reader_open;
+    cfg.close = _radio_reader_close;
+    cfg.process = _radio_reader_process;
+    cfg.destroy = _radio_reader_destroy;
+    cfg.buffer_len = config->buffer_len;
+    cfg.task_stack = config->task_stack;
+    cfg.task_prio = config->task_prio;
+    cfg.task_core = config->task_core;
+    cfg.out_rb_size = config->out_rb_size;
+    cfg.stack_in_ext = config->stack_in_ext;
+    cfg.tag = "http";
+
+    audio_element_handle_t el = audio_element_init(&cfg);
+    AUDIO_MEM_CHECK(TAG, el, goto _reader_init_failed);
+    audio_element_setdata(el, reader);
+    return el;
+
+_reader_init_failed:
+    if (reader->own_pool) {
+        radio_pool_free(reader->pool);
+    }
+    jitter_buffer_destroy(reader->jb);
+    audio_free(reader);
+    return NULL;
+}
@@ -0,0 +1,137 @@
+#ifndef __RADIO_READER_H__
+#define __RADIO_READER_H__
+
+#include "audio_element.h"
+#include "jitter_buffer.h"
+
+/*
+ * HTTP reader for the radio stations that keeps the neighbouring stations warm.
+ *
+ * Besides the playing station the reader holds connections to the stations
+ * before and after it in the station list. A background task connects them
+ * ahead of time and keeps reading them into a rolling buffer that always
+ * holds their latest audio, so tuning to a neighbour only hands its buffer
+ * and its open connection to the decoder: no DNS lookup, no TLS handshake
+ * and no wait for the first bytes. The station that was left stays connected
+ * as the neighbour on the other side.
+ *
+ * Stations without a warm connection are connected when the element opens,
+ * as a plain http reader would.
+ *
+ * The playing station is read into an adaptive jitter buffer (jitter_buffer.h)
+ * and the decoder is fed from it: a cold station waits for the pre-roll, a
+ * warm one starts on the audio its standby had buffered. The element ringbuffer
+ * only needs to cover a few decoder reads.
+ *
+ * A second reader can share the connections of the first one (`share`): it
+ * adds a slot to play from and tunes to the same warm standbys, so the
+ * incoming station of a crossfade starts as fast as a plain tune. Each reader
+ * has its own jitter buffer; the first one owns the connections and the
+ * standby task.
+ *
+ * Every connection asks for the ICY metadata. It is stripped out of each read
+ * in place (speaker_icy.h) before the audio reaches a buffer, so the decoder
+ * never sees it, and a new stream title is handed to `on_title`. A warm
+ * standby keeps following its title and hands it over when it is tuned to.
+ *
+ * A live stream has no end, so a read error, the server closing or a stall
+ * of the playing station is a drop: the standby task reconnects to the same
+ * URL, at once and then with a backoff that doubles up to 30 s, while the
+ * element keeps feeding the decoder from the jitter buffer. The new
+ * connection goes on into the same buffer, the decoder is never restarted.
+ */
+
+typedef struct {
+    uint32_t    drops;          /* The playing station was lost */
+    uint32_t    reconnects;     /* Of those, back again */
+    uint32_t    retries;        /* Reconnects that failed and were tried again later */
+    uint32_t    outage_ms;      /* Last data before the last drop to the reconnect after it */
+    uint32_t    outage_max_ms;
+    uint32_t    outage_total_ms;
+    bool        down;           /* A playing station is being reconnected */
+} radio_link_stats_t;
+
+/* Called from the reader task with the title of the playing station, the string is only valid during the call */
+typedef void (*radio_title_cb)(void *ctx, const char *title);
+
+typedef struct {
+    int     out_rb_size;
+    int     task_stack;
+    int     task_core;
+    int     task_prio;
+    bool    stack_in_ext;
+    int     buffer_len;
+    int     standby_num;        /* Neighbours kept warm: 0, 1 (next) or 2 (next and previous) */
+    int     standby_size;       /* Bytes of latest audio buffered for every neighbour */
+    int     standby_stack;
+    int     standby_prio;
+    int     standby_core;
+    int     jitter_size;        /* Bytes of the jitter buffer, bounds the deepest pre-roll */
+    int     preroll_ms;         /* Pre-roll on a steady link, it grows while the link falls behind */
+    audio_element_handle_t  share;  /* Radio reader whose connections are shared, its standby settings apply */
+    radio_title_cb  on_title;
+    void            *title_ctx;
+} radio_reader_cfg_t;
+
+#define RADIO_READER_TASK_STACK     (4 * 1024)
+#define RADIO_READER_TASK_CORE      (0)
+#define RADIO_READER_TASK_PRIO      (4)
+#define RADIO_READER_RINGBUFFER     (4 * 1024)
+#define RADIO_READER_BUFFER_LEN     (2048)
+#define RADIO_READER_STANDBY_NUM    (2)
+#define RADIO_READER_STANDBY_SIZE   (8 * 1024)
+#define RADIO_READER_STANDBY_STACK  (4 * 1024)
+#define RADIO_READER_STANDBY_PRIO   (3)
+#define RADIO_READER_STANDBY_CORE   (0)
+#define RADIO_READER_JITTER_SIZE    (24 * 1024)
+#define RADIO_READER_PREROLL_MS     (750)
+
+#define DEFAULT_RADIO_READER_CONFIG() {                 \
+    .out_rb_size    = RADIO_READER_RINGBUFFER,          \
+    .task_stack     = RADIO_READER_TASK_STACK,          \
+    .task_core      = RADIO_READER_TASK_CORE,           \
+    .task_prio      = RADIO_READER_TASK_PRIO,           \
+    .stack_in_ext   = false,                            \
+    .buffer_len     = RADIO_READER_BUFFER_LEN,          \
+    .standby_num    = RADIO_READER_STANDBY_NUM,         \
+    .standby_size   = RADIO_READER_STANDBY_SIZE,        \
+    .standby_stack  = RADIO_READER_STANDBY_STACK,       \
+    .standby_prio   = RADIO_READER_STANDBY_PRIO,        \
+    .standby_core   = RADIO_READER_STANDBY_CORE,        \
+    .jitter_size    = RADIO_READER_JITTER_SIZE,         \
+    .preroll_ms     = RADIO_READER_PREROLL_MS,          \
+    .share          = NULL,                             \
+    .on_title       = NULL,                             \
+    .title_ctx      = NULL,                             \
+}
+
+/**
+ * @brief Create the radio reader, the station to play is the element uri
+ */
+audio_element_handle_t radio_reader_init(radio_reader_cfg_t *config);
+
+/**
+ * @brief Set the station list the neighbours are taken from
+ *
+ * The list is not copied and must outlive the reader. Only call it while the reader is stopped.
+ */
+esp_err_t radio_reader_set_stations(audio_element_handle_t self, const char *const *urls, int count);
+
+/**
+ * @brief Close every connection and stop the standby task, when the radio is left
+ *
+ * With a shared pool this closes the connections of both readers, only call it while both are stopped.
+ */
+void radio_reader_release(audio_element_handle_t self);
+
+/**
+ * @brief Underrun and rebuffer counts and the current depth of the jitter buffer
+ */
+void radio_reader_get_stats(audio_element_handle_t self, jitter_buffer_stats_t *stats);
+
+/**
+ * @brief Drops and reconnects of the playing stations since boot, of both readers of a shared pool
+ */
+void radio_reader_get_link_stats(audio_element_handle_t self, radio_link_stats_t *stats);
+
+#endif
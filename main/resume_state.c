@@ -0,0 +1,112 @@
+#include <string.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "nvs.h"
+#include "resume_state.h"
+
+static const char *TAG = "RESUME_STATE";
+
+#define RESUME_NAMESPACE        "speaker"
+#define RESUME_KEY              "resume"
+#define RESUME_VERSION          (1)
+#define RESUME_SETTLE_US        (2 * 1000 * 1000LL)    /* A setting is written once it stopped changing for this long */
+
+typedef struct {
+    uint32_t        version;
+    resume_state_t  state;
+} resume_blob_t;
+
+typedef struct {
+    nvs_handle_t    nvs;
+    bool            opened;
+    resume_state_t  stored;     /* As in flash */
+    resume_state_t  current;
+    int64_t         due_us;     /* When `current` is written, 0 while it equals `stored` */
+    int64_t         written_us; /* Last write */
+    uint32_t        writes;
+} resume_t;
+
+static resume_t s_resume;
+
+static bool resume_settings_differ(const resume_state_t *a, const resume_state_t *b)
+{
+    return a->mode != b->mode || a->volume != b->volume || a->station != b->station || a->track != b->track;
+}
+
+esp_err_t resume_state_init(resume_state_t *saved)
+{
+    memset(saved, 0, sizeof(*saved));
+    esp_err_t ret = nvs_open(RESUME_NAMESPACE, NVS_READWRITE, &s_resume.nvs);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "No NVS namespace, the state is not saved (%s)", esp_err_to_name(ret));
+        return ret;
+    }
+    s_resume.opened = true;
+    resume_blob_t blob;
+    size_t len = sizeof(blob);
+    ret = nvs_get_blob(s_resume.nvs, RESUME_KEY, &blob, &len);
+    if (ret != ESP_OK || len != sizeof(blob) || blob.version != RESUME_VERSION) {
+        ESP_LOGI(TAG, "No saved state");
+        return ESP_ERR_NOT_FOUND;
+    }
+    *saved = blob.state;
+    s_resume.stored = blob.state;
+    s_resume.current = blob.state;
+    ESP_LOGI(TAG, "Saved state: mode %u, volume %u, station %u, track %u at byte %u",
+             blob.state.mode, blob.state.volume, blob.state.station, blob.state.track, blob.state.offset);
+    return ESP_OK;
+}
+
+void resume_state_set(const resume_state_t *state)
+{
+    if (memcmp(state, &s_resume.current, sizeof(*state)) == 0) {
+        return;
+    }
+    int64_t now = esp_timer_get_time();
+    int64_t due;
+    if (resume_settings_differ(state, &s_resume.current)) {
+        due = now + RESUME_SETTLE_US;
+    } else {
+        /* The position alone moved on, it waits for the save period */
+        due = s_resume.written_us + CONFIG_SPEAKER_RESUME_SAVE_S * 1000 * 1000LL;
+    }
+    s_resume.current = *state;
+    if (memcmp(state, &s_resume.stored, sizeof(*state)) == 0) {
+        s_resume.due_us = 0;
+        return;
+    }
+    /* A pending write is only ever brought forward, a steady stream of changes cannot hold it back */
+    if (s_resume.due_us == 0 || due < s_resume.due_us) {
+        s_resume.due_us = due;
+    }
+}
+
+void resume_state_flush(bool force)
+{
+    if (!s_resume.opened || s_resume.due_us == 0) {
+        return;
+    }
+    int64_t now = esp_timer_get_time();
+    if (!force && now < s_resume.due_us) {
+        return;
+    }
+    resume_blob_t blob = {
+        .version = RESUME_VERSION,
+        .state = s_resume.current,
+    };
+    esp_err_t ret = nvs_set_blob(s_resume.nvs, RESUME_KEY, &blob, sizeof(blob));
+    if (ret == ESP_OK) {
+        ret = nvs_commit(s_resume.nvs);
+    }
+    s_resume.written_us = now;
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "State not saved, %s", esp_err_to_name(ret));
+        s_resume.due_us = now + CONFIG_SPEAKER_RESUME_SAVE_S * 1000 * 1000LL;
+        return;
+    }
+    s_resume.due_us = 0;
+    s_resume.stored = s_resume.current;
+    s_resume.writes++;
+    ESP_LOGD(TAG, "Saved write %u: mode %u, volume %u, station %u, track %u at byte %u", s_resume.writes,
+             blob.state.mode, blob.state.volume, blob.state.station, blob.state.track, blob.state.offset);
+}
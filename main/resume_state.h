@@ -0,0 +1,49 @@
+#ifndef __RESUME_STATE_H__
+#define __RESUME_STATE_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+/*
+ * Where playback was, kept in NVS across power cycles.
+ *
+ * The state is one small blob in the "speaker" namespace. The main task hands
+ * over the current state every housekeeping tick and the module decides when
+ * it reaches flash: a change of mode, volume, station or track is written a
+ * couple of seconds after it happened, so a burst of volume steps costs one
+ * write; a position that only moved on within the track is written at most
+ * every CONFIG_SPEAKER_RESUME_SAVE_S. A state equal to the one in flash is
+ * never written. Not thread safe, call every function from the main task.
+ */
+
+typedef struct {
+    uint8_t     mode;       /* service_mode_t, SD_MODE, BT_MODE or WIFI_MODE; 0 for none */
+    uint8_t     volume;
+    uint16_t    station;    /* Index into station_list, 0 to count - 1; past the end of the list, the first one plays */
+    uint32_t    track;      /* Music index number of the track */
+    uint32_t    offset;     /* File offset within the track, 0 for its start */
+} resume_state_t;
+
+/**
+ * @brief Open the namespace and read the saved state, call after nvs_flash_init()
+ *
+ * @param[out] saved    The saved state, zeroed when there is none
+ *
+ * @return ESP_OK with a saved state, ESP_ERR_NOT_FOUND without one (also for a blob of an older layout)
+ */
+esp_err_t resume_state_init(resume_state_t *saved);
+
+/**
+ * @brief Hand over the current state, it is written once due
+ */
+void resume_state_set(const resume_state_t *state);
+
+/**
+ * @brief Write the state when it is due
+ *
+ * @param force     Write a pending change now, e.g. before the power goes
+ */
+void resume_state_flush(bool force);
+
+#endif
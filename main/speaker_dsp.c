@@ -0,0 +1,604 @@
+#include <math.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "sdkconfig.h"
+#include "audio_error.h"
+#include "audio_mem.h"
+#include "audio_element.h"
+#include "ringbuf.h"
+#include "mem_policy.h"
+#include "speaker_kernel.h"
+#include "speaker_resampler.h"
+#include "speaker_asrc.h"
+#include "speaker_drift.h"
+#include "speaker_crossfade.h"
+#include "speaker_dsp.h"
+
+#define DSP_INPUT_MAIN          (0)     /* The input ring buffer the pipeline links */
+#define DSP_INPUT_SIDE          (1)     /* Multi-input ring buffer 0, fed by the second deck */
+#define DSP_SIDE_WAIT_MS        (50)    /* The side input is not aborted by a stop of the pipeline, never block on it */
+#define DSP_PRIME_WAIT          pdMS_TO_TICKS(10)   /* Between two looks at the input while it fills to the depth */
+
+static const char *TAG = "SPEAKER_DSP";
+
+typedef enum {
+    DSP_FADE_NONE = 0,
+    DSP_FADE_ARMED,     /* An incoming stream fills the other input, the end of the live one must not finish the element */
+    DSP_FADE_MIX,       /* Mixing the live input out and the other one in */
+} dsp_fade_t;
+
+typedef struct speaker_dsp {
+    volatile int            rate_slot;      /* Index into loudness_rates, SPEAKER_KERNEL_NO_EQ without a table */
+    volatile int            channels;
+    volatile bool           bypass;         /* Not 16-bit mono/stereo */
+    volatile int            target;         /* Volume step published by speaker_dsp_set_volume() */
+    const resampler_ratio_t *volatile ratio; /* Conversion to out_rate, NULL when the programme is at that rate */
+    int                     out_rate;
+    int                     rate;           /* Rate of the programme, the fade length is counted in its frames */
+    int                     carry_len[2];   /* Split frame of each input, waiting for the rest of it */
+    char                    carry[2][SPEAKER_KERNEL_MAX_CH * sizeof(int16_t)];
+    int16_t                 *converted;     /* Output of the resampler, only with an out_rate */
+    volatile int            live;           /* DSP_INPUT_MAIN or DSP_INPUT_SIDE */
+    volatile dsp_fade_t     fade;           /* Published by the control task, advanced by the element task */
+    volatile uint32_t       fade_len;       /* Frames of the requested fade */
+    bool                    mixing;
+    uint64_t                out_frames;     /* Frames written since the open */
+    char                    *mix;           /* Block of the incoming input, only with `crossfade` */
+    speaker_crossfade_t     xfade;
+    speaker_dsp_fade_stats_t stats;
+    volatile int            drift_ms;       /* Depth published by speaker_dsp_set_drift(), 0 without the drift correction */
+    int                     drift_depth;    /* Depth the estimator runs at */
+    bool                    priming;        /* Waiting for the input to reach the depth, or dropping what is over it */
+    speaker_drift_t         drift;
+    speaker_asrc_t          *asrc;          /* Only with `drift` */
+    int16_t                 *drifted;       /* Output of the drift resampler */
+    speaker_resampler_t     resampler;      /* Run by the element task, restarted when the ratio changes */
+    speaker_kernel_t        kernel;         /* Run by the element task, set_info only updates its limiter release */
+} speaker_dsp_t;
+
+static void _speaker_dsp_free(speaker_dsp_t *dsp)
+{
+    mem_policy_free(dsp->drifted);
+    mem_policy_free(dsp->asrc);
+    mem_policy_free(dsp->mix);
+    mem_policy_free(dsp->converted);
+    mem_policy_free(dsp);
+}
+
+static esp_err_t _speaker_dsp_destroy(audio_element_handle_t self)
+{
+    _speaker_dsp_free((speaker_dsp_t *)audio_element_getdata(self));
+    return ESP_OK;
+}
+
+static esp_err_t _speaker_dsp_open(audio_element_handle_t self)
+{
+    speaker_dsp_t *dsp = (speaker_dsp_t *)audio_element_getdata(self);
+    dsp->carry_len[DSP_INPUT_MAIN] = 0;
+    dsp->carry_len[DSP_INPUT_SIDE] = 0;
+    dsp->live = DSP_INPUT_MAIN;
+    dsp->fade = DSP_FADE_NONE;
+    dsp->mixing = false;
+    dsp->out_frames = 0;
+    /* Every run fills to the depth again, the drift of the source is kept */
+    dsp->priming = true;
+    if (dsp->asrc) {
+        speaker_asrc_reset(dsp->asrc, dsp->channels);
+        speaker_drift_init(&dsp->drift, dsp->drift.rate, dsp->drift_depth, true);
+    }
+    speaker_kernel_reset(&dsp->kernel);
+    speaker_resampler_set(&dsp->resampler, dsp->ratio, dsp->channels);
+    return ESP_OK;
+}
+
+static esp_err_t _speaker_dsp_close(audio_element_handle_t self)
+{
+    return ESP_OK;
+}
+
+/* Whole frames of one input, a split frame at the end waits for the next read of that input */
+static int dsp_read(audio_element_handle_t self, speaker_dsp_t *dsp, int input, char *buf, int len,
+                    int frame_bytes, bool wait)
+{
+    int carried = dsp->carry_len[input];
+    memcpy(buf, dsp->carry[input], carried);
+    int r_size;
+    if (input == DSP_INPUT_SIDE) {
+        r_size = audio_element_multi_input(self, buf + carried, len - carried, 0,
+                                           wait ? DSP_SIDE_WAIT_MS / portTICK_PERIOD_MS : 0);
+    } else if (wait) {
+        r_size = audio_element_input(self, buf + carried, len - carried);
+    } else {
+        r_size = rb_read(audio_element_get_input_ringbuf(self), buf + carried, len - carried, 0);
+    }
+    if (r_size <= 0) {
+        return r_size;
+    }
+    r_size += carried;
+    int whole = r_size - r_size % frame_bytes;
+    dsp->carry_len[input] = r_size - whole;
+    memcpy(dsp->carry[input], buf + whole, r_size - whole);
+    return whole > 0 ? whole : AEL_IO_TIMEOUT;
+}
+
+/* The other input is live from the next block on, the player learns it from a position report */
+static void dsp_flip(audio_element_handle_t self, speaker_dsp_t *dsp)
+{
+    int outgoing = dsp->live;
+    dsp->carry_len[outgoing] = 0;
+    dsp->live = !outgoing;
+    dsp->mixing = false;
+    dsp->fade = DSP_FADE_NONE;
+    audio_element_report_pos(self);
+}
+
+/* One block of the fade: the incoming input sets the pace, the outgoing one is topped up with silence once it runs dry */
+static int dsp_mix(audio_element_handle_t self, speaker_dsp_t *dsp, char *buf, int len, int frame_bytes)
+{
+    int incoming = !dsp->live;
+    if (!dsp->mixing) {
+        /* The incoming programme starts at this output frame, the output stage swaps its track in there */
+        speaker_crossfade_start(&dsp->xfade, dsp->fade_len);
+        dsp->mixing = true;
+        dsp->stats.mark = dsp->out_frames;
+        audio_element_report_pos(self);
+    }
+    int n = dsp_read(self, dsp, incoming, dsp->mix, len, frame_bytes, true);
+    if (n == AEL_IO_DONE || n == AEL_IO_OK) {
+        dsp_flip(self, dsp);
+        return AEL_IO_TIMEOUT;
+    }
+    if (n <= 0) {
+        return n;
+    }
+    int m = dsp_read(self, dsp, dsp->live, buf, n, frame_bytes, false);
+    m = m > 0 ? m : 0;
+    if (m < n) {
+        memset(buf + m, 0, n - m);
+        dsp->stats.silent_frames += (n - m) / frame_bytes;
+    }
+    int64_t start_us = esp_timer_get_time();
+    bool done = speaker_crossfade_run(&dsp->xfade, (int16_t *)buf, (int16_t *)dsp->mix, n / frame_bytes, dsp->channels);
+    dsp->stats.mix_us += esp_timer_get_time() - start_us;
+    dsp->stats.mixed_frames += n / frame_bytes;
+    if (done) {
+        if (dsp->xfade.len) {
+            dsp->stats.fades++;
+        } else {
+            dsp->stats.cuts++;
+        }
+        dsp_flip(self, dsp);
+    }
+    return n;
+}
+
+/* Read and forget `frames` frames of the main input, the split frame carried over counts as the first */
+static void dsp_drop(audio_element_handle_t self, speaker_dsp_t *dsp, char *buf, int len, int frames, int frame_bytes)
+{
+    ringbuf_handle_t rb = audio_element_get_input_ringbuf(self);
+    int bytes = frames * frame_bytes - dsp->carry_len[DSP_INPUT_MAIN];
+    dsp->carry_len[DSP_INPUT_MAIN] = 0;
+    while (bytes > 0) {
+        int r_size = rb_read(rb, buf, bytes < len ? bytes : len, 0);
+        if (r_size <= 0) {
+            break;
+        }
+        bytes -= r_size;
+    }
+}
+
+/*
+ * Keep the input of a source with its own clock at the depth before a block is read: wait for it to fill
+ * when a run starts or the source ran dry, drop what is over it after a burst. Returns the frames buffered,
+ * AEL_IO_TIMEOUT while filling.
+ */
+static int dsp_drift_pace(audio_element_handle_t self, speaker_dsp_t *dsp, char *buf, int len, int frame_bytes)
+{
+    ringbuf_handle_t rb = audio_element_get_input_ringbuf(self);
+    int depth = dsp->drift_ms;
+    /* The ring buffer in front holds the depth and the bursts around it */
+    int max_ms = (int)((int64_t)rb_get_size(rb) / frame_bytes * 1000 / dsp->rate * 2 / 3);
+    depth = depth < max_ms ? depth : max_ms;
+    if (depth != dsp->drift_depth || dsp->rate != dsp->drift.rate || dsp->channels != dsp->asrc->channels) {
+        /* The same source at the same rate keeps the drift it was found at */
+        if (dsp->rate == dsp->drift.rate && dsp->drift_depth) {
+            ESP_LOGI(TAG, "Bluetooth depth %d ms, drift %+.0f ppm", depth, dsp->drift.drift_ppm);
+        }
+        speaker_drift_init(&dsp->drift, dsp->rate, depth, dsp->rate == dsp->drift.rate);
+        speaker_asrc_reset(dsp->asrc, dsp->channels);
+        dsp->drift_depth = depth;
+        dsp->priming = true;
+    }
+    int fill = (rb_bytes_filled(rb) + dsp->carry_len[DSP_INPUT_MAIN]) / frame_bytes;
+    if (fill == 0 && !dsp->priming) {
+        /* A pause of the source or a stall of the link: start over from the depth */
+        dsp->priming = true;
+        speaker_drift_init(&dsp->drift, dsp->rate, depth, true);
+    }
+    if (dsp->priming) {
+        if (fill < dsp->drift.target) {
+            vTaskDelay(DSP_PRIME_WAIT);
+            return AEL_IO_TIMEOUT;
+        }
+        if (fill > dsp->drift.target + dsp->drift.slip) {
+            dsp_drop(self, dsp, buf, len, fill - dsp->drift.target, frame_bytes);
+            fill = dsp->drift.target;
+        }
+        dsp->priming = false;
+    }
+    return fill;
+}
+
+static int _speaker_dsp_process(audio_element_handle_t self, char *in_buffer, int in_len)
+{
+    speaker_dsp_t *dsp = (speaker_dsp_t *)audio_element_getdata(self);
+    dsp_fade_t fade = dsp->fade;
+    if (fade != DSP_FADE_MIX) {
+        dsp->mixing = false;
+    }
+    /* Pick up the latest rate and volume, the coefficient set only changes between blocks */
+    speaker_kernel_sync(&dsp->kernel, dsp->rate_slot, dsp->target);
+    int channels = dsp->channels;
+    /* Only whole frames are processed, a format passed through is taken as it comes */
+    int frame_bytes = dsp->bypass ? 1 : channels * sizeof(int16_t);
+    /* Only the main input of a plain run follows the clock of its source, a fade mixes two files or streams */
+    bool drifting = dsp->asrc && dsp->drift_ms > 0 && dsp->rate > 0 && !dsp->bypass
+                    && fade == DSP_FADE_NONE && dsp->live == DSP_INPUT_MAIN;
+    int fill = 0;
+    if (drifting) {
+        fill = dsp_drift_pace(self, dsp, in_buffer, in_len, frame_bytes);
+        if (fill < 0) {
+            return fill;
+        }
+    }
+    int r_size;
+    if (fade == DSP_FADE_MIX && dsp->mix && !dsp->bypass) {
+        r_size = dsp_mix(self, dsp, in_buffer, in_len, frame_bytes);
+    } else {
+        r_size = dsp_read(self, dsp, dsp->live, in_buffer, in_len, frame_bytes, true);
+        if (fade == DSP_FADE_ARMED && (r_size == AEL_IO_DONE || r_size == AEL_IO_OK)) {
+            /* The live track ended before the incoming one is ready, wait for the fade to start */
+            vTaskDelay(1);
+            return AEL_IO_TIMEOUT;
+        }
+    }
+    if (r_size <= 0) {
+        return r_size;
+    }
+    if (dsp->bypass) {
+        int w_size = audio_element_output(self, in_buffer, r_size);
+        if (w_size > 0) {
+            audio_element_update_byte_pos(self, w_size);
+        }
+        return w_size;
+    }
+    int frames = r_size / frame_bytes;
+    int out_len = r_size;
+    /* A gapless track at the same rate keeps the filter history, a new ratio starts from silence */
+    const resampler_ratio_t *ratio = dsp->ratio;
+    if (ratio != dsp->resampler.ratio || channels != dsp->resampler.channels) {
+        speaker_resampler_set(&dsp->resampler, ratio, channels);
+    }
+    /* The byte position counts the programme taken in, whatever rate it leaves at */
+    int in_bytes = out_len;
+    int16_t *pcm = (int16_t *)in_buffer;
+    if (drifting) {
+        /* Drift first, at the programme rate the estimator counts in */
+        frames = speaker_asrc_run(dsp->asrc, pcm, frames, dsp->drifted, dsp->drift.ratio_ppm);
+        if (speaker_drift_update(&dsp->drift, fill, frames)) {
+            dsp->priming = true;
+        }
+        pcm = dsp->drifted;
+        out_len = frames * frame_bytes;
+    }
+    if (ratio) {
+        frames = speaker_resampler_run(&dsp->resampler, pcm, frames, dsp->converted);
+        pcm = dsp->converted;
+        out_len = frames * frame_bytes;
+    }
+    speaker_kernel_run(&dsp->kernel, pcm, frames, channels);
+    int w_size = audio_element_output(self, (char *)pcm, out_len);
+    if (w_size > 0) {
+        audio_element_update_byte_pos(self, in_bytes);
+        dsp->out_frames += frames;
+    }
+    return w_size;
+}
+
+esp_err_t speaker_dsp_set_info(audio_element_handle_t self, int rate, int ch, int bits)
+{
+    speaker_dsp_t *dsp = (speaker_dsp_t *)audio_element_getdata(self);
+    bool bypass = bits != 16 || ch <= 0 || ch > SPEAKER_KERNEL_MAX_CH;
+    const resampler_ratio_t *ratio = NULL;
+    int out_rate = rate;
+    if (!bypass && dsp->out_rate && rate != dsp->out_rate) {
+        ratio = speaker_resampler_find(rate, dsp->out_rate);
+        if (ratio) {
+            out_rate = dsp->out_rate;
+            ESP_LOGI(TAG, "Converting %d Hz to %d Hz", rate, out_rate);
+        } else {
+            ESP_LOGW(TAG, "No resampler for %d Hz, the output follows the programme", rate);
+        }
+    }
+    int slot = speaker_kernel_set_rate(&dsp->kernel, out_rate);
+    if (bypass) {
+        slot = SPEAKER_KERNEL_NO_EQ;
+    }
+    dsp->bypass = bypass;
+    dsp->channels = ch;
+    dsp->rate = rate;
+    dsp->ratio = ratio;
+    dsp->rate_slot = slot;
+    audio_element_set_music_info(self, out_rate, ch, bits);
+    if (bypass) {
+        ESP_LOGW(TAG, "Unsupported format, %d bits, ch=%d, passing through", bits, ch);
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    if (slot == SPEAKER_KERNEL_NO_EQ) {
+        ESP_LOGW(TAG, "No loudness curve for %d Hz, only the limiter is applied", out_rate);
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    return ESP_OK;
+}
+
+void speaker_dsp_set_volume(audio_element_handle_t self, int volume)
+{
+    speaker_dsp_t *dsp = (speaker_dsp_t *)audio_element_getdata(self);
+    if (volume < 0) {
+        volume = 0;
+    } else if (volume >= LOUDNESS_STEPS) {
+        volume = LOUDNESS_STEPS - 1;
+    }
+    dsp->target = volume;
+}
+
+void speaker_dsp_fade_prepare(audio_element_handle_t self)
+{
+    speaker_dsp_t *dsp = (speaker_dsp_t *)audio_element_getdata(self);
+    dsp->fade = DSP_FADE_ARMED;
+}
+
+void speaker_dsp_fade_start(audio_element_handle_t self, int ms)
+{
+    speaker_dsp_t *dsp = (speaker_dsp_t *)audio_element_getdata(self);
+    if (dsp->mix == NULL) {
+        return;
+    }
+    dsp->fade_len = ms > 0 ? (uint32_t)((int64_t)dsp->rate * ms / 1000) : 0;
+    dsp->fade = DSP_FADE_MIX;
+}
+
+void speaker_dsp_fade_cancel(audio_element_handle_t self)
+{
+    speaker_dsp_t *dsp = (speaker_dsp_t *)audio_element_getdata(self);
+    dsp->fade = DSP_FADE_NONE;
+}
+
+bool speaker_dsp_side_live(audio_element_handle_t self)
+{
+    speaker_dsp_t *dsp = (speaker_dsp_t *)audio_element_getdata(self);
+    return dsp->live == DSP_INPUT_SIDE;
+}
+
+void speaker_dsp_get_fade_stats(audio_element_handle_t self, speaker_dsp_fade_stats_t *stats)
+{
+    speaker_dsp_t *dsp = (speaker_dsp_t *)audio_element_getdata(self);
+    *stats = dsp->stats;
+}
+
+void speaker_dsp_set_drift(audio_element_handle_t self, int depth_ms)
+{
+    speaker_dsp_t *dsp = (speaker_dsp_t *)audio_element_getdata(self);
+    if (dsp->asrc == NULL) {
+        return;
+    }
+    dsp->drift_ms = depth_ms > 0 ? depth_ms : 0;
+}
+
+void speaker_dsp_get_drift_stats(audio_element_handle_t self, speaker_dsp_drift_stats_t *stats)
+{
+    speaker_dsp_t *dsp = (speaker_dsp_t *)audio_element_getdata(self);
+    stats->active = dsp->drift_ms > 0;
+    stats->drift_ppm = dsp->drift.drift_ppm;
+    stats->ratio_ppm = dsp->drift.ratio_ppm;
+    stats->depth_ms = dsp->drift.fill_ms;
+    stats->target_ms = dsp->drift_depth;
+    stats->slips = dsp->drift.slips;
+}
+
+audio_element_handle_t speaker_dsp_init(speaker_dsp_cfg_t *config)
+{
+    AUDIO_NULL_CHECK(TAG, config, return NULL);
+    /* The filter and limiter state is read on every sample, keep it out of PSRAM */
+    speaker_dsp_t *dsp = mem_policy_calloc(MEM_HOT, 1, sizeof(speaker_dsp_t));
+    AUDIO_MEM_CHECK(TAG, dsp, return NULL);
+    dsp->rate_slot = SPEAKER_KERNEL_NO_EQ;
+    dsp->channels = 2;
+    speaker_kernel_init(&dsp->kernel, config->gain_db, config->limit_db, config->release_ms);
+    if (config->drift) {
+        int samples = speaker_asrc_max_out(config->buffer_len / sizeof(int16_t)) + SPEAKER_KERNEL_MAX_CH;
+        dsp->asrc = mem_policy_calloc(MEM_HOT, 1, sizeof(speaker_asrc_t));
+        dsp->drifted = mem_policy_calloc(MEM_HOT, samples, sizeof(int16_t));
+        AUDIO_MEM_CHECK(TAG, dsp->asrc && dsp->drifted, {_speaker_dsp_free(dsp); return NULL;});
+        speaker_asrc_reset(dsp->asrc, dsp->channels);
+    }
+    if (config->out_rate) {
+        /* A block of mono frames converts to the most output samples, plus the rounding of a stereo block */
+        int in_samples = config->drift ? speaker_asrc_max_out(config->buffer_len / sizeof(int16_t)) : config->buffer_len / sizeof(int16_t);
+        int samples = speaker_resampler_max_out(in_samples) + SPEAKER_KERNEL_MAX_CH;
+        dsp->converted = mem_policy_calloc(MEM_HOT, samples, sizeof(int16_t));
+        AUDIO_MEM_CHECK(TAG, dsp->converted, {_speaker_dsp_free(dsp); return NULL;});
+        dsp->out_rate = config->out_rate;
+    }
+    if (config->crossfade) {
+        dsp->mix = mem_policy_calloc(MEM_HOT, 1, config->buffer_len);
+        AUDIO_MEM_CHECK(TAG, dsp->mix, {_speaker_dsp_free(dsp); return NULL;});
+    }
+
+    audio_element_cfg_t cfg = DEFAULT_AUDIO_ELEMENT_CONFIG();
+    cfg.destroy = _speaker_dsp_destroy;
+    cfg.process = _speaker_dsp_process;
+    cfg.open = _speaker_dsp_open;
+    cfg.close = _speaker_dsp_close;
+    cfg.buffer_len = config->buffer_len;
+    cfg.task_stack = config->task_stack;
+    cfg.task_prio = config->task_prio;
+    cfg.task_core = config->task_core;
+    cfg.out_rb_size = config->out_rb_size;
+    cfg.stack_in_ext = config->stack_in_ext;
+    cfg.multi_in_rb_num = config->crossfade ? 1 : 0;
+    cfg.tag = "dsp";
+
+    audio_element_handle_t el = audio_element_init(&cfg);
+    AUDIO_MEM_CHECK(TAG, el, {_speaker_dsp_free(dsp); return NULL;});
+    audio_element_setdata(el, dsp);
+    speaker_dsp_set_volume(el, config->volume);
+    return el;
+}
+
+#if CONFIG_SPEAKER_DSP_BENCHMARK
+#include "esp_cpu.h"
+#include "ringbuf.h"
+#include "equalizer.h"
+#include "audio_alc.h"
+
+#define BENCH_FRAMES        (1024)
+#define BENCH_ROUNDS        (32)
+
+#define BENCH_START_WAIT    pdMS_TO_TICKS(2000)
+#define BENCH_SOURCE_RB     (1024)  /* Stays empty, the chain waits on it */
+
+typedef int (*bench_chain_t)(audio_element_handle_t *els);
+
+static int bench_pair(audio_element_handle_t *els)
+{
+    equalizer_cfg_t eq_cfg = DEFAULT_EQUALIZER_CONFIG();
+    alc_volume_setup_cfg_t alc_cfg = DEFAULT_ALC_VOLUME_SETUP_CONFIG();
+    els[0] = equalizer_init(&eq_cfg);
+    els[1] = alc_volume_setup_init(&alc_cfg);
+    return 2;
+}
+
+static int bench_fused(audio_element_handle_t *els)
+{
+    speaker_dsp_cfg_t dsp_cfg = DEFAULT_SPEAKER_DSP_CONFIG();
+    els[0] = speaker_dsp_init(&dsp_cfg);
+    return 1;
+}
+
+/*
+ * Internal RAM a chain of elements holds once its tasks run, from the element handles to the
+ * ring buffer behind every element. The chain reads an empty ring buffer so it stays running.
+ */
+static int bench_chain_ram(bench_chain_t build)
+{
+    audio_element_handle_t els[2] = { NULL };
+    ringbuf_handle_t rbs[3] = { NULL };
+    int used = -1;
+    rbs[0] = rb_create(1, BENCH_SOURCE_RB);
+    AUDIO_MEM_CHECK(TAG, rbs[0], return -1);
+    size_t before = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    int num = build(els);
+    for (int i = 0; i < num; i++) {
+        AUDIO_NULL_CHECK(TAG, els[i], goto _chain_exit);
+        rbs[i + 1] = rb_create(1, audio_element_get_output_ringbuf_size(els[i]));
+        AUDIO_MEM_CHECK(TAG, rbs[i + 1], goto _chain_exit);
+        audio_element_set_input_ringbuf(els[i], rbs[i]);
+        audio_element_set_output_ringbuf(els[i], rbs[i + 1]);
+        audio_element_run(els[i]);
+        /* What an element allocates in its open is only there once it runs */
+        if (audio_element_resume(els[i], 0, BENCH_START_WAIT) != ESP_OK) {
+            ESP_LOGE(TAG, "%s did not start", audio_element_get_tag(els[i]));
+            goto _chain_exit;
+        }
+    }
+    used = (int)(before - heap_caps_get_free_size(MALLOC_CAP_INTERNAL));
+
+_chain_exit:
+    for (int i = 0; i < num; i++) {
+        if (els[i]) {
+            audio_element_stop(els[i]);
+            audio_element_wait_for_stop(els[i]);
+            audio_element_terminate(els[i]);
+            audio_element_deinit(els[i]);
+        }
+    }
+    for (int i = 0; i <= num; i++) {
+        if (rbs[i]) {
+            rb_destroy(rbs[i]);
+        }
+    }
+    return used;
+}
+
+void speaker_dsp_benchmark(void)
+{
+    speaker_kernel_t *kernel = heap_caps_malloc(sizeof(speaker_kernel_t), MALLOC_CAP_INTERNAL);
+    speaker_resampler_t *resampler = heap_caps_malloc(sizeof(speaker_resampler_t), MALLOC_CAP_INTERNAL);
+    int16_t *pcm = heap_caps_malloc(BENCH_FRAMES * 2 * sizeof(int16_t), MALLOC_CAP_INTERNAL);
+    int16_t *converted = heap_caps_malloc(speaker_resampler_max_out(BENCH_FRAMES) * 2 * sizeof(int16_t), MALLOC_CAP_INTERNAL);
+    speaker_asrc_t *asrc = heap_caps_malloc(sizeof(speaker_asrc_t), MALLOC_CAP_INTERNAL);
+    AUDIO_MEM_CHECK(TAG, kernel && resampler && pcm && converted && asrc, goto _bench_exit);
+    speaker_kernel_init(kernel, 0.0f, -1.0f, 200);
+
+    for (int r = 0; r < LOUDNESS_RATE_NUM; r++) {
+        int rate = loudness_rates[r].sample_rate;
+        for (int i = 0; i < BENCH_FRAMES; i++) {
+            /* 1 kHz at -6 dBFS over a 50 Hz tone that drives the bass bands into the limiter */
+            float s = 0.5f * sinf(2 * M_PI * 1000 * i / rate) + 0.4f * sinf(2 * M_PI * 50 * i / rate);
+            pcm[2 * i] = pcm[2 * i + 1] = (int16_t)(s * 32767 * 0.9f);
+        }
+        speaker_kernel_sync(kernel, speaker_kernel_set_rate(kernel, rate), 50);
+        uint32_t start = esp_cpu_get_ccount();
+        for (int i = 0; i < BENCH_ROUNDS; i++) {
+            speaker_kernel_run(kernel, pcm, BENCH_FRAMES, 2);
+        }
+        uint32_t cycles = esp_cpu_get_ccount() - start;
+        ESP_LOGI(TAG, "%5d Hz stereo: %u cycles per frame", rate, cycles / (BENCH_ROUNDS * BENCH_FRAMES));
+    }
+
+    /* The resampler at every ratio, per output frame so it adds up with the EQ figures at the output rate */
+    for (int r = 0; r < RESAMPLER_RATIO_NUM; r++) {
+        const resampler_ratio_t *ratio = &resampler_ratios[r];
+        speaker_resampler_set(resampler, ratio, 2);
+        int produced = 0;
+        uint32_t start = esp_cpu_get_ccount();
+        for (int i = 0; i < BENCH_ROUNDS; i++) {
+            produced += speaker_resampler_run(resampler, pcm, BENCH_FRAMES, converted);
+        }
+        uint32_t cycles = esp_cpu_get_ccount() - start;
+        uint32_t per_frame = cycles / produced;
+        float load = 100.0f * per_frame * ratio->out_rate / (CONFIG_ESP32_DEFAULT_CPU_FREQ_MHZ * 1000000.0f);
+        ESP_LOGI(TAG, "%5d -> %5d Hz stereo: %u cycles per output frame, %.1f%% of a core",
+                 ratio->in_rate, ratio->out_rate, per_frame, load);
+    }
+
+    /* The drift resampler of the Bluetooth path interpolates its filter at every frame, time it at a ratio off 1 */
+    speaker_asrc_reset(asrc, 2);
+    int produced = 0;
+    uint32_t start = esp_cpu_get_ccount();
+    for (int i = 0; i < BENCH_ROUNDS; i++) {
+        produced += speaker_asrc_run(asrc, pcm, BENCH_FRAMES, converted, 123.0f);
+    }
+    uint32_t per_frame = (esp_cpu_get_ccount() - start) / produced;
+    ESP_LOGI(TAG, "44100 Hz stereo drift: %u cycles per output frame, %.1f%% of a core", per_frame,
+             100.0f * per_frame * 44100 / (CONFIG_ESP32_DEFAULT_CPU_FREQ_MHZ * 1000000.0f));
+
+    int pair_ram = bench_chain_ram(bench_pair);
+    int fused_ram = bench_chain_ram(bench_fused);
+    ESP_LOGI(TAG, "Internal RAM: equalizer + alc %d bytes, dsp %d bytes, saved %d bytes",
+             pair_ram, fused_ram, pair_ram - fused_ram);
+    ESP_LOGI(TAG, "Free internal RAM %u bytes", heap_caps_get_free_size(MALLOC_CAP_INTERNAL));
+
+_bench_exit:
+    heap_caps_free(asrc);
+    heap_caps_free(converted);
+    heap_caps_free(pcm);
+    heap_caps_free(resampler);
+    heap_caps_free(kernel);
+}
+#endif
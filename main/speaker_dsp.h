@@ -0,0 +1,159 @@
+#ifndef __SPEAKER_DSP_H__
+#define __SPEAKER_DSP_H__
+
+#include "audio_element.h"
+
+/*
+ * The whole programme processing in one element: loudness compensation EQ, gain and peak limiter.
+ *
+ * It replaces the equalizer --> alc pair, which cost a task, a stack and a ring buffer per stage and
+ * copied every sample twice on its way to the output stage. Every block is split into the channels once,
+ * each channel runs through the 10-band biquad cascade with the ESP-DSP float kernels, and a single pass
+ * over the frames applies the gain and the limiter and interleaves the samples back.
+ *
+ * The EQ curve follows the volume across the whole 0-100 % range. The coefficients of every volume step
+ * are precomputed for every supported sample rate (components/speaker_core/loudness_table.c, generated by
+ * tools/gen_loudness_table.py), so a volume change never computes a filter. It only publishes the new
+ * target step; the element task swaps the coefficient set used by all channels at the next block and
+ * walks towards the target a few steps per block, so a jump never clicks.
+ *
+ * Programmes at a rate without tables skip the EQ but still get the gain and the limiter. Formats other
+ * than 16-bit mono/stereo pass through untouched. The processing itself lives in
+ * components/speaker_core/speaker_kernel.c, so it also builds and is benchmarked on a host.
+ *
+ * With a fixed `out_rate` the element first converts the programme to that rate
+ * (components/speaker_core/speaker_resampler.c) and reports the output rate as its music info, so the
+ * I2S clock is programmed once and the EQ, gain and limiter always run at the output rate. A programme
+ * rate the resampler has no filter for is passed at its own rate, the clock then follows it as before.
+ *
+ * With `crossfade` the element has a second input, multi-input ring buffer 0, that a second decoder
+ * feeds. One input is live at a time. A fade mixes the live input out and the other one in with
+ * components/speaker_core/speaker_crossfade.c, ahead of the resampler, so both must carry the format set
+ * with speaker_dsp_set_info(). The element reports its position when the mix starts, with the output
+ * frame it started at in the fade stats, and again when the other input has become the live one.
+ *
+ * With `drift` the element follows a source that pushes audio on its own clock, the Bluetooth sink: the
+ * main input is held at a depth set with speaker_dsp_set_drift(), the drift of the source is estimated from
+ * the fill of that ring buffer (components/speaker_core/speaker_drift.c) and the programme runs through an
+ * asynchronous resampler (components/speaker_core/speaker_asrc.c) at the ratio that keeps the fill at the
+ * depth, ahead of the fixed one. The ring buffer in front must hold half as much again as the depth.
+ */
+
+typedef struct {
+    int     out_rb_size;
+    int     task_stack;
+    int     task_core;
+    int     task_prio;
+    bool    stack_in_ext;
+    int     buffer_len;
+    int     volume;         /* Curve used until the first speaker_dsp_set_volume() */
+    float   gain_db;        /* Gain in front of the limiter */
+    float   limit_db;       /* Limiter ceiling in dBFS */
+    int     release_ms;     /* Time the limiter takes to recover about 20 dB */
+    int     out_rate;       /* Rate the programme is converted to, 0 keeps the rate of the programme */
+    bool    crossfade;      /* Add the second input and the buffer the fades mix from */
+    bool    drift;          /* Add the drift resampler and its buffer */
+} speaker_dsp_cfg_t;
+
+typedef struct {
+    int         fades;          /* Fades mixed to the end */
+    int         cuts;           /* Fades of length 0 */
+    uint64_t    mark;           /* Output frame since the open the last fade started at */
+    uint32_t    mixed_frames;
+    uint32_t    silent_frames;  /* Outgoing frames that were not there in time and were mixed as silence */
+    uint32_t    mix_us;         /* Time spent in the mixer */
+} speaker_dsp_fade_stats_t;
+
+typedef struct {
+    bool        active;         /* The main input follows the clock of its source */
+    float       drift_ppm;      /* Source clock against the output clock, positive when the source is fast */
+    float       ratio_ppm;      /* Correction the resampler runs at */
+    float       depth_ms;       /* Average fill of the main input over the last second */
+    int         target_ms;
+    uint32_t    slips;          /* Times the fill was put back to the depth by waiting or dropping */
+} speaker_dsp_drift_stats_t;
+
+#define SPEAKER_DSP_TASK_STACK      (3 * 1024)
+#define SPEAKER_DSP_TASK_CORE       (0)
+#define SPEAKER_DSP_TASK_PRIO       (5)
+#define SPEAKER_DSP_RINGBUFFER      (8 * 1024)
+#define SPEAKER_DSP_BUFFER_LEN      (2 * 1024)
+
+#define DEFAULT_SPEAKER_DSP_CONFIG() {                  \
+    .out_rb_size    = SPEAKER_DSP_RINGBUFFER,           \
+    .task_stack     = SPEAKER_DSP_TASK_STACK,           \
+    .task_core      = SPEAKER_DSP_TASK_CORE,            \
+    .task_prio      = SPEAKER_DSP_TASK_PRIO,            \
+    .stack_in_ext   = false,                            \
+    .buffer_len     = SPEAKER_DSP_BUFFER_LEN,           \
+    .volume         = 50,                               \
+    .gain_db        = 0.0f,                             \
+    .limit_db       = -1.0f,                            \
+    .release_ms     = 200,                              \
+    .out_rate       = 0,                                \
+    .crossfade      = false,                            \
+    .drift          = false,                            \
+}
+
+/**
+ * @brief Create the DSP element
+ */
+audio_element_handle_t speaker_dsp_init(speaker_dsp_cfg_t *config);
+
+/**
+ * @brief Set the format of the programme
+ *
+ * The music info of the element is the format it outputs: `out_rate` when the programme is converted.
+ *
+ * @return ESP_OK, ESP_ERR_NOT_SUPPORTED when the programme is not equalized
+ */
+esp_err_t speaker_dsp_set_info(audio_element_handle_t self, int rate, int ch, int bits);
+
+/**
+ * @brief Follow a new volume, safe to call from any task
+ *
+ * @param volume    Volume in %, clamped to 0-100
+ */
+void speaker_dsp_set_volume(audio_element_handle_t self, int volume);
+
+/**
+ * @brief An incoming stream fills the other input: the end of the live one no longer finishes the element
+ */
+void speaker_dsp_fade_prepare(audio_element_handle_t self);
+
+/**
+ * @brief Fade from the live input to the other one over `ms`, 0 switches at the next block
+ *
+ * The other input must already carry the format set with speaker_dsp_set_info(). Without `crossfade` this does nothing.
+ */
+void speaker_dsp_fade_start(audio_element_handle_t self, int ms);
+
+/**
+ * @brief Drop a prepared fade that has not started mixing, the live input stays
+ */
+void speaker_dsp_fade_cancel(audio_element_handle_t self);
+
+/**
+ * @brief Whether the second input is the live one
+ */
+bool speaker_dsp_side_live(audio_element_handle_t self);
+
+void speaker_dsp_get_fade_stats(audio_element_handle_t self, speaker_dsp_fade_stats_t *stats);
+
+/**
+ * @brief Hold the main input at `depth_ms` and follow the clock of its source, 0 takes the input as it comes
+ *
+ * Safe to call from any task, the element fills or drops to the new depth at the next block. Without `drift` this does nothing.
+ */
+void speaker_dsp_set_drift(audio_element_handle_t self, int depth_ms);
+
+void speaker_dsp_get_drift_stats(audio_element_handle_t self, speaker_dsp_drift_stats_t *stats);
+
+/**
+ * @brief Time the DSP pass and the resampler on a synthetic programme and log the cycles per frame and the internal RAM it takes
+ *
+ * Built with CONFIG_SPEAKER_DSP_BENCHMARK only. Call it before the playback pipeline is created.
+ */
+void speaker_dsp_benchmark(void);
+
+#endif
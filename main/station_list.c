@@ -0,0 +1,338 @@
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/param.h>
+#include "esp_log.h"
+#include "nvs.h"
+#include "audio_error.h"
+#include "mem_policy.h"
+#include "station_list.h"
+
+static const char *TAG = "STATION_LIST";
+
+#define STATION_LIST_NAMESPACE  "speaker"
+#define STATION_LIST_KEY        "stations"
+#define STATION_LIST_TABLE_INIT (1024)
+
+struct station_list {
+    char        *table;     /* "url\0name\0" per station */
+    int         size;
+    int         cap;
+    int         count;
+    const char  **urls;     /* Into the table, built once the table is complete */
+};
+
+/* What a list file is read with: the current line and the station it describes so far */
+typedef struct {
+    char    line[STATION_LIST_LINE_MAX];
+    char    url[STATION_LIST_LINE_MAX];
+    char    name[STATION_LIST_LINE_MAX];
+    int     num;                            /* N of the PLS entry in `url` */
+} station_parse_t;
+
+static station_list_handle_t station_list_create(int cap)
+{
+    station_list_handle_t list = mem_policy_calloc(MEM_BULK, 1, sizeof(struct station_list));
+    AUDIO_MEM_CHECK(TAG, list, return NULL);
+    list->table = mem_policy_malloc(MEM_BULK, cap);
+    AUDIO_MEM_CHECK(TAG, list->table, {mem_policy_free(list); return NULL;});
+    list->cap = cap;
+    return list;
+}
+
+static esp_err_t station_list_add(station_list_handle_t list, const char *url, const char *name)
+{
+    int url_len = strlen(url) + 1;
+    int name_len = strlen(name) + 1;
+    if (list->size + url_len + name_len > list->cap) {
+        int cap = MAX(list->cap * 2, list->size + url_len + name_len);
+        char *table = mem_policy_malloc(MEM_BULK, cap);
+        AUDIO_MEM_CHECK(TAG, table, return ESP_ERR_NO_MEM);
+        memcpy(table, list->table, list->size);
+        mem_policy_free(list->table);
+        list->table = table;
+        list->cap = cap;
+    }
+    memcpy(list->table + list->size, url, url_len);
+    memcpy(list->table + list->size + url_len, name, name_len);
+    list->size += url_len + name_len;
+    return ESP_OK;
+}
+
+/* Point the index at every station of the complete table, a table that does not end in a name is refused */
+static esp_err_t station_list_index(station_list_handle_t list)
+{
+    const char *end = list->table + list->size;
+    int strings = 0;
+    if (list->size == 0 || end[-1] != '\0') {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    for (const char *p = list->table; p < end; p += strlen(p) + 1) {
+        strings++;
+    }
+    if (strings % 2) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    int count = strings / 2;
+    list->urls = mem_policy_malloc(MEM_BULK, count * sizeof(const char *));
+    AUDIO_MEM_CHECK(TAG, list->urls, return ESP_ERR_NO_MEM);
+    const char *p = list->table;
+    for (int i = 0; i < count; i++) {
+        list->urls[i] = p;
+        p += strlen(p) + 1;
+        p += strlen(p) + 1;
+    }
+    list->count = count;
+    return ESP_OK;
+}
+
+/* Index a list that was filled, or drop it when it came out empty or broken */
+static station_list_handle_t station_list_finish(station_list_handle_t list, const char *from)
+{
+    if (list->size == 0 || station_list_index(list) != ESP_OK) {
+        station_list_destroy(list);
+        return NULL;
+    }
+    ESP_LOGI(TAG, "%d stations from %s, %d bytes", list->count, from, list->size);
+    return list;
+}
+
+station_list_handle_t station_list_from_array(const char *const *urls, int count)
+{
+    station_list_handle_t list = station_list_create(STATION_LIST_TABLE_INIT);
+    AUDIO_NULL_CHECK(TAG, list, return NULL);
+    for (int i = 0; i < count; i++) {
+        if (station_list_add(list, urls[i], "") != ESP_OK) {
+            station_list_destroy(list);
+            return NULL;
+        }
+    }
+    return station_list_finish(list, "the built-in list");
+}
+
+station_list_handle_t station_list_load_nvs(void)
+{
+    nvs_handle_t nvs;
+    if (nvs_open(STATION_LIST_NAMESPACE, NVS_READONLY, &nvs) != ESP_OK) {
+        return NULL;
+    }
+    station_list_handle_t list = NULL;
+    size_t len = 0;
+    if (nvs_get_blob(nvs, STATION_LIST_KEY, NULL, &len) == ESP_OK && len > 0) {
+        list = station_list_create(len);
+        if (list && nvs_get_blob(nvs, STATION_LIST_KEY, list->table, &len) == ESP_OK) {
+            list->size = len;
+            list = station_list_finish(list, "NVS");
+        } else if (list) {
+            station_list_destroy(list);
+            list = NULL;
+        }
+    }
+    nvs_close(nvs);
+    return list;
+}
+
+/* Read the next line without its line end and surrounding blanks, false at the end of the file */
+static bool station_read_line(FILE *f, station_parse_t *parse, char **line)
+{
+    if (fgets(parse->line, sizeof(parse->line), f) == NULL) {
+        return false;
+    }
+    char *s = parse->line;
+    int len = strlen(s);
+    if (len == sizeof(parse->line) - 1 && s[len - 1] != '\n') {
+        /* Longer than any sensible entry, skip the rest of it */
+        int c;
+        while ((c = fgetc(f)) != EOF && c != '\n') {
+        }
+        ESP_LOGW(TAG, "Skipped a line of more than %d bytes", STATION_LIST_LINE_MAX);
+        s[0] = '\0';
+    }
+    while (len > 0 && isspace((unsigned char)s[len - 1])) {
+        s[--len] = '\0';
+    }
+    if ((unsigned char)s[0] == 0xEF && (unsigned char)s[1] == 0xBB && (unsigned char)s[2] == 0xBF) {
+        s += 3;
+    }
+    while (isspace((unsigned char)*s)) {
+        s++;
+    }
+    *line = s;
+    return true;
+}
+
+static esp_err_t station_parse_m3u(station_list_handle_t list, FILE *f, station_parse_t *parse)
+{
+    char *line;
+    parse->name[0] = '\0';
+    while (station_read_line(f, parse, &line)) {
+        if (strncasecmp(line, "#EXTINF:", 8) == 0) {
+            /* #EXTINF:<length>,<name> names the URL that follows */
+            char *comma = strchr(line, ',');
+            strlcpy(parse->name, comma ? comma + 1 : "", sizeof(parse->name));
+        } else if (line[0] != '\0' && line[0] != '#') {
+            if (station_list_add(list, line, parse->name) != ESP_OK) {
+                return ESP_ERR_NO_MEM;
+            }
+            parse->name[0] = '\0';
+        }
+    }
+    return ESP_OK;
+}
+
+/* The value of a PLS "<key><N>=<value>" line when the key matches, with its N */
+static const char *station_pls_value(const char *line, const char *key, int *num)
+{
+    int key_len = strlen(key);
+    if (strncasecmp(line, key, key_len) != 0 || !isdigit((unsigned char)line[key_len])) {
+        return NULL;
+    }
+    const char *eq = strchr(line, '=');
+    if (eq == NULL) {
+        return NULL;
+    }
+    *num = atoi(line + key_len);
+    return eq + 1;
+}
+
+static esp_err_t station_parse_pls(station_list_handle_t list, FILE *f, station_parse_t *parse)
+{
+    char *line;
+    const char *value;
+    int num;
+    parse->url[0] = '\0';
+    parse->name[0] = '\0';
+    /* A TitleN may come before or after its FileN, an entry is added once the next one starts */
+    while (station_read_line(f, parse, &line)) {
+        if ((value = station_pls_value(line, "File", &num)) != NULL) {
+            if (parse->url[0] && station_list_add(list, parse->url, parse->name) != ESP_OK) {
+                return ESP_ERR_NO_MEM;
+            }
+            if (num != parse->num) {
+                parse->name[0] = '\0';
+            }
+            strlcpy(parse->url, value, sizeof(parse->url));
+            parse->num = num;
+        } else if ((value = station_pls_value(line, "Title", &num)) != NULL) {
+            if (num != parse->num && parse->url[0]) {
+                if (station_list_add(list, parse->url, parse->name) != ESP_OK) {
+                    return ESP_ERR_NO_MEM;
+                }
+                parse->url[0] = '\0';
+            }
+            strlcpy(parse->name, value, sizeof(parse->name));
+            parse->num = num;
+        }
+    }
+    if (parse->url[0] && station_list_add(list, parse->url, parse->name) != ESP_OK) {
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+station_list_handle_t station_list_load_card(void)
+{
+    static const struct {
+        const char  *path;
+        esp_err_t   (*parse)(station_list_handle_t list, FILE *f, station_parse_t *parse);
+    } files[] = {
+        { STATION_LIST_M3U, station_parse_m3u },
+        { STATION_LIST_PLS, station_parse_pls },
+    };
+    for (int i = 0; i < sizeof(files) / sizeof(files[0]); i++) {
+        FILE *f = fopen(files[i].path, "r");
+        if (f == NULL) {
+            continue;
+        }
+        station_list_handle_t list = station_list_create(STATION_LIST_TABLE_INIT);
+        station_parse_t *parse = mem_policy_calloc(MEM_BULK, 1, sizeof(station_parse_t));
+        esp_err_t ret = ESP_ERR_NO_MEM;
+        if (list && parse) {
+            ret = files[i].parse(list, f, parse);
+        }
+        fclose(f);
+        mem_policy_free(parse);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to read %s", files[i].path);
+            if (list) {
+                station_list_destroy(list);
+            }
+            return NULL;
+        }
+        list = station_list_finish(list, files[i].path);
+        if (list == NULL) {
+            ESP_LOGW(TAG, "No station in %s", files[i].path);
+        }
+        return list;
+    }
+    return NULL;
+}
+
+esp_err_t station_list_save_nvs(station_list_handle_t list)
+{
+    AUDIO_NULL_CHECK(TAG, list, return ESP_ERR_INVALID_ARG);
+    nvs_handle_t nvs;
+    esp_err_t ret = nvs_open(STATION_LIST_NAMESPACE, NVS_READWRITE, &nvs);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    size_t len = 0;
+    if (nvs_get_blob(nvs, STATION_LIST_KEY, NULL, &len) == ESP_OK && len == list->size) {
+        char *stored = mem_policy_malloc(MEM_BULK, len);
+        bool same = stored && nvs_get_blob(nvs, STATION_LIST_KEY, stored, &len) == ESP_OK
+                    && memcmp(stored, list->table, len) == 0;
+        mem_policy_free(stored);
+        if (same) {
+            nvs_close(nvs);
+            return ESP_OK;
+        }
+    }
+    ret = nvs_set_blob(nvs, STATION_LIST_KEY, list->table, list->size);
+    if (ret == ESP_OK) {
+        ret = nvs_commit(nvs);
+    }
+    nvs_close(nvs);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "%d stations not kept in NVS, %s", list->count, esp_err_to_name(ret));
+        return ret;
+    }
+    ESP_LOGI(TAG, "%d stations kept in NVS", list->count);
+    return ESP_OK;
+}
+
+int station_list_count(station_list_handle_t list)
+{
+    return list ? list->count : 0;
+}
+
+const char *const *station_list_urls(station_list_handle_t list)
+{
+    return list ? list->urls : NULL;
+}
+
+const char *station_list_url(station_list_handle_t list, int station)
+{
+    if (list == NULL || station < 0 || station >= list->count) {
+        return NULL;
+    }
+    return list->urls[station];
+}
+
+const char *station_list_name(station_list_handle_t list, int station)
+{
+    const char *url = station_list_url(list, station);
+    return url ? url + strlen(url) + 1 : "";
+}
+
+void station_list_destroy(station_list_handle_t list)
+{
+    if (list == NULL) {
+        return;
+    }
+    mem_policy_free(list->urls);
+    mem_policy_free(list->table);
+    mem_policy_free(list);
+}
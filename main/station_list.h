@@ -0,0 +1,66 @@
+#ifndef __STATION_LIST_H__
+#define __STATION_LIST_H__
+
+#include "esp_err.h"
+
+/*
+ * The radio stations, as many as the list holds, in one compact string table.
+ *
+ * The table stores "url\0name\0" for every station back to back, and an index
+ * of pointers into it gives a station by its number in O(1); a station costs
+ * its text and one pointer. The list is read from the SD card, an M3U file
+ * (STATION_LIST_M3U, names from #EXTINF) or else a PLS file
+ * (STATION_LIST_PLS, names from TitleN), and kept in NVS as the table itself,
+ * so the radio keeps the stations of the last card without it. Without
+ * either the built-in list applies.
+ *
+ * A list never changes once built, a new one replaces it while the radio is stopped.
+ */
+
+#define STATION_LIST_M3U        "/sdcard/stations.m3u"
+#define STATION_LIST_PLS        "/sdcard/stations.pls"
+#define STATION_LIST_LINE_MAX   (512)   /* Longest line of a list file, longer entries are skipped */
+
+typedef struct station_list *station_list_handle_t;
+
+/**
+ * @brief Build a list from an array of URLs, e.g. the built-in stations
+ */
+station_list_handle_t station_list_from_array(const char *const *urls, int count);
+
+/**
+ * @brief Read the list kept in NVS, call after nvs_flash_init()
+ *
+ * @return The list, NULL when NVS holds none
+ */
+station_list_handle_t station_list_load_nvs(void);
+
+/**
+ * @brief Read the list file of the mounted card, the M3U one first
+ *
+ * @return The list, NULL when the card has no list file or no station in it
+ */
+station_list_handle_t station_list_load_card(void);
+
+/**
+ * @brief Keep the list in NVS, nothing is written when NVS holds the same one
+ */
+esp_err_t station_list_save_nvs(station_list_handle_t list);
+
+int station_list_count(station_list_handle_t list);
+
+/**
+ * @brief The URL of every station, valid as long as the list
+ */
+const char *const *station_list_urls(station_list_handle_t list);
+
+const char *station_list_url(station_list_handle_t list, int station);
+
+/**
+ * @brief The name the list file gave the station, "" without one
+ */
+const char *station_list_name(station_list_handle_t list, int station);
+
+void station_list_destroy(station_list_handle_t list);
+
+#endif
@@ -0,0 +1,394 @@
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "audio_error.h"
+#include "audio_mem.h"
+#include "audio_element.h"
+#include "ringbuf.h"
+#include "output_stage.h"
+#include "radio_reader.h"
+#include "telemetry.h"
+
+#define TELEMETRY_TASK_STACK    (3 * 1024)
+#define TELEMETRY_TASK_PRIO     (1)
+#define TELEMETRY_TASK_CORE     (0)
+#define TELEMETRY_SPARE_TASKS   (4)     /* Tasks that may start between counting and listing them */
+#define TELEMETRY_MP3_FRAME     (1152)  /* Samples per channel in an MPEG-1 layer III frame */
+#define TELEMETRY_MP3_HALF_RATE (32000) /* MPEG-2 rates below this carry 576 */
+#define TELEMETRY_STACK_POLL_MS (1000)
+#define TELEMETRY_STACK_MIN     (2048)  /* Smallest stack the task plan takes */
+#define TELEMETRY_STACK_ALIGN   (256)
+
+static const char *TAG = "TELEMETRY";
+
+struct telemetry {
+    player_pipeline_handle_t    player;
+    int                         period_s;
+    SemaphoreHandle_t           lock;       /* Serialises the periodic and the on-demand samples */
+    TaskHandle_t                task;
+    SemaphoreHandle_t           task_done;
+    volatile bool               quit;
+    int64_t                     last_us;
+    uint32_t                    last_total;
+    const char                  *stack_tag[TELEMETRY_MAX_ELEMENTS];
+    uint32_t                    stack_peak[TELEMETRY_MAX_ELEMENTS]; /* Deepest use over every run of the task */
+    audio_element_handle_t      last_el[TELEMETRY_MAX_ELEMENTS];
+    uint32_t                    last_runtime[TELEMETRY_MAX_ELEMENTS];
+    uint64_t                    last_bytes[TELEMETRY_MAX_ELEMENTS];
+    telemetry_report_t          report;
+};
+
+static const char *const s_state_names[] = {
+    [AEL_STATE_NONE]            = "none",
+    [AEL_STATE_INIT]            = "init",
+    [AEL_STATE_INITIALIZING]    = "init",
+    [AEL_STATE_RUNNING]         = "run",
+    [AEL_STATE_PAUSED]          = "pause",
+    [AEL_STATE_STOPPED]         = "stop",
+    [AEL_STATE_FINISHED]        = "done",
+    [AEL_STATE_ERROR]           = "error",
+};
+
+static int tm_fill(ringbuf_handle_t rb)
+{
+    if (rb == NULL || rb_get_size(rb) <= 0) {
+        return TELEMETRY_NO_RB;
+    }
+    return rb_bytes_filled(rb) * 100 / rb_get_size(rb);
+}
+
+/* The element task is named after the pipeline tag, "el-" prefixed on some ADF versions */
+static bool tm_is_element_task(const char *task, const char *tag)
+{
+    if (strncmp(task, "el-", 3) == 0) {
+        task += 3;
+    }
+    return strncmp(task, tag, configMAX_TASK_NAME_LEN) == 0;
+}
+
+static int tm_elements(telemetry_handle_t tm, audio_element_handle_t *els)
+{
+    player_pipeline_handle_t player = tm->player;
+    int n = 0;
+    els[n++] = player->file_reader;
+    els[n++] = player->http_reader;
+    if (player->source == PLAYER_SOURCE_BT && player->bt_reader) {
+        /* Only sampled while linked, it is destroyed with the Bluetooth service */
+        els[n++] = player->bt_reader;
+    }
+    els[n++] = player->mp3_decoder;
+    els[n++] = player->flac_decoder;
+    els[n++] = player->dsp;
+    els[n++] = player->output;
+    if (player->sink == player->i2s_writer) {
+        els[n++] = player->i2s_writer;
+    }
+    if (player->side) {
+        els[n++] = player->side_file;
+        els[n++] = player->side_http;
+        els[n++] = player->side_mp3;
+    }
+    return n;
+}
+
+/* The element tasks end on every source switch, so the deepest use is kept here across their runs */
+static void tm_note_stack(telemetry_handle_t tm, const char *tag, uint32_t stack_free)
+{
+    int stack = player_pipeline_task_stack(tag);
+    if (stack <= 0 || stack_free == TELEMETRY_UNKNOWN || stack_free > stack) {
+        return;
+    }
+    for (int i = 0; i < TELEMETRY_MAX_ELEMENTS; i++) {
+        if (tm->stack_tag[i] == NULL) {
+            tm->stack_tag[i] = tag;
+        }
+        if (strcmp(tm->stack_tag[i], tag) == 0) {
+            if (stack - stack_free > tm->stack_peak[i]) {
+                tm->stack_peak[i] = stack - stack_free;
+            }
+            return;
+        }
+    }
+}
+
+static TaskStatus_t *tm_list_tasks(UBaseType_t *task_num, uint32_t *total)
+{
+    TaskStatus_t *tasks = NULL;
+    *task_num = 0;
+#if configUSE_TRACE_FACILITY
+    UBaseType_t num = uxTaskGetNumberOfTasks() + TELEMETRY_SPARE_TASKS;
+    tasks = audio_malloc(num * sizeof(TaskStatus_t));
+    if (tasks) {
+        *task_num = uxTaskGetSystemState(tasks, num, total);
+    }
+#endif
+    return tasks;
+}
+
+static void tm_track_stacks(telemetry_handle_t tm)
+{
+    audio_element_handle_t els[TELEMETRY_MAX_ELEMENTS];
+    int count = tm_elements(tm, els);
+    UBaseType_t task_num;
+    uint32_t total;
+    TaskStatus_t *tasks = tm_list_tasks(&task_num, &total);
+    for (int t = 0; t < task_num; t++) {
+        for (int i = 0; i < count; i++) {
+            const char *tag = audio_element_get_tag(els[i]);
+            if (tm_is_element_task(tasks[t].pcTaskName, tag)) {
+                tm_note_stack(tm, tag, tasks[t].usStackHighWaterMark);
+                break;
+            }
+        }
+    }
+    audio_free(tasks);
+}
+
+static void tm_take(telemetry_handle_t tm, telemetry_report_t *r)
+{
+    int64_t now_us = esp_timer_get_time();
+    uint32_t elapsed_us = (uint32_t)(now_us - tm->last_us);
+    audio_element_handle_t els[TELEMETRY_MAX_ELEMENTS];
+    memset(r, 0, sizeof(*r));
+    r->period_ms = elapsed_us / 1000;
+    r->source = tm->player->source;
+    r->count = tm_elements(tm, els);
+
+    UBaseType_t task_num;
+    uint32_t total = 0;
+    TaskStatus_t *tasks = tm_list_tasks(&task_num, &total);
+
+    uint32_t mp3_runtime = TELEMETRY_UNKNOWN;
+    uint64_t dsp_bytes = 0;
+    for (int i = 0; i < r->count; i++) {
+        audio_element_handle_t el = els[i];
+        telemetry_element_t *e = &r->el[i];
+        e->tag = audio_element_get_tag(el);
+        e->state = audio_element_get_state(el);
+        e->in_fill = tm_fill(audio_element_get_input_ringbuf(el));
+        e->out_fill = tm_fill(audio_element_get_output_ringbuf(el));
+        audio_element_info_t info = {0};
+        audio_element_getinfo(el, &info);
+        e->bytes = info.byte_pos;
+        /* A new run restarts the count, the element changed when the Bluetooth reader was swapped */
+        uint64_t moved = (tm->last_el[i] == el && e->bytes >= tm->last_bytes[i]) ? e->bytes - tm->last_bytes[i] : e->bytes;
+        e->bytes_per_s = elapsed_us ? (uint32_t)(moved * 1000000 / elapsed_us) : 0;
+
+        e->cpu_permille = TELEMETRY_UNKNOWN;
+        e->stack_free = TELEMETRY_UNKNOWN;
+        uint32_t runtime = 0;
+        for (int t = 0; t < task_num; t++) {
+            if (tm_is_element_task(tasks[t].pcTaskName, e->tag)) {
+                runtime = tasks[t].ulRunTimeCounter;
+                e->stack_free = tasks[t].usStackHighWaterMark;
+                tm_note_stack(tm, e->tag, e->stack_free);
+                uint32_t delta_total = total - tm->last_total;
+                if (tm->last_el[i] == el && delta_total > 0 && runtime >= tm->last_runtime[i]) {
+                    uint32_t busy = runtime - tm->last_runtime[i];
+                    e->cpu_permille = (uint32_t)((uint64_t)busy * 1000 / delta_total);
+                    if (el == tm->player->mp3_decoder) {
+                        mp3_runtime = busy;
+                    }
+                }
+                break;
+            }
+        }
+        if (el == tm->player->dsp) {
+            dsp_bytes = moved;
+        }
+        tm->last_el[i] = el;
+        tm->last_runtime[i] = runtime;
+        tm->last_bytes[i] = e->bytes;
+    }
+    audio_free(tasks);
+
+    /* The DSP passes every decoded frame on, its byte count gives the frames the decoder produced */
+    r->decode_us = TELEMETRY_UNKNOWN;
+    player_pipeline_handle_t player = tm->player;
+    int frame_bytes = player->channels * (player->bits >> 3);
+    if ((r->source == PLAYER_SOURCE_SDCARD || r->source == PLAYER_SOURCE_HTTP)
+        && mp3_runtime != TELEMETRY_UNKNOWN && frame_bytes > 0 && dsp_bytes > 0) {
+        int spf = player->programme_rate >= TELEMETRY_MP3_HALF_RATE ? TELEMETRY_MP3_FRAME : TELEMETRY_MP3_FRAME / 2;
+        uint64_t mp3_frames = dsp_bytes / frame_bytes / spf;
+        if (mp3_frames > 0) {
+            r->decode_us = (uint32_t)(mp3_runtime / mp3_frames);
+        }
+    }
+
+    output_stage_stats_t stats;
+    output_stage_get_stats(player->output, &stats);
+    r->i2s_underruns = stats.underruns;
+    r->queued_ms = stats.queued_us / 1000;
+    r->queued_max_ms = stats.queued_max_us / 1000;
+    radio_link_stats_t link;
+    radio_reader_get_link_stats(player->http_reader, &link);
+    r->radio_drops = link.drops;
+    r->radio_reconnects = link.reconnects;
+    r->radio_outage_ms = link.outage_ms;
+    r->radio_outage_max_ms = link.outage_max_ms;
+    r->radio_down = link.down;
+    speaker_dsp_drift_stats_t drift;
+    speaker_dsp_get_drift_stats(player->dsp, &drift);
+    r->bt_drift_ppm = drift.drift_ppm;
+    r->bt_ratio_ppm = drift.ratio_ppm;
+    r->bt_depth_ms = (uint32_t)(drift.depth_ms + 0.5f);
+    r->bt_target_ms = drift.target_ms;
+    r->bt_slips = drift.slips;
+    r->heap_free = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    r->heap_min_free = heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL);
+    r->heap_largest = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL);
+
+    tm->last_us = now_us;
+    tm->last_total = total;
+    tm->report = *r;
+}
+
+void telemetry_log(const telemetry_report_t *r)
+{
+    ESP_LOGI(TAG, "%s over %u ms: heap %u free, %u low, %u block, i2s underruns %u, output queue %u ms (max %u), "
+             "decode %d us/frame", player_pipeline_source_name(r->source), r->period_ms, r->heap_free, r->heap_min_free,
+             r->heap_largest, r->i2s_underruns, r->queued_ms, r->queued_max_ms,
+             r->decode_us == TELEMETRY_UNKNOWN ? -1 : (int)r->decode_us);
+    if (r->source == PLAYER_SOURCE_HTTP) {
+        ESP_LOGI(TAG, "  radio %s, %u drops, %u reconnects, outage %u ms (max %u)", r->radio_down ? "reconnecting" : "up",
+                 r->radio_drops, r->radio_reconnects, r->radio_outage_ms, r->radio_outage_max_ms);
+    }
+    if (r->source == PLAYER_SOURCE_BT && r->bt_target_ms) {
+        ESP_LOGI(TAG, "  bt drift %+.1f ppm, corrected %+.1f ppm, buffer %u ms of %u, %u slips", r->bt_drift_ppm,
+                 r->bt_ratio_ppm, r->bt_depth_ms, r->bt_target_ms, r->bt_slips);
+    }
+    for (int i = 0; i < r->count; i++) {
+        const telemetry_element_t *e = &r->el[i];
+        char cpu[8] = "-";
+        if (e->cpu_permille != TELEMETRY_UNKNOWN) {
+            snprintf(cpu, sizeof(cpu), "%u.%u%%", e->cpu_permille / 10, e->cpu_permille % 10);
+        }
+        ESP_LOGI(TAG, "  %-6s %-5s cpu %6s in %3d%% out %3d%% %6u B/s %8llu B stack %d",
+                 e->tag ? e->tag : "?", e->state < sizeof(s_state_names) / sizeof(s_state_names[0]) ? s_state_names[e->state] : "?",
+                 cpu, e->in_fill, e->out_fill, e->bytes_per_s, (unsigned long long)e->bytes,
+                 e->stack_free == TELEMETRY_UNKNOWN ? -1 : (int)e->stack_free);
+    }
+}
+
+static void telemetry_task(void *pv)
+{
+    telemetry_handle_t tm = (telemetry_handle_t)pv;
+    TickType_t period = pdMS_TO_TICKS(tm->period_s * 1000);
+    TickType_t last_wake = xTaskGetTickCount();
+    TickType_t last_stacks = last_wake;
+    while (!tm->quit) {
+        /* Wake often enough to notice a stop, follow the stacks every second and report once a period */
+        vTaskDelay(pdMS_TO_TICKS(100));
+        if (xTaskGetTickCount() - last_stacks >= pdMS_TO_TICKS(TELEMETRY_STACK_POLL_MS)) {
+            last_stacks = xTaskGetTickCount();
+            xSemaphoreTake(tm->lock, portMAX_DELAY);
+            tm_track_stacks(tm);
+            xSemaphoreGive(tm->lock);
+        }
+        if (xTaskGetTickCount() - last_wake < period) {
+            continue;
+        }
+        last_wake = xTaskGetTickCount();
+        telemetry_report_t report;
+        xSemaphoreTake(tm->lock, portMAX_DELAY);
+        tm_take(tm, &report);
+        xSemaphoreGive(tm->lock);
+        telemetry_log(&report);
+    }
+    xSemaphoreGive(tm->task_done);
+    vTaskDelete(NULL);
+}
+
+telemetry_handle_t telemetry_start(player_pipeline_handle_t player, int period_s)
+{
+    AUDIO_NULL_CHECK(TAG, player, return NULL);
+    telemetry_handle_t tm = audio_calloc(1, sizeof(struct telemetry));
+    AUDIO_MEM_CHECK(TAG, tm, return NULL);
+    tm->player = player;
+    tm->period_s = period_s;
+    tm->lock = xSemaphoreCreateMutex();
+    tm->task_done = xSemaphoreCreateBinary();
+    AUDIO_MEM_CHECK(TAG, tm->lock && tm->task_done, goto _start_failed);
+    tm->last_us = esp_timer_get_time();
+    /* The first report is taken over the time from here */
+    telemetry_report_t report;
+    tm_take(tm, &report);
+
+    if (period_s > 0 && xTaskCreatePinnedToCore(telemetry_task, "telemetry", TELEMETRY_TASK_STACK, tm,
+                                                TELEMETRY_TASK_PRIO, &tm->task, TELEMETRY_TASK_CORE) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to start the telemetry task");
+        goto _start_failed;
+    }
+#if !configGENERATE_RUN_TIME_STATS
+    ESP_LOGW(TAG, "FreeRTOS run time statistics are disabled, no CPU shares");
+#endif
+    return tm;
+
+_start_failed:
+    tm->task = NULL;
+    telemetry_stop(tm);
+    return NULL;
+}
+
+void telemetry_stop(telemetry_handle_t tm)
+{
+    if (tm == NULL) {
+        return;
+    }
+    if (tm->task) {
+        tm->quit = true;
+        xSemaphoreTake(tm->task_done, portMAX_DELAY);
+    }
+    if (tm->lock) {
+        vSemaphoreDelete(tm->lock);
+    }
+    if (tm->task_done) {
+        vSemaphoreDelete(tm->task_done);
+    }
+    audio_free(tm);
+}
+
+esp_err_t telemetry_sample(telemetry_handle_t tm, telemetry_report_t *report)
+{
+    AUDIO_NULL_CHECK(TAG, tm && report, return ESP_ERR_INVALID_ARG);
+    xSemaphoreTake(tm->lock, portMAX_DELAY);
+    tm_take(tm, report);
+    xSemaphoreGive(tm->lock);
+    return ESP_OK;
+}
+
+esp_err_t telemetry_get_report(telemetry_handle_t tm, telemetry_report_t *report)
+{
+    AUDIO_NULL_CHECK(TAG, tm && report, return ESP_ERR_INVALID_ARG);
+    xSemaphoreTake(tm->lock, portMAX_DELAY);
+    *report = tm->report;
+    xSemaphoreGive(tm->lock);
+    return ESP_OK;
+}
+
+void telemetry_log_stacks(telemetry_handle_t tm)
+{
+    if (tm == NULL) {
+        return;
+    }
+    xSemaphoreTake(tm->lock, portMAX_DELAY);
+    tm_track_stacks(tm);
+    ESP_LOGI(TAG, "Element task stacks, deepest use since boot:");
+    for (int i = 0; i < TELEMETRY_MAX_ELEMENTS && tm->stack_tag[i]; i++) {
+        int stack = player_pipeline_task_stack(tm->stack_tag[i]);
+        uint32_t peak = tm->stack_peak[i];
+        /* A quarter on top of the deepest use seen, for the paths the session did not take */
+        uint32_t fit = (peak + peak / 4 + TELEMETRY_STACK_ALIGN - 1) / TELEMETRY_STACK_ALIGN * TELEMETRY_STACK_ALIGN;
+        if (fit < TELEMETRY_STACK_MIN) {
+            fit = TELEMETRY_STACK_MIN;
+        }
+        ESP_LOGI(TAG, "  %-6s %5d B, used %5u B (%u%%), fits in %u B", tm->stack_tag[i], stack, peak,
+                 stack > 0 ? peak * 100 / stack : 0, fit);
+    }
+    xSemaphoreGive(tm->lock);
+}
@@ -0,0 +1,105 @@
+#ifndef __TELEMETRY_H__
+#define __TELEMETRY_H__
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "audio_element.h"
+#include "player_pipeline.h"
+
+/*
+ * Per-element telemetry of the playback pipeline.
+ *
+ * A low priority task samples every element of the pipeline once a period:
+ * the CPU share of its task, the fill of its input and output ringbuffers,
+ * the bytes it reported moving and the free stack left at its deepest point.
+ * Next to that it keeps the decode time per MP3 frame, the times the i2s
+ * writer ran dry, the drops and reconnects of the radio link, the clock
+ * drift of a Bluetooth source and the depth its stream is held at, and the
+ * internal heap low-water mark. The period ends with
+ * a compact report in the log; the last report can be read at any time, and
+ * a fresh one can be taken on demand.
+ *
+ * The CPU shares come from the FreeRTOS run time statistics, enabled with
+ * CONFIG_SPEAKER_TELEMETRY.
+ */
+
+#define TELEMETRY_MAX_ELEMENTS  (12)
+#define TELEMETRY_NO_RB         (-1)
+#define TELEMETRY_UNKNOWN       (UINT32_MAX)
+
+typedef struct {
+    const char              *tag;       /* Pipeline tag: "file", "http", "bt", "mp3", "flac", "dsp", "output", "i2s", "*_b" of the second deck */
+    audio_element_state_t   state;
+    uint32_t                cpu_permille;   /* Of one core over the period, TELEMETRY_UNKNOWN without a task */
+    int                     in_fill;        /* Percent, TELEMETRY_NO_RB when unlinked */
+    int                     out_fill;
+    uint64_t                bytes;          /* Reported by the element since its last reset */
+    uint32_t                bytes_per_s;    /* Over the period */
+    uint32_t                stack_free;     /* Least free stack the task ever had, TELEMETRY_UNKNOWN without a task */
+} telemetry_element_t;
+
+typedef struct {
+    uint32_t                period_ms;      /* Time the rates and CPU shares are taken over */
+    player_source_t         source;
+    int                     count;
+    telemetry_element_t     el[TELEMETRY_MAX_ELEMENTS];
+    uint32_t                decode_us;      /* CPU time per MP3 frame, TELEMETRY_UNKNOWN when not decoding */
+    uint32_t                i2s_underruns;  /* Since boot */
+    uint32_t                queued_ms;      /* Audio between the output stage and the codec at the last block */
+    uint32_t                queued_max_ms;  /* Most of it since the run started */
+    uint32_t                radio_drops;    /* Since boot, the playing station was lost */
+    uint32_t                radio_reconnects;
+    uint32_t                radio_outage_ms;        /* Of the last drop, data to data */
+    uint32_t                radio_outage_max_ms;
+    bool                    radio_down;     /* Reconnecting right now */
+    float                   bt_drift_ppm;   /* Clock of the Bluetooth source against ours */
+    float                   bt_ratio_ppm;   /* Correction the resampler runs at */
+    uint32_t                bt_depth_ms;    /* Average fill of the Bluetooth buffer over the last second */
+    uint32_t                bt_target_ms;
+    uint32_t                bt_slips;       /* Since the DSP element was created, the fill was put back to the target */
+    uint32_t                heap_free;      /* Internal RAM */
+    uint32_t                heap_min_free;  /* Internal RAM low-water mark since boot */
+    uint32_t                heap_largest;   /* Largest free internal block */
+} telemetry_report_t;
+
+typedef struct telemetry *telemetry_handle_t;
+
+/**
+ * @brief Start sampling the pipeline
+ *
+ * @param player    The pipeline to sample, it must outlive the telemetry
+ * @param period_s  Seconds between logged reports, 0 samples only on demand
+ *
+ * @return The telemetry handle, NULL on failure
+ */
+telemetry_handle_t telemetry_start(player_pipeline_handle_t player, int period_s);
+
+/**
+ * @brief Stop the sampling task and free the telemetry
+ */
+void telemetry_stop(telemetry_handle_t tm);
+
+/**
+ * @brief Take a report now, over the time since the previous one
+ */
+esp_err_t telemetry_sample(telemetry_handle_t tm, telemetry_report_t *report);
+
+/**
+ * @brief Copy the last report taken, periodic or on demand
+ */
+esp_err_t telemetry_get_report(telemetry_handle_t tm, telemetry_report_t *report);
+
+/**
+ * @brief Log a report, one line per element
+ */
+void telemetry_log(const telemetry_report_t *report);
+
+/**
+ * @brief Log the deepest stack use of every element task that ran, with a size that fits it
+ *
+ * The use is followed across every run of the tasks, once a second while the
+ * periodic reports are on and whenever a report is taken.
+ */
+void telemetry_log_stacks(telemetry_handle_t tm);
+
+#endif
@@ -0,0 +1,126 @@
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/event_groups.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_event.h"
+#include "esp_netif.h"
+#include "esp_wifi.h"
+#include "wifi_link.h"
+
+static const char *TAG = "WIFI_LINK";
+
+#define WIFI_LINK_CONNECTED     BIT0
+
+typedef struct {
+    esp_netif_t                     *netif;
+    EventGroupHandle_t              state;
+    esp_event_handler_instance_t    wifi_handler;
+    esp_event_handler_instance_t    ip_handler;
+    volatile bool                   stopping;
+    int64_t                         start_us;
+} wifi_link_t;
+
+static wifi_link_t s_link;
+
+static void wifi_link_event(void *arg, esp_event_base_t base, int32_t id, void *data)
+{
+    if (base == WIFI_EVENT && id == WIFI_EVENT_STA_START) {
+        esp_wifi_connect();
+    } else if (base == WIFI_EVENT && id == WIFI_EVENT_STA_DISCONNECTED) {
+        xEventGroupClearBits(s_link.state, WIFI_LINK_CONNECTED);
+        if (!s_link.stopping) {
+            wifi_event_sta_disconnected_t *event = (wifi_event_sta_disconnected_t *)data;
+            ESP_LOGW(TAG, "Disconnected (reason %d), reconnecting", event->reason);
+            esp_wifi_connect();
+        }
+    } else if (base == IP_EVENT && id == IP_EVENT_STA_GOT_IP) {
+        ESP_LOGI(TAG, "Connected in %d ms", (int)((esp_timer_get_time() - s_link.start_us) / 1000));
+        xEventGroupSetBits(s_link.state, WIFI_LINK_CONNECTED);
+    }
+}
+
+esp_err_t wifi_link_start(const char *ssid, const char *password)
+{
+    if (s_link.netif) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    s_link.start_us = esp_timer_get_time();
+    s_link.stopping = false;
+    /* The default loop outlives the link, it is only created on the first start */
+    esp_err_t ret = esp_event_loop_create_default();
+    if (ret != ESP_OK && ret != ESP_ERR_INVALID_STATE) {
+        return ret;
+    }
+    if (s_link.state == NULL) {
+        s_link.state = xEventGroupCreate();
+        if (s_link.state == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    xEventGroupClearBits(s_link.state, WIFI_LINK_CONNECTED);
+
+    s_link.netif = esp_netif_create_default_wifi_sta();
+    if (s_link.netif == NULL) {
+        return ESP_FAIL;
+    }
+    wifi_init_config_t init_cfg = WIFI_INIT_CONFIG_DEFAULT();
+    ret = esp_wifi_init(&init_cfg);
+    if (ret != ESP_OK) {
+        goto _start_failed;
+    }
+    esp_event_handler_instance_register(WIFI_EVENT, ESP_EVENT_ANY_ID, wifi_link_event, NULL, &s_link.wifi_handler);
+    esp_event_handler_instance_register(IP_EVENT, IP_EVENT_STA_GOT_IP, wifi_link_event, NULL, &s_link.ip_handler);
+
+    wifi_config_t sta_cfg = { 0 };
+    strlcpy((char *)sta_cfg.sta.ssid, ssid, sizeof(sta_cfg.sta.ssid));
+    strlcpy((char *)sta_cfg.sta.password, password, sizeof(sta_cfg.sta.password));
+    esp_wifi_set_storage(WIFI_STORAGE_RAM);
+    esp_wifi_set_mode(WIFI_MODE_STA);
+    esp_wifi_set_config(WIFI_IF_STA, &sta_cfg);
+    ret = esp_wifi_start();
+    if (ret != ESP_OK) {
+        goto _start_failed;
+    }
+    return ESP_OK;
+
+_start_failed:
+    ESP_LOGE(TAG, "Wi-Fi start failed, %s", esp_err_to_name(ret));
+    wifi_link_stop();
+    return ret;
+}
+
+esp_err_t wifi_link_wait_connected(TickType_t ticks)
+{
+    if (s_link.state == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    EventBits_t bits = xEventGroupWaitBits(s_link.state, WIFI_LINK_CONNECTED, pdFALSE, pdTRUE, ticks);
+    return (bits & WIFI_LINK_CONNECTED) ? ESP_OK : ESP_ERR_TIMEOUT;
+}
+
+void wifi_link_stop(void)
+{
+    if (s_link.netif == NULL) {
+        return;
+    }
+    int64_t start_us = esp_timer_get_time();
+    s_link.stopping = true;
+    if (s_link.wifi_handler) {
+        esp_event_handler_instance_unregister(WIFI_EVENT, ESP_EVENT_ANY_ID, s_link.wifi_handler);
+        s_link.wifi_handler = NULL;
+    }
+    if (s_link.ip_handler) {
+        esp_event_handler_instance_unregister(IP_EVENT, IP_EVENT_STA_GOT_IP, s_link.ip_handler);
+        s_link.ip_handler = NULL;
+    }
+    /* Each call fails harmlessly on a driver that did not get that far */
+    esp_wifi_disconnect();
+    esp_wifi_stop();
+    esp_wifi_deinit();
+    esp_wifi_clear_default_wifi_driver_and_handlers(s_link.netif);
+    esp_netif_destroy(s_link.netif);
+    s_link.netif = NULL;
+    xEventGroupClearBits(s_link.state, WIFI_LINK_CONNECTED);
+    ESP_LOGI(TAG, "Wi-Fi released in %d ms", (int)((esp_timer_get_time() - start_us) / 1000));
+}
@@ -0,0 +1,35 @@
+#ifndef __WIFI_LINK_H__
+#define __WIFI_LINK_H__
+
+#include "freertos/FreeRTOS.h"
+#include "esp_err.h"
+
+/*
+ * The station link of the radio mode.
+ *
+ * The link is brought up when the radio mode starts and taken down completely
+ * when it exits: driver, event handlers and the default station netif are
+ * released, so the speaker can go back to SD or Bluetooth playback without a
+ * restart and bring the link up again on the next cycle. The credentials are
+ * kept in RAM only, a mode cycle writes nothing to NVS. A dropped link is
+ * reconnected until wifi_link_stop().
+ */
+
+/**
+ * @brief Start the driver and connect, call esp_netif_init() once before
+ */
+esp_err_t wifi_link_start(const char *ssid, const char *password);
+
+/**
+ * @brief Wait for an IP address
+ *
+ * @return ESP_OK once connected, ESP_ERR_TIMEOUT otherwise
+ */
+esp_err_t wifi_link_wait_connected(TickType_t ticks);
+
+/**
+ * @brief Disconnect and release the driver and the netif, nothing is left running
+ */
+void wifi_link_stop(void);
+
+#endif
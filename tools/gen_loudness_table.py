@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+#
+# Build the loudness compensation coefficient tables from tools/loudness/curves.json.
+#
+# The spec lists the gain of every EQ band at a few anchor volumes. The gains are
+# interpolated linearly (in dB) to every volume step from 0 to 100 % and turned into
+# RBJ peaking biquads for every supported sample rate, so the firmware never computes
+# a coefficient at run time: a volume change only selects another precomputed set.
+# Bands at or above 0.45 x the sample rate are left flat.
+#
+# Every biquad is stored as { b0, b1, b2, a1, a2 } with a0 normalized to 1, the layout
+# the ESP-DSP biquad kernels take:
+#   python3 tools/gen_loudness_table.py
+
+import argparse
+import json
+import math
+import os
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+STEPS = 101
+
+
+def interpolate(curves, volume):
+    curves = sorted(curves, key=lambda c: c['volume'])
+    if volume <= curves[0]['volume']:
+        return curves[0]['gain_db']
+    for lo, hi in zip(curves, curves[1:]):
+        if volume <= hi['volume']:
+            t = (volume - lo['volume']) / (hi['volume'] - lo['volume'])
+            return [a + (b - a) * t for a, b in zip(lo['gain_db'], hi['gain_db'])]
+    return curves[-1]['gain_db']
+
+
+def peaking(freq, gain_db, q, rate):
+    if freq >= 0.45 * rate or gain_db == 0:
+        return [1.0, 0.0, 0.0, 0.0, 0.0]
+    a = 10 ** (gain_db / 40)
+    w0 = 2 * math.pi * freq / rate
+    alpha = math.sin(w0) / (2 * q)
+    cos_w0 = math.cos(w0)
+    a0 = 1 + alpha / a
+    return [(1 + alpha * a) / a0, -2 * cos_w0 / a0, (1 - alpha * a) / a0,
+            -2 * cos_w0 / a0, (1 - alpha / a) / a0]
+
+
+def write_header(path, spec):
+    lines = [
+        '/* Generated by tools/gen_loudness_table.py from tools/loudness/curves.json, do not edit */',
+        '#ifndef __LOUDNESS_TABLE_H__',
+        '#define __LOUDNESS_TABLE_H__',
+        '',
+        '#define LOUDNESS_BANDS          (%d)' % len(spec['bands_hz']),
+        '#define LOUDNESS_STEPS          (%d)' % STEPS,
+        '#define LOUDNESS_RATE_NUM       (%d)' % len(spec['sample_rates']),
+        '',
+        '/* One volume step: a biquad { b0, b1, b2, a1, a2 } per band */',
+        'typedef struct {',
+        '    float   coef[LOUDNESS_BANDS][5];',
+        '} loudness_coefs_t;',
+        '',
+        'typedef struct {',
+        '    int                     sample_rate;',
+        '    const loudness_coefs_t  *steps;     /* LOUDNESS_STEPS sets, indexed by the volume in % */',
+        '} loudness_rate_t;',
+        '',
+        'extern const loudness_rate_t loudness_rates[LOUDNESS_RATE_NUM];',
+        '',
+        '#endif',
+        '',
+    ]
+    with open(path, 'w') as f:
+        f.write('\n'.join(lines))
+
+
+def write_source(path, spec):
+    lines = [
+        '/* Generated by tools/gen_loudness_table.py from tools/loudness/curves.json, do not edit */',
+        '#include "loudness_table.h"',
+        '',
+    ]
+    for rate in spec['sample_rates']:
+        lines.append('static const loudness_coefs_t s_loudness_%d[LOUDNESS_STEPS] = {' % rate)
+        for step in range(STEPS):
+            gains = interpolate(spec['curves'], step)
+            bands = [peaking(f, g, spec['q'], rate) for f, g in zip(spec['bands_hz'], gains)]
+            lines.append('    { { /* %d %% */' % step)
+            for band in bands:
+                lines.append('        { %s },' % ', '.join('%.9ef' % c for c in band))
+            lines.append('    } },')
+        lines += ['};', '']
+    lines.append('const loudness_rate_t loudness_rates[LOUDNESS_RATE_NUM] = {')
+    lines += ['    { %d, s_loudness_%d },' % (rate, rate) for rate in spec['sample_rates']]
+    lines += ['};', '']
+    with open(path, 'w') as f:
+        f.write('\n'.join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate the loudness compensation coefficient tables')
+    parser.add_argument('--spec', default=os.path.join(ROOT, 'tools', 'loudness', 'curves.json'))
+    parser.add_argument('--out', default=os.path.join(ROOT, 'components', 'speaker_core', 'loudness_table'))
+    args = parser.parse_args()
+
+    with open(args.spec) as f:
+        spec = json.load(f)
+    for c in spec['curves']:
+        if len(c['gain_db']) != len(spec['bands_hz']):
+            sys.exit('Curve at %d %% has %d gains for %d bands' % (c['volume'], len(c['gain_db']), len(spec['bands_hz'])))
+
+    write_header(args.out + '.h', spec)
+    write_source(args.out + '.c', spec)
+    size = len(spec['sample_rates']) * STEPS * len(spec['bands_hz']) * 5 * 4
+    print('%s.c: %d rates x %d steps x %d bands, %d bytes of coefficients' % (args.out, len(spec['sample_rates']),
+                                                                          STEPS, len(spec['bands_hz']), size))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+#
+# Build the polyphase filter tables of the fixed-rate output resampler.
+#
+# Every pair of a programme rate and an output rate is a rational ratio up/down.
+# One Kaiser-windowed sinc lowpass is designed at up x the programme rate, with its
+# stopband edge at the lower of the two Nyquist frequencies, and split into `up`
+# phases of TAPS coefficients. The firmware then computes every output sample with
+# one phase and TAPS input frames, no filter is designed at run time.
+#
+# A second bank of FRAC_PHASES + 1 phases at ratio 1 serves the asynchronous resampler
+# of the Bluetooth path: it interpolates between two neighbouring phases for any position
+# between two input frames, the last phase being the first one a frame later.
+#
+# The coefficients are Q14 so the centre tap of a phase (close to 1.0) fits 16 bits,
+# and each phase is stored oldest input first:
+#   python3 tools/gen_resampler_table.py
+
+import argparse
+import math
+import os
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+IN_RATES = [22050, 32000, 44100, 48000]
+OUT_RATES = [44100, 48000]
+TAPS = 32
+Q = 14
+STOP_DB = 60.0
+FRAC_PHASES = 64
+
+
+def bessel_i0(x):
+    total, term, k = 1.0, 1.0, 1
+    while term > 1e-12 * total:
+        term *= (x / (2 * k)) ** 2
+        total += term
+        k += 1
+    return total
+
+
+def design(up, down):
+    """Prototype lowpass at up x the input rate, gain `up` so every phase sums to about 1"""
+    n = TAPS * up
+    beta = 0.1102 * (STOP_DB - 8.7)
+    # Transition band a Kaiser filter of this length reaches, in cycles per upsampled sample
+    width = (STOP_DB - 7.95) / (14.36 * n)
+    stop = 0.5 / max(up, down)
+    cutoff = stop - width / 2
+    centre = (n - 1) / 2
+    taps = []
+    for i in range(n):
+        t = i - centre
+        sinc = 2 * cutoff if t == 0 else math.sin(2 * math.pi * cutoff * t) / (math.pi * t)
+        window = bessel_i0(beta * math.sqrt(1 - (2 * t / (n - 1)) ** 2)) / bessel_i0(beta)
+        taps.append(up * sinc * window)
+    return taps, cutoff
+
+
+def phases(taps, up, count=None):
+    """Phase p holds the taps p, p + up, ... applied newest input first, stored reversed"""
+    table = []
+    for p in range(count or up):
+        coefs = [taps[p + k * up] if p + k * up < len(taps) else 0.0 for k in range(TAPS)]
+        table.append([max(-32768, min(32767, int(round(c * (1 << Q))))) for c in reversed(coefs)])
+    return table
+
+
+def ratios():
+    for out_rate in OUT_RATES:
+        for in_rate in IN_RATES:
+            if in_rate == out_rate:
+                continue
+            g = math.gcd(in_rate, out_rate)
+            yield in_rate, out_rate, out_rate // g, in_rate // g
+
+
+def write_header(path, num, max_ratio_q8):
+    lines = [
+        '/* Generated by tools/gen_resampler_table.py, do not edit */',
+        '#ifndef __RESAMPLER_TABLE_H__',
+        '#define __RESAMPLER_TABLE_H__',
+        '',
+        '#include <stdint.h>',
+        '',
+        '#define RESAMPLER_TAPS          (%d)' % TAPS,
+        '#define RESAMPLER_Q             (%d)' % Q,
+        '#define RESAMPLER_RATIO_NUM     (%d)' % num,
+        '#define RESAMPLER_MAX_RATIO_Q8  (%d)     /* Largest up/down, rounded up, in 1/256 */' % max_ratio_q8,
+        '#define RESAMPLER_FRAC_PHASES   (%d)      /* Positions between two input frames of the fractional bank */' % FRAC_PHASES,
+        '',
+        '/* Output rate = input rate x up / down, `up` phases of RESAMPLER_TAPS coefficients, oldest input first */',
+        'typedef struct {',
+        '    int             in_rate;',
+        '    int             out_rate;',
+        '    int             up;',
+        '    int             down;',
+        '    const int16_t   (*phases)[RESAMPLER_TAPS];',
+        '} resampler_ratio_t;',
+        '',
+        'extern const resampler_ratio_t resampler_ratios[RESAMPLER_RATIO_NUM];',
+        '',
+        '/* Ratio 1 at RESAMPLER_FRAC_PHASES positions between two input frames and the next frame itself */',
+        'extern const int16_t resampler_frac_phases[RESAMPLER_FRAC_PHASES + 1][RESAMPLER_TAPS];',
+        '',
+        '#endif',
+        '',
+    ]
+    with open(path, 'w') as f:
+        f.write('\n'.join(lines))
+
+
+def write_source(path):
+    lines = [
+        '/* Generated by tools/gen_resampler_table.py, do not edit */',
+        '#include "resampler_table.h"',
+        '',
+    ]
+    entries = []
+    for in_rate, out_rate, up, down in ratios():
+        taps, cutoff = design(up, down)
+        name = 's_phases_%d_%d' % (in_rate, out_rate)
+        lines.append('/* %d -> %d Hz, up %d down %d, passband to %.0f Hz */' % (
+            in_rate, out_rate, up, down, (cutoff - (STOP_DB - 7.95) / (14.36 * TAPS * up) / 2) * in_rate * up))
+        lines.append('static const int16_t %s[%d][RESAMPLER_TAPS] = {' % (name, up))
+        for phase in phases(taps, up):
+            lines.append('    { %s },' % ', '.join('%d' % c for c in phase))
+        lines += ['};', '']
+        entries.append('    { %d, %d, %d, %d, %s },' % (in_rate, out_rate, up, down, name))
+    lines.append('const resampler_ratio_t resampler_ratios[RESAMPLER_RATIO_NUM] = {')
+    lines += entries
+    lines += ['};', '']
+    taps, cutoff = design(FRAC_PHASES, FRAC_PHASES)
+    lines.append('/* Fractional delay at ratio 1, passband to %.0f%% of the input rate */' % (
+        (cutoff - (STOP_DB - 7.95) / (14.36 * TAPS * FRAC_PHASES) / 2) * FRAC_PHASES * 100))
+    lines.append('const int16_t resampler_frac_phases[RESAMPLER_FRAC_PHASES + 1][RESAMPLER_TAPS] = {')
+    for phase in phases(taps, FRAC_PHASES, FRAC_PHASES + 1):
+        lines.append('    { %s },' % ', '.join('%d' % c for c in phase))
+    lines += ['};', '']
+    with open(path, 'w') as f:
+        f.write('\n'.join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate the polyphase resampler tables')
+    parser.add_argument('--out', default=os.path.join(ROOT, 'components', 'speaker_core', 'resampler_table'))
+    args = parser.parse_args()
+
+    all_ratios = list(ratios())
+    max_ratio_q8 = max(-(-up * 256 // down) for _, _, up, down in all_ratios)
+    write_header(args.out + '.h', len(all_ratios), max_ratio_q8)
+    write_source(args.out + '.c')
+    size = (sum(up for _, _, up, _ in all_ratios) + FRAC_PHASES + 1) * TAPS * 2
+    print('%s.c: %d ratios, %d taps per phase, %d bytes of coefficients' % (args.out, len(all_ratios), TAPS, size))
+
+
+if __name__ == '__main__':
+    main()
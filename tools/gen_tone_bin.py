@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+#
+# Build the flash_tone partition image from tools/tones/tones.json.
+#
+# Every tone is stored as pre-decoded 16-bit mono PCM, so the firmware can play
+# it straight out of the memory-mapped partition without an MP3 decoder.
+# A tone is either synthesized from a list of [frequency_hz, duration_ms] notes
+# or loaded from a WAV file ("wav": "path/relative/to/the/spec.wav").
+#
+# Image layout (little endian):
+#   header   magic "TPCM", u16 version, u16 tone_num, u32 sample_rate, u16 channels, u16 bits
+#   entries  tone_num x { u32 offset, u32 samples }, offset is from the start of the partition
+#   samples  int16 PCM, every tone starts on a 4-byte boundary
+#
+# The tone enum used by the firmware is written next to the image reader:
+#   python3 tools/gen_tone_bin.py
+#   esptool.py --chip esp32 write_flash 0x310000 tools/audio_tone_pcm.bin
+
+import argparse
+import json
+import math
+import os
+import struct
+import sys
+import wave
+
+MAGIC = b'TPCM'
+VERSION = 1
+HEADER_FMT = '<4sHHIHH'
+ENTRY_FMT = '<II'
+FADE_MS = 4
+AMPLITUDE = 0.5
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+
+def synth(notes, rate):
+    samples = []
+    for freq, dur_ms in notes:
+        n = int(rate * dur_ms / 1000)
+        fade = max(1, int(rate * FADE_MS / 1000))
+        for i in range(n):
+            env = math.exp(-3.0 * i / n)
+            if i < fade:
+                env *= i / fade
+            if n - i < fade:
+                env *= (n - i) / fade
+            # A touch of the second harmonic keeps the chime audible on small speakers
+            s = math.sin(2 * math.pi * freq * i / rate) + 0.3 * math.sin(4 * math.pi * freq * i / rate)
+            samples.append(int(32767 * AMPLITUDE * env * s / 1.3))
+    return samples
+
+
+def load_wav(path, rate):
+    with wave.open(path, 'rb') as w:
+        if w.getsampwidth() != 2:
+            sys.exit('%s: only 16-bit WAV files are supported' % path)
+        ch = w.getnchannels()
+        src_rate = w.getframerate()
+        raw = w.readframes(w.getnframes())
+    pcm = struct.unpack('<%dh' % (len(raw) // 2), raw)
+    mono = [sum(pcm[i:i + ch]) // ch for i in range(0, len(pcm), ch)]
+    if src_rate == rate:
+        return mono
+    # Linear interpolation is plenty for short prompts
+    out = []
+    step = src_rate / rate
+    pos = 0.0
+    while pos < len(mono) - 1:
+        i = int(pos)
+        frac = pos - i
+        out.append(int(mono[i] + (mono[i + 1] - mono[i]) * frac))
+        pos += step
+    return out
+
+
+def write_header(path, names):
+    lines = [
+        '/* Generated by tools/gen_tone_bin.py from tools/tones/tones.json, do not edit */',
+        '#ifndef __AUDIO_TONE_LIST_H__',
+        '#define __AUDIO_TONE_LIST_H__',
+        '',
+        'typedef enum {',
+    ]
+    lines += ['    TONE_TYPE_%s,' % n for n in names]
+    lines += ['    TONE_TYPE_MAX,', '} tone_type_t;', '', '#endif', '']
+    with open(path, 'w') as f:
+        f.write('\n'.join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate the pre-decoded flash_tone image')
+    parser.add_argument('--spec', default=os.path.join(ROOT, 'tools', 'tones', 'tones.json'))
+    parser.add_argument('--out', default=os.path.join(ROOT, 'tools', 'audio_tone_pcm.bin'))
+    parser.add_argument('--header', default=os.path.join(ROOT, 'components', 'audio_flash_tone', 'audio_tone_list.h'))
+    parser.add_argument('--partition-size', type=lambda x: int(x, 0), default=384 * 1024)
+    args = parser.parse_args()
+
+    with open(args.spec) as f:
+        spec = json.load(f)
+    rate = spec['sample_rate']
+    spec_dir = os.path.dirname(os.path.abspath(args.spec))
+
+    tones = []
+    for t in spec['tones']:
+        if 'wav' in t:
+            tones.append(load_wav(os.path.join(spec_dir, t['wav']), rate))
+        else:
+            tones.append(synth(t['notes'], rate))
+
+    offset = struct.calcsize(HEADER_FMT) + struct.calcsize(ENTRY_FMT) * len(tones)
+    entries = b''
+    for pcm in tones:
+        offset = (offset + 3) & ~3
+        entries += struct.pack(ENTRY_FMT, offset, len(pcm))
+        offset += 2 * len(pcm)
+    image = struct.pack(HEADER_FMT, MAGIC, VERSION, len(tones), rate, 1, 16) + entries
+    for pcm in tones:
+        image += b'\0' * (((len(image) + 3) & ~3) - len(image))
+        image += struct.pack('<%dh' % len(pcm), *[max(-32768, min(32767, s)) for s in pcm])
+
+    if len(image) > args.partition_size:
+        sys.exit('Tone image is %d bytes, the flash_tone partition only holds %d' % (len(image), args.partition_size))
+    with open(args.out, 'wb') as f:
+        f.write(image)
+    write_header(args.header, [t['name'] for t in spec['tones']])
+    print('%s: %d tones, %d bytes (%.1f s at %d Hz)' % (args.out, len(tones), len(image),
+                                                       sum(len(p) for p in tones) / rate, rate))
+
+
+if __name__ == '__main__':
+    main()